@@ -104,31 +104,19 @@ template<typename EvalT, typename Traits>
 void RotatingReferenceFrame<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  double omega2 = this->angularFrequency * this->angularFrequency;
-  double xyz[3], len2, dot, r, cellVol, m, fMag, fDir[3];
+  // The centripetal force is m * omega^2 * r * rDir, where r * rDir is the
+  // component of the offset from the axis orthogonal to the axis. Using that
+  // vector directly avoids normalizing it, and gives zero force on the axis.
+  const double omega2 = this->angularFrequency * this->angularFrequency;
+  double xyz[3], dot, cellVol, mOmega2;
   for (int cell = 0; cell < workset.numCells; ++cell)
   {
-    // Determine the cell's distance from the axis of rotation
-    len2 = dot = 0.;
+    // Determine the cell's offset from the axis of rotation
+    dot = 0.;
     for (std::size_t i = 0; i < 3; i++)
     {
-      xyz[i] = fDir[i] = this->coordinates(cell, 0, i) - this->axisOrigin[i];
+      xyz[i] = this->coordinates(cell, 0, i) - this->axisOrigin[i];
       dot += xyz[i] * this->axisDirection[i];
-      len2 += xyz[i] * xyz[i];
-    }
-    r = std::sqrt(len2 - dot*dot);
-
-    // Determine the direction of force due to centripedal acceleration
-    len2 = 0.;
-    for (std::size_t i = 0; i < 3; i++)
-    {
-      fDir[i] -= this->axisDirection[i] * dot;
-      len2 += fDir[i] * fDir[i];
-    }
-    double lenReciprocal = 1./sqrt(len2);
-    for (std::size_t i = 0; i < 3; i++)
-    {
-      fDir[i] *= lenReciprocal;
     }
 
     // Determine the cell's mass
@@ -137,14 +125,13 @@ evaluateFields(typename Traits::EvalData workset)
     {
       cellVol += weights(cell,qp);
     }
-    m = val(this->density(cell)) * cellVol;
+    mOmega2 = val(this->density(cell)) * cellVol * omega2;
 
     // Determine the force due to centripedal acceleration
-    fMag = m * omega2 * r;
-
     for (std::size_t i = 0; i < 3; i++)
     {
-      this->force(cell, 0, i) = fDir[i] * fMag;
+      this->force(cell, 0, i) =
+        mOmega2 * (xyz[i] - this->axisDirection[i] * dot);
     }
   }
 }
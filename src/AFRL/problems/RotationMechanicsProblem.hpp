@@ -707,6 +707,7 @@ constructEvaluators(PHX::FieldManager<PHAL::AlbanyTraits>& fm0,
   std::string mech_source = (*fnm)["Mechanical_Source"];
   std::string defgrad = (*fnm)["F"];
   std::string J = (*fnm)["J"];
+  std::string defgrad_inv = (*fnm)["F_inv"];
   // Poromechanics variables
   std::string totStress = (*fnm)["Total_Stress"];
   std::string kcPerm = (*fnm)["KCPermeability"];
@@ -1918,6 +1919,10 @@ constructEvaluators(PHX::FieldManager<PHAL::AlbanyTraits>& fm0,
           "QP Scalar Data Layout",
           dl_->qp_scalar);
 
+      // F^{-1} is shared by the pore pressure residual
+      if (have_pore_pressure_eq_)
+        p->set<std::string>("Inverse DefGrad Name", defgrad_inv);
+
       if (Teuchos::nonnull(rc_mgr_)) {
         rc_mgr_->registerField(
             defgrad, dl_->qp_tensor, AAdapt::rc::Init::identity,
@@ -2359,6 +2364,7 @@ constructEvaluators(PHX::FieldManager<PHAL::AlbanyTraits>& fm0,
     if (have_mech_eq_) {
       p->set<bool>("Have Mechanics", true);
       p->set<std::string>("DefGrad Name", defgrad);
+      p->set<std::string>("Inverse DefGrad Name", defgrad_inv);
       p->set<Teuchos::RCP<PHX::DataLayout>>(
           "QP Tensor Data Layout",
           dl_->qp_tensor);
@@ -10,7 +10,7 @@
 namespace AMP
 {
   //constructor
-  Laser::Laser()
+  Laser::Laser() : haveCached_(false)
   {
     std::ifstream is("LaserCenter.txt", std::ifstream::in);
     TEUCHOS_TEST_FOR_EXCEPTION(!is, Teuchos::Exceptions::InvalidParameter,
@@ -38,7 +38,7 @@ namespace AMP
 
   }
   // copy constructor
-  Laser::Laser(const Laser &A)
+  Laser::Laser(const Laser &A) : haveCached_(false)
   {
     LaserData_ = A.LaserData_;
   }
@@ -58,6 +58,15 @@ namespace AMP
   // interpolate
   void Laser::getLaserPosition(RealType t, LaserCenter val, RealType &x, RealType &y, int &power, RealType &power_fraction)
   {
+    if ( haveCached_ && cached_.t == t )
+      {
+	x = cached_.x;
+	y = cached_.y;
+	power = cached_.power;
+	power_fraction = cached_.power_fraction;
+	return;
+      }
+
     Teuchos::Array<LaserCenter>::iterator low;
     // this line below works because Teuchos::Array<T> is a lighweight implementation of
     // std::vector<T>
@@ -118,6 +127,13 @@ namespace AMP
       {
 	power = 0; // off
       }
+
+    cached_.t = t;
+    cached_.x = x;
+    cached_.y = y;
+    cached_.power = power;
+    cached_.power_fraction = power_fraction;
+    haveCached_ = true;
   }
 
   // function used in some STL (standard template library) containers
@@ -42,10 +42,13 @@ namespace AMP
     ~Laser();
     // get LaserData_
     const Teuchos::Array<LaserCenter> &getLaserData();
-    // interpolate
+    // interpolate. The result for the last time is cached, since every
+    // workset of an evaluation asks for the same time.
     void getLaserPosition(RealType time, LaserCenter val, RealType &x, RealType &y, int &power, RealType &power_fraction);
   private:
     Teuchos::Array<LaserCenter> LaserData_;
+    bool haveCached_;
+    LaserCenter cached_;
   };
   
   bool compLaserCenter(LaserCenter A, LaserCenter B);
@@ -3,6 +3,7 @@
 //    This Software is released under the BSD license detailed     //
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
+#include <algorithm>
 #include <fstream>
 #include "Sacado_ParameterRegistration.hpp"
 #include "Albany_Utils.hpp"
@@ -137,6 +138,33 @@ evaluateFields(typename Traits::EvalData workset)
   ScalarT Laser_center_y = y;
   ScalarT Laser_power_fraction = power_fraction;
 
+  // skip the worksets that are entirely outside of the beam
+  bool outside = (power != 1) || workset.numCells == 0;
+  if ( !outside )
+    {
+      RealType xmin = Sacado::ScalarValue<MeshScalarT>::eval(coord_(0,0,0)), xmax = xmin;
+      RealType ymin = Sacado::ScalarValue<MeshScalarT>::eval(coord_(0,0,1)), ymax = ymin;
+      for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+        for (std::size_t qp = 0; qp < num_qps_; ++qp) {
+          const RealType X = Sacado::ScalarValue<MeshScalarT>::eval(coord_(cell,qp,0));
+          const RealType Y = Sacado::ScalarValue<MeshScalarT>::eval(coord_(cell,qp,1));
+          xmin = std::min(xmin,X); xmax = std::max(xmax,X);
+          ymin = std::min(ymin,Y); ymax = std::max(ymax,Y);
+        }
+      }
+      const RealType dx = std::max(std::max(xmin - x, x - xmax), 0.0);
+      const RealType dy = std::max(std::max(ymin - y, y - ymax), 0.0);
+      const RealType R = Sacado::ScalarValue<ScalarT>::eval(laser_beam_radius);
+      outside = (dx*dx + dy*dy >= R*R);
+    }
+  if ( outside )
+    {
+      for (std::size_t cell = 0; cell < workset.numCells; ++cell)
+        for (std::size_t qp = 0; qp < num_qps_; ++qp)
+          laser_source_(cell,qp) = 0.0;
+      return;
+    }
+
   // source function
   ScalarT pi = 3.1415926535897932;
   ScalarT LaserFlux_Max;
@@ -175,11 +203,11 @@ evaluateFields(typename Traits::EvalData workset)
 	  MeshScalarT Y = coord_(cell,qp,1);
 	  MeshScalarT Z = coord_(cell,qp,2);
 
-    ScalarT depth_profile = f1*(f2*(A*(b2*exp(2.0*a*beta*Z)-b1*exp(-2.0*a*beta*Z)) - B*(c2*exp(-2.0*a*(lambda - beta*Z))-c1*exp(2.0*a*(lambda-beta*Z)))) + f3*(exp(-beta*Z)+powder_hemispherical_reflectivity*exp(beta*Z - 2.0*lambda)));
-    MeshScalarT* XX = &coord_(cell,qp,0);
     ScalarT radius = sqrt((X - Laser_center_x)*(X - Laser_center_x) + (Y - Laser_center_y)*(Y - Laser_center_y));
-     if (radius < laser_beam_radius && beta*Z <= lambda)
+     if (radius < laser_beam_radius && beta*Z <= lambda) {
+            ScalarT depth_profile = f1*(f2*(A*(b2*exp(2.0*a*beta*Z)-b1*exp(-2.0*a*beta*Z)) - B*(c2*exp(-2.0*a*(lambda - beta*Z))-c1*exp(2.0*a*(lambda-beta*Z)))) + f3*(exp(-beta*Z)+powder_hemispherical_reflectivity*exp(beta*Z - 2.0*lambda)));
             laser_source_(cell,qp) = beta*LaserFlux_Max*pow((1.0-(radius*radius)/(laser_beam_radius*laser_beam_radius)),2)*depth_profile;
+     }
      else   laser_source_(cell,qp) = 0.0;
 	
     }
@@ -3,6 +3,7 @@
 //    This Software is released under the BSD license detailed     //
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
+#include <algorithm>
 #include <fstream>
 #include "Sacado_ParameterRegistration.hpp"
 #include "Albany_Utils.hpp"
@@ -102,6 +103,34 @@ evaluateFields(typename Traits::EvalData workset)
 
   //source function
   ScalarT laser_beam_radius = 60.0e-6;
+
+  // skip the worksets that are entirely outside of the beam
+  bool outside = (power != 1) || workset.numCells == 0;
+  if ( !outside )
+    {
+      RealType xmin = Sacado::ScalarValue<MeshScalarT>::eval(coord_(0,0,0)), xmax = xmin;
+      RealType ymin = Sacado::ScalarValue<MeshScalarT>::eval(coord_(0,0,1)), ymax = ymin;
+      for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+        for (std::size_t qp = 0; qp < num_qps_; ++qp) {
+          const RealType X = Sacado::ScalarValue<MeshScalarT>::eval(coord_(cell,qp,0));
+          const RealType Y = Sacado::ScalarValue<MeshScalarT>::eval(coord_(cell,qp,1));
+          xmin = std::min(xmin,X); xmax = std::max(xmax,X);
+          ymin = std::min(ymin,Y); ymax = std::max(ymax,Y);
+        }
+      }
+      const RealType dx = std::max(std::max(xmin - x, x - xmax), 0.0);
+      const RealType dy = std::max(std::max(ymin - y, y - ymax), 0.0);
+      const RealType R = Sacado::ScalarValue<ScalarT>::eval(laser_beam_radius);
+      outside = (dx*dx + dy*dy >= R*R);
+    }
+  if ( outside )
+    {
+      for (std::size_t cell = 0; cell < workset.numCells; ++cell)
+        for (std::size_t qp = 0; qp < num_qps_; ++qp)
+          source_(cell,qp) = 0.0;
+      return;
+    }
+
   ScalarT porosity = 0.652;
   ScalarT particle_dia = 20.0e-6;
   ScalarT powder_hemispherical_reflectivity = 0.70;
@@ -174,6 +203,9 @@ evaluateFields(typename Traits::EvalData workset)
   
   //std::cout<<" ebname ="<<workset.EBName<<std::endl; 
   //std::cout<<"current time ="<<workset.current_time<<std::endl;
+  //Value of depth profile at z = lambda
+  ScalarT depth_profile_lambda = f1*(f2*(A*(b2*exp(2.0*a*lambda)-b1*exp(-2.0*a*lambda)) - B*(c2*exp(-2.0*a*(lambda - lambda))-c1*exp(2.0*a*(lambda-lambda)))) + f3*(exp(-lambda)+powder_hemispherical_reflectivity*exp(lambda - 2.0*lambda)));
+
   // source function
   for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
     for (std::size_t qp = 0; qp < num_qps_; ++qp) {
@@ -181,9 +213,6 @@ evaluateFields(typename Traits::EvalData workset)
         MeshScalarT Y = coord_(cell,qp,1);
         MeshScalarT Z = coord_(cell,qp,2);
 		
-		//Value of depth profile at z = lambda
-		ScalarT depth_profile_lambda = f1*(f2*(A*(b2*exp(2.0*a*lambda)-b1*exp(-2.0*a*lambda)) - B*(c2*exp(-2.0*a*(lambda - lambda))-c1*exp(2.0*a*(lambda-lambda)))) + f3*(exp(-lambda)+powder_hemispherical_reflectivity*exp(lambda - 2.0*lambda)));
-  
                            
         ScalarT radius = sqrt((X - Laser_center_x)*(X - Laser_center_x) + (Y - Laser_center_y)*(Y - Laser_center_y));
         /*
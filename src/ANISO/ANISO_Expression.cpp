@@ -5,7 +5,9 @@
 //*****************************************************************//
 
 #include "ANISO_Expression.hpp"
+#include "Teuchos_TestForException.hpp"
 #include <RTC_FunctionRTC.hh>
+#include <cctype>
 
 namespace ANISO {
 
@@ -36,4 +38,62 @@ double expression_eval(
   return evaluator.getValueOfVar("val");
 }
 
+Expression::Expression(std::string const& val) :
+  is_constant(false),
+  constant(0.0),
+  rtc(Teuchos::rcp(new PG_RuntimeCompiler::Function(5))) {
+
+  // find which of x, y, z and t appear as identifiers
+  const char* const names = "xyzt";
+  for (int i=0; i < 4; ++i)
+    uses[i] = false;
+  for (std::size_t i=0; i < val.size();) {
+    if (std::isalpha(static_cast<unsigned char>(val[i])) || val[i] == '_') {
+      std::size_t j = i;
+      while (j < val.size() && (std::isalnum(static_cast<unsigned char>(val[j])) || val[j] == '_'))
+        ++j;
+      if (j == i+1)
+        for (int k=0; k < 4; ++k)
+          if (val[i] == names[k]) uses[k] = true;
+      i = j;
+    }
+    else if (std::isdigit(static_cast<unsigned char>(val[i])) || val[i] == '.') {
+      // skip numbers, including exponents such as 1e-3
+      while (i < val.size() && (std::isalnum(static_cast<unsigned char>(val[i])) || val[i] == '.'))
+        ++i;
+    }
+    else
+      ++i;
+  }
+
+  rtc->addVar("double", "x");
+  rtc->addVar("double", "y");
+  rtc->addVar("double", "z");
+  rtc->addVar("double", "t");
+  rtc->addVar("double", "val");
+  const bool compiled = rtc->addBody("val="+val);
+  TEUCHOS_TEST_FOR_EXCEPTION(!compiled, std::runtime_error,
+      "ANISO::Expression: cannot compile \"" << val << "\"\n");
+
+  if (!uses[0] && !uses[1] && !uses[2] && !uses[3]) {
+    constant = eval(0.0, 0.0, 0.0, 0.0);
+    is_constant = true;
+  }
+}
+
+double Expression::eval(
+    const double x,
+    const double y,
+    const double z,
+    const double t) const {
+  if (is_constant) return constant;
+  rtc->varValueFill(0,x);
+  rtc->varValueFill(1,y);
+  rtc->varValueFill(2,z);
+  rtc->varValueFill(3,t);
+  rtc->varValueFill(4,0.0);
+  rtc->execute();
+  return rtc->getValueOfVar("val");
+}
+
 }
@@ -8,6 +8,11 @@
 #define ANISO_EXPRESSION_HPP
 
 #include <string>
+#include "Teuchos_RCP.hpp"
+
+namespace PG_RuntimeCompiler {
+class Function;
+}
 
 namespace ANISO {
 
@@ -20,6 +25,98 @@ double expression_eval(
     const double z,
     const double t);
 
+//! An expression in x, y, z and t, compiled once at construction.
+//! Expressions that use none of the variables are evaluated once and
+//! stored as a constant.
+class Expression {
+
+  public:
+
+    explicit Expression(std::string const& val);
+
+    bool isConstant() const { return is_constant; }
+
+    double eval(
+        const double x,
+        const double y,
+        const double z,
+        const double t) const;
+
+    //! Evaluate value(cell, qp) at the points coord(cell, qp, :) of a
+    //! workset. Only the coordinates the expression uses are read.
+    template <typename CoordT, typename ValueT>
+    void evalWorkset(
+        const CoordT& coord,
+        ValueT& value,
+        const int num_cells,
+        const int num_qps,
+        const double t) const;
+
+    //! As evalWorkset, into the component comp of value(cell, qp, comp)
+    template <typename CoordT, typename ValueT>
+    void evalWorksetComponent(
+        const CoordT& coord,
+        ValueT& value,
+        const int num_cells,
+        const int num_qps,
+        const double t,
+        const int comp) const;
+
+  private:
+
+    template <typename CoordT>
+    double evalAt(
+        const CoordT& coord,
+        const int cell,
+        const int qp,
+        const double t) const;
+
+    bool is_constant;
+    double constant;
+    bool uses[4];
+    Teuchos::RCP<PG_RuntimeCompiler::Function> rtc;
+
+};
+
+template <typename CoordT>
+double Expression::evalAt(
+    const CoordT& coord,
+    const int cell,
+    const int qp,
+    const double t) const {
+  if (is_constant) return constant;
+  double x = 0.0, y = 0.0, z = 0.0;
+  if (uses[0]) x = coord(cell,qp,0);
+  if (uses[1]) y = coord(cell,qp,1);
+  if (uses[2]) z = coord(cell,qp,2);
+  return eval(x, y, z, t);
+}
+
+template <typename CoordT, typename ValueT>
+void Expression::evalWorkset(
+    const CoordT& coord,
+    ValueT& value,
+    const int num_cells,
+    const int num_qps,
+    const double t) const {
+  for (int cell=0; cell < num_cells; ++cell)
+    for (int qp=0; qp < num_qps; ++qp)
+      value(cell, qp) = evalAt(coord, cell, qp, t);
+}
+
+template <typename CoordT, typename ValueT>
+void Expression::evalWorksetComponent(
+    const CoordT& coord,
+    ValueT& value,
+    const int num_cells,
+    const int num_qps,
+    const double t,
+    const int comp) const {
+  for (int cell=0; cell < num_cells; ++cell)
+    for (int qp=0; qp < num_qps; ++qp)
+      value(cell, qp, comp) = evalAt(coord, cell, qp, t);
+}
+
 }
 
 #endif
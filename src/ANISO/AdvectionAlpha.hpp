@@ -12,6 +12,7 @@
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_MDField.hpp"
 #include "Albany_Layouts.hpp"
+#include "ANISO_Expression.hpp"
 
 namespace ANISO {
 
@@ -40,7 +41,7 @@ class AdvectionAlpha :
 
     int num_qps;
     int num_dims;
-    Teuchos::Array<std::string> alpha_val;
+    Teuchos::Array<Teuchos::RCP<Expression> > alpha_expr;
 
     PHX::MDField<const MeshScalarT, Cell, QuadPoint, Dim> coord;
     PHX::MDField<ScalarT, Cell, QuadPoint, Dim> alpha;
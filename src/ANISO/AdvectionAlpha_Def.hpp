@@ -18,12 +18,16 @@ AdvectionAlpha(
     const Teuchos::RCP<Albany::Layouts>& dl) :
   coord     (p.get<std::string>("Coordinate Name"), dl->qp_vector),
   alpha     (p.get<std::string>("Alpha Name"), dl->qp_vector),
-  alpha_mag (p.get<std::string>("Alpha Magnitude Name"), dl->qp_scalar),
-  alpha_val (p.get<Teuchos::Array<std::string> >("Alpha Value")) {
+  alpha_mag (p.get<std::string>("Alpha Magnitude Name"), dl->qp_scalar) {
 
   num_qps = dl->node_qp_vector->dimension(2);
   num_dims = dl->node_qp_vector->dimension(3);
 
+  Teuchos::Array<std::string> alpha_val =
+    p.get<Teuchos::Array<std::string> >("Alpha Value");
+  for (int dim=0; dim < alpha_val.size(); ++dim)
+    alpha_expr.push_back(Teuchos::rcp(new Expression(alpha_val[dim])));
+
   this->addDependentField(coord);
   this->addEvaluatedField(alpha);
   this->addEvaluatedField(alpha_mag);
@@ -45,18 +49,15 @@ template<typename EvalT, typename Traits>
 void AdvectionAlpha<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset) {
 
+  for (int dim=0; dim < num_dims; ++dim)
+    alpha_expr[dim]->evalWorksetComponent(
+        coord, alpha, workset.numCells, num_qps, 0, dim);
+
   for (int cell=0; cell < workset.numCells; ++cell) {
     for (int qp=0; qp < num_qps; ++qp) {
       alpha_mag(cell, qp) = 0.0;
-      for (int dim=0; dim < num_dims; ++dim) {
-        alpha(cell, qp, dim) = expression_eval(
-            alpha_val[dim],
-            coord(cell,qp,0),
-            coord(cell,qp,1),
-            coord(cell,qp,2),
-            0);
+      for (int dim=0; dim < num_dims; ++dim)
         alpha_mag(cell, qp) += alpha(cell, qp, dim)*alpha(cell, qp, dim);
-      }
       alpha_mag(cell, qp) = std::sqrt(alpha_mag(cell, qp));
     }
   }
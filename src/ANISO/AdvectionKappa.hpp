@@ -12,6 +12,7 @@
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_MDField.hpp"
 #include "Albany_Layouts.hpp"
+#include "ANISO_Expression.hpp"
 
 namespace ANISO {
 
@@ -40,7 +41,7 @@ class AdvectionKappa :
 
     int num_qps;
     int num_dims;
-    std::string kappa_val;
+    Teuchos::RCP<Expression> kappa_expr;
 
     PHX::MDField<const MeshScalarT, Cell, QuadPoint, Dim> coord;
     PHX::MDField<ScalarT, Cell, QuadPoint> kappa;
@@ -17,8 +17,9 @@ AdvectionKappa(
     const Teuchos::ParameterList& p,
     const Teuchos::RCP<Albany::Layouts>& dl) :
   coord     (p.get<std::string>("Coordinate Name"), dl->qp_vector),
-  kappa     (p.get<std::string>("Kappa Name"), dl->qp_scalar),
-  kappa_val (p.get<std::string>("Kappa Value")) {
+  kappa     (p.get<std::string>("Kappa Name"), dl->qp_scalar) {
+
+  kappa_expr = Teuchos::rcp(new Expression(p.get<std::string>("Kappa Value")));
 
   num_qps = dl->node_qp_vector->dimension(2);
   num_dims = dl->node_qp_vector->dimension(3);
@@ -42,18 +43,7 @@ template<typename EvalT, typename Traits>
 void AdvectionKappa<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset) {
 
-  for (int cell=0; cell < workset.numCells; ++cell) {
-    for (int qp=0; qp < num_qps; ++qp) {
-
-      kappa(cell, qp) = expression_eval(
-          kappa_val,
-          coord(cell,qp,0),
-          coord(cell,qp,1),
-          coord(cell,qp,2),
-          0);
-
-    }
-  }
+  kappa_expr->evalWorkset(coord, kappa, workset.numCells, num_qps, 0);
 
 }
 
@@ -7,6 +7,7 @@
 #include "ATO_SolverEpetra.hpp"
 #include "ATO_OptimizationProblem.hpp"
 #include "ATO_TopoTools.hpp"
+#include "ATO_PointGrid.hpp"
 #include "ATO_Types.hpp"
 
 /* GAH FIXME - Silence warning:
@@ -1747,89 +1748,118 @@ ATO::SpatialFilter::buildOperator(
       }
     }
   
-    std::map< GlobalPoint, std::set<GlobalPoint> > neighbors;
-  
-    double filter_radius_sqrd = filterRadius*filterRadius;
-    // awful n^2 search... all against all
+    // collect the distinct nodes on this processor.  Trial nodes are the nodes
+    // that may appear in the neighborhood of another node.
     size_t dimension   = app->getDiscretization()->getNumDim();
-    GlobalPoint homeNode;
+    std::vector<GlobalPoint> nodes;
+    std::vector<bool> isTrialNode;
+    std::map<int,int> nodeIndex;
     size_t num_worksets = coords.size();
-    for (size_t home_ws=0; home_ws<num_worksets; home_ws++) {
-      int home_num_cells = coords[home_ws].size();
-      for (int home_cell=0; home_cell<home_num_cells; home_cell++) {
-        size_t num_nodes = coords[home_ws][home_cell].size();
-        for (int home_node=0; home_node<num_nodes; home_node++) {
-          homeNode.gid = wsElNodeID[home_ws][home_cell][home_node];
-          if(neighbors.find(homeNode)==neighbors.end()) {  // if this node was already accessed just skip
-            for (int dim=0; dim<dimension; dim++)  {
-              homeNode.coords[dim] = coords[home_ws][home_cell][home_node][dim];
-            }
-            std::set<GlobalPoint> my_neighbors;
-            if( excludeNodes.find(homeNode.gid) == excludeNodes.end() ){
-              for (size_t trial_ws=0; trial_ws<num_worksets; trial_ws++) {
-                if( blocks.size() > 0 && 
-                    find(blocks.begin(), blocks.end(), wsEBNames[trial_ws]) == blocks.end() ) continue;
-                int trial_num_cells = coords[trial_ws].size();
-                for (int trial_cell=0; trial_cell<trial_num_cells; trial_cell++) {
-                  size_t trial_num_nodes = coords[trial_ws][trial_cell].size();
-                  for (int trial_node=0; trial_node<trial_num_nodes; trial_node++) {
-                    int gid = wsElNodeID[trial_ws][trial_cell][trial_node];
-                    if( excludeNodes.find(gid) != excludeNodes.end() ) continue; // don't add excluded nodes
-                    double tmp;
-                    double delta_norm_sqr = 0.;
-                    for (int dim=0; dim<dimension; dim++)  { //individual coordinates
-                      tmp = homeNode.coords[dim]-coords[trial_ws][trial_cell][trial_node][dim];
-                      delta_norm_sqr += tmp*tmp;
-                    }
-                    if(delta_norm_sqr<=filter_radius_sqrd) {
-                      GlobalPoint newIntx;
-                      newIntx.gid = wsElNodeID[trial_ws][trial_cell][trial_node];
-                      for (int dim=0; dim<dimension; dim++) 
-                        newIntx.coords[dim] = coords[trial_ws][trial_cell][trial_node][dim];
-                      my_neighbors.insert(newIntx);
-                    }
-                  }
-                }
-              }
-            }
-            neighbors.insert( std::pair<GlobalPoint,std::set<GlobalPoint> >(homeNode,my_neighbors) );
+    for (size_t ws=0; ws<num_worksets; ws++) {
+      bool inBlocks = blocks.size() == 0 || 
+                      find(blocks.begin(), blocks.end(), wsEBNames[ws]) != blocks.end();
+      int num_cells = coords[ws].size();
+      for (int cell=0; cell<num_cells; cell++) {
+        size_t num_nodes = coords[ws][cell].size();
+        for (int node=0; node<num_nodes; node++) {
+          int gid = wsElNodeID[ws][cell][node];
+          std::pair<std::map<int,int>::iterator,bool> 
+            inserted = nodeIndex.insert(std::pair<int,int>(gid,nodes.size()));
+          if( inserted.second ){
+            GlobalPoint newNode;
+            newNode.gid = gid;
+            for (int dim=0; dim<dimension; dim++) 
+              newNode.coords[dim] = coords[ws][cell][node][dim];
+            nodes.push_back(newNode);
+            isTrialNode.push_back(false);
           }
+          if( inBlocks && excludeNodes.find(gid) == excludeNodes.end() )
+            isTrialNode[inserted.first->second] = true;
         }
       }
     }
 
-    // communicate neighbor data
-    importNeighbors(neighbors,importer,*localNodeMap,exporter,*overlapNodeMap);
+    std::vector<int> trialNodes;
+    std::vector<double> trialCoords;
+    int num_nodes = nodes.size();
+    for (int i=0; i<num_nodes; i++) {
+      if( !isTrialNode[i] ) continue;
+      trialNodes.push_back(i);
+      trialCoords.insert(trialCoords.end(), nodes[i].coords, nodes[i].coords+3);
+    }
+    ATO::PointGrid trialGrid(trialCoords, dimension, filterRadius);
 
+    // neighbor lists in compressed row storage:  the neighbors of nodes[i] are
+    // neighborPoints[neighborOffsets[i]] ... neighborPoints[neighborOffsets[i+1]-1].
+    double filter_radius_sqrd = filterRadius*filterRadius;
+    std::vector<int> neighborOffsets(num_nodes+1,0);
+    std::vector<GlobalPoint> neighborPoints;
+    for (int i=0; i<num_nodes; i++) {
+      const GlobalPoint& homeNode = nodes[i];
+      if( excludeNodes.find(homeNode.gid) == excludeNodes.end() ){
+        trialGrid.forEachCandidate(homeNode.coords, [&](int trial){
+          const GlobalPoint& trialNode = nodes[trialNodes[trial]];
+          double delta_norm_sqr = 0.;
+          for (int dim=0; dim<dimension; dim++)  { //individual coordinates
+            double tmp = homeNode.coords[dim]-trialNode.coords[dim];
+            delta_norm_sqr += tmp*tmp;
+          }
+          if(delta_norm_sqr<=filter_radius_sqrd) neighborPoints.push_back(trialNode);
+        });
+      }
+      neighborOffsets[i+1] = neighborPoints.size();
+    }
+
+    // communicate neighbor data
+    if( localNodeMap->Comm().NumProc() > 1 ){
+      std::map< GlobalPoint, std::set<GlobalPoint> > neighbors;
+      for (int i=0; i<num_nodes; i++)
+        neighbors.insert( std::pair<GlobalPoint,std::set<GlobalPoint> >(nodes[i],
+          std::set<GlobalPoint>(neighborPoints.begin()+neighborOffsets[i],
+                                neighborPoints.begin()+neighborOffsets[i+1])) );
+
+      importNeighbors(neighbors,importer,*localNodeMap,exporter,*overlapNodeMap);
+
+      nodes.clear();
+      neighborPoints.clear();
+      neighborOffsets.assign(1,0);
+      for (std::map<GlobalPoint,std::set<GlobalPoint> >::iterator 
+          it=neighbors.begin(); it!=neighbors.end(); ++it) { 
+        nodes.push_back(it->first);
+        neighborPoints.insert(neighborPoints.end(), it->second.begin(), it->second.end());
+        neighborOffsets.push_back(neighborPoints.size());
+      }
+      num_nodes = nodes.size();
+    }
     
-    // for each interior node, search boundary nodes for additional interactions off processor.
-    
-  
     // now build filter operator
     int numnonzeros = 0;
     filterOperator = Teuchos::rcp(new Epetra_CrsMatrix(Copy,*localNodeMap,numnonzeros));
-    for (std::map<GlobalPoint,std::set<GlobalPoint> >::iterator 
-        it=neighbors.begin(); it!=neighbors.end(); ++it) { 
-      GlobalPoint homeNode = it->first;
+    std::vector<int> neighborGIDs;
+    std::vector<double> weights;
+    for (int i=0; i<num_nodes; i++) {
+      const GlobalPoint& homeNode = nodes[i];
       int home_node_gid = homeNode.gid;
-      std::set<GlobalPoint> connected_nodes = it->second;
-      if( connected_nodes.size() > 0 ){
-        for (std::set<GlobalPoint>::iterator 
-             set_it=connected_nodes.begin(); set_it!=connected_nodes.end(); ++set_it) {
-           int neighbor_node_gid = set_it->gid;
-           const double* coords = &(set_it->coords[0]);
+      int num_connected = neighborOffsets[i+1]-neighborOffsets[i];
+      if( num_connected > 0 ){
+        neighborGIDs.resize(num_connected);
+        weights.resize(num_connected);
+        for (int j=0; j<num_connected; j++) {
+           const GlobalPoint& neighbor = neighborPoints[neighborOffsets[i]+j];
+           const double* coords = &(neighbor.coords[0]);
            double distance = 0.0;
            for (int dim=0; dim<dimension; dim++) 
              distance += (coords[dim]-homeNode.coords[dim])*(coords[dim]-homeNode.coords[dim]);
            distance = (distance > 0.0) ? sqrt(distance) : 0.0;
-           double weight = filterRadius - distance;
-           filterOperator->InsertGlobalValues(home_node_gid,1,&weight,&neighbor_node_gid);
+           neighborGIDs[j] = neighbor.gid;
+           weights[j] = filterRadius - distance;
         }
       } else {
          // if the list of connected nodes is empty, still add a one on the diagonal.
-         double weight = 1.0;
-         filterOperator->InsertGlobalValues(home_node_gid,1,&weight,&home_node_gid);
+         neighborGIDs.assign(1,home_node_gid);
+         weights.assign(1, 1.0);
       }
+      filterOperator->InsertGlobalValues(home_node_gid,neighborGIDs.size(),&weights[0],&neighborGIDs[0]);
     }
   
     filterOperator->FillComplete();
@@ -2039,34 +2069,40 @@ ATO::SpatialFilter::importNeighbors(
       index++;
     }
   
-    // add newNeighbors map to neighbors map
-    std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator new_nbr;
+    // add newNeighbors map to neighbors map.  The received points are binned
+    // so that each home point only checks the received points near it.
+    std::vector<ATO::GlobalPoint> remotePoints;
+    std::vector<double> remoteCoords;
+    std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator nbrs;
+    std::set< ATO::GlobalPoint >::iterator remote_point;
+    for(nbrs=newNeighbors.begin(); nbrs!=newNeighbors.end(); nbrs++){
+      std::set<ATO::GlobalPoint>& remote_points = nbrs->second;
+      for(remote_point=remote_points.begin(); 
+          remote_point!=remote_points.end();
+          remote_point++){
+        remotePoints.push_back(*remote_point);
+        remoteCoords.insert(remoteCoords.end(), remote_point->coords, remote_point->coords+3);
+      }
+    }
+    ATO::PointGrid remoteGrid(remoteCoords, 3, filterRadius);
+
     std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator nbr;
-    std::set< ATO::GlobalPoint >::iterator newPoint;
     // loop on total neighbor list
     for(nbr=neighbors.begin(); nbr!=neighbors.end(); nbr++){
   
       std::set<ATO::GlobalPoint>& pointSet = nbr->second;
       int pointSetSize = pointSet.size();
   
-      ATO::GlobalPoint home_point = nbr->first;
-      double* home_coords = &(home_point.coords[0]);
-      std::map< ATO::GlobalPoint, std::set<ATO::GlobalPoint> >::iterator nbrs;
-      std::set< ATO::GlobalPoint >::iterator remote_point;
-      for(nbrs=newNeighbors.begin(); nbrs!=newNeighbors.end(); nbrs++){
-        std::set<ATO::GlobalPoint>& remote_points = nbrs->second;
-        for(remote_point=remote_points.begin(); 
-            remote_point!=remote_points.end();
-            remote_point++){
-          const double* remote_coords = &(remote_point->coords[0]);
-          double distance = 0.0;
-          for(int i=0; i<3; i++)
-            distance += (remote_coords[i]-home_coords[i])*(remote_coords[i]-home_coords[i]);
-          distance = (distance > 0.0) ? sqrt(distance) : 0.0;
-          if( distance < filterRadius )
-            pointSet.insert(*remote_point);
-        }
-      }
+      const double* home_coords = &(nbr->first.coords[0]);
+      remoteGrid.forEachCandidate(home_coords, [&](int remote){
+        const double* remote_coords = &(remotePoints[remote].coords[0]);
+        double distance = 0.0;
+        for(int i=0; i<3; i++)
+          distance += (remote_coords[i]-home_coords[i])*(remote_coords[i]-home_coords[i]);
+        distance = (distance > 0.0) ? sqrt(distance) : 0.0;
+        if( distance < filterRadius )
+          pointSet.insert(remotePoints[remote]);
+      });
       // see if any new points where found off processor.  
       newPoints += (pointSet.size() - pointSetSize);
     }
@@ -126,6 +126,8 @@ Optimizer(optimizerParams)
   dfdp = NULL;
   dgdp = NULL;
   dmdp = NULL;
+  _useLinearMeasure = false;
+  _linearMeasureBase = 0.0;
 
   _moveLimit     = optimizerParams.get<double>("Move Limiter");
   _stabExponent  = optimizerParams.get<double>("Stabilization Parameter");
@@ -150,6 +152,12 @@ Optimizer(optimizerParams)
     if( measureParams.isType<bool>("Use Newton Search") )
       _useNewtonSearch   = measureParams.get<bool>("Use Newton Search");
     else _useNewtonSearch = true;
+    if( measureParams.isType<bool>("Linearized Bisection") )
+      _linearizedBisection = measureParams.get<bool>("Linearized Bisection");
+    else _linearizedBisection = false;
+    if( measureParams.isType<int>("Maximum Linearization Corrections") )
+      _maxLinearCorrections = measureParams.get<int>("Maximum Linearization Corrections");
+    else _maxLinearCorrections = 5;
 
   } else
   TEUCHOS_TEST_FOR_EXCEPTION(
@@ -784,6 +792,66 @@ bool ConvergenceTest::RelRunningDF::passed(double delta_f, double delta_p, bool
 void
 Optimizer_OC::computeUpdatedTopology()
 /******************************************************************************/
+{
+  if( !_linearizedBisection ){
+    enforceMeasure();
+    return;
+  }
+
+  // Bisect on the linearization of the measure about p_last, m(p_last) +
+  // dmdp.(p-p_last), which is a local sum and one reduction per iteration.
+  // Only the accepted topology is integrated.  If the integrated measure
+  // misses the target, the linearization is shifted to match it and the
+  // search is repeated.
+  solverInterface->ComputeMeasure(_measureType, p_last, _linearMeasureBase, _measureIntMethod);
+
+  double measure = 0.0;
+  int ncorrections = 0;
+  while(true) {
+    _useLinearMeasure = true;
+    double estimate = enforceMeasure();
+    _useLinearMeasure = false;
+
+    solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+    double resid = measure - _measureConstraint*_optMeasure;
+    if(comm->getRank()==0){
+      std::cout << "Measure enforcement (integrated): Residual = " << resid/_optMeasure << std::endl;
+    }
+    if( fabs(resid) <= _measureConvTol*_optMeasure || ncorrections >= _maxLinearCorrections ) break;
+
+    _linearMeasureBase += measure - estimate;
+    ncorrections++;
+  }
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    ( fabs(measure - _measureConstraint*_optMeasure) > _measureAccpTol*_optMeasure ),
+    Teuchos::Exceptions::InvalidParameter, 
+    std::endl << "Enforcement of measure constraint failed:  Exceeded max linearization corrections" 
+    << std::endl);
+}
+
+/******************************************************************************/
+void
+Optimizer_OC::computeBisectionMeasure(double& measure)
+/******************************************************************************/
+{
+  if( !_useLinearMeasure ){
+    solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+    return;
+  }
+
+  double dm = 0.0;
+  for(int i=0; i<numOptDofs; i++)
+    dm += dmdp[i]*(p[i]-p_last[i]);
+  double global_dm = 0.0;
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, 1, &dm, &global_dm);
+  measure = _linearMeasureBase + global_dm;
+}
+
+/******************************************************************************/
+double
+Optimizer_OC::enforceMeasure()
+/******************************************************************************/
 {
 #ifdef OUTPUT_TO_SCREEN
   std::cout << "DEBUG: " << __PRETTY_FUNCTION__ << "\n";
@@ -843,7 +911,7 @@ Optimizer_OC::computeUpdatedTopology()
     // compute new measure
     if( _useNewtonSearch ){
       double prevResidual = measure - _measureConstraint*_optMeasure;
-      solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+      computeBisectionMeasure(measure);
       double newResidual = measure - _measureConstraint*_optMeasure;
       if( newResidual > 0.0 ){
         residRatio = newResidual/prevResidual;
@@ -852,7 +920,7 @@ Optimizer_OC::computeUpdatedTopology()
         break;
       } else v2 = vmid;
     } else {
-      solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+      computeBisectionMeasure(measure);
       double newResidual = measure - _measureConstraint*_optMeasure;
       if( newResidual > 0.0 ){
         v1 = vmid;
@@ -898,7 +966,7 @@ Optimizer_OC::computeUpdatedTopology()
       p[i] = p_new;
     }
     // compute new measure
-    solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+    computeBisectionMeasure(measure);
     double f0 =  (measure - _measureConstraint*_optMeasure);
 
     if(comm->getRank()==0){
@@ -931,7 +999,7 @@ Optimizer_OC::computeUpdatedTopology()
       p[i] = p_new;
     }
     // compute new measure
-    solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+    computeBisectionMeasure(measure);
     double f1 =  (measure - _measureConstraint*_optMeasure);
 
     if( f1-f0 == 0.0 ) break;
@@ -972,7 +1040,7 @@ Optimizer_OC::computeUpdatedTopology()
       }
   
       // compute new measure
-      solverInterface->ComputeMeasure(_measureType, p, measure, _measureIntMethod);
+      computeBisectionMeasure(measure);
       double newResidual = measure - _measureConstraint*_optMeasure;
       if( newResidual > 0.0 ){
         v1 = vmid;
@@ -995,8 +1063,7 @@ Optimizer_OC::computeUpdatedTopology()
     std::endl << "Enforcement of measure constraint failed:  Exceeded max iterations" 
     << std::endl);
 
-
-
+  return measure;
 }
 
 #ifdef ATO_USES_NLOPT
@@ -66,6 +66,8 @@ class Optimizer_OC : public Optimizer {
   void Initialize();
  protected:
   void computeUpdatedTopology();
+  double enforceMeasure();
+  void computeBisectionMeasure(double& measure);
 
   double* p;
   double* p_last;
@@ -95,6 +97,10 @@ class Optimizer_OC : public Optimizer {
   double _maxMeasure;
   double _optMeasure;
   bool   _useNewtonSearch;
+  bool   _linearizedBisection;
+  int    _maxLinearCorrections;
+  bool   _useLinearMeasure;
+  double _linearMeasureBase;
 
 };
 
@@ -1,5 +1,6 @@
 #include "ATOT_XFEM_Preconditioner.hpp"
 #include "Albany_Utils.hpp"
+#include <cmath>
 #include <string>
 
 
@@ -22,33 +23,25 @@ int Preconditioner::BuildPreconditioner(
   domainMap_ = jacT->getDomainMap();
   rangeMap_  = jacT->getRangeMap(); 
 
-  // initially this is a diagonal matrix
-  int numEntriesPerRow = 1;
-  
-  operator_ = rcp(new Tpetra_CrsMatrix(jacT->getRowMap(), jacT->getColMap(), numEntriesPerRow, Tpetra::ProfileType::StaticProfile));
-  
-  auto nRows = operator_->getNodeNumRows();
-  double zero = 0.0;
-  //IKT: err is not set anywhere b/c fillComplete and insertLocalValues routines are 
-  //void, not int, in Tpetra.
-  int err;
-  for(int iRow=0; iRow<nRows; ++iRow)
-    operator_->insertLocalValues(iRow,numEntriesPerRow,&zero,&iRow);
-  operator_->fillComplete();
-  
-  // for now, just do inverse row sum.  Later, we'll hook in Cogent.
-  RCP<Tpetra_Vector> invRowSums = Teuchos::rcp(new Tpetra_Vector(jacT->getRowMap()));
-  Albany::InvRowSum(invRowSums, jacT); 
-  //IKT, FIXME: ReplaceDiagonalEntries has not been tested!  Need to test prior to using. 
-  Albany::ReplaceDiagonalEntries(operator_, invRowSums);
+  // the vector is reused between builds as long as the rows are the same
+  if( invRowSums_.is_null() || !invRowSums_->getMap()->isSameAs(*jacT->getRowMap()) )
+    invRowSums_ = rcp(new Tpetra_Vector(jacT->getRowMap()));
 
-  invOperator_ = rcp(new Tpetra_CrsMatrix(jacT->getRowMap(), jacT->getColMap(), numEntriesPerRow, Tpetra::ProfileType::StaticProfile));
-  invOperator_->fillComplete();
-  
-  RCP<Tpetra_Vector> rowSums = rcp(new Tpetra_Vector(*invRowSums));
-  rowSums->reciprocal(*invRowSums);
-  //IKT, FIXME: ReplaceDiagonalEntries has not been tested!  Need to test prior to using. 
-  Albany::ReplaceDiagonalEntries(invOperator_, rowSums);
+  // for now, just do inverse row sum.  Later, we'll hook in Cogent.
+  // The sums are taken over the local matrix directly rather than row copies.
+  const auto localMatrix = jacT->getLocalMatrix();
+  const auto rowMap = Kokkos::create_mirror_view(localMatrix.graph.row_map);
+  const auto values = Kokkos::create_mirror_view(localMatrix.values);
+  Kokkos::deep_copy(rowMap, localMatrix.graph.row_map);
+  Kokkos::deep_copy(values, localMatrix.values);
+
+  Teuchos::ArrayRCP<ST> invRowSums = invRowSums_->get1dViewNonConst();
+  const LO nRows = jacT->getNodeNumRows();
+  for(LO iRow=0; iRow<nRows; ++iRow){
+    ST scale = 0.0;
+    for(auto j=rowMap(iRow); j<rowMap(iRow+1); ++j) scale += std::abs(values(j));
+    invRowSums[iRow] = (scale < 1.0e-16) ? 0.0 : 1.0/scale;
+  }
   return 0; 
 }
 
@@ -60,7 +53,8 @@ void Preconditioner::apply(
       Teuchos::ETransp mode, ST alpha, ST beta) const
 /*******************************************************************************/
 { 
-  invOperator_->apply(X, Y, Teuchos::NO_TRANS, 1.0, 0.0); 
+  // Y = beta*Y + alpha*diag(invRowSums)*X, as ApplyInverse in the Epetra version
+  Y.elementWiseMultiply(alpha, *invRowSums_, X, beta);
 }
 
 } // end namespace XFEM
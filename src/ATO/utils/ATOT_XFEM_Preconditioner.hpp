@@ -45,8 +45,8 @@ namespace XFEM {
       ST alpha = Teuchos::ScalarTraits<ST>::one(),
       ST beta = Teuchos::ScalarTraits<ST>::zero()) const;
 
-    /** */
-    bool hasTransposeApply() const {return useTranspose_;}
+    /** The operator is diagonal, so its transpose is itself */
+    bool hasTransposeApply() const {return true;}
 
     /** */
     Teuchos::RCP<const Tpetra_Map> getDomainMap() const {return domainMap_;} 
@@ -70,9 +70,9 @@ namespace XFEM {
     /** */
     RCP<const Tpetra_Map> rangeMap_;
 
-    /** */
-    RCP<Tpetra_CrsMatrix> operator_;
-    RCP<Tpetra_CrsMatrix> invOperator_;
+    /** Inverse row sums of the Jacobian.  Rows with a zero sum (void
+        nodes) are zero. */
+    RCP<Tpetra_Vector> invRowSums_;
 
   };
 } // end namespace XFEM
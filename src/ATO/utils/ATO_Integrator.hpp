@@ -162,8 +162,12 @@ class SubIntegrator
 
   template <typename N, typename V, typename P>
   void Project( const Kokkos::DynRankView<N, PHX::Device>& topoVals, 
+                const std::vector<RealType>& basisValues,
                 std::vector<Simplex<V,P> >& implicitPolys);
 
+  template <typename V, typename P>
+  void cacheBasisValues(uint level, const std::vector<Simplex<V,P> >& implicitPolys);
+
   template<typename C, typename V, typename P>
   void Dice(const std::vector<Simplex<V,P> >& implicitPolys, const V zeroVal, 
        const C comparison, std::vector<Simplex<V,P> >& explicitPolys);
@@ -189,6 +193,10 @@ class SubIntegrator
   std::vector< std::vector<Simplex<RealType,RealType> > > refinement;
   std::vector< std::vector<Simplex<DFadType,DFadType> > > DFadRefinement;
 
+  // basis values at the simplex vertices of each refinement level, stored
+  // flat as [(simplex*nVerts + vertex)*numNodes + node]
+  std::vector< std::vector<RealType> > refinementBasisValues;
+
   uint nDims;
 
   uint maxRefinements;
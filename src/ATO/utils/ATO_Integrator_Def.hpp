@@ -70,7 +70,28 @@ void ATO::SubIntegrator::getMeasure(
   while (1){
     std::vector<Simplex<RealType,RealType> >& implicitPolys = refinement[level];
 
-    Project(/*in*/ topoVals, /*in/out*/ implicitPolys);
+    if( level >= refinementBasisValues.size() ) cacheBasisValues(level, implicitPolys);
+    Project(/*in*/ topoVals, refinementBasisValues[level], /*in/out*/ implicitPolys);
+
+    // if no simplex is cut the cell is either empty or full, so skip the dicing
+    if( level+1 >= maxRefinements ){
+      bool allAbove = true, allBelow = true;
+      typename std::vector<Simplex<RealType,RealType> >::iterator it;
+      for(it=implicitPolys.begin(); it!=implicitPolys.end(); it++){
+        const std::vector<RealType>& vals = it->fieldvals;
+        for(uint i=0; i<vals.size(); i++){
+          if( !(vals[i] > zeroVal) ) allAbove = false;
+          if( !(vals[i] < zeroVal) ) allBelow = false;
+        }
+      }
+      if( allAbove || allBelow ){
+        measure = 0.0;
+        if( (sense == Sense::Positive) == allAbove )
+          for(it=implicitPolys.begin(); it!=implicitPolys.end(); it++)
+            measure += Volume(*it, coordCon);
+        return;
+      }
+    }
  
     std::vector<Simplex<RealType,RealType> > explicitPolys;
     if( sense == Sense::Positive){
@@ -128,7 +149,8 @@ void ATO::SubIntegrator::getMeasure(
   while (1){
     std::vector<Simplex<DFadType,DFadType> >& implicitPolys = DFadRefinement[level];
 
-    Project(/*in*/ Tfad, /*in/out*/ implicitPolys);
+    if( level >= refinementBasisValues.size() ) cacheBasisValues(level, implicitPolys);
+    Project(/*in*/ Tfad, refinementBasisValues[level], /*in/out*/ implicitPolys);
  
     std::vector<Simplex<DFadType,DFadType> > explicitPolys;
     DFadType TZeroVal = zeroVal;
@@ -300,6 +322,7 @@ void ATO::SubIntegrator::Refine(
 template<typename N, typename V, typename P>
 void ATO::SubIntegrator::Project(
      const Kokkos::DynRankView<N, PHX::Device>& topoVals, 
+     const std::vector<RealType>& basisValues,
      std::vector<Simplex<V,P> >& implicitPolys)
 //******************************************************************************//
 {
@@ -307,29 +330,54 @@ void ATO::SubIntegrator::Project(
   int numNodes = basis->getCardinality();
   int nPoints = implicitPolys[0].points.size();
 
-  Kokkos::DynRankView<V, PHX::Device> Nvals("ZZZ", numNodes, nPoints);
-  Kokkos::DynRankView<P, PHX::Device> evalPoints("ZZZ", nPoints, nDims);
+  const RealType* Nvals = basisValues.data();
 
   typename std::vector<Simplex<V,P> >::iterator it;
   for(it=implicitPolys.begin(); it!=implicitPolys.end(); it++){
    
     std::vector<V>& vals = it->fieldvals;
-    std::vector<typename Vector3D<P>::Type>& pnts = it->points;
 
-    for(int i=0; i<nPoints; i++)
-      for(uint j=0; j<nDims; j++)
-        evalPoints(i, j) = pnts[i](j);
-
-    getValues<V,P>(Nvals, evalPoints);
-
-    for(int i=0; i<nPoints; i++){
+    for(int i=0; i<nPoints; i++, Nvals+=numNodes){
       vals[i] = 0.0;
       for(int I=0; I<numNodes; I++)
-        vals[i] += Nvals(I,i)*topoVals(I);
+        vals[i] += Nvals[I]*topoVals(I);
     }
   }
 }
 
+//******************************************************************************//
+template<typename V, typename P>
+void ATO::SubIntegrator::cacheBasisValues(
+     uint level,
+     const std::vector<Simplex<V,P> >& implicitPolys)
+//******************************************************************************//
+{
+  // the simplex vertices of a refinement level don't depend on the cell, so
+  // the basis is evaluated at them once instead of in every Project.
+  int numNodes = basis->getCardinality();
+  int nPolys = implicitPolys.size();
+  int nPoints = (nPolys > 0) ? implicitPolys[0].points.size() : 0;
+  int nTotal = nPolys*nPoints;
+
+  if( level >= refinementBasisValues.size() ) refinementBasisValues.resize(level+1);
+  std::vector<RealType>& values = refinementBasisValues[level];
+  values.resize(nTotal*numNodes);
+  if( nTotal == 0 ) return;
+
+  Kokkos::DynRankView<RealType, PHX::Device> Nvals("Nvals", numNodes, nTotal);
+  Kokkos::DynRankView<RealType, PHX::Device> evalPoints("evalPoints", nTotal, nDims);
+  for(int ip=0; ip<nPolys; ip++)
+    for(int i=0; i<nPoints; i++)
+      for(uint j=0; j<nDims; j++)
+        evalPoints(ip*nPoints+i, j) = Sacado::ScalarValue<P>::eval(implicitPolys[ip].points[i](j));
+
+  basis->getValues(Nvals, evalPoints, Intrepid2::OPERATOR_VALUE);
+
+  for(int pt=0; pt<nTotal; pt++)
+    for(int I=0; I<numNodes; I++)
+      values[pt*numNodes+I] = Nvals(I,pt);
+}
+
 //******************************************************************************//
 template<typename C, typename V, typename P>
 void ATO::SubIntegrator::Dice(
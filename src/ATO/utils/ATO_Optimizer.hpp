@@ -69,6 +69,8 @@ class Optimizer_OC : public Optimizer {
   void Initialize();
  protected:
   void computeUpdatedTopology();
+  double enforceMeasure();
+  void computeBisectionMeasure(double& measure);
 
   double* p;
   double* p_last;
@@ -98,6 +100,10 @@ class Optimizer_OC : public Optimizer {
   double _maxMeasure;
   double _optMeasure;
   bool   _useNewtonSearch;
+  bool   _linearizedBisection;
+  int    _maxLinearCorrections;
+  bool   _useLinearMeasure;
+  double _linearMeasureBase;
 
 };
 
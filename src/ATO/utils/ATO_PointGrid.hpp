@@ -0,0 +1,106 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ATO_POINTGRID_HPP
+#define ATO_POINTGRID_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace ATO {
+
+/** \brief Uniform grid for fixed radius neighbor searches
+
+    Points are binned into cells whose edge length is the search radius and
+    stored sorted by cell.  All points within the radius of a query point
+    are then found in the 3^dim cells surrounding the query point, so a
+    search over n points costs O(n log n) instead of O(n^2).
+
+*/
+class PointGrid
+{
+public:
+  // coords holds three coordinates per point.  Only the first 'dimension'
+  // coordinates of each point are used.
+  PointGrid(const std::vector<double>& coords, int dimension, double radius) :
+    dim(dimension), cellSize(radius > 0.0 ? radius : 1.0)
+  {
+    int numPoints = coords.size()/3;
+    for(int i=0; i<3; i++){ origin[i] = 0.0; numCells[i] = 1; }
+    if( numPoints == 0 ) return;
+
+    double upper[3];
+    for(int i=0; i<dim; i++){ origin[i] = coords[i]; upper[i] = coords[i]; }
+    for(int p=1; p<numPoints; p++)
+      for(int i=0; i<dim; i++){
+        origin[i] = std::min(origin[i], coords[3*p+i]);
+        upper[i] = std::max(upper[i], coords[3*p+i]);
+      }
+    for(int i=0; i<dim; i++)
+      numCells[i] = static_cast<long long>((upper[i]-origin[i])/cellSize) + 1;
+
+    cellPoints.resize(numPoints);
+    for(int p=0; p<numPoints; p++){
+      long long ijk[3] = {0, 0, 0};
+      cellOf(&coords[3*p], ijk);
+      cellPoints[p] = std::make_pair(cellKey(ijk), p);
+    }
+    std::sort(cellPoints.begin(), cellPoints.end());
+  }
+
+  // Call visit(p) for every point p in the cells adjacent to x.  The caller
+  // applies the exact distance test.
+  template<typename Visitor>
+  void forEachCandidate(const double* x, Visitor visit) const
+  {
+    if( cellPoints.empty() ) return;
+
+    long long home[3] = {0, 0, 0};
+    cellOf(x, home);
+
+    long long lo[3] = {0, 0, 0}, hi[3] = {0, 0, 0};
+    for(int i=0; i<dim; i++){
+      lo[i] = std::max(home[i]-1, 0LL);
+      hi[i] = std::min(home[i]+1, numCells[i]-1);
+      if( lo[i] > hi[i] ) return;
+    }
+
+    long long ijk[3];
+    for(ijk[0]=lo[0]; ijk[0]<=hi[0]; ijk[0]++)
+      for(ijk[1]=lo[1]; ijk[1]<=hi[1]; ijk[1]++)
+        for(ijk[2]=lo[2]; ijk[2]<=hi[2]; ijk[2]++){
+          std::pair<long long,int> first(cellKey(ijk), 0);
+          std::vector<std::pair<long long,int> >::const_iterator
+            it = std::lower_bound(cellPoints.begin(), cellPoints.end(), first);
+          for(; it!=cellPoints.end() && it->first==first.first; ++it)
+            visit(it->second);
+        }
+  }
+
+private:
+  void cellOf(const double* x, long long* ijk) const
+  {
+    for(int i=0; i<dim; i++)
+      ijk[i] = static_cast<long long>(std::floor((x[i]-origin[i])/cellSize));
+  }
+
+  long long cellKey(const long long* ijk) const
+  {
+    return (ijk[0]*numCells[1] + ijk[1])*numCells[2] + ijk[2];
+  }
+
+  int dim;
+  double cellSize;
+  double origin[3];
+  long long numCells[3];
+  std::vector<std::pair<long long,int> > cellPoints;
+};
+
+}
+
+#endif
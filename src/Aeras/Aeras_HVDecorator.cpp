@@ -76,6 +76,58 @@ Teuchos::RCP<Tpetra_CrsMatrix> getOnlyNonzeros (const Teuchos::RCP<Tpetra_CrsMat
   
   return B;
 }
+
+// Applies the hyperviscosity Laplace operator without assembling it. The
+// shallow water residual is linear in x_dotdot, so
+//   L v = f(x, x_dot, v) - f(x, x_dot, 0),
+// which is evaluated element by element by the residual field manager.
+class MatrixFreeLaplaceOpT : public Tpetra_Operator {
+public:
+  MatrixFreeLaplaceOpT(
+      const Teuchos::RCP<Albany::Application>& app,
+      const Teuchos::RCP<const Tpetra_Vector>& xT,
+      const Teuchos::RCP<const Tpetra_Vector>& x_dotT,
+      const Teuchos::Array<ParamVec>& p) :
+    app_(app), xT_(xT), x_dotT_(x_dotT), p_(p),
+    f0T_(Teuchos::rcp(new Tpetra_Vector(xT->getMap(), true))),
+    fT_(Teuchos::rcp(new Tpetra_Vector(xT->getMap(), true)))
+  {
+    const Tpetra_Vector zeroT(xT->getMap(), true);
+    app_->computeGlobalResidualT(0.0, x_dotT_.get(), &zeroT, *xT_, p_, *f0T_);
+  }
+
+  virtual void apply(const Tpetra_MultiVector& X,
+                     Tpetra_MultiVector& Y, Teuchos::ETransp mode = Teuchos::NO_TRANS,
+                     ST alpha = Teuchos::ScalarTraits<ST>::one(),
+                     ST beta = Teuchos::ScalarTraits<ST>::zero()) const {
+    TEUCHOS_TEST_FOR_EXCEPTION(mode != Teuchos::NO_TRANS, std::logic_error,
+                               "MatrixFreeLaplaceOpT only applies the Laplace "
+                               "operator untransposed.\n");
+    for (std::size_t j = 0; j < X.getNumVectors(); ++j) {
+      app_->computeGlobalResidualT(0.0, x_dotT_.get(), X.getVector(j).get(),
+                                   *xT_, p_, *fT_);
+      fT_->update(-1.0, *f0T_, 1.0);
+      Y.getVectorNonConst(j)->update(alpha, *fT_, beta);
+    }
+  }
+
+  virtual bool hasTransposeApply() const { return false; }
+
+  virtual Teuchos::RCP<const Tpetra_Map> getDomainMap() const {
+    return xT_->getMap();
+  }
+
+  virtual Teuchos::RCP<const Tpetra_Map> getRangeMap() const {
+    return xT_->getMap();
+  }
+
+private:
+  const Teuchos::RCP<Albany::Application> app_;
+  const Teuchos::RCP<const Tpetra_Vector> xT_, x_dotT_;
+  const Teuchos::Array<ParamVec>& p_;
+  //f(x, x_dot, 0) and a work vector
+  const Teuchos::RCP<Tpetra_Vector> f0T_, fT_;
+};
 } // namespace
 
 Aeras::HVDecorator::HVDecorator(
@@ -93,6 +145,19 @@ Aeras::HVDecorator::HVDecorator(
   const bool SW_app = (appname == "Aeras Shallow Water 3D");
   const bool Hydro_app = (appname == "Aeras Hydrostatic");
 
+  // With "Matrix-Free Hyperviscosity", the Laplace operator is applied through
+  // residual evaluations and its CrsMatrix is never assembled. This trades a
+  // residual evaluation per apply for the memory of the Laplace graph.
+  const bool matrix_free = SW_app &&
+    app->getProblemPL()->sublist("Shallow Water Problem").get<bool>(
+        "Matrix-Free Hyperviscosity", false);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      Hydro_app &&
+      app->getProblemPL()->sublist("Hydrostatic Problem").get<bool>(
+          "Matrix-Free Hyperviscosity", false),
+      std::logic_error,
+      "Matrix-Free Hyperviscosity is only implemented for Aeras Shallow Water 3D.\n");
+
   // Create and store mass and Laplacian operators (in CrsMatrix form). 
   Teuchos::RCP<Tpetra_CrsMatrix> mass;
   if(SW_app)
@@ -100,7 +165,7 @@ Aeras::HVDecorator::HVDecorator(
   if(Hydro_app)
 	  mass = createOperatorDiag(1.0, 0.0, 0.0, false);
   Teuchos::RCP<Tpetra_CrsMatrix> laplace;
-  if(SW_app)
+  if(SW_app && !matrix_free)
       laplace = createOperator(0.0, 0.0, 1.0, true);
   if(Hydro_app)
       laplace = createOperator(0.0, 0.0, 1.0, false);
@@ -114,7 +179,10 @@ Aeras::HVDecorator::HVDecorator(
   wrk_ = Teuchos::rcp(new Tpetra_Vector(mass->getRowMap()));
   // 3. Remove the structural nonzeros, numerical zeros, from the Laplace
   // operator.
-  laplace_ = getOnlyNonzeros(laplace);
+  if (matrix_free)
+    laplace_ = createMatrixFreeOperator();
+  else
+    laplace_ = getOnlyNonzeros(laplace);
   xtildeT = Teuchos::rcp(new Tpetra_Vector(mass->getRowMap())); 
 
 //OG In case of a parallel run by some reason laplace.mm file contains indices
@@ -123,7 +191,8 @@ Aeras::HVDecorator::HVDecorator(
 //in case of a parallel and serial run.
 #ifdef WRITE_TO_MATRIX_MARKET_TO_MM_FILE
   Tpetra_MatrixMarket_Writer::writeSparseFile("mass.mm", mass);
-  Tpetra_MatrixMarket_Writer::writeSparseFile("laplace.mm", laplace_);
+  if (Teuchos::nonnull(laplace))
+    Tpetra_MatrixMarket_Writer::writeSparseFile("laplace.mm", getOnlyNonzeros(laplace));
 #endif
 }
  
@@ -203,6 +272,20 @@ Aeras::HVDecorator::createOperatorDiag(double alpha, double beta, double omega,
   return Op_crs; 
 }
 
+Teuchos::RCP<Tpetra_Operator>
+Aeras::HVDecorator::createMatrixFreeOperator()
+{
+#ifdef OUTPUT_TO_SCREEN
+  std::cout << "DEBUG: " << __PRETTY_FUNCTION__ << "\n";
+#endif
+  const Teuchos::RCP<const Tpetra_Vector> xT = ConverterT::getConstTpetraVector(this->getNominalValues().get_x());
+  const Teuchos::RCP<const Tpetra_Vector> x_dotT =
+    Teuchos::nonnull(this->getNominalValues().get_x_dot()) ?
+    ConverterT::getConstTpetraVector(this->getNominalValues().get_x_dot()) :
+    Teuchos::null;
+  return Teuchos::rcp(new MatrixFreeLaplaceOpT(app, xT, x_dotT, sacado_param_vec));
+}
+
 //IKT: the following function returns laplace_*mass_^(-1)*laplace_*x_in.  It is to be called 
 //in evalModelImpl after the last computeGlobalResidualT call.
 //Note that it is more efficient to implement an apply method like is done here, than 
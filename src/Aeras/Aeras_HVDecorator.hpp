@@ -34,6 +34,11 @@ public:
   //matrix, namely the Laplace, whereas the mass matrix should be diagonal. 
   Teuchos::RCP<Tpetra_CrsMatrix> createOperatorDiag(double alpha, double beta, double omega, bool xdotdot_nonnull);
 
+  //Laplace operator that is applied through residual evaluations instead of
+  //being assembled. Only available for the shallow water problem, whose
+  //residual is linear in the x_dotdot (utilde/htilde) variables.
+  Teuchos::RCP<Tpetra_Operator> createMatrixFreeOperator();
+
   void applyLinvML(Teuchos::RCP<const Tpetra_Vector> x_in, Teuchos::RCP<Tpetra_Vector> x_out) const; 
 
 protected:
@@ -44,8 +49,10 @@ protected:
       const Thyra::ModelEvaluatorBase::OutArgs<ST>& outArgs) const;
 
 private: 
-  //Mass and Laplace operators
-  Teuchos::RCP<Tpetra_CrsMatrix> laplace_; 
+  //Mass and Laplace operators. The Laplace is either the assembled CrsMatrix
+  //or, with "Matrix-Free Hyperviscosity", an operator that applies it through
+  //residual evaluations.
+  Teuchos::RCP<Tpetra_Operator> laplace_; 
   Teuchos::RCP<Tpetra_Vector> inv_mass_diag_, wrk_;
   Teuchos::RCP<Tpetra_Vector> xtildeT; 
 };
@@ -598,7 +598,7 @@ evaluateFields(typename Traits::EvalData workset)
 
   bool buildMass = ( ( workset.j_coeff == 0.0 )&&( workset.m_coeff != 0.0 )&&( workset.n_coeff == 0.0 ) );
   if ( buildMass ) {
-    Kokkos::parallel_for(ComputeAndScatterJac_buildMass_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), ComputeAndScatterJac_buildMass_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
 
@@ -610,32 +610,32 @@ evaluateFields(typename Traits::EvalData workset)
     // numNodes must be known at compile time in order to construct static arrays inside kernel
     switch (this->numNodes) {
       case 9: {
-        Kokkos::parallel_for(ComputeAndScatterJac_buildLaplace_Policy<9>(0,workset.numCells),*this);
+        Kokkos::parallel_for(this->getName(), ComputeAndScatterJac_buildLaplace_Policy<9>(0,workset.numCells),*this);
         cudaCheckError();
         break;
       }
       case 16: {
-        Kokkos::parallel_for(ComputeAndScatterJac_buildLaplace_Policy<16>(0,workset.numCells),*this);
+        Kokkos::parallel_for(this->getName(), ComputeAndScatterJac_buildLaplace_Policy<16>(0,workset.numCells),*this);
         cudaCheckError();
         break;
       }
       case 25: {
-        Kokkos::parallel_for(ComputeAndScatterJac_buildLaplace_Policy<25>(0,workset.numCells),*this);
+        Kokkos::parallel_for(this->getName(), ComputeAndScatterJac_buildLaplace_Policy<25>(0,workset.numCells),*this);
         cudaCheckError();
         break;
       }
       case 36: {
-        Kokkos::parallel_for(ComputeAndScatterJac_buildLaplace_Policy<36>(0,workset.numCells),*this);
+        Kokkos::parallel_for(this->getName(), ComputeAndScatterJac_buildLaplace_Policy<36>(0,workset.numCells),*this);
         cudaCheckError();
         break;
       }
       case 49: {
-        Kokkos::parallel_for(ComputeAndScatterJac_buildLaplace_Policy<49>(0,workset.numCells),*this);
+        Kokkos::parallel_for(this->getName(), ComputeAndScatterJac_buildLaplace_Policy<49>(0,workset.numCells),*this);
         cudaCheckError();
         break;
       }
       case 64: {
-        Kokkos::parallel_for(ComputeAndScatterJac_buildLaplace_Policy<64>(0,workset.numCells),*this);
+        Kokkos::parallel_for(this->getName(), ComputeAndScatterJac_buildLaplace_Policy<64>(0,workset.numCells),*this);
         cudaCheckError();
         break;
       }
@@ -744,7 +744,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
   else {
 #if !(HOMMEMAP)
-    Kokkos::parallel_for(ComputeBasisFunctions_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), ComputeBasisFunctions_Policy(0,workset.numCells),*this);
 #else 
   //IKT: Kokkos version of Jacobian for HOMMEMAP is not implemented, nor does it need to be. 
     TEUCHOS_TEST_FOR_EXCEPTION(true,
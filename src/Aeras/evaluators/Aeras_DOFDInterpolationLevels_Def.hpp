@@ -84,7 +84,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(DOFDInterpolationLevels_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), DOFDInterpolationLevels_Policy(0,workset.numCells),*this);
 
 #endif
 }
@@ -90,7 +90,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(DOFDivInterpolationLevelsXZ_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), DOFDivInterpolationLevelsXZ_Policy(0,workset.numCells),*this);
 
 #endif
 }
@@ -173,12 +173,12 @@ evaluateFields(typename Traits::EvalData workset)
 
 #else
   if ( originalDiv ) {
-    Kokkos::parallel_for(DOFDivInterpolationLevels_originalDiv_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), DOFDivInterpolationLevels_originalDiv_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
   else {
     vcontra = createDynRankView(div_val_qp.get_view(), "vcontra", workset.numCells, numNodes, numLevels, 2);
-    Kokkos::parallel_for(DOFDivInterpolationLevels_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), DOFDivInterpolationLevels_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
 
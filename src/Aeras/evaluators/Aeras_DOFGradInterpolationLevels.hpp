@@ -21,6 +21,12 @@ namespace Aeras {
     This evaluator interpolates nodal DOF values to their
     gradients at quad points.
 
+    With "Sum Factorization", on tensor-product elements whose quadrature
+    points are the nodes (spectral elements), the reference gradients are
+    applied one direction at a time with the 1D derivative matrix and mapped
+    with "Jacobian Inv Name". This costs O(np^3) per element and level instead
+    of O(np^4). "Intrepid2 Basis" and "Cubature" are then required.
+
 */
 
 template<typename EvalT, typename Traits>
@@ -57,6 +63,18 @@ private:
   const int numQPs;
   const int numLevels;
 
+  bool sumFactorize;
+  PHX::MDField<const MeshScalarT,Cell,QuadPoint,Dim,Dim> jacobian_inv;
+  //! D1(a,b): derivative of the 1D Lagrange polynomial a at the point b
+  Kokkos::View<RealType**, PHX::Device> D1;
+  int np;
+
+  void initializeSumFactorization(
+    const Teuchos::ParameterList& p);
+
+  KOKKOS_INLINE_FUNCTION
+  void sumFactorizedGrad(const int cell) const;
+
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
 public:
   typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
@@ -68,6 +86,17 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator() (const DOFGradInterpolationLevels_Tag& tag, const int& i) const;
 
+#ifdef KOKKOS_OPTIMIZED
+  // One team per element, the levels of a quadrature point in the vector lanes
+  struct DOFGradInterpolationLevels_Team_Tag{};
+
+  typedef Kokkos::TeamPolicy<ExecutionSpace, DOFGradInterpolationLevels_Team_Tag> DOFGradInterpolationLevels_Team_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const DOFGradInterpolationLevels_Team_Tag& tag,
+                   const typename DOFGradInterpolationLevels_Team_Policy::member_type& team) const;
+#endif
+
 #endif
 };
 
@@ -117,6 +146,16 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator() (const DOFGradInterpolationLevels_noDeriv_Tag& tag, const int& i) const;
 
+#ifdef KOKKOS_OPTIMIZED
+  struct DOFGradInterpolationLevels_noDeriv_Team_Tag{};
+
+  typedef Kokkos::TeamPolicy<ExecutionSpace, DOFGradInterpolationLevels_noDeriv_Team_Tag> DOFGradInterpolationLevels_noDeriv_Team_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const DOFGradInterpolationLevels_noDeriv_Team_Tag& tag,
+                   const typename DOFGradInterpolationLevels_noDeriv_Team_Policy::member_type& team) const;
+#endif
+
 #endif
 };
 }
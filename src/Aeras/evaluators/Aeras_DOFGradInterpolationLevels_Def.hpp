@@ -8,7 +8,12 @@
 #include "Phalanx_DataLayout.hpp"
 #include "PHAL_Utilities.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 #include "Intrepid2_FunctionSpaceTools.hpp"
+#include "Intrepid2_Basis.hpp"
+#include "Intrepid2_Cubature.hpp"
 
 namespace Aeras {
 
@@ -23,10 +28,19 @@ DOFGradInterpolationLevels(Teuchos::ParameterList& p,
   numNodes   (dl->node_scalar             ->dimension(1)),
   numDims    (dl->node_qp_gradient        ->dimension(3)),
   numQPs     (dl->node_qp_scalar          ->dimension(2)),
-  numLevels  (dl->node_scalar_level       ->dimension(2))
+  numLevels  (dl->node_scalar_level       ->dimension(2)),
+  sumFactorize (p.isParameter("Sum Factorization") ? p.get<bool>("Sum Factorization") : false),
+  np         (0)
 {
   this->addDependentField(val_node);
-  this->addDependentField(GradBF);
+  if (sumFactorize) {
+    jacobian_inv = PHX::MDField<const MeshScalarT,Cell,QuadPoint,Dim,Dim>(
+      p.get<std::string>("Jacobian Inv Name"), dl->qp_tensor);
+    this->addDependentField(jacobian_inv);
+    initializeSumFactorization(p);
+  }
+  else
+    this->addDependentField(GradBF);
   this->addEvaluatedField(grad_val_qp);
 
   this->setName("Aeras::DOFGradInterpolationLevels"+PHX::typeAsString<EvalT>());
@@ -34,6 +48,73 @@ DOFGradInterpolationLevels(Teuchos::ParameterList& p,
   //std::cout << "Aeras::DOFGradInterpolationLevels: " << numDims << " " << numQPs << " " << numLevels << std::endl;
 }
 
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void DOFGradInterpolationLevels<EvalT, Traits>::
+initializeSumFactorization(const Teuchos::ParameterList& p)
+{
+  Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > intrepidBasis =
+    p.get<Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > >("Intrepid2 Basis");
+  Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubature =
+    p.get<Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature");
+
+  np = static_cast<int>(std::floor(std::sqrt(static_cast<double>(numNodes))+.1));
+  TEUCHOS_TEST_FOR_EXCEPTION(np*np != numNodes || numQPs != numNodes || numDims != 2,
+                             std::logic_error,
+                             "Aeras::DOFGradInterpolationLevels: Sum Factorization needs a 2D "
+                             "tensor-product element with the quadrature points at the nodes.\n");
+
+  Kokkos::DynRankView<RealType, PHX::Device> refPoints ("refPoints",  numQPs, numDims);
+  Kokkos::DynRankView<RealType, PHX::Device> refWeights("refWeights", numQPs);
+  Kokkos::DynRankView<RealType, PHX::Device> refGrad   ("refGrad",    numNodes, numQPs, numDims);
+  cubature->getCubature(refPoints, refWeights);
+  intrepidBasis->getValues(refGrad, refPoints, Intrepid2::OPERATOR_GRAD);
+
+  // The first row of nodes and points gives the 1D derivative matrix. The
+  // other gradients must factor through it, with x running fastest.
+  D1 = Kokkos::View<RealType**, PHX::Device>("D1", np, np);
+  for (int a=0; a<np; ++a)
+    for (int b=0; b<np; ++b)
+      D1(a,b) = refGrad(a,b,0);
+
+  RealType maxGrad = 0, maxError = 0;
+  for (int node=0; node<numNodes; ++node) {
+    for (int qp=0; qp<numQPs; ++qp) {
+      const RealType dxi  = node/np == qp/np ? D1(node%np, qp%np) : 0;
+      const RealType deta = node%np == qp%np ? D1(node/np, qp/np) : 0;
+      maxGrad  = std::max(maxGrad, std::max(std::abs(refGrad(node,qp,0)), std::abs(refGrad(node,qp,1))));
+      maxError = std::max(maxError, std::max(std::abs(refGrad(node,qp,0) - dxi),
+                                             std::abs(refGrad(node,qp,1) - deta)));
+    }
+  }
+  TEUCHOS_TEST_FOR_EXCEPTION(maxError > 1.0e-10*maxGrad, std::logic_error,
+                             "Aeras::DOFGradInterpolationLevels: the basis gradients do not "
+                             "factor into 1D derivatives on a tensor grid of nodes; "
+                             "Sum Factorization cannot be used.\n");
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void DOFGradInterpolationLevels<EvalT, Traits>::
+sumFactorizedGrad(const int cell) const
+{
+  for (int level=0; level < numLevels; ++level) {
+    for (int qp=0; qp < numQPs; ++qp) {
+      const int x = qp % np;
+      const int y = qp / np;
+      ScalarT dxi = 0, deta = 0;
+      for (int a=0; a < np; ++a) {
+        dxi  += val_node(cell, y*np + a, level) * D1(a, x);
+        deta += val_node(cell, a*np + x, level) * D1(a, y);
+      }
+      // Same transform as HGRADtransformGRAD: the transpose of the inverse Jacobian
+      for (int dim=0; dim<numDims; dim++)
+        grad_val_qp(cell,qp,level,dim) = jacobian_inv(cell,qp,0,dim) * dxi + jacobian_inv(cell,qp,1,dim) * deta;
+    }
+  }
+}
+
 //**********************************************************************
 template<typename EvalT, typename Traits>
 void DOFGradInterpolationLevels<EvalT, Traits>::
@@ -41,7 +122,10 @@ postRegistrationSetup(typename Traits::SetupData d,
                       PHX::FieldManager<Traits>& fm)
 {
   this->utils.setFieldData(val_node,fm);
-  this->utils.setFieldData(GradBF,fm);
+  if (sumFactorize)
+    this->utils.setFieldData(jacobian_inv,fm);
+  else
+    this->utils.setFieldData(GradBF,fm);
   this->utils.setFieldData(grad_val_qp,fm);
 }
 
@@ -52,6 +136,10 @@ template<typename EvalT, typename Traits>
 KOKKOS_INLINE_FUNCTION
 void DOFGradInterpolationLevels<EvalT, Traits>::
 operator() (const DOFGradInterpolationLevels_Tag& tag, const int& cell) const{
+  if (sumFactorize) {
+    sumFactorizedGrad(cell);
+    return;
+  }
   for (int qp=0; qp < numQPs; ++qp) {
     for (int level=0; level < numLevels; ++level) {
       for (int dim=0; dim<numDims; dim++) {
@@ -64,6 +152,26 @@ operator() (const DOFGradInterpolationLevels_Tag& tag, const int& cell) const{
   }
 }
 
+#ifdef KOKKOS_OPTIMIZED
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void DOFGradInterpolationLevels<EvalT, Traits>::
+operator() (const DOFGradInterpolationLevels_Team_Tag& tag,
+            const typename DOFGradInterpolationLevels_Team_Policy::member_type& team) const{
+  const int cell = team.league_rank();
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, numQPs), [=] (const int& qp) {
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, numLevels), [=] (const int& level) {
+      for (int dim=0; dim<numDims; dim++) {
+        grad_val_qp(cell,qp,level,dim) = val_node(cell, 0, level) * GradBF(cell, 0, qp, dim);
+        for (int node=1 ; node < numNodes; ++node) {
+          grad_val_qp(cell,qp,level,dim) += val_node(cell, node, level) * GradBF(cell, node, qp, dim);
+        }
+      }
+    });
+  });
+}
+#endif
+
 #endif
 
 //**********************************************************************
@@ -102,6 +210,12 @@ evaluateFields(typename Traits::EvalData workset)
   }
   */
 
+  if (sumFactorize) {
+    for (int cell=0; cell < workset.numCells; ++cell)
+      sumFactorizedGrad(cell);
+    return;
+  }
+
   for (int cell=0; cell < workset.numCells; ++cell) {
     for (int qp=0; qp < numQPs; ++qp) {
       for (int level=0; level < numLevels; ++level) {
@@ -123,7 +237,13 @@ evaluateFields(typename Traits::EvalData workset)
 */
 
 #else
-  Kokkos::parallel_for(DOFGradInterpolationLevels_Policy(0,workset.numCells),*this);
+#ifdef KOKKOS_OPTIMIZED
+  if (!sumFactorize) {
+    Kokkos::parallel_for(this->getName(), DOFGradInterpolationLevels_Team_Policy(workset.numCells,Kokkos::AUTO(),16),*this);
+    return;
+  }
+#endif
+  Kokkos::parallel_for(this->getName(), DOFGradInterpolationLevels_Policy(0,workset.numCells),*this);
 
 #endif
 }
@@ -180,6 +300,26 @@ operator() (const DOFGradInterpolationLevels_noDeriv_Tag& tag, const int& cell)
   }
 }
 
+#ifdef KOKKOS_OPTIMIZED
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void DOFGradInterpolationLevels_noDeriv<EvalT, Traits>::
+operator() (const DOFGradInterpolationLevels_noDeriv_Team_Tag& tag,
+            const typename DOFGradInterpolationLevels_noDeriv_Team_Policy::member_type& team) const{
+  const int cell = team.league_rank();
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, numQPs), [=] (const int& qp) {
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, numLevels), [=] (const int& level) {
+      for (int dim=0; dim<numDims; dim++) {
+        typename PHAL::Ref<MeshScalarT>::type gvqp = grad_val_qp(cell,qp,level,dim) = 0;
+        for (int node=0 ; node < numNodes; ++node) {
+          gvqp += val_node(cell, node, level) * GradBF(cell, node, qp, dim);
+        }
+      }
+    });
+  });
+}
+#endif
+
 #endif
 
 //**********************************************************************
@@ -206,7 +346,11 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(DOFGradInterpolationLevels_noDeriv_Policy(0,workset.numCells),*this);
+#ifdef KOKKOS_OPTIMIZED
+  Kokkos::parallel_for(this->getName(), DOFGradInterpolationLevels_noDeriv_Team_Policy(workset.numCells,Kokkos::AUTO(),16),*this);
+#else
+  Kokkos::parallel_for(this->getName(), DOFGradInterpolationLevels_noDeriv_Policy(0,workset.numCells),*this);
+#endif
 
 #endif
 }
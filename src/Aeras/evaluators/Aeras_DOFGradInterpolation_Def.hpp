@@ -83,7 +83,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(DOFGradInterpolation_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), DOFGradInterpolation_Policy(0,workset.numCells),*this);
 
 #endif
 }
@@ -161,7 +161,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(DOFGradInterpolation_noDeriv_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), DOFGradInterpolation_noDeriv_Policy(0,workset.numCells),*this);
 
 #endif
 }
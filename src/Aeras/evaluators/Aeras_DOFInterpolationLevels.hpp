@@ -62,6 +62,17 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator() (const DOFInterpolationLevels_Tag& tag, const int& i) const;
 
+#ifdef KOKKOS_OPTIMIZED
+  // One team per element, the levels of a node in the vector lanes
+  struct DOFInterpolationLevels_Team_Tag{};
+
+  typedef Kokkos::TeamPolicy<ExecutionSpace, DOFInterpolationLevels_Team_Tag> DOFInterpolationLevels_Team_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const DOFInterpolationLevels_Team_Tag& tag,
+                   const typename DOFInterpolationLevels_Team_Policy::member_type& team) const;
+#endif
+
 #endif
 };
 }
@@ -56,6 +56,21 @@ operator() (const DOFInterpolationLevels_Tag& tag, const int& cell) const{
   }
 }
 
+#ifdef KOKKOS_OPTIMIZED
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void DOFInterpolationLevels<EvalT, Traits>::
+operator() (const DOFInterpolationLevels_Team_Tag& tag,
+            const typename DOFInterpolationLevels_Team_Policy::member_type& team) const{
+  const int cell = team.league_rank();
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, numNodes), [=] (const int& node) {
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, numLevels), [=] (const int& level) {
+      val_qp(cell,node,level) = val_node(cell, node, level) * BF(cell, node, node);
+    });
+  });
+}
+#endif
+
 #endif
 
 //**********************************************************************
@@ -77,7 +92,11 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(DOFInterpolationLevels_Policy(0,workset.numCells),*this);
+#ifdef KOKKOS_OPTIMIZED
+  Kokkos::parallel_for(this->getName(), DOFInterpolationLevels_Team_Policy(workset.numCells,Kokkos::AUTO(),16),*this);
+#else
+  Kokkos::parallel_for(this->getName(), DOFInterpolationLevels_Policy(0,workset.numCells),*this);
+#endif
 
 #endif
 }
@@ -103,9 +103,9 @@ evaluateFields(typename Traits::EvalData workset)
 
 #else
   if (numRank == 2) {
-    Kokkos::parallel_for(DOFInterpolation_numRank2_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), DOFInterpolation_numRank2_Policy(0,workset.numCells),*this);
   } else {
-    Kokkos::parallel_for(DOFInterpolation_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), DOFInterpolation_Policy(0,workset.numCells),*this);
   }
 
 #endif
@@ -93,7 +93,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(DOFVecInterpolationLevels_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), DOFVecInterpolationLevels_Policy(0,workset.numCells),*this);
 
 #endif
 }
@@ -254,7 +254,7 @@ evaluateFields(typename Traits::EvalData workset)
   d_val = val_kokkosvec.template view<executionSpace>(); 
   d_val_dot = val_dot_kokkosvec.template view<executionSpace>(); 
 
-  Kokkos::parallel_for(GatherSolution_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), GatherSolution_Policy(0,workset.numCells),*this);
   cudaCheckError();
 
 #endif
@@ -502,7 +502,7 @@ evaluateFields(typename Traits::EvalData workset)
     val_kokkosjac[i]=this->val[i].get_view();
   d_val=val_kokkosjac.template view<executionSpace>();
 
-  Kokkos::parallel_for(GatherSolution_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), GatherSolution_Policy(0,workset.numCells),*this);
   cudaCheckError();
 
   if (workset.transientTerms) { 
@@ -510,7 +510,7 @@ evaluateFields(typename Traits::EvalData workset)
       val_dot_kokkosjac[i]=this->val_dot[i].get_view();
     d_val_dot=val_dot_kokkosjac.template view<executionSpace>();
 
-    Kokkos::parallel_for(GatherSolution_transientTerms_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), GatherSolution_transientTerms_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
 
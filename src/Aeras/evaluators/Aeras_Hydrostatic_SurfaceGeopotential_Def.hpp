@@ -239,12 +239,12 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
   else if ( topoType == SPHERE_MOUNTAIN1 ){
-    Kokkos::parallel_for(Hydrostatic_SurfaceGeopotential_SPHERE_MOUNTAIN1_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), Hydrostatic_SurfaceGeopotential_SPHERE_MOUNTAIN1_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
 
   else if (topoType == ASP_BAROCLINIC){
-    Kokkos::parallel_for(Hydrostatic_SurfaceGeopotential_ASP_BAROCLINIC_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), Hydrostatic_SurfaceGeopotential_ASP_BAROCLINIC_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
 
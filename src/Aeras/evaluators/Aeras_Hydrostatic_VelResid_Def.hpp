@@ -226,12 +226,12 @@ evaluateFields(typename Traits::EvalData workset)
 #else
   if ( !obtainLaplaceOp ) {
     if (!pureAdvection ) {
-      Kokkos::parallel_for(Hydrostatic_VelResid_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), Hydrostatic_VelResid_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
 
     else {
-      Kokkos::parallel_for(Hydrostatic_VelResid_pureAdvection_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), Hydrostatic_VelResid_pureAdvection_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
   }
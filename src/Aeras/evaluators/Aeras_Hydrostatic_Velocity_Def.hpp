@@ -226,21 +226,21 @@ evaluateFields(typename Traits::EvalData workset)
   switch (adv_type) {
     case UNKNOWN: //velocity is an unknown that we solve for (not prescribed)
     {
-      Kokkos::parallel_for(Hydrostatic_Velocity_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), Hydrostatic_Velocity_Policy(0,workset.numCells),*this);
       cudaCheckError();
       break; 
     } 
 
     case PRESCRIBED_1_1: //velocity is prescribed to that of 1-1 test
     {
-      Kokkos::parallel_for(Hydrostatic_Velocity_PRESCRIBED_1_1_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), Hydrostatic_Velocity_PRESCRIBED_1_1_Policy(0,workset.numCells),*this);
       cudaCheckError();
       break; 
     }
 
     case PRESCRIBED_1_2: //velocity is prescribed to that of 1-2 test
     {
-      Kokkos::parallel_for(Hydrostatic_Velocity_PRESCRIBED_1_2_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), Hydrostatic_Velocity_PRESCRIBED_1_2_Policy(0,workset.numCells),*this);
       cudaCheckError();
       break; 
     }
@@ -7,6 +7,8 @@
 #ifndef AERAS_SW_COMPUTE_AND_SCATTER_JAC_HPP
 #define AERAS_SW_COMPUTE_AND_SCATTER_JAC_HPP
 
+#include <vector>
+
 #include "Phalanx_config.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
@@ -88,6 +90,21 @@ public:
                               const Teuchos::RCP<Aeras::Layouts>& dl);
   void evaluateFields(typename Traits::EvalData d); 
 
+private:
+  // Lumped mass diagonal of a workset, without the m_coeff factor: each
+  // local row it touches once, with the sum of wBF(cell,node,node) over the
+  // cells sharing that row. The mass only depends on the mesh, so it is
+  // built on the first fill and rebuilt only if the workset's equation
+  // numbering (src) changes.
+  struct LumpedMass {
+    const LO* src = nullptr;
+    std::vector<LO> rows;
+    std::vector<RealType> values;
+  };
+
+  void buildLumpedMass(typename Traits::EvalData workset, LumpedMass& mass);
+
+  std::vector<LumpedMass> lumpedMass;
 };
 
 // **************************************************************
@@ -4,6 +4,7 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <map>
 #include <vector>
 #include <string>
 
@@ -109,16 +110,9 @@ evaluateFields(typename Traits::EvalData workset)
 //
 //Then the values of these matrices need to be scattered into the global Jacobian.
 
-  auto nodeID = workset.wsElNodeEqID;
-  Teuchos::RCP<Tpetra_Vector>      fT = workset.fT;
   Teuchos::RCP<Tpetra_CrsMatrix> JacT = workset.JacT;
 
-  const bool loadResid = (fT != Teuchos::null);
-  LO rowT; 
-  Teuchos::Array<LO> colT; 
-
   //std::cout << "DEBUG in SW_ComputeAndScatterJac::EvaluateFields: " << __PRETTY_FUNCTION__ << "\n";
-  //std::cout << "LOAD RESIDUAL? " << loadResid << "\n";
 
   //AMET calls for mass with (j, m, n ) = (0, -1, 0)
 
@@ -126,32 +120,51 @@ evaluateFields(typename Traits::EvalData workset)
 
   bool buildMass = true; // ( ( workset.j_coeff == 0.0 )&&( workset.m_coeff != 0.0 )&&( workset.n_coeff == 0.0 ) );
 
-  int numcells_ = workset.numCells,
-	  numnodes_ = this->numNodes;
-  //for mass we do not really need even this
-  /*
-  Kokkos::DynRankView<ScalarT, PHX::Device> localMassMatr(numcells_,numnodes_,numnodes_);
-  for(int cell = 0; cell < numcells_; cell++){
-	  for(int node = 0; node < numnodes_; node++)
-	     localMassMatr(cell, node, node) = this -> wBF(cell, node, node);
-  }*/
-
   if ( buildMass ) {
-    for (int cell=0; cell < workset.numCells; ++cell ) {
-      const int neq = nodeID.dimension(2);
-
-      for (int node = 0; node < this->numNodes; ++node) {
-        int n = 0, eq = 0;
-        for (int j = eq; j < eq+this->numNodeVar; ++j, ++n) {
-          rowT = nodeID(cell,node,n);
-          RealType val2 = mc * this -> wBF(cell, node, node);
-          JacT->sumIntoLocalValues(rowT, Teuchos::arrayView(&rowT,1), Teuchos::arrayView(&val2,1));
-        }
-        eq += this->numNodeVar;
-      }
+    const int ws = workset.wsIndex;
+    if (ws >= (int)lumpedMass.size())
+      lumpedMass.resize(ws+1);
+
+    LumpedMass& mass = lumpedMass[ws];
+    if (mass.src != workset.wsElNodeEqID.data())
+      buildLumpedMass(workset, mass);
+
+    for (std::size_t i = 0; i < mass.rows.size(); ++i) {
+      const LO rowT = mass.rows[i];
+      const RealType val2 = mc * mass.values[i];
+      JacT->sumIntoLocalValues(rowT, Teuchos::arrayView(&rowT,1), Teuchos::arrayView(&val2,1));
     }
   }
 
 }
 
+// **********************************************************************
+template<typename Traits>
+void SW_ComputeAndScatterJac<PHAL::AlbanyTraits::Jacobian, Traits>::
+buildLumpedMass(typename Traits::EvalData workset, LumpedMass& mass)
+{
+  auto nodeID = workset.wsElNodeEqID;
+
+  // Rows of a node shared by several cells of the workset are summed here,
+  // so that every row is assembled once per fill
+  std::map<LO, RealType> diag;
+  for (int cell=0; cell < workset.numCells; ++cell ) {
+    for (int node = 0; node < this->numNodes; ++node) {
+      const RealType m = Sacado::ScalarValue<PHAL::AlbanyTraits::Jacobian::MeshScalarT>::eval(this->wBF(cell, node, node));
+      for (int n = 0; n < this->numNodeVar; ++n)
+        diag[nodeID(cell,node,n)] += m;
+    }
+  }
+
+  mass.rows.clear();
+  mass.values.clear();
+  mass.rows.reserve(diag.size());
+  mass.values.reserve(diag.size());
+  for (typename std::map<LO, RealType>::const_iterator it = diag.begin(); it != diag.end(); ++it) {
+    mass.rows.push_back(it->first);
+    mass.values.push_back(it->second);
+  }
+  mass.src = nodeID.data();
+}
+
 }
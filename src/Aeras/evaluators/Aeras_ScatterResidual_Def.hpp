@@ -176,7 +176,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
   d_val_kokkos = val_kokkos.template view<ExecutionSpace>();
 
-  Kokkos::parallel_for(Aeras_ScatterRes_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), Aeras_ScatterRes_Policy(0,workset.numCells),*this);
   cudaCheckError();
 #endif
 }
@@ -539,15 +539,15 @@ evaluateFields(typename Traits::EvalData workset)
   d_val_kokkos = val_kokkos.template view<ExecutionSpace>();
 
   if (loadResid) {
-    Kokkos::parallel_for(Aeras_ScatterRes_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), Aeras_ScatterRes_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
   if (workset.is_adjoint) {
-    Kokkos::parallel_for(Aeras_ScatterJac_Adjoint_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), Aeras_ScatterJac_Adjoint_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
   else {
-    Kokkos::parallel_for(Aeras_ScatterJac_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), Aeras_ScatterJac_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
 
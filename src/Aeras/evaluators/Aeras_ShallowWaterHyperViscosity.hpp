@@ -73,6 +73,16 @@ public:
  KOKKOS_INLINE_FUNCTION
  void operator() (const ShallowWaterHyperViscosity_Tag& tag, const int& cell) const;
 
+#ifdef KOKKOS_OPTIMIZED
+ // One team per element, the components of a quadrature point in the vector lanes
+ struct ShallowWaterHyperViscosity_Team_Tag{};
+ typedef Kokkos::TeamPolicy<ExecutionSpace, ShallowWaterHyperViscosity_Team_Tag> ShallowWaterHyperViscosity_Team_Policy;
+
+ KOKKOS_INLINE_FUNCTION
+ void operator() (const ShallowWaterHyperViscosity_Team_Tag& tag,
+                  const typename ShallowWaterHyperViscosity_Team_Policy::member_type& team) const;
+#endif
+
 #endif
           
 };
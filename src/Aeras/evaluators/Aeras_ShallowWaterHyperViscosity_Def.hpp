@@ -109,6 +109,22 @@ if (useHyperviscosity == false) { //no hyperviscosity
     }
 
 }
+
+#ifdef KOKKOS_OPTIMIZED
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void ShallowWaterHyperViscosity<EvalT, Traits>::
+operator() (const ShallowWaterHyperViscosity_Team_Tag& tag,
+            const typename ShallowWaterHyperViscosity_Team_Policy::member_type& team) const{
+  const int cell = team.league_rank();
+  const double value = useHyperviscosity ? hvTau : 0.0;
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(team, numQPs), [=] (const int& qp) {
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, vecDim), [=] (const int& i) {
+      hyperviscosity(cell, qp, i) = value;
+    });
+  });
+}
+#endif
 #endif
 //*********************************************************************
 template<typename EvalT, typename Traits>
@@ -139,7 +155,11 @@ evaluateFields(typename Traits::EvalData workset)
   }
 #else
 
-  Kokkos::parallel_for(ShallowWaterHyperViscosity_Policy(0,workset.numCells),*this);
+#ifdef KOKKOS_OPTIMIZED
+  Kokkos::parallel_for(this->getName(), ShallowWaterHyperViscosity_Team_Policy(workset.numCells,Kokkos::AUTO(),16),*this);
+#else
+  Kokkos::parallel_for(this->getName(), ShallowWaterHyperViscosity_Policy(0,workset.numCells),*this);
+#endif
 
 #endif
 
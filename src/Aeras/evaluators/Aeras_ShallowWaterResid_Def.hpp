@@ -1535,41 +1535,41 @@ evaluateFields(typename Traits::EvalData workset)
 
   if (usePrescribedVelocity) {
     if (useImplHyperviscosity)
-      Kokkos::parallel_for(ShallowWaterResid_VecDim4_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), ShallowWaterResid_VecDim4_Policy(0,workset.numCells),*this);
     else if (useExplHyperviscosity)
       if ( obtainLaplaceOp ) {
-	Kokkos::parallel_for(ShallowWaterResid_BuildLaplace_for_h_Policy(0,workset.numCells),*this);
+	Kokkos::parallel_for(this->getName(), ShallowWaterResid_BuildLaplace_for_h_Policy(0,workset.numCells),*this);
       }
       else
-	Kokkos::parallel_for(ShallowWaterResid_VecDim3_usePrescribedVelocity_Policy(0,workset.numCells),*this);
+	Kokkos::parallel_for(this->getName(), ShallowWaterResid_VecDim3_usePrescribedVelocity_Policy(0,workset.numCells),*this);
    else
-	Kokkos::parallel_for(ShallowWaterResid_VecDim3_usePrescribedVelocity_Policy(0,workset.numCells),*this);
+	Kokkos::parallel_for(this->getName(), ShallowWaterResid_VecDim3_usePrescribedVelocity_Policy(0,workset.numCells),*this);
   }
   else {
     if (useImplHyperviscosity) {
       if (plotVorticity) 
-        Kokkos::parallel_for(ShallowWaterResid_VecDim6_Vorticity_Policy(0,workset.numCells),*this); 
+        Kokkos::parallel_for(this->getName(), ShallowWaterResid_VecDim6_Vorticity_Policy(0,workset.numCells),*this); 
       else
-        Kokkos::parallel_for(ShallowWaterResid_VecDim6_Policy(0,workset.numCells),*this);
+        Kokkos::parallel_for(this->getName(), ShallowWaterResid_VecDim6_Policy(0,workset.numCells),*this);
     }
     else if (useExplHyperviscosity)
       if ( obtainLaplaceOp ) {
-	Kokkos::parallel_for(ShallowWaterResid_BuildLaplace_for_huv_Policy(0,workset.numCells),*this);
+	Kokkos::parallel_for(this->getName(), ShallowWaterResid_BuildLaplace_for_huv_Policy(0,workset.numCells),*this);
         if ((j_coeff == 0) && (m_coeff == 1) && (workset.current_time == 0) && (plotVorticity))
-	  Kokkos::parallel_for(ShallowWaterResid_BuildLaplace_for_huv_Vorticity_Policy(0,workset.numCells),*this);
+	  Kokkos::parallel_for(this->getName(), ShallowWaterResid_BuildLaplace_for_huv_Vorticity_Policy(0,workset.numCells),*this);
          
       }
       else {
         if (plotVorticity)
-	  Kokkos::parallel_for(ShallowWaterResid_VecDim3_Vorticity_no_usePrescribedVelocity_Policy(0,workset.numCells),*this);
+	  Kokkos::parallel_for(this->getName(), ShallowWaterResid_VecDim3_Vorticity_no_usePrescribedVelocity_Policy(0,workset.numCells),*this);
         else
-	  Kokkos::parallel_for(ShallowWaterResid_VecDim3_no_usePrescribedVelocity_Policy(0,workset.numCells),*this);
+	  Kokkos::parallel_for(this->getName(), ShallowWaterResid_VecDim3_no_usePrescribedVelocity_Policy(0,workset.numCells),*this);
       }
     else {
        if (plotVorticity)
-         Kokkos::parallel_for(ShallowWaterResid_VecDim3_Vorticity_no_usePrescribedVelocity_Policy(0,workset.numCells),*this);
+         Kokkos::parallel_for(this->getName(), ShallowWaterResid_VecDim3_Vorticity_no_usePrescribedVelocity_Policy(0,workset.numCells),*this);
        else
-         Kokkos::parallel_for(ShallowWaterResid_VecDim3_no_usePrescribedVelocity_Policy(0,workset.numCells),*this);
+         Kokkos::parallel_for(this->getName(), ShallowWaterResid_VecDim3_no_usePrescribedVelocity_Policy(0,workset.numCells),*this);
     }
   }
 
@@ -347,7 +347,7 @@ evaluateFields(typename Traits::EvalData workset)
 
   A = earthRadius;
   time = workset.current_time; 
-  Kokkos::parallel_for(ShallowWaterSource_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), ShallowWaterSource_Policy(0,workset.numCells),*this);
 
 #endif
 
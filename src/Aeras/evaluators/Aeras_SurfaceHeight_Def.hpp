@@ -152,10 +152,10 @@ evaluateFields(typename Traits::EvalData workset)
 
    switch (hs_type) {
     case NONE:
-      Kokkos::parallel_for(SurfaceHeight_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), SurfaceHeight_Policy(0,workset.numCells),*this);
     break;
     case  MOUNTAIN:
-      Kokkos::parallel_for(SurfaceHeight_MOUNTAIN_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), SurfaceHeight_MOUNTAIN_Policy(0,workset.numCells),*this);
     break;
    }
 
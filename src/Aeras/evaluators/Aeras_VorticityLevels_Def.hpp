@@ -199,9 +199,9 @@ evaluateFields(typename Traits::EvalData workset)
 #else
 
 #if ORIGINALVORT
-  Kokkos::parallel_for(Vorticity_Orig_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), Vorticity_Orig_Policy(0,workset.numCells),*this);
 #else
-  Kokkos::parallel_for(Vorticity_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), Vorticity_Policy(0,workset.numCells),*this);
 #endif
 
 #endif
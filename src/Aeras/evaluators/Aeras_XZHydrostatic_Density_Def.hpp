@@ -78,7 +78,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(XZHydrostatic_Density_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), XZHydrostatic_Density_Policy(0,workset.numCells),*this);
 
 #endif
 }
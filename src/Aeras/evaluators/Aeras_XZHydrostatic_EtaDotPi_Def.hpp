@@ -350,12 +350,12 @@ evaluateFields(typename Traits::EvalData workset)
   d_dedotpiTracerde = dedotpiTracerde_kokkos.template view<executionSpace>();
 
   if (!pureAdvection) {
-    Kokkos::parallel_for(XZHydrostatic_EtaDotPi_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), XZHydrostatic_EtaDotPi_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
 
   else {
-    Kokkos::parallel_for(XZHydrostatic_EtaDotPi_pureAdvection_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), XZHydrostatic_EtaDotPi_pureAdvection_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
 
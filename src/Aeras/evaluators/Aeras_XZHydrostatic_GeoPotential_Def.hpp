@@ -120,7 +120,7 @@ evaluateFields(typename Traits::EvalData workset)
   //}*/
 
 #else
-  Kokkos::parallel_for(XZHydrostatic_GeoPotential_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), XZHydrostatic_GeoPotential_Policy(0,workset.numCells),*this);
   cudaCheckError();
 
 #endif
@@ -84,7 +84,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(XZHydrostatic_KineticEnergy_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), XZHydrostatic_KineticEnergy_Policy(0,workset.numCells),*this);
 
 #endif
 }
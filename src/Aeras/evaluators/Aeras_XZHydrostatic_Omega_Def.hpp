@@ -104,7 +104,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(XZHydrostatic_Omega_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), XZHydrostatic_Omega_Policy(0,workset.numCells),*this);
   cudaCheckError();
 
 #endif
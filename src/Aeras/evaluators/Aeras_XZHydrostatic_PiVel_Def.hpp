@@ -76,7 +76,7 @@ evaluateFields(typename Traits::EvalData workset)
             //std::cout << "Tracer " << Tracer(cell,node,level) << std::endl;
           }
 #else
-  Kokkos::parallel_for(XZHydrostatic_PiVel_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), XZHydrostatic_PiVel_Policy(0,workset.numCells),*this);
 
 #endif
 }
@@ -133,10 +133,10 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(XZHydrostatic_Pressure_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), XZHydrostatic_Pressure_Policy(0,workset.numCells),*this);
   cudaCheckError();
 
-  Kokkos::parallel_for(XZHydrostatic_Pressure_Pi_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), XZHydrostatic_Pressure_Pi_Policy(0,workset.numCells),*this);
   cudaCheckError();
 #endif
 }
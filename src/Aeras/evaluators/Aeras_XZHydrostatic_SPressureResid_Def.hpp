@@ -145,12 +145,12 @@ evaluateFields(typename Traits::EvalData workset)
 #else
   if( !obtainLaplaceOp ) {
     if( !pureAdvection ) {
-      Kokkos::parallel_for(XZHydrostatic_SPressureResid_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), XZHydrostatic_SPressureResid_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
 
     else {
-      Kokkos::parallel_for(XZHydrostatic_SPressureResid_pureAdvection_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), XZHydrostatic_SPressureResid_pureAdvection_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
   }
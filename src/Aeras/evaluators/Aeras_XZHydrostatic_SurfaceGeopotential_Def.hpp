@@ -184,7 +184,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
   else if (topoType == MOUNTAIN1) {
-    Kokkos::parallel_for(XZHydrostatic_SurfaceGeopotential_MOUNTAIN1_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), XZHydrostatic_SurfaceGeopotential_MOUNTAIN1_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
 
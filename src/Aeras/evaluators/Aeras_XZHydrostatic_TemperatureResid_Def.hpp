@@ -218,16 +218,16 @@ evaluateFields(typename Traits::EvalData workset)
 #else
   if ( !obtainLaplaceOp ) {
     if( !pureAdvection ) {
-      Kokkos::parallel_for(XZHydrostatic_TemperatureResid_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), XZHydrostatic_TemperatureResid_Policy(0,workset.numCells),*this);
     }
 
     else {
-      Kokkos::parallel_for(XZHydrostatic_TemperatureResid_pureAdvection_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), XZHydrostatic_TemperatureResid_pureAdvection_Policy(0,workset.numCells),*this);
     }
   }
 
   else {
-    Kokkos::parallel_for(XZHydrostatic_TemperatureResid_Laplace_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), XZHydrostatic_TemperatureResid_Laplace_Policy(0,workset.numCells),*this);
   }
 
 #endif
@@ -138,7 +138,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(XZHydrostatic_TracerResid_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), XZHydrostatic_TracerResid_Policy(0,workset.numCells),*this);
 
 #endif
 }
@@ -0,0 +1,74 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef AERAS_XZHYDROSTATIC_TRACERSRESID_HPP
+#define AERAS_XZHYDROSTATIC_TRACERSRESID_HPP
+
+#include <vector>
+
+#include "Phalanx_config.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Aeras_Layouts.hpp"
+#include "Aeras_Dimension.hpp"
+
+namespace Aeras {
+/** \brief Tracer residuals of all tracers for the XZHydrostatic model
+
+    This evaluator computes the residual of every tracer equation at once,
+    replacing the per tracer chain UTracer, DOFDivInterpolationLevelsXZ and
+    TracerResid. The divergence of u*q at a quadrature point is
+    sum_node (u(node).GradBF(node,qp)) q(node), so the velocity term
+    u(node).GradBF(node,qp) is computed once per cell, point and level and
+    shared by all tracers, which form the innermost loop.
+
+*/
+
+template<typename EvalT, typename Traits>
+class XZHydrostatic_TracersResid : public PHX::EvaluatorWithBaseImpl<Traits>,
+                   public PHX::EvaluatorDerived<EvalT, Traits> {
+
+public:
+  typedef typename EvalT::ScalarT ScalarT;
+  typedef typename EvalT::MeshScalarT MeshScalarT;
+
+  XZHydrostatic_TracersResid(Teuchos::ParameterList& p,
+                        const Teuchos::RCP<Aeras::Layouts>& dl);
+
+  void postRegistrationSetup(typename Traits::SetupData d,
+			     PHX::FieldManager<Traits>& vm);
+
+  void evaluateFields(typename Traits::EvalData d);
+private:
+
+  // Input:
+  PHX::MDField<const MeshScalarT,Cell,Node,QuadPoint>     wBF;
+  PHX::MDField<const MeshScalarT,Cell,Node,QuadPoint,Dim> GradBF;
+  PHX::MDField<const ScalarT,Cell,Node,Level,Dim>         Velocity;
+
+  // One field per tracer, in the order of the tracer names
+  std::vector< PHX::MDField<const ScalarT,Cell,Node,Level> >      Tracer;
+  std::vector< PHX::MDField<const ScalarT,Cell,Node,Level> >      TracerDot;
+  std::vector< PHX::MDField<const ScalarT,Cell,QuadPoint,Level> > TracerSrc;
+  std::vector< PHX::MDField<const ScalarT,Cell,QuadPoint,Level> > dedotpiTracerde;
+
+  // Output:
+  std::vector< PHX::MDField<ScalarT,Cell,Node,Level> >            Residual;
+
+  // Work space: u.GradBF of each node, and the divergence of each tracer
+  std::vector<ScalarT> uGradBF;
+  std::vector<ScalarT> UTracerDiv;
+
+  const int numTracers ;
+  const int numNodes   ;
+  const int numQPs     ;
+  const int numDims;
+  const int numLevels  ;
+};
+}
+
+#endif
@@ -0,0 +1,121 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_VerboseObject.hpp"
+#include "Teuchos_RCP.hpp"
+#include "Phalanx_DataLayout.hpp"
+#include "PHAL_Utilities.hpp"
+
+#include "Aeras_Layouts.hpp"
+
+namespace Aeras {
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+XZHydrostatic_TracersResid<EvalT, Traits>::
+XZHydrostatic_TracersResid(Teuchos::ParameterList& p,
+                      const Teuchos::RCP<Aeras::Layouts>& dl) :
+  wBF        (p.get<std::string> ("Weighted BF Name"),                 dl->node_qp_scalar   ),
+  GradBF     (p.get<std::string> ("Gradient BF Name"),                 dl->node_qp_gradient ),
+  Velocity   (p.get<std::string> ("Velocity"),                         dl->node_vector_level),
+  numTracers (p.get< Teuchos::ArrayRCP<std::string> >("Tracer Names").size()),
+  numNodes   (dl->node_scalar             ->dimension(1)),
+  numQPs     (dl->node_qp_scalar          ->dimension(2)),
+  numDims    (dl->node_qp_gradient        ->dimension(3)),
+  numLevels  (dl->node_scalar_level       ->dimension(2))
+{
+  const Teuchos::ArrayRCP<std::string> tracerNames    = p.get< Teuchos::ArrayRCP<std::string> >("Tracer Names");
+  const Teuchos::ArrayRCP<std::string> tracerDotNames = p.get< Teuchos::ArrayRCP<std::string> >("Time Dependent Tracer Names");
+  const Teuchos::ArrayRCP<std::string> tracerSrcNames = p.get< Teuchos::ArrayRCP<std::string> >("Tracer Source Names");
+  const Teuchos::ArrayRCP<std::string> tracerDetaNames= p.get< Teuchos::ArrayRCP<std::string> >("Tracer EtaDotd Names");
+  const Teuchos::ArrayRCP<std::string> residNames     = p.get< Teuchos::ArrayRCP<std::string> >("Residual Names");
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    tracerDotNames.size() != numTracers || tracerSrcNames.size() != numTracers ||
+    tracerDetaNames.size() != numTracers || residNames.size() != numTracers,
+    std::logic_error,
+    "Aeras::XZHydrostatic_TracersResid needs the same number of names for every tracer field.");
+
+  this->addDependentField(wBF);
+  this->addDependentField(GradBF);
+  this->addDependentField(Velocity);
+
+  for (int t = 0; t < numTracers; ++t) {
+    Tracer.push_back         (PHX::MDField<const ScalarT,Cell,Node,Level>     (tracerNames    [t], dl->node_scalar_level));
+    TracerDot.push_back      (PHX::MDField<const ScalarT,Cell,Node,Level>     (tracerDotNames [t], dl->node_scalar_level));
+    TracerSrc.push_back      (PHX::MDField<const ScalarT,Cell,QuadPoint,Level>(tracerSrcNames [t], dl->qp_scalar_level  ));
+    dedotpiTracerde.push_back(PHX::MDField<const ScalarT,Cell,QuadPoint,Level>(tracerDetaNames[t], dl->qp_scalar_level  ));
+    Residual.push_back       (PHX::MDField<ScalarT,Cell,Node,Level>           (residNames     [t], dl->node_scalar_level));
+
+    this->addDependentField(Tracer[t]);
+    this->addDependentField(TracerDot[t]);
+    this->addDependentField(TracerSrc[t]);
+    this->addDependentField(dedotpiTracerde[t]);
+    this->addEvaluatedField(Residual[t]);
+  }
+
+  this->setName("Aeras::XZHydrostatic_TracersResid" + PHX::typeAsString<EvalT>());
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void XZHydrostatic_TracersResid<EvalT, Traits>::
+postRegistrationSetup(typename Traits::SetupData d,
+                      PHX::FieldManager<Traits>& fm)
+{
+  this->utils.setFieldData(wBF,      fm);
+  this->utils.setFieldData(GradBF,   fm);
+  this->utils.setFieldData(Velocity, fm);
+
+  for (int t = 0; t < numTracers; ++t) {
+    this->utils.setFieldData(Tracer[t],          fm);
+    this->utils.setFieldData(TracerDot[t],       fm);
+    this->utils.setFieldData(TracerSrc[t],       fm);
+    this->utils.setFieldData(dedotpiTracerde[t], fm);
+    this->utils.setFieldData(Residual[t],        fm);
+  }
+
+  uGradBF.resize(numNodes);
+  UTracerDiv.resize(numTracers);
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void XZHydrostatic_TracersResid<EvalT, Traits>::
+evaluateFields(typename Traits::EvalData workset)
+{
+  for (int t = 0; t < numTracers; ++t)
+    PHAL::set(Residual[t], 0.0);
+
+  for (int cell=0; cell < workset.numCells; ++cell) {
+    for (int level=0; level < numLevels; ++level) {
+      for (int qp=0; qp < numQPs; ++qp) {
+        int node = qp; 
+
+        // Velocity part of div(u*q), the same for every tracer
+        for (int n=0; n < numNodes; ++n) {
+          uGradBF[n] = Velocity(cell,n,level,0) * GradBF(cell,n,qp,0);
+          for (int dim=1; dim < numDims; ++dim)
+            uGradBF[n] += Velocity(cell,n,level,dim) * GradBF(cell,n,qp,dim);
+        }
+
+        for (int t=0; t < numTracers; ++t)
+          UTracerDiv[t] = 0.0;
+        for (int n=0; n < numNodes; ++n)
+          for (int t=0; t < numTracers; ++t)
+            UTracerDiv[t] += uGradBF[n] * Tracer[t](cell,n,level);
+
+        for (int t=0; t < numTracers; ++t)
+          Residual[t](cell,node,level) += ( TracerDot[t](cell,qp,level)
+                                          + TracerSrc[t](cell,qp,level)
+                                          + UTracerDiv[t]
+                                          + dedotpiTracerde[t](cell,qp,level) ) * wBF(cell,node,qp);
+      }
+    }
+  }
+}
+}
@@ -81,7 +81,7 @@ evaluateFields(typename Traits::EvalData workset)
           }
 
 #else
-  Kokkos::parallel_for(XZHydrostatic_UTracer_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), XZHydrostatic_UTracer_Policy(0,workset.numCells),*this);
 
 #endif
 }
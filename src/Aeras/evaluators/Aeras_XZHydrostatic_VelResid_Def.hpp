@@ -126,7 +126,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
 #else
-  Kokkos::parallel_for(XZHydrostatic_VelResid_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), XZHydrostatic_VelResid_Policy(0,workset.numCells),*this);
 
 #endif
 }
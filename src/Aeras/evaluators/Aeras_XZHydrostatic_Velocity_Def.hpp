@@ -70,7 +70,7 @@ evaluateFields(typename Traits::EvalData workset)
           Velocity(cell,node,level,dim) = Velx(cell,node,level,dim);
 
 #else
-  Kokkos::parallel_for(XZHydrostatic_Velocity_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), XZHydrostatic_Velocity_Policy(0,workset.numCells),*this);
 
 #endif
 }
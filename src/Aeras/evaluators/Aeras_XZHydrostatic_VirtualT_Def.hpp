@@ -131,9 +131,9 @@ evaluateFields(typename Traits::EvalData workset)
 
 #else
   if (!vapor) {
-    Kokkos::parallel_for(XZHydrostatic_VirtualT_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), XZHydrostatic_VirtualT_Policy(0,workset.numCells),*this);
   } else { 
-    Kokkos::parallel_for(XZHydrostatic_VirtualT_vapor_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), XZHydrostatic_VirtualT_vapor_Policy(0,workset.numCells),*this);
   }
 
 #endif
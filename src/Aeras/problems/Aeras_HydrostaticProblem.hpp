@@ -188,6 +188,17 @@ Aeras::HydrostaticProblem::constructEvaluators(
   
   const int numQPts = cubature->getNumPoints();
   const int numVertices = cellType->getNodeCount();
+
+  // Sum-factorized gradients on the spectral elements of the sphere
+  const bool sumFactorize = numDim == 2 &&
+    params->sublist("Hydrostatic Problem").get<bool>("Sum Factorization", false);
+  auto setSumFactorization = [&](ParameterList& pl) {
+    if (!sumFactorize) return;
+    pl.set<bool>("Sum Factorization", true);
+    pl.set<string>("Jacobian Inv Name", "Jacobian Inv");
+    pl.set< RCP<Intrepid2::Cubature<PHX::Device> > >("Cubature", cubature);
+    pl.set< RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> > >("Intrepid2 Basis", intrepidBasis);
+  };
   
   const int vecDim = 3;
   *out << "Field Dimensions: Workset=" << worksetSize 
@@ -315,6 +326,7 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", dof_names_tracers_gradient[t]);
 
+    setSumFactorization(*p);
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
   }
@@ -432,6 +444,7 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", dof_names_levels_gradient[1]);
     
+    setSumFactorization(*p);
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
   }
@@ -471,6 +484,7 @@ Aeras::HydrostaticProblem::constructEvaluators(
     p->set<string>("Gradient BF Name", "Grad BF");
     p->set<string>("Gradient Variable Name", "KineticEnergy_gradient");
   
+    setSumFactorization(*p);
     ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
   }
@@ -599,7 +613,8 @@ Aeras::HydrostaticProblem::constructEvaluators(
       p->set<string>("Gradient BF Name"    ,   "Grad BF");
       p->set<string>("Gradient Variable Name",   "Gradient QP Pressure");
     
-      ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
+      setSumFactorization(*p);
+    ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
       fm0.template registerEvaluator<EvalT>(ev);
   }
   {//QP Pi
@@ -749,7 +764,8 @@ Aeras::HydrostaticProblem::constructEvaluators(
       p->set<string>("Gradient BF Name",       "Grad BF");
       p->set<string>("Gradient Variable Name", "Gradient QP GeoPotential");
     
-      ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
+      setSumFactorization(*p);
+    ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
       fm0.template registerEvaluator<EvalT>(ev);
   }
 
@@ -870,7 +886,8 @@ Aeras::HydrostaticProblem::constructEvaluators(
       p->set<string>("Gradient BF Name", "Grad BF");
       p->set<string>("Gradient Variable Name", dof_names_tracers_gradient[t]);
     
-      ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
+      setSumFactorization(*p);
+    ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
       fm0.template registerEvaluator<EvalT>(ev);
     }
 
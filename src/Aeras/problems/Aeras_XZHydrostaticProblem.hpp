@@ -33,13 +33,12 @@
 #include "Aeras_XZHydrostatic_VelResid.hpp"
 #include "Aeras_XZHydrostatic_Velocity.hpp"
 #include "Aeras_XZHydrostatic_EtaDot.hpp"
-#include "Aeras_XZHydrostatic_TracerResid.hpp"
+#include "Aeras_XZHydrostatic_TracersResid.hpp"
 #include "Aeras_XZHydrostatic_TemperatureResid.hpp"
 #include "Aeras_XZHydrostatic_PiVel.hpp"
 #include "Aeras_XZHydrostatic_SPressureResid.hpp"
 #include "Aeras_XZHydrostatic_SurfaceGeopotential.hpp"
 #include "Aeras_XZHydrostatic_KineticEnergy.hpp"
-#include "Aeras_XZHydrostatic_UTracer.hpp"
 #include "Aeras_XZHydrostatic_VirtualT.hpp"
 
 
@@ -756,61 +755,24 @@ Aeras::XZHydrostaticProblem::constructEvaluators(
     fm0.template registerEvaluator<EvalT>(ev);
   }
 
-  for (int t=0; t<numTracers; ++t) {
-    RCP<ParameterList> p = rcp(new ParameterList("XZHydrostatic Tracer Resid"));
-
-    {
-      RCP<ParameterList> p = rcp(new ParameterList("DOF Grad Interpolation "+dof_names_tracers[t]));
-      // Input
-      p->set<string>("Variable Name", dof_names_tracers[t]);
-      p->set<string>("Gradient BF Name", "Grad BF");
-      p->set<string>("Gradient Variable Name", dof_names_tracers_gradient[t]);
-    
-      ev = rcp(new Aeras::DOFGradInterpolationLevels<EvalT,AlbanyTraits>(*p,dl));
-      fm0.template registerEvaluator<EvalT>(ev);
-    }
-
-    {//Level u*Tracer
-      RCP<ParameterList> p = rcp(new ParameterList("UTracer"));
-      p->set<string>("Velocity", "Velocity");
-      p->set<string>("PiVelx",    "PiVelx");
-      p->set<string>("Tracer",    dof_names_tracers[t]);
-      p->set<string>("UTracer",   "U"+dof_names_tracers[t]);
-    
-      ev = rcp(new Aeras::XZHydrostatic_UTracer<EvalT,AlbanyTraits>(*p,dl));
-      fm0.template registerEvaluator<EvalT>(ev);
-    }
-
-    {//Divergence QP UTracer
-      RCP<ParameterList> p = rcp(new ParameterList("Divergence UTracer"));
-      // Input
-      p->set<string>("Variable Name",          "U"+dof_names_tracers[t]);
-      p->set<string>("Gradient BF Name",       "Grad BF");
-
-      p->set<string>("Divergence Variable Name", "U"+dof_names_tracers[t]+"_divergence");
-    
-      ev = rcp(new Aeras::DOFDivInterpolationLevelsXZ<EvalT,AlbanyTraits>(*p,dl));
-      fm0.template registerEvaluator<EvalT>(ev);
-    }
+  if (numTracers > 0) {
+    // All tracer residuals in one evaluator, which shares the velocity part
+    // of div(u*Tracer) between the tracers
+    RCP<ParameterList> p = rcp(new ParameterList("XZHydrostatic Tracers Resid"));
 
     //Input
     p->set<std::string>("Weighted BF Name",                     "wBF");
-    p->set<std::string>("Weighted Gradient BF Name",            "wGrad BF");
-    p->set<std::string>("Gradient QP PiTracer",                 dof_names_tracers_gradient[t]);
-    p->set<std::string>("QP Time Derivative Variable Name",     dof_names_tracers_dot  [t]);
-    p->set<std::string>("Divergence QP UTracer",            "U"+dof_names_tracers      [t]+"_divergence");
-    p->set<std::string>("Residual Name",                        dof_names_tracers_resid[t]);
-    p->set<std::string>("Tracer Source Name",                   dof_names_tracers_src  [t]);
-    p->set<std::string>("Tracer EtaDotd Name",                  dof_names_tracers_deta [t]);
-
-    p->set<RCP<ParamLib> >("Parameter Library", paramLib);
-
-    Teuchos::ParameterList& paramList = params->sublist("XZHydrostatic Problem");
-    p->set<Teuchos::ParameterList*>("XZHydrostatic Problem", &paramList);
+    p->set<std::string>("Gradient BF Name",                     "Grad BF");
+    p->set<std::string>("Velocity",                             "Velocity");
+    p->set< Teuchos::ArrayRCP<std::string> >("Tracer Names",                dof_names_tracers);
+    p->set< Teuchos::ArrayRCP<std::string> >("Time Dependent Tracer Names", dof_names_tracers_dot);
+    p->set< Teuchos::ArrayRCP<std::string> >("Tracer Source Names",         dof_names_tracers_src);
+    p->set< Teuchos::ArrayRCP<std::string> >("Tracer EtaDotd Names",        dof_names_tracers_deta);
 
     //Output
+    p->set< Teuchos::ArrayRCP<std::string> >("Residual Names",              dof_names_tracers_resid);
 
-    ev = rcp(new Aeras::XZHydrostatic_TracerResid<EvalT,AlbanyTraits>(*p,dl));
+    ev = rcp(new Aeras::XZHydrostatic_TracersResid<EvalT,AlbanyTraits>(*p,dl));
     fm0.template registerEvaluator<EvalT>(ev);
   }
 
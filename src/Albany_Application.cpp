@@ -12,6 +12,8 @@
 #include "Albany_ResponseFactory.hpp"
 #include "Albany_Utils.hpp"
 #include "Teuchos_TimeMonitor.hpp"
+#include "Teuchos_CommHelpers.hpp"
+#include "utility/PerformanceContext.hpp"
 
 #if defined(ALBANY_EPETRA)
 #include "EpetraExt_MultiVectorOut.h"
@@ -22,6 +24,9 @@
 #endif
 
 #include "Albany_DataTypes.hpp"
+#include <algorithm>
+#include <cmath>
+#include <map>
 #include <string>
 
 #include "Albany_DummyParameterAccessor.hpp"
@@ -42,7 +47,9 @@
 #endif
 //#endif
 
+#include "Albany_FieldManagerScalarResponseFunction.hpp"
 #include "Albany_ScalarResponseFunction.hpp"
+#include "PHAL_SDirichletSweep.hpp"
 #include "PHAL_Utilities.hpp"
 
 #ifdef ALBANY_PERIDIGM
@@ -151,12 +158,31 @@ int calcTangentDerivDimension(
             : parameterParams.sublist(Albany::strint("Parameter Vector", i));
     np += pList.get<int>("Number");
   }
-  return std::max(1, np);
+  // Room for the solution tangent directions (columns of Vx), so that many
+  // directions are propagated in one evaluation
+  const int nx = problemParams->get<int>("Number of Tangent Directions", 0);
+  return std::max(1, std::max(np, nx));
+}
+
+//! Throw if a static FAD type of the given capacity, 0 if dynamic, cannot
+//! hold the derivative dimension of a field manager
+void checkDerivativeCapacity(const std::string &evalType, const int capacity,
+                             const int dimension, const std::string &option) {
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      capacity > 0 && dimension > capacity, std::logic_error,
+      "Error in Albany::Application::postRegSetup: the " << evalType
+          << " evaluation needs " << dimension
+          << " derivatives, but its FAD type was built with " << capacity
+          << ". Reconfigure with " << option << " of at least " << dimension
+          << ".\n");
 }
 } // namespace
 
 void Albany::Application::initialSetUp(
     const RCP<Teuchos::ParameterList> &params) {
+  util::PhaseGuard phase(util::PerformanceContext::instance().phaseMonitor(),
+                         "Application::initialSetUp");
+
   // Create parameter libraries
   paramLib = rcp(new ParamLib);
   distParamLib = rcp(new DistParamLib);
@@ -220,6 +246,16 @@ void Albany::Application::initialSetUp(
   // Validate Problem parameters against list for this specific problem
   problemParams->validateParameters(*(problem->getValidProblemParameters()), 0);
 
+#if defined(ALBANY_LCM)
+  // The constitutive model status test, set by the problem or by Schwarz
+  if (problemParams->isParameter("Constitutive Model NOX Status Test")) {
+    nox_status_test_ =
+        Teuchos::rcp_dynamic_cast<NOX::StatusTest::ModelEvaluatorFlag>(
+            problemParams->get<Teuchos::RCP<NOX::StatusTest::Generic>>(
+                "Constitutive Model NOX Status Test"));
+  }
+#endif // ALBANY_LCM
+
   try {
     tangent_deriv_dim = calcTangentDerivDimension(problemParams);
   } catch (...) {
@@ -479,6 +515,34 @@ void Albany::Application::initialSetUp(
     //#endif
   }
 
+  // Threaded assembly evaluates worksets of the same color concurrently on
+  // per-thread copies of the workset and the volumetric field managers.
+  // 0 selects the hybrid mode: few ranks per node (e.g. one per socket), each
+  // assembling with all the host threads Kokkos was initialized with, so the
+  // ghost layers are stored once per rank instead of once per core.
+  num_assembly_threads_ = problemParams->get("Workset Assembly Threads", 1);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      num_assembly_threads_ < 0, Teuchos::Exceptions::InvalidParameter,
+      std::endl
+          << "Error in Albany::Application: "
+          << "Workset Assembly Threads must be at least 0." << std::endl);
+  if (num_assembly_threads_ == 0)
+    num_assembly_threads_ =
+        std::max(1, Kokkos::DefaultHostExecutionSpace::concurrency());
+
+  static_graph_export_ =
+      problemParams->get("Static Graph Jacobian Export", false);
+
+  overlap_fill_export_ = problemParams->get("Overlap Fill Export", false);
+
+  cache_basis_functions_ = problemParams->get("Cache Basis Functions", false);
+
+  memoize_fields_ = problemParams->get("Use MDField Memoization", false);
+
+  // Save the states in the Residual fills rather than in a separate pass of
+  // the state field manager at the converged solution
+  states_in_residual_ = problemParams->get("Save States In Residual", false);
+
   // get info from Scaling parameter list (for scaling Jacobian/residual)
   RCP<Teuchos::ParameterList> scalingParams =
       Teuchos::sublist(params, "Scaling", true);
@@ -547,6 +611,8 @@ void Albany::Application::initialSetUp(
   writeToCoutJac = debugParams->get("Write Jacobian to Standard Output", 0);
   writeToCoutRes = debugParams->get("Write Residual to Standard Output", 0);
   derivatives_check_ = debugParams->get<int>("Derivative Check", 0);
+  derivative_check_directions_ =
+      debugParams->get<int>("Derivative Check Directions", 1);
   // the above 4 parameters cannot have values < -1
   if (writeToMatrixMarketJac < -1) {
     TEUCHOS_TEST_FOR_EXCEPTION(
@@ -663,6 +729,20 @@ void Albany::Application::buildProblem() {
 
   problem->buildProblem(meshSpecs, stateMgr);
 
+  // Replicate the volumetric field managers for threaded assembly. Thread 0
+  // uses the problem's own field managers. This has to happen before the
+  // state variables are allocated since evaluators register states.
+  thread_fm_.resize(num_assembly_threads_ - 1);
+  for (int t = 0; t < thread_fm_.size(); t++) {
+    thread_fm_[t].resize(meshSpecs.size());
+    for (int ps = 0; ps < meshSpecs.size(); ps++) {
+      thread_fm_[t][ps] =
+          Teuchos::rcp(new PHX::FieldManager<PHAL::AlbanyTraits>);
+      problem->buildEvaluators(*thread_fm_[t][ps], *meshSpecs[ps], stateMgr,
+                               BUILD_RESID_FM, Teuchos::null);
+    }
+  }
+
   if ((requires_sdbcs_ == true) && (problem->useSDBCs() == false) &&
       (no_dir_bcs_ == false)) {
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
@@ -696,6 +776,8 @@ void Albany::Application::buildProblem() {
   const Teuchos::Array<unsigned int> defaultDataUnsignedInt;
   relative_responses =
       responseList.get("Relative Responses Markers", defaultDataUnsignedInt);
+  fused_response_gradients_ =
+      responseList.get("Fused Gradient Evaluation", false);
 
   // Build state field manager
   if (Teuchos::nonnull(rc_mgr))
@@ -725,6 +807,9 @@ void Albany::Application::buildProblem() {
 }
 
 void Albany::Application::createDiscretization() {
+  util::PhaseGuard phase(util::PerformanceContext::instance().phaseMonitor(),
+                         "Application::createDiscretization");
+
   // Create the full mesh
   disc = discFactory->createDiscretization(
       neq, problem->getSideSetEquations(), stateMgr.getStateInfoStruct(),
@@ -737,6 +822,9 @@ void Albany::Application::createDiscretization() {
 void Albany::Application::finalSetUp(
     const Teuchos::RCP<Teuchos::ParameterList> &params,
     const Teuchos::RCP<const Tpetra_Vector> &initial_guess) {
+  util::PhaseGuard phase(util::PerformanceContext::instance().phaseMonitor(),
+                         "Application::finalSetUp");
+
 
   bool TpetraBuild = Albany::build_type() == Albany::BuildType::Tpetra;
   /*
@@ -853,6 +941,9 @@ void Albany::Application::finalSetUp(
 
   offsets_ = problem->getOffsets();
 
+  if (states_in_residual_)
+    requireStatesInResidualFill();
+
   nfm = problem->getNeumannFieldManager();
 
   if (commT->getRank() == 0) {
@@ -866,6 +957,9 @@ void Albany::Application::finalSetUp(
        << "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx\n"
        << std::endl;
 
+  if (problemParams->get("Report Overlap Storage", false))
+    reportOverlapStorage();
+
   // Allow Problem to add custom NOX status test
   problem->applyProblemSpecificSolverSettings(params);
 
@@ -981,6 +1075,33 @@ RCP<Tpetra_Operator> Albany::Application::getPreconditionerT() {
 RCP<Epetra_Operator> Albany::Application::getPreconditioner() {
 #if defined(ALBANY_TEKO)
   if (precType == "Teko") {
+    // get desired blocking of unknowns, by default the physics blocks of the
+    // problem, which follow the nodal interleaving of the unknowns
+    blockDecomp.clear();
+    if (precParams->isParameter("Unknown Blocking")) {
+      std::stringstream ss;
+      ss << precParams->get<std::string>("Unknown Blocking");
+
+      // figure out the decomposition requested by the string
+      unsigned int num = 0;
+      while (not ss.eof()) {
+        ss >> num;
+        blockDecomp.push_back(num);
+      }
+    } else {
+      blockDecomp = problem->getUnknownBlocking();
+    }
+    unsigned int sum = 0;
+    for (unsigned int i = 0; i < blockDecomp.size(); ++i) {
+      TEUCHOS_ASSERT(blockDecomp[i] > 0);
+      sum += blockDecomp[i];
+    }
+    TEUCHOS_ASSERT(neq == sum);
+
+    // physics-aware presets fill in the inverse factory library
+    if (precParams->isParameter("Preset"))
+      setTekoPreset();
+
     // inverseLib = Teko::InverseLibrary::buildFromStratimikos();
     inverseLib = Teko::InverseLibrary::buildFromParameterList(
         precParams->sublist("Inverse Factory Library"));
@@ -989,20 +1110,6 @@ RCP<Epetra_Operator> Albany::Application::getPreconditioner() {
     inverseFac = inverseLib->getInverseFactory(
         precParams->get("Preconditioner Name", "Amesos"));
 
-    // get desired blocking of unknowns
-    std::stringstream ss;
-    ss << precParams->get<std::string>("Unknown Blocking");
-
-    // figure out the decomposition requested by the string
-    unsigned int num = 0, sum = 0;
-    while (not ss.eof()) {
-      ss >> num;
-      TEUCHOS_ASSERT(num > 0);
-      sum += num;
-      blockDecomp.push_back(num);
-    }
-    TEUCHOS_ASSERT(neq == sum);
-
     return rcp(new Teko::Epetra::InverseFactoryOperator(inverseFac));
   } else
 #endif
@@ -1108,14 +1215,20 @@ void dfm_set(PHAL::Workset &workset, const Teuchos::RCP<const Tpetra_Vector> &x,
 // f_i at x. We don't have the Hessian, however, so approximate the last term by
 // norm(f) O(xd' xd). We use the inf-norm throughout.
 //   For check_lvl >= 1, check that f(x + xd) - f(x) is approximately equal to
-// J(x) xd by computing
+// J(x) xd for num_dirs random perturbations xd. J(x) xd is computed for all of
+// them in one Tangent fill, and f(x + xd) with one Residual fill each. The
+// check reports
 //     reldif(f(x + dx) - f(x), J(x) dx)
 //        = norm(f(x + dx) - f(x) - J(x) dx) /
-//          max(norm(f(x + dx) - f(x)), norm(J(x) dx)).
-// This norm should be on the order of norm(xd).
+//          max(norm(f(x + dx) - f(x)), norm(J(x) dx))
+// over all the equations, and restricted to the equations of each element
+// block and equation offset. It should be on the order of norm(xd); a larger
+// value for only some blocks and offsets points at the evaluators that
+// contribute to them.
 //   For check_lvl >= 2, output a multivector in matrix market format having
 // columns
-//     [x, dx, f(x), f(x + dx) - f(x), f(x + dx) - f(x) - J(x) dx].
+//     [x, f(x), dx, f(x + dx) - f(x), f(x + dx) - f(x) - J(x) dx],
+// with num_dirs columns for each of the last three.
 //   The purpose of this derivative checker is to help find programming errors
 // in the Jacobian. Automatic differentiation largely or entirely prevents math
 // errors, but other kinds of programming errors (uninitialized memory,
@@ -1129,105 +1242,185 @@ void dfm_set(PHAL::Workset &workset, const Teuchos::RCP<const Tpetra_Vector> &x,
 //     <ParameterList>
 //       <ParameterList name="Debug Output">
 //         <Parameter name="Derivative Check" type="int" value="1"/>
+//         <Parameter name="Derivative Check Directions" type="int" value="4"/>
 void checkDerivatives(Albany::Application &app, const double time,
                       const Teuchos::RCP<const Tpetra_Vector> &xdot,
                       const Teuchos::RCP<const Tpetra_Vector> &xdotdot,
                       const Teuchos::RCP<const Tpetra_Vector> &x,
                       const Teuchos::Array<ParamVec> &p,
                       const Teuchos::RCP<const Tpetra_Vector> &fi,
-                      const Teuchos::RCP<const Tpetra_CrsMatrix> &jacobian,
-                      const int check_lvl) {
-  if (check_lvl <= 0)
+                      const int check_lvl, const int num_dirs) {
+  if (check_lvl <= 0 || num_dirs <= 0)
     return;
 
-  // Work vectors. x's map is compatible with f's, so don't distinguish among
-  // maps in this function.
-  Tpetra_Vector w1(x->getMap()), w2(x->getMap()), w3(x->getMap());
-
-  Teuchos::RCP<Tpetra_MultiVector> mv;
-  if (check_lvl > 1)
-    mv = Teuchos::rcp(new Tpetra_MultiVector(x->getMap(), 5));
+  // x's map is compatible with f's, so don't distinguish among maps in this
+  // function.
+  const Teuchos::RCP<const Tpetra_Map> map = x->getMap();
 
-  // Construct a perturbation.
+  // Construct the perturbations.
   const double delta = 1e-7;
-  Tpetra_Vector &xd = w1;
+  Tpetra_MultiVector xd(map, num_dirs);
   xd.randomize();
-  Tpetra_Vector &xpd = w2;
   {
     const Teuchos::ArrayRCP<const RealType> x_d = x->getData();
-    const Teuchos::ArrayRCP<RealType> xd_d = xd.getDataNonConst(),
-                                      xpd_d = xpd.getDataNonConst();
-    for (size_t i = 0; i < x_d.size(); ++i) {
-      xd_d[i] = 2 * xd_d[i] - 1;
-      const double xdi = xd_d[i];
-      if (x_d[i] == 0) {
-        // No scalar-level way to get the magnitude of x_i, so just go with
-        // something:
-        xd_d[i] = xpd_d[i] = delta * xd_d[i];
-      } else {
-        // Make the perturbation meaningful relative to the magnitude of x_i.
-        xpd_d[i] = (1 + delta * xd_d[i]) * x_d[i]; // mult line
-        // Sanitize xd_d.
-        xd_d[i] = xpd_d[i] - x_d[i];
-        if (xd_d[i] == 0) {
-          // Underflow in "mult line" occurred because x_d[i] is something like
-          // 1e-314. That's a possible sign of uninitialized memory. However,
-          // carry on here to get a good perturbation by reverting to the
-          // no-magnitude case:
-          xd_d[i] = xpd_d[i] = delta * xd_d[i];
+    for (int k = 0; k < num_dirs; ++k) {
+      const Teuchos::ArrayRCP<RealType> xd_d = xd.getDataNonConst(k);
+      for (size_t i = 0; i < x_d.size(); ++i) {
+        xd_d[i] = 2 * xd_d[i] - 1;
+        if (x_d[i] == 0) {
+          // No scalar-level way to get the magnitude of x_i, so just go with
+          // something:
+          xd_d[i] = delta * xd_d[i];
+        } else {
+          // Make the perturbation meaningful relative to the magnitude of
+          // x_i.
+          const double xpdi = (1 + delta * xd_d[i]) * x_d[i]; // mult line
+          if (xpdi == x_d[i]) {
+            // Underflow in "mult line" occurred because x_d[i] is something
+            // like 1e-314. That's a possible sign of uninitialized memory.
+            // However, carry on here to get a good perturbation by reverting
+            // to the no-magnitude case:
+            xd_d[i] = delta * xd_d[i];
+          } else {
+            // Sanitize xd_d.
+            xd_d[i] = xpdi - x_d[i];
+          }
         }
       }
     }
   }
-  if (Teuchos::nonnull(mv)) {
-    mv->getVectorNonConst(0)->update(1, *x, 0);
-    mv->getVectorNonConst(1)->update(1, xd, 0);
-  }
 
   // If necessary, compute f(x).
   Teuchos::RCP<const Tpetra_Vector> f;
   if (fi.is_null()) {
-    Teuchos::RCP<Tpetra_Vector> w =
-        Teuchos::rcp(new Tpetra_Vector(x->getMap()));
+    Teuchos::RCP<Tpetra_Vector> w = Teuchos::rcp(new Tpetra_Vector(map));
     app.computeGlobalResidualT(time, xdot.get(), xdotdot.get(), *x, p, *w);
     f = w;
   } else {
     f = fi;
   }
-  if (Teuchos::nonnull(mv))
-    mv->getVectorNonConst(2)->update(1, *f, 0);
 
-  // fpd = f(xpd).
-  Tpetra_Vector &fpd = w3;
-  app.computeGlobalResidualT(time, xdot.get(), xdotdot.get(), xpd, p, fpd);
+  // Jxd = J xd, for all the perturbations in one Tangent fill.
+  Tpetra_MultiVector Jxd(map, num_dirs);
+  app.computeGlobalTangentT(0.0, 1.0, 0.0, time, false, xdot.get(),
+                            xdotdot.get(), *x, p, NULL, &xd, NULL, NULL, NULL,
+                            NULL, &Jxd, NULL);
 
-  // fd = fpd - f.
-  Tpetra_Vector &fd = fpd;
-  fd.update(-1, *f, 1);
-  if (Teuchos::nonnull(mv))
-    mv->getVectorNonConst(3)->update(1, fd, 0);
+  // fd = f(x + xd) - f.
+  Tpetra_MultiVector fd(map, num_dirs);
+  {
+    Tpetra_Vector xpd(map);
+    for (int k = 0; k < num_dirs; ++k) {
+      xpd.update(1, *x, 1, *xd.getVector(k), 0);
+      const Teuchos::RCP<Tpetra_Vector> fpd = fd.getVectorNonConst(k);
+      app.computeGlobalResidualT(time, xdot.get(), xdotdot.get(), xpd, p,
+                                 *fpd);
+      fpd->update(-1, *f, 1);
+    }
+  }
 
-  // Jxd = J xd.
-  Tpetra_Vector &Jxd = w2;
-  jacobian->apply(xd, Jxd);
+  // d = fd - Jxd.
+  Tpetra_MultiVector d(map, num_dirs);
+  d.update(1, fd, -1, Jxd, 0);
 
   // Norms.
-  const double fdn = fd.normInf(), Jxdn = Jxd.normInf(), xdn = xd.normInf();
-  // d = norm(fd - Jxd).
-  Tpetra_Vector &d = fd;
-  d.update(-1, Jxd, 1);
-  if (Teuchos::nonnull(mv))
-    mv->getVectorNonConst(4)->update(1, d, 0);
-  const double dn = d.normInf();
+  Teuchos::Array<double> fdn(num_dirs), Jxdn(num_dirs), xdn(num_dirs),
+      dn(num_dirs);
+  fd.normInf(fdn());
+  Jxd.normInf(Jxdn());
+  xd.normInf(xdn());
+  d.normInf(dn());
+  double e = 0, xdn_max = 0;
+  for (int k = 0; k < num_dirs; ++k) {
+    const double den = std::max(fdn[k], Jxdn[k]);
+    e = std::max(e, den > 0 ? dn[k] / den : 0.0);
+    xdn_max = std::max(xdn_max, xdn[k]);
+  }
+
+  // Maxima of |d|, |fd| and |Jxd| per element block and equation offset,
+  // gathered on the overlapped map through the element connectivity.
+  const Teuchos::RCP<Albany::AbstractDiscretization> disc =
+      app.getDiscretization();
+  const int neq = app.getNumEquations();
+  const auto &meshSpecs = disc->getMeshStruct()->getMeshSpecs();
+  std::map<std::string, int> blocks;
+  Teuchos::Array<std::string> blockNames;
+  for (int b = 0; b < meshSpecs.size(); ++b)
+    if (blocks.insert(std::make_pair(meshSpecs[b]->ebName,
+                                     static_cast<int>(blockNames.size())))
+            .second)
+      blockNames.push_back(meshSpecs[b]->ebName);
+  const int numBlocks = blockNames.size();
+
+  Teuchos::Array<double> local(3 * numBlocks * neq, 0.0),
+      global(3 * numBlocks * neq, 0.0);
+  {
+    const Teuchos::RCP<Tpetra_Import> importerT =
+        app.getAdaptSolMgrT()->get_importerT();
+    const Teuchos::RCP<const Tpetra_Map> overlapMap = disc->getOverlapMapT();
+    Tpetra_MultiVector overlap_d(overlapMap, num_dirs),
+        overlap_fd(overlapMap, num_dirs), overlap_Jxd(overlapMap, num_dirs);
+    overlap_d.doImport(d, *importerT, Tpetra::INSERT);
+    overlap_fd.doImport(fd, *importerT, Tpetra::INSERT);
+    overlap_Jxd.doImport(Jxd, *importerT, Tpetra::INSERT);
+    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<const ST>> d_d =
+        overlap_d.get2dView(),
+        fd_d = overlap_fd.get2dView(), Jxd_d = overlap_Jxd.get2dView();
+
+    const auto &wsElNodeEqID = disc->getWsElNodeEqID();
+    const auto &wsEBNames = disc->getWsEBNames();
+    for (int ws = 0; ws < wsElNodeEqID.size(); ++ws) {
+      const auto block = blocks.find(wsEBNames[ws]);
+      if (block == blocks.end())
+        continue;
+      const auto eqID = Kokkos::create_mirror_view(wsElNodeEqID[ws]);
+      Kokkos::deep_copy(eqID, wsElNodeEqID[ws]);
+      for (int cell = 0; cell < eqID.dimension(0); ++cell)
+        for (int node = 0; node < eqID.dimension(1); ++node)
+          for (int eq = 0; eq < eqID.dimension(2) && eq < neq; ++eq) {
+            const LO lid = eqID(cell, node, eq);
+            if (lid < 0)
+              continue;
+            double *const entry = &local[3 * (block->second * neq + eq)];
+            for (int k = 0; k < num_dirs; ++k) {
+              entry[0] = std::max(entry[0], std::abs(d_d[k][lid]));
+              entry[1] = std::max(entry[1], std::abs(fd_d[k][lid]));
+              entry[2] = std::max(entry[2], std::abs(Jxd_d[k][lid]));
+            }
+          }
+    }
+  }
+  Teuchos::reduceAll<int, double>(*map->getComm(), Teuchos::REDUCE_MAX,
+                                  local.size(), local.getRawPtr(),
+                                  global.getRawPtr());
 
   // Assess.
-  const double den = std::max(fdn, Jxdn), e = dn / den;
-  *Teuchos::VerboseObjectBase::getDefaultOStream()
-      << "Albany::Application Check Derivatives level " << check_lvl << ":\n"
-      << "   reldif(f(x + dx) - f(x), J(x) dx) = " << e
-      << ",\n which should be on the order of " << xdn << "\n";
+  Teuchos::RCP<Teuchos::FancyOStream> out =
+      Teuchos::VerboseObjectBase::getDefaultOStream();
+  *out << "Albany::Application Check Derivatives level " << check_lvl << ", "
+       << num_dirs << " directions:\n"
+       << "   reldif(f(x + dx) - f(x), J(x) dx) = " << e
+       << ",\n which should be on the order of " << xdn_max << "\n"
+       << "   per element block and equation:\n";
+  for (int b = 0; b < numBlocks; ++b)
+    for (int eq = 0; eq < neq; ++eq) {
+      const double *const entry = &global[3 * (b * neq + eq)];
+      const double den = std::max(entry[1], entry[2]);
+      *out << "     " << blockNames[b] << " equation " << eq << ": "
+           << (den > 0 ? entry[0] / den : 0.0) << "\n";
+    }
 
-  if (Teuchos::nonnull(mv)) {
+  if (check_lvl > 1) {
+    Teuchos::RCP<Tpetra_MultiVector> mv =
+        Teuchos::rcp(new Tpetra_MultiVector(map, 2 + 3 * num_dirs));
+    mv->getVectorNonConst(0)->update(1, *x, 0);
+    mv->getVectorNonConst(1)->update(1, *f, 0);
+    for (int k = 0; k < num_dirs; ++k) {
+      mv->getVectorNonConst(2 + k)->update(1, *xd.getVector(k), 0);
+      mv->getVectorNonConst(2 + num_dirs + k)->update(1, *fd.getVector(k), 0);
+      mv->getVectorNonConst(2 + 2 * num_dirs + k)
+          ->update(1, *d.getVector(k), 0);
+    }
     static int ctr = 0;
     std::stringstream ss;
     ss << "dc" << ctr << ".mm";
@@ -1235,14 +1428,208 @@ void checkDerivatives(Albany::Application &app, const double time,
     ++ctr;
   }
 }
+
+//! Keep a copy of v, reusing the storage of the previous copy
+void copyStateVector(Teuchos::RCP<Tpetra_Vector> &copy,
+                     const Tpetra_Vector *v) {
+  if (v == NULL) {
+    copy = Teuchos::null;
+    return;
+  }
+  if (copy.is_null() || copy->getMap() != v->getMap())
+    copy = Teuchos::rcp(new Tpetra_Vector(v->getMap()));
+  copy->update(1.0, *v, 0.0);
+}
+
+// Zero the overlapped Jacobian before a fill. Under Kokkos the scatter adds
+// into the device values of the local matrix, so they are zeroed there. The
+// matrix is only fill completed once, to create its local matrix, and is
+// then kept fill active for evaluators that still sum through CrsMatrix.
+void zeroOverlappedJacobianT(Tpetra_CrsMatrix &jacT) {
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  if (!jacT.isFillActive())
+    jacT.resumeFill();
+  if (jacT.getLocalMatrix().values.dimension(0) != jacT.getNodeNumEntries()) {
+    jacT.fillComplete();
+    jacT.resumeFill();
+  }
+  Kokkos::deep_copy(jacT.getLocalMatrix().values, 0.0);
+#else
+  jacT.setAllToScalar(0.0);
+#endif
+}
+
+//! True if the local entries of v equal those of the copy
+bool sameStateVector(const Teuchos::RCP<Tpetra_Vector> &copy,
+                     const Tpetra_Vector *v) {
+  if (copy.is_null() || v == NULL)
+    return copy.is_null() && v == NULL;
+  if (copy->getMap() != v->getMap())
+    return false;
+  Teuchos::ArrayRCP<const ST> a = copy->get1dView();
+  Teuchos::ArrayRCP<const ST> b = v->get1dView();
+  for (int i = 0; i < a.size(); i++)
+    if (a[i] != b[i])
+      return false;
+  return true;
+}
 } // namespace
 
+void Albany::Application::exportJacobianT(
+    const Tpetra_CrsMatrix& overlapped_jacT, Tpetra_CrsMatrix& jacT,
+    const Teuchos::RCP<const Tpetra_Export>& exporterT) {
+  if (!static_graph_export_) {
+    jacT.doExport(overlapped_jacT, *exporterT, Tpetra::ADD);
+    return;
+  }
+  getJacobianExporterT(overlapped_jacT, jacT, exporterT)
+      .exportAdd(overlapped_jacT, jacT);
+}
+
+Albany::StaticGraphExporter &Albany::Application::getJacobianExporterT(
+    const Tpetra_CrsMatrix& overlapped_jacT, const Tpetra_CrsMatrix& jacT,
+    const Teuchos::RCP<const Tpetra_Export>& exporterT) {
+  // The graphs only change on adaptation; rebuild the plan when they do
+  if (jac_exporterT_.is_null() ||
+      !jac_exporterT_->isCompatible(overlapped_jacT, jacT)) {
+    jac_exporterT_ = Teuchos::rcp(new StaticGraphExporter(
+        overlapped_jacT.getCrsGraph(), jacT.getCrsGraph(), exporterT));
+  }
+  return *jac_exporterT_;
+}
+
+bool Albany::Application::overlapFillExportT(
+    const Teuchos::RCP<const Tpetra_Export>& exporterT) {
+  if (!overlap_fill_export_ || useThreadedAssembly())
+    return false;
+
+  const auto &wsElNodeEqID = disc->getWsElNodeEqID();
+  const int numWorksets = wsElNodeEqID.size();
+
+  // The export and the worksets only change on adaptation
+  if (vec_exporterT_.is_null() || vec_exporterT_->getExporter() != exporterT ||
+      static_cast<int>(ws_export_order_.size()) != numWorksets) {
+    vec_exporterT_ = Teuchos::rcp(new AsyncVectorExporter(exporterT));
+
+    // A row sent to another rank only gets contributions from the elements
+    // of its node, so it is complete once the worksets with such an element
+    // are assembled
+    std::vector<int> sent, others;
+    for (int ws = 0; ws < numWorksets; ++ws) {
+      const auto eqID = Kokkos::create_mirror_view(wsElNodeEqID[ws]);
+      Kokkos::deep_copy(eqID, wsElNodeEqID[ws]);
+      const LO *const lids = eqID.data();
+      bool isSent = false;
+      for (std::size_t i = 0; !isSent && i < eqID.size(); ++i)
+        isSent = lids[i] >= 0 && vec_exporterT_->isSent(lids[i]);
+      (isSent ? sent : others).push_back(ws);
+    }
+    num_sent_worksets_ = sent.size();
+    ws_export_order_ = sent;
+    ws_export_order_.insert(ws_export_order_.end(), others.begin(),
+                            others.end());
+  }
+  return true;
+}
+
+bool Albany::Application::useThreadedAssembly() const {
+  return num_assembly_threads_ > 1 && disc->getWsColors().size() > 0;
+}
+
+void Albany::Application::reportOverlapStorage() const {
+  // Ghost entries are the overlap entries beyond the owned ones: the
+  // coordinate, solution and state ghosts scale with the overlap map and the
+  // Jacobian ghosts with the overlap graph. Their sum over the ranks shows
+  // how much the ghost layers cost for a given number of ranks per node.
+  const Teuchos::RCP<const Tpetra_CrsGraph> graph = disc->getJacobianGraphT();
+  const Teuchos::RCP<const Tpetra_CrsGraph> overlapGraph =
+      disc->getOverlapJacobianGraphT();
+  const double local[4] = {
+      static_cast<double>(disc->getMapT()->getNodeNumElements()),
+      static_cast<double>(disc->getOverlapMapT()->getNodeNumElements()),
+      static_cast<double>(graph->getNodeNumEntries()),
+      static_cast<double>(overlapGraph->getNodeNumEntries())};
+  double sum[4], max[4];
+  Teuchos::reduceAll<int, double>(*commT, Teuchos::REDUCE_SUM, 4, local, sum);
+  Teuchos::reduceAll<int, double>(*commT, Teuchos::REDUCE_MAX, 4, local, max);
+
+  const double ghostDofs = sum[1] - sum[0];
+  const double ghostEntries = sum[3] - sum[2];
+  *out << "Overlap storage on " << commT->getSize() << " ranks with "
+       << num_assembly_threads_ << " assembly thread(s) each:\n"
+       << "  ghost DOFs:            " << ghostDofs << " ("
+       << (sum[0] > 0 ? 100.0 * ghostDofs / sum[0] : 0.0)
+       << "% of owned), max overlap DOFs per rank " << max[1] << "\n"
+       << "  ghost Jacobian entries: " << ghostEntries << " ("
+       << (sum[2] > 0 ? 100.0 * ghostEntries / sum[2] : 0.0)
+       << "% of owned), max overlap entries per rank " << max[3]
+       << std::endl;
+}
+
+template <typename EvalT>
+void Albany::Application::evaluateColoredWorksets(
+    PHAL::Workset const &workset) {
+  const auto &wsColors = disc->getWsColors();
+  const auto &wsPhysIndex = disc->getWsPhysIndex();
+
+  int const numWorksets = wsColors.size();
+  int const numThreads = num_assembly_threads_;
+
+  // Group the worksets by color
+  int numColors = 0;
+  for (int ws = 0; ws < numWorksets; ws++)
+    numColors = std::max(numColors, wsColors[ws] + 1);
+  std::vector<std::vector<int>> colorWorksets(numColors);
+  for (int ws = 0; ws < numWorksets; ws++)
+    colorWorksets[wsColors[ws]].push_back(ws);
+
+  // Per-thread copies of the workset. They are made here, outside the
+  // parallel region, because reference counting of the shared RCPs is not
+  // thread safe.
+  std::vector<PHAL::Workset> threadWorksets(numThreads, workset);
+
+  for (int c = 0; c < numColors; c++) {
+    std::vector<int> const &worksets = colorWorksets[c];
+    // Worksets of one color touch disjoint rows of the overlapped residual
+    // and Jacobian, so scatters from different threads do not collide.
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, numThreads),
+        [&](int const t) {
+          PHAL::Workset &threadWorkset = threadWorksets[t];
+          for (int i = t; i < worksets.size(); i += numThreads) {
+            int const ws = worksets[i];
+            loadWorksetBucketInfo<EvalT>(threadWorkset, ws);
+            PHX::FieldManager<PHAL::AlbanyTraits> &threadFm =
+                t == 0 ? *fm[wsPhysIndex[ws]]
+                       : *thread_fm_[t - 1][wsPhysIndex[ws]];
+            threadFm.template evaluateFields<EvalT>(threadWorkset);
+          }
+        });
+  }
+
+  // The Neumann field managers are not replicated; evaluate them serially.
+  if (nfm != Teuchos::null) {
+    PHAL::Workset &neumannWorkset = threadWorksets[0];
+    for (int ws = 0; ws < numWorksets; ws++) {
+      loadWorksetBucketInfo<EvalT>(neumannWorkset, ws);
+#ifdef ALBANY_PERIDIGM
+      // DJL avoid passing a sphere mesh through a nfm that was
+      // created for non-sphere topology.
+      if (neumannWorkset.sideSets->size() == 0)
+        continue;
+#endif
+      deref_nfm(nfm, wsPhysIndex, ws)
+          ->template evaluateFields<EvalT>(neumannWorkset);
+    }
+  }
+}
+
 void Albany::Application::computeGlobalResidualImplT(
     double const current_time, Teuchos::RCP<Tpetra_Vector const> const &xdotT,
     Teuchos::RCP<Tpetra_Vector const> const &xdotdotT,
     Teuchos::RCP<Tpetra_Vector const> const &xT,
     Teuchos::Array<ParamVec> const &p, Teuchos::RCP<Tpetra_Vector> const &fT) {
-  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Residual");
+  UTIL_FUNC_PHASE_MONITOR("> Albany Fill: Residual");
   postRegSetup("Residual");
 
   // Load connectivity map and coordinates
@@ -1257,8 +1644,7 @@ void Albany::Application::computeGlobalResidualImplT(
       solMgrT->get_overlapped_fT();
 
   Teuchos::RCP<Tpetra_Export> const exporterT = solMgrT->get_exporterT();
-
-  Teuchos::RCP<Tpetra_Import> const importerT = solMgrT->get_importerT();
+  bool const overlap_export = overlapFillExportT(exporterT);
 
   // Scatter x and xdot to the overlapped distrbution
   solMgrT->scatterXT(*xT, xdotT.get(), xdotdotT.get());
@@ -1290,6 +1676,15 @@ void Albany::Application::computeGlobalResidualImplT(
     xdotdot_ = Teuchos::null;
 #endif // ALBANY_LCM
 
+  // This fill saves the states; remember where
+  if (states_in_residual_) {
+    states_saved_ = true;
+    states_time_ = fixTime(current_time);
+    copyStateVector(states_xT_, xT.get());
+    copyStateVector(states_xdotT_, xdotT.get());
+    copyStateVector(states_xdotdotT_, xdotdotT.get());
+  }
+
   // Zero out overlapped residual - Tpetra
   overlapped_fT->putScalar(0.0);
   fT->putScalar(0.0);
@@ -1320,47 +1715,74 @@ void Albany::Application::computeGlobalResidualImplT(
 
     workset.fT = overlapped_fT;
 
-    for (int ws = 0; ws < numWorksets; ws++) {
-      loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws);
+    if (useThreadedAssembly()) {
+      evaluateColoredWorksets<PHAL::AlbanyTraits::Residual>(workset);
+    } else {
+      for (int i = 0; i < numWorksets; i++) {
+        // Post the rows sent to other ranks once they are assembled
+        if (overlap_export && i == num_sent_worksets_)
+          vec_exporterT_->beginExportAdd(*overlapped_fT);
+        const int ws = overlap_export ? ws_export_order_[i] : i;
+
+        loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws);
 
 #ifdef DEBUG_OUTPUT
-      *out << "IKT countRes = " << countRes
-           << ", computeGlobalResid workset.xT = \n ";
-      (workset.xT)->describe(*out, Teuchos::VERB_EXTREME);
+        *out << "IKT countRes = " << countRes
+             << ", computeGlobalResid workset.xT = \n ";
+        (workset.xT)->describe(*out, Teuchos::VERB_EXTREME);
 #endif
 
-      // FillType template argument used to specialize Sacado
+        // FillType template argument used to specialize Sacado
 #ifdef DEBUG_OUTPUT2
-      std::cout << "calling FM evaluate fields in computeGlobalResidualImplT" << std::endl;
+        std::cout << "calling FM evaluate fields in computeGlobalResidualImplT" << std::endl;
 #endif
-      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(
-          workset);
-      if (nfm != Teuchos::null) {
+        fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(
+            workset);
+        if (nfm != Teuchos::null) {
 #ifdef ALBANY_PERIDIGM
-        // DJL this is a hack to avoid running a block with sphere elements
-        // through a Neumann field manager that was constructed for a non-sphere
-        // element topology.  The root cause is that Albany currently supports
-        // only a single Neumann field manager.  The history on that is murky.
-        // The single field manager is created for a specific element topology,
-        // and it fails if applied to worksets with a different element
-        // topology. The Peridigm use case is a discretization that contains
-        // blocks with sphere elements and blocks with standard FEM solid
-        // elements, and we want to apply Neumann BC to the standard solid
-        // elements.
-        if (workset.sideSets->size() != 0) {
+          // DJL this is a hack to avoid running a block with sphere elements
+          // through a Neumann field manager that was constructed for a non-sphere
+          // element topology.  The root cause is that Albany currently supports
+          // only a single Neumann field manager.  The history on that is murky.
+          // The single field manager is created for a specific element topology,
+          // and it fails if applied to worksets with a different element
+          // topology. The Peridigm use case is a discretization that contains
+          // blocks with sphere elements and blocks with standard FEM solid
+          // elements, and we want to apply Neumann BC to the standard solid
+          // elements.
+          if (workset.sideSets->size() != 0) {
+            deref_nfm(nfm, wsPhysIndex, ws)
+                ->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
+          }
+#else
           deref_nfm(nfm, wsPhysIndex, ws)
               ->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
-        }
-#else
-        deref_nfm(nfm, wsPhysIndex, ws)
-            ->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
 #endif
+        }
       }
+      if (overlap_export && num_sent_worksets_ == numWorksets)
+        vec_exporterT_->beginExportAdd(*overlapped_fT);
     }
   }
 
   // Assemble the residual into a non-overlapping vector
-  fT->doExport(*overlapped_fT, *exporterT, Tpetra::ADD);
+  if (overlap_export)
+    vec_exporterT_->endExportAdd(*overlapped_fT, *fT);
+  else
+    fT->doExport(*overlapped_fT, *exporterT, Tpetra::ADD);
+
+  finishGlobalResidualT(current_time, xdotT, xdotdotT, xT, overlapped_fT, fT);
+}
+
+void Albany::Application::finishGlobalResidualT(
+    double const current_time, Teuchos::RCP<Tpetra_Vector const> const &xdotT,
+    Teuchos::RCP<Tpetra_Vector const> const &xdotdotT,
+    Teuchos::RCP<Tpetra_Vector const> const &xT,
+    Teuchos::RCP<Tpetra_Vector> const &overlapped_fT,
+    Teuchos::RCP<Tpetra_Vector> const &fT) {
+#if defined(ALBANY_LCM)
+  Teuchos::RCP<Tpetra_Import> const importerT = solMgrT->get_importerT();
+#endif // ALBANY_LCM
 
   // Allocate scaleVec_
   if (scale != 1.0) {
@@ -1458,20 +1880,20 @@ void Albany::Application::computeGlobalResidual(
   // Create Tpetra copies of Epetra arguments
   // Names of Tpetra entitied are identified by the suffix T
   const Teuchos::RCP<const Tpetra_Vector> xT =
-      Petra::EpetraVector_To_TpetraVectorNonConst(x, commT);
+      Petra::EpetraVector_To_TpetraVectorNonConst(x, disc->getMapT());
 
   Teuchos::RCP<const Tpetra_Vector> xdotT;
   if (xdot != NULL && num_time_deriv > 0) {
-    xdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdot, commT);
+    xdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdot, disc->getMapT());
   }
 
   Teuchos::RCP<const Tpetra_Vector> xdotdotT;
   if (xdotdot != NULL && num_time_deriv > 1) {
-    xdotdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdotdot, commT);
+    xdotdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdotdot, disc->getMapT());
   }
 
   const Teuchos::RCP<Tpetra_Vector> fT =
-      Petra::EpetraVector_To_TpetraVectorNonConst(f, commT);
+      Petra::EpetraVector_To_TpetraVectorNonConst(f, disc->getMapT());
 
   if (problem->useSDBCs() == false) {
     this->computeGlobalResidualImplT(current_time, xdotT, xdotdotT, xT, p, fT);
@@ -1535,6 +1957,12 @@ void Albany::Application::computeGlobalResidualT(
         Teuchos::rcpFromRef(xT), p, Teuchos::rcpFromRef(fT));
   }
 
+#if defined(ALBANY_LCM)
+  // Reduce the failure flags of the constitutive models while NOX works
+  // on the residual; the status test waits for the result
+  if (Teuchos::nonnull(nox_status_test_)) nox_status_test_->postSyncFlag();
+#endif // ALBANY_LCM
+
   // Debut output
   if (writeToMatrixMarketRes !=
       0) {          // If requesting writing to MatrixMarket of residual...
@@ -1569,6 +1997,134 @@ void Albany::Application::computeGlobalResidualT(
   }
 }
 
+void Albany::Application::computeGlobalResidualsT(
+    const double current_time, const Tpetra_Vector *xdotT,
+    const Tpetra_Vector *xdotdotT, const Tpetra_MultiVector &xT,
+    const Teuchos::Array<Teuchos::Array<ParamVec>> &p,
+    Tpetra_MultiVector &fT) {
+  int const numSamples = p.size();
+  ALBANY_ASSERT(
+      fT.getNumVectors() == static_cast<size_t>(numSamples) &&
+          (xT.getNumVectors() == 1 ||
+           xT.getNumVectors() == static_cast<size_t>(numSamples)),
+      "computeGlobalResidualsT needs one residual, and one or a shared "
+      "solution, per sample");
+  bool const sharedX = xT.getNumVectors() == 1;
+
+  // The batched sweep only replaces the plain element fill. Everything else
+  // evaluates the samples one at a time.
+  bool batched = !problem->useSDBCs() && !useThreadedAssembly();
+#ifdef ALBANY_PERIDIGM
+  batched = false;
+#endif
+  if (!batched) {
+    for (int s = 0; s < numSamples; s++) {
+      computeGlobalResidualT(current_time, xdotT, xdotdotT,
+                             *xT.getVector(sharedX ? 0 : s), p[s],
+                             *fT.getVectorNonConst(s));
+    }
+    return;
+  }
+
+  UTIL_FUNC_PHASE_MONITOR("> Albany Fill: Residual");
+  postRegSetup("Residual");
+
+  const auto &wsElNodeEqID = disc->getWsElNodeEqID();
+  const auto &wsPhysIndex = disc->getWsPhysIndex();
+
+  int const numWorksets = wsElNodeEqID.size();
+
+  Teuchos::RCP<Tpetra_Export> const exporterT = solMgrT->get_exporterT();
+
+  // Scatter the first solution and the time derivatives, which all samples
+  // share, then the other solutions to their own overlapped vectors
+  solMgrT->scatterXT(*xT.getVector(0), xdotT, xdotdotT);
+  Teuchos::RCP<Tpetra_MultiVector> overlapped_xT;
+  if (!sharedX) {
+    overlapped_xT = Teuchos::rcp(
+        new Tpetra_MultiVector(disc->getOverlapMapT(), numSamples, false));
+    overlapped_xT->doImport(xT, *solMgrT->get_importerT(), Tpetra::INSERT);
+  }
+
+  distParamLib->scatter();
+
+  Teuchos::RCP<Tpetra_MultiVector> const overlapped_fT = Teuchos::rcp(
+      new Tpetra_MultiVector(disc->getOverlapMapT(), numSamples, true));
+  fT.putScalar(0.0);
+
+  if (Teuchos::nonnull(rc_mgr)) {
+    rc_mgr->init_x_if_not(xT.getMap());
+  }
+
+  // Sweep the worksets once, evaluating all samples on each workset while
+  // its connectivity, coordinates and cached basis functions are in cache
+  {
+    PHAL::Workset workset;
+
+    double const
+    this_time = fixTime(current_time);
+
+    loadBasicWorksetInfoT(workset, this_time);
+
+    Teuchos::Array<Teuchos::RCP<Tpetra_Vector>> overlapped_fTs(numSamples);
+    Teuchos::Array<Teuchos::RCP<Tpetra_Vector>> overlapped_xTs(numSamples);
+    for (int s = 0; s < numSamples; s++) {
+      overlapped_fTs[s] = overlapped_fT->getVectorNonConst(s);
+      overlapped_xTs[s] =
+          sharedX ? workset.xT : overlapped_xT->getVectorNonConst(s);
+    }
+
+    for (int ws = 0; ws < numWorksets; ws++) {
+      loadWorksetBucketInfo<PHAL::AlbanyTraits::Residual>(workset, ws);
+
+      for (int s = 0; s < numSamples; s++) {
+        for (int i = 0; i < p[s].size(); i++) {
+          for (unsigned int j = 0; j < p[s][i].size(); j++) {
+            p[s][i][j].family->setRealValueForAllTypes(p[s][i][j].baseValue);
+          }
+        }
+        workset.xT = overlapped_xTs[s];
+        workset.fT = overlapped_fTs[s];
+
+        fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Residual>(
+            workset);
+        if (nfm != Teuchos::null) {
+          deref_nfm(nfm, wsPhysIndex, ws)
+              ->evaluateFields<PHAL::AlbanyTraits::Residual>(workset);
+        }
+      }
+    }
+  }
+
+  // Assemble, scale and apply the Dirichlet conditions sample by sample, with
+  // the parameters of each sample set again for the Dirichlet field manager
+  for (int s = 0; s < numSamples; s++) {
+    for (int i = 0; i < p[s].size(); i++) {
+      for (unsigned int j = 0; j < p[s][i].size(); j++) {
+        p[s][i][j].family->setRealValueForAllTypes(p[s][i][j].baseValue);
+      }
+    }
+
+    Teuchos::RCP<Tpetra_Vector const> const xT_s =
+        xT.getVector(sharedX ? 0 : s);
+    Teuchos::RCP<Tpetra_Vector> const fT_s = fT.getVectorNonConst(s);
+
+#if defined(ALBANY_LCM)
+    x_ = Teuchos::rcp(new Tpetra_Vector(*xT_s));
+    xdot_ = (xdotT != NULL) ? Teuchos::rcp(new Tpetra_Vector(*xdotT))
+                            : Teuchos::null;
+    xdotdot_ = (xdotdotT != NULL) ? Teuchos::rcp(new Tpetra_Vector(*xdotdotT))
+                                  : Teuchos::null;
+#endif // ALBANY_LCM
+
+    fT_s->doExport(*overlapped_fT->getVector(s), *exporterT, Tpetra::ADD);
+
+    finishGlobalResidualT(current_time, Teuchos::rcp(xdotT, false),
+                          Teuchos::rcp(xdotdotT, false), xT_s,
+                          overlapped_fT->getVectorNonConst(s), fT_s);
+  }
+}
+
 #if defined(ALBANY_EPETRA)
 double Albany::Application::computeConditionNumber(Epetra_CrsMatrix &matrix) {
   AztecOOConditionNumber conditionEstimator;
@@ -1593,7 +2149,7 @@ void Albany::Application::computeGlobalJacobianImplT(
     const Teuchos::RCP<const Tpetra_Vector> &xT,
     const Teuchos::Array<ParamVec> &p, const Teuchos::RCP<Tpetra_Vector> &fT,
     const Teuchos::RCP<Tpetra_CrsMatrix> &jacT) {
-  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian");
+  UTIL_FUNC_PHASE_MONITOR("> Albany Fill: Jacobian");
 
   postRegSetup("Jacobian");
 
@@ -1615,6 +2171,7 @@ void Albany::Application::computeGlobalJacobianImplT(
   Teuchos::RCP<Tpetra_CrsMatrix> overlapped_jacT =
       solMgrT->get_overlapped_jacT();
   Teuchos::RCP<Tpetra_Export> exporterT = solMgrT->get_exporterT();
+  bool const overlap_export = overlapFillExportT(exporterT);
 
   // Scatter x and xdot to the overlapped distribution
   solMgrT->scatterXT(*xT, xdotT.get(), xdotdotT.get());
@@ -1637,20 +2194,7 @@ void Albany::Application::computeGlobalJacobianImplT(
   jacT->resumeFill();
   jacT->setAllToScalar(0.0);
 
-#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-  if (!overlapped_jacT->isFillActive())
-    overlapped_jacT->resumeFill();
-#endif
-  overlapped_jacT->setAllToScalar(0.0);
-#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-  if (overlapped_jacT->isFillActive()) {
-    // Makes getLocalMatrix() valid.
-    overlapped_jacT->fillComplete();
-  }
-  if (!overlapped_jacT->isFillActive())
-    overlapped_jacT->resumeFill();
-
-#endif
+  zeroOverlappedJacobianT(*overlapped_jacT);
 
   // Set data in Workset struct, and perform fill via field manager
   {
@@ -1679,31 +2223,51 @@ void Albany::Application::computeGlobalJacobianImplT(
                   this, ps, explicit_scheme));
     }
 
-    for (int ws = 0; ws < numWorksets; ws++) {
-      loadWorksetBucketInfo<PHAL::AlbanyTraits::Jacobian>(workset, ws);
-      // FillType template argument used to specialize Sacado
+    // Post the rows sent to other ranks once they are assembled. Only the
+    // static graph export of the Jacobian can be split.
+    const auto beginExport = [&]() {
+      if (Teuchos::nonnull(fT))
+        vec_exporterT_->beginExportAdd(*overlapped_fT);
+      if (static_graph_export_)
+        getJacobianExporterT(*overlapped_jacT, *jacT, exporterT)
+            .beginExportAdd(*overlapped_jacT);
+    };
+
+    if (useThreadedAssembly()) {
+      evaluateColoredWorksets<PHAL::AlbanyTraits::Jacobian>(workset);
+    } else {
+      for (int i = 0; i < numWorksets; i++) {
+        if (overlap_export && i == num_sent_worksets_)
+          beginExport();
+        const int ws = overlap_export ? ws_export_order_[i] : i;
+
+        loadWorksetBucketInfo<PHAL::AlbanyTraits::Jacobian>(workset, ws);
+        // FillType template argument used to specialize Sacado
 #ifdef DEBUG_OUTPUT2
-      std::cout << "calling FM evaluate fields in computeGlobalJacobianImplT" << std::endl;
+        std::cout << "calling FM evaluate fields in computeGlobalJacobianImplT" << std::endl;
 #endif
-      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Jacobian>(
-          workset);
-      if (Teuchos::nonnull(nfm))
+        fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Jacobian>(
+            workset);
+        if (Teuchos::nonnull(nfm))
 #ifdef ALBANY_PERIDIGM
-        // DJL avoid passing a sphere mesh through a nfm that was
-        // created for non-sphere topology.
-        if (workset.sideSets->size() != 0) {
+          // DJL avoid passing a sphere mesh through a nfm that was
+          // created for non-sphere topology.
+          if (workset.sideSets->size() != 0) {
+            deref_nfm(nfm, wsPhysIndex, ws)
+                ->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
+          }
+#else
           deref_nfm(nfm, wsPhysIndex, ws)
               ->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
-        }
-#else
-        deref_nfm(nfm, wsPhysIndex, ws)
-            ->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
 #endif
+      }
+      if (overlap_export && num_sent_worksets_ == numWorksets)
+        beginExport();
     }
   }
 
   {
-    TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian Export");
+    UTIL_FUNC_PHASE_MONITOR("> Albany Fill: Jacobian Export");
     // Allocate and populate scaleVec_
     if (scale != 1.0) {
       if (scaleVec_ == Teuchos::null ||
@@ -1714,11 +2278,18 @@ void Albany::Application::computeGlobalJacobianImplT(
     }
 
     // Assemble global residual
-    if (Teuchos::nonnull(fT))
-      fT->doExport(*overlapped_fT, *exporterT, Tpetra::ADD);
+    if (Teuchos::nonnull(fT)) {
+      if (overlap_export)
+        vec_exporterT_->endExportAdd(*overlapped_fT, *fT);
+      else
+        fT->doExport(*overlapped_fT, *exporterT, Tpetra::ADD);
+    }
 
     // Assemble global Jacobian
-    jacT->doExport(*overlapped_jacT, *exporterT, Tpetra::ADD);
+    if (overlap_export && static_graph_export_)
+      jac_exporterT_->endExportAdd(*overlapped_jacT, *jacT);
+    else
+      exportJacobianT(*overlapped_jacT, *jacT, exporterT);
 
 #ifdef ALBANY_PERIDIGM
 #if defined(ALBANY_EPETRA)
@@ -1822,15 +2393,9 @@ void Albany::Application::computeGlobalJacobianImplT(
     jacT->leftScale(*scaleVec_);
   }
 
-#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-  if (overlapped_jacT->isFillActive()) {
-    // Makes getLocalMatrix() valid.
-    overlapped_jacT->fillComplete();
-  }
-#endif
   if (derivatives_check_ > 0)
-    checkDerivatives(*this, current_time, xdotT, xdotdotT, xT, p, fT, jacT,
-                     derivatives_check_);
+    checkDerivatives(*this, current_time, xdotT, xdotdotT, xT, p, fT,
+                     derivatives_check_, derivative_check_directions_);
 }
 
 void Albany::Application::computeGlobalJacobianSDBCsImplT(
@@ -1840,7 +2405,7 @@ void Albany::Application::computeGlobalJacobianSDBCsImplT(
     const Teuchos::RCP<const Tpetra_Vector> &xT,
     const Teuchos::Array<ParamVec> &p, const Teuchos::RCP<Tpetra_Vector> &fT,
     const Teuchos::RCP<Tpetra_CrsMatrix> &jacT) {
-  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian");
+  UTIL_FUNC_PHASE_MONITOR("> Albany Fill: Jacobian");
 
   postRegSetup("Jacobian");
 
@@ -1917,20 +2482,7 @@ void Albany::Application::computeGlobalJacobianSDBCsImplT(
   jacT->resumeFill();
   jacT->setAllToScalar(0.0);
 
-#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-  if (!overlapped_jacT->isFillActive())
-    overlapped_jacT->resumeFill();
-#endif
-  overlapped_jacT->setAllToScalar(0.0);
-#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-  if (overlapped_jacT->isFillActive()) {
-    // Makes getLocalMatrix() valid.
-    overlapped_jacT->fillComplete();
-  }
-  if (!overlapped_jacT->isFillActive())
-    overlapped_jacT->resumeFill();
-
-#endif
+  zeroOverlappedJacobianT(*overlapped_jacT);
 
   // Set data in Workset struct, and perform fill via field manager
   {
@@ -1993,14 +2545,14 @@ void Albany::Application::computeGlobalJacobianSDBCsImplT(
   }
 
   {
-    TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Jacobian Export");
+    UTIL_FUNC_PHASE_MONITOR("> Albany Fill: Jacobian Export");
 
     // Assemble global residual
     if (Teuchos::nonnull(fT))
       fT->doExport(*overlapped_fT, *exporterT, Tpetra::ADD);
 
     // Assemble global Jacobian
-    jacT->doExport(*overlapped_jacT, *exporterT, Tpetra::ADD);
+    exportJacobianT(*overlapped_jacT, *jacT, exporterT);
 
 #ifdef ALBANY_PERIDIGM
 #if defined(ALBANY_EPETRA)
@@ -2048,7 +2600,12 @@ void Albany::Application::computeGlobalJacobianSDBCsImplT(
 #ifdef DEBUG_OUTPUT2
     std::cout << "calling DFM evaluate fields in computeGlobalJacobianSDBCsImplT" << std::endl;
 #endif
+    if (sdbc_sweep_ == Teuchos::null) {
+      sdbc_sweep_ = Teuchos::rcp(new PHAL::SDirichletSweep);
+    }
+    if (sdbc_sweep_->begin(*jacT) == true) workset.sdbcSweep = sdbc_sweep_;
     dfm->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
+    sdbc_sweep_->apply(*jacT);
     xT_post_SDBCs = Teuchos::rcp(new Tpetra_Vector(*workset.xT));
   }
   jacT->fillComplete();
@@ -2069,20 +2626,7 @@ void Albany::Application::computeGlobalJacobianSDBCsImplT(
     jacT->resumeFill();
     jacT->setAllToScalar(0.0);
 
-#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-    if (!overlapped_jacT->isFillActive())
-      overlapped_jacT->resumeFill();
-#endif
-    overlapped_jacT->setAllToScalar(0.0);
-#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-    if (overlapped_jacT->isFillActive()) {
-      // Makes getLocalMatrix() valid.
-      overlapped_jacT->fillComplete();
-    }
-    if (!overlapped_jacT->isFillActive())
-      overlapped_jacT->resumeFill();
-
-#endif
+    zeroOverlappedJacobianT(*overlapped_jacT);
 
     double const
     this_time = fixTime(current_time);
@@ -2136,7 +2680,7 @@ void Albany::Application::computeGlobalJacobianSDBCsImplT(
       fT->doExport(*overlapped_fT, *exporterT, Tpetra::ADD);
 
     // Assemble global Jacobian
-    jacT->doExport(*overlapped_jacT, *exporterT, Tpetra::ADD);
+    exportJacobianT(*overlapped_jacT, *jacT, exporterT);
 
 #ifdef ALBANY_PERIDIGM
 #if defined(ALBANY_EPETRA)
@@ -2183,22 +2727,23 @@ void Albany::Application::computeGlobalJacobianSDBCsImplT(
 #ifdef DEBUG_OUTPUT2
         std::cout << "calling DFM evaluate fields AGAIN in computeGlobalJacobianSDBCsImplT" << std::endl;
 #endif
+        if (overlapped_sdbc_sweep_ == Teuchos::null) {
+          overlapped_sdbc_sweep_ = Teuchos::rcp(new PHAL::SDirichletSweep);
+        }
+        if (overlapped_sdbc_sweep_->begin(*overlapped_jacT) == true) {
+          workset.sdbcSweep = overlapped_sdbc_sweep_;
+        }
         dfm->evaluateFields<PHAL::AlbanyTraits::Jacobian>(workset);
+        overlapped_sdbc_sweep_->apply(*overlapped_jacT);
       }
     }
     jacT->fillComplete();
   } // endif (begin_time_step == true)
   previous_app = current_app;
 
-#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
-  if (overlapped_jacT->isFillActive()) {
-    // Makes getLocalMatrix() valid.
-    overlapped_jacT->fillComplete();
-  }
-#endif
   if (derivatives_check_ > 0)
-    checkDerivatives(*this, current_time, xdotT, xdotdotT, xT, p, fT, jacT,
-                     derivatives_check_);
+    checkDerivatives(*this, current_time, xdotT, xdotdotT, xT, p, fT,
+                     derivatives_check_, derivative_check_directions_);
 }
 
 #if defined(ALBANY_EPETRA)
@@ -2214,25 +2759,27 @@ void Albany::Application::computeGlobalJacobian(
   // Create Tpetra copies of Epetra arguments
   // Names of Tpetra entitied are identified by the suffix T
   const Teuchos::RCP<const Tpetra_Vector> xT =
-      Petra::EpetraVector_To_TpetraVectorConst(x, commT);
+      Petra::EpetraVector_To_TpetraVectorConst(x, disc->getMapT());
 
   Teuchos::RCP<const Tpetra_Vector> xdotT;
   if (xdot != NULL && num_time_deriv > 0) {
-    xdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdot, commT);
+    xdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdot, disc->getMapT());
   }
 
   Teuchos::RCP<const Tpetra_Vector> xdotdotT;
   if (xdotdot != NULL && num_time_deriv > 1) {
-    xdotdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdotdot, commT);
+    xdotdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdotdot, disc->getMapT());
   }
 
   Teuchos::RCP<Tpetra_Vector> fT;
   if (f != NULL) {
-    fT = Petra::EpetraVector_To_TpetraVectorNonConst(*f, commT);
+    fT = Petra::EpetraVector_To_TpetraVectorNonConst(*f, disc->getMapT());
   }
 
+  // The Tpetra Jacobian is built once per Epetra graph; assembly zeroes it
+  if (jacBridge.is_null()) jacBridge = Teuchos::rcp(new Petra::CrsMatrixBridge);
   const Teuchos::RCP<Tpetra_CrsMatrix> jacT =
-      Petra::EpetraCrsMatrix_To_TpetraCrsMatrix(jac, commT);
+      jacBridge->getTpetraMatrix(jac, commT);
 
   if (problem->useSDBCs() == false) {
     this->computeGlobalJacobianImplT(alpha, beta, omega, current_time, xdotT,
@@ -2247,8 +2794,7 @@ void Albany::Application::computeGlobalJacobian(
     Petra::TpetraVector_To_EpetraVector(fT, *f, comm);
   }
   Petra::TpetraVector_To_EpetraVector(xT, const_cast<Epetra_Vector &>(x), comm);
-  Petra::TpetraCrsMatrix_To_EpetraCrsMatrix(jacT, jac, comm);
-  jac.FillComplete(true);
+  jacBridge->copyToEpetra(jac, comm);
   /*std::cout << "Global Soln x\n" << x << std::endl;
   std::cout << "f "<< std::endl;
   if (f != NULL)
@@ -2319,6 +2865,9 @@ void Albany::Application::computeGlobalJacobianT(
       alpha, beta, omega, current_time, Teuchos::rcp(xdotT, false),
       Teuchos::rcp(xdotdotT, false), Teuchos::rcpFromRef(xT), p,
       Teuchos::rcp(fT, false), Teuchos::rcpFromRef(jacT));
+#if defined(ALBANY_LCM)
+  if (Teuchos::nonnull(nox_status_test_)) nox_status_test_->postSyncFlag();
+#endif // ALBANY_LCM
   // Debut output
   if (writeToMatrixMarketJac !=
       0) {          // If requesting writing to MatrixMarket of Jacobian...
@@ -2557,6 +3106,15 @@ void Albany::Application::computeGlobalTangentImplT(
       "Seed matrices Vx and Vp must have the same number "
           << " of columns when sum_derivs is true and both are "
           << "non-null!" << std::endl);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      param_offset + num_cols_p > static_cast<int>(tangent_deriv_dim) ||
+          num_cols_x > static_cast<int>(tangent_deriv_dim),
+      std::logic_error,
+      "The tangent evaluation needs "
+          << std::max(param_offset + num_cols_p, num_cols_x)
+          << " derivatives, but the Tangent fields were set up for "
+          << tangent_deriv_dim << ". Set \"Number of Tangent Directions\" "
+          << "in the Problem list to at least this number." << std::endl);
 
   // Initialize
   if (Teuchos::nonnull(params)) {
@@ -2604,17 +3162,21 @@ void Albany::Application::computeGlobalTangentImplT(
     workset.num_cols_p = num_cols_p;
     workset.param_offset = param_offset;
 
-    for (int ws = 0; ws < numWorksets; ws++) {
-      loadWorksetBucketInfo<PHAL::AlbanyTraits::Tangent>(workset, ws);
+    if (useThreadedAssembly()) {
+      evaluateColoredWorksets<PHAL::AlbanyTraits::Tangent>(workset);
+    } else {
+      for (int ws = 0; ws < numWorksets; ws++) {
+        loadWorksetBucketInfo<PHAL::AlbanyTraits::Tangent>(workset, ws);
 
-      // FillType template argument used to specialize Sacado
+        // FillType template argument used to specialize Sacado
 #ifdef DEBUG_OUTPUT2
-      std::cout << "calling FM evaluate fields in computeGlobalTangentImplT" << std::endl;
+        std::cout << "calling FM evaluate fields in computeGlobalTangentImplT" << std::endl;
 #endif
-      fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Tangent>(workset);
-      if (nfm != Teuchos::null)
-        deref_nfm(nfm, wsPhysIndex, ws)
-            ->evaluateFields<PHAL::AlbanyTraits::Tangent>(workset);
+        fm[wsPhysIndex[ws]]->evaluateFields<PHAL::AlbanyTraits::Tangent>(workset);
+        if (nfm != Teuchos::null)
+          deref_nfm(nfm, wsPhysIndex, ws)
+              ->evaluateFields<PHAL::AlbanyTraits::Tangent>(workset);
+      }
     }
 
     // fill Tangent derivative dimensions
@@ -2695,15 +3257,15 @@ void Albany::Application::computeGlobalTangent(
   // Create Tpetra copies of Epetra arguments
   // Names of Tpetra entitied are identified by the suffix T
   Teuchos::RCP<const Tpetra_Vector> xT =
-      Petra::EpetraVector_To_TpetraVectorConst(x, commT);
+      Petra::EpetraVector_To_TpetraVectorConst(x, disc->getMapT());
 
   Teuchos::RCP<const Tpetra_Vector> xdotT;
   if (xdot != NULL && num_time_deriv > 0) {
-    xdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdot, commT);
+    xdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdot, disc->getMapT());
   }
   Teuchos::RCP<const Tpetra_Vector> xdotdotT;
   if (xdotdot != NULL && num_time_deriv > 1) {
-    xdotdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdotdot, commT);
+    xdotdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdotdot, disc->getMapT());
   }
 
   Teuchos::RCP<const Tpetra_MultiVector> VxT;
@@ -2725,7 +3287,7 @@ void Albany::Application::computeGlobalTangent(
 
   Teuchos::RCP<Tpetra_Vector> fT;
   if (f != NULL)
-    fT = Petra::EpetraVector_To_TpetraVectorNonConst(*f, commT);
+    fT = Petra::EpetraVector_To_TpetraVectorNonConst(*f, disc->getMapT());
 
   Teuchos::RCP<Tpetra_MultiVector> JVT;
   if (JV != NULL)
@@ -3011,6 +3573,72 @@ void Albany::Application::evaluateResponseDerivativeT(
       dg_dxdotdotT, dg_dpT);
 }
 
+void Albany::Application::evaluateResponsesDerivativeT(
+    const Teuchos::Array<int> &response_indices, const double current_time,
+    const Tpetra_Vector *xdotT, const Tpetra_Vector *xdotdotT,
+    const Tpetra_Vector &xT, const Teuchos::Array<ParamVec> &p,
+    const Teuchos::Array<Tpetra_Vector *> &gT,
+    const Teuchos::Array<Thyra::ModelEvaluatorBase::Derivative<ST>> &dg_dxT,
+    const Teuchos::Array<Thyra::ModelEvaluatorBase::Derivative<ST>> &dg_dxdotT,
+    const Teuchos::Array<Thyra::ModelEvaluatorBase::Derivative<ST>>
+        &dg_dxdotdotT) {
+  double const
+  this_time = fixTime(current_time);
+
+  const auto toTpetra = [](const Thyra::ModelEvaluatorBase::Derivative<ST> &d) {
+    return Teuchos::nonnull(d.getMultiVector())
+               ? ConverterT::getTpetraMultiVector(d.getMultiVector())
+               : Teuchos::null;
+  };
+
+  // The field manager responses that request the same derivatives share one
+  // sweep per derivative; the others are evaluated one by one
+  std::vector<FieldManagerScalarResponseFunction *> swept;
+  std::vector<Tpetra_Vector *> swept_gT;
+  std::vector<Tpetra_MultiVector *> swept_dgdxT, swept_dgdxdotT,
+      swept_dgdxdotdotT;
+  Teuchos::Array<Teuchos::RCP<Tpetra_MultiVector>> swept_views;
+  const Thyra::ModelEvaluatorBase::Derivative<ST> dummy_derivT;
+  for (int k = 0; k < response_indices.size(); ++k) {
+    const int j = response_indices[k];
+    FieldManagerScalarResponseFunction *response =
+        fused_response_gradients_
+            ? dynamic_cast<FieldManagerScalarResponseFunction *>(
+                  responses[j].get())
+            : NULL;
+    const Teuchos::RCP<Tpetra_MultiVector> dgdx = toTpetra(dg_dxT[k]),
+                                           dgdxdot = toTpetra(dg_dxdotT[k]),
+                                           dgdxdotdot =
+                                               toTpetra(dg_dxdotdotT[k]);
+    const bool shares =
+        response != NULL && response->sharesGradientSweep() &&
+        (dg_dxT[k].isEmpty() || Teuchos::nonnull(dgdx)) &&
+        (dg_dxdotT[k].isEmpty() || Teuchos::nonnull(dgdxdot)) &&
+        (dg_dxdotdotT[k].isEmpty() || Teuchos::nonnull(dgdxdotdot)) &&
+        (swept.empty() ||
+         ((swept_dgdxT[0] != NULL) == Teuchos::nonnull(dgdx) &&
+          (swept_dgdxdotT[0] != NULL) == Teuchos::nonnull(dgdxdot) &&
+          (swept_dgdxdotdotT[0] != NULL) == Teuchos::nonnull(dgdxdotdot)));
+    if (shares) {
+      swept.push_back(response);
+      swept_gT.push_back(gT[k]);
+      swept_dgdxT.push_back(dgdx.get());
+      swept_dgdxdotT.push_back(dgdxdot.get());
+      swept_dgdxdotdotT.push_back(dgdxdotdot.get());
+      swept_views.push_back(dgdx);
+      swept_views.push_back(dgdxdot);
+      swept_views.push_back(dgdxdotdot);
+    } else {
+      responses[j]->evaluateDerivativeT(this_time, xdotT, xdotdotT, xT, p,
+                                        NULL, gT[k], dg_dxT[k], dg_dxdotT[k],
+                                        dg_dxdotdotT[k], dummy_derivT);
+    }
+  }
+  FieldManagerScalarResponseFunction::evaluateGradientsT(
+      swept, this_time, xdotT, xdotdotT, xT, p, swept_gT, swept_dgdxT,
+      swept_dgdxdotT, swept_dgdxdotdotT);
+}
+
 void Albany::Application::evaluateResponseDistParamDerivT(
     int response_index, const double current_time, const Tpetra_Vector *xdot,
     const Tpetra_Vector *xdotdot, const Tpetra_Vector &x,
@@ -3044,16 +3672,16 @@ void Albany::Application::evaluateStateFieldManager(
 
   // Create Tpetra copy of x, called xT
   Teuchos::RCP<const Tpetra_Vector> xT =
-      Petra::EpetraVector_To_TpetraVectorConst(x, commT);
+      Petra::EpetraVector_To_TpetraVectorConst(x, disc->getMapT());
   // Create Tpetra copy of xdot, called xdotT
   Teuchos::RCP<const Tpetra_Vector> xdotT;
   if (xdot != NULL && num_time_deriv > 0) {
-    xdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdot, commT);
+    xdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdot, disc->getMapT());
   }
   // Create Tpetra copy of xdotdot, called xdotdotT
   Teuchos::RCP<const Tpetra_Vector> xdotdotT;
   if (xdotdot != NULL && num_time_deriv > 1) {
-    xdotdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdotdot, commT);
+    xdotdotT = Petra::EpetraVector_To_TpetraVectorConst(*xdotdot, disc->getMapT());
   }
 
   this->evaluateStateFieldManagerT(current_time, xdotT.ptr(), xdotdotT.ptr(),
@@ -3079,6 +3707,9 @@ void Albany::Application::evaluateStateFieldManagerT(
 void Albany::Application::evaluateStateFieldManagerT(
     const double current_time, Teuchos::Ptr<const Tpetra_Vector> xdotT,
     Teuchos::Ptr<const Tpetra_Vector> xdotdotT, const Tpetra_Vector &xT) {
+  if (statesSavedInResidualFill(current_time, xdotT, xdotdotT, xT))
+    return;
+
   {
     const std::string eval = "SFM_Jacobian";
     if (setupSet.find(eval) == setupSet.end()) {
@@ -3146,6 +3777,108 @@ void Albany::Application::evaluateStateFieldManagerT(
     rc_mgr->endEvaluatingSfm();
 }
 
+void Albany::Application::requireStatesInResidualFill() {
+  Teuchos::RCP<PHX::DataLayout> dummy =
+      Teuchos::rcp(new PHX::MDALayout<Dummy>(0));
+  for (int ps = 0; ps < meshSpecs.size(); ps++) {
+    std::string elementBlockName = meshSpecs[ps]->ebName;
+    const std::vector<std::string> responseIDs_to_require =
+        stateMgr.getResidResponseIDsToRequire(elementBlockName);
+    for (const std::string &responseID : responseIDs_to_require) {
+      PHX::Tag<PHAL::AlbanyTraits::Residual::ScalarT> res_response_tag(
+          responseID, dummy);
+      fm[ps]->requireField<PHAL::AlbanyTraits::Residual>(res_response_tag);
+      for (int t = 0; t < thread_fm_.size(); t++)
+        thread_fm_[t][ps]->requireField<PHAL::AlbanyTraits::Residual>(
+            res_response_tag);
+    }
+  }
+}
+
+bool Albany::Application::statesSavedInResidualFill(
+    const double current_time, Teuchos::Ptr<const Tpetra_Vector> xdotT,
+    Teuchos::Ptr<const Tpetra_Vector> xdotdotT, const Tpetra_Vector &xT) {
+  if (!states_in_residual_)
+    return false;
+
+  // The Response Function manager does its own work in the state pass, and
+  // the states of the last fill are only current once.
+  const bool same = states_saved_ && Teuchos::is_null(rc_mgr) &&
+                    states_time_ == current_time &&
+                    sameStateVector(states_xT_, &xT) &&
+                    sameStateVector(states_xdotT_, xdotT.get()) &&
+                    sameStateVector(states_xdotdotT_, xdotdotT.get());
+  states_saved_ = false;
+
+  int localDiffer = same ? 0 : 1, differ = 0;
+  Teuchos::reduceAll<int, int>(*commT, Teuchos::REDUCE_MAX, localDiffer,
+                               Teuchos::ptr(&differ));
+  return differ == 0;
+}
+
+void Albany::Application::collectEvaluatorStatistics() {
+  util::EvaluatorMonitor &monitor =
+      util::PerformanceContext::instance().evaluatorMonitor();
+
+  // Costs per cell declared by the user as {bytes, flops}
+  const Teuchos::ParameterList &costs =
+      params_->sublist("Debug Output").sublist("Evaluator Costs");
+  for (Teuchos::ParameterList::ConstIterator it = costs.begin();
+       it != costs.end(); ++it) {
+    const std::string &name = costs.name(it);
+    const Teuchos::Array<double> cost =
+        costs.get<Teuchos::Array<double>>(name);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        cost.size() != 2, Teuchos::Exceptions::InvalidParameter,
+        "Error in Albany::Application: Evaluator Costs entry "
+            << name << " must be {bytes per cell, flops per cell}.\n");
+    monitor.declareCost(name, cost[0], cost[1]);
+  }
+
+  // Cells per evaluateFields call, averaged over the worksets of all ranks
+  const auto &wsElNodeEqID = disc->getWsElNodeEqID();
+  double local[2] = {0.0, static_cast<double>(wsElNodeEqID.size())};
+  for (int ws = 0; ws < wsElNodeEqID.size(); ++ws)
+    local[0] += wsElNodeEqID[ws].dimension(0);
+  double global[2] = {0.0, 0.0};
+  Teuchos::reduceAll<int, double>(*commT, Teuchos::REDUCE_SUM, 2, local,
+                                  global);
+  const double cellsPerCall = global[1] > 0 ? global[0] / global[1] : 0.0;
+
+  // Phalanx times each evaluator of a DAG, per evaluation type, when it is
+  // built with Phalanx_ENABLE_TEUCHOS_TIME_MONITOR. The timers are named
+  // "Phalanx: Evaluator <index>: [<evaluation type>] <evaluator name>".
+  Teuchos::TimeMonitor::stat_map_type stats;
+  std::vector<std::string> statNames;
+  Teuchos::TimeMonitor::computeGlobalTimerStatistics(
+      stats, statNames, commT.ptr(), Teuchos::Union, "Phalanx: Evaluator");
+  const std::size_t maxStat =
+      std::find(statNames.begin(), statNames.end(), "MaxOverProcs") -
+      statNames.begin();
+  const std::size_t meanStat =
+      std::find(statNames.begin(), statNames.end(), "MeanOverProcs") -
+      statNames.begin();
+  if (stats.empty() || maxStat == statNames.size() ||
+      meanStat == statNames.size()) {
+    *out << "Albany::Application: no Phalanx evaluator timers found; "
+         << "Phalanx has to be built with "
+         << "Phalanx_ENABLE_TEUCHOS_TIME_MONITOR" << std::endl;
+    return;
+  }
+
+  for (Teuchos::TimeMonitor::stat_map_type::const_iterator it = stats.begin();
+       it != stats.end(); ++it) {
+    const std::string &timer = it->first;
+    const std::size_t type = timer.find('[');
+    const std::string name =
+        type != std::string::npos ? timer.substr(type) : timer;
+    // Same-named evaluators of several field managers add up
+    const double time = it->second[maxStat].first;
+    const double calls = it->second[meanStat].second;
+    monitor.record(name, time, calls, calls * cellsPerCall);
+  }
+}
+
 void Albany::Application::registerShapeParameters() {
   int numShParams = shapeParams.size();
   if (shapeParamNames.size() == 0) {
@@ -3196,9 +3929,16 @@ void Albany::Application::postRegSetup(std::string eval) {
 
   setupSet.insert(eval);
 
+  util::PhaseGuard phase(util::PerformanceContext::instance().phaseMonitor(),
+                         "Application::postRegSetup " + eval);
+
   if (eval == "Residual") {
     for (int ps = 0; ps < fm.size(); ps++)
       fm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
+    for (int t = 0; t < thread_fm_.size(); t++)
+      for (int ps = 0; ps < thread_fm_[t].size(); ps++)
+        thread_fm_[t][ps]
+            ->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
     if (dfm != Teuchos::null)
       dfm->postRegistrationSetupForType<PHAL::AlbanyTraits::Residual>(eval);
     if (nfm != Teuchos::null)
@@ -3211,9 +3951,18 @@ void Albany::Application::postRegSetup(std::string eval) {
       derivative_dimensions.push_back(
           PHAL::getDerivativeDimensions<PHAL::AlbanyTraits::Jacobian>(
               this, ps, explicit_scheme));
+      checkDerivativeCapacity("Jacobian", FadTypeCapacity,
+                              derivative_dimensions[0], "SLFAD_SIZE");
       fm[ps]->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(
           derivative_dimensions);
       fm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Jacobian>(eval);
+      for (int t = 0; t < thread_fm_.size(); t++) {
+        thread_fm_[t][ps]
+            ->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(
+                derivative_dimensions);
+        thread_fm_[t][ps]
+            ->postRegistrationSetupForType<PHAL::AlbanyTraits::Jacobian>(eval);
+      }
       if (nfm != Teuchos::null && ps < nfm.size()) {
         nfm[ps]
             ->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Jacobian>(
@@ -3238,9 +3987,18 @@ void Albany::Application::postRegSetup(std::string eval) {
       std::vector<PHX::index_size_type> derivative_dimensions;
       derivative_dimensions.push_back(
           PHAL::getDerivativeDimensions<PHAL::AlbanyTraits::Tangent>(this, ps));
+      checkDerivativeCapacity("Tangent", TanFadTypeCapacity,
+                              derivative_dimensions[0], "TAN_SLFAD_SIZE");
       fm[ps]->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Tangent>(
           derivative_dimensions);
       fm[ps]->postRegistrationSetupForType<PHAL::AlbanyTraits::Tangent>(eval);
+      for (int t = 0; t < thread_fm_.size(); t++) {
+        thread_fm_[t][ps]
+            ->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Tangent>(
+                derivative_dimensions);
+        thread_fm_[t][ps]
+            ->postRegistrationSetupForType<PHAL::AlbanyTraits::Tangent>(eval);
+      }
       if (nfm != Teuchos::null && ps < nfm.size()) {
         nfm[ps]
             ->setKokkosExtendedDataTypeDimensions<PHAL::AlbanyTraits::Tangent>(
@@ -3265,6 +4023,9 @@ void Albany::Application::postRegSetup(std::string eval) {
       derivative_dimensions.push_back(
           PHAL::getDerivativeDimensions<PHAL::AlbanyTraits::DistParamDeriv>(
               this, ps));
+      checkDerivativeCapacity("Distributed Parameter Derivative",
+                              TanFadTypeCapacity, derivative_dimensions[0],
+                              "TAN_SLFAD_SIZE");
       fm[ps]
           ->setKokkosExtendedDataTypeDimensions<
               PHAL::AlbanyTraits::DistParamDeriv>(derivative_dimensions);
@@ -3373,6 +4134,59 @@ Albany::Application::buildWrappedOperator(const RCP<Epetra_Operator> &Jac,
 }
 #endif
 
+#if defined(ALBANY_EPETRA) && defined(ALBANY_TEKO)
+void Albany::Application::setTekoPreset() {
+  const std::string preset = precParams->get<std::string>("Preset");
+  const std::string blockInverse =
+      precParams->get<std::string>("Block Inverse Type", "ML");
+  const int numBlocks = blockDecomp.size();
+
+  // an explicit library takes precedence over the preset
+  Teuchos::ParameterList &library =
+      precParams->sublist("Inverse Factory Library");
+  if (!library.isSublist(preset)) {
+    Teuchos::ParameterList &inverse = library.sublist(preset);
+    if (preset == "Block Gauss-Seidel" ||
+        preset == "Block Triangular for Thermo-Mechanics") {
+      // one solve per physics, lower triangular coupling by default
+      inverse.set("Type", "Block Gauss-Seidel");
+      inverse.set("Use Upper Triangle",
+                  precParams->get("Use Upper Triangle", false));
+      for (int i = 0; i < numBlocks; ++i)
+        inverse.set(Albany::strint("Inverse Type", i + 1),
+                    precParams->get(Albany::strint("Inverse Type", i + 1),
+                                    blockInverse));
+    } else if (preset == "Block Jacobi") {
+      inverse.set("Type", "Block Jacobi");
+      inverse.set("Inverse Type", blockInverse);
+    } else if (preset == "Schur Complement for Saddle Point") {
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          numBlocks != 2, Teuchos::Exceptions::InvalidParameter,
+          std::endl
+              << "Error in Albany::Application: the Schur complement preset "
+              << "needs a velocity and a pressure block, found " << numBlocks
+              << " blocks. Set Unknown Blocking." << std::endl);
+      // SIMPLEC approximation of the pressure Schur complement
+      inverse.set("Type", "NS SIMPLE");
+      inverse.set("Inverse Velocity Type",
+                  precParams->get("Inverse Velocity Type", blockInverse));
+      inverse.set("Inverse Pressure Type",
+                  precParams->get("Inverse Pressure Type", blockInverse));
+      inverse.set("Explicit Velocity Inverse Type", "AbsRowSum");
+    } else {
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          true, Teuchos::Exceptions::InvalidParameter,
+          std::endl
+              << "Error in Albany::Application: unknown Teko preset " << preset
+              << ". Valid presets are Block Gauss-Seidel, Block Jacobi, "
+              << "Block Triangular for Thermo-Mechanics and Schur Complement "
+              << "for Saddle Point." << std::endl);
+    }
+  }
+  precParams->get("Preconditioner Name", preset);
+}
+#endif
+
 void Albany::Application::determinePiroSolver(
     const Teuchos::RCP<Teuchos::ParameterList> &topLevelParams) {
 
@@ -3458,6 +4272,8 @@ void Albany::Application::loadBasicWorksetInfoT(PHAL::Workset &workset,
   // workset.delta_time = delta_time;
   workset.transientTerms = Teuchos::nonnull(workset.xdotT);
   workset.accelerationTerms = Teuchos::nonnull(workset.xdotdotT);
+  workset.cache_basis_functions = cache_basis_functions_;
+  loadWorksetMemoizerInfo(workset);
 }
 
 void Albany::Application::loadBasicWorksetInfoSDBCsT(
@@ -3488,6 +4304,29 @@ void Albany::Application::loadBasicWorksetInfoSDBCsT(
   // workset.delta_time = delta_time;
   workset.transientTerms = Teuchos::nonnull(workset.xdotT);
   workset.accelerationTerms = Teuchos::nonnull(workset.xdotdotT);
+  workset.cache_basis_functions = cache_basis_functions_;
+  loadWorksetMemoizerInfo(workset);
+}
+
+void Albany::Application::loadWorksetMemoizerInfo(PHAL::Workset &workset) {
+  workset.memoize_fields = memoize_fields_;
+  if (!memoize_fields_) return;
+
+  // Compare the overlapped values, which include the ghosts other ranks
+  // own, with those of the last fill
+  bool changed = false;
+  for (auto it = distParamLib->begin(); it != distParamLib->end(); ++it) {
+    const Teuchos::ArrayRCP<const ST> values =
+        it->second->overlapped_vector()->get1dView();
+    Teuchos::Array<ST> &saved = dist_param_values_[it->first];
+    if (saved.size() != values.size() ||
+        !std::equal(values.begin(), values.end(), saved.begin())) {
+      saved.assign(values.begin(), values.end());
+      changed = true;
+    }
+  }
+  if (changed) ++dist_param_state_;
+  workset.dist_param_state = dist_param_state_;
 }
 
 void Albany::Application::loadWorksetJacobianInfo(PHAL::Workset &workset,
@@ -3696,6 +4535,8 @@ void Albany::Application::setupBasicWorksetInfoT(
 
   workset.transientTerms = Teuchos::nonnull(workset.xdotT);
   workset.accelerationTerms = Teuchos::nonnull(workset.xdotdotT);
+  workset.cache_basis_functions = cache_basis_functions_;
+  loadWorksetMemoizerInfo(workset);
 
   workset.comm = commT;
 
@@ -3769,6 +4610,15 @@ void Albany::Application::setupTangentWorksetInfo(
       "Seed matrices Vx and Vp must have the same number "
           << " of columns when sum_derivs is true and both are "
           << "non-null!" << std::endl);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      param_offset + num_cols_p > static_cast<int>(tangent_deriv_dim) ||
+          num_cols_x > static_cast<int>(tangent_deriv_dim),
+      std::logic_error,
+      "The tangent evaluation needs "
+          << std::max(param_offset + num_cols_p, num_cols_x)
+          << " derivatives, but the Tangent fields were set up for "
+          << tangent_deriv_dim << ". Set \"Number of Tangent Directions\" "
+          << "in the Problem list to at least this number." << std::endl);
 
   // Initialize
   if (params != Teuchos::null) {
@@ -3864,6 +4714,15 @@ void Albany::Application::setupTangentWorksetInfoT(
       "Seed matrices Vx and Vp must have the same number "
           << " of columns when sum_derivs is true and both are "
           << "non-null!" << std::endl);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      param_offset + num_cols_p > static_cast<int>(tangent_deriv_dim) ||
+          num_cols_x > static_cast<int>(tangent_deriv_dim),
+      std::logic_error,
+      "The tangent evaluation needs "
+          << std::max(param_offset + num_cols_p, num_cols_x)
+          << " derivatives, but the Tangent fields were set up for "
+          << tangent_deriv_dim << ". Set \"Number of Tangent Directions\" "
+          << "in the Problem list to at least this number." << std::endl);
 
   // Initialize
   if (params != Teuchos::null) {
@@ -3982,7 +4841,7 @@ void Albany::Application::computeGlobalResidualSDBCsImplT(
     Teuchos::RCP<Tpetra_Vector const> const &xdotdotT,
     Teuchos::RCP<Tpetra_Vector const> const &xT,
     Teuchos::Array<ParamVec> const &p, Teuchos::RCP<Tpetra_Vector> const &fT) {
-  TEUCHOS_FUNC_TIME_MONITOR("> Albany Fill: Residual");
+  UTIL_FUNC_PHASE_MONITOR("> Albany Fill: Residual");
   postRegSetup("Residual");
 
   if (scale != 1.0) {
@@ -4059,6 +4918,15 @@ void Albany::Application::computeGlobalResidualSDBCsImplT(
     xdotdot_ = Teuchos::null;
 #endif // ALBANY_LCM
 
+  // This fill saves the states; remember where
+  if (states_in_residual_) {
+    states_saved_ = true;
+    states_time_ = fixTime(current_time);
+    copyStateVector(states_xT_, xT.get());
+    copyStateVector(states_xdotT_, xdotT.get());
+    copyStateVector(states_xdotdotT_, xdotdotT.get());
+  }
+
   // Zero out overlapped residual - Tpetra
   overlapped_fT->putScalar(0.0);
   fT->putScalar(0.0);
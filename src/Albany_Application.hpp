@@ -20,12 +20,15 @@
 #include "Epetra_Import.h"
 #include "Epetra_Map.h"
 #include "Epetra_Vector.h"
+#include "Petra_Converters.hpp"
 #endif
 
 #include "Albany_AbstractDiscretization.hpp"
 #include "Albany_AbstractProblem.hpp"
 #include "Albany_AbstractResponseFunction.hpp"
+#include "Albany_AsyncVectorExporter.hpp"
 #include "Albany_StateManager.hpp"
+#include "Albany_StaticGraphExporter.hpp"
 
 #if defined(ALBANY_EPETRA)
 #include "AAdapt_AdaptiveSolutionManager.hpp"
@@ -41,7 +44,9 @@
 
 #include "PHAL_AlbanyTraits.hpp"
 #include "PHAL_Workset.hpp"
+#include <map>
 #include <set>
+#include <vector>
 
 #if defined(ALBANY_EPETRA)
 
@@ -67,6 +72,14 @@ class Manager;
 }
 } // namespace AAdapt
 
+#if defined(ALBANY_LCM)
+namespace NOX {
+namespace StatusTest {
+class ModelEvaluatorFlag;
+}
+} // namespace NOX
+#endif // ALBANY_LCM
+
 namespace Albany {
 
 class Application
@@ -207,6 +220,19 @@ public:
                          const Tpetra_Vector *xdotdotT, const Tpetra_Vector &xT,
                          const Teuchos::Array<ParamVec> &p, Tpetra_Vector &fT);
 
+  //! Compute the global residuals of a batch of parameter samples
+  /*!
+   * Column s of fT is the residual with the parameters p[s], at column s of
+   * xT or at its only column. All the samples are evaluated on each workset
+   * in a single sweep, so the workset data is loaded once for the batch.
+   */
+  void
+  computeGlobalResidualsT(const double current_time, const Tpetra_Vector *xdotT,
+                          const Tpetra_Vector *xdotdotT,
+                          const Tpetra_MultiVector &xT,
+                          const Teuchos::Array<Teuchos::Array<ParamVec>> &p,
+                          Tpetra_MultiVector &fT);
+
 private:
   void computeGlobalResidualImplT(
       const double current_time, const Teuchos::RCP<const Tpetra_Vector> &xdotT,
@@ -214,6 +240,14 @@ private:
       const Teuchos::RCP<const Tpetra_Vector> &xT,
       const Teuchos::Array<ParamVec> &p, const Teuchos::RCP<Tpetra_Vector> &fT);
 
+  //! Scale the assembled residual fT and apply the Dirichlet conditions
+  void finishGlobalResidualT(
+      const double current_time, const Teuchos::RCP<const Tpetra_Vector> &xdotT,
+      const Teuchos::RCP<const Tpetra_Vector> &xdotdotT,
+      const Teuchos::RCP<const Tpetra_Vector> &xT,
+      const Teuchos::RCP<Tpetra_Vector> &overlapped_fT,
+      const Teuchos::RCP<Tpetra_Vector> &fT);
+
   void computeGlobalResidualSDBCsImplT(
       const double current_time, const Teuchos::RCP<const Tpetra_Vector> &xdotT,
       const Teuchos::RCP<const Tpetra_Vector> &xdotdotT,
@@ -371,6 +405,19 @@ public:
       const Thyra::ModelEvaluatorBase::Derivative<ST> &dg_dxdotdotT,
       const Thyra::ModelEvaluatorBase::Derivative<ST> &dg_dpT);
 
+  //! dg/dx, dg/dxdot and dg/dxdotdot of several responses. With "Fused
+  //! Gradient Evaluation", the field manager responses share their sweeps.
+  void evaluateResponsesDerivativeT(
+      const Teuchos::Array<int> &response_indices, const double current_time,
+      const Tpetra_Vector *xdotT, const Tpetra_Vector *xdotdotT,
+      const Tpetra_Vector &xT, const Teuchos::Array<ParamVec> &p,
+      const Teuchos::Array<Tpetra_Vector *> &gT,
+      const Teuchos::Array<Thyra::ModelEvaluatorBase::Derivative<ST>> &dg_dxT,
+      const Teuchos::Array<Thyra::ModelEvaluatorBase::Derivative<ST>>
+          &dg_dxdotT,
+      const Teuchos::Array<Thyra::ModelEvaluatorBase::Derivative<ST>>
+          &dg_dxdotdotT);
+
   void evaluateResponseDistParamDerivT(
       int response_index, const double current_time, const Tpetra_Vector *xdot,
       const Tpetra_Vector *xdotdot, const Tpetra_Vector &x,
@@ -403,6 +450,11 @@ public:
   //! Access to number of worksets - needed for working with StateManager
   int getNumWorksets() { return disc->getWsElNodeEqID().size(); }
 
+  //! Record the times of the field manager evaluators in the evaluator
+  //! monitor of util::PerformanceContext, with the costs declared in the
+  //! "Evaluator Costs" sublist of "Debug Output". Collective.
+  void collectEvaluatorStatistics();
+
   //! Const access to problem parameter list
   Teuchos::RCP<const Teuchos::ParameterList> getProblemPL() const {
     return problemParams;
@@ -436,6 +488,9 @@ private:
   Application &operator=(const Application &);
 
 #if defined(ALBANY_EPETRA) && defined(ALBANY_TEKO)
+  //! Fill the Teko inverse factory library from the "Preset" parameter
+  void setTekoPreset();
+
   //! Call to Teko to build strided block operator
   Teuchos::RCP<Epetra_Operator>
   buildWrappedOperator(const Teuchos::RCP<Epetra_Operator> &Jac,
@@ -451,6 +506,47 @@ private:
   void
   removeEpetraRelatedPLs(const Teuchos::RCP<Teuchos::ParameterList> &params);
 
+  //! True if worksets can be assembled concurrently (more than one assembly
+  //! thread requested and a workset coloring available)
+  bool useThreadedAssembly() const;
+
+  //! Print the ghost DOFs and Jacobian entries held in the overlap maps and
+  //! graphs, summed over the ranks
+  void reportOverlapStorage() const;
+
+  //! Add the overlapped Jacobian into the owned one, with the static graph
+  //! exporter if requested
+  void exportJacobianT(
+      const Tpetra_CrsMatrix& overlapped_jacT, Tpetra_CrsMatrix& jacT,
+      const Teuchos::RCP<const Tpetra_Export>& exporterT);
+
+  //! Static graph exporter for the graphs of the two matrices, rebuilt when
+  //! they change
+  StaticGraphExporter& getJacobianExporterT(
+      const Tpetra_CrsMatrix& overlapped_jacT, const Tpetra_CrsMatrix& jacT,
+      const Teuchos::RCP<const Tpetra_Export>& exporterT);
+
+  //! True if the non-threaded fills should overlap the export with the
+  //! assembly. Orders the worksets of the discretization for exporterT.
+  bool overlapFillExportT(const Teuchos::RCP<const Tpetra_Export>& exporterT);
+
+  //! Evaluate the volumetric field managers on all worksets, one color at a
+  //! time, with the worksets of a color distributed over the threads
+  template <typename EvalT>
+  void evaluateColoredWorksets(PHAL::Workset const &workset);
+
+  //! Require the state fields in the Residual fills of the volumetric field
+  //! managers, so that each Residual fill saves the states
+  void requireStatesInResidualFill();
+
+  //! True if the last Residual fill saved the states at this time and
+  //! solution, in which case the state field manager pass can be skipped.
+  //! Consumes the record of the last fill. Collective.
+  bool statesSavedInResidualFill(const double current_time,
+                                 Teuchos::Ptr<const Tpetra_Vector> xdotT,
+                                 Teuchos::Ptr<const Tpetra_Vector> xdotdotT,
+                                 const Tpetra_Vector &xT);
+
 public:
   //! Routine to get workset (bucket) size info needed by all Evaluation types
   template <typename EvalT>
@@ -469,6 +565,10 @@ public:
   void loadWorksetJacobianInfo(PHAL::Workset &workset, const double &alpha,
                                const double &beta, const double &omega);
 
+  //! Set the memoization flags of the workset, after the distributed
+  //! parameters are scattered
+  void loadWorksetMemoizerInfo(PHAL::Workset &workset);
+
   Teuchos::ArrayRCP<Teuchos::RCP<Albany::MeshSpecsStruct>>
   getEnrichedMeshSpecs() const {
     return meshSpecs;
@@ -632,6 +732,18 @@ public:
   Teuchos::RCP<Tpetra_Vector const> const &
   getXdotdot() const { return xdotdot_; }
 
+  /// Solutions seen by the Schwarz BCs of the coupled applications
+  void
+  setX(Teuchos::RCP<Tpetra_Vector const> const & x) { x_ = x; }
+
+  void
+  setXdot(Teuchos::RCP<Tpetra_Vector const> const & xdot) { xdot_ = xdot; }
+
+  void
+  setXdotdot(Teuchos::RCP<Tpetra_Vector const> const & xdotdot) {
+    xdotdot_ = xdotdot;
+  }
+
   void
   setSchwarzAlternating(bool const isa) {is_schwarz_alternating_ = isa;}
 
@@ -656,6 +768,10 @@ private:
 
   bool is_schwarz_alternating_{false};
 
+  //! Status test the constitutive models flag failures in; its reduction
+  //! is posted after each evaluation and completed by NOX
+  Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag> nox_status_test_;
+
 #endif // ALBANY_LCM
 
   std::vector<double> prev_times_;
@@ -669,6 +785,11 @@ protected:
 
   bool requires_sdbcs_;
 
+  //! Shared Jacobian sweeps of the SDBCs, for the global and the overlapped
+  //! Jacobians
+  Teuchos::RCP<PHAL::SDirichletSweep> sdbc_sweep_;
+  Teuchos::RCP<PHAL::SDirichletSweep> overlapped_sdbc_sweep_;
+
   bool requires_orig_dbcs_;
 
 #if defined(ALBANY_EPETRA)
@@ -732,6 +853,47 @@ protected:
   //! Phalanx Field Manager for states
   Teuchos::Array<Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>>> sfm;
 
+  //! Evaluate the gradients of the field manager responses in shared sweeps
+  bool fused_response_gradients_{false};
+
+  //! Number of threads used for workset assembly
+  int num_assembly_threads_{1};
+
+  //! Replicas of the volumetric field managers for assembly threads 1..n-1
+  Teuchos::Array<
+      Teuchos::Array<Teuchos::RCP<PHX::FieldManager<PHAL::AlbanyTraits>>>>
+      thread_fm_;
+
+  //! Export only the values of the overlapped Jacobian, reusing a plan
+  //! built once for the fixed graphs
+  bool static_graph_export_{false};
+  Teuchos::RCP<StaticGraphExporter> jac_exporterT_;
+
+  //! Assemble the worksets with sent equations first, and export their
+  //! rows while the other worksets are assembled
+  bool overlap_fill_export_{false};
+  Teuchos::RCP<AsyncVectorExporter> vec_exporterT_;
+  std::vector<int> ws_export_order_;
+  int num_sent_worksets_{0};
+
+  //! Let basis function evaluators cache their outputs per workset
+  bool cache_basis_functions_{false};
+
+  //! Let evaluators of solution-independent fields reuse their outputs, and
+  //! the overlapped distributed parameters those outputs were computed with
+  bool memoize_fields_{false};
+  int dist_param_state_{0};
+  std::map<std::string, Teuchos::Array<ST>> dist_param_values_;
+
+  //! Save the states in every Residual fill, and skip the state field
+  //! manager pass when it is evaluated at the last Residual fill
+  bool states_in_residual_{false};
+  bool states_saved_{false};
+  double states_time_{0.0};
+  Teuchos::RCP<Tpetra_Vector> states_xT_;
+  Teuchos::RCP<Tpetra_Vector> states_xdotT_;
+  Teuchos::RCP<Tpetra_Vector> states_xdotdotT_;
+
 #if defined(ALBANY_EPETRA)
   //! Product multi-comm
   Teuchos::RCP<const EpetraExt::MultiComm> product_comm;
@@ -785,6 +947,16 @@ protected:
 #endif
   std::vector<int> blockDecomp;
 
+#if defined(ALBANY_EPETRA)
+  //! Tpetra Jacobian assembled for the Epetra interface, kept while the
+  //! Epetra graph is unchanged
+  Teuchos::RCP<Petra::CrsMatrixBridge> jacBridge;
+#endif
+
+  //! Evaluation types whose field managers are set up. The evaluators, the
+  //! DAG and the field data sized by the mesh specs workset size are kept
+  //! when the discretization is updated or adapted, which only changes the
+  //! worksets (see loadWorksetBucketInfo).
   std::set<std::string> setupSet;
   mutable int phxGraphVisDetail;
   mutable int stateGraphVisDetail;
@@ -808,6 +980,8 @@ protected:
 #endif
 
   int derivatives_check_;
+  //! Random directions checked by the derivative check
+  int derivative_check_directions_{1};
 
   int num_time_deriv;
 
@@ -839,11 +1013,35 @@ void Albany::Application::loadWorksetBucketInfo(PHAL::Workset &workset,
 
   workset.numCells = wsElNodeEqID[ws].dimension(0);
   workset.wsElNodeEqID = wsElNodeEqID[ws];
+
+  // The field managers are set up once, with fields of the workset size of
+  // the mesh specs, and are reused after adaptation
+  const int worksetSize = meshSpecs[disc->getWsPhysIndex()[ws]]->worksetSize;
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      workset.numCells > worksetSize, std::logic_error,
+      "Error in Albany::Application: workset "
+          << ws << " has " << workset.numCells
+          << " cells, more than the workset size " << worksetSize
+          << " the field managers were set up for.\n");
+
+  const auto &wsJacOffsets = disc->getWsJacOffsets();
+  if (wsJacOffsets.size() > 0 && Teuchos::nonnull(workset.JacT) &&
+      workset.JacT->getCrsGraph() == disc->getOverlapJacobianGraphT())
+    workset.wsJacOffsets = wsJacOffsets[ws];
+  else
+    workset.wsJacOffsets = Albany::AbstractDiscretization::WorksetJacOffsets();
   workset.wsElNodeID = wsElNodeID[ws];
   workset.wsCoords = coords[ws];
+  const auto &coordsViews = disc->getCoordsViews();
+  workset.wsCoordsView = coordsViews.size() > 0
+                             ? coordsViews[ws]
+                             : Albany::AbstractDiscretization::WorksetCoordsView();
   workset.wsSphereVolume = sphereVolume[ws];
   workset.wsLatticeOrientation = latticeOrientation[ws];
   workset.EBName = wsEBNames[ws];
+  const auto &ebNameToIndex = meshSpecs[disc->getWsPhysIndex()[ws]]->ebNameToIndex;
+  const auto eb = ebNameToIndex.find(wsEBNames[ws]);
+  workset.EBIndex = eb != ebNameToIndex.end() ? eb->second : -1;
   workset.wsIndex = ws;
 
   workset.local_Vp.resize(workset.numCells);
@@ -0,0 +1,60 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_AsyncVectorExporter.hpp"
+#include "Albany_Utils.hpp"
+
+Albany::AsyncVectorExporter::AsyncVectorExporter(
+    const Teuchos::RCP<const Tpetra_Export>& exporterT)
+    : exporterT_(exporterT), distributor_(exporterT->getDistributor())
+{
+  const Teuchos::ArrayView<const LO> exportLIDs = exporterT->getExportLIDs();
+  sent_.assign(exporterT->getSourceMap()->getNodeNumElements(), 0);
+  for (int i = 0; i < exportLIDs.size(); ++i) sent_[exportLIDs[i]] = 1;
+
+  exports_ = Teuchos::arcp<ST>(exportLIDs.size());
+  imports_ = Teuchos::arcp<ST>(exporterT->getRemoteLIDs().size());
+}
+
+void
+Albany::AsyncVectorExporter::beginExportAdd(const Tpetra_Vector& overlapT)
+{
+  ALBANY_ASSERT(!posted_, "AsyncVectorExporter posted twice");
+  const Teuchos::ArrayRCP<const ST>  values     = overlapT.getData();
+  const Teuchos::ArrayView<const LO> exportLIDs = exporterT_->getExportLIDs();
+  for (int i = 0; i < exportLIDs.size(); ++i)
+    exports_[i] = values[exportLIDs[i]];
+  distributor_.doPosts(exports_.getConst(), 1, imports_);
+  posted_ = true;
+}
+
+void
+Albany::AsyncVectorExporter::endExportAdd(
+    const Tpetra_Vector& overlapT,
+    Tpetra_Vector&       targetT)
+{
+  ALBANY_ASSERT(posted_, "AsyncVectorExporter completed without a post");
+  {
+    const Teuchos::ArrayRCP<const ST> from = overlapT.getData();
+    const Teuchos::ArrayRCP<ST>       to   = targetT.getDataNonConst();
+
+    const size_t numSameIDs = exporterT_->getNumSameIDs();
+    for (size_t row = 0; row < numSameIDs; ++row) to[row] += from[row];
+    const Teuchos::ArrayView<const LO> permuteFromLIDs =
+        exporterT_->getPermuteFromLIDs();
+    const Teuchos::ArrayView<const LO> permuteToLIDs =
+        exporterT_->getPermuteToLIDs();
+    for (int i = 0; i < permuteFromLIDs.size(); ++i)
+      to[permuteToLIDs[i]] += from[permuteFromLIDs[i]];
+
+    distributor_.doWaits();
+    posted_ = false;
+
+    const Teuchos::ArrayView<const LO> remoteLIDs = exporterT_->getRemoteLIDs();
+    for (int i = 0; i < remoteLIDs.size(); ++i)
+      to[remoteLIDs[i]] += imports_[i];
+  }
+}
@@ -0,0 +1,67 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_ASYNCVECTOREXPORTER_HPP
+#define ALBANY_ASYNCVECTOREXPORTER_HPP
+
+#include <vector>
+
+#include "Albany_DataTypes.hpp"
+
+namespace Albany {
+
+/*! \brief Export-add of an overlapped vector split into a post and a wait.
+ *
+ *  beginExportAdd packs the rows of the overlapped vector that the Export
+ *  sends to other ranks and posts them. endExportAdd adds the rows kept on
+ *  this rank, waits for the remote rows and adds them. The rows that are
+ *  sent must not change in between; the others may. This lets the fill
+ *  assemble the elements that touch no sent row while the messages are in
+ *  flight.
+ *
+ *  The exporter posts through its own copy of the Export's distributor, so
+ *  that a Jacobian export through the Export may be in flight as well.
+ */
+class AsyncVectorExporter {
+ public:
+  explicit AsyncVectorExporter(
+      const Teuchos::RCP<const Tpetra_Export>& exporterT);
+
+  const Teuchos::RCP<const Tpetra_Export>&
+  getExporter() const
+  {
+    return exporterT_;
+  }
+
+  //! True if the row of the overlapped map with local id lid is sent
+  bool
+  isSent(const LO lid) const
+  {
+    return sent_[lid] != 0;
+  }
+
+  //! Post the sent rows of overlapT
+  void
+  beginExportAdd(const Tpetra_Vector& overlapT);
+
+  //! Add overlapT into targetT, completing the posted rows
+  void
+  endExportAdd(const Tpetra_Vector& overlapT, Tpetra_Vector& targetT);
+
+ private:
+  Teuchos::RCP<const Tpetra_Export> exporterT_;
+  Tpetra::Distributor               distributor_;
+
+  std::vector<char> sent_;
+
+  Teuchos::ArrayRCP<ST> exports_;
+  Teuchos::ArrayRCP<ST> imports_;
+  bool                  posted_{false};
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_ASYNCVECTOREXPORTER_HPP
@@ -18,6 +18,91 @@
 #include "TriKota_ThyraDirectApplicInterface.hpp"
 #include "Albany_SolverFactory.hpp"
 #include "Teuchos_TestForException.hpp"
+#include "Thyra_ModelEvaluatorDelegatorBase.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+#include <deque>
+
+namespace {
+
+// Starts each nonlinear solve from the stored solution of the nearest
+// parameter point evaluated before, instead of the initial guess of the
+// input file. The solution is the last response of the Piro solvers.
+class WarmStartModelEvaluator : public Thyra::ModelEvaluatorDelegatorBase<ST>
+{
+ public:
+  WarmStartModelEvaluator(
+      const Teuchos::RCP<Thyra::ModelEvaluator<ST>>& solver,
+      const Teuchos::RCP<Thyra::VectorBase<ST>>&     initial_guess,
+      const int                                      p_index,
+      const int                                      cache_size)
+      : Thyra::ModelEvaluatorDelegatorBase<ST>(solver),
+        initial_guess_(initial_guess),
+        p_index_(p_index),
+        cache_size_(cache_size)
+  {
+  }
+
+ private:
+  struct Entry
+  {
+    Teuchos::RCP<const Thyra::VectorBase<ST>> p;
+    Teuchos::RCP<const Thyra::VectorBase<ST>> x;
+  };
+
+  void
+  evalModelImpl(
+      const Thyra::ModelEvaluatorBase::InArgs<ST>&  inArgs,
+      const Thyra::ModelEvaluatorBase::OutArgs<ST>& outArgs) const
+  {
+    const Teuchos::RCP<const Thyra::ModelEvaluator<ST>> solver =
+        this->getUnderlyingModel();
+
+    Teuchos::RCP<const Thyra::VectorBase<ST>> p = inArgs.get_p(p_index_);
+    if (Teuchos::is_null(p)) p = solver->getNominalValues().get_p(p_index_);
+
+    // The nominal solution vector of the model is the initial guess of the
+    // solver, overwrite it in place
+    const Teuchos::RCP<Thyra::VectorBase<ST>> diff = p->clone_v();
+    int nearest      = -1;
+    ST  nearest_dist = 0.0;
+    for (size_t i = 0; i < cache_.size(); ++i) {
+      Thyra::V_VmV(diff.ptr(), *p, *cache_[i].p);
+      const ST dist = Thyra::norm_2(*diff);
+      if (nearest < 0 || dist < nearest_dist) {
+        nearest      = i;
+        nearest_dist = dist;
+      }
+    }
+    if (nearest >= 0) Thyra::assign(initial_guess_.ptr(), *cache_[nearest].x);
+
+    const int j_sol = outArgs.Ng() - 1;
+    Thyra::ModelEvaluatorBase::OutArgs<ST> solver_out_args = outArgs;
+    Teuchos::RCP<Thyra::VectorBase<ST>> x = outArgs.get_g(j_sol);
+    if (Teuchos::is_null(x)) {
+      x = Thyra::createMember(solver->get_g_space(j_sol));
+      solver_out_args.set_g(j_sol, x);
+    }
+
+    solver->evalModel(inArgs, solver_out_args);
+
+    Entry entry;
+    entry.p = p->clone_v();
+    entry.x = x->clone_v();
+    cache_.push_back(entry);
+    if (static_cast<int>(cache_.size()) > cache_size_) cache_.pop_front();
+  }
+
+  Teuchos::RCP<Thyra::VectorBase<ST>> initial_guess_;
+
+  int p_index_;
+
+  int cache_size_;
+
+  mutable std::deque<Entry> cache_;
+};
+
+}  // namespace
 
 // Standard use case for TriKota
 //   Dakota is run in library mode with its interface
@@ -98,7 +183,26 @@ int Albany_DakotaT(int argc, char *argv[])
   RCP<Dakota::DirectApplicInterface> trikota_interface;
 
   RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST> > appT = slvrfctry->createT(appCommT, appCommT);
-  trikota_interface = rcp(new TriKota::ThyraDirectApplicInterface(dakota.getProblemDescDB(), appT, p_index, g_index), false);
+
+  // The model and its mesh are built once per analysis communicator, and
+  // reused for all the evaluations Dakota runs on it
+  RCP<Thyra::ModelEvaluatorDefaultBase<ST> > solverT = appT;
+  if (dakotaParams.get("Warm Start", false)) {
+    const int cache_size = dakotaParams.get("Warm Start Cache Size", 100);
+    RCP<Thyra::VectorBase<ST> > initial_guess =
+      Teuchos::rcp_const_cast<Thyra::VectorBase<ST> >(
+        slvrfctry->returnModelT()->getNominalValues().get_x());
+    TEUCHOS_TEST_FOR_EXCEPTION(
+      initial_guess.is_null() ||
+      !appT->get_g_space(appT->Ng() - 1)->isCompatible(*initial_guess->space()),
+      std::logic_error,
+      "Albany_DakotaT: Warm Start needs a solver that returns its solution "
+      "as the last response.\n");
+    solverT = rcp(new WarmStartModelEvaluator(
+      appT, initial_guess, p_index, cache_size));
+  }
+
+  trikota_interface = rcp(new TriKota::ThyraDirectApplicInterface(dakota.getProblemDescDB(), solverT, p_index, g_index), false);
 
   // Run the requested Dakota strategy using this interface
   dakota.run(trikota_interface.get());
@@ -33,16 +33,37 @@ typedef double RealType;
 
 // Switch between dynamic and static FAD types
 #ifdef ALBANY_FAST_FELIX
-  // Code templated on data type need to know if FadType and TanFadType
-  // are the same or different typdefs
-#define ALBANY_FADTYPE_NOTEQUAL_TANFADTYPE
   typedef Sacado::Fad::SLFad<RealType, ALBANY_SLFAD_SIZE> FadType;
 #else
 #define ALBANY_SFAD_SIZE 300
   typedef Sacado::Fad::DFad<RealType> FadType;
 #endif
 
-typedef Sacado::Fad::DFad<RealType> TanFadType;
+#ifdef ALBANY_TAN_SLFAD
+  typedef Sacado::Fad::SLFad<RealType, ALBANY_TAN_SLFAD_SIZE> TanFadType;
+#else
+  typedef Sacado::Fad::DFad<RealType> TanFadType;
+#endif
+
+// Code templated on data type need to know if FadType and TanFadType
+// are the same or different typdefs
+#if defined(ALBANY_FAST_FELIX) != defined(ALBANY_TAN_SLFAD)
+#define ALBANY_FADTYPE_NOTEQUAL_TANFADTYPE
+#elif defined(ALBANY_FAST_FELIX) && ALBANY_SLFAD_SIZE != ALBANY_TAN_SLFAD_SIZE
+#define ALBANY_FADTYPE_NOTEQUAL_TANFADTYPE
+#endif
+
+// Number of derivatives the static FAD types can hold, 0 if dynamic
+#ifdef ALBANY_FAST_FELIX
+const int FadTypeCapacity = ALBANY_SLFAD_SIZE;
+#else
+const int FadTypeCapacity = 0;
+#endif
+#ifdef ALBANY_TAN_SLFAD
+const int TanFadTypeCapacity = ALBANY_TAN_SLFAD_SIZE;
+#else
+const int TanFadTypeCapacity = 0;
+#endif
 
 //Tpetra includes
 #include "Teuchos_DefaultComm.hpp"
@@ -56,6 +56,13 @@ namespace Albany {
     //! Return constant workset_elem_dofs. For each workset, workset_elem_dofs maps (elem, node, nComp) into local id
     virtual const std::vector<id_array_type>& workset_elem_dofs() const = 0;
 
+    //! Local id type of the workset (elem, node) -> local id views
+    typedef typename DistributedParameterTraits<vector_type, multi_vector_type,id_array_type>::elem_lid_view_type elem_lid_view_type;
+
+    //! Return the local ids of the first component of workset_elem_dofs for
+    //! workset ws, as a (elem, node) view that gathers can index directly
+    virtual const elem_lid_view_type& workset_elem_lids(const int ws) const = 0;
+
     //! Get parallel map
     virtual Teuchos::RCP<const map_type> map() const = 0;
 
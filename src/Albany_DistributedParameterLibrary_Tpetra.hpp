@@ -13,12 +13,17 @@
 
 #include "Albany_DataTypes.hpp"
 
+#include "Teuchos_CommHelpers.hpp"
+
+#include <vector>
+
 namespace Albany {
 
   //! Specialization of DistributedParameterTraits for Tpetra_Vector
   template <>
   struct DistributedParameterTraits<Tpetra_Vector, Tpetra_MultiVector, IDArray> {
     typedef Tpetra_Map map_type;
+    typedef Kokkos::View<LO**, Kokkos::LayoutRight, Kokkos::HostSpace> elem_lid_view_type;
   };
 
   //! General distributed parameter storing an Tpetra_Vector
@@ -31,6 +36,7 @@ namespace Albany {
     typedef base_type::multi_vector_type multi_vector_type; // Tpetra_MultiVector
     typedef base_type::map_type map_type;       // Tpetra_Map
     typedef base_type::id_array_type id_array_type;  // IDArray
+    typedef base_type::elem_lid_view_type elem_lid_view_type;
     typedef std::vector<id_array_type> id_array_vec_type; //vector of IDArray
 
     //! Constructor
@@ -76,6 +82,27 @@ namespace Albany {
       return *ws_elem_dofs;
     }
 
+    //! Return the (elem, node) local ids of workset ws. The view is built on
+    //! first use, and again if the workset_elem_dofs of ws are reallocated.
+    virtual const elem_lid_view_type& workset_elem_lids(const int ws) const {
+      const id_array_type& dofs = (*ws_elem_dofs)[ws];
+      if (ws_elem_lids.size() != ws_elem_dofs->size()) {
+        ws_elem_lids.assign(ws_elem_dofs->size(), elem_lid_view_type());
+        ws_elem_lids_src.assign(ws_elem_dofs->size(), NULL);
+      }
+      elem_lid_view_type& lids = ws_elem_lids[ws];
+      if (ws_elem_lids_src[ws] != dofs.contiguous_data() ||
+          lids.dimension_0() != dofs.dimension(0) ||
+          lids.dimension_1() != dofs.dimension(1)) {
+        lids = elem_lid_view_type("workset_elem_lids", dofs.dimension(0), dofs.dimension(1));
+        for (int cell = 0; cell < dofs.dimension(0); ++cell)
+          for (int node = 0; node < dofs.dimension(1); ++node)
+            lids(cell, node) = dofs(cell, node, 0);
+        ws_elem_lids_src[ws] = dofs.contiguous_data();
+      }
+      return lids;
+    }
+
     //! Get vector
     virtual Teuchos::RCP<vector_type> vector() const {
       return vec;
@@ -108,9 +135,25 @@ namespace Albany {
       dst.doExport(src, *exporter, Tpetra::ADD);
     }
 
-    //! Fill overlapped vector from owned vector
+    //! Fill overlapped vector from owned vector. The import is skipped if
+    //! no rank's owned values changed since the last scatter.
     virtual void scatter() const {
+      int changed = scattered_vec.is_null() ? 1 : 0;
+      if (!changed) {
+        const Teuchos::ArrayRCP<const ST> a = vec->get1dView();
+        const Teuchos::ArrayRCP<const ST> b = scattered_vec->get1dView();
+        for (int i = 0; !changed && i < a.size(); ++i)
+          changed = a[i] != b[i];
+      }
+      int anyChanged = changed;
+      Teuchos::reduceAll<int, int>(*owned_map->getComm(), Teuchos::REDUCE_MAX,
+                                   changed, Teuchos::outArg(anyChanged));
+      if (!anyChanged) return;
+
       overlapped_vec->doImport(*vec, *importer, Tpetra::INSERT);
+      if (scattered_vec.is_null())
+        scattered_vec = Teuchos::rcp(new Tpetra_Vector(owned_map, false));
+      scattered_vec->update(1.0, *vec, 0.0);
     }
 
   protected:
@@ -143,6 +186,13 @@ namespace Albany {
     //! vector over worksets, containing DOF's map from (elem, node, nComp) into local id
     Teuchos::RCP<const id_array_vec_type> ws_elem_dofs;
 
+    //! (elem, node) local ids per workset, and the dofs they were built from
+    mutable std::vector<elem_lid_view_type> ws_elem_lids;
+    mutable std::vector<const LO*> ws_elem_lids_src;
+
+    //! Owned values at the last import into overlapped_vec
+    mutable Teuchos::RCP<Tpetra_Vector> scattered_vec;
+
   };
 
 }
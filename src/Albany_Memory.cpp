@@ -8,6 +8,8 @@
 #include <vector>
 #include <sstream>
 #include <iomanip>
+#include <fstream>
+#include <cstdlib>
 
 #include <Teuchos_CommHelpers.hpp>
 #include "Albany_Memory.hpp"
@@ -43,11 +45,13 @@ class MemoryAnalyzer {
     ru_nvcsw, ru_nivcsw,
     // Kernel_GetMemorySize
     gms_shared, gms_persist, gms_heapavail, gms_stackavail, gms_stack,
-    gms_heap, gms_guard, gms_mmap
+    gms_heap, gms_guard, gms_mmap,
+    // numa_maps
+    numa_n0, numa_n1, numa_n2, numa_n3, numa_n4, numa_n5, numa_n6, numa_n7
   };
 
   Teuchos::RCP< const Teuchos::Comm<int> > comm_;
-  static const int ndata_ = gms_mmap + 1;
+  static const int ndata_ = numa_n7 + 1;
   Int data_[ndata_];
   struct {
     Int min[ndata_], min_i[ndata_], med[ndata_], max[ndata_], max_i[ndata_];
@@ -95,6 +99,23 @@ class MemoryAnalyzer {
 #endif    
   }
 
+  // Pages of this rank on each NUMA node, summed over the mappings listed in
+  // /proc/self/numa_maps (Linux).
+  static void collectNumaMaps (Int* data) {
+#ifdef ALBANY_HAVE_NUMA_MAPS
+    std::ifstream maps("/proc/self/numa_maps");
+    std::string token;
+    while (maps >> token) {
+      if (token.size() < 4 || token[0] != 'N') continue;
+      const std::size_t eq = token.find('=');
+      if (eq == std::string::npos) continue;
+      const int node = std::atoi(token.substr(1, eq - 1).c_str());
+      if (node < 0 || node > numa_n7 - numa_n0) continue;
+      data[numa_n0 + node] += std::atoll(token.substr(eq + 1).c_str());
+    }
+#endif
+  }
+
   void calcStats (const std::vector<Int>& d) {
     if (comm_->getRank() != 0) return;
 
@@ -132,6 +153,7 @@ public:
     collectMallinfo(data_);
     collectGetrusage(data_);
     collectKernelGetMemorySize(data_);
+    collectNumaMaps(data_);
 
     std::vector<Int> d;
     if (comm_->getRank() == 0) d.resize(ndata_*comm_->getSize(), 0);
@@ -171,6 +193,9 @@ public:
 
     smsg(gms_heapavail); smsg(gms_stackavail); smsg(gms_stack); smsg(gms_heap);
     smsg(gms_guard); smsg(gms_mmap);
+
+    smsg(numa_n0); smsg(numa_n1); smsg(numa_n2); smsg(numa_n3);
+    smsg(numa_n4); smsg(numa_n5); smsg(numa_n6); smsg(numa_n7);
     msg << "<<< Albany Memory Analysis" << std::endl;
 #undef smsg
     os << msg.str();
@@ -186,4 +211,15 @@ void printMemoryAnalysis (
   ma.print(os);
 }
 
+long long getPeakResidentSetSize ()
+{
+#ifdef ALBANY_HAVE_GETRUSAGE
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return static_cast<long long>(ru.ru_maxrss);
+#else
+  return 0;
+#endif
+}
+
 } // namespace Albany
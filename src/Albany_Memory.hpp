@@ -27,16 +27,20 @@ namespace Albany {
  *        <Parameter name="Analyze Memory" type="bool" value="true"/>
  *      </ParameterList>
  *
- *  printMemoryAnalysis obtains data from up to three sources: mallinfo,
- *  getrusage, and Kernel_GetMemorySize. None of these is assumed to be
- *  available. To enable them, provide these flags in your configuration file:
+ *  printMemoryAnalysis obtains data from up to four sources: mallinfo,
+ *  getrusage, Kernel_GetMemorySize, and /proc/self/numa_maps. None of these is
+ *  assumed to be available. To enable them, provide these flags in your
+ *  configuration file:
  *
  *      -D ENABLE_MALLINFO=ON \
  *      -D ENABLE_GETRUSAGE=ON \
  *      -D ENABLE_KERNELGETMEMORYSIZE=ON \
+ *      -D ENABLE_NUMA_MAPS=ON \
  *
  *  The third one is available only in special environments. The first two are
- *  generally available on *nix systems. You might get a compile or link error
+ *  generally available on *nix systems, the fourth on Linux. It reports the
+ *  pages of each rank on NUMA nodes 0 to 7 (numa_n0 ... numa_n7), which shows
+ *  whether the threads of a rank work on memory of their own socket. You might get a compile or link error
  *  if you enable one on a system that does not support it. These are all off by
  *  default.
  *
@@ -49,6 +53,12 @@ namespace Albany {
  */
 void printMemoryAnalysis(
   std::ostream& os, const Teuchos::RCP< const Teuchos::Comm<int> >& comm);
+
+/*! \brief Peak resident set size of this rank in KB, from getrusage.
+ *
+ *  Returns 0 unless Albany is configured with ENABLE_GETRUSAGE.
+ */
+long long getPeakResidentSetSize();
 }
 
 #endif // ALBANY_MEMORY_HPP
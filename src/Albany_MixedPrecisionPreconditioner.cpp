@@ -0,0 +1,259 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_MixedPrecisionPreconditioner.hpp"
+
+#ifdef ALBANY_MIXED_PRECISION_PREC
+
+#include "Albany_Utils.hpp"
+#include "Ifpack2_Factory.hpp"
+#include "Teuchos_TimeMonitor.hpp"
+#include "Thyra_DefaultPreconditioner.hpp"
+#ifdef ALBANY_MUELU
+#include "MueLu_CreateTpetraPreconditioner.hpp"
+#include "MueLu_TpetraOperator.hpp"
+#endif
+
+namespace {
+
+typedef Ifpack2::Preconditioner<float, Tpetra_LO, Tpetra_GO, KokkosNode>
+    Ifpack2Prec;
+#ifdef ALBANY_MUELU
+typedef MueLu::TpetraOperator<float, Tpetra_LO, Tpetra_GO, KokkosNode>
+    MueLuPrec;
+#endif
+
+// Convert the values of a matrix into one sharing its graph
+void
+copyValues(const Tpetra_CrsMatrix& from, Albany::Tpetra_CrsMatrix_Float& to)
+{
+  const auto src = from.getLocalMatrix().values;
+  const auto dst = to.getLocalMatrix().values;
+  Kokkos::parallel_for(
+      "Albany::MixedPrecision::copyValues",
+      Kokkos::RangePolicy<PHX::Device::execution_space>(0, src.dimension(0)),
+      KOKKOS_LAMBDA(const int i) { dst(i) = static_cast<float>(src(i)); });
+}
+
+}  // namespace
+
+Albany::MixedPrecisionOperator::MixedPrecisionOperator(
+    const Teuchos::RCP<Tpetra_CrsMatrix_Float>& matrix,
+    const Teuchos::RCP<Tpetra_Operator_Float>&  prec,
+    const std::string&                          type)
+    : matrix_(matrix), prec_(prec), type_(type)
+{
+}
+
+bool
+Albany::MixedPrecisionOperator::isCompatible(
+    const Tpetra_CrsMatrix& matrixT) const
+{
+  return matrix_->getCrsGraph() == matrixT.getCrsGraph();
+}
+
+void
+Albany::MixedPrecisionOperator::update(const Tpetra_CrsMatrix& matrixT)
+{
+  ALBANY_ASSERT(
+      isCompatible(matrixT),
+      "MixedPrecisionOperator updated from a matrix with another graph");
+  copyValues(matrixT, *matrix_);
+
+#ifdef ALBANY_MUELU
+  if (type_ == "MueLu") {
+    MueLu::ReuseTpetraPreconditioner(
+        matrix_, *Teuchos::rcp_dynamic_cast<MueLuPrec>(prec_, true));
+    return;
+  }
+#endif
+  Teuchos::rcp_dynamic_cast<Ifpack2Prec>(prec_, true)->compute();
+}
+
+void
+Albany::MixedPrecisionOperator::apply(
+    const Tpetra_MultiVector& X,
+    Tpetra_MultiVector&       Y,
+    Teuchos::ETransp          mode,
+    ST                        alpha,
+    ST                        beta) const
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      mode != Teuchos::NO_TRANS, std::logic_error,
+      "MixedPrecisionOperator only applies the preconditioner itself\n");
+
+  const size_t numVectors = X.getNumVectors();
+  if (Xf_.is_null() || Xf_->getNumVectors() != numVectors) {
+    Xf_ = Teuchos::rcp(new Tpetra_MultiVector_Float(X.getMap(), numVectors));
+    Yf_ = Teuchos::rcp(new Tpetra_MultiVector_Float(Y.getMap(), numVectors));
+  }
+
+  Tpetra::deep_copy(*Xf_, X);
+  prec_->apply(*Xf_, *Yf_);
+
+  if (alpha == Teuchos::ScalarTraits<ST>::one() &&
+      beta == Teuchos::ScalarTraits<ST>::zero()) {
+    Tpetra::deep_copy(Y, *Yf_);
+  } else {
+    Tpetra_MultiVector MX(Y.getMap(), numVectors);
+    Tpetra::deep_copy(MX, *Yf_);
+    Y.update(alpha, MX, beta);
+  }
+}
+
+bool
+Albany::MixedPrecisionPreconditionerFactory::isCompatible(
+    const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const
+{
+  const Teuchos::RCP<const Tpetra_Operator> op =
+      ConverterT::getConstTpetraOperator(fwdOpSrc.getOp());
+  return Teuchos::nonnull(
+      Teuchos::rcp_dynamic_cast<const Tpetra_CrsMatrix>(op));
+}
+
+Teuchos::RCP<Thyra::PreconditionerBase<ST>>
+Albany::MixedPrecisionPreconditionerFactory::createPrec() const
+{
+  return Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>);
+}
+
+void
+Albany::MixedPrecisionPreconditionerFactory::initializePrec(
+    const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+    Thyra::PreconditionerBase<ST>*                           prec,
+    const Thyra::ESupportSolveUse supportSolveUse) const
+{
+  static Teuchos::RCP<Teuchos::Time> setupTime =
+      Teuchos::TimeMonitor::getNewTimer("Albany: Mixed Precision Prec Setup");
+  Teuchos::TimeMonitor setupTimer(*setupTime);
+
+  const Teuchos::RCP<const Tpetra_CrsMatrix> matrixT =
+      Teuchos::rcp_dynamic_cast<const Tpetra_CrsMatrix>(
+          ConverterT::getConstTpetraOperator(fwdOpSrc->getOp()), true);
+
+  Thyra::DefaultPreconditioner<ST>* defaultPrec =
+      dynamic_cast<Thyra::DefaultPreconditioner<ST>*>(prec);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      defaultPrec == NULL, std::logic_error,
+      "MixedPrecisionPreconditionerFactory needs a DefaultPreconditioner\n");
+
+  // Reuse the float matrix and the setup of the last Jacobian if the graph
+  // did not change
+  const Teuchos::RCP<Thyra::LinearOpBase<ST>> oldOp =
+      defaultPrec->getNonconstUnspecifiedPrecOp();
+  if (Teuchos::nonnull(oldOp)) {
+    const Teuchos::RCP<MixedPrecisionOperator> oldPrec =
+        Teuchos::rcp_dynamic_cast<MixedPrecisionOperator>(
+            ConverterT::getTpetraOperator(oldOp));
+    if (Teuchos::nonnull(oldPrec) && oldPrec->isCompatible(*matrixT)) {
+      oldPrec->update(*matrixT);
+      return;
+    }
+  }
+
+  const Teuchos::RCP<Teuchos::ParameterList> params =
+      Teuchos::nonnull(paramList_) ? paramList_ :
+                                     Teuchos::rcp(new Teuchos::ParameterList);
+  const std::string type =
+      params->get<std::string>("Inner Preconditioner Type", "Ifpack2");
+
+  // The float matrix shares the graph of the Jacobian, so later updates
+  // only convert the values
+  const Teuchos::RCP<Tpetra_CrsMatrix_Float> matrix =
+      Teuchos::rcp(new Tpetra_CrsMatrix_Float(matrixT->getCrsGraph()));
+  matrix->fillComplete(matrixT->getDomainMap(), matrixT->getRangeMap());
+  copyValues(*matrixT, *matrix);
+
+  Teuchos::RCP<Tpetra_Operator_Float> innerPrec;
+  if (type == "Ifpack2") {
+    Teuchos::ParameterList& ifpackList = params->sublist("Ifpack2");
+    const std::string precType =
+        ifpackList.get<std::string>("Prec Type", "ILUT");
+    Ifpack2::Factory factory;
+    const Teuchos::RCP<Ifpack2Prec> ifpackPrec =
+        factory.create<Tpetra::RowMatrix<float, Tpetra_LO, Tpetra_GO, KokkosNode>>(
+            precType, matrix);
+    ifpackPrec->setParameters(ifpackList.sublist("Ifpack2 Settings"));
+    ifpackPrec->initialize();
+    ifpackPrec->compute();
+    innerPrec = ifpackPrec;
+  }
+#ifdef ALBANY_MUELU
+  else if (type == "MueLu") {
+    Teuchos::RCP<Tpetra_Operator_Float> op = matrix;
+    innerPrec = MueLu::CreateTpetraPreconditioner(op, params->sublist("MueLu"));
+  }
+#endif
+  else {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        true, std::logic_error,
+        "Unknown Inner Preconditioner Type \"" << type << "\"\n");
+  }
+
+  const Teuchos::RCP<Tpetra_Operator> precOp =
+      Teuchos::rcp(new MixedPrecisionOperator(matrix, innerPrec, type));
+  defaultPrec->initializeUnspecified(Thyra::createLinearOp(precOp));
+}
+
+void
+Albany::MixedPrecisionPreconditionerFactory::uninitializePrec(
+    Thyra::PreconditionerBase<ST>*                     prec,
+    Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* fwdOpSrc,
+    Thyra::ESupportSolveUse*                           supportSolveUse) const
+{
+  // The preconditioner is kept for reuse with the next Jacobian
+  if (fwdOpSrc) *fwdOpSrc = Teuchos::null;
+  if (supportSolveUse) *supportSolveUse = Thyra::SUPPORT_SOLVE_UNSPECIFIED;
+}
+
+void
+Albany::MixedPrecisionPreconditionerFactory::setParameterList(
+    const Teuchos::RCP<Teuchos::ParameterList>& paramList)
+{
+  paramList->validateParametersAndSetDefaults(*getValidParameters(), 0);
+  paramList_ = paramList;
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+Albany::MixedPrecisionPreconditionerFactory::getNonconstParameterList()
+{
+  return paramList_;
+}
+
+Teuchos::RCP<Teuchos::ParameterList>
+Albany::MixedPrecisionPreconditionerFactory::unsetParameterList()
+{
+  const Teuchos::RCP<Teuchos::ParameterList> old = paramList_;
+  paramList_ = Teuchos::null;
+  return old;
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+Albany::MixedPrecisionPreconditionerFactory::getParameterList() const
+{
+  return paramList_;
+}
+
+Teuchos::RCP<const Teuchos::ParameterList>
+Albany::MixedPrecisionPreconditionerFactory::getValidParameters() const
+{
+  static Teuchos::RCP<Teuchos::ParameterList> validPL;
+  if (validPL.is_null()) {
+    validPL = Teuchos::rcp(new Teuchos::ParameterList("Mixed Precision"));
+    validPL->set<std::string>(
+        "Inner Preconditioner Type", "Ifpack2",
+        "Preconditioner built on the float Jacobian: Ifpack2 or MueLu");
+    Teuchos::ParameterList& ifpackList = validPL->sublist(
+        "Ifpack2", false, "Ifpack2 preconditioner in single precision");
+    ifpackList.set<std::string>("Prec Type", "ILUT", "Ifpack2 preconditioner");
+    ifpackList.sublist("Ifpack2 Settings").disableRecursiveValidation();
+    validPL->sublist("MueLu", false, "MueLu parameters")
+        .disableRecursiveValidation();
+  }
+  return validPL;
+}
+
+#endif  // ALBANY_MIXED_PRECISION_PREC
@@ -0,0 +1,136 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_MIXEDPRECISIONPRECONDITIONER_HPP
+#define ALBANY_MIXEDPRECISIONPRECONDITIONER_HPP
+
+#include "Albany_DataTypes.hpp"
+
+#if defined(ALBANY_IFPACK2) && defined(HAVE_TPETRA_INST_FLOAT)
+#define ALBANY_MIXED_PRECISION_PREC
+
+#include "Thyra_PreconditionerFactoryBase.hpp"
+
+namespace Albany {
+
+typedef Tpetra::CrsMatrix<float, Tpetra_LO, Tpetra_GO, KokkosNode>
+    Tpetra_CrsMatrix_Float;
+typedef Tpetra::Operator<float, Tpetra_LO, Tpetra_GO, KokkosNode>
+    Tpetra_Operator_Float;
+typedef Tpetra::MultiVector<float, Tpetra_LO, Tpetra_GO, KokkosNode>
+    Tpetra_MultiVector_Float;
+
+/*! \brief Preconditioner built and applied in single precision.
+ *
+ *  Wraps an Ifpack2 or MueLu preconditioner of a float copy of the
+ *  Jacobian as a double Tpetra operator. The vectors are converted to float
+ *  on the way in and back to double on the way out, so the setup and the
+ *  sweeps move half the bytes of the double preconditioner. The outer
+ *  Krylov method stays in double; a flexible one (e.g. Belos "Flexible
+ *  Gmres") tolerates the rounding of the preconditioner best.
+ */
+class MixedPrecisionOperator : public Tpetra_Operator {
+ public:
+  MixedPrecisionOperator(
+      const Teuchos::RCP<Tpetra_CrsMatrix_Float>& matrix,
+      const Teuchos::RCP<Tpetra_Operator_Float>&  prec,
+      const std::string&                          type);
+
+  //! The matrix the float copy was made from, which must share its graph
+  bool
+  isCompatible(const Tpetra_CrsMatrix& matrixT) const;
+
+  //! Copy the values of matrixT into the float matrix and recompute the
+  //! numeric setup of the preconditioner, keeping its symbolic setup
+  void
+  update(const Tpetra_CrsMatrix& matrixT);
+
+  Teuchos::RCP<const Tpetra_Map>
+  getDomainMap() const
+  {
+    return prec_->getDomainMap();
+  }
+
+  Teuchos::RCP<const Tpetra_Map>
+  getRangeMap() const
+  {
+    return prec_->getRangeMap();
+  }
+
+  void
+  apply(
+      const Tpetra_MultiVector& X,
+      Tpetra_MultiVector&       Y,
+      Teuchos::ETransp          mode  = Teuchos::NO_TRANS,
+      ST                        alpha = Teuchos::ScalarTraits<ST>::one(),
+      ST                        beta  = Teuchos::ScalarTraits<ST>::zero()) const;
+
+ private:
+  Teuchos::RCP<Tpetra_CrsMatrix_Float> matrix_;
+  Teuchos::RCP<Tpetra_Operator_Float>  prec_;
+  std::string                          type_;
+
+  //! Work vectors, reallocated when the number of vectors changes
+  mutable Teuchos::RCP<Tpetra_MultiVector_Float> Xf_;
+  mutable Teuchos::RCP<Tpetra_MultiVector_Float> Yf_;
+};
+
+/*! \brief Stratimikos factory of MixedPrecisionOperator.
+ *
+ *  Registered as the "Mixed Precision" preconditioner type. Parameters:
+ *  "Inner Preconditioner Type" is "Ifpack2" (default) or "MueLu". The
+ *  "Ifpack2" sublist takes "Prec Type" and "Ifpack2 Settings" as the
+ *  Stratimikos Ifpack2 factory does; the "MueLu" sublist is passed to MueLu.
+ *
+ *  The float matrix is created once per Jacobian graph. While the graph is
+ *  unchanged, e.g. when the Jacobian is recomputed with the same sparsity,
+ *  only the values are converted and the preconditioner setup is reused.
+ */
+class MixedPrecisionPreconditionerFactory
+    : public Thyra::PreconditionerFactoryBase<ST> {
+ public:
+  bool
+  isCompatible(const Thyra::LinearOpSourceBase<ST>& fwdOpSrc) const;
+
+  Teuchos::RCP<Thyra::PreconditionerBase<ST>>
+  createPrec() const;
+
+  void
+  initializePrec(
+      const Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>& fwdOpSrc,
+      Thyra::PreconditionerBase<ST>*                           prec,
+      const Thyra::ESupportSolveUse supportSolveUse) const;
+
+  void
+  uninitializePrec(
+      Thyra::PreconditionerBase<ST>*                     prec,
+      Teuchos::RCP<const Thyra::LinearOpSourceBase<ST>>* fwdOpSrc,
+      Thyra::ESupportSolveUse*                           supportSolveUse) const;
+
+  void
+  setParameterList(const Teuchos::RCP<Teuchos::ParameterList>& paramList);
+
+  Teuchos::RCP<Teuchos::ParameterList>
+  getNonconstParameterList();
+
+  Teuchos::RCP<Teuchos::ParameterList>
+  unsetParameterList();
+
+  Teuchos::RCP<const Teuchos::ParameterList>
+  getParameterList() const;
+
+  Teuchos::RCP<const Teuchos::ParameterList>
+  getValidParameters() const;
+
+ private:
+  Teuchos::RCP<Teuchos::ParameterList> paramList_;
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_IFPACK2 && HAVE_TPETRA_INST_FLOAT
+
+#endif  // ALBANY_MIXEDPRECISIONPRECONDITIONER_HPP
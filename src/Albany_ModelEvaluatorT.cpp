@@ -11,6 +11,11 @@
 #include "Teuchos_ScalarTraits.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Tpetra_ConfigDefs.hpp"
+#include "utility/PerformanceContext.hpp"
+#include "Thyra_DefaultLinearOpSource.hpp"
+#ifdef ALBANY_IFPACK2
+#include "Thyra_Ifpack2PreconditionerFactory.hpp"
+#endif
 
 // uncomment the following to write stuff out to matrix market to debug
 //#define WRITE_TO_MATRIX_MARKET
@@ -29,6 +34,120 @@ static int mm_counter_jac = 0;
 #include "TpetraExt_MMHelpers.hpp"
 #endif
 
+namespace {
+// Applies W = alpha df/dxdot + beta df/dx + omega df/dxdotdot at a point
+// without assembling it, as the directional derivative computed by the
+// Tangent evaluation type with all the seeds set to the applied vectors.
+class TangentOpT : public Tpetra_Operator {
+ public:
+  TangentOpT(
+      const Teuchos::RCP<Albany::Application>& app,
+      const Teuchos::Array<ParamVec>&          p)
+      : app_(app), p_(p), mapT_(app->getMapT())
+  {
+  }
+
+  //! Set the point W is applied at; the vectors are copied
+  void
+  setPoint(
+      ST const             alpha,
+      ST const             beta,
+      ST const             omega,
+      ST const             t,
+      const Tpetra_Vector& xT,
+      const Tpetra_Vector* x_dotT,
+      const Tpetra_Vector* x_dotdotT)
+  {
+    alpha_ = alpha;
+    beta_  = beta;
+    omega_ = omega;
+    t_     = t;
+    copy(xT_, &xT);
+    copy(x_dotT_, x_dotT);
+    copy(x_dotdotT_, x_dotdotT);
+  }
+
+  virtual void
+  apply(
+      const Tpetra_MultiVector& X,
+      Tpetra_MultiVector&       Y,
+      Teuchos::ETransp          mode  = Teuchos::NO_TRANS,
+      ST                        alpha = Teuchos::ScalarTraits<ST>::one(),
+      ST                        beta  = Teuchos::ScalarTraits<ST>::zero()) const
+  {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        mode != Teuchos::NO_TRANS,
+        std::logic_error,
+        "TangentOpT only applies the Jacobian untransposed.\n");
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        Teuchos::is_null(xT_),
+        std::logic_error,
+        "TangentOpT is applied before its point is set.\n");
+    if (Teuchos::is_null(JVT_) ||
+        JVT_->getNumVectors() != X.getNumVectors()) {
+      JVT_ = Teuchos::rcp(new Tpetra_MultiVector(mapT_, X.getNumVectors()));
+    }
+    app_->computeGlobalTangentT(
+        alpha_,
+        beta_,
+        omega_,
+        t_,
+        false,
+        x_dotT_.get(),
+        x_dotdotT_.get(),
+        *xT_,
+        p_,
+        NULL,
+        &X,
+        Teuchos::nonnull(x_dotT_) ? &X : NULL,
+        Teuchos::nonnull(x_dotdotT_) ? &X : NULL,
+        NULL,
+        NULL,
+        JVT_.get(),
+        NULL);
+    Y.update(alpha, *JVT_, beta);
+  }
+
+  virtual bool
+  hasTransposeApply() const
+  {
+    return false;
+  }
+
+  virtual Teuchos::RCP<const Tpetra_Map>
+  getDomainMap() const
+  {
+    return mapT_;
+  }
+
+  virtual Teuchos::RCP<const Tpetra_Map>
+  getRangeMap() const
+  {
+    return mapT_;
+  }
+
+ private:
+  static void
+  copy(Teuchos::RCP<Tpetra_Vector>& to, const Tpetra_Vector* from)
+  {
+    if (from == NULL) {
+      to = Teuchos::null;
+      return;
+    }
+    if (Teuchos::is_null(to)) to = Teuchos::rcp(new Tpetra_Vector(from->getMap()));
+    to->update(1.0, *from, 0.0);
+  }
+
+  const Teuchos::RCP<Albany::Application> app_;
+  const Teuchos::Array<ParamVec>&         p_;
+  const Teuchos::RCP<const Tpetra_Map>    mapT_;
+  ST                                      alpha_{0.0}, beta_{1.0}, omega_{0.0};
+  ST                                      t_{0.0};
+  Teuchos::RCP<Tpetra_Vector>             xT_, x_dotT_, x_dotdotT_;
+  mutable Teuchos::RCP<Tpetra_MultiVector> JVT_;
+};
+}  // namespace
+
 Albany::ModelEvaluatorT::ModelEvaluatorT(
     const Teuchos::RCP<Albany::Application>&    app_,
     const Teuchos::RCP<Teuchos::ParameterList>& appParams)
@@ -56,6 +175,54 @@ Albany::ModelEvaluatorT::ModelEvaluatorT(
 
   *out << "Number of parameter vectors  = " << num_param_vecs << std::endl;
 
+  // Matrix-free Jacobian through the Tangent evaluation type
+  const std::string jacobianOperator =
+      problemParams.get<std::string>("Jacobian Operator", "Assembled");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      jacobianOperator != "Assembled" && jacobianOperator != "Tangent",
+      Teuchos::Exceptions::InvalidParameter,
+      std::endl
+          << "Error!  In Albany::ModelEvaluatorT constructor:  "
+          << "Jacobian Operator must be Assembled or Tangent, not "
+          << jacobianOperator
+          << "."
+          << std::endl);
+  jac_tangent_ = jacobianOperator == "Tangent";
+  if (jac_tangent_) {
+#ifdef ALBANY_IFPACK2
+    tangent_prec_factory_ = Teuchos::rcp(
+        new Thyra::Ifpack2PreconditionerFactory<Tpetra_CrsMatrix>);
+    tangent_prec_factory_->setParameterList(Teuchos::rcp(
+        new Teuchos::ParameterList(
+            problemParams.sublist("Tangent Preconditioner"))));
+#else
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        true,
+        Teuchos::Exceptions::InvalidParameter,
+        std::endl
+            << "Error!  In Albany::ModelEvaluatorT constructor:  "
+            << "Jacobian Operator = Tangent needs Albany built with Ifpack2."
+            << std::endl);
+#endif
+  }
+
+  // Jacobian reuse; by default the Jacobian is filled whenever requested
+  if (problemParams.isSublist("Jacobian Reuse")) {
+    Teuchos::ParameterList& reuseParams =
+        problemParams.sublist("Jacobian Reuse");
+    jac_iteration_interval_ = reuseParams.get("Iteration Interval", 1);
+    jac_step_interval_      = reuseParams.get("Step Interval", 0);
+    jac_stall_ratio_        = reuseParams.get("Stall Ratio", 0.0);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        jac_iteration_interval_ < 0 || jac_step_interval_ < 0 ||
+            jac_stall_ratio_ < 0.0,
+        Teuchos::Exceptions::InvalidParameter,
+        std::endl
+            << "Error!  In Albany::ModelEvaluatorT constructor:  "
+            << "Jacobian Reuse intervals and Stall Ratio must not be negative."
+            << std::endl);
+  }
+
   Teuchos::ParameterList& responseParams =
       problemParams.sublist("Response Functions");
 
@@ -423,9 +590,58 @@ Albany::ModelEvaluatorT::getUpperBounds() const
   return Thyra::ModelEvaluatorBase::InArgs<ST>();  // Default value
 }
 
+bool
+Albany::ModelEvaluatorT::rebuildJacobian(
+    const Tpetra_CrsMatrix& W,
+    ST const                alpha,
+    ST const                beta,
+    ST const                omega,
+    ST const                curr_time,
+    bool const              force) const
+{
+  util::CounterMonitor& counters =
+      util::PerformanceContext::instance().counterMonitor();
+
+  ++jac_requests_;
+  if (curr_time != jac_time_) {
+    ++jac_steps_;
+    jac_time_ = curr_time;
+  }
+  ST const f_ratio = jac_f_norm_ > 0.0 ? f_norm_ / jac_f_norm_ : 0.0;
+  jac_f_norm_      = f_norm_;
+
+  // A new matrix (first fill, or a new mesh) or new time integrator
+  // coefficients always need a fill
+  bool const rebuild =
+      force || jac_filled_ != &W || alpha != jac_alpha_ || beta != jac_beta_ ||
+      omega != jac_omega_ ||
+      (jac_iteration_interval_ > 0 &&
+       jac_requests_ >= jac_iteration_interval_) ||
+      (jac_step_interval_ > 0 && jac_steps_ >= jac_step_interval_) ||
+      (jac_stall_ratio_ > 0.0 && f_ratio > jac_stall_ratio_);
+
+  if (rebuild == false) {
+    ++*counters["Albany: Jacobian Fills Reused"];
+    return false;
+  }
+
+  ++*counters["Albany: Jacobian Fills"];
+  jac_filled_   = &W;
+  jac_requests_ = 0;
+  jac_steps_    = 0;
+  jac_alpha_    = alpha;
+  jac_beta_     = beta;
+  jac_omega_    = omega;
+  return true;
+}
+
 Teuchos::RCP<Thyra::LinearOpBase<ST>>
 Albany::ModelEvaluatorT::create_W_op() const
 {
+  if (jac_tangent_) {
+    return Thyra::createLinearOp(
+        Teuchos::RCP<Tpetra_Operator>(new TangentOpT(app, sacado_param_vec)));
+  }
   const Teuchos::RCP<Tpetra_Operator> W =
       Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
   return Thyra::createLinearOp(W);
@@ -434,6 +650,12 @@ Albany::ModelEvaluatorT::create_W_op() const
 Teuchos::RCP<Thyra::PreconditionerBase<ST>>
 Albany::ModelEvaluatorT::create_W_prec() const
 {
+  // The matrix-free W is preconditioned on the assembled Jacobian
+  if (jac_tangent_) {
+    Extra_W_crs = Teuchos::rcp(new Tpetra_CrsMatrix(app->getJacobianGraphT()));
+    return tangent_prec_factory_->createPrec();
+  }
+
   Teuchos::RCP<Thyra::DefaultPreconditioner<ST>> W_prec =
       Teuchos::rcp(new Thyra::DefaultPreconditioner<ST>);
   Teuchos::RCP<Tpetra_Operator>         precOp = app->getPreconditionerT();
@@ -562,7 +784,7 @@ Albany::ModelEvaluatorT::createOutArgsImpl() const
 
   result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_f, true);
 
-  if (supplies_prec)
+  if (supplies_prec || jac_tangent_)
     result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec, true);
 
   result.setSupports(Thyra::ModelEvaluatorBase::OUT_ARG_W_op, true);
@@ -769,11 +991,21 @@ Albany::ModelEvaluatorT::evalModelImpl(
           Teuchos::null;
 #endif
 
-  // Cast W to a CrsMatrix, throw an exception if this fails
+  // Cast W to a CrsMatrix, or to the matrix-free operator, throw an
+  // exception if this fails
   const Teuchos::RCP<Tpetra_CrsMatrix> W_op_out_crsT =
-      Teuchos::nonnull(W_op_outT) ?
+      Teuchos::nonnull(W_op_outT) && !jac_tangent_ ?
           Teuchos::rcp_dynamic_cast<Tpetra_CrsMatrix>(W_op_outT, true) :
           Teuchos::null;
+  const Teuchos::RCP<TangentOpT> W_op_out_tanT =
+      Teuchos::nonnull(W_op_outT) && jac_tangent_ ?
+          Teuchos::rcp_dynamic_cast<TangentOpT>(W_op_outT, true) :
+          Teuchos::null;
+  const Teuchos::RCP<Thyra::PreconditionerBase<ST>> W_prec_out_tan =
+      jac_tangent_ &&
+              outArgsT.supports(Thyra::ModelEvaluatorBase::OUT_ARG_W_prec) ?
+          outArgsT.get_W_prec() :
+          Teuchos::null;
 
 #ifdef WRITE_MASS_MATRIX_TO_MM_FILE
   // IK, 4/24/15: adding object to hold mass matrix to be written to matrix
@@ -790,7 +1022,8 @@ Albany::ModelEvaluatorT::evalModelImpl(
   bool f_already_computed = false;
 
   // W matrix
-  if (Teuchos::nonnull(W_op_out_crsT)) {
+  if (Teuchos::nonnull(W_op_out_crsT) &&
+      rebuildJacobian(*W_op_out_crsT, alpha, beta, omega, curr_time)) {
     app->computeGlobalJacobianT(
         alpha,
         beta,
@@ -827,6 +1060,39 @@ Albany::ModelEvaluatorT::evalModelImpl(
         "colmap.mm", *Mass_crs->getColMap());
 #endif
   }
+  // Matrix-free W: only the point it is applied at changes
+  if (Teuchos::nonnull(W_op_out_tanT)) {
+    W_op_out_tanT->setPoint(
+        alpha, beta, omega, curr_time, *xT, x_dotT.get(), x_dotdotT.get());
+  }
+  // Its preconditioner, on the assembled Jacobian, follows the reuse policy
+  if (Teuchos::nonnull(W_prec_out_tan) &&
+      rebuildJacobian(
+          *Extra_W_crs,
+          alpha,
+          beta,
+          omega,
+          curr_time,
+          W_prec_out_tan.get() != tangent_prec_)) {
+    app->computeGlobalJacobianT(
+        alpha,
+        beta,
+        omega,
+        curr_time,
+        x_dotT.get(),
+        x_dotdotT.get(),
+        *xT,
+        sacado_param_vec,
+        fT_out.get(),
+        *Extra_W_crs);
+    f_already_computed = true;
+
+    tangent_prec_factory_->initializePrec(
+        Thyra::defaultLinearOpSource<ST>(Thyra::createConstLinearOp(
+            Teuchos::RCP<const Tpetra_Operator>(Extra_W_crs))),
+        W_prec_out_tan.get());
+    tangent_prec_ = W_prec_out_tan.get();
+  }
   if (Teuchos::nonnull(WPrec_out)) {
     app->computeGlobalJacobianT(
         alpha,
@@ -914,46 +1180,68 @@ Albany::ModelEvaluatorT::evalModelImpl(
     }
   }
 
-  // Response functions
-  for (int j = 0; j < outArgsT.Ng(); ++j) {
-    const Teuchos::RCP<Thyra::VectorBase<ST>> g_out = outArgsT.get_g(j);
-    Teuchos::RCP<Tpetra_Vector>               gT_out =
-        Teuchos::nonnull(g_out) ? ConverterT::getTpetraVector(g_out) :
-                                  Teuchos::null;
-
-    const Thyra::ModelEvaluatorBase::Derivative<ST> dgdxT_out =
-        outArgsT.get_DgDx(j);
-    Thyra::ModelEvaluatorBase::Derivative<ST> dgdxdotT_out;
-
-    if (supports_xdot) dgdxdotT_out = outArgsT.get_DgDx_dot(j);
-
-    //    const Thyra::ModelEvaluatorBase::Derivative<ST> dgdxdotdotT_out =
-    //    this->get_DgDx_dotdot(j);
-    const Thyra::ModelEvaluatorBase::Derivative<ST> dgdxdotdotT_out;
-
-    sanitize_nans(dgdxT_out);
-    sanitize_nans(dgdxdotT_out);
-    sanitize_nans(dgdxdotdotT_out);
-
-    // dg/dx, dg/dxdot
-    if (!dgdxT_out.isEmpty() || !dgdxdotT_out.isEmpty()) {
-      const Thyra::ModelEvaluatorBase::Derivative<ST> dummy_derivT;
-      app->evaluateResponseDerivativeT(
-          j,
+  // Residual norm for the stall trigger of the Jacobian reuse policy
+  if (jac_stall_ratio_ > 0.0 && Teuchos::nonnull(fT_out)) {
+    f_norm_ = fT_out->norm2();
+  }
+
+  // dg/dx, dg/dxdot of all the responses that request them, in one call so
+  // that their sweeps can be shared
+  const int num_responses = outArgsT.Ng();
+  Teuchos::Array<Teuchos::RCP<Tpetra_Vector>> gT_outs(num_responses);
+  {
+    Teuchos::Array<int>                                       indices;
+    Teuchos::Array<Tpetra_Vector*>                            gTs;
+    Teuchos::Array<Thyra::ModelEvaluatorBase::Derivative<ST>> dgdxTs,
+        dgdxdotTs, dgdxdotdotTs;
+    for (int j = 0; j < num_responses; ++j) {
+      const Teuchos::RCP<Thyra::VectorBase<ST>> g_out = outArgsT.get_g(j);
+      gT_outs[j] = Teuchos::nonnull(g_out) ?
+                       ConverterT::getTpetraVector(g_out) :
+                       Teuchos::null;
+
+      const Thyra::ModelEvaluatorBase::Derivative<ST> dgdxT_out =
+          outArgsT.get_DgDx(j);
+      Thyra::ModelEvaluatorBase::Derivative<ST> dgdxdotT_out;
+
+      if (supports_xdot) dgdxdotT_out = outArgsT.get_DgDx_dot(j);
+
+      //    const Thyra::ModelEvaluatorBase::Derivative<ST> dgdxdotdotT_out =
+      //    this->get_DgDx_dotdot(j);
+      const Thyra::ModelEvaluatorBase::Derivative<ST> dgdxdotdotT_out;
+
+      sanitize_nans(dgdxT_out);
+      sanitize_nans(dgdxdotT_out);
+      sanitize_nans(dgdxdotdotT_out);
+
+      if (!dgdxT_out.isEmpty() || !dgdxdotT_out.isEmpty()) {
+        indices.push_back(j);
+        gTs.push_back(gT_outs[j].get());
+        dgdxTs.push_back(dgdxT_out);
+        dgdxdotTs.push_back(dgdxdotT_out);
+        dgdxdotdotTs.push_back(dgdxdotdotT_out);
+        // Set gT_out to null to indicate that g_out was evaluated.
+        gT_outs[j] = Teuchos::null;
+      }
+    }
+    if (!indices.empty()) {
+      app->evaluateResponsesDerivativeT(
+          indices,
           curr_time,
           x_dotT.get(),
           x_dotdotT.get(),
           *xT,
           sacado_param_vec,
-          NULL,
-          gT_out.get(),
-          dgdxT_out,
-          dgdxdotT_out,
-          dgdxdotdotT_out,
-          dummy_derivT);
-      // Set gT_out to null to indicate that g_out was evaluated.
-      gT_out = Teuchos::null;
+          gTs,
+          dgdxTs,
+          dgdxdotTs,
+          dgdxdotdotTs);
     }
+  }
+
+  // Response functions
+  for (int j = 0; j < num_responses; ++j) {
+    Teuchos::RCP<Tpetra_Vector> gT_out = gT_outs[j];
 
     // dg/dp
     for (int l = 0; l < num_param_vecs; ++l) {
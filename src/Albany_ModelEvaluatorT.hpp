@@ -14,6 +14,7 @@
 #include "Albany_Application.hpp"
 
 #include "Teuchos_TimeMonitor.hpp"
+#include "Thyra_PreconditionerFactoryBase.hpp"
 
 namespace Albany {
 
@@ -182,6 +183,43 @@ class ModelEvaluatorT
   //! Model uses time integration (accelerations)
   bool supports_xdotdot;
 
+  //! True if the Jacobian in W has to be filled at this evaluation, false
+  //! if the policy of the "Jacobian Reuse" sublist lets it be reused
+  bool
+  rebuildJacobian(
+      const Tpetra_CrsMatrix& W,
+      ST const                alpha,
+      ST const                beta,
+      ST const                omega,
+      ST const                curr_time,
+      bool const              force = false) const;
+
+  //! W is applied matrix-free with the Tangent evaluation type
+  //! ("Jacobian Operator" = "Tangent"), and preconditioned with Ifpack2 on
+  //! the assembled Jacobian in Extra_W_crs
+  bool jac_tangent_{false};
+  Teuchos::RCP<Thyra::PreconditionerFactoryBase<ST>> tangent_prec_factory_;
+  mutable const Thyra::PreconditionerBase<ST>* tangent_prec_{NULL};
+
+  //! Jacobian reuse policy: fill after this many Jacobian requests (0 = no
+  //! iteration trigger), at every n-th new time (0 = no step trigger), and
+  //! when the residual norm ratio between requests exceeds the stall ratio
+  //! (0 = no stall trigger)
+  int jac_iteration_interval_{1};
+  int jac_step_interval_{0};
+  ST  jac_stall_ratio_{0.0};
+
+  //! State of the Jacobian reuse policy
+  mutable const Tpetra_CrsMatrix* jac_filled_{NULL};
+  mutable int jac_requests_{0};
+  mutable int jac_steps_{0};
+  mutable ST  jac_alpha_{0.0};
+  mutable ST  jac_beta_{0.0};
+  mutable ST  jac_omega_{0.0};
+  mutable ST  jac_time_{0.0};
+  mutable ST  f_norm_{0.0};
+  mutable ST  jac_f_norm_{0.0};
+
 #if defined(ALBANY_LCM)
   // This is here to have a sane way to handle time and avoid Thyra ME.
   ST
@@ -6,9 +6,56 @@
 #include "Albany_Networks.hpp"
 #include "Stokhos_EpetraOperatorOrthogPoly.hpp"
 
+#include <vector>
+
 //IK, 9/12/14: right now this is Epetra (Albany) function.
 //Not compiled if ALBANY_EPETRA_EXE is off.
 
+namespace {
+
+// Block rows 1 and 2 of the network Jacobian: the response derivatives of
+// both models, one ReplaceGlobalValues call per row
+void fillResponseRows(Epetra_CrsMatrix& W_crs,
+                      const Epetra_MultiVector& dgdp0,
+                      const Epetra_MultiVector& dgdp1,
+                      const int n)
+{
+  std::vector<int> cols(4*n);
+  std::vector<double> vals(4*n);
+  for (int j=0; j<4*n; j++)
+    cols[j] = j;
+
+  for (int k=0; k<2; k++) {
+    // Row k*n+i couples g[0] at entry i+(1-k)*n with g[1] at entry i+k*n
+    const int off0 = (1-k)*n;
+    const int off1 = k*n;
+    for (int i=0; i<n; i++) {
+      for (int j=0; j<2*n; j++) {
+	vals[j]     =  dgdp0[j][i+off0];
+	vals[2*n+j] = -dgdp1[j][i+off1];
+      }
+      W_crs.ReplaceGlobalValues(k*n+i, 4*n, &vals[0], &cols[0]);
+    }
+  }
+}
+
+// Block rows 3 and 4: the parameter matching equations
+void fillParameterRows(Epetra_CrsMatrix& W_crs, const int n)
+{
+  const double vals[2] = {1.0, 1.0};
+  int cols[2];
+  for (int i=0; i<n; i++) {
+    cols[0] = n+i;
+    cols[1] = 2*n+i;
+    W_crs.ReplaceGlobalValues(2*n+i, 2, vals, cols);
+    cols[0] = i;
+    cols[1] = 3*n+i;
+    W_crs.ReplaceGlobalValues(3*n+i, 2, vals, cols);
+  }
+}
+
+}
+
 void 
 Albany::ReactorNetworkModel::
 evalModel(
@@ -51,115 +98,8 @@ evalModel(
     Teuchos::RCP<Epetra_CrsMatrix> W_crs = 
       Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(W, true);
     W_crs->PutScalar(0.0);
-    int row, col;
-    double val;
-
-    // Block row 1
-    for (int i=0; i<n; i++) {
-      row = i; 
-	  
-      // (1,1) block
-      for (int j=0; j<n; j++) {
-	col = j; 
-	val = (*dgdp[0])[j][i+n];
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-      }
-
-      // (1,2) block
-      for (int j=0; j<n; j++) {
-	col = n+j; 
-	val = (*dgdp[0])[j+n][i+n];
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-      }
-
-      // (1,3) block
-      for (int j=0; j<n; j++) {
-	col = 2*n+j; 
-	val = -(*dgdp[1])[j][i];
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-      }
-
-      // (1,4) block
-      for (int j=0; j<n; j++) {
-	col = 3*n+j; 
-	val = -(*dgdp[1])[j+n][i];
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-      }
-
-    }
-
-    // Block row 2
-    for (int i=0; i<n; i++) {
-      row = n+i; 
-	  
-      // (1,1) block
-      for (int j=0; j<n; j++) {
-	col = j; 
-	val = (*dgdp[0])[j][i];
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-      }
-
-      // (1,2) block
-      for (int j=0; j<n; j++) {
-	col = n+j; 
-	val = (*dgdp[0])[j+n][i];
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-      }
-
-      // (1,3) block
-      for (int j=0; j<n; j++) {
-	col = 2*n+j; 
-	val = -(*dgdp[1])[j][i+n];
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-      }
-
-      // (1,4) block
-      for (int j=0; j<n; j++) {
-	col = 3*n+j; 
-	val = -(*dgdp[1])[j+n][i+n];
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-      }
-
-    }
-
-    // Block row 3
-    for (int i=0; i<n; i++) {
-      row = 2*n+i; 
-	  
-      // (3,1) block -- zero
-
-      // (3,2) block
-      col = n+i; 
-      val = 1.0;
-      W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-
-      // (3,3) block
-      col = 2*n+i; 
-      val = 1.0;
-      W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-
-      // (3,4) block -- zero
-    }
-
-    // Block row 4
-    for (int i=0; i<n; i++) {
-      row = 3*n+i; 
-	  
-      // (4,1) block
-      col = 0+i; 
-      val = 1.0;
-      W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-
-      // (4,2) block -- zero
-
-      // (4,3) block -- zero
-
-      // (4,4) block
-      col = 3*n+i; 
-      val = 1.0;
-      W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-    }
-
+    fillResponseRows(*W_crs, *dgdp[0], *dgdp[1], n);
+    fillParameterRows(*W_crs, n);
     // W_crs->Print(std::cout << "W_crs =" << std::endl);
   }
       
@@ -189,127 +129,19 @@ evalModel(
     if (W_sg != Teuchos::null) {
       // std::cout << "dgdp_sg[0] = " << std::endl << *(dgdp_sg[0]) << std::endl;
       // std::cout << "dgdp_sg[1] = " << std::endl << *(dgdp_sg[1]) << std::endl;
-      int row, col;
-      double val;
       for (int block=0; block<W_sg->size(); block++) {
 	Teuchos::RCP<Epetra_CrsMatrix> W_crs = 
 	  Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(
 	    W_sg->getCoeffPtr(block), true);
 	    
 	W_crs->PutScalar(0.0);
-	    
-	// Block row 1
-	for (int i=0; i<n; i++) {
-	  row = i; 
-	  
-	  // (1,1) block
-	  for (int j=0; j<n; j++) {
-	    col = j; 
-	    val = (*dgdp_sg[0])[block][j][i+n];
-	    W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-	  }
-	      
-	  // (1,2) block
-	  for (int j=0; j<n; j++) {
-	    col = n+j; 
-	    val = (*dgdp_sg[0])[block][j+n][i+n];
-	    W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-	  }
-	      
-	  // (1,3) block
-	  for (int j=0; j<n; j++) {
-	    col = 2*n+j; 
-	    val = -(*dgdp_sg[1])[block][j][i];
-	    W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-	  }
-
-	  // (1,4) block
-	  for (int j=0; j<n; j++) {
-	    col = 3*n+j; 
-	    val = -(*dgdp_sg[1])[block][j+n][i];
-	    W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-	  }
-
-	}
-
-	// Block row 2
-	for (int i=0; i<n; i++) {
-	  row = n+i; 
-	      
-	  // (1,1) block
-	  for (int j=0; j<n; j++) {
-	    col = j; 
-	    val = (*dgdp_sg[0])[block][j][i];
-	    W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-	  }
-	      
-	  // (1,2) block
-	  for (int j=0; j<n; j++) {
-	    col = n+j; 
-	    val = (*dgdp_sg[0])[block][j+n][i];
-	    W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-	  }
-	      
-	  // (1,3) block
-	  for (int j=0; j<n; j++) {
-	    col = 2*n+j; 
-	    val = -(*dgdp_sg[1])[block][j][i+n];
-	    W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-	  }
-	      
-	  // (1,4) block
-	  for (int j=0; j<n; j++) {
-	    col = 3*n+j; 
-	    val = -(*dgdp_sg[1])[block][j+n][i+n];
-	    W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-	  }
-	      
-	}
-
+	fillResponseRows(*W_crs, (*dgdp_sg[0])[block], (*dgdp_sg[1])[block], n);
       }
 
       // Rows 3 and 4, only the mean block
-      Teuchos::RCP<Epetra_CrsMatrix> W_crs = 
-	Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(
-	  W_sg->getCoeffPtr(0), true);
-
-      // Block row 3
-      for (int i=0; i<n; i++) {
-	row = 2*n+i; 
-	  
-	// (3,1) block -- zero
-
-	// (3,2) block
-	col = n+i; 
-	val = 1.0;
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-	    
-	// (3,3) block
-	col = 2*n+i; 
-	val = 1.0;
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-	    
-	// (3,4) block -- zero
-      }
-	  
-      // Block row 4
-      for (int i=0; i<n; i++) {
-	row = 3*n+i; 
-	    
-	// (4,1) block
-	col = 0+i; 
-	val = 1.0;
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-	    
-	// (4,2) block -- zero
-	    
-	// (4,3) block -- zero
-	    
-	// (4,4) block
-	col = 3*n+i; 
-	val = 1.0;
-	W_crs->ReplaceGlobalValues(row, 1, &val, &col);
-      }
+      fillParameterRows(
+	*Teuchos::rcp_dynamic_cast<Epetra_CrsMatrix>(
+	  W_sg->getCoeffPtr(0), true), n);
 
       //std::cout << "W_sg = " << *W_sg << std::endl;
     }
@@ -297,6 +297,33 @@ setCoordinates(const Teuchos::RCP<Tpetra_MultiVector> &coordMV_)
   }
 }
 
+void RigidBodyModes::
+setSemiCoarsening(const int numLayers, const bool columnOrdering)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    !isMueLuUsed() || plist->isSublist("Factories"),
+    std::logic_error,
+    "Semi-coarsening of extruded meshes needs a simplified MueLu input deck.");
+
+  // Coarsen the vertical lines down to a single layer of nodes
+  const int rate = plist->get("semicoarsen: coarsen rate", 3);
+  int numLevels = 0;
+  for (int layers = numLayers + 1; layers > 1; layers = (layers + rate - 1) / rate)
+    ++numLevels;
+
+  if (!plist->isParameter("semicoarsen: number of levels"))
+    plist->set("semicoarsen: number of levels", numLevels);
+  // A vertical line has numLayers+1 nodes. They are contiguous with the
+  // columnwise ordering; otherwise the lines are found from the coordinates.
+  if (!plist->isParameter("linedetection: num layers"))
+    plist->set("linedetection: num layers", numLayers + 1);
+  if (!plist->isParameter("linedetection: orientation"))
+    plist->set("linedetection: orientation",
+               std::string(columnOrdering ? "vertical" : "coordinates"));
+  if (!plist->isParameter("smoother: type"))
+    plist->set("smoother: type", "LINESMOOTHING_BANDEDRELAXATION");
+}
+
 void RigidBodyModes::
 setCoordinatesAndNullspace(const Teuchos::RCP<Tpetra_MultiVector> &coordMV,
                            const Teuchos::RCP<const Tpetra_Map>& soln_map)
@@ -100,6 +100,10 @@ public:
   //! Pass only the coordinates.
   void setCoordinates(const Teuchos::RCP<Tpetra_MultiVector> &coordMV);
 
+  //! Enable MueLu semi-coarsening and line smoothing for a mesh extruded
+  //! with numLayers layers. Parameters already in the MueLu list are kept.
+  void setSemiCoarsening(const int numLayers, const bool columnOrdering);
+
 private:
   int numPDEs, numElasticityDim, numScalar, nullSpaceDim;
   bool mlUsed, mueLuUsed, setNonElastRBM;
@@ -0,0 +1,320 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include "Albany_ProbeOutput.hpp"
+
+#include "Albany_AbstractDiscretization.hpp"
+#include "Albany_Application.hpp"
+#include "Albany_ProblemUtils.hpp"
+
+#include "Intrepid2_CellTools.hpp"
+#include "Shards_CellTopology.hpp"
+#include "Teuchos_CommHelpers.hpp"
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_VerboseObject.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+
+namespace Albany {
+
+ProbeOutput::
+ProbeOutput (const Teuchos::RCP<Application>& app,
+             const Teuchos::ParameterList& params)
+  : app_(app),
+    filename_(params.get<std::string>("Output File Name", "probes.bin")),
+    bufferSteps_(params.get<int>("Buffer Steps", 100)),
+    tolerance_(params.get<double>("Tolerance", 1.0e-6)),
+    numDim_(0), numComponents_(0), numProbes_(0), located_(false),
+    bufferedSteps_(0)
+{
+  const Teuchos::Array<double> coords =
+    params.get<Teuchos::Array<double> >("Coordinates");
+  coordinates_.assign(coords.begin(), coords.end());
+  TEUCHOS_TEST_FOR_EXCEPTION(bufferSteps_ < 1, std::logic_error,
+                             "Probe Output: Buffer Steps must be positive\n");
+}
+
+ProbeOutput::~ProbeOutput ()
+{
+  flush();
+}
+
+Teuchos::RCP<ProbeOutput>
+ProbeOutput::create (const Teuchos::RCP<Application>& app)
+{
+  const Teuchos::RCP<const Teuchos::ParameterList> appParams = app->getAppPL();
+  if (appParams.is_null() || !appParams->isSublist("Discretization"))
+    return Teuchos::null;
+  const Teuchos::ParameterList& discParams =
+    appParams->sublist("Discretization");
+  if (!discParams.isSublist("Probe Output"))
+    return Teuchos::null;
+  return Teuchos::rcp(new ProbeOutput(app, discParams.sublist("Probe Output")));
+}
+
+void ProbeOutput::locate ()
+{
+  const Teuchos::RCP<AbstractDiscretization> disc = app_->getDiscretization();
+  const Teuchos::RCP<const Teuchos_Comm> comm = app_->getComm();
+  const int rank = comm->getRank(), numRanks = comm->getSize();
+
+  numDim_ = disc->getNumDim();
+  numComponents_ = disc->getNumEq();
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    coordinates_.size() % numDim_ != 0, std::logic_error,
+    "Probe Output: the number of Coordinates is not a multiple of the "
+    "dimension " << numDim_ << "\n");
+  numProbes_ = coordinates_.size() / numDim_;
+
+  // Uniform grid over the bounding box of the probes, with about one probe
+  // per bin, so that each element only tests the probes near it
+  std::vector<double> lo(numDim_), hi(numDim_);
+  for (int d = 0; d < numDim_; ++d) {
+    lo[d] = std::numeric_limits<double>::max();
+    hi[d] = -std::numeric_limits<double>::max();
+  }
+  for (int p = 0; p < numProbes_; ++p)
+    for (int d = 0; d < numDim_; ++d) {
+      lo[d] = std::min(lo[d], coordinates_[numDim_*p + d]);
+      hi[d] = std::max(hi[d], coordinates_[numDim_*p + d]);
+    }
+  const int binsPerDim = std::max(1, static_cast<int>(std::ceil(
+    std::pow(static_cast<double>(numProbes_), 1.0 / numDim_))));
+  std::vector<double> binSize(numDim_);
+  for (int d = 0; d < numDim_; ++d)
+    binSize[d] = std::max((hi[d] - lo[d]) / binsPerDim,
+                          std::numeric_limits<double>::min());
+  const auto binIndex = [&](int d, double x) {
+    return std::min(binsPerDim - 1,
+                    std::max(0, static_cast<int>((x - lo[d]) / binSize[d])));
+  };
+  int numBins = 1;
+  for (int d = 0; d < numDim_; ++d) numBins *= binsPerDim;
+  std::vector<std::vector<int> > bins(numBins);
+  for (int p = 0; p < numProbes_; ++p) {
+    int bin = 0;
+    for (int d = numDim_ - 1; d >= 0; --d)
+      bin = bin * binsPerDim + binIndex(d, coordinates_[numDim_*p + d]);
+    bins[bin].push_back(p);
+  }
+
+  const Teuchos::ArrayRCP<double>& coords = disc->getCoordinates();
+  const Teuchos::RCP<const Tpetra_Map> overlapNodeMapT =
+    disc->getOverlapNodeMapT();
+  const auto& wsElNodeID = disc->getWsElNodeID();
+  const auto& wsElNodeEqID = disc->getWsElNodeEqID();
+  const auto& wsEBNames = disc->getWsEBNames();
+
+  std::map<std::string, const MeshSpecsStruct*> meshSpecs;
+  for (auto ms : disc->getMeshStruct()->getMeshSpecs())
+    meshSpecs[ms->ebName] = ms.get();
+
+  std::vector<bool> found(numProbes_, false);
+  std::vector<double> elemLo(numDim_), elemHi(numDim_);
+  for (int ws = 0; ws < wsElNodeID.size(); ++ws) {
+    const auto it = meshSpecs.find(wsEBNames[ws]);
+    TEUCHOS_TEST_FOR_EXCEPTION(it == meshSpecs.end(), std::logic_error,
+                               "Probe Output: no mesh specs for element block "
+                               << wsEBNames[ws] << "\n");
+    const shards::CellTopology cellTopology(&it->second->ctd);
+    const Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> >
+      basis = getIntrepid2Basis(it->second->ctd);
+    const int numNodes = it->second->ctd.node_count;
+
+    Kokkos::DynRankView<RealType, PHX::Device>
+      physPoint("physPoint", 1, 1, numDim_),
+      refPoint("refPoint", 1, 1, numDim_),
+      cellNodes("cellNodes", 1, numNodes, numDim_),
+      point("point", numDim_),
+      refPointReduced("refPoint", 1, numDim_),
+      basisValues("basisValues", basis->getCardinality(), 1);
+    const auto nodeEqID = Kokkos::create_mirror_view(wsElNodeEqID[ws]);
+    Kokkos::deep_copy(nodeEqID, wsElNodeEqID[ws]);
+
+    for (int e = 0; e < wsElNodeID[ws].size(); ++e) {
+      for (int n = 0; n < numNodes; ++n) {
+        const LO lid = overlapNodeMapT->getLocalElement(wsElNodeID[ws][e][n]);
+        for (int d = 0; d < numDim_; ++d) {
+          // Coordinates are stored with a stride of 3 regardless of numDim
+          const double x = coords[3*lid + d];
+          cellNodes(0, n, d) = x;
+          elemLo[d] = n == 0 ? x : std::min(elemLo[d], x);
+          elemHi[d] = n == 0 ? x : std::max(elemHi[d], x);
+        }
+      }
+
+      bool overlaps = true;
+      std::vector<int> binLo(numDim_), binHi(numDim_);
+      for (int d = 0; d < numDim_; ++d) {
+        const double pad = tolerance_ * (elemHi[d] - elemLo[d]);
+        elemLo[d] -= pad;
+        elemHi[d] += pad;
+        overlaps = overlaps && elemLo[d] <= hi[d] && elemHi[d] >= lo[d];
+        binLo[d] = binIndex(d, elemLo[d]);
+        binHi[d] = binIndex(d, elemHi[d]);
+      }
+      if (!overlaps) continue;
+
+      // Visit the bins covered by the element bounding box
+      std::vector<int> b(binLo);
+      while (true) {
+        int bin = 0;
+        for (int d = numDim_ - 1; d >= 0; --d)
+          bin = bin * binsPerDim + b[d];
+
+        for (const int p : bins[bin]) {
+          if (found[p]) continue;
+          bool inBox = true;
+          for (int d = 0; d < numDim_; ++d) {
+            const double x = coordinates_[numDim_*p + d];
+            inBox = inBox && elemLo[d] <= x && x <= elemHi[d];
+            physPoint(0, 0, d) = x;
+          }
+          if (!inBox) continue;
+
+          Intrepid2::CellTools<PHX::Device>::mapToReferenceFrame(
+            refPoint, physPoint, cellNodes, cellTopology);
+          for (int d = 0; d < numDim_; ++d) {
+            point(d) = refPoint(0, 0, d);
+            refPointReduced(0, d) = refPoint(0, 0, d);
+          }
+          if (!Intrepid2::CellTools<PHX::Device>::checkPointInclusion(
+                point, cellTopology, tolerance_))
+            continue;
+
+          found[p] = true;
+          basis->getValues(basisValues, refPointReduced,
+                           Intrepid2::OPERATOR_VALUE);
+          Location location;
+          location.probe = p;
+          location.basisValues.resize(numNodes);
+          location.dofs.resize(numNodes * numComponents_);
+          for (int n = 0; n < numNodes; ++n) {
+            location.basisValues[n] = basisValues(n, 0);
+            for (int c = 0; c < numComponents_; ++c)
+              location.dofs[n*numComponents_ + c] = nodeEqID(e, n, c);
+          }
+          locations_.push_back(location);
+        }
+
+        int d = 0;
+        while (d < numDim_ && ++b[d] > binHi[d]) {
+          b[d] = binLo[d];
+          ++d;
+        }
+        if (d == numDim_) break;
+      }
+    }
+  }
+
+  // A probe on an element boundary may be found by several ranks: the
+  // lowest rank keeps it
+  std::vector<int> myOwner(numProbes_, numRanks), owner(numProbes_);
+  for (const Location& location : locations_)
+    myOwner[location.probe] = rank;
+  if (numProbes_ > 0)
+    Teuchos::reduceAll<int, int>(*comm, Teuchos::REDUCE_MIN, numProbes_,
+                                 myOwner.data(), owner.data());
+  locations_.erase(
+    std::remove_if(locations_.begin(), locations_.end(),
+                   [&](const Location& location) {
+                     return owner[location.probe] != rank;
+                   }),
+    locations_.end());
+
+  int numMissing = 0;
+  for (int p = 0; p < numProbes_; ++p)
+    if (owner[p] == numRanks) ++numMissing;
+  if (numMissing > 0 && rank == 0)
+    *Teuchos::VerboseObjectBase::getDefaultOStream()
+      << "Probe Output: " << numMissing
+      << " probes are outside of the mesh and are written as NaN\n";
+
+  // Import from the owners of the probes to rank 0
+  Teuchos::Array<Tpetra_GO> myGIDs;
+  for (const Location& location : locations_)
+    for (int c = 0; c < numComponents_; ++c)
+      myGIDs.push_back(static_cast<Tpetra_GO>(location.probe) * numComponents_ + c);
+  Teuchos::Array<Tpetra_GO> rootGIDs;
+  if (rank == 0)
+    for (Tpetra_GO i = 0; i < static_cast<Tpetra_GO>(numProbes_) * numComponents_; ++i)
+      rootGIDs.push_back(i);
+  const Teuchos::RCP<const Tpetra_Map> localMapT =
+    Tpetra::createNonContigMapWithNode<LO, Tpetra_GO, KokkosNode>(
+      myGIDs, comm, app_->getMapT()->getNode());
+  const Teuchos::RCP<const Tpetra_Map> rootMapT =
+    Tpetra::createNonContigMapWithNode<LO, Tpetra_GO, KokkosNode>(
+      rootGIDs, comm, app_->getMapT()->getNode());
+  localValuesT_ = Teuchos::rcp(new Tpetra_Vector(localMapT));
+  gatheredValuesT_ = Teuchos::rcp(new Tpetra_Vector(rootMapT));
+  importerT_ = Teuchos::rcp(new Tpetra_Import(localMapT, rootMapT));
+
+  if (rank == 0) {
+    out_.open(filename_.c_str(), std::ios::out | std::ios::binary);
+    TEUCHOS_TEST_FOR_EXCEPTION(!out_, std::runtime_error,
+                               "Probe Output: cannot open " << filename_ << "\n");
+    const std::int32_t version = 1, numDim = numDim_,
+                       numComponents = numComponents_;
+    const std::int64_t numProbes = numProbes_;
+    out_.write("ALBPROBE", 8);
+    out_.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    out_.write(reinterpret_cast<const char*>(&numDim), sizeof(numDim));
+    out_.write(reinterpret_cast<const char*>(&numComponents),
+               sizeof(numComponents));
+    out_.write(reinterpret_cast<const char*>(&numProbes), sizeof(numProbes));
+    out_.write(reinterpret_cast<const char*>(coordinates_.data()),
+               coordinates_.size() * sizeof(double));
+    buffer_.reserve(bufferSteps_ * (1 + numProbes_ * numComponents_));
+  }
+
+  located_ = true;
+}
+
+void ProbeOutput::writeStep (double time, const Tpetra_Vector& overlappedSolutionT)
+{
+  if (!located_) locate();
+
+  {
+    const Teuchos::ArrayRCP<const ST> x = overlappedSolutionT.get1dView();
+    const Teuchos::ArrayRCP<ST> values = localValuesT_->get1dViewNonConst();
+    for (std::size_t i = 0; i < locations_.size(); ++i) {
+      const Location& location = locations_[i];
+      for (int c = 0; c < numComponents_; ++c) {
+        ST value = 0.0;
+        for (std::size_t n = 0; n < location.basisValues.size(); ++n)
+          value += location.basisValues[n] * x[location.dofs[n*numComponents_ + c]];
+        values[i*numComponents_ + c] = value;
+      }
+    }
+  }
+
+  // Probes outside of the mesh have no source and keep the NaN
+  gatheredValuesT_->putScalar(std::numeric_limits<ST>::quiet_NaN());
+  gatheredValuesT_->doImport(*localValuesT_, *importerT_, Tpetra::INSERT);
+
+  if (app_->getComm()->getRank() != 0) return;
+
+  const Teuchos::ArrayRCP<const ST> gathered = gatheredValuesT_->get1dView();
+  buffer_.push_back(time);
+  buffer_.insert(buffer_.end(), gathered.getRawPtr(),
+                 gathered.getRawPtr() + gathered.size());
+  if (++bufferedSteps_ >= bufferSteps_) flush();
+}
+
+void ProbeOutput::flush ()
+{
+  if (!out_.is_open() || buffer_.empty()) return;
+  out_.write(reinterpret_cast<const char*>(buffer_.data()),
+             buffer_.size() * sizeof(double));
+  out_.flush();
+  buffer_.clear();
+  bufferedSteps_ = 0;
+}
+
+} // namespace Albany
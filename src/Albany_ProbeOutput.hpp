@@ -0,0 +1,96 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#ifndef ALBANY_PROBEOUTPUT_HPP
+#define ALBANY_PROBEOUTPUT_HPP
+
+#include "Albany_DataTypes.hpp"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Albany {
+
+class Application;
+
+/*! \brief Time series of the solution at fixed probe points.
+ *
+ * Configured by the "Probe Output" sublist of the "Discretization" list:
+ *   - "Coordinates" (Array(double)): numDim coordinates per probe
+ *   - "Output File Name" (string, default "probes.bin")
+ *   - "Buffer Steps" (int, default 100): steps kept in memory between writes
+ *   - "Tolerance" (double, default 1e-6): slack of the reference element
+ *     inclusion test
+ *
+ * The probes are located once, at the first step, in the elements of the
+ * owning ranks, and the basis values at their parametric coordinates are
+ * cached. Each step then interpolates the located probes and gathers them
+ * on rank 0 with one precomputed import, so that the cost per step depends
+ * on the number of probes and not on the size of the mesh.
+ *
+ * Rank 0 writes a native-endian binary stream. The header is the characters
+ * "ALBPROBE", then int32 version (1), int32 numDim, int32 numComponents,
+ * int64 numProbes and the numProbes x numDim probe coordinates as doubles.
+ * Each step follows as a double time and numProbes x numComponents doubles,
+ * probe major. Probes outside of the mesh are written as NaN.
+ */
+class ProbeOutput {
+public:
+  ProbeOutput(const Teuchos::RCP<Application>& app,
+              const Teuchos::ParameterList& params);
+
+  //! Writes the buffered steps
+  ~ProbeOutput();
+
+  //! Create the probe output if the discretization parameters ask for it
+  static Teuchos::RCP<ProbeOutput> create(const Teuchos::RCP<Application>& app);
+
+  //! Interpolate the overlapped solution at the probes and buffer the step
+  void writeStep(double time, const Tpetra_Vector& overlappedSolutionT);
+
+private:
+  ProbeOutput(const ProbeOutput&);
+  ProbeOutput& operator=(const ProbeOutput&);
+
+  //! Probe located in an element of this rank
+  struct Location {
+    int probe;
+    //! Overlapped solution LIDs, node major
+    std::vector<LO> dofs;
+    std::vector<RealType> basisValues;
+  };
+
+  void locate();
+  void flush();
+
+  Teuchos::RCP<Application> app_;
+  std::string filename_;
+  int bufferSteps_;
+  double tolerance_;
+  std::vector<double> coordinates_;
+
+  int numDim_;
+  int numComponents_;
+  int numProbes_;
+  bool located_;
+
+  std::vector<Location> locations_;
+  Teuchos::RCP<Tpetra_Vector> localValuesT_;
+  Teuchos::RCP<Tpetra_Vector> gatheredValuesT_;
+  Teuchos::RCP<Tpetra_Import> importerT_;
+
+  //! Steps not yet written, rank 0 only
+  std::vector<double> buffer_;
+  int bufferedSteps_;
+  std::ofstream out_;
+};
+
+} // namespace Albany
+
+#endif // ALBANY_PROBEOUTPUT_HPP
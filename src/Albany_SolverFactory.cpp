@@ -29,6 +29,7 @@
 #ifdef ALBANY_IFPACK2
 #include "Teuchos_AbstractFactoryStd.hpp"
 #include "Thyra_Ifpack2PreconditionerFactory.hpp"
+#include "Albany_MixedPrecisionPreconditioner.hpp"
 #endif /* ALBANY_IFPACK2 */
 
 #ifdef ALBANY_MUELU
@@ -190,16 +191,8 @@ Albany::SolverFactory::SolverFactory(
   // RCP<ParameterList> input_
   appParams = Teuchos::createParameterList("Albany Parameters");
 
-  std::string const
-  input_extension = getFileExtension(inputFile);
-
-  if (input_extension == "yaml" || input_extension == "yml") {
-    Teuchos::updateParametersFromYamlFileAndBroadcast(
-        inputFile, appParams.ptr(), *tcomm);
-  } else {
-    Teuchos::updateParametersFromXmlFileAndBroadcast(
-        inputFile, appParams.ptr(), *tcomm);
-  }
+  // Large tables can be kept in binary side files, see resolveExternalArrays
+  updateParametersFromInputFile(inputFile, *appParams, *tcomm);
 
   // do not set default solver parameters for QCAD::Solver or ATO::Solver
   // problems,
@@ -547,6 +540,13 @@ enableIfpack2(Stratimikos::DefaultLinearSolverBuilder& linearSolverBuilder) {
   linearSolverBuilder.setPreconditioningStrategyFactory(
       Teuchos::abstractFactoryStd<Base, Impl>(), "Ifpack2");
 #endif
+#ifdef ALBANY_MIXED_PRECISION_PREC
+  linearSolverBuilder.setPreconditioningStrategyFactory(
+      Teuchos::abstractFactoryStd<
+          Thyra::PreconditionerFactoryBase<ST>,
+          Albany::MixedPrecisionPreconditionerFactory>(),
+      "Mixed Precision");
+#endif
 }
 
 void
@@ -1375,6 +1375,8 @@ Albany::SolverFactory::getValidAppParameters() const {
   validPL->sublist("Piro", false, "Piro sublist");
   validPL->sublist("Coupled System", false, "Coupled system sublist");
   validPL->sublist("Alternating System", false, "Alternating system sublist");
+  validPL->sublist("MPAS Interface", false, "MPAS interface sublist");
+  validPL->sublist("CISM Interface", false, "CISM interface sublist");
 
   // validPL->set<std::string>("Jacobian Operator", "Have Jacobian", "Flag to
   // allow Matrix-Free specification in Piro");
@@ -4,6 +4,7 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 #include "Albany_StateManager.hpp"
+#include <algorithm>
 #include "Albany_Utils.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Teuchos_VerboseObject.hpp"
@@ -882,6 +883,39 @@ Albany::StateManager::setStateArrays(Albany::StateArrays& sa)
   return;
 }
 
+namespace {
+
+// The new and old arrays of a state have the same dimensions and are
+// contiguous, so each workset is copied as a single block. The arrays are
+// looked up once per workset instead of once per value.
+void
+copyNewToOldState(
+    Albany::StateArrayVec& sav,
+    std::string const&     stateName,
+    std::string const&     stateName_old)
+{
+  for (auto& sa : sav) {
+    auto const it = sa.find(stateName);
+    if (it == sa.end()) continue;
+
+    Albany::MDArray const& state = it->second;
+    if (state.size() == 0) continue;
+
+    auto const it_old = sa.find(stateName_old);
+    ALBANY_ASSERT(it_old != sa.end());
+
+    Albany::MDArray& state_old = it_old->second;
+    ALBANY_ASSERT(state_old.size() == state.size());
+
+    std::copy(
+        state.contiguous_data(),
+        state.contiguous_data() + state.size(),
+        state_old.contiguous_data());
+  }
+}
+
+}  // anonymous namespace
+
 void
 Albany::StateManager::updateStates()
 {
@@ -893,10 +927,8 @@ Albany::StateManager::updateStates()
   Albany::StateArrays&   sa              = disc->getStateArrays();
   Albany::StateArrayVec& esa             = sa.elemStateArrays;
   Albany::StateArrayVec& nsa             = sa.nodeStateArrays;
-  int                    numElemWorksets = esa.size();
-  int                    numNodeWorksets = nsa.size();
 
-  // For each workset, loop over registered states
+  // For each registered state, copy the new values into the old state
 
   for (unsigned int i = 0; i < stateInfo->size(); i++) {
     if ((*stateInfo)[i]->saveOldState) {
@@ -905,26 +937,20 @@ Albany::StateManager::updateStates()
 
       switch ((*stateInfo)[i]->entity) {
         case Albany::StateStruct::NodalDataToElemNode:
-          for (int ws = 0; ws < numNodeWorksets; ws++)
-            for (int j = 0; j < nsa[ws][stateName].size(); j++)
-              nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
+          copyNewToOldState(nsa, stateName, stateName_old);
 
         case Albany::StateStruct::WorksetValue:
         case Albany::StateStruct::ElemData:
         case Albany::StateStruct::QuadPoint:
         case Albany::StateStruct::ElemNode:
 
-          for (int ws = 0; ws < numElemWorksets; ws++)
-            for (int j = 0; j < esa[ws][stateName].size(); j++)
-              esa[ws][stateName_old][j] = esa[ws][stateName][j];
+          copyNewToOldState(esa, stateName, stateName_old);
 
           break;
 
         case Albany::StateStruct::NodalData:
 
-          for (int ws = 0; ws < numNodeWorksets; ws++)
-            for (int j = 0; j < nsa[ws][stateName].size(); j++)
-              nsa[ws][stateName_old][j] = nsa[ws][stateName][j];
+          copyNewToOldState(nsa, stateName, stateName_old);
 
           break;
 
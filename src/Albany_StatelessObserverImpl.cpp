@@ -19,7 +19,8 @@ namespace Albany {
 StatelessObserverImpl::
 StatelessObserverImpl (const Teuchos::RCP<Application> &app)
   : app_(app),
-  solOutTime_(Teuchos::TimeMonitor::getNewTimer("Albany: Output to File"))
+  solOutTime_(Teuchos::TimeMonitor::getNewTimer("Albany: Output to File")),
+  probeOutput_(ProbeOutput::create(app))
 {}
 
 RealType StatelessObserverImpl::
@@ -82,19 +83,8 @@ void StatelessObserverImpl::observeSolutionT (
   double stamp, const Tpetra_Vector &nonOverlappedSolutionT,
   const Teuchos::Ptr<const Tpetra_Vector>& nonOverlappedSolutionDotT)
 {
-  Teuchos::TimeMonitor timer(*solOutTime_);
-  const Teuchos::RCP<const Tpetra_Vector> overlappedSolutionT =
-    app_->getAdaptSolMgrT()->updateAndReturnOverlapSolutionT(nonOverlappedSolutionT);
-  if (nonOverlappedSolutionDotT != Teuchos::null) {
-    const Teuchos::RCP<const Tpetra_Vector> overlappedSolutionDotT =
-      app_->getAdaptSolMgrT()->updateAndReturnOverlapSolutionDotT(*nonOverlappedSolutionDotT);
-    app_->getDiscretization()->writeSolutionT(
-      *overlappedSolutionT, *overlappedSolutionDotT, stamp, /*overlapped =*/ true);
-  }
-  else {
-    app_->getDiscretization()->writeSolutionT(
-      *overlappedSolutionT, stamp, /*overlapped =*/ true);
-  }
+  StatelessObserverImpl::observeSolutionT(
+    stamp, nonOverlappedSolutionT, nonOverlappedSolutionDotT, Teuchos::null);
 }
 
 void StatelessObserverImpl::observeSolutionT (
@@ -103,14 +93,23 @@ void StatelessObserverImpl::observeSolutionT (
   const Teuchos::Ptr<const Tpetra_Vector>& nonOverlappedSolutionDotDotT)
 {
   Teuchos::TimeMonitor timer(*solOutTime_);
-  const Teuchos::RCP<const Tpetra_Vector> overlappedSolutionT =
-    app_->getAdaptSolMgrT()->updateAndReturnOverlapSolutionT(nonOverlappedSolutionT);
   if (nonOverlappedSolutionDotT != Teuchos::null) {
+    // Import the solution and its derivatives together
+    const Teuchos::RCP<AAdapt::AdaptiveSolutionManagerT> solMgrT =
+      app_->getAdaptSolMgrT();
+    solMgrT->scatterXT(nonOverlappedSolutionT, nonOverlappedSolutionDotT.get(),
+                       nonOverlappedSolutionDotDotT.get());
+    const Teuchos::RCP<const Tpetra_MultiVector> overlappedSolutionMV =
+      solMgrT->getOverlappedSolution();
+    const Teuchos::RCP<const Tpetra_Vector> overlappedSolutionT =
+      overlappedSolutionMV->getVector(0);
+    if (Teuchos::nonnull(probeOutput_))
+      probeOutput_->writeStep(stamp, *overlappedSolutionT);
     const Teuchos::RCP<const Tpetra_Vector> overlappedSolutionDotT =
-      app_->getAdaptSolMgrT()->updateAndReturnOverlapSolutionDotT(*nonOverlappedSolutionDotT);
+      overlappedSolutionMV->getVector(1);
     if (nonOverlappedSolutionDotDotT != Teuchos::null) {
       const Teuchos::RCP<const Tpetra_Vector> overlappedSolutionDotDotT =
-        app_->getAdaptSolMgrT()->updateAndReturnOverlapSolutionDotDotT(*nonOverlappedSolutionDotDotT);
+        overlappedSolutionMV->getVector(2);
       app_->getDiscretization()->writeSolutionT(
         *overlappedSolutionT, *overlappedSolutionDotT, *overlappedSolutionDotDotT, 
         stamp, /*overlapped =*/ true);
@@ -121,6 +120,10 @@ void StatelessObserverImpl::observeSolutionT (
    }
   }
   else {
+    const Teuchos::RCP<const Tpetra_Vector> overlappedSolutionT =
+      app_->getAdaptSolMgrT()->updateAndReturnOverlapSolutionT(nonOverlappedSolutionT);
+    if (Teuchos::nonnull(probeOutput_))
+      probeOutput_->writeStep(stamp, *overlappedSolutionT);
     app_->getDiscretization()->writeSolutionT(
       *overlappedSolutionT, stamp, /*overlapped =*/ true);
   }
@@ -133,6 +136,8 @@ void StatelessObserverImpl::observeSolutionT (
   Teuchos::TimeMonitor timer(*solOutTime_);
   const Teuchos::RCP<const Tpetra_MultiVector> overlappedSolutionT =
     app_->getAdaptSolMgrT()->updateAndReturnOverlapSolutionMV(nonOverlappedSolutionT);
+  if (Teuchos::nonnull(probeOutput_))
+    probeOutput_->writeStep(stamp, *overlappedSolutionT->getVector(0));
   app_->getDiscretization()->writeSolutionMV(
     *overlappedSolutionT, stamp, /*overlapped =*/ true);
 }
@@ -8,6 +8,7 @@
 
 #include "Albany_Application.hpp"
 #include "Albany_DataTypes.hpp"
+#include "Albany_ProbeOutput.hpp"
 
 #if defined(ALBANY_EPETRA)
 #include "Epetra_Map.h"
@@ -85,6 +86,8 @@ public:
 protected:
   Teuchos::RCP<Application> app_;
   Teuchos::RCP<Teuchos::Time> solOutTime_;
+  //! Probe time series, written at every observed step, or null
+  Teuchos::RCP<ProbeOutput> probeOutput_;
 
 private:
   StatelessObserverImpl(const StatelessObserverImpl&);
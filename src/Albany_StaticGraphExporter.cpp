@@ -0,0 +1,213 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+
+#include "Albany_StaticGraphExporter.hpp"
+#include "Albany_Utils.hpp"
+
+namespace {
+
+//! Host copy of the local structure of a fill-complete graph. A CrsMatrix
+//! built on the graph stores its values in the order of these entries.
+struct HostGraph {
+  using LocalGraph = Tpetra_CrsGraph::local_graph_type;
+
+  explicit HostGraph(const Tpetra_CrsGraph& graphT)
+  {
+    const LocalGraph local_graph = graphT.getLocalGraph();
+    row_map = RowMap("row_map", local_graph.row_map.dimension(0));
+    Kokkos::deep_copy(row_map, local_graph.row_map);
+    entries = Kokkos::create_mirror_view(local_graph.entries);
+    Kokkos::deep_copy(entries, local_graph.entries);
+  }
+
+  //! Offset of local column col in local row row, or -1 if there is none.
+  //! Column indices are sorted within each row of a fill-complete graph.
+  LO
+  offset(const LO row, const LO col) const
+  {
+    if (col < 0) return -1;
+    const Tpetra_LO* const first = entries.data() + row_map(row);
+    const Tpetra_LO* const last  = entries.data() + row_map(row + 1);
+    const Tpetra_LO* const it    = std::lower_bound(first, last, col);
+    return (it != last && *it == col) ? it - entries.data() : -1;
+  }
+
+  using RowMap = LocalGraph::row_map_type::non_const_type::HostMirror;
+  RowMap                                 row_map;
+  LocalGraph::entries_type::HostMirror   entries;
+};
+
+}  // namespace
+
+Albany::StaticGraphExporter::StaticGraphExporter(
+    const Teuchos::RCP<const Tpetra_CrsGraph>& overlapGraphT,
+    const Teuchos::RCP<const Tpetra_CrsGraph>& graphT,
+    const Teuchos::RCP<const Tpetra_Export>&   exporterT)
+    : overlapGraphT_(overlapGraphT), graphT_(graphT), exporterT_(exporterT)
+{
+  ALBANY_ASSERT(
+      overlapGraphT->isFillComplete() && graphT->isFillComplete(),
+      "StaticGraphExporter needs fill-complete graphs");
+
+  const HostGraph   overlap(*overlapGraphT);
+  const HostGraph   owned(*graphT);
+  const Tpetra_Map& overlapColMapT = *overlapGraphT->getColMap();
+  const Tpetra_Map& colMapT        = *graphT->getColMap();
+
+  // Entries of rows that stay on this rank: the first numSameIDs rows have
+  // the same local id in both maps, the permuted ones are listed
+  const auto addLocalRow = [&](const LO from, const LO to) {
+    for (size_t k = overlap.row_map(from); k < overlap.row_map(from + 1);
+         ++k) {
+      const LO col = colMapT.getLocalElement(
+          overlapColMapT.getGlobalElement(overlap.entries(k)));
+      const LO off = owned.offset(to, col);
+      if (off < 0) continue;
+      localFrom_.push_back(k);
+      localTo_.push_back(off);
+    }
+  };
+  const size_t numSameIDs = exporterT->getNumSameIDs();
+  for (size_t row = 0; row < numSameIDs; ++row) addLocalRow(row, row);
+  const Teuchos::ArrayView<const LO> permuteFromLIDs =
+      exporterT->getPermuteFromLIDs();
+  const Teuchos::ArrayView<const LO> permuteToLIDs =
+      exporterT->getPermuteToLIDs();
+  for (int i = 0; i < permuteFromLIDs.size(); ++i)
+    addLocalRow(permuteFromLIDs[i], permuteToLIDs[i]);
+
+  // Send the column ids of the remote rows once, in the order in which
+  // exportAdd will send their values
+  const Teuchos::ArrayView<const LO> exportLIDs = exporterT->getExportLIDs();
+  const Teuchos::ArrayView<const LO> remoteLIDs = exporterT->getRemoteLIDs();
+  numSendPerRow_.resize(exportLIDs.size());
+  numRecvPerRow_.resize(remoteLIDs.size());
+
+  std::vector<Tpetra_GO> sendCols;
+  for (int i = 0; i < exportLIDs.size(); ++i) {
+    const LO row      = exportLIDs[i];
+    numSendPerRow_[i] = overlap.row_map(row + 1) - overlap.row_map(row);
+    for (size_t k = overlap.row_map(row); k < overlap.row_map(row + 1); ++k) {
+      sendFrom_.push_back(k);
+      sendCols.push_back(overlapColMapT.getGlobalElement(overlap.entries(k)));
+    }
+  }
+
+  Tpetra::Distributor& distributor = exporterT->getDistributor();
+  distributor.doPostsAndWaits(
+      Teuchos::ArrayView<const size_t>(
+          numSendPerRow_.data(), numSendPerRow_.size()),
+      1,
+      Teuchos::ArrayView<size_t>(numRecvPerRow_.data(), numRecvPerRow_.size()));
+
+  size_t numRecv = 0;
+  for (size_t i = 0; i < numRecvPerRow_.size(); ++i)
+    numRecv += numRecvPerRow_[i];
+  std::vector<Tpetra_GO> recvCols(numRecv);
+  distributor.doPostsAndWaits(
+      Teuchos::ArrayView<const Tpetra_GO>(sendCols.data(), sendCols.size()),
+      Teuchos::ArrayView<const size_t>(
+          numSendPerRow_.data(), numSendPerRow_.size()),
+      Teuchos::ArrayView<Tpetra_GO>(recvCols.data(), recvCols.size()),
+      Teuchos::ArrayView<const size_t>(
+          numRecvPerRow_.data(), numRecvPerRow_.size()));
+
+  recvTo_.resize(numRecv);
+  for (size_t i = 0, k = 0; i < numRecvPerRow_.size(); ++i) {
+    const LO row = remoteLIDs[i];
+    for (size_t j = 0; j < numRecvPerRow_[i]; ++j, ++k)
+      recvTo_[k] = owned.offset(row, colMapT.getLocalElement(recvCols[k]));
+  }
+
+  sendValues_ = Teuchos::arcp<ST>(sendFrom_.size());
+  recvValues_ = Teuchos::arcp<ST>(recvTo_.size());
+}
+
+bool
+Albany::StaticGraphExporter::isCompatible(
+    const Tpetra_CrsMatrix& overlapMatrixT,
+    const Tpetra_CrsMatrix& matrixT) const
+{
+  return overlapMatrixT.getCrsGraph() == overlapGraphT_ &&
+         matrixT.getCrsGraph() == graphT_;
+}
+
+void
+Albany::StaticGraphExporter::exportAdd(
+    const Tpetra_CrsMatrix& overlapMatrixT,
+    Tpetra_CrsMatrix&       matrixT)
+{
+  beginExportAdd(overlapMatrixT);
+  endExportAdd(overlapMatrixT, matrixT);
+}
+
+void
+Albany::StaticGraphExporter::beginExportAdd(
+    const Tpetra_CrsMatrix& overlapMatrixT)
+{
+  ALBANY_ASSERT(
+      overlapMatrixT.getCrsGraph() == overlapGraphT_,
+      "StaticGraphExporter used with matrices on other graphs");
+  ALBANY_ASSERT(!begun_, "StaticGraphExporter posted twice");
+  begun_ = true;
+
+  // The local matrices are only set up after the first fillComplete
+  const auto overlapValuesD = overlapMatrixT.getLocalMatrix().values;
+  posted_ = overlapValuesD.dimension(0) == overlapGraphT_->getNodeNumEntries();
+  if (!posted_) return;
+
+  const auto overlapValues = Kokkos::create_mirror_view(overlapValuesD);
+  Kokkos::deep_copy(overlapValues, overlapValuesD);
+  for (size_t i = 0; i < sendFrom_.size(); ++i)
+    sendValues_[i] = overlapValues(sendFrom_[i]);
+  exporterT_->getDistributor().doPosts(
+      sendValues_.getConst(),
+      Teuchos::ArrayView<const size_t>(
+          numSendPerRow_.data(), numSendPerRow_.size()),
+      recvValues_,
+      Teuchos::ArrayView<const size_t>(
+          numRecvPerRow_.data(), numRecvPerRow_.size()));
+}
+
+void
+Albany::StaticGraphExporter::endExportAdd(
+    const Tpetra_CrsMatrix& overlapMatrixT,
+    Tpetra_CrsMatrix&       matrixT)
+{
+  ALBANY_ASSERT(
+      isCompatible(overlapMatrixT, matrixT),
+      "StaticGraphExporter used with matrices on other graphs");
+  ALBANY_ASSERT(begun_, "StaticGraphExporter completed without a post");
+  begun_ = false;
+
+  const auto overlapValuesD = overlapMatrixT.getLocalMatrix().values;
+  const auto valuesD        = matrixT.getLocalMatrix().values;
+  if (posted_ && valuesD.dimension(0) != graphT_->getNodeNumEntries()) {
+    exporterT_->getDistributor().doWaits();
+    posted_ = false;
+  }
+  if (!posted_) {
+    matrixT.doExport(overlapMatrixT, *exporterT_, Tpetra::ADD);
+    return;
+  }
+
+  const auto overlapValues = Kokkos::create_mirror_view(overlapValuesD);
+  const auto values        = Kokkos::create_mirror_view(valuesD);
+  Kokkos::deep_copy(overlapValues, overlapValuesD);
+  Kokkos::deep_copy(values, valuesD);
+
+  for (size_t i = 0; i < localFrom_.size(); ++i)
+    values(localTo_[i]) += overlapValues(localFrom_[i]);
+
+  exporterT_->getDistributor().doWaits();
+  posted_ = false;
+  for (size_t i = 0; i < recvTo_.size(); ++i)
+    if (recvTo_[i] >= 0) values(recvTo_[i]) += recvValues_[i];
+
+  Kokkos::deep_copy(valuesD, values);
+}
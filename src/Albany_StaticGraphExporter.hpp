@@ -0,0 +1,81 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_STATICGRAPHEXPORTER_HPP
+#define ALBANY_STATICGRAPHEXPORTER_HPP
+
+#include <vector>
+
+#include "Albany_DataTypes.hpp"
+
+namespace Albany {
+
+/*! \brief Export-add of an overlapped matrix with a fixed sparsity pattern.
+ *
+ *  Tpetra's doExport of a CrsMatrix packs and sends the column indices of
+ *  every remote row, and looks up every entry in the target rows, on each
+ *  call. When both matrices are built on fill-complete graphs that do not
+ *  change, this work can be done once. The constructor matches each entry
+ *  of the overlapped graph with its entry in the owned graph. exportAdd then
+ *  adds the locally owned rows in place and sends only the values of the
+ *  remote rows, through the distributor of the given Export.
+ *
+ *  Build a new exporter whenever the graphs change, e.g. after adaptation.
+ */
+class StaticGraphExporter {
+ public:
+  StaticGraphExporter(
+      const Teuchos::RCP<const Tpetra_CrsGraph>& overlapGraphT,
+      const Teuchos::RCP<const Tpetra_CrsGraph>& graphT,
+      const Teuchos::RCP<const Tpetra_Export>&   exporterT);
+
+  //! True if the matrices are built on the graphs this exporter was set up for
+  bool
+  isCompatible(
+      const Tpetra_CrsMatrix& overlapMatrixT,
+      const Tpetra_CrsMatrix& matrixT) const;
+
+  //! Add the values of overlapMatrixT into matrixT. Falls back to doExport
+  //! if the local values of either matrix are not available yet.
+  void
+  exportAdd(const Tpetra_CrsMatrix& overlapMatrixT, Tpetra_CrsMatrix& matrixT);
+
+  //! exportAdd split into a post of the values of the remote rows, which
+  //! must not change until endExportAdd, and the local adds and the wait
+  void
+  beginExportAdd(const Tpetra_CrsMatrix& overlapMatrixT);
+
+  void
+  endExportAdd(const Tpetra_CrsMatrix& overlapMatrixT, Tpetra_CrsMatrix& matrixT);
+
+ private:
+  Teuchos::RCP<const Tpetra_CrsGraph> overlapGraphT_;
+  Teuchos::RCP<const Tpetra_CrsGraph> graphT_;
+  Teuchos::RCP<const Tpetra_Export>   exporterT_;
+
+  //! Overlapped and owned value offsets of the entries of rows kept locally
+  std::vector<LO> localFrom_;
+  std::vector<LO> localTo_;
+
+  //! Overlapped value offsets of the entries sent, in send order
+  std::vector<LO>     sendFrom_;
+  std::vector<size_t> numSendPerRow_;
+
+  //! Owned value offsets of the entries received, -1 if not in the graph
+  std::vector<LO>     recvTo_;
+  std::vector<size_t> numRecvPerRow_;
+
+  Teuchos::ArrayRCP<ST> sendValues_;
+  Teuchos::ArrayRCP<ST> recvValues_;
+
+  //! beginExportAdd posted the values; false if it fell back to doExport
+  bool posted_{false};
+  bool begun_{false};
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_STATICGRAPHEXPORTER_HPP
@@ -0,0 +1,142 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Albany_TempusSession.hpp"
+
+#include "Piro_ObserverToTempusIntegrationObserverAdapter.hpp"
+#include "Teuchos_TestForException.hpp"
+#include "Thyra_VectorStdOps.hpp"
+
+namespace Albany {
+
+TempusSession::TempusSession(
+    const std::string& input_file,
+    const Teuchos::RCP<const Teuchos_Comm>& comm)
+    : factory_(input_file, comm), t_init_(0.0), needs_reset_(false), t0_(0.0)
+{
+  solver_ = factory_.createAndGetAlbanyAppT(app_, comm, comm);
+  model_ = factory_.returnModelT();
+
+  Teuchos::ParameterList& piro_params = factory_.getParameters().sublist("Piro");
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      piro_params.isSublist("Tempus") == false,
+      Teuchos::Exceptions::InvalidParameter,
+      std::endl << "Error!  No Tempus sublist when attempting to run problem "
+                << "with Transient Tempus No Piro Solution Method. "
+                << std::endl);
+
+  Teuchos::RCP<Teuchos::ParameterList> tempus_params =
+      Teuchos::rcp(&(piro_params.sublist("Tempus")), false);
+
+  integrator_ = Tempus::integratorBasic<ST>(tempus_params, model_);
+
+  Teuchos::RCP<Piro::ObserverBase<ST>> piro_observer =
+      factory_.returnObserverT();
+
+  if (Teuchos::nonnull(piro_observer)) {
+    Teuchos::RCP<Tempus::IntegratorObserver<ST>> tempus_observer =
+        Teuchos::rcp(new Piro::ObserverToTempusIntegrationObserverAdapter<ST>(
+            integrator_->getSolutionHistory(),
+            integrator_->getTimeStepControl(),
+            piro_observer));
+    integrator_->setObserver(tempus_observer);
+    integrator_->initialize();
+  }
+
+  // Keep copies, the nominal vectors are views of the application state
+  Thyra::ModelEvaluatorBase::InArgs<ST> const nominal =
+      model_->getNominalValues();
+
+  x_init_ = nominal.get_x()->clone_v();
+  if (nominal.supports(Thyra::ModelEvaluatorBase::IN_ARG_x_dot) &&
+      Teuchos::nonnull(nominal.get_x_dot())) {
+    x_dot_init_ = nominal.get_x_dot()->clone_v();
+  }
+  t_init_ = integrator_->getTime();
+}
+
+bool
+TempusSession::advance()
+{
+  if (needs_reset_) {
+    integrator_->initializeSolutionHistory(t0_, x0_, x_dot0_);
+    needs_reset_ = false;
+  }
+  return integrator_->advanceTime();
+}
+
+bool
+TempusSession::advance(double const final_time)
+{
+  if (needs_reset_) {
+    integrator_->initializeSolutionHistory(t0_, x0_, x_dot0_);
+    needs_reset_ = false;
+  }
+  return integrator_->advanceTime(final_time);
+}
+
+void
+TempusSession::resetInitialCondition(double const t0)
+{
+  resetInitialCondition(t0, x_init_, x_dot_init_);
+}
+
+void
+TempusSession::resetInitialCondition(
+    double const t0,
+    const Teuchos::RCP<const Thyra::VectorBase<ST>>& x0,
+    const Teuchos::RCP<const Thyra::VectorBase<ST>>& x_dot0)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      Teuchos::is_null(x0), std::logic_error,
+      "Error! TempusSession needs an initial condition.\n");
+
+  // The history is rebuilt lazily, so that several resets before the next
+  // integration cost one copy
+  t0_ = t0;
+  x0_ = x0->clone_v();
+  x_dot0_ = Teuchos::nonnull(x_dot0) ? x_dot0->clone_v() : Teuchos::null;
+  needs_reset_ = true;
+}
+
+void
+TempusSession::setParameter(int const l, int const k, ST const value)
+{
+  // The steppers hold the nominal parameter vectors of the model by
+  // reference, so the new value is seen by every later evaluation
+  Thyra::ModelEvaluatorBase::InArgs<ST> const nominal =
+      model_->getNominalValues();
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      l < 0 || l >= nominal.Np() || Teuchos::is_null(nominal.get_p(l)),
+      std::logic_error,
+      "Error! TempusSession: no parameter vector " << l << ".\n");
+
+  Teuchos::RCP<Thyra::VectorBase<ST>> p =
+      Teuchos::rcp_const_cast<Thyra::VectorBase<ST>>(nominal.get_p(l));
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      k < 0 || k >= p->space()->dim(), std::logic_error,
+      "Error! TempusSession: parameter vector " << l << " has no entry "
+                                                << k << ".\n");
+
+  Thyra::set_ele(k, value, p.ptr());
+}
+
+Teuchos::RCP<const Thyra::VectorBase<ST>>
+TempusSession::getX() const
+{
+  return integrator_->getX();
+}
+
+double
+TempusSession::getTime() const
+{
+  return integrator_->getTime();
+}
+
+}  // namespace Albany
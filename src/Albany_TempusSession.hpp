@@ -0,0 +1,113 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_TEMPUSSESSION_HPP
+#define ALBANY_TEMPUSSESSION_HPP
+
+#include <string>
+
+#include "Albany_Application.hpp"
+#include "Albany_DataTypes.hpp"
+#include "Albany_SolverFactory.hpp"
+
+#include "Teuchos_RCP.hpp"
+#include "Thyra_ModelEvaluator.hpp"
+#include "Thyra_VectorBase.hpp"
+
+#include "Tempus_IntegratorBasic.hpp"
+
+namespace Albany {
+
+/*!
+ * \brief Albany application and Tempus integrator kept alive across runs
+ *
+ * The discretization, field managers, model evaluator and integrator are
+ * built once from the input file. Between integrations the initial
+ * condition, the parameter values and the final time can be reset, so
+ * drivers doing ensembles or continuation call advance() in a loop instead
+ * of paying the full setup for every run.
+ */
+class TempusSession {
+ public:
+  TempusSession(
+      const std::string& input_file,
+      const Teuchos::RCP<const Teuchos_Comm>& comm);
+
+  //! Integrate from the current initial condition up to the final time
+  //! of the Tempus parameters; returns false if the integrator failed
+  bool
+  advance();
+
+  //! Integrate from the current initial condition up to final_time
+  bool
+  advance(double const final_time);
+
+  //! Restart the next integration at t0 from the initial condition of the
+  //! input file
+  void
+  resetInitialCondition(double const t0);
+
+  //! Restart the next integration at t0 from x0 and, if given, x_dot0
+  void
+  resetInitialCondition(
+      double const t0,
+      const Teuchos::RCP<const Thyra::VectorBase<ST>>& x0,
+      const Teuchos::RCP<const Thyra::VectorBase<ST>>& x_dot0 = Teuchos::null);
+
+  //! Set entry k of parameter vector l for the next integrations
+  void
+  setParameter(int const l, int const k, ST const value);
+
+  //! Solution and time reached by the last integration
+  Teuchos::RCP<const Thyra::VectorBase<ST>>
+  getX() const;
+
+  double
+  getTime() const;
+
+  Teuchos::ParameterList&
+  getParameters() { return factory_.getParameters(); }
+
+  Teuchos::RCP<Application>
+  getApplication() const { return app_; }
+
+  Teuchos::RCP<Thyra::ModelEvaluator<ST>>
+  getModel() const { return model_; }
+
+  Teuchos::RCP<Tempus::IntegratorBasic<ST>>
+  getIntegrator() const { return integrator_; }
+
+ private:
+  SolverFactory factory_;
+
+  Teuchos::RCP<Application> app_;
+
+  Teuchos::RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST>> solver_;
+
+  Teuchos::RCP<Thyra::ModelEvaluator<ST>> model_;
+
+  Teuchos::RCP<Tempus::IntegratorBasic<ST>> integrator_;
+
+  //! Initial condition and time of the input file
+  Teuchos::RCP<const Thyra::VectorBase<ST>> x_init_;
+
+  Teuchos::RCP<const Thyra::VectorBase<ST>> x_dot_init_;
+
+  double t_init_;
+
+  //! Initial condition of the next integration
+  bool needs_reset_;
+
+  double t0_;
+
+  Teuchos::RCP<const Thyra::VectorBase<ST>> x0_;
+
+  Teuchos::RCP<const Thyra::VectorBase<ST>> x_dot0_;
+};
+
+}  // namespace Albany
+
+#endif  // ALBANY_TEMPUSSESSION_HPP
@@ -6,8 +6,15 @@
 
 #include "Albany_Utils.hpp"
 #include "Teuchos_TestForException.hpp"
+#include "Teuchos_XMLParameterListHelpers.hpp"
+#include "Teuchos_YamlParameterListHelpers.hpp"
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <stdexcept>
+#include <vector>
 
 // For vtune
 #include <sys/types.h>
@@ -199,6 +206,137 @@
     return filename.substr(pos + 1);
   }
 
+  void
+  Albany::updateParametersFromInputFile(std::string const & input_file,
+      Teuchos::ParameterList & params, Teuchos_Comm const & comm)
+  {
+    auto const input_extension = getFileExtension(input_file);
+    if (input_extension == "yaml" || input_extension == "yml") {
+      Teuchos::updateParametersFromYamlFileAndBroadcast(
+          input_file, Teuchos::ptrFromRef(params), comm);
+    } else {
+      Teuchos::updateParametersFromXmlFileAndBroadcast(
+          input_file, Teuchos::ptrFromRef(params), comm);
+    }
+
+    // External arrays are relative to the input file
+    auto const pos = input_file.find_last_of("/");
+    std::string const base_dir =
+        pos == std::string::npos ? "" : input_file.substr(0, pos + 1);
+    resolveExternalArrays(params, comm, base_dir);
+  }
+
+namespace {
+
+  // Reads the raw bytes of an external array file
+  std::vector<char>
+  readExternalArrayFile(std::string const & filename, std::size_t value_size)
+  {
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    ALBANY_ASSERT(file.good(),
+        "\nError! Cannot open external array file " << filename << "\n");
+
+    std::int64_t count = 0;
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    ALBANY_ASSERT(file.good() && count >= 0,
+        "\nError! Invalid header in external array file " << filename << "\n");
+
+    std::vector<char> bytes(count * value_size);
+    file.read(bytes.data(), bytes.size());
+    ALBANY_ASSERT(file.gcount() == static_cast<std::streamsize>(bytes.size()),
+        "\nError! External array file " << filename << " holds fewer than "
+        << count << " values\n");
+    return bytes;
+  }
+
+  // Every rank gets the bytes of the file, read once per node or per rank
+  std::vector<char>
+  loadExternalArray(std::string const & filename, std::size_t value_size,
+      bool node_leader, Teuchos_Comm const & comm)
+  {
+#ifdef ALBANY_MPI
+    if (node_leader) {
+      Teuchos::Ptr<const Teuchos::MpiComm<int> > mpi_comm =
+          Teuchos::ptr_dynamic_cast<const Teuchos::MpiComm<int> >(Teuchos::ptrFromRef(comm));
+      if (!mpi_comm.is_null()) {
+        MPI_Comm node_comm;
+        MPI_Comm_split_type(*mpi_comm->getRawMpiComm(), MPI_COMM_TYPE_SHARED,
+            comm.getRank(), MPI_INFO_NULL, &node_comm);
+        int node_rank;
+        MPI_Comm_rank(node_comm, &node_rank);
+
+        std::vector<char> bytes;
+        long long num_bytes = 0;
+        if (node_rank == 0) {
+          bytes = readExternalArrayFile(filename, value_size);
+          num_bytes = bytes.size();
+        }
+        MPI_Bcast(&num_bytes, 1, MPI_LONG_LONG, 0, node_comm);
+        bytes.resize(num_bytes);
+
+        // MPI counts are ints, large arrays go in chunks
+        long long const chunk = 1LL << 30;
+        for (long long offset = 0; offset < num_bytes; offset += chunk) {
+          int const n = static_cast<int>(std::min(chunk, num_bytes - offset));
+          MPI_Bcast(bytes.data() + offset, n, MPI_BYTE, 0, node_comm);
+        }
+        MPI_Comm_free(&node_comm);
+        return bytes;
+      }
+    }
+#endif
+    return readExternalArrayFile(filename, value_size);
+  }
+
+  template <typename T>
+  Teuchos::Array<T>
+  toArray(std::vector<char> const & bytes)
+  {
+    Teuchos::Array<T> values(bytes.size() / sizeof(T));
+    if (values.size() > 0)
+      std::memcpy(values.getRawPtr(), bytes.data(), bytes.size());
+    return values;
+  }
+
+} // anonymous namespace
+
+  void
+  Albany::resolveExternalArrays(Teuchos::ParameterList & params,
+      Teuchos_Comm const & comm, std::string const & base_dir)
+  {
+    // Collect the names first, entries are replaced below
+    std::vector<std::string> sublists;
+    for (auto it = params.begin(); it != params.end(); ++it)
+      if (params.entry(it).isList()) sublists.push_back(params.name(it));
+
+    for (auto const & name : sublists) {
+      Teuchos::ParameterList & sublist = params.sublist(name);
+      if (!sublist.isParameter("External Array File")) {
+        resolveExternalArrays(sublist, comm, base_dir);
+        continue;
+      }
+
+      std::string filename = sublist.get<std::string>("External Array File");
+      if (!filename.empty() && filename[0] != '/') filename = base_dir + filename;
+      std::string const type = sublist.get<std::string>("Type", "double");
+      std::string const read = sublist.get<std::string>("Read", "Node Leader");
+      ALBANY_ASSERT(type == "double" || type == "int",
+          "\nError! Unknown external array type " << type << "\n");
+      ALBANY_ASSERT(read == "Node Leader" || read == "Each Rank",
+          "\nError! Unknown external array read mode " << read << "\n");
+
+      std::size_t const value_size = type == "double" ? sizeof(double) : sizeof(int);
+      std::vector<char> const bytes =
+          loadExternalArray(filename, value_size, read == "Node Leader", comm);
+
+      params.remove(name);
+      if (type == "double")
+        params.set(name, toArray<double>(bytes));
+      else
+        params.set(name, toArray<int>(bytes));
+    }
+  }
+
   void Albany::printTpetraVector(std::ostream &os, const Teuchos::RCP<const Tpetra_Vector>& vec){
 
     Teuchos::ArrayRCP<const double> vv = vec->get1dView();
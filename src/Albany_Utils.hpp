@@ -33,6 +33,7 @@
 #endif
 #include "Albany_DataTypes.hpp"
 #include "Teuchos_RCP.hpp"
+#include "Teuchos_ParameterList.hpp"
 
 // Checks if the previous Kokkos::Cuda kernel has failed
 #ifdef ALBANY_CUDA_ERROR_CHECK
@@ -156,6 +157,26 @@ splitStringOnDelim(
 std::string
 getFileExtension(std::string const& filename);
 
+/// Read a YAML or XML input file into params. Rank 0 parses the file and
+/// broadcasts the parameter structure, then the external arrays it
+/// references are read on every rank (see resolveExternalArrays).
+void
+updateParametersFromInputFile(
+    std::string const& input_file, Teuchos::ParameterList& params,
+    Teuchos_Comm const& comm);
+
+/// Replace, recursively, each sublist with an "External Array File"
+/// parameter by the array stored in that binary file: a 64-bit count
+/// followed by the values, 8-byte doubles for "Type" = "double" (the
+/// default) or 4-byte ints for "Type" = "int". Relative file names are
+/// taken from base_dir. With "Read" = "Node Leader" (the default) one rank
+/// per shared-memory node reads the file and sends it to the others on its
+/// node; with "Each Rank" every rank reads it directly.
+void
+resolveExternalArrays(
+    Teuchos::ParameterList& params, Teuchos_Comm const& comm,
+    std::string const& base_dir = "");
+
 //! Nicely prints out a Tpetra Vector
 void
 printTpetraVector(
@@ -30,6 +30,7 @@ typedef Belos::SolverManager<ST, MV, OP> Solver;
 typedef Belos::BlockGmresSolMgr<ST, MV, OP> GmresSolver;
 typedef Tpetra_Operator Prec;
 typedef Ifpack2::Preconditioner<ST, LO, Tpetra_GO, KokkosNode> IfpackPrec;
+typedef MueLu::TpetraOperator<ST, LO, Tpetra_GO, KokkosNode> MueLuPrec;
 
 static RCP<ParameterList> get_belos_params(RCP<const ParameterList> in) {
   RCP<ParameterList> p = rcp(new ParameterList);
@@ -53,11 +54,29 @@ static RCP<Solver> build_muelu_solver(
     RCP<Tpetra_Vector> x,
     RCP<Tpetra_Vector> b,
     RCP<Tpetra_MultiVector> coords,
-    RCP<Tpetra_MultiVector> nullspace) {
+    RCP<Tpetra_MultiVector> nullspace,
+    RCP<PreconditionerCache> cache,
+    RCP<Teuchos::FancyOStream> out) {
   auto muelu_params = in->sublist("Preconditioner");
   auto belos_params = get_belos_params(in);
-  auto AA = (RCP<OP>)A;
-  auto M = MueLu::CreateTpetraPreconditioner(AA, muelu_params, coords, nullspace);
+  bool should_reuse = false;
+  if (in->isType<bool>("Reuse Preconditioner"))
+    should_reuse = in->get<bool>("Reuse Preconditioner");
+  RCP<OP> M;
+  if (should_reuse && cache != Teuchos::null &&
+      cache->prec != Teuchos::null && cache->graph == A->getCrsGraph()) {
+    *out << "  reusing the preconditioner setup\n";
+    auto muelu_prec = rcp_dynamic_cast<MueLuPrec>(cache->prec, true);
+    MueLu::ReuseTpetraPreconditioner(A, *muelu_prec);
+    M = cache->prec;
+  } else {
+    auto AA = (RCP<OP>)A;
+    M = MueLu::CreateTpetraPreconditioner(AA, muelu_params, coords, nullspace);
+    if (should_reuse && cache != Teuchos::null) {
+      cache->prec = M;
+      cache->graph = A->getCrsGraph();
+    }
+  }
   auto problem = rcp(new LinearProblem(A, x, b));
   problem->setLeftPrec(M);
   problem->setProblem();
@@ -248,7 +267,8 @@ void solve_linear_system(
     RCP<Tpetra_CrsMatrix> A,
     RCP<Tpetra_Vector> x,
     RCP<Tpetra_Vector> b,
-    RCP<Albany::AbstractDiscretization> d) {
+    RCP<Albany::AbstractDiscretization> d,
+    RCP<PreconditionerCache> cache) {
 
   // useful timing info
   RCP<Teuchos::FancyOStream> out(Teuchos::VerboseObjectBase::getDefaultOStream());
@@ -267,7 +287,8 @@ void solve_linear_system(
   }
 
   // build the solver and solve
-  RCP<Solver> solver = build_muelu_solver(in, A, x, b, coords, nullspace);
+  RCP<Solver> solver = build_muelu_solver(
+      in, A, x, b, coords, nullspace, cache, out);
   solver->solve();
 
   // print some final information
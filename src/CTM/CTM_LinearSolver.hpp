@@ -12,12 +12,21 @@ namespace CTM {
 using Teuchos::RCP;
 using Teuchos::ParameterList;
 
+//! The MueLu preconditioner of the last solve and the graph it was built on
+struct PreconditionerCache {
+  RCP<Tpetra_Operator> prec;
+  RCP<const Tpetra_CrsGraph> graph;
+};
+
+//! With "Reuse Preconditioner" and a cache, a preconditioner built on the
+//! same graph is updated with MueLu's reuse setup instead of rebuilt
 void solve_linear_system(
     RCP<const ParameterList> p,
     RCP<Tpetra_CrsMatrix> A,
     RCP<Tpetra_Vector> x,
     RCP<Tpetra_Vector> b,
-    RCP<Albany::AbstractDiscretization> d = Teuchos::null);
+    RCP<Albany::AbstractDiscretization> d = Teuchos::null,
+    RCP<PreconditionerCache> cache = Teuchos::null);
 
 } // namespace CTM
 
@@ -82,6 +82,8 @@ void Solver::initial_setup() {
   m_state_mgr = rcp(new Albany::StateManager);
   t_sol_info = rcp(new SolutionInfo);
   m_sol_info = rcp(new SolutionInfo);
+  t_prec_cache = rcp(new PreconditionerCache);
+  m_prec_cache = rcp(new PreconditionerCache);
 
   // build the initial mesh specs
   auto disc_factory = rcp(new Albany::DiscretizationFactory(params, comm, false));
@@ -178,7 +180,7 @@ void Solver::solve_temp() {
   t_assembler->assemble_system(alpha, beta, omega, t_current, t_old);
   f->scale(-1.0);
   delta_T->putScalar(0.0);
-  solve_linear_system(la_params, J, delta_T, f);
+  solve_linear_system(la_params, J, delta_T, f, Teuchos::null, t_prec_cache);
 
   // perform updates
   T->update(1.0, *delta_T, 1.0);
@@ -213,7 +215,7 @@ void Solver::solve_mech() {
   u->putScalar(0.0);
   m_assembler->assemble_system(alpha, beta, omega, t_current, t_old);
   f->scale(-1.0);
-  solve_linear_system(la_params, J, u, f, m_disc);
+  solve_linear_system(la_params, J, u, f, m_disc, m_prec_cache);
 
   // perform updates
   m_assembler->assemble_state(t_current, t_old);
@@ -230,6 +232,8 @@ void Solver::adapt_mesh() {
   adapter->adapt(t_current);
   t_sol_info->resize(t_disc, true);
   m_sol_info->resize(m_disc, false);
+  t_prec_cache = rcp(new PreconditionerCache);
+  m_prec_cache = rcp(new PreconditionerCache);
   t_sol_info->owned->x = t_disc->getSolutionFieldT();
   m_sol_info->owned->x = m_disc->getSolutionFieldT();
   t_sol_info->scatter_x();
@@ -22,6 +22,7 @@ using Teuchos::ParameterList;
 class SolutionInfo;
 class Assembler;
 class Adapter;
+struct PreconditionerCache;
 
 class Solver {
 
@@ -62,6 +63,9 @@ class Solver {
 
     RCP<Adapter> adapter;
 
+    RCP<PreconditionerCache> t_prec_cache;
+    RCP<PreconditionerCache> m_prec_cache;
+
     int num_steps;
     double dt;
     double t_old;
@@ -12,6 +12,7 @@
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_MDField.hpp"
 #include "Albany_Layouts.hpp"
+#include "PHAL_MDFieldMemoizer.hpp"
 
 namespace FELIX
 {
@@ -92,6 +93,10 @@ private:
 
   enum BETA_TYPE {GIVEN_CONSTANT, GIVEN_FIELD, EXP_GIVEN_FIELD, GAL_PROJ_EXP_GIVEN_FIELD, POWER_LAW, REGULARIZED_COULOMB};
   BETA_TYPE beta_type;
+
+  // Saved beta of each workset, if it only depends on mesh fields
+  bool memoize;
+  PHAL::MDFieldMemoizer<ScalarT> memoizer;
 };
 
 } // Namespace FELIX
@@ -11,6 +11,7 @@
 #include "Albany_Layouts.hpp"
 
 #include <algorithm>
+#include <type_traits>
 
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
@@ -202,6 +203,11 @@ BasalFrictionCoefficient (const Teuchos::ParameterList& p,
 
   logParameters = beta_list.get<bool>("Use log scalar parameters",false);
 
+  // A beta given as a mesh field does not depend on the solution, so it is
+  // computed once per workset unless the field or the mesh changes
+  memoize = (beta_type==GIVEN_FIELD || beta_type==EXP_GIVEN_FIELD || beta_type==GAL_PROJ_EXP_GIVEN_FIELD) &&
+            std::is_same<ParamScalarT,RealType>::value && std::is_same<MeshScalarT,RealType>::value;
+
   this->setName("BasalFrictionCoefficient"+PHX::typeAsString<EvalT>());
 }
 
@@ -303,10 +309,16 @@ evaluateFields (typename Traits::EvalData workset)
                                 "\nError in FELIX::BasalFrictionCoefficient: \"Bed Roughness\" must be >= 0.\n");
   }
 
+  if (memoize && memoizer.restore(workset,beta))
+    return;
+
   if (IsStokes)
     evaluateFieldsSide(workset,mu,lambda,power);
   else
     evaluateFieldsCell(workset,mu,lambda,power);
+
+  if (memoize)
+    memoizer.save(workset,beta);
 }
 
 template<typename EvalT, typename Traits, bool IsHydrology, bool IsStokes>
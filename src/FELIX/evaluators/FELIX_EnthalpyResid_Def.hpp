@@ -255,27 +255,30 @@ namespace FELIX
 
     for (std::size_t cell = 0; cell < d.numCells; ++cell)
     {
-      for (std::size_t node = 0; node < numNodes; ++node)
+      for (std::size_t qp = 0; qp < numQPs; ++qp)
       {
-//      ScalarT scale = 0.5 - atan(flux_reg_coeff * diffEnth(cell,node))/pi;
-        for (std::size_t qp = 0; qp < numQPs; ++qp)
+        // node-independent coefficients of the quadrature point
+        ScalarT scale = 0.5 - atan(flux_reg_coeff * (Enthalpy(cell,qp) - EnthalpyHs(cell,qp)))/pi;
+        //scale = Albany::ADValue(scale);
+        ScalarT diff_coeff = powm3 * scale * K_i;
+        ScalarT melt_coeff = powm9*(1 - scale)*(k_i + rho_i*c_i*nu);
+
+        // advection and drainage, both tested against wBF
+        ScalarT adv_drain = (Velocity(cell,qp,0)*EnthalpyGrad(cell,qp,0) +
+                Velocity(cell,qp,1)*EnthalpyGrad(cell,qp,1) + verticalVel(cell,qp)*EnthalpyGrad(cell,qp,2))/scyr
+            - powm6 * drainage_coeff*alpha_om*pow(phi(cell,qp),alpha_om-1)*phiGrad(cell,qp,2);
+
+        for (std::size_t node = 0; node < numNodes; ++node)
         {
-          ScalarT scale = 0.5 - atan(flux_reg_coeff * (Enthalpy(cell,qp) - EnthalpyHs(cell,qp)))/pi;
-          //scale = Albany::ADValue(scale);
-          Residual(cell,node) += powm3 * scale * K_i * (EnthalpyGrad(cell,qp,0)*wGradBF(cell,node,qp,0) +
+          Residual(cell,node) += diff_coeff * (EnthalpyGrad(cell,qp,0)*wGradBF(cell,node,qp,0) +
               EnthalpyGrad(cell,qp,1)*wGradBF(cell,node,qp,1) +
               EnthalpyGrad(cell,qp,2)*wGradBF(cell,node,qp,2));
 
-          Residual(cell,node) += (Velocity(cell,qp,0)*EnthalpyGrad(cell,qp,0) +
-                  Velocity(cell,qp,1)*EnthalpyGrad(cell,qp,1) + verticalVel(cell,qp)*EnthalpyGrad(cell,qp,2))*wBF(cell,node,qp)/scyr ;
-//          Residual(cell,node) += (Albany::ADValue(Velocity(cell,qp,0))*EnthalpyGrad(cell,qp,0) +
-//                  Albany::ADValue(Velocity(cell,qp,1))*EnthalpyGrad(cell,qp,1) + verticalVel(cell,qp)*EnthalpyGrad(cell,qp,2))*wBF(cell,node,qp)/scyr ;
-
-          Residual(cell,node) += powm9*(1 - scale)*(k_i + rho_i*c_i*nu) * (meltTempGrad(cell,qp,0)*wGradBF(cell,node,qp,0) +
+          Residual(cell,node) += melt_coeff * (meltTempGrad(cell,qp,0)*wGradBF(cell,node,qp,0) +
               meltTempGrad(cell,qp,1)*wGradBF(cell,node,qp,1) +
               meltTempGrad(cell,qp,2)*wGradBF(cell,node,qp,2));
 
-          Residual(cell,node) -= powm6 * drainage_coeff*alpha_om*pow(phi(cell,qp),alpha_om-1)*phiGrad(cell,qp,2)*wBF(cell,node,qp);
+          Residual(cell,node) += adv_drain*wBF(cell,node,qp);
          // Residual(cell,node) += powm6*(1 - scale) * drainage_coeff*pow(phi(cell,qp),alpha_om)*wGradBF(cell,node,qp,2);
         }
       }
@@ -315,17 +318,15 @@ namespace FELIX
         }
 
 
-        for (std::size_t node = 0; node < numNodes; ++node)
+        ScalarT tau = delta*diam/vmax;
+        for (std::size_t qp = 0; qp < numQPs; ++qp)
         {
-          for (std::size_t qp = 0; qp < numQPs; ++qp)
+          // the advective derivative is shared by all test functions
+          ScalarT adv = (Velocity(cell,qp,0)*EnthalpyGrad(cell,qp,0) +
+              Velocity(cell,qp,1)*EnthalpyGrad(cell,qp,1) + verticalVel(cell,qp)*EnthalpyGrad(cell,qp,2))/scyr;
+          for (std::size_t node = 0; node < numNodes; ++node)
           {
 /*
-            //ScalarT scale = - atan(alpha * (Enthalpy(cell,qp) - EnthalpyHs(cell,qp)))/pi + 0.5;
-            //ScalarT totalVertVel = verticalVel(cell,qp);// - alpha_om*pow(phi(cell,qp),alpha_om-1)*(1-scale)*drain_vel;
-            //wSUPG = delta*(std::sqrt(diam_xy/vmax_xy)*(Velocity(cell,qp,0) * wGradBF(cell,node,qp,0) + Velocity(cell,qp,1) * wGradBF(cell,node,qp,1)) + std::sqrt(diam_z/vmax_z)*totalVertVel * wGradBF(cell,node,qp,2));
-            //Residual(cell,node) += (std::sqrt(diam_xy/vmax_xy)*(Velocity(cell,qp,0)*EnthalpyGrad(cell,qp,0) +
-            //    Velocity(cell,qp,1)*EnthalpyGrad(cell,qp,1)) + std::sqrt(diam_z/vmax_z)*totalVertVel*EnthalpyGrad(cell,qp,2))*wSUPG/scyr;
-
             ScalarT totalVertVel = verticalVel(cell,qp);// - alpha_om*pow(phi(cell,qp),alpha_om-1)*(1-scale)*drain_vel;
             ScalarT  wSUPG_xy = delta*diam_xy/vmax_xy*(Velocity(cell,qp,0) * wGradBF(cell,node,qp,0) + Velocity(cell,qp,1) * wGradBF(cell,node,qp,1));
             ScalarT  wSUPG_z = delta*diam_z/vmax_z*totalVertVel * wGradBF(cell,node,qp,2);
@@ -333,17 +334,8 @@ namespace FELIX
             Residual(cell,node) += (wSUPG_xy*(Velocity(cell,qp,0)*EnthalpyGrad(cell,qp,0) +
                 Velocity(cell,qp,1)*EnthalpyGrad(cell,qp,1)) +  wSUPG_z*totalVertVel*EnthalpyGrad(cell,qp,2))/scyr;
 /*/
-            wSUPG = delta*diam/vmax*(Velocity(cell,qp,0) * wGradBF(cell,node,qp,0) + Velocity(cell,qp,1) * wGradBF(cell,node,qp,1) + verticalVel(cell,qp) * wGradBF(cell,node,qp,2)); // +(velGrad(cell,qp,0,0)+velGrad(cell,qp,1,1))*wBF(cell,node,qp));
-//            ScalarT totalVertVel = verticalVel(cell,qp) - alpha_om*pow(phi(cell,qp),alpha_om-1)*drain_vel;
-//            wSUPG = delta*diam/vmax*(Velocity(cell,qp,0) * wGradBF(cell,node,qp,0) +Velocity(cell,qp,1) * wGradBF(cell,node,qp,1) + totalVertVel * wGradBF(cell,node,qp,2)); // +(velGrad(cell,qp,0,0)+velGrad(cell,qp,1,1))*wBF(cell,node,qp));
-            Residual(cell,node) += (Velocity(cell,qp,0)*EnthalpyGrad(cell,qp,0) +
-                Velocity(cell,qp,1)*EnthalpyGrad(cell,qp,1) + verticalVel(cell,qp)*EnthalpyGrad(cell,qp,2))*wSUPG/scyr;
-//            wSUPG = delta*diam/vmax*(Velocity(cell,qp,0) * wGradBF(cell,node,qp,0) +Velocity(cell,qp,1) * wGradBF(cell,node,qp,1) + totalVertVel * wGradBF(cell,node,qp,2)); // +(velGrad(cell,qp,0,0)+velGrad(cell,qp,1,1))*wBF(cell,node,qp));
-//           Residual(cell,node) += (Velocity(cell,qp,0)*EnthalpyGrad(cell,qp,0) +
-//                Velocity(cell,qp,1)*EnthalpyGrad(cell,qp,1) + totalVertVel*EnthalpyGrad(cell,qp,2))*wSUPG/scyr;
-           // wSUPG = delta*diam/vmax*(Albany::ADValue(Velocity(cell,qp,0)) * wGradBF(cell,node,qp,0) + Albany::ADValue(Velocity(cell,qp,1)) * wGradBF(cell,node,qp,1) + totalVertVel * wGradBF(cell,node,qp,2)); // +(velGrad(cell,qp,0,0)+velGrad(cell,qp,1,1))*wBF(cell,node,qp));
-           // Residual(cell,node) += (Albany::ADValue(Velocity(cell,qp,0))*EnthalpyGrad(cell,qp,0) +
-           //     Albany::ADValue(Velocity(cell,qp,1))*EnthalpyGrad(cell,qp,1) + totalVertVel*EnthalpyGrad(cell,qp,2))*wSUPG/scyr;
+            wSUPG = tau*(Velocity(cell,qp,0) * wGradBF(cell,node,qp,0) + Velocity(cell,qp,1) * wGradBF(cell,node,qp,1) + verticalVel(cell,qp) * wGradBF(cell,node,qp,2)); // +(velGrad(cell,qp,0,0)+velGrad(cell,qp,1,1))*wBF(cell,node,qp));
+            Residual(cell,node) += adv*wSUPG;
 //*/
           }
         }
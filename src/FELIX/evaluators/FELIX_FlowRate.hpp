@@ -12,6 +12,7 @@
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_MDField.hpp"
 #include "Albany_Layouts.hpp"
+#include "PHAL_MDFieldMemoizer.hpp"
 
 namespace FELIX
 {
@@ -51,6 +52,10 @@ private:
   double A;
   enum FlowRateType {UNIFORM, GIVEN_FIELD, TEMPERATURE_BASED};
   FlowRateType flowRate_type;
+
+  // Saved flow rate of each workset, if the temperature is a given field
+  bool memoize;
+  PHAL::MDFieldMemoizer<ParamScalarT> memoizer;
 };
 
 } // Namespace FELIX
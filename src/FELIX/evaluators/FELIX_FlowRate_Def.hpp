@@ -7,6 +7,8 @@
 #include "Phalanx_DataLayout.hpp"
 #include "Phalanx_TypeStrings.hpp"
 
+#include <type_traits>
+
 namespace FELIX {
 
 //**********************************************************************
@@ -56,6 +58,10 @@ FlowRate<EvalT, Traits>::FlowRate (const Teuchos::ParameterList& p,
 
   this->addEvaluatedField(flowRate);
 
+  // The temperature is a ParamScalarT field, hence solution independent; it
+  // only needs the exponentials again if the field or the mesh changes
+  memoize = flowRate_type==TEMPERATURE_BASED && std::is_same<ParamScalarT,RealType>::value;
+
   this->setName("FlowRate"+PHX::typeAsString<EvalT>());
 }
 
@@ -84,6 +90,9 @@ postRegistrationSetup(typename Traits::SetupData d,
 template<typename EvalT, typename Traits>
 void FlowRate<EvalT, Traits>::evaluateFields (typename Traits::EvalData workset)
 {
+  if (memoize && memoizer.restore(workset,flowRate))
+    return;
+
   switch (flowRate_type)
   {
     case UNIFORM:
@@ -105,6 +114,9 @@ void FlowRate<EvalT, Traits>::evaluateFields (typename Traits::EvalData workset)
     default:
       TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error, "Error! Invalid flow rate type. However, you should have got an error before...\n");
   }
+
+  if (memoize)
+    memoizer.save(workset,flowRate);
 }
 
 } // Namespace FELIX
@@ -53,6 +53,10 @@ protected:
   std::string meshPart;
 
   Teuchos::RCP<const CellTopologyData> cell_topo;
+
+  //! Trapezoidal weights of the levels, from layers_ratio
+  const std::vector<double>& getLevelWeights(const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering);
+  std::vector<double> quadWeights;
 };
 
 
@@ -55,6 +55,17 @@ postRegistrationSetup(typename Traits::SetupData d,
 }
 
 //**********************************************************************
+template<typename EvalT, typename Traits>
+const std::vector<double>& GatherVerticallyAveragedVelocityBase<EvalT, Traits>::
+getLevelWeights(const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering)
+{
+  // The weights only depend on the layering, they are computed once
+  if (quadWeights.size() != static_cast<std::size_t>(layeredMeshNumbering.numLevels))
+    quadWeights = layeredMeshNumbering.getLevelWeights();
+  return quadWeights;
+}
+
+//**********************************************************************
 
 
 
@@ -88,13 +99,12 @@ evaluateFields(typename Traits::EvalData workset)
     const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
     const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
 
-    const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
     int numLayers = layeredMeshNumbering.numLayers;
+    const std::vector<double>& quadWeights = this->getLevelWeights(layeredMeshNumbering); //doing trapezoidal rule
 
-    Teuchos::ArrayRCP<double> quadWeights(numLayers+1); //doing trapezoidal rule
-    quadWeights[0] = 0.5*layers_ratio[0]; quadWeights[numLayers] = 0.5*layers_ratio[numLayers-1];
-    for(int i=1; i<numLayers; ++i)
-      quadWeights[i] = 0.5*(layers_ratio[i-1] + layers_ratio[i]);
+    // Each column is averaged once and shared by the sides of this workset
+    // that touch it.
+    std::map<LO,std::vector<double> > columnAverages;
 
     for (std::size_t iSide = 0; iSide < sideSet.size(); ++iSide) { // loop over the sides on this ws and name
       // Get the data that corresponds to the side
@@ -112,12 +122,15 @@ evaluateFields(typename Traits::EvalData workset)
         std::size_t node = side.node[i];
         LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(elNodeID[node]);
         layeredMeshNumbering.getIndices(lnodeId, baseId, ilayer);
-        std::vector<double> avVel(this->vecDimFO,0);
-        for(int il=0; il<numLayers+1; ++il)
-        {
-          LO inode = layeredMeshNumbering.getId(baseId, il);
-          for(int comp=0; comp<this->vecDimFO; ++comp)
-            avVel[comp] += xT_constView[solDOFManager.getLocalDOF(inode, comp)]*quadWeights[il];
+        std::vector<double>& avVel = columnAverages[baseId];
+        if (avVel.empty()) {
+          avVel.assign(this->vecDimFO,0);
+          for(int il=0; il<numLayers+1; ++il)
+          {
+            LO inode = layeredMeshNumbering.getId(baseId, il);
+            for(int comp=0; comp<this->vecDimFO; ++comp)
+              avVel[comp] += xT_constView[solDOFManager.getLocalDOF(inode, comp)]*quadWeights[il];
+          }
         }
         for(int comp=0; comp<this->vecDimFO; ++comp)
           this->averagedVel(elem_LID,node,comp) = avVel[comp];
@@ -160,13 +173,11 @@ evaluateFields(typename Traits::EvalData workset)
     const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
     const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
 
-    const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
-
-    Teuchos::ArrayRCP<double> quadWeights(numLayers+1); //doing trapezoidal rule
+    const std::vector<double>& quadWeights = this->getLevelWeights(layeredMeshNumbering); //doing trapezoidal rule
 
-    quadWeights[0] = 0.5*layers_ratio[0]; quadWeights[numLayers] = 0.5*layers_ratio[numLayers-1];
-    for(int i=1; i<numLayers; ++i)
-      quadWeights[i] = 0.5*(layers_ratio[i-1] + layers_ratio[i]);
+    // Each column is averaged once and shared by the sides of this workset
+    // that touch it.
+    std::map<LO,std::vector<double> > columnAverages;
 
     for (std::size_t iSide = 0; iSide < sideSet.size(); ++iSide) { // loop over the sides on this ws and name
 
@@ -185,12 +196,15 @@ evaluateFields(typename Traits::EvalData workset)
         std::size_t node = side.node[i];
         LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(elNodeID[node]);
         layeredMeshNumbering.getIndices(lnodeId, baseId, ilayer);
-        std::vector<double> avVel(this->vecDimFO,0);
-        for(int il=0; il<numLayers+1; ++il)
-        {
-          LO inode = layeredMeshNumbering.getId(baseId, il);
-          for(int comp=0; comp<this->vecDimFO; ++comp)
-            avVel[comp] += xT_constView[solDOFManager.getLocalDOF(inode, comp)]*quadWeights[il];
+        std::vector<double>& avVel = columnAverages[baseId];
+        if (avVel.empty()) {
+          avVel.assign(this->vecDimFO,0);
+          for(int il=0; il<numLayers+1; ++il)
+          {
+            LO inode = layeredMeshNumbering.getId(baseId, il);
+            for(int comp=0; comp<this->vecDimFO; ++comp)
+              avVel[comp] += xT_constView[solDOFManager.getLocalDOF(inode, comp)]*quadWeights[il];
+          }
         }
 
         for(int comp=0; comp<this->vecDimFO; ++comp) {
@@ -246,13 +260,12 @@ evaluateFields(typename Traits::EvalData workset)
     const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
     const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
 
-    const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
     int numLayers = layeredMeshNumbering.numLayers;
+    const std::vector<double>& quadWeights = this->getLevelWeights(layeredMeshNumbering); //doing trapezoidal rule
 
-    Teuchos::ArrayRCP<double> quadWeights(numLayers+1); //doing trapezoidal rule
-    quadWeights[0] = 0.5*layers_ratio[0]; quadWeights[numLayers] = 0.5*layers_ratio[numLayers-1];
-    for(int i=1; i<numLayers; ++i)
-      quadWeights[i] = 0.5*(layers_ratio[i-1] + layers_ratio[i]);
+    // Each column is averaged once and shared by the sides of this workset
+    // that touch it.
+    std::map<LO,std::vector<double> > columnAverages;
 
     for (std::size_t iSide = 0; iSide < sideSet.size(); ++iSide) { // loop over the sides on this ws and name
       // Get the data that corresponds to the side
@@ -270,12 +283,15 @@ evaluateFields(typename Traits::EvalData workset)
         std::size_t node = side.node[i];
         LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(elNodeID[node]);
         layeredMeshNumbering.getIndices(lnodeId, baseId, ilayer);
-        std::vector<double> avVel(this->vecDimFO,0);
-        for(int il=0; il<numLayers+1; ++il)
-        {
-          LO inode = layeredMeshNumbering.getId(baseId, il);
-          for(int comp=0; comp<this->vecDimFO; ++comp)
-            avVel[comp] += xT_constView[solDOFManager.getLocalDOF(inode, comp)]*quadWeights[il];
+        std::vector<double>& avVel = columnAverages[baseId];
+        if (avVel.empty()) {
+          avVel.assign(this->vecDimFO,0);
+          for(int il=0; il<numLayers+1; ++il)
+          {
+            LO inode = layeredMeshNumbering.getId(baseId, il);
+            for(int comp=0; comp<this->vecDimFO; ++comp)
+              avVel[comp] += xT_constView[solDOFManager.getLocalDOF(inode, comp)]*quadWeights[il];
+          }
         }
         for(int comp=0; comp<this->vecDimFO; ++comp)
           this->averagedVel(elem_LID,node,comp) = avVel[comp];
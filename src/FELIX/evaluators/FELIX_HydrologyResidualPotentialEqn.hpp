@@ -73,9 +73,24 @@ private:
   double l_r;
   double A;
 
+  // Omega is in mm/d rather than m/s
+  double scaling_omega;
+
   // Variables necessary for stokes coupling
   std::string                     sideSetName;
   std::vector<std::vector<int> >  sideNodes;
+  std::vector<ScalarT>            q_metric;
+
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  struct Cell_Tag{};
+
+  typedef Kokkos::RangePolicy<ExecutionSpace,Cell_Tag> Cell_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const Cell_Tag& tag, const int& cell) const;
 };
 
 } // Namespace FELIX
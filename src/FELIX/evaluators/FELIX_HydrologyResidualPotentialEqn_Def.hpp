@@ -84,6 +84,8 @@ HydrologyResidualPotentialEqn (const Teuchos::ParameterList& p,
   A   *= 1./(1000*yr_to_s);     // Need to adjust A, which is given in k^-{n+1} Pa^-n yr^-1, to [kPa]^-n s^-1.
   l_r *= yr_to_s;               // Need to adjust u_b from m/yr to m/s. Since it's always divided by l_r, we simply scale l_r
 
+  scaling_omega = 0.001/(24*3600);
+
   this->setName("HydrologyResidualPotentialEqn"+PHX::typeAsString<EvalT>());
 }
 
@@ -104,19 +106,52 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(u_b,fm);
 
   if (IsStokesCoupling)
+  {
     this->utils.setFieldData(metric,fm);
+    q_metric.resize(numDims);
+  }
 
   this->utils.setFieldData(residual,fm);
 }
 
 //**********************************************************************
 template<typename EvalT, typename Traits, bool HasThicknessEqn, bool IsStokesCoupling>
+KOKKOS_INLINE_FUNCTION
 void HydrologyResidualPotentialEqn<EvalT, Traits, HasThicknessEqn, IsStokesCoupling>::
-evaluateFields (typename Traits::EvalData workset)
+operator() (const Cell_Tag& tag, const int& cell) const
 {
-  // Omega is in mm/d rather than m/s
-  double scaling_omega = 0.001/(24*3600);
+  // The cells of a workset write disjoint residual entries, so the cells
+  // are independent; the node terms are accumulated qp by qp, so that the
+  // qp terms are evaluated once rather than once per node
+  for (int node=0; node < numNodes; ++node)
+    residual(cell,node) = ScalarT(0.);
+
+  for (int qp=0; qp < numQPs; ++qp)
+  {
+    ScalarT res_qp = rho_combo*m(cell,qp) + omega(cell,qp)*scaling_omega
+                   - (h_r - use_eff_cav*h(cell,qp))*u_b(cell,qp)/l_r;
+    if (eta_i>0)
+      res_qp += h(cell,qp)*N(cell,qp)/eta_i;
+    else
+      res_qp += h(cell,qp)*A*std::pow(N(cell,qp),3);
+
+    for (int node=0; node < numNodes; ++node)
+    {
+      ScalarT res = res_qp*BF(cell,node,qp);
+      for (int dim=0; dim<numDims; ++dim)
+      {
+        res += q(cell,qp,dim) * GradBF(cell,node,qp,dim);
+      }
+      residual (cell,node) += res * w_measure(cell,qp);
+    }
+  }
+}
 
+//**********************************************************************
+template<typename EvalT, typename Traits, bool HasThicknessEqn, bool IsStokesCoupling>
+void HydrologyResidualPotentialEqn<EvalT, Traits, HasThicknessEqn, IsStokesCoupling>::
+evaluateFields (typename Traits::EvalData workset)
+{
   if (IsStokesCoupling)
   {
     // Zero out, to avoid leaving stuff from previous workset!
@@ -133,90 +168,38 @@ evaluateFields (typename Traits::EvalData workset)
       const int cell = it_side.elem_LID;
       const int side = it_side.side_local_id;
 
-      for (int node=0; node < numNodes; ++node)
+      for (int qp=0; qp < numQPs; ++qp)
       {
-        res_node = 0;
-        for (int qp=0; qp < numQPs; ++qp)
-        {
-          res_qp = rho_combo*m(cell,side,qp) + omega(cell,side,qp)
-                 - (h_r -h(cell,side,qp))*u_b(cell,side,qp)/l_r
-                 + h(cell,side,qp)*std::pow(A*N(cell,side,qp),3);
-
-          res_qp *= BF(cell,side,node,qp);
+        res_qp = rho_combo*m(cell,side,qp) + omega(cell,side,qp)
+               - (h_r -h(cell,side,qp))*u_b(cell,side,qp)/l_r
+               + h(cell,side,qp)*std::pow(A*N(cell,side,qp),3);
 
+        // q^T G, shared by all nodes
+        for (int jdim=0; jdim<numDims; ++jdim)
+        {
+          q_metric[jdim] = 0;
           for (int idim=0; idim<numDims; ++idim)
           {
-            for (int jdim=0; jdim<numDims; ++jdim)
-            {
-              res_qp += q(cell,side,qp,idim) * metric(cell,side,qp,idim,jdim) * GradBF(cell,side,node,qp,jdim);
-            }
+            q_metric[jdim] += q(cell,side,qp,idim) * metric(cell,side,qp,idim,jdim);
           }
-
-          res_node += res_qp * w_measure(cell,side,qp);
         }
-        residual (cell,side,node) += res_node;
-      }
-    }
-  }
-  else
-  {
-    if (eta_i>0)
-    {
-      ScalarT res_qp, res_node;
-      for (int cell=0; cell < workset.numCells; ++cell)
-      {
-        for (int node=0; node < numNodes; ++node)
-        {
-          res_node = 0;
-          for (int qp=0; qp < numQPs; ++qp)
-          {
-            res_qp = rho_combo*m(cell,qp) + omega(cell,qp)*scaling_omega
-                   - (h_r - use_eff_cav*h(cell,qp))*u_b(cell,qp)/l_r
-                   + h(cell,qp)*N(cell,qp)/eta_i;
-
-            res_qp *= BF(cell,node,qp);
-
-            for (int dim=0; dim<numDims; ++dim)
-            {
-              res_qp += q(cell,qp,dim) * GradBF(cell,node,qp,dim);
-            }
-
-            res_node += res_qp * w_measure(cell,qp);
-          }
 
-          residual (cell,node) = res_node;
-        }
-      }
-    }
-    else
-    {
-      ScalarT res_qp, res_node;
-      for (int cell=0; cell < workset.numCells; ++cell)
-      {
         for (int node=0; node < numNodes; ++node)
         {
-          res_node = 0;
-          for (int qp=0; qp < numQPs; ++qp)
+          res_node = res_qp * BF(cell,side,node,qp);
+          for (int jdim=0; jdim<numDims; ++jdim)
           {
-            res_qp = rho_combo*m(cell,qp) + omega(cell,qp)*scaling_omega
-                   - (h_r - use_eff_cav*h(cell,qp))*u_b(cell,qp)/l_r
-                   + h(cell,qp)*A*std::pow(N(cell,qp),3);
-
-            res_qp *= BF(cell,node,qp);
-
-            for (int dim=0; dim<numDims; ++dim)
-            {
-              res_qp += q(cell,qp,dim) * GradBF(cell,node,qp,dim);
-            }
-
-            res_node += res_qp * w_measure(cell,qp);
+            res_node += q_metric[jdim] * GradBF(cell,side,node,qp,jdim);
           }
-
-          residual (cell,node) = res_node;
+          residual (cell,side,node) += res_node * w_measure(cell,side,qp);
         }
       }
     }
   }
+  else
+  {
+    Kokkos::parallel_for(this->getName(), Cell_Policy(0,workset.numCells), *this);
+  }
 }
 
 } // Namespace FELIX
@@ -70,6 +70,17 @@ private:
   bool                            stokes_coupling;
   std::string                     sideSetName;
   std::vector<std::vector<int> >  sideNodes;
+
+public:
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  struct Cell_Tag{};
+
+  typedef Kokkos::RangePolicy<ExecutionSpace,Cell_Tag> Cell_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const Cell_Tag& tag, const int& cell) const;
 };
 
 } // Namespace FELIX
@@ -98,13 +98,36 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(residual,fm);
 }
 
+template<typename EvalT, typename Traits, bool IsStokes>
+KOKKOS_INLINE_FUNCTION
+void HydrologyResidualThicknessEqn<EvalT, Traits, IsStokes>::
+operator() (const Cell_Tag& tag, const int& cell) const
+{
+  // The cells are independent; the qp terms are evaluated once and spread
+  // to the nodes
+  for (int qp=0; qp < numQPs; ++qp)
+  {
+    ScalarT res_qp = rho_i_inv*m(cell,qp) + (h_r - use_eff_cav*h(cell,qp))*u_b(cell,qp)/l_r
+                   - h(cell,qp)*A*std::pow(N(cell,qp),3);
+    if (unsteady)
+      res_qp -= h_dot(cell,qp);
+
+    res_qp *= w_measure(cell,qp);
+    for (int node=0; node < numNodes; ++node)
+    {
+      residual (cell,node) += res_qp * BF(cell,node,qp);
+    }
+  }
+}
+
+//**********************************************************************
 template<typename EvalT, typename Traits, bool IsStokes>
 void HydrologyResidualThicknessEqn<EvalT, Traits, IsStokes>::
 evaluateFields (typename Traits::EvalData workset)
 {
   // h' = W_O - W_C = (m/rho_i + u_b*(h_b-h)/l_b) - AhN^n
 
-  ScalarT res_node, res_qp, zero(0.0);
+  ScalarT res_qp, zero(0.0);
 
   if (IsStokes)
   {
@@ -121,38 +144,22 @@ evaluateFields (typename Traits::EvalData workset)
       const int cell = it_side.elem_LID;
       const int side = it_side.side_local_id;
 
-      for (int node=0; node < numNodes; ++node)
+      for (int qp=0; qp < numQPs; ++qp)
       {
-        res_node = 0;
-        for (int qp=0; qp < numQPs; ++qp)
-        {
-          res_qp = rho_i_inv*m(cell,side,qp) - (h_r - use_eff_cav*h(cell,side,qp))*u_b(cell,side,qp)/l_r
-                 + h(cell,side,qp)*A*std::pow(N(cell,side,qp),3) - (unsteady ? h_dot(cell,side,qp) : zero);
+        res_qp = rho_i_inv*m(cell,side,qp) - (h_r - use_eff_cav*h(cell,side,qp))*u_b(cell,side,qp)/l_r
+               + h(cell,side,qp)*A*std::pow(N(cell,side,qp),3) - (unsteady ? h_dot(cell,side,qp) : zero);
 
-          res_node += res_qp * BF(cell,side,node,qp) * w_measure(cell,side,qp);
+        res_qp *= w_measure(cell,side,qp);
+        for (int node=0; node < numNodes; ++node)
+        {
+          residual (cell,side,node) += res_qp * BF(cell,side,node,qp);
         }
-
-        residual (cell,side,node) += res_node;
       }
     }
   }
   else
   {
-    for (int cell=0; cell < workset.numCells; ++cell)
-    {
-      for (int node=0; node < numNodes; ++node)
-      {
-        res_node = 0;
-        for (int qp=0; qp < numQPs; ++qp)
-        {
-          res_qp = rho_i_inv*m(cell,qp) + (h_r - use_eff_cav*h(cell,qp))*u_b(cell,qp)/l_r
-                 - h(cell,qp)*A*std::pow(N(cell,qp),3) - (unsteady ? h_dot(cell,qp) : zero);
-
-          res_node += res_qp * BF(cell,node,qp) * w_measure(cell,qp);
-        }
-        residual (cell,node) += res_node;
-      }
-    }
+    Kokkos::parallel_for(this->getName(), Cell_Policy(0,workset.numCells), *this);
   }
 }
 
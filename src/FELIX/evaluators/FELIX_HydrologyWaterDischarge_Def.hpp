@@ -97,10 +97,11 @@ void HydrologyWaterDischarge<EvalT, Traits, HasThicknessEqn, false>::evaluateFie
     {
       for (int qp=0; qp < numQPs; ++qp)
       {
+//        const hScalarT k = -k_0 * std::pow(h(cell,qp),alpha) / mu_w;
+        const hScalarT k = -k_0 * std::pow(h(cell,qp),3) / mu_w;
         for (int dim(0); dim<numDim; ++dim)
         {
-//          q(cell,qp,dim) = -k_0 * std::pow(h(cell,qp),alpha) * gradPhi(cell,qp,dim) / mu_w;
-          q(cell,qp,dim) = -k_0 * std::pow(h(cell,qp),3) * gradPhi(cell,qp,dim) / mu_w;
+          q(cell,qp,dim) = k * gradPhi(cell,qp,dim);
         }
       }
     }
@@ -206,9 +207,10 @@ evaluateFields (typename Traits::EvalData workset)
 
       for (int qp=0; qp < numQPs; ++qp)
       {
+        const hScalarT k = -k_0 * std::pow(h(cell,side,qp),alpha) / mu_w;
         for (int dim(0); dim<numDim; ++dim)
         {
-          q(cell,side,qp,dim) = -k_0 * std::pow(h(cell,side,qp),alpha) * gradPhi(cell,side,qp,dim) / mu_w;
+          q(cell,side,qp,dim) = k * gradPhi(cell,side,qp,dim);
         }
       }
     }
@@ -57,6 +57,11 @@ protected:
   bool StokesThermoCoupled;
 
   int offset, neq;
+
+  //! Column (base node) and level of each node of the workset cells,
+  //! looked up once per evaluation
+  void getNodeLevels(typename Traits::EvalData workset);
+  std::vector<LO> baseIds, levels;
 };
 
 template<typename EvalT, typename Traits> class Integral1Dw_Z;
@@ -66,6 +66,27 @@ postRegistrationSetup(typename Traits::SetupData d,
     this->utils.setFieldData(int1Dw_z,fm);
 }
 
+template<typename EvalT, typename Traits>
+void Integral1Dw_ZBase<EvalT, Traits>::
+getNodeLevels(typename Traits::EvalData workset)
+{
+    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
+    const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
+    const Teuchos::RCP<const Tpetra_Map> overlapNodeMap = workset.disc->getOverlapNodeMapT();
+
+    baseIds.resize(workset.numCells*numNodes);
+    levels.resize(workset.numCells*numNodes);
+    for ( std::size_t cell = 0; cell < workset.numCells; ++cell )
+    {
+      const Teuchos::ArrayRCP<GO>& nodeID = wsElNodeID[cell];
+      for (std::size_t node = 0; node < numNodes; ++node)
+      {
+        LO lnodeId = overlapNodeMap->getLocalElement(nodeID[node]);
+        layeredMeshNumbering.getIndices(lnodeId, baseIds[cell*numNodes+node], levels[cell*numNodes+node]);
+      }
+    }
+}
+
 // Specialization for AlbanyTraits::Residual
 template<typename Traits>
 Integral1Dw_Z<PHAL::AlbanyTraits::Residual, Traits>::
@@ -83,49 +104,41 @@ evaluateFields(typename Traits::EvalData workset)
 
     Kokkos::deep_copy(this->int1Dw_z.get_view(), ScalarT(0.0));
 
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
-
     const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
     const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
-    const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
-    int numLayers = layeredMeshNumbering.numLayers;
-    LO baseId, ilayer;
     std::map<LO,std::pair<std::size_t,std::size_t> > basalCellsMap;
 
+    // Each column is integrated once, in a single sweep, and shared by the
+    // nodes of the column in this workset.
+    const int offset = this->offset;
+    auto w_z = [&](const LO inode) { return xT_constView[solDOFManager.getLocalDOF(inode, offset)]; };
+    std::map<LO,std::vector<double> > columnIntegrals;
+    this->getNodeLevels(workset);
+
     for ( std::size_t cell = 0; cell < workset.numCells; ++cell )
     {
-      const Teuchos::ArrayRCP<GO>& nodeID = wsElNodeID[cell];
-
       for (std::size_t node = 0; node < this->numNodes; ++node)
       {
-        LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(nodeID[node]);
-        layeredMeshNumbering.getIndices(lnodeId, baseId, ilayer);
+        const LO baseId = this->baseIds[cell*this->numNodes+node];
+        const LO ilayer = this->levels[cell*this->numNodes+node];
 
         if(ilayer==0)
           basalCellsMap[baseId]= std::make_pair(cell,node);
 
-        double int1D = 0;
+        std::vector<double>& int1D = columnIntegrals[baseId];
+        if (int1D.empty())
+          layeredMeshNumbering.integrateColumn(baseId, w_z, int1D);
 
-        for (int il = 0; il < ilayer; ++il)
-        {
-          LO inode0 = layeredMeshNumbering.getId(baseId, il);
-          LO inode1 = layeredMeshNumbering.getId(baseId, il+1);
-          int1D += 0.5 * ( xT_constView[solDOFManager.getLocalDOF(inode0, this->offset)] + xT_constView[solDOFManager.getLocalDOF(inode1, this->offset)] ) * layers_ratio[il];
-        }
-
-        this->int1Dw_z(cell,node) = int1D * this->thickness(cell,node);
+        this->int1Dw_z(cell,node) = int1D[ilayer] * this->thickness(cell,node);
       }
     }
 
     for ( std::size_t cell = 0; cell < workset.numCells; ++cell )
     {
-      const Teuchos::ArrayRCP<GO>& nodeID = wsElNodeID[cell];
-
       for (std::size_t node = 0; node < this->numNodes; ++node)
       {
-        LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(nodeID[node]);
-        layeredMeshNumbering.getIndices(lnodeId, baseId, ilayer);
-        this->int1Dw_z(cell,node) += this->basal_velocity(basalCellsMap[baseId].first, basalCellsMap[baseId].second);
+        const std::pair<std::size_t,std::size_t>& basal = basalCellsMap[this->baseIds[cell*this->numNodes+node]];
+        this->int1Dw_z(cell,node) += this->basal_velocity(basal.first, basal.second);
       }
     }
 }
@@ -147,57 +160,48 @@ evaluateFields(typename Traits::EvalData workset)
 
     Kokkos::deep_copy(this->int1Dw_z.get_view(), ScalarT(0.0));
 
-    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
-
     const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
     const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
 
     const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
-    int numLayers = layeredMeshNumbering.numLayers;
 
-    LO baseId, ilevel, baseId_curr, ilevel_curr;
     std::map<LO,std::pair<std::size_t,std::size_t> > basalCellsMap;
 
+    const int offset = this->offset;
+    auto w_z = [&](const LO inode) { return xT_constView[solDOFManager.getLocalDOF(inode, offset)]; };
+    std::map<LO,std::vector<double> > columnIntegrals;
+    this->getNodeLevels(workset);
+
     for ( std::size_t cell = 0; cell < workset.numCells; ++cell )
     {
-      const Teuchos::ArrayRCP<GO>& nodeID = wsElNodeID[cell];
-
       for (std::size_t node = 0; node < this->numNodes; ++node)
       {
-        LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(nodeID[node]);
-        layeredMeshNumbering.getIndices(lnodeId, baseId, ilevel);
+        const LO baseId = this->baseIds[cell*this->numNodes+node];
+        const LO ilevel = this->levels[cell*this->numNodes+node];
 
         if(ilevel==0)
           basalCellsMap[baseId]= std::make_pair(cell,node);
 
-        double int1D = 0;
+        std::vector<double>& int1D = columnIntegrals[baseId];
+        if (int1D.empty())
+          layeredMeshNumbering.integrateColumn(baseId, w_z, int1D);
 
-        for (int il = 0; il < ilevel; ++il)
-        {
-          LO inode0 = layeredMeshNumbering.getId(baseId, il);
-          LO inode1 = layeredMeshNumbering.getId(baseId, il+1);
-          int1D += 0.5 * ( xT_constView[solDOFManager.getLocalDOF(inode0, this->offset)] + xT_constView[solDOFManager.getLocalDOF(inode1, this->offset)] ) * layers_ratio[il];
-        }
-
-        this->int1Dw_z(cell,node) = FadType(this->int1Dw_z(cell,node).size(), int1D);
+        this->int1Dw_z(cell,node) = FadType(this->int1Dw_z(cell,node).size(), int1D[ilevel]);
       }
     }
 
     for ( std::size_t cell = 0; cell < workset.numCells; ++cell )
     {
-      const Teuchos::ArrayRCP<GO>& nodeID = wsElNodeID[cell];
-
       for (std::size_t node = 0; node < this->numNodes; ++node)
       {
-        LO lnodeId = workset.disc->getOverlapNodeMapT()->getLocalElement(nodeID[node]);
-        layeredMeshNumbering.getIndices(lnodeId, baseId, ilevel);
-
+        const LO baseId = this->baseIds[cell*this->numNodes+node];
+        const LO ilevel = this->levels[cell*this->numNodes+node];
 
         // TODO implement the derivative for the extra term mb
         for (std::size_t node_curr = 0; node_curr < this->numNodes; ++node_curr)
           {
-            LO lnodeId_curr = nodeID[node_curr];
-              layeredMeshNumbering.getIndices(lnodeId_curr, baseId_curr, ilevel_curr);
+              const LO baseId_curr = this->baseIds[cell*this->numNodes+node_curr];
+              const LO ilevel_curr = this->levels[cell*this->numNodes+node_curr];
               if (baseId_curr == baseId)
               {
                 int idx = this->neq * node_curr + this->offset;
@@ -459,34 +459,34 @@ evaluateFields(typename Traits::EvalData workset)
    y_0 = stereographicMapList->get<double>("Y_0", 0);//-2040);
    R2 = std::pow(R,2);
 
-   Kokkos::parallel_for(FO_INTERP_SURF_GRAD_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), FO_INTERP_SURF_GRAD_Policy(0,workset.numCells),*this);
   }
   else if (bf_type == POISSON) {
-   Kokkos::parallel_for(POISSON_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), POISSON_Policy(0,workset.numCells),*this);
   }
   else if (bf_type == FO_SINCOS2D) {
-   Kokkos::parallel_for(FO_SINCOS2D_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), FO_SINCOS2D_Policy(0,workset.numCells),*this);
   }
   else if (bf_type == FO_COSEXP2D) {
-   Kokkos::parallel_for(FO_COSEXP2D_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), FO_COSEXP2D_Policy(0,workset.numCells),*this);
   }
   else if (bf_type == FO_COSEXP2DFLIP) {
-   Kokkos::parallel_for(FO_COSEXP2DFLIP_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), FO_COSEXP2DFLIP_Policy(0,workset.numCells),*this);
   }
   else if (bf_type == FO_COSEXP2DALL) {
-   Kokkos::parallel_for(FO_COSEXP2DALL_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), FO_COSEXP2DALL_Policy(0,workset.numCells),*this);
   }
   else if (bf_type == FO_SINCOSZ) {
-   Kokkos::parallel_for(FO_SINCOSZ_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), FO_SINCOSZ_Policy(0,workset.numCells),*this);
   }
   else if (bf_type == FO_SINEXP2D) {
-   Kokkos::parallel_for(FO_SINEXP2D_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), FO_SINEXP2D_Policy(0,workset.numCells),*this);
   }
   else if (bf_type == FO_DOME) {
-   Kokkos::parallel_for(FO_DOME_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), FO_DOME_Policy(0,workset.numCells),*this);
   }
   else if (bf_type == FO_XZMMS ) {
-   Kokkos::parallel_for(FO_XZMMS_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), FO_XZMMS_Policy(0,workset.numCells),*this);
   }
 }
 
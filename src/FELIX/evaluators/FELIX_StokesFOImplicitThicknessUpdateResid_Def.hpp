@@ -114,7 +114,7 @@ template<typename EvalT, typename Traits>
 void StokesFOImplicitThicknessUpdateResid<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  Kokkos::parallel_for(StokesFOImplicitThicknessUpdateResid_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), StokesFOImplicitThicknessUpdateResid_Policy(0,workset.numCells),*this);
 }
 
 //**********************************************************************
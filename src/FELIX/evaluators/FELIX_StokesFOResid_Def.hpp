@@ -461,21 +461,21 @@ evaluateFields(typename Traits::EvalData workset)
 #endif
   if (numDims == 3) { //3D case
     if (eqn_type == FELIX) {
-     Kokkos::parallel_for(FELIX_3D_Policy(0,workset.numCells), *this);
+     Kokkos::parallel_for(this->getName(), FELIX_3D_Policy(0,workset.numCells), *this);
     }
     else if (eqn_type == POISSON) {
-      Kokkos::parallel_for(POISSON_3D_Policy(0,workset.numCells), *this);
+      Kokkos::parallel_for(this->getName(), POISSON_3D_Policy(0,workset.numCells), *this);
     }
   }
   else { //2D case
    if (eqn_type == FELIX) {
-     Kokkos::parallel_for(FELIX_2D_Policy(0,workset.numCells), *this);
+     Kokkos::parallel_for(this->getName(), FELIX_2D_Policy(0,workset.numCells), *this);
    }
    if (eqn_type == FELIX_XZ) {
-     Kokkos::parallel_for(FELIX_XZ_2D_Policy(0,workset.numCells), *this);
+     Kokkos::parallel_for(this->getName(), FELIX_XZ_2D_Policy(0,workset.numCells), *this);
    }
    else if (eqn_type == POISSON) {
-    Kokkos::parallel_for(POISSON_2D_Policy(0,workset.numCells), *this);
+    Kokkos::parallel_for(this->getName(), POISSON_2D_Policy(0,workset.numCells), *this);
    }
   }
 }
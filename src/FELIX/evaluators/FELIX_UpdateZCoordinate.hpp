@@ -51,6 +51,9 @@ private:
 
   double minH;
   unsigned int numDims, numNodes;
+
+  //! Normalized coordinate of each level of the layered mesh
+  std::vector<double> sigmaLevel;
 };
 
 
@@ -84,6 +87,9 @@ private:
 
   double minH;
   unsigned int numDims, numNodes;
+
+  //! Normalized coordinate of each level of the layered mesh
+  std::vector<double> sigmaLevel;
 };
 }
 
@@ -72,13 +72,11 @@ evaluateFields(typename Traits::EvalData workset)
   const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
   const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
 
-  int numLayers = layeredMeshNumbering.numLayers;
   const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
-  const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
-  Teuchos::ArrayRCP<double> sigmaLevel(numLayers+1);
-  sigmaLevel[0] = 0.; sigmaLevel[numLayers] = 1.;
-  for(int i=1; i<numLayers; ++i)
-    sigmaLevel[i] = sigmaLevel[i-1] + layers_ratio[i-1];
+
+  // The level coordinates only depend on the layering, they are summed once
+  if (sigmaLevel.size() != static_cast<std::size_t>(layeredMeshNumbering.numLevels))
+    sigmaLevel = layeredMeshNumbering.getLevelCoordinates();
 
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     const Teuchos::ArrayRCP<GO>& elNodeID = wsElNodeID[cell];
@@ -155,13 +153,11 @@ evaluateFields(typename Traits::EvalData workset)
   const Albany::LayeredMeshNumbering<LO>& layeredMeshNumbering = *workset.disc->getLayeredMeshNumbering();
   const Albany::NodalDOFManager& solDOFManager = workset.disc->getOverlapDOFManager("ordinary_solution");
 
-  int numLayers = layeredMeshNumbering.numLayers;
   const Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >& wsElNodeID  = workset.disc->getWsElNodeID()[workset.wsIndex];
-  const Teuchos::ArrayRCP<double>& layers_ratio = layeredMeshNumbering.layers_ratio;
-  Teuchos::ArrayRCP<double> sigmaLevel(numLayers+1);
-  sigmaLevel[0] = 0.; sigmaLevel[numLayers] = 1.;
-  for(int i=1; i<numLayers; ++i)
-    sigmaLevel[i] = sigmaLevel[i-1] + layers_ratio[i-1];
+
+  // The level coordinates only depend on the layering, they are summed once
+  if (sigmaLevel.size() != static_cast<std::size_t>(layeredMeshNumbering.numLevels))
+    sigmaLevel = layeredMeshNumbering.getLevelCoordinates();
 
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     const Teuchos::ArrayRCP<GO>& elNodeID = wsElNodeID[cell];
@@ -13,6 +13,8 @@
 #include "Phalanx_MDField.hpp"
 #include "Albany_Layouts.hpp"
 
+#include <vector>
+
 namespace FELIX {
 /** \brief Finite Element Interpolation Evaluator
 
@@ -80,6 +82,18 @@ private:
 
   ScalarT printedFF;
 
+  //! Temperature-based flow factor 1/2*A(T)^{-1/n} of each cell of a workset,
+  //! with the temperature it was computed for. It is recomputed only for the
+  //! cells whose temperature changed, so the exp and pow of a frozen
+  //! temperature field are done once per solve.
+  struct FlowFactorCache {
+    Kokkos::View<RealType*, PHX::Device> temperature;
+    Kokkos::View<RealType*, PHX::Device> flowFactor;
+  };
+  std::vector<FlowFactorCache> flowFactorCache;
+  FlowFactorCache wsFlowFactorCache;
+  bool useFlowFactorCache;
+
   unsigned int numQPs, numDims, numCells;
 
   enum VISCTYPE {CONSTANT, EXPTRIG, GLENSLAW, GLENSLAW_XZ};
@@ -138,6 +152,9 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator() (const ViscosityFO_GLENSLAW_XZ_FROMCISM_Tag& tag, const int& i) const;
 
+  KOKKOS_INLINE_FUNCTION
+  RealType cachedFlowFactor (const int& cell) const;
+
   KOKKOS_INLINE_FUNCTION
   void glenslaw (const ScalarT &flowFactorVec, const int& cell) const;
 
@@ -10,6 +10,9 @@
 
 #include "Albany_Layouts.hpp"
 
+#include <limits>
+#include <type_traits>
+
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
 
@@ -48,6 +51,8 @@ ViscosityFO(const Teuchos::ParameterList& p,
   std::string viscType = visc_list->get("Type", "Constant");
 
   extractStrainRateSq = visc_list->get("Extract Strain Rate Sq", false);
+  // A temperature carrying derivatives must go through the FAD flow rate
+  useFlowFactorCache = std::is_same<TemprT, RealType>::value;
   useStiffeningFactor = visc_list->get("Use Stiffening Factor", false);
 
   std::string flowRateType;
@@ -352,12 +357,27 @@ void ViscosityFO<EvalT, Traits, VelT, TemprT>::operator () (const ViscosityFO_GL
   glenslaw(flowFactorVec,cell);
 }
 
+template<typename EvalT, typename Traits, typename VelT, typename TemprT>
+KOKKOS_INLINE_FUNCTION
+RealType ViscosityFO<EvalT, Traits, VelT, TemprT>::cachedFlowFactor (const int& cell) const
+{
+  const RealType T = Albany::ADValue(temperature(cell));
+  if (T != wsFlowFactorCache.temperature(cell)) {
+    wsFlowFactorCache.temperature(cell) = T;
+    wsFlowFactorCache.flowFactor(cell) = 1.0/2.0*pow(flowRate<RealType>(T), -1.0/n);
+  }
+  return wsFlowFactorCache.flowFactor(cell);
+}
+
 template<typename EvalT, typename Traits, typename VelT, typename TemprT>
 KOKKOS_INLINE_FUNCTION
 void ViscosityFO<EvalT, Traits, VelT, TemprT>::operator () (const ViscosityFO_GLENSLAW_TEMPERATUREBASED_Tag& tag, const int& cell) const
 {
   ScalarT flowFactorVec;
-  flowFactorVec =1.0/2.0*pow(flowRate<TemprT>(temperature(cell)), -1.0/n);
+  if (useFlowFactorCache)
+    flowFactorVec = cachedFlowFactor(cell);
+  else
+    flowFactorVec =1.0/2.0*pow(flowRate<TemprT>(temperature(cell)), -1.0/n);
   //flowFactorVec =1.0/2.0*homotopyParam(0)*pow(flowRate<TemprT>(temperature(cell)), -1.0/n)+1./2.*(1.-homotopyParam(0))*pow(A, -1.0/n);
   glenslaw(flowFactorVec,cell);
 }
@@ -433,7 +453,10 @@ KOKKOS_INLINE_FUNCTION
 void ViscosityFO<EvalT, Traits, VelT, TemprT>::operator () (const ViscosityFO_GLENSLAW_XZ_TEMPERATUREBASED_Tag& tag, const int& cell) const
 {
   TemprT flowFactorVec;
-  flowFactorVec =1.0/2.0*pow(flowRate<TemprT>(temperature(cell)), -1.0/n);
+  if (useFlowFactorCache)
+    flowFactorVec = cachedFlowFactor(cell);
+  else
+    flowFactorVec =1.0/2.0*pow(flowRate<TemprT>(temperature(cell)), -1.0/n);
   glenslaw_xz(flowFactorVec,cell);
 }
 
@@ -458,13 +481,27 @@ template<typename EvalT, typename Traits, typename VelT, typename TemprT>
 void ViscosityFO<EvalT, Traits, VelT, TemprT>::
 evaluateFields(typename Traits::EvalData workset)
 {
+  if (useFlowFactorCache && flowRate_type == TEMPERATUREBASED &&
+      (visc_type == GLENSLAW || visc_type == GLENSLAW_XZ)) {
+    if (workset.wsIndex >= flowFactorCache.size())
+      flowFactorCache.resize(workset.wsIndex + 1);
+    FlowFactorCache& c = flowFactorCache[workset.wsIndex];
+    if (c.temperature.dimension_0() < workset.numCells) {
+      c.temperature = Kokkos::View<RealType*, PHX::Device>("Cached Temperature", workset.numCells);
+      c.flowFactor  = Kokkos::View<RealType*, PHX::Device>("Cached Flow Factor", workset.numCells);
+      // NaN never compares equal, so every cell is computed on the first fill
+      Kokkos::deep_copy(c.temperature, std::numeric_limits<RealType>::quiet_NaN());
+    }
+    wsFlowFactorCache = c;
+  }
+
   switch (visc_type)
   {
     case CONSTANT:
-      Kokkos::parallel_for(ViscosityFO_CONSTANT_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), ViscosityFO_CONSTANT_Policy(0,workset.numCells),*this);
       break;
     case EXPTRIG:
-      Kokkos::parallel_for(ViscosityFO_EXPTRIG_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), ViscosityFO_EXPTRIG_Policy(0,workset.numCells),*this);
       break;
     case GLENSLAW:
       if(useStereographicMap)
@@ -478,14 +515,14 @@ evaluateFields(typename Traits::EvalData workset)
       switch (flowRate_type)
       {
         case UNIFORM:
-          Kokkos::parallel_for(ViscosityFO_GLENSLAW_UNIFORM_Policy(0,workset.numCells),*this);
+          Kokkos::parallel_for(this->getName(), ViscosityFO_GLENSLAW_UNIFORM_Policy(0,workset.numCells),*this);
           break;
         case TEMPERATUREBASED:
-          Kokkos::parallel_for(ViscosityFO_GLENSLAW_TEMPERATUREBASED_Policy(0,workset.numCells),*this);
+          Kokkos::parallel_for(this->getName(), ViscosityFO_GLENSLAW_TEMPERATUREBASED_Policy(0,workset.numCells),*this);
           break;
         case FROMFILE:
         case FROMCISM:
-          Kokkos::parallel_for(ViscosityFO_GLENSLAW_FROMFILE_Policy(0,workset.numCells),*this);
+          Kokkos::parallel_for(this->getName(), ViscosityFO_GLENSLAW_FROMFILE_Policy(0,workset.numCells),*this);
         break;
       }
       break;
@@ -493,14 +530,14 @@ evaluateFields(typename Traits::EvalData workset)
       switch (flowRate_type)
       {
         case UNIFORM:
-          Kokkos::parallel_for(ViscosityFO_GLENSLAW_XZ_UNIFORM_Policy(0,workset.numCells),*this);
+          Kokkos::parallel_for(this->getName(), ViscosityFO_GLENSLAW_XZ_UNIFORM_Policy(0,workset.numCells),*this);
           break;
         case TEMPERATUREBASED:
-          Kokkos::parallel_for(ViscosityFO_GLENSLAW_XZ_TEMPERATUREBASED_Policy(0,workset.numCells),*this);
+          Kokkos::parallel_for(this->getName(), ViscosityFO_GLENSLAW_XZ_TEMPERATUREBASED_Policy(0,workset.numCells),*this);
           break;
         case FROMFILE:
         case FROMCISM:
-          Kokkos::parallel_for(ViscosityFO_GLENSLAW_XZ_FROMFILE_Policy(0,workset.numCells),*this);
+          Kokkos::parallel_for(this->getName(), ViscosityFO_GLENSLAW_XZ_FROMFILE_Policy(0,workset.numCells),*this);
           break;
       }
       break;
@@ -32,6 +32,29 @@
 
 const Tpetra::global_size_t INVALID = Teuchos::OrdinalTraits<Tpetra::global_size_t>::invalid ();
 
+namespace {
+
+//This is the inverse of the temperature-flowRate relationship; see FELIX_ViscosityFO_Def.hpp .
+double temperatureFromFlowFactor(const double flowFactor)
+{
+  if (flowFactor < 1.4e-05)
+    return 6.0e4/log(1.13939568e7/flowFactor)/8.314;
+  else
+    return 1.39e5/log(5.4651888e22/flowFactor)/8.314;
+}
+
+//Check that the 1-based face IDs passed from CISM are the ones of faceMapT
+bool sameFaceIDs(const Teuchos::RCP<Tpetra_Map>& faceMapT, const int * face_active_owned_map_Ptr, const int numFaces)
+{
+  if (numFaces == 0) return true;
+  if (face_active_owned_map_Ptr == NULL || static_cast<int>(faceMapT->getNodeNumElements()) != numFaces) return false;
+  for (int i=0; i<numFaces; i++)
+    if (faceMapT->getGlobalElement(i) != face_active_owned_map_Ptr[i]-1) return false;
+  return true;
+}
+
+}
+
 //Constructor for arrays passed from CISM through Albany-CISM interface
 Albany::CismSTKMeshStruct::CismSTKMeshStruct(
                   const Teuchos::RCP<Teuchos::ParameterList>& params,
@@ -444,11 +467,7 @@ Albany::CismSTKMeshStruct::constructMesh(
        //Fill temperature field from flowRate
        //For CISM-Albany runs, flowRate will always be passed, not temperature.  
        double *temperature = stk::mesh::field_data(*temperature_field, elem);
-       //This is the inverse of the temperature-flowRate relationship; see FELIX_ViscosityFO_Def.hpp .
-       if (flwa[i] < 1.4e-05)
-         temperature[0] = 6.0e4/log(1.13939568e7/flwa[i])/8.314;
-       else 
-         temperature[0] = 1.39e5/log(5.4651888e22/flwa[i])/8.314;
+       temperature[0] = temperatureFromFlowFactor(flwa[i]);
      }
      
   }
@@ -611,6 +630,135 @@ Albany::CismSTKMeshStruct::constructMesh(
   bulkData->modification_end();
 }
 
+bool
+Albany::CismSTKMeshStruct::hasSameTopology(
+                  const int * global_node_id_owned_map_Ptr,
+                  const int * global_element_id_active_owned_map_Ptr,
+                  const int * global_element_conn_active_Ptr,
+                  const int * global_basal_face_active_owned_map_Ptr,
+                  const int * global_west_face_active_owned_map_Ptr,
+                  const int * global_east_face_active_owned_map_Ptr,
+                  const int * global_south_face_active_owned_map_Ptr,
+                  const int * global_north_face_active_owned_map_Ptr,
+                  const int * dirichlet_node_mask_Ptr,
+                  const int nNodes, const int nElementsActive,
+                  const int nCellsActive, const int nWestFacesActive,
+                  const int nEastFacesActive, const int nSouthFacesActive,
+                  const int nNorthFacesActive) const
+{
+  if (nNodes != NumNodes || nElementsActive != NumEles || nCellsActive != NumBasalFaces ||
+      nWestFacesActive != NumWestFaces || nEastFacesActive != NumEastFaces ||
+      nSouthFacesActive != NumSouthFaces || nNorthFacesActive != NumNorthFaces)
+    return false;
+
+  for (int i=0; i<NumNodes; i++)
+    if (node_mapT->getGlobalElement(i) != global_node_id_owned_map_Ptr[i]-1) return false;
+  for (int i=0; i<NumEles; i++) {
+    if (elem_mapT->getGlobalElement(i) != global_element_id_active_owned_map_Ptr[i]-1) return false;
+    for (int j = 0; j<8; j++)
+      if (eles[i][j] != global_element_conn_active_Ptr[i + nElementsActive*j]) return false;
+  }
+
+  if (have_bf && !sameFaceIDs(basal_face_mapT, global_basal_face_active_owned_map_Ptr, NumBasalFaces)) return false;
+  if (!sameFaceIDs(west_face_mapT, global_west_face_active_owned_map_Ptr, NumWestFaces)) return false;
+  if (!sameFaceIDs(east_face_mapT, global_east_face_active_owned_map_Ptr, NumEastFaces)) return false;
+  if (!sameFaceIDs(south_face_mapT, global_south_face_active_owned_map_Ptr, NumSouthFaces)) return false;
+  if (!sameFaceIDs(north_face_mapT, global_north_face_active_owned_map_Ptr, NumNorthFaces)) return false;
+
+  //The Dirichlet node set is a mesh part, so it is part of the topology
+  if (have_dirichlet != (dirichlet_node_mask_Ptr != NULL)) return false;
+  if (have_dirichlet) {
+    for (int i=0; i<NumNodes; i++)
+      if (dirichletNodeMask[i] != dirichlet_node_mask_Ptr[i]) return false;
+  }
+  return true;
+}
+
+void
+Albany::CismSTKMeshStruct::updateGeometry(
+                  const double * xyz_at_nodes_Ptr,
+                  const double * uvel_at_nodes_Ptr,
+                  const double * vvel_at_nodes_Ptr,
+                  const double * beta_at_nodes_Ptr,
+                  const double * surf_height_at_nodes_Ptr,
+                  const double * dsurf_height_at_nodes_dx_Ptr,
+                  const double * dsurf_height_at_nodes_dy_Ptr,
+                  const double * thick_at_nodes_Ptr,
+                  const double * flwa_at_active_elements_Ptr)
+{
+  //Fields that were not passed at construction do not exist in the mesh; the ones
+  //that are not passed now keep their previous values.
+  for (int i=0; i<NumNodes; i++)
+    for (int j=0; j<3; j++)
+      xyz[i][j] = xyz_at_nodes_Ptr[i + NumNodes*j];
+  const bool update_sh = have_sh && surf_height_at_nodes_Ptr != NULL;
+  const bool update_thck = have_thck && thick_at_nodes_Ptr != NULL;
+  const bool update_shGrad = have_shGrad && dsurf_height_at_nodes_dx_Ptr != NULL && dsurf_height_at_nodes_dy_Ptr != NULL;
+  const bool update_beta = have_beta && beta_at_nodes_Ptr != NULL;
+  const bool update_dirichlet = have_dirichlet && uvel_at_nodes_Ptr != NULL && vvel_at_nodes_Ptr != NULL;
+  const bool update_flwa = have_flwa && flwa_at_active_elements_Ptr != NULL;
+  for (int i=0; i<NumNodes; i++) {
+    if (update_sh) sh[i] = surf_height_at_nodes_Ptr[i];
+    if (update_thck) thck[i] = thick_at_nodes_Ptr[i];
+    if (update_shGrad) {
+      shGrad[i][0] = dsurf_height_at_nodes_dx_Ptr[i];
+      shGrad[i][1] = dsurf_height_at_nodes_dy_Ptr[i];
+    }
+    if (update_beta) beta[i] = beta_at_nodes_Ptr[i];
+    if (update_dirichlet) {
+      uvel[i] = uvel_at_nodes_Ptr[i];
+      vvel[i] = vvel_at_nodes_Ptr[i];
+    }
+  }
+  if (update_flwa) {
+    for (int i=0; i<NumEles; i++)
+      flwa[i] = flwa_at_active_elements_Ptr[i];
+  }
+
+  typedef AbstractSTKFieldContainer::ScalarFieldType ScalarFieldType;
+  typedef AbstractSTKFieldContainer::VectorFieldType VectorFieldType;
+
+  VectorFieldType* coordinates_field = fieldContainer->getCoordinatesField();
+  ScalarFieldType* surfaceHeight_field = metaData->get_field<ScalarFieldType>(stk::topology::NODE_RANK, "surface_height");
+  ScalarFieldType* thickness_field = metaData->get_field<ScalarFieldType>(stk::topology::NODE_RANK, "ice_thickness");
+  ScalarFieldType* dsurfaceHeight_dx_field = metaData->get_field<ScalarFieldType>(stk::topology::NODE_RANK, "xgrad_surface_height");
+  ScalarFieldType* dsurfaceHeight_dy_field = metaData->get_field<ScalarFieldType>(stk::topology::NODE_RANK, "ygrad_surface_height");
+  ScalarFieldType* flowFactor_field = metaData->get_field<ScalarFieldType>(stk::topology::ELEMENT_RANK, "flow_factor");
+  ScalarFieldType* temperature_field = metaData->get_field<ScalarFieldType>(stk::topology::ELEMENT_RANK, "temperature");
+  ScalarFieldType* basal_friction_field = metaData->get_field<ScalarFieldType>(stk::topology::NODE_RANK, "basal_friction");
+  VectorFieldType* dirichlet_field = metaData->get_field<VectorFieldType>(stk::topology::NODE_RANK, "dirichlet_field");
+
+  //Same traversal as constructMesh: nodes are set through the elements they belong to
+  for (int i=0; i<NumEles; i++) {
+     stk::mesh::Entity elem = bulkData->get_entity(stk::topology::ELEMENT_RANK, 1+elem_mapT->getGlobalElement(i));
+     for (int j=0; j<8; j++) {
+       stk::mesh::Entity node = bulkData->get_entity(stk::topology::NODE_RANK, eles[i][j]);
+       const unsigned int node_LID = node_mapT->getLocalElement(eles[i][j]-1);
+       double* coord = stk::mesh::field_data(*coordinates_field, node);
+       coord[0] = xyz[node_LID][0];   coord[1] = xyz[node_LID][1];   coord[2] = xyz[node_LID][2];
+       if (update_sh)
+         stk::mesh::field_data(*surfaceHeight_field, node)[0] = sh[node_LID];
+       if (update_thck)
+         stk::mesh::field_data(*thickness_field, node)[0] = thck[node_LID];
+       if (update_shGrad) {
+         stk::mesh::field_data(*dsurfaceHeight_dx_field, node)[0] = shGrad[node_LID][0];
+         stk::mesh::field_data(*dsurfaceHeight_dy_field, node)[0] = shGrad[node_LID][1];
+       }
+       if (update_dirichlet) {
+         double* dirichlet = stk::mesh::field_data(*dirichlet_field, node);
+         dirichlet[0] = uvel[node_LID];
+         dirichlet[1] = vvel[node_LID];
+       }
+       if (update_beta)
+         stk::mesh::field_data(*basal_friction_field, node)[0] = beta[node_LID];
+     }
+     if (update_flwa) {
+       stk::mesh::field_data(*flowFactor_field, elem)[0] = flwa[i];
+       stk::mesh::field_data(*temperature_field, elem)[0] = temperatureFromFlowFactor(flwa[i]);
+     }
+  }
+}
+
 Teuchos::RCP<const Teuchos::ParameterList>
 Albany::CismSTKMeshStruct::getValidDiscretizationParameters() const
 {
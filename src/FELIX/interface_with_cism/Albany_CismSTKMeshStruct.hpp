@@ -75,6 +75,35 @@ namespace Albany {
                   const unsigned int worksetSize);
 
 
+    //! True if the arrays passed from CISM describe the mesh of this struct: same
+    //! nodes, active elements and connectivity, boundary faces and Dirichlet nodes
+    bool hasSameTopology(
+                  const int * global_node_id_owned_map_Ptr, 
+                  const int * global_element_id_active_owned_map_Ptr, 
+                  const int * global_element_conn_active_Ptr, 
+                  const int * global_basal_face_active_owned_map_Ptr, 
+                  const int * global_west_face_active_owned_map_Ptr,
+                  const int * global_east_face_active_owned_map_Ptr,
+                  const int * global_south_face_active_owned_map_Ptr,
+                  const int * global_north_face_active_owned_map_Ptr,
+                  const int * dirichlet_node_mask_Ptr, 
+                  const int nNodes, const int nElementsActive, 
+                  const int nCellsActive, 
+                  const int nWestFacesActive, const int nEastFacesActive, 
+                  const int nSouthFacesActive, const int nNorthFacesActive) const; 
+
+    //! Update the coordinates and the fields passed from CISM in place, on a constructed mesh 
+    void updateGeometry(
+                  const double * xyz_at_nodes_Ptr, 
+                  const double * uvel_at_nodes_Ptr, 
+                  const double * vvel_at_nodes_Ptr, 
+                  const double * beta_at_nodes_Ptr, 
+                  const double * surf_height_at_nodes_Ptr, 
+                  const double * dsurf_height_at_nodes_dx_Ptr, 
+                  const double * dsurf_height_at_nodes_dy_Ptr, 
+                  const double * thick_at_nodes_Ptr, 
+                  const double * flwa_at_active_elements_Ptr);
+
     //! Flag if solution has a restart values -- used in Init Cond
     bool hasRestartSolution() const {return hasRestartSol; }
 
@@ -42,6 +42,8 @@
 #include "Piro_PerformSolve.hpp"
 #include <stk_mesh/base/GetEntities.hpp>
 #include "Albany_OrdinarySTKFieldContainer.hpp"
+#include "Albany_STKDiscretization.hpp"
+#include "Teuchos_CommHelpers.hpp"
 #ifdef CISM_USE_EPETRA
 #include "Thyra_EpetraThyraWrappers.hpp"
 #endif
@@ -130,6 +132,11 @@ double *vVel_ptr;
 double *uvel_at_nodes_Ptr; 
 double *vvel_at_nodes_Ptr; 
 bool first_time_step = true;
+//With "CISM Interface"/"Keep Mesh Between Time Steps", the mesh and the Albany app
+//are kept from one time step to the next as long as the mesh topology does not change;
+//only the coordinates and the fields passed from CISM are updated in place.
+bool keepMesh = false;
+bool keptMesh = false;
 #ifdef CISM_USE_EPETRA 
   Teuchos::RCP<Epetra_Map> node_map; 
 #else
@@ -431,6 +438,34 @@ void felix_driver_init(int argc, int exec_mode, FelixToGlimmer * ftg_ptr, const
       reducedMpiComm = mpiComm;
    #endif
 #endif
+
+    nNodes = (ewn-2*nhalo+1)*(nsn-2*nhalo+1)*upn; //number of nodes in mesh (on each processor) 
+    nElementsActive = nCellsActive*(upn-1); //number of 3D active elements in mesh  
+
+#ifndef REDUCED_COMM
+    //Reuse the mesh of the previous time step if no processor has a different mesh topology.
+    //With REDUCED_COMM the set of processors taking part in the solve can change, so the mesh is always rebuilt.
+    int localSameMesh = keepMesh && keptMesh && Teuchos::nonnull(meshStruct) &&
+        meshStruct->hasSameTopology(global_node_id_owned_map_Ptr, global_element_id_active_owned_map_Ptr,
+                                    global_element_conn_active_Ptr, global_basal_face_id_active_owned_map_Ptr,
+                                    global_west_face_id_active_owned_map_Ptr, global_east_face_id_active_owned_map_Ptr,
+                                    global_south_face_id_active_owned_map_Ptr, global_north_face_id_active_owned_map_Ptr,
+                                    dirichlet_node_mask_Ptr, nNodes, nElementsActive, nCellsActive,
+                                    nWestFacesActive, nEastFacesActive, nSouthFacesActive, nNorthFacesActive);
+    int sameMesh = 0;
+    Teuchos::reduceAll<int, int>(*mpiCommT, Teuchos::REDUCE_MIN, localSameMesh, Teuchos::outArg(sameMesh));
+    if (sameMesh) {
+      if (debug_output_verbosity != 0 & mpiCommT->getRank() == 0) 
+        std::cout << "In felix_driver: mesh topology unchanged, updating geometry in place..." << std::endl;
+      meshStruct->updateGeometry(xyz_at_nodes_Ptr, uvel_at_nodes_Ptr, vvel_at_nodes_Ptr, beta_at_nodes_Ptr,
+                                 surf_height_at_nodes_Ptr, dsurf_height_at_nodes_dx_Ptr, dsurf_height_at_nodes_dy_Ptr,
+                                 thick_at_nodes_Ptr, flwa_at_active_elements_Ptr);
+      return;
+    }
+#endif
+    keptMesh = false;
+    meshStruct = Teuchos::null;
+    albanyApp = Teuchos::null;
  
     
 
@@ -444,6 +479,7 @@ void felix_driver_init(int argc, int exec_mode, FelixToGlimmer * ftg_ptr, const
     parameterList = Teuchos::rcp(&slvrfctry->getParameters(),false);
     discParams = Teuchos::sublist(parameterList, "Discretization", true);
     discParams->set<bool>("Output DTK Field to Exodus", true);
+    keepMesh = parameterList->sublist("CISM Interface").get("Keep Mesh Between Time Steps", false);
     Albany::AbstractFieldContainer::FieldContainerRequirements req;
     int neq = 2; //number of equations - 2 for FO Stokes
     //IK, 11/14/13, debug output: check that pointers that are passed from CISM are not null 
@@ -470,9 +506,6 @@ void felix_driver_init(int argc, int exec_mode, FelixToGlimmer * ftg_ptr, const
     //std::cout << "DEBUG: global_north_face_conn_active_Ptr: " << global_north_face_conn_active_Ptr << std::endl; 
     //std::cout << "DEBUG: global_north_face_id_active_owned_map_Ptr: " << global_north_face_id_active_owned_map_Ptr << std::endl;
 
-    nNodes = (ewn-2*nhalo+1)*(nsn-2*nhalo+1)*upn; //number of nodes in mesh (on each processor) 
-    nElementsActive = nCellsActive*(upn-1); //number of 3D active elements in mesh  
-   
 /*    std::string beta_name = "basal_friction";
     Teuchos::Array<std::string> arrayBasalFields(1, beta_name);
     Teuchos::Array<std::string> arraySideSets(1, "Basal");
@@ -757,7 +790,12 @@ void felix_driver_run(FelixToGlimmer * ftg_ptr, double& cur_time_yr, double time
        }
     }
 
-    albanyApp->createDiscretization();
+    if (!keptMesh) {
+      albanyApp->createDiscretization();
+    } else {
+      auto stk_disc = Teuchos::rcp_dynamic_cast<Albany::STKDiscretization>(albanyApp->getDiscretization());
+      stk_disc->updateMesh();
+    }
     albanyApp->finalSetUp(parameterList); 
 
     //IK, 10/30/14: Check that # of elements from previous time step hasn't changed. 
@@ -1038,14 +1076,20 @@ void felix_driver_run(FelixToGlimmer * ftg_ptr, double& cur_time_yr, double time
 
 
     first_time_step = false;
-    meshStruct = Teuchos::null;
-    albanyApp = Teuchos::null;
+    keptMesh = keepMesh;
+    if (!keptMesh) {
+      meshStruct = Teuchos::null;
+      albanyApp = Teuchos::null;
+    }
     solver = Teuchos::null;
 #ifdef CISM_USE_EPETRA
     mpiComm = Teuchos::null; 
     reducedMpiComm = Teuchos::null;
 #endif
     if (cur_time_yr == final_time) {
+      keptMesh = false;
+      meshStruct = Teuchos::null;
+      albanyApp = Teuchos::null;
       mpiCommT = Teuchos::null; 
       reducedMpiCommT = Teuchos::null;
       parameterList = Teuchos::null;
@@ -48,6 +48,14 @@ bool MPAS_useGLP(true);
 #endif
 bool keptMesh =false;
 
+//Persistent session: with "MPAS Interface"/"Persistent Solver Session", the
+//solver built by the first call is reused by the next calls on the same mesh,
+//as long as Piro keeps solving with NOX. Only the coefficients and the initial
+//guess stored in the mesh fields are refreshed.
+std::string persistentSolverType;
+Teuchos::RCP<Tpetra_Import> persistentImport;
+Teuchos::RCP<Tpetra_Vector> persistentSolution;
+
 typedef struct TET_ {
   int verts[4];
   int neighbours[4];
@@ -188,6 +196,13 @@ void velocity_solver_solve_fo(int nLayers, int nGlobalVertices,
 
 
 
+  const bool persistentSession = paramList->sublist("MPAS Interface").get("Persistent Solver Session", false);
+  const std::string solverType = paramList->sublist("Piro").isParameter("Solver Type") ?
+      paramList->sublist("Piro").get<std::string>("Solver Type") : "";
+  const bool reuseSolver = persistentSession && keptMesh && Teuchos::nonnull(solver) &&
+      Teuchos::nonnull(slvrfctry->returnModelT()) && (solverType == "NOX") &&
+      (solverType == persistentSolverType);
+
   if(!keptMesh) {
     albanyApp->createDiscretization();
   } else {
@@ -195,17 +210,38 @@ void velocity_solver_solve_fo(int nLayers, int nGlobalVertices,
     auto stk_disc = Teuchos::rcp_dynamic_cast<Albany::STKDiscretization>(abs_disc);
     stk_disc->updateMesh();
   }
-  albanyApp->finalSetUp(paramList);
+
+  if (reuseSolver) {
+    //The field managers read the coefficients from the mesh fields. Refresh
+    //the initial guess and the distributed parameters, which are copied.
+    auto disc = albanyApp->getDiscretization();
+    const Teuchos::RCP<Thyra::VectorBase<double> > x_nominal =
+        Teuchos::rcp_const_cast<Thyra::VectorBase<double> >(
+            slvrfctry->returnModelT()->getNominalValues().get_x());
+    ConverterT::getTpetraVector(x_nominal)->assign(*disc->getSolutionFieldT());
+    const Albany::StateInfoStruct& distParamSIS = disc->getNodalParameterSIS();
+    for (int is = 0; is < distParamSIS.size(); is++) {
+      const std::string& param_name = distParamSIS[is]->name;
+      disc->getFieldT(*albanyApp->getDistParamLib()->get(param_name)->vector(), param_name);
+    }
+  } else {
+    albanyApp->finalSetUp(paramList);
+  }
 
   bool success = true;
   Teuchos::ArrayRCP<const ST> solution_constView;
   Teuchos::RCP<const Tpetra_Map> overlapMap;
   try {
+  if (!reuseSolver) {
 #ifdef MPAS_USE_EPETRA
   solver = slvrfctry->createThyraSolverAndGetAlbanyApp(albanyApp, mpiCommT, mpiCommT, Teuchos::null, false);
 #else
    solver = slvrfctry->createAndGetAlbanyAppT(albanyApp, mpiCommT, mpiCommT, Teuchos::null, false);
 #endif
+    persistentSolverType = solverType;
+    persistentImport = Teuchos::null;
+    persistentSolution = Teuchos::null;
+  }
 
   Teuchos::ParameterList solveParams;
   solveParams.set("Compute Sensitivities", false);
@@ -217,10 +253,12 @@ void velocity_solver_solve_fo(int nLayers, int nGlobalVertices,
       thyraSensitivities);
 
   overlapMap = albanyApp->getDiscretization()->getOverlapMapT();
-  Teuchos::RCP<Tpetra_Import> import = Teuchos::rcp(new Tpetra_Import(albanyApp->getDiscretization()->getMapT(), overlapMap));
-  Teuchos::RCP<Tpetra_Vector> solution = Teuchos::rcp(new Tpetra_Vector(overlapMap));
-  solution->doImport(*albanyApp->getDiscretization()->getSolutionFieldT(), *import, Tpetra::INSERT);
-  solution_constView = solution->get1dView();
+  if (persistentImport.is_null() || !persistentSession) {
+    persistentImport = Teuchos::rcp(new Tpetra_Import(albanyApp->getDiscretization()->getMapT(), overlapMap));
+    persistentSolution = Teuchos::rcp(new Tpetra_Vector(overlapMap));
+  }
+  persistentSolution->doImport(*albanyApp->getDiscretization()->getSolutionFieldT(), *persistentImport, Tpetra::INSERT);
+  solution_constView = persistentSolution->get1dView();
   }
   TEUCHOS_STANDARD_CATCH_STATEMENTS(true, std::cerr, success);
 
@@ -292,6 +330,9 @@ void velocity_solver_finalize() {
 
 void velocity_solver_compute_2d_grid(MPI_Comm reducedComm) {
   keptMesh = false;
+  solver = Teuchos::null;
+  persistentImport = Teuchos::null;
+  persistentSolution = Teuchos::null;
   mpiCommT = Albany::createTeuchosCommFromMpiComm(reducedComm);
 }
 
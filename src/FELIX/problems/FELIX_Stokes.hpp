@@ -38,6 +38,13 @@ namespace FELIX {
     //! Get boolean telling code if SDBCs are utilized  
     virtual bool useSDBCs() const {return use_sdbcs_; }
 
+    //! Velocity and pressure blocks
+    virtual std::vector<int> getUnknownBlocking() const {
+      std::vector<int> blocking;
+      if (haveFlowEq) { blocking.push_back(numDim); blocking.push_back(1); }
+      return blocking;
+    }
+
     //! Build the PDE instantiations, boundary conditions, and initial solution
     virtual void buildProblem(
       Teuchos::ArrayRCP<Teuchos::RCP<Albany::MeshSpecsStruct> >  meshSpecs,
@@ -35,6 +35,14 @@ public:
 
   void evaluateFields(typename Traits::EvalData d);
 
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct HydrideCResid_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, HydrideCResid_Tag> HydrideCResid_Policy;
+
+  //! Residual of one cell, in a single pass over its QPs
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const HydrideCResid_Tag& tag, const int& cell) const;
+
   ScalarT& getValue(const std::string &n);
 
 private:
@@ -53,8 +61,6 @@ private:
   // Output:
   PHX::MDField<ScalarT,Cell,Node> cResidual;
 
-  Kokkos::DynRankView<ScalarT, PHX::Device> gamma_term;
-
   unsigned int numQPs, numDims, numNodes, worksetSize;
 
   ScalarT gamma;
@@ -72,39 +72,53 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(stressTerm,fm);
   if(haveNoise)
     this->utils.setFieldData(noiseTerm,fm);
-    
-  gamma_term  = Kokkos::createDynRankView(cGrad.get_view(), "gamma_term", worksetSize, numQPs, numDims);   
 
   this->utils.setFieldData(cResidual,fm);
 }
 
 //**********************************************************************
 template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
 void HydrideCResid<EvalT, Traits>::
-evaluateFields(typename Traits::EvalData workset)
+operator() (const HydrideCResid_Tag& tag, const int& cell) const
 {
 
 // Form Equation 2.2
 
-  typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
-
-  for (std::size_t cell=0; cell < workset.numCells; ++cell) 
-    for (std::size_t qp=0; qp < numQPs; ++qp) 
-      for (std::size_t i=0; i < numDims; ++i) 
-
-        gamma_term(cell, qp, i) = cGrad(cell,qp,i) * gamma; 
+// The sources are summed once per QP and contracted with wBF in the same
+// pass as the gradient term, instead of one integrate per term.
 
-  FST::integrate(cResidual.get_view(), gamma_term, wGradBF.get_view(), false); // "false" overwrites
+  for (std::size_t node=0; node < numNodes; ++node)
+    cResidual(cell, node) = 0.0;
 
-  FST::integrate(cResidual.get_view(), chemTerm.get_view(), wBF.get_view(), true); // "true" sums into
+  for (std::size_t qp=0; qp < numQPs; ++qp) {
 
-  FST::integrate(cResidual.get_view(), stressTerm.get_view(), wBF.get_view(), true); // "true" sums into
+    ScalarT source = chemTerm(cell, qp) + stressTerm(cell, qp);
+    if(haveNoise)
+      source += noiseTerm(cell, qp);
 
-  if(haveNoise)
+    for (std::size_t node=0; node < numNodes; ++node) {
+      ScalarT gradTerm = cGrad(cell, qp, 0) * wGradBF(cell, node, qp, 0);
+      for (std::size_t i=1; i < numDims; ++i)
+        gradTerm += cGrad(cell, qp, i) * wGradBF(cell, node, qp, i);
 
-    FST::integrate(cResidual.get_view(), noiseTerm.get_view(), wBF.get_view(), true); // "true" sums into
+      cResidual(cell, node) += gamma * gradTerm + source * wBF(cell, node, qp);
+    }
+  }
 
+}
 
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void HydrideCResid<EvalT, Traits>::
+evaluateFields(typename Traits::EvalData workset)
+{
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  for (int cell=0; cell < workset.numCells; ++cell)
+    (*this)(HydrideCResid_Tag(), cell);
+#else
+  Kokkos::parallel_for(this->getName(), HydrideCResid_Policy(0, workset.numCells), *this);
+#endif
 }
 
 template<typename EvalT, typename Traits>
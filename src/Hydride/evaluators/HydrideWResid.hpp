@@ -33,6 +33,14 @@ public:
 
   void evaluateFields(typename Traits::EvalData d);
 
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct HydrideWResid_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, HydrideWResid_Tag> HydrideWResid_Policy;
+
+  //! Residual of one cell, in a single pass over its QPs
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const HydrideWResid_Tag& tag, const int& cell) const;
+
 private:
 
   typedef typename EvalT::ScalarT ScalarT;
@@ -71,47 +71,45 @@ postRegistrationSetup(typename Traits::SetupData d,
 }
 
 template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
 void HydrideWResid<EvalT, Traits>::
-evaluateFields(typename Traits::EvalData workset)
+operator() (const HydrideWResid_Tag& tag, const int& cell) const
 {
-  typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
-
-  FST::integrate(wResidual.get_view(), wGrad.get_view(), wGradBF.get_view(), false); // "false" overwrites
+  for (std::size_t node=0; node < numNodes; ++node)
+    wResidual(cell, node) = 0.0;
 
-  if(!lump){
-    // Consistent mass matrix, the Intrepid2 way
-    FST::integrate(wResidual.get_view(), cDot.get_view(), wBF.get_view(), true); // "true" sums into
+  for (std::size_t qp=0; qp < numQPs; ++qp) {
 
-    // Consistent mass matrix, done manually
-/*
-    for (std::size_t cell=0; cell < workset.numCells; ++cell) 
+    // Lumped mass matrix: lump all the row onto the diagonal
+    MeshScalarT diag = 0.0;
+    if(lump)
       for (std::size_t node=0; node < numNodes; ++node)
-       for (std::size_t qp=0; qp < numQPs; ++qp) 
-
-         wResidual(cell, node) += cDot(cell, qp) * wBF(cell, node, qp);
-*/
-  }
-  else {
-
-   ScalarT diag;
-
-    // Lumped mass matrix
-   for (std::size_t cell=0; cell < workset.numCells; ++cell) 
-     for (std::size_t qp=0; qp < numQPs; ++qp) {
-
-       diag = 0;
-       for (std::size_t node=0; node < numNodes; ++node)
-
-          diag += BF(cell, node, qp); // lump all the row onto the diagonal
-
-       for (std::size_t node=0; node < numNodes; ++node)
-
-          wResidual(cell, node) += diag * cDotNode(cell, node) * wBF(cell, node, qp);
-
-     }
-
+        diag += BF(cell, node, qp);
+
+    for (std::size_t node=0; node < numNodes; ++node) {
+      ScalarT gradTerm = wGrad(cell, qp, 0) * wGradBF(cell, node, qp, 0);
+      for (std::size_t i=1; i < numDims; ++i)
+        gradTerm += wGrad(cell, qp, i) * wGradBF(cell, node, qp, i);
+
+      if(!lump)
+        wResidual(cell, node) += gradTerm + cDot(cell, qp) * wBF(cell, node, qp);
+      else
+        wResidual(cell, node) += gradTerm + diag * cDotNode(cell, node) * wBF(cell, node, qp);
+    }
   }
+}
 
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void HydrideWResid<EvalT, Traits>::
+evaluateFields(typename Traits::EvalData workset)
+{
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  for (int cell=0; cell < workset.numCells; ++cell)
+    (*this)(HydrideWResid_Tag(), cell);
+#else
+  Kokkos::parallel_for(this->getName(), HydrideWResid_Policy(0, workset.numCells), *this);
+#endif
 }
 
 //**********************************************************************
@@ -59,6 +59,9 @@ namespace LCM {
     //! Input: Parametrization sweep interval
     double parametrization_interval_;
 
+    //! Input: skip the minimization where the tangent is positive definite
+    bool screen_elliptic_points_;
+
     //! Input: material tangent
     PHX::MDField<const ScalarT,Cell,QuadPoint,Dim,Dim,Dim,Dim> tangent_;
 
@@ -77,6 +80,14 @@ namespace LCM {
     //! number of spatial dimensions
     int num_dims_;
 
+    ///
+    /// Gershgorin lower bound of the smallest eigenvalue of the tangent,
+    /// seen as a symmetric operator on second-order tensors. If positive,
+    /// the tangent is strongly elliptic and det(A(n)) >= bound^3 for all n.
+    ///
+    ScalarT
+    tangent_eigenvalue_bound(minitensor::Tensor4<ScalarT, 3> const & tangent);
+
     ///
     /// Spherical parametrization sweep
     ///
@@ -22,6 +22,7 @@ namespace LCM {
                    const Teuchos::RCP<Albany::Layouts>& dl) :
     parametrization_type_(p.get<std::string>("Parametrization Type Name")),
     parametrization_interval_(p.get<double>("Parametrization Interval Name")),
+    screen_elliptic_points_(p.get<bool>("Screen Elliptic Points", false)),
     tangent_(p.get<std::string>("Material Tangent Name"),dl->qp_tensor4),
     ellipticity_flag_(p.get<std::string>("Ellipticity Flag Name"),dl->qp_scalar),
     direction_(p.get<std::string>("Bifurcation Direction Name"),dl->qp_vector),
@@ -71,6 +72,23 @@ namespace LCM {
 
         double interval = parametrization_interval_;
 
+        // Points whose tangent is positive definite cannot bifurcate, so
+        // skip the minimization and report the lower bound of min detA.
+        // The direction is left at that of the previous point.
+        if (screen_elliptic_points_ == true) {
+          ScalarT const
+          bound = tangent_eigenvalue_bound(tangent);
+
+          if (bound > 0.0) {
+            ellipticity_flag_(cell,pt) = true;
+            min_detA_(cell,pt) = bound * bound * bound;
+            for (int i(0); i < num_dims_; ++i) {
+              direction_(cell,pt,i) = direction(i);
+            }
+            continue;
+          }
+        }
+
         if (parametrization_type_ == "Oliver") {
 
           boost::tie(ellipticity_flag, direction)
@@ -188,6 +206,39 @@ namespace LCM {
 
   }
 
+  //----------------------------------------------------------------------------
+  template<typename EvalT, typename Traits>
+  typename EvalT::ScalarT BifurcationCheck<EvalT, Traits>::
+  tangent_eigenvalue_bound(minitensor::Tensor4<ScalarT, 3> const & tangent)
+  {
+    // Rows (i,j) and columns (k,l) of the 9x9 matrix of the symmetric part
+    // (C_ijkl + C_klij) / 2
+    ScalarT
+    bound = Teuchos::ScalarTraits<RealType>::rmax();
+
+    for (int i(0); i < 3; ++i) {
+      for (int j(0); j < 3; ++j) {
+        ScalarT
+        off_diagonal = 0.0;
+
+        for (int k(0); k < 3; ++k) {
+          for (int l(0); l < 3; ++l) {
+            if (k == i && l == j) continue;
+            off_diagonal +=
+                std::abs(0.5 * (tangent(i,j,k,l) + tangent(k,l,i,j)));
+          }
+        }
+
+        ScalarT const
+        row_bound = tangent(i,j,i,j) - off_diagonal;
+
+        if (row_bound < bound) bound = row_bound;
+      }
+    }
+
+    return bound;
+  }
+
   //----------------------------------------------------------------------------
   template<typename EvalT, typename Traits>
   typename EvalT::ScalarT BifurcationCheck<EvalT, Traits>::
@@ -49,6 +49,9 @@ public:
   void
   computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val);
 
+  void
+  locateNodeSetPoints();
+
 #if defined(ALBANY_DTK)
   Teuchos::RCP<Tpetra::MultiVector<double, int, DataTransferKit::SupportId>>
   computeBCsDTK();
@@ -138,6 +141,27 @@ protected:
 
   int
   coupled_app_index_;
+
+  // Element of the coupled application that contains a node set node and
+  // the shape function values of that element at the node.
+  struct PointLocation
+  {
+    int
+    workset{-1};
+
+    int
+    element{-1};
+
+    std::vector<RealType>
+    basis_values;
+  };
+
+  std::vector<PointLocation>
+  point_locations_;
+
+  // Coupled discretization for which point_locations_ were computed.
+  Albany::AbstractDiscretization const *
+  located_coupled_disc_{nullptr};
 };
 
 //
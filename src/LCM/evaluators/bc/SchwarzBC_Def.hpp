@@ -70,13 +70,17 @@ SchwarzBC_Base(Teuchos::ParameterList & p) :
 }
 
 //
-//
+// Locate the node set nodes of this application in the elements of the
+// coupled application. The element and the basis function values at the
+// parametric coordinates of each node are cached, so that subsequent
+// Schwarz iterations only need to re-interpolate the coupled solution.
+// Candidate elements are found through a uniform grid of element bounding
+// boxes instead of scanning every element of the coupled discretization.
 //
 template<typename EvalT, typename Traits>
-template<typename T>
 void
 SchwarzBC_Base<EvalT, Traits>::
-computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
+locateNodeSetPoints()
 {
   auto const
   coupled_app_index = getCoupledAppIndex();
@@ -84,16 +88,6 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
   Albany::Application const &
   coupled_app = getApplication(coupled_app_index);
 
-  Teuchos::RCP<Tpetra_Vector const>
-  coupled_solution = coupled_app.getX();
-
-  if (coupled_solution == Teuchos::null) {
-    x_val = 0.0;
-    y_val = 0.0;
-    z_val = 0.0;
-    return;
-  }
-
   auto const
   this_app_index = getThisAppIndex();
 
@@ -181,17 +175,6 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
   auto const &
   ws_elem_to_node_id = coupled_stk_disc->getWsElNodeID();
 
-  std::vector<minitensor::Vector<double>>
-  coupled_element_nodes(coupled_node_count);
-
-  std::vector<minitensor::Vector<double>>
-  coupled_element_solution(coupled_node_count);
-
-  for (auto i = 0; i < coupled_node_count; ++i) {
-    coupled_element_nodes[i].set_dimension(coupled_dimension);
-    coupled_element_solution[i].set_dimension(coupled_dimension);
-  }
-
   // This tolerance is used for geometric approximations. It will be used
   // to determine whether a node of this_app is inside an element of
   // coupled_app within that tolerance.
@@ -236,25 +219,142 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
     break;
   }
 
-  double * const
-  coord = ns_coord[ns_node];
+  Teuchos::ArrayRCP<double> const &
+  coupled_coordinates = coupled_stk_disc->getCoordinates();
+
+  Teuchos::RCP<Tpetra_Map const>
+  coupled_overlap_node_map = coupled_stk_disc->getOverlapNodeMapT();
+
+  // Bounding boxes of the candidate elements, padded by the tolerance.
+  std::vector<std::pair<int, int>>
+  elements;
+
+  std::vector<minitensor::Vector<double>>
+  box_lo;
+
+  std::vector<minitensor::Vector<double>>
+  box_hi;
 
   minitensor::Vector<double>
-  point;
+  domain_lo(coupled_dimension, minitensor::Filler::ZEROS);
 
-  point.set_dimension(coupled_dimension);
+  minitensor::Vector<double>
+  domain_hi(coupled_dimension, minitensor::Filler::ZEROS);
 
-  point.fill(coord);
+  for (auto workset = 0; workset < ws_elem_to_node_id.size(); ++workset) {
 
-  // Determine the element that contains this point.
-  Teuchos::ArrayRCP<double> const &
-  coupled_coordinates = coupled_stk_disc->getCoordinates();
+    std::string const &
+    coupled_element_block = coupled_ws_eb_names[workset];
 
-  Teuchos::ArrayRCP<ST const>
-  coupled_solution_view = coupled_solution->get1dView();
+    bool const
+    block_names_differ = coupled_element_block != coupled_block_name;
 
-  Teuchos::RCP<Tpetra_Map const>
-  coupled_overlap_node_map = coupled_stk_disc->getOverlapNodeMapT();
+    if (use_block == true && block_names_differ == true) continue;
+
+    auto const
+    elements_per_workset = ws_elem_to_node_id[workset].size();
+
+    for (auto element = 0; element < elements_per_workset; ++element) {
+
+      minitensor::Vector<double>
+      elem_lo(coupled_dimension);
+
+      minitensor::Vector<double>
+      elem_hi(coupled_dimension);
+
+      for (auto node = 0; node < coupled_node_count; ++node) {
+
+        auto const
+        global_node_id = ws_elem_to_node_id[workset][element][node];
+
+        auto const
+        local_node_id =
+            coupled_overlap_node_map->getLocalElement(global_node_id);
+
+        for (auto i = 0; i < coupled_dimension; ++i) {
+          double const
+          x = coupled_coordinates[coupled_dimension * local_node_id + i];
+
+          elem_lo(i) = node == 0 ? x : std::min(elem_lo(i), x);
+          elem_hi(i) = node == 0 ? x : std::max(elem_hi(i), x);
+        }
+      }
+
+      minitensor::Vector<double> const
+      padding = tolerance * (elem_hi - elem_lo);
+
+      elem_lo -= padding;
+      elem_hi += padding;
+
+      for (auto i = 0; i < coupled_dimension; ++i) {
+        bool const
+        first = elements.empty();
+
+        domain_lo(i) = first == true ? elem_lo(i) : std::min(domain_lo(i), elem_lo(i));
+        domain_hi(i) = first == true ? elem_hi(i) : std::max(domain_hi(i), elem_hi(i));
+      }
+
+      elements.push_back(std::make_pair(workset, element));
+      box_lo.push_back(elem_lo);
+      box_hi.push_back(elem_hi);
+
+    } // element loop
+
+  } // workset loop
+
+  // Uniform grid with about one element per bin.
+  auto const
+  number_elements = elements.size();
+
+  int const
+  bins_per_dimension = std::max(1, static_cast<int>(std::ceil(
+      std::pow(static_cast<double>(number_elements),
+          1.0 / coupled_dimension))));
+
+  minitensor::Vector<double> const
+  bin_size = (domain_hi - domain_lo) / static_cast<double>(bins_per_dimension);
+
+  auto
+  bin_index = [&](int const i, double const x)
+  {
+    if (bin_size(i) <= 0.0) return 0;
+    int const
+    b = static_cast<int>(std::floor((x - domain_lo(i)) / bin_size(i)));
+    return std::min(std::max(b, 0), bins_per_dimension - 1);
+  };
+
+  int
+  number_bins = 1;
+
+  for (auto i = 0; i < coupled_dimension; ++i) {
+    number_bins *= bins_per_dimension;
+  }
+
+  std::vector<std::vector<int>>
+  bins(number_bins);
+
+  for (auto e = 0; e < number_elements; ++e) {
+    int
+    b_lo[3] = {0, 0, 0};
+
+    int
+    b_hi[3] = {0, 0, 0};
+
+    for (auto i = 0; i < coupled_dimension; ++i) {
+      b_lo[i] = bin_index(i, box_lo[e](i));
+      b_hi[i] = bin_index(i, box_hi[e](i));
+    }
+
+    for (auto k = b_lo[2]; k <= b_hi[2]; ++k) {
+      for (auto j = b_lo[1]; j <= b_hi[1]; ++j) {
+        for (auto i = b_lo[0]; i <= b_hi[0]; ++i) {
+          auto const
+          bin = (k * bins_per_dimension + j) * bins_per_dimension + i;
+          bins[bin].push_back(e);
+        }
+      }
+    }
+  }
 
   // We do this element by element
   auto const
@@ -272,10 +372,6 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
       number_points,
       parametric_dimension);
 
-  for (auto j = 0; j < parametric_dimension; ++j) {
-    parametric_point(0, 0, j) = 0.0;
-  }
-
   // Container for the physical point
   Kokkos::DynRankView<RealType, PHX::Device>
   physical_coordinates(
@@ -284,10 +380,6 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
       number_points,
       coupled_dimension);
 
-  for (auto i = 0; i < coupled_dimension; ++i) {
-    physical_coordinates(0, 0, i) = point(i);
-  }
-
   // Container for the physical nodal coordinates
   Kokkos::DynRankView<RealType, PHX::Device>
   nodal_coordinates(
@@ -296,23 +388,57 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
       coupled_node_count,
       coupled_dimension);
 
-  bool
-  found = false;
+  // Basis function values at the parametric point.
+  Kokkos::DynRankView<RealType, PHX::Device>
+  basis_values("basis", coupled_node_count, number_points);
+
+  // Another container for the parametric coordinates. Needed because above
+  // it is required that parametric_points has rank 3 for mapToReferenceFrame
+  // but here basis->getValues requires a rank 2 view :(
+  Kokkos::DynRankView<RealType, PHX::Device>
+  pp_reduced("par_point", number_points, parametric_dimension);
 
-  for (auto workset = 0; workset < ws_elem_to_node_id.size(); ++workset) {
+  auto const
+  ns_number_nodes = ns_coord.size();
 
-    std::string const &
-    coupled_element_block = coupled_ws_eb_names[workset];
+  point_locations_.clear();
+  point_locations_.resize(ns_number_nodes);
 
-    bool const
-    block_names_differ = coupled_element_block != coupled_block_name;
+  for (auto ns_node = 0; ns_node < ns_number_nodes; ++ns_node) {
 
-    if (use_block == true && block_names_differ == true) continue;
+    double * const
+    coord = ns_coord[ns_node];
 
-    auto const
-    elements_per_workset = ws_elem_to_node_id[workset].size();
+    for (auto i = 0; i < coupled_dimension; ++i) {
+      physical_coordinates(0, 0, i) = coord[i];
+    }
 
-    for (auto element = 0; element < elements_per_workset; ++element) {
+    int
+    bin = 0;
+
+    for (int i = coupled_dimension - 1; i >= 0; --i) {
+      bin = bin * bins_per_dimension + bin_index(i, coord[i]);
+    }
+
+    bool
+    found = false;
+
+    for (auto e : bins[bin]) {
+
+      bool
+      in_box = true;
+
+      for (auto i = 0; i < coupled_dimension; ++i) {
+        in_box = in_box && box_lo[e](i) <= coord[i] && coord[i] <= box_hi[e](i);
+      }
+
+      if (in_box == false) continue;
+
+      auto const
+      workset = elements[e].first;
+
+      auto const
+      element = elements[e].second;
 
       for (auto node = 0; node < coupled_node_count; ++node) {
 
@@ -323,21 +449,9 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
         local_node_id =
             coupled_overlap_node_map->getLocalElement(global_node_id);
 
-        double * const
-        pcoord = &(coupled_coordinates[coupled_dimension * local_node_id]);
-
-        coupled_element_nodes[node].fill(pcoord);
-
-        for (auto i = 0; i < coupled_dimension; ++i) {
-          coupled_element_solution[node](i) =
-              coupled_solution_view[coupled_dimension * local_node_id + i];
-        } // dimension loop
-
-      } // node loop
-
-      for (auto i = 0; i < coupled_node_count; ++i) {
         for (auto j = 0; j < coupled_dimension; ++j) {
-          nodal_coordinates(0, i, j) = coupled_element_nodes[i](j);
+          nodal_coordinates(0, node, j) =
+              coupled_coordinates[coupled_dimension * local_node_id + j];
         }
       }
 
@@ -357,43 +471,109 @@ computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
         in_element = in_element && lo(i) <= xi && xi <= hi(i);
       }
 
-      if (in_element == true) {
-        found = true;
-        break;
+      if (in_element == false) continue;
+
+      found = true;
+
+      // Evaluate shape functions at parametric point.
+      for (auto j = 0; j < parametric_dimension; ++j) {
+        pp_reduced(0, j) = parametric_point(0, 0, j);
       }
+      basis->getValues(basis_values, pp_reduced, Intrepid2::OPERATOR_VALUE);
 
-    } // element loop
+      PointLocation &
+      location = point_locations_[ns_node];
+
+      location.workset = workset;
+      location.element = element;
+      location.basis_values.resize(coupled_node_count);
+
+      for (auto i = 0; i < coupled_node_count; ++i) {
+        location.basis_values[i] = basis_values(i, 0);
+      }
 
-    if (found == true) {
       break;
-    }
 
-  } // workset loop
+    } // candidate element loop
 
-  ALBANY_EXPECT(found == true);
+    ALBANY_EXPECT(found == true);
 
-  // Evaluate shape functions at parametric point.
-  Kokkos::DynRankView<RealType, PHX::Device>
-  basis_values("basis", coupled_node_count, number_points);
+  } // node set node loop
 
-  // Another container for the parametric coordinates. Needed because above
-  // it is required that parametric_points has rank 3 for mapToReferenceFrame
-  // but here basis->getValues requires a rank 2 view :(
-  Kokkos::DynRankView<RealType, PHX::Device>
-  pp_reduced("par_point", number_points, parametric_dimension);
+  located_coupled_disc_ = coupled_disc.get();
+}
+
+//
+//
+//
+template<typename EvalT, typename Traits>
+template<typename T>
+void
+SchwarzBC_Base<EvalT, Traits>::
+computeBCs(size_t const ns_node, T & x_val, T & y_val, T & z_val)
+{
+  auto const
+  coupled_app_index = getCoupledAppIndex();
+
+  Albany::Application const &
+  coupled_app = getApplication(coupled_app_index);
+
+  Teuchos::RCP<Tpetra_Vector const>
+  coupled_solution = coupled_app.getX();
+
+  if (coupled_solution == Teuchos::null) {
+    x_val = 0.0;
+    y_val = 0.0;
+    z_val = 0.0;
+    return;
+  }
+
+  Teuchos::RCP<Albany::AbstractDiscretization>
+  coupled_disc = coupled_app.getDiscretization();
 
-  for (auto j = 0; j < parametric_dimension; ++j) {
-    pp_reduced(0, j) = parametric_point(0, 0, j);
+  // Locate the node set nodes once per coupled discretization. A new
+  // discretization after a mesh update invalidates the cached locations.
+  if (located_coupled_disc_ != coupled_disc.get()) {
+    locateNodeSetPoints();
   }
-  basis->getValues(basis_values, pp_reduced, Intrepid2::OPERATOR_VALUE);
 
-  // Evaluate solution at parametric point using values of shape
-  // functions just computed.
+  PointLocation const &
+  location = point_locations_[ns_node];
+
+  auto const
+  coupled_dimension = coupled_disc->getNumDim();
+
+  auto const &
+  ws_elem_to_node_id = coupled_disc->getWsElNodeID();
+
+  Teuchos::RCP<Tpetra_Map const>
+  coupled_overlap_node_map = coupled_disc->getOverlapNodeMapT();
+
+  Teuchos::ArrayRCP<ST const>
+  coupled_solution_view = coupled_solution->get1dView();
+
+  // Evaluate solution at parametric point using the cached values of the
+  // shape functions.
   minitensor::Vector<double>
   value(coupled_dimension, minitensor::Filler::ZEROS);
 
-  for (auto i = 0; i < coupled_node_count; ++i) {
-    value += basis_values(i, 0) * coupled_element_solution[i];
+  auto const
+  coupled_node_count = location.basis_values.size();
+
+  for (auto node = 0; node < coupled_node_count; ++node) {
+
+    auto const
+    global_node_id =
+        ws_elem_to_node_id[location.workset][location.element][node];
+
+    auto const
+    local_node_id =
+        coupled_overlap_node_map->getLocalElement(global_node_id);
+
+    for (auto i = 0; i < coupled_dimension; ++i) {
+      value(i) += location.basis_values[node] *
+          coupled_solution_view[coupled_dimension * local_node_id + i];
+    }
   }
 
   x_val = value(0);
@@ -57,6 +57,24 @@ class DefGrad : public PHX::EvaluatorWithBaseImpl<Traits>,
 
   //! stabilization parameter for the weighted average
   ScalarT alpha;
+
+  //! number of cells of the current workset
+  int numCells;
+
+ public:  // Kokkos
+  struct defgrad_Tag {};
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, defgrad_Tag> defgrad_Policy;
+
+  ///
+  /// F, J and the weighted volume average of one cell. Cells past the
+  /// end of the workset get F = I.
+  ///
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const defgrad_Tag& tag, const int& cell) const;
 };
 }
 #endif
@@ -8,6 +8,7 @@
 #include "Teuchos_TestForException.hpp"
 
 #include "Albany_MaterialDatabase.hpp"
+#include "KinematicsKernels.hpp"
 #include "Intrepid2_FunctionSpaceTools.hpp"
 #include "Intrepid2_RealSpaceTools.hpp"
 
@@ -29,7 +30,7 @@ DefGrad<EvalT, Traits>::DefGrad(const Teuchos::ParameterList& p)
           p.get<Teuchos::RCP<PHX::DataLayout>>("QP Tensor Data Layout")),
       J(p.get<std::string>("DetDefGrad Name"),
         p.get<Teuchos::RCP<PHX::DataLayout>>("QP Scalar Data Layout")),
-      weightedAverage(false), alpha(0.05)
+      weightedAverage(false), alpha(0.05), numCells(0)
 {
   if (p.isType<bool>("Weighted Volume Average J"))
     weightedAverage = p.get<bool>("Weighted Volume Average J");
@@ -68,61 +69,65 @@ DefGrad<EvalT, Traits>::postRegistrationSetup(
 }
 //**********************************************************************
 template<typename EvalT, typename Traits>
-void
-DefGrad<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+KOKKOS_INLINE_FUNCTION void
+DefGrad<EvalT, Traits>::operator()(
+    const defgrad_Tag& tag,
+    const int&         cell) const
 {
-  // bool print = false;
-  // if (typeid(ScalarT) == typeid(RealType)) print = true;
-
-  // Compute DefGrad tensor from displacement gradient
-  for (int cell = 0; cell < workset.numCells; ++cell) {
-    for (int qp = 0; qp < numQPs; ++qp) {
-      for (int i = 0; i < numDims; ++i) {
-        for (int j = 0; j < numDims; ++j) {
-          defgrad(cell, qp, i, j) = GradU(cell, qp, i, j);
-        }
-        defgrad(cell, qp, i, i) += 1.0;
-      }
-    }
-  }
   // Since Intrepid2 will later perform calculations on the entire workset size
   // and not just the used portion, we must fill the excess with reasonable
   // values. Leaving this out leads to inversion of 0 tensors.
-  for (int cell = workset.numCells; cell < worksetSize; ++cell) {
+  if (cell >= numCells) {
     for (int qp = 0; qp < numQPs; ++qp) {
       for (int i = 0; i < numDims; ++i) {
+        for (int j = 0; j < numDims; ++j) defgrad(cell, qp, i, j) = 0.0;
         defgrad(cell, qp, i, i) = 1.0;
       }
+      J(cell, qp) = 1.0;
     }
+    return;
   }
 
-  Intrepid2::RealSpaceTools<PHX::Device>::det(J.get_view(), defgrad.get_view());
+  // Compute DefGrad tensor from displacement gradient
+  ScalarT F[3][3];
+  ScalarT Jbar = 0.0;
+  ScalarT vol  = 0.0;
+  for (int qp = 0; qp < numQPs; ++qp) {
+    for (int i = 0; i < numDims; ++i) {
+      for (int j = 0; j < numDims; ++j) F[i][j] = GradU(cell, qp, i, j);
+      F[i][i] += 1.0;
+    }
+    for (int i = 0; i < numDims; ++i)
+      for (int j = 0; j < numDims; ++j) defgrad(cell, qp, i, j) = F[i][j];
+    J(cell, qp) = kinematics::det(F, numDims);
+
+    if (weightedAverage) {
+      Jbar += weights(cell, qp) * std::log(J(cell, qp));
+      vol += weights(cell, qp);
+    }
+  }
 
   if (weightedAverage) {
-    ScalarT Jbar, wJbar, vol;
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      Jbar = 0.0;
-      vol  = 0.0;
-      for (int qp = 0; qp < numQPs; ++qp) {
-        Jbar += weights(cell, qp) * std::log(J(cell, qp));
-        vol += weights(cell, qp);
-      }
-      Jbar /= vol;
-
-      // Jbar = std::exp(Jbar);
-      for (int qp = 0; qp < numQPs; ++qp) {
-        for (int i = 0; i < numDims; ++i) {
-          for (int j = 0; j < numDims; ++j) {
-            wJbar =
-                std::exp((1 - alpha) * Jbar + alpha * std::log(J(cell, qp)));
-            defgrad(cell, qp, i, j) *= std::cbrt(wJbar / J(cell, qp));
-          }
-        }
-        J(cell, qp) = wJbar;
-      }
+    Jbar /= vol;
+    for (int qp = 0; qp < numQPs; ++qp) {
+      const ScalarT wJbar =
+          std::exp((1 - alpha) * Jbar + alpha * std::log(J(cell, qp)));
+      const ScalarT scale = std::cbrt(wJbar / J(cell, qp));
+      for (int i = 0; i < numDims; ++i)
+        for (int j = 0; j < numDims; ++j) defgrad(cell, qp, i, j) *= scale;
+      J(cell, qp) = wJbar;
     }
   }
 }
 
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void
+DefGrad<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
+{
+  numCells = workset.numCells;
+  Kokkos::parallel_for(this->getName(), defgrad_Policy(0, worksetSize), *this);
+}
+
 //**********************************************************************
 }
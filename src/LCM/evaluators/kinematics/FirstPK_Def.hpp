@@ -174,16 +174,16 @@ void FirstPK<EvalT, Traits>::evaluateFields (typename Traits::EvalData workset)
   auto start = std::chrono::high_resolution_clock::now();
 #endif
   // Copy stress_ to first_pk_stress_.
-  Kokkos::parallel_for(small_strain_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), small_strain_Policy(0,workset.numCells),*this);
   // Optionally modify the stress tensor by pressure terms.
   if (have_stab_pressure_)
-    Kokkos::parallel_for(have_stab_pressure_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), have_stab_pressure_Policy(0,workset.numCells),*this);
   if (have_pore_pressure_)
-    Kokkos::parallel_for(have_pore_pressure_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), have_pore_pressure_Policy(0,workset.numCells),*this);
   if ( ! small_strain_) {
     // For large deformation, map Cauchy stress to 1st PK stress. In the
     // small-strain case, this transformation is Identity.
-    Kokkos::parallel_for(no_small_strain_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), no_small_strain_Policy(0,workset.numCells),*this);
   }
 #ifdef ALBANY_TIMER
   PHX::Device::fence();
@@ -21,6 +21,7 @@ namespace LCM {
 ///
 ///  This evaluator computes kinematics quantities i.e.
 ///  Deformation Gradient
+///  (optional) Inverse Deformation Gradient
 ///  (optional) Velocity Gradient
 ///  (optional) Strain
 ///
@@ -65,6 +66,9 @@ class Kinematics : public PHX::EvaluatorWithBaseImpl<Traits>,
   //! Output: determinant of the deformation gradient
   PHX::MDField<ScalarT, Cell, QuadPoint> j_;
 
+  //! Output: inverse of the deformation gradient
+  PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim> def_grad_inv_;
+
   //! Output: velocity gradient
   PHX::MDField<ScalarT, Cell, QuadPoint, Dim, Dim> vel_grad_;
 
@@ -83,6 +87,9 @@ class Kinematics : public PHX::EvaluatorWithBaseImpl<Traits>,
   //! stabilization parameter for the weighted average
   ScalarT alpha_;
 
+  //! flag to compute the inverse of the deformation gradient
+  bool needs_def_grad_inv_;
+
   //! flag to compute the velocity Gradient
   bool needs_vel_grad_;
 
@@ -95,6 +102,21 @@ class Kinematics : public PHX::EvaluatorWithBaseImpl<Traits>,
   PHX::MDField<const ScalarT, Cell, Vertex, Dim> u_;
   bool
   check_det(typename Traits::EvalData d, int cell, int pt);
+
+ public:  // Kokkos
+  struct kinematics_Tag {};
+
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+
+  typedef Kokkos::RangePolicy<ExecutionSpace, kinematics_Tag> kinematics_Policy;
+
+  ///
+  /// F, J, the volume average of J, F^{-1} and the strain of one cell,
+  /// in one pass over its points
+  ///
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(const kinematics_Tag& tag, const int& cell) const;
 };
 }
 #endif
@@ -0,0 +1,70 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef KINEMATICS_KERNELS_HPP
+#define KINEMATICS_KERNELS_HPP
+
+#include <Kokkos_Core.hpp>
+
+namespace LCM {
+namespace kinematics {
+
+///
+/// Determinant of a 1x1, 2x2 or 3x3 tensor stored in a plain array, for
+/// use in Kokkos kernels where minitensor temporaries are too costly.
+///
+template<typename T>
+KOKKOS_INLINE_FUNCTION T
+det(T const A[3][3], int const dim)
+{
+  switch (dim) {
+    case 3:
+      return A[0][0] * (A[1][1] * A[2][2] - A[1][2] * A[2][1]) -
+             A[0][1] * (A[1][0] * A[2][2] - A[1][2] * A[2][0]) +
+             A[0][2] * (A[1][0] * A[2][1] - A[1][1] * A[2][0]);
+    case 2: return A[0][0] * A[1][1] - A[0][1] * A[1][0];
+    case 1: return A[0][0];
+    default:
+      Kokkos::abort("Error(LCM kinematics): det is defined for dim 1 to 3.");
+  }
+  return A[0][0];
+}
+
+///
+/// Inverse of a 1x1, 2x2 or 3x3 tensor given its determinant.
+///
+template<typename T>
+KOKKOS_INLINE_FUNCTION void
+inverse(T const A[3][3], T const& detA, int const dim, T Ainv[3][3])
+{
+  switch (dim) {
+    case 3:
+      Ainv[0][0] = (A[1][1] * A[2][2] - A[1][2] * A[2][1]) / detA;
+      Ainv[0][1] = (A[0][2] * A[2][1] - A[0][1] * A[2][2]) / detA;
+      Ainv[0][2] = (A[0][1] * A[1][2] - A[0][2] * A[1][1]) / detA;
+      Ainv[1][0] = (A[1][2] * A[2][0] - A[1][0] * A[2][2]) / detA;
+      Ainv[1][1] = (A[0][0] * A[2][2] - A[0][2] * A[2][0]) / detA;
+      Ainv[1][2] = (A[0][2] * A[1][0] - A[0][0] * A[1][2]) / detA;
+      Ainv[2][0] = (A[1][0] * A[2][1] - A[1][1] * A[2][0]) / detA;
+      Ainv[2][1] = (A[0][1] * A[2][0] - A[0][0] * A[2][1]) / detA;
+      Ainv[2][2] = (A[0][0] * A[1][1] - A[0][1] * A[1][0]) / detA;
+      break;
+    case 2:
+      Ainv[0][0] = A[1][1] / detA;
+      Ainv[0][1] = -A[0][1] / detA;
+      Ainv[1][0] = -A[1][0] / detA;
+      Ainv[1][1] = A[0][0] / detA;
+      break;
+    case 1: Ainv[0][0] = 1.0 / detA; break;
+    default:
+      Kokkos::abort("Error(LCM kinematics): inverse is defined for dim 1 to 3.");
+  }
+}
+
+}  // namespace kinematics
+}  // namespace LCM
+
+#endif  // KINEMATICS_KERNELS_HPP
@@ -6,6 +6,7 @@
 
 #include <MiniTensor.h>
 #include <PHAL_Utilities.hpp>
+#include "KinematicsKernels.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Teuchos_TestForException.hpp"
 #ifdef ALBANY_TIMER
@@ -26,7 +27,7 @@ Kinematics<EvalT, Traits>::Kinematics(
       j_(p.get<std::string>("DetDefGrad Name"), dl->qp_scalar),
       weighted_average_(p.get<bool>("Weighted Volume Average J", false)),
       alpha_(p.get<RealType>("Average J Stabilization Parameter", 0.0)),
-      needs_vel_grad_(false), needs_strain_(false)
+      needs_def_grad_inv_(false), needs_vel_grad_(false), needs_strain_(false)
 {
   if (p.isType<bool>("Velocity Gradient Flag"))
     needs_vel_grad_ = p.get<bool>("Velocity Gradient Flag");
@@ -36,6 +37,12 @@ Kinematics<EvalT, Traits>::Kinematics(
         decltype(strain_)(p.get<std::string>("Strain Name"), dl->qp_tensor);
     this->addEvaluatedField(strain_);
   }
+  if (p.isType<std::string>("Inverse DefGrad Name")) {
+    needs_def_grad_inv_ = true;
+    def_grad_inv_       = decltype(def_grad_inv_)(
+        p.get<std::string>("Inverse DefGrad Name"), dl->qp_tensor);
+    this->addEvaluatedField(def_grad_inv_);
+  }
 
   std::vector<PHX::DataLayout::size_type> dims;
   dl->qp_tensor->dimensions(dims);
@@ -76,6 +83,7 @@ Kinematics<EvalT, Traits>::postRegistrationSetup(
   this->utils.setFieldData(j_, fm);
   this->utils.setFieldData(grad_u_, fm);
   if (needs_strain_) this->utils.setFieldData(strain_, fm);
+  if (needs_def_grad_inv_) this->utils.setFieldData(def_grad_inv_, fm);
   if (needs_vel_grad_) this->utils.setFieldData(vel_grad_, fm);
   if (def_grad_rc_) this->utils.setFieldData(def_grad_rc_(), fm);
   if (def_grad_rc_) this->utils.setFieldData(u_, fm);
@@ -105,42 +113,89 @@ Kinematics<EvalT, Traits>::check_det(
   return neg_det;
 }
 
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION void
+Kinematics<EvalT, Traits>::operator()(
+    const kinematics_Tag& tag,
+    const int&            cell) const
+{
+  ScalarT F[3][3], Finv[3][3];
+  ScalarT jbar   = 0.0;
+  ScalarT volume = 0.0;
+
+  for (int pt = 0; pt < num_pts_; ++pt) {
+    for (int i = 0; i < num_dims_; ++i) {
+      for (int j = 0; j < num_dims_; ++j) F[i][j] = grad_u_(cell, pt, i, j);
+      F[i][i] += 1.0;
+    }
+    const ScalarT J = kinematics::det(F, num_dims_);
+    j_(cell, pt)    = J;
+    for (int i = 0; i < num_dims_; ++i)
+      for (int j = 0; j < num_dims_; ++j) def_grad_(cell, pt, i, j) = F[i][j];
+
+    if (weighted_average_) {
+      jbar += weights_(cell, pt) * J;
+      volume += weights_(cell, pt);
+    }
+
+    if (needs_strain_) {
+      for (int i = 0; i < num_dims_; ++i)
+        for (int j = 0; j < num_dims_; ++j)
+          strain_(cell, pt, i, j) =
+              0.5 * (grad_u_(cell, pt, i, j) + grad_u_(cell, pt, j, i));
+    }
+  }
+
+  if (weighted_average_) {
+    jbar /= volume;
+    for (int pt = 0; pt < num_pts_; ++pt) {
+      const ScalarT weighted_jbar = (1 - alpha_) * jbar + alpha_ * j_(cell, pt);
+      const ScalarT p = std::pow((weighted_jbar / j_(cell, pt)), 1. / 3.);
+      for (int i = 0; i < num_dims_; ++i)
+        for (int j = 0; j < num_dims_; ++j) def_grad_(cell, pt, i, j) *= p;
+      j_(cell, pt) = weighted_jbar;
+    }
+  }
+
+  // inverse of F, shared by e.g. the poromechanics residuals
+  if (needs_def_grad_inv_) {
+    for (int pt = 0; pt < num_pts_; ++pt) {
+      for (int i = 0; i < num_dims_; ++i)
+        for (int j = 0; j < num_dims_; ++j) F[i][j] = def_grad_(cell, pt, i, j);
+      kinematics::inverse(F, j_(cell, pt), num_dims_, Finv);
+      for (int i = 0; i < num_dims_; ++i)
+        for (int j = 0; j < num_dims_; ++j)
+          def_grad_inv_(cell, pt, i, j) = Finv[i][j];
+    }
+  }
+}
+
 template<typename EvalT, typename Traits>
 void
 Kinematics<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 {
+  // Without RCU, all the kinematics of a cell are computed in one kernel
+  if (!def_grad_rc_) {
+    Kokkos::parallel_for(
+        this->getName(), kinematics_Policy(0, workset.numCells), *this);
+    return;
+  }
+
   minitensor::Tensor<ScalarT> F(num_dims_), strain(num_dims_), gradu(num_dims_);
   minitensor::Tensor<ScalarT> I(minitensor::eye<ScalarT>(num_dims_));
 
-  // Compute DefGrad tensor from displacement gradient
-  if (!def_grad_rc_) {
-    for (int cell(0); cell < workset.numCells; ++cell) {
-      for (int pt(0); pt < num_pts_; ++pt) {
-        gradu.fill(grad_u_, cell, pt, 0, 0);
-        F = I + gradu;
-        j_(cell, pt) = minitensor::det(F);
-        for (int i(0); i < num_dims_; ++i) {
-          for (int j(0); j < num_dims_; ++j) {
-            def_grad_(cell, pt, i, j) = F(i, j);
-          }
-        }
-      }
-    }
-  } else {
-    bool first = true;
-    for (int cell = 0; cell < workset.numCells; ++cell) {
-      for (int pt = 0; pt < num_pts_; ++pt) {
-        gradu.fill(grad_u_, cell, pt, 0, 0);
-        F = I + gradu;
-        for (int i = 0; i < num_dims_; ++i)
-          for (int j = 0; j < num_dims_; ++j)
-            def_grad_(cell, pt, i, j) = F(i, j);
-        if (first && check_det(workset, cell, pt)) first = false;
-        // F[n,0] = F[n,n-1] F[n-1,0].
-        def_grad_rc_.multiplyInto<ScalarT>(def_grad_, cell, pt);
-        F.fill(def_grad_, cell, pt, 0, 0);
-        j_(cell, pt) = minitensor::det(F);
-      }
+  bool first = true;
+  for (int cell = 0; cell < workset.numCells; ++cell) {
+    for (int pt = 0; pt < num_pts_; ++pt) {
+      gradu.fill(grad_u_, cell, pt, 0, 0);
+      F = I + gradu;
+      for (int i = 0; i < num_dims_; ++i)
+        for (int j = 0; j < num_dims_; ++j) def_grad_(cell, pt, i, j) = F(i, j);
+      if (first && check_det(workset, cell, pt)) first = false;
+      // F[n,0] = F[n,n-1] F[n-1,0].
+      def_grad_rc_.multiplyInto<ScalarT>(def_grad_, cell, pt);
+      F.fill(def_grad_, cell, pt, 0, 0);
+      j_(cell, pt) = minitensor::det(F);
     }
   }
 
@@ -170,31 +225,31 @@ Kinematics<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
     }
   }
 
-  if (needs_strain_) {
-    if (!def_grad_rc_) {
-      for (int cell(0); cell < workset.numCells; ++cell) {
-        for (int pt(0); pt < num_pts_; ++pt) {
-          gradu.fill(grad_u_, cell, pt, 0, 0);
-          strain = 0.5 * (gradu + minitensor::transpose(gradu));
-          for (int i(0); i < num_dims_; ++i) {
-            for (int j(0); j < num_dims_; ++j) {
-              strain_(cell, pt, i, j) = strain(i, j);
-            }
+  // inverse of F, shared by e.g. the poromechanics residuals
+  if (needs_def_grad_inv_) {
+    for (int cell(0); cell < workset.numCells; ++cell) {
+      for (int pt(0); pt < num_pts_; ++pt) {
+        F.fill(def_grad_, cell, pt, 0, 0);
+        minitensor::Tensor<ScalarT> const Finv = minitensor::inverse(F);
+        for (int i(0); i < num_dims_; ++i) {
+          for (int j(0); j < num_dims_; ++j) {
+            def_grad_inv_(cell, pt, i, j) = Finv(i, j);
           }
         }
       }
-    } else {
-      for (int cell = 0; cell < workset.numCells; ++cell) {
-        for (int pt = 0; pt < num_pts_; ++pt) {
-          F.fill(def_grad_, cell, pt, 0, 0);
-          gradu = F - I;
-          // dU/dx[0] = dx[n]/dx[0] - dx[0]/dx[0] = F[n,0] - I.
-          // strain = 1/2 (dU/dx[0] + dU/dx[0]^T).
-          strain = 0.5 * (gradu + minitensor::transpose(gradu));
-          for (int i = 0; i < num_dims_; ++i)
-            for (int j = 0; j < num_dims_; ++j)
-              strain_(cell, pt, i, j) = strain(i, j);
-        }
+    }
+  }
+
+  if (needs_strain_) {
+    for (int cell = 0; cell < workset.numCells; ++cell) {
+      for (int pt = 0; pt < num_pts_; ++pt) {
+        F.fill(def_grad_, cell, pt, 0, 0);
+        gradu = F - I;
+        // dU/dx[0] = dx[n]/dx[0] - dx[0]/dx[0] = F[n,0] - I.
+        // strain = 1/2 (dU/dx[0] + dU/dx[0]^T).
+        strain = 0.5 * (gradu + minitensor::transpose(gradu));
+        for (int i = 0; i < num_dims_; ++i)
+          for (int j = 0; j < num_dims_; ++j) strain_(cell, pt, i, j) = strain(i, j);
       }
     }
   }
@@ -42,11 +42,29 @@ protected:
   typedef typename EvalT::ScalarT ScalarT;
   typedef typename EvalT::MeshScalarT MeshScalarT;
 
-  // Protected function for stress calc, only for RealType
+  // Protected function for stress calc, only for RealType. The old stress and
+  // state must have been loaded into matp by setOldState; the new state is
+  // copied to the state variable fields only if storeState is true
   void calcStressRealType(PHX::MDField<RealType,Cell,QuadPoint,Dim,Dim>& stressFieldRef,
                           PHX::MDField<RealType,Cell,QuadPoint,Dim,Dim>& defGradFieldRef,
                           typename Traits::EvalData workset,
-                          Teuchos::RCP<LameMatParams>& matp);
+                          Teuchos::RCP<LameMatParams>& matp,
+                          bool storeState = true);
+
+  // Load the old stress and state of the workset into matp, once per
+  // evaluation since the perturbed calls all start from them
+  void setOldState(Teuchos::RCP<LameMatParams>& matp,
+                   typename Traits::EvalData workset);
+
+  // Stress and its derivatives by finite differences of Lame with doubles,
+  // shared by the Jacobian and Tangent specializations. When there are more
+  // derivative components than deformation gradient components, the
+  // material tangent dS/dF is differenced instead and chained with dF.
+  template<typename FadT>
+  void calcStressFD(PHX::MDField<FadT,Cell,QuadPoint,Dim,Dim>& stressFad,
+                    PHX::MDField<FadT,Cell,QuadPoint,Dim,Dim>& defGradFad,
+                    typename Traits::EvalData workset,
+                    double pert);
 
   // Allocate material parameter arrays -- always doubles
   void setMatP(Teuchos::RCP<LameMatParams>& matp,
@@ -117,6 +117,7 @@ evaluateFields(typename Traits::EvalData workset)
 
   Teuchos::RCP<LameMatParams> matp = Teuchos::rcp(new LameMatParams());
   this->setMatP(matp, workset);
+  this->setOldState(matp, workset);
 
   this->calcStressRealType(this->stressField, this->defGradField, workset, matp);
 
@@ -128,61 +129,7 @@ template<typename Traits>
 void LameStress<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  // This block forces stressField Fad to allocate deriv array --is ther a better way?
-  PHAL::AlbanyTraits::Jacobian::ScalarT scalarToForceAllocation=this->defGradField(0,0,0,0);
-  for (int cell=0; cell < (int)workset.numCells; ++cell)
-    for (int qp=0; qp < (int)this->numQPs; ++qp)
-      for (int i=0; i < (int)this->numDims; ++i)
-        for (int j=0; j < (int)this->numDims; ++j)
-          this->stressField(cell,qp,i,j) = scalarToForceAllocation;
-
-  // Allocate double arrays in matp
-  Teuchos::RCP<LameMatParams> matp = Teuchos::rcp(new LameMatParams());
-  this->setMatP(matp, workset);
-
-  // Begin Finite Difference
-  // Do Base unperturbed case
-  for (int cell=0; cell < (int)workset.numCells; ++cell)
-    for (int qp=0; qp < (int)this->numQPs; ++qp)
-      for (int i=0; i < (int)this->numDims; ++i)
-        for (int j=0; j < (int)this->numDims; ++j)
-          this->defGradFieldRealType(cell,qp,i,j) =
-            this->defGradField(cell,qp,i,j).val();
-
-  this->calcStressRealType(this->stressFieldRealType,
-                           this->defGradFieldRealType, workset, matp);
-
-  for (int cell=0; cell < (int)workset.numCells; ++cell)
-    for (int qp=0; qp < (int)this->numQPs; ++qp)
-      for (int i=0; i < (int)this->numDims; ++i)
-        for (int j=0; j < (int)this->numDims; ++j)
-          this->stressField(cell,qp,i,j).val() =
-            this->stressFieldRealType(cell,qp,i,j);
-
-  // Do Perturbations
-  double pert=1.0e-6;
-  int numIVs = this->defGradField(0,0,0,0).size();
-  for (int iv=0; iv < numIVs; ++iv) {
-    for (int cell=0; cell < (int)workset.numCells; ++cell)
-      for (int qp=0; qp < (int)this->numQPs; ++qp)
-        for (int i=0; i < (int)this->numDims; ++i)
-          for (int j=0; j < (int)this->numDims; ++j)
-            this->defGradFieldRealType(cell,qp,i,j) =
-              this->defGradField(cell,qp,i,j).val() + pert*this->defGradField(cell,qp,i,j).fastAccessDx(iv);
-
-    this->calcStressRealType(this->stressFieldRealType, this->defGradFieldRealType, workset, matp);
-
-    for (int cell=0; cell < (int)workset.numCells; ++cell)
-      for (int qp=0; qp < (int)this->numQPs; ++qp)
-        for (int i=0; i < (int)this->numDims; ++i)
-          for (int j=0; j < (int)this->numDims; ++j)
-            this->stressField(cell,qp,i,j).fastAccessDx(iv) =
-              (this->stressFieldRealType(cell,qp,i,j) -
-               this->stressField(cell,qp,i,j).val()) / pert;
-  }
-
-  // Free double arrays allocated in matp
-  this->freeMatP(matp);
+  this->calcStressFD(this->stressField, this->defGradField, workset, 1.0e-6);
 }
 
 // Tangent implementation is Identical to Jacobian
@@ -190,58 +137,100 @@ template<typename Traits>
 void LameStress<PHAL::AlbanyTraits::Tangent, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  // This block forces stressField Fad to allocate deriv array
-  PHAL::AlbanyTraits::Tangent::ScalarT scalarToForceAllocation=this->defGradField(0,0,0,0);
-  for (int cell=0; cell < (int)workset.numCells; ++cell)
-    for (int qp=0; qp < (int)this->numQPs; ++qp)
-      for (int i=0; i < (int)this->numDims; ++i)
-        for (int j=0; j < (int)this->numDims; ++j)
-          this->stressField(cell,qp,i,j) = scalarToForceAllocation;
-
-  // Allocate double arrays in matp
+  this->calcStressFD(this->stressField, this->defGradField, workset, 1.0e-8);
+}
+
+template<typename EvalT, typename Traits>
+template<typename FadT>
+void LameStressBase<EvalT, Traits>::
+  calcStressFD(PHX::MDField<FadT,Cell,QuadPoint,Dim,Dim>& stressFad,
+               PHX::MDField<FadT,Cell,QuadPoint,Dim,Dim>& defGradFad,
+               typename Traits::EvalData workset,
+               double pert)
+{
+  int const numCells = workset.numCells;
+  int const nQPs = this->numQPs;
+  int const nDims = this->numDims;
+  int const numIVs = defGradFad(0,0,0,0).size();
+
+  // Allocate double arrays in matp; the old stress and state are the same
+  // for every perturbed call
   Teuchos::RCP<LameMatParams> matp = Teuchos::rcp(new LameMatParams());
   this->setMatP(matp, workset);
+  this->setOldState(matp, workset);
 
   // Begin Finite Difference
-  // Do Base unperturbed case
-  for (int cell=0; cell < (int)workset.numCells; ++cell)
-    for (int qp=0; qp < (int)this->numQPs; ++qp)
-      for (int i=0; i < (int)this->numDims; ++i)
-        for (int j=0; j < (int)this->numDims; ++j)
+  // Do Base unperturbed case, which is the only one storing the state
+  for (int cell=0; cell < numCells; ++cell)
+    for (int qp=0; qp < nQPs; ++qp)
+      for (int i=0; i < nDims; ++i)
+        for (int j=0; j < nDims; ++j)
           this->defGradFieldRealType(cell,qp,i,j) =
-            this->defGradField(cell,qp,i,j).val();
+            defGradFad(cell,qp,i,j).val();
 
   this->calcStressRealType(this->stressFieldRealType,
                            this->defGradFieldRealType, workset, matp);
 
-  for (int cell=0; cell < (int)workset.numCells; ++cell)
-    for (int qp=0; qp < (int)this->numQPs; ++qp)
-      for (int i=0; i < (int)this->numDims; ++i)
-        for (int j=0; j < (int)this->numDims; ++j)
-          this->stressField(cell,qp,i,j).val() =
-            this->stressFieldRealType(cell,qp,i,j);
-
-  // Do Perturbations
-  double pert=1.0e-8;
-  int numIVs = this->defGradField(0,0,0,0).size();
-  for (int iv=0; iv < numIVs; ++iv) {
-    for (int cell=0; cell < (int)workset.numCells; ++cell)
-      for (int qp=0; qp < (int)this->numQPs; ++qp)
-        for (int i=0; i < (int)this->numDims; ++i)
-          for (int j=0; j < (int)this->numDims; ++j)
-            this->defGradFieldRealType(cell,qp,i,j) =
-              this->defGradField(cell,qp,i,j).val() + pert*this->defGradField(cell,qp,i,j).fastAccessDx(iv);
-
-    this->calcStressRealType(this->stressFieldRealType,
-                             this->defGradFieldRealType, workset, matp);
-
-    for (int cell=0; cell < (int)workset.numCells; ++cell)
-      for (int qp=0; qp < (int)this->numQPs; ++qp)
-        for (int i=0; i < (int)this->numDims; ++i)
-          for (int j=0; j < (int)this->numDims; ++j)
-            this->stressField(cell,qp,i,j).fastAccessDx(iv) =
-              (this->stressFieldRealType(cell,qp,i,j) -
-               this->stressField(cell,qp,i,j).val()) / pert;
+  // This also forces the stress Fad to allocate its deriv array
+  for (int cell=0; cell < numCells; ++cell)
+    for (int qp=0; qp < nQPs; ++qp)
+      for (int i=0; i < nDims; ++i)
+        for (int j=0; j < nDims; ++j)
+          stressFad(cell,qp,i,j) =
+            FadT(numIVs, this->stressFieldRealType(cell,qp,i,j));
+
+  if (numIVs <= nDims*nDims) {
+    // Perturb along each derivative direction of the deformation gradient
+    for (int iv=0; iv < numIVs; ++iv) {
+      for (int cell=0; cell < numCells; ++cell)
+        for (int qp=0; qp < nQPs; ++qp)
+          for (int i=0; i < nDims; ++i)
+            for (int j=0; j < nDims; ++j)
+              this->defGradFieldRealType(cell,qp,i,j) =
+                defGradFad(cell,qp,i,j).val() + pert*defGradFad(cell,qp,i,j).fastAccessDx(iv);
+
+      this->calcStressRealType(this->stressFieldRealType,
+                               this->defGradFieldRealType, workset, matp, false);
+
+      for (int cell=0; cell < numCells; ++cell)
+        for (int qp=0; qp < nQPs; ++qp)
+          for (int i=0; i < nDims; ++i)
+            for (int j=0; j < nDims; ++j)
+              stressFad(cell,qp,i,j).fastAccessDx(iv) =
+                (this->stressFieldRealType(cell,qp,i,j) -
+                 stressFad(cell,qp,i,j).val()) / pert;
+    }
+  }
+  else {
+    // Perturb each deformation gradient component, one batched Lame call
+    // each, and chain the material tangent dS/dF(k,l) with dF(k,l)
+    for (int k=0; k < nDims; ++k) {
+      for (int l=0; l < nDims; ++l) {
+        for (int cell=0; cell < numCells; ++cell)
+          for (int qp=0; qp < nQPs; ++qp)
+            for (int i=0; i < nDims; ++i)
+              for (int j=0; j < nDims; ++j)
+                this->defGradFieldRealType(cell,qp,i,j) =
+                  defGradFad(cell,qp,i,j).val() + (i==k && j==l ? pert : 0.0);
+
+        this->calcStressRealType(this->stressFieldRealType,
+                                 this->defGradFieldRealType, workset, matp, false);
+
+        for (int cell=0; cell < numCells; ++cell)
+          for (int qp=0; qp < nQPs; ++qp) {
+            FadT const& dF = defGradFad(cell,qp,k,l);
+            for (int i=0; i < nDims; ++i)
+              for (int j=0; j < nDims; ++j) {
+                RealType const dSdF =
+                  (this->stressFieldRealType(cell,qp,i,j) -
+                   stressFad(cell,qp,i,j).val()) / pert;
+                for (int iv=0; iv < numIVs; ++iv)
+                  stressFad(cell,qp,i,j).fastAccessDx(iv) +=
+                    dSdF * dF.fastAccessDx(iv);
+              }
+          }
+      }
+    }
   }
 
   // Free double arrays allocated in matp
@@ -311,16 +300,51 @@ void LameStressBase<EvalT, Traits>::
   delete [] matp->stress_new;
 }
 
+template<typename EvalT, typename Traits>
+void LameStressBase<EvalT, Traits>::
+  setOldState(Teuchos::RCP<LameMatParams>& matp,
+              typename Traits::EvalData workset)
+{
+  Albany::MDArray oldStress = (*workset.stateArrayPtr)[stressName];
+
+  int numStateVariables = (int)(this->lameMaterialModelStateVariableNames.size());
+
+  // Look the state arrays up once, not per material point
+  std::vector<Albany::MDArray> oldStates;
+  for(int iVar=0 ; iVar<numStateVariables ; iVar++)
+    oldStates.push_back((*workset.stateArrayPtr)[this->lameMaterialModelStateVariableNames[iVar]+"_old"]);
+
+  double* stateOldPtr = matp->state_old;
+  double* stressOldPtr = matp->stress_old;
+
+  for (int cell=0; cell < (int)workset.numCells; ++cell) {
+    for (int qp=0; qp < (int)numQPs; ++qp) {
+
+      stressOldPtr[0] = oldStress(cell,qp,0,0);
+      stressOldPtr[1] = oldStress(cell,qp,1,1);
+      stressOldPtr[2] = oldStress(cell,qp,2,2);
+      stressOldPtr[3] = oldStress(cell,qp,0,1);
+      stressOldPtr[4] = oldStress(cell,qp,1,2);
+      stressOldPtr[5] = oldStress(cell,qp,0,2);
+      stressOldPtr += 6;
+
+      // copy data from the state manager to the LAME data structure
+      for(int iVar=0 ; iVar<numStateVariables ; iVar++, stateOldPtr++)
+        *stateOldPtr = oldStates[iVar](cell,qp);
+    }
+  }
+}
+
 template<typename EvalT, typename Traits>
 void LameStressBase<EvalT, Traits>::
   calcStressRealType(PHX::MDField<RealType,Cell,QuadPoint,Dim,Dim>& stressFieldRef,
              PHX::MDField<RealType,Cell,QuadPoint,Dim,Dim>& defGradFieldRef,
              typename Traits::EvalData workset,
-             Teuchos::RCP<LameMatParams>& matp)
+             Teuchos::RCP<LameMatParams>& matp,
+             bool storeState)
 {
   // Get the old state data
   Albany::MDArray oldDefGrad = (*workset.stateArrayPtr)[defGradName];
-  Albany::MDArray oldStress = (*workset.stateArrayPtr)[stressName];
 
   int numStateVariables = (int)(this->lameMaterialModelStateVariableNames.size());
 
@@ -329,8 +353,6 @@ void LameStressBase<EvalT, Traits>::
   double* spinPtr = matp->spin;
   double* leftStretchPtr = matp->left_stretch;
   double* rotationPtr = matp->rotation;
-  double* stateOldPtr = matp->state_old;
-  double* stressOldPtr = matp->stress_old;
 
   double deltaT = matp->dt;
 
@@ -441,28 +463,11 @@ void LameStressBase<EvalT, Traits>::
       rotationPtr[7] = ( R(2,1) );
       rotationPtr[8] = ( R(2,0) );
 
-      stressOldPtr[0] = oldStress(cell,qp,0,0);
-      stressOldPtr[1] = oldStress(cell,qp,1,1);
-      stressOldPtr[2] = oldStress(cell,qp,2,2);
-      stressOldPtr[3] = oldStress(cell,qp,0,1);
-      stressOldPtr[4] = oldStress(cell,qp,1,2);
-      stressOldPtr[5] = oldStress(cell,qp,0,2);
-
       // increment the pointers
       strainRatePtr += 6;
       spinPtr += 3;
       leftStretchPtr += 6;
       rotationPtr += 9;
-      stressOldPtr += 6;
-
-      // copy data from the state manager to the LAME data structure
-      for(int iVar=0 ; iVar<numStateVariables ; iVar++, stateOldPtr++){
-        //std::string& variableName = this->lameMaterialModelStateVariableNames[iVar];
-        //const Intrepid2::FieldContainer_Kokkos<RealType, PHX::Layout, PHX::Device>& stateVar = *oldState[variableName];
-        const std::string& variableName = this->lameMaterialModelStateVariableNames[iVar]+"_old";
-        Albany::MDArray stateVar = (*workset.stateArrayPtr)[variableName];
-        *stateOldPtr = stateVar(cell,qp);
-      }
     }
   }
 
@@ -493,6 +498,8 @@ void LameStressBase<EvalT, Traits>::
     }
   }
 
+  if (!storeState) return;
+
   // !!!!! When should this be done???
   double* stateNewPtr = matp->state_new;
   for (int cell=0; cell < workset.numCells; ++cell) {
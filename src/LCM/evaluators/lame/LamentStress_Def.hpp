@@ -108,20 +108,29 @@ evaluateFields(typename Traits::EvalData workset)
   // \todo Get actual time step for calls to LAMENT materials.
   double deltaT = 1.0;
 
-  vector<ScalarT> strainRate(6);              // symmetric tensor
-  vector<ScalarT> spin(3);                     // skew-symmetric tensor
-  vector<ScalarT> defGrad(9);              // symmetric tensor
-  vector<ScalarT> leftStretch(6);              // symmetric tensor
-  vector<ScalarT> rotation(9);                 // full tensor
-  vector<double> stressOld(6);                // symmetric tensor
-  vector<ScalarT> stressNew(6);               // symmetric tensor
-  vector<double> stateOld(numStateVariables); // a single scalar for each state variable
-  vector<double> stateNew(numStateVariables); // a single scalar for each state variable
+  // Lament is called one time (called for all material points in the workset
+  // at once); its ScalarT instantiation carries the derivatives through
+  int numMaterialEvaluations = workset.numCells * numQPs;
+
+  vector<ScalarT> strainRate(6*numMaterialEvaluations);              // symmetric tensor
+  vector<ScalarT> spin(3*numMaterialEvaluations);                     // skew-symmetric tensor
+  vector<ScalarT> defGrad(9*numMaterialEvaluations);              // symmetric tensor
+  vector<ScalarT> leftStretch(6*numMaterialEvaluations);              // symmetric tensor
+  vector<ScalarT> rotation(9*numMaterialEvaluations);                 // full tensor
+  vector<double> stressOld(6*numMaterialEvaluations);                // symmetric tensor
+  vector<ScalarT> stressNew(6*numMaterialEvaluations);               // symmetric tensor
+  vector<double> stateOld(numStateVariables*numMaterialEvaluations); // a single scalar for each state variable
+  vector<double> stateNew(numStateVariables*numMaterialEvaluations); // a single scalar for each state variable
+
+  // Look the state arrays up once, not per material point
+  vector<Albany::MDArray> oldStates;
+  for(int iVar=0 ; iVar<numStateVariables ; iVar++)
+    oldStates.push_back((*workset.stateArrayPtr)[this->lamentMaterialModelStateVariableNames[iVar]+"_old"]);
 
   // \todo Set up scratch space for material models using getNumScratchVars() and setScratchPtr().
 
   // Create the matParams structure, which is passed to Lament
-  matp->nelements = 1;
+  matp->nelements = numMaterialEvaluations;
   matp->dt = deltaT;
   matp->time = 0.0;
   matp->strain_rate = &strainRate[0];
@@ -147,6 +156,8 @@ evaluateFields(typename Traits::EvalData workset)
   for (int cell=0; cell < (int)workset.numCells; ++cell) {
     for (int qp=0; qp < (int)numQPs; ++qp) {
 
+      int const pt = cell*numQPs + qp;
+
       // std::cout << "QP: " << qp << std::endl;
 
       // Fill the following entries in matParams for call to LAMENT
@@ -276,73 +287,82 @@ evaluateFields(typename Traits::EvalData workset)
 
       // load everything into the Lament data structure
 
-      strainRate[0] = ( D(0,0) );
-      strainRate[1] = ( D(1,1) );
-      strainRate[2] = ( D(2,2) );
-      strainRate[3] = ( D(0,1) );
-      strainRate[4] = ( D(1,2) );
-      strainRate[5] = ( D(2,0) );
-
-      spin[0] = ( W(0,1) );
-      spin[1] = ( W(1,2) );
-      spin[2] = ( W(2,0) );
-
-      leftStretch[0] = ( V(0,0) );
-      leftStretch[1] = ( V(1,1) );
-      leftStretch[2] = ( V(2,2) );
-      leftStretch[3] = ( V(0,1) );
-      leftStretch[4] = ( V(1,2) );
-      leftStretch[5] = ( V(2,0) );
-
-      rotation[0] = ( R(0,0) );
-      rotation[1] = ( R(1,1) );
-      rotation[2] = ( R(2,2) );
-      rotation[3] = ( R(0,1) );
-      rotation[4] = ( R(1,2) );
-      rotation[5] = ( R(2,0) );
-      rotation[6] = ( R(1,0) );
-      rotation[7] = ( R(2,1) );
-      rotation[8] = ( R(0,2) );
-
-      defGrad[0] = ( Fnew(0,0) );
-      defGrad[1] = ( Fnew(1,1) );
-      defGrad[2] = ( Fnew(2,2) );
-      defGrad[3] = ( Fnew(0,1) );
-      defGrad[4] = ( Fnew(1,2) );
-      defGrad[5] = ( Fnew(2,0) );
-      defGrad[6] = ( Fnew(1,0) );
-      defGrad[7] = ( Fnew(2,1) );
-      defGrad[8] = ( Fnew(0,2) );
-
-      stressOld[0] = oldStress(cell,qp,0,0);
-      stressOld[1] = oldStress(cell,qp,1,1);
-      stressOld[2] = oldStress(cell,qp,2,2);
-      stressOld[3] = oldStress(cell,qp,0,1);
-      stressOld[4] = oldStress(cell,qp,1,2);
-      stressOld[5] = oldStress(cell,qp,2,0);
+      strainRate[6*pt+0] = ( D(0,0) );
+      strainRate[6*pt+1] = ( D(1,1) );
+      strainRate[6*pt+2] = ( D(2,2) );
+      strainRate[6*pt+3] = ( D(0,1) );
+      strainRate[6*pt+4] = ( D(1,2) );
+      strainRate[6*pt+5] = ( D(2,0) );
+
+      spin[3*pt+0] = ( W(0,1) );
+      spin[3*pt+1] = ( W(1,2) );
+      spin[3*pt+2] = ( W(2,0) );
+
+      leftStretch[6*pt+0] = ( V(0,0) );
+      leftStretch[6*pt+1] = ( V(1,1) );
+      leftStretch[6*pt+2] = ( V(2,2) );
+      leftStretch[6*pt+3] = ( V(0,1) );
+      leftStretch[6*pt+4] = ( V(1,2) );
+      leftStretch[6*pt+5] = ( V(2,0) );
+
+      rotation[9*pt+0] = ( R(0,0) );
+      rotation[9*pt+1] = ( R(1,1) );
+      rotation[9*pt+2] = ( R(2,2) );
+      rotation[9*pt+3] = ( R(0,1) );
+      rotation[9*pt+4] = ( R(1,2) );
+      rotation[9*pt+5] = ( R(2,0) );
+      rotation[9*pt+6] = ( R(1,0) );
+      rotation[9*pt+7] = ( R(2,1) );
+      rotation[9*pt+8] = ( R(0,2) );
+
+      defGrad[9*pt+0] = ( Fnew(0,0) );
+      defGrad[9*pt+1] = ( Fnew(1,1) );
+      defGrad[9*pt+2] = ( Fnew(2,2) );
+      defGrad[9*pt+3] = ( Fnew(0,1) );
+      defGrad[9*pt+4] = ( Fnew(1,2) );
+      defGrad[9*pt+5] = ( Fnew(2,0) );
+      defGrad[9*pt+6] = ( Fnew(1,0) );
+      defGrad[9*pt+7] = ( Fnew(2,1) );
+      defGrad[9*pt+8] = ( Fnew(0,2) );
+
+      stressOld[6*pt+0] = oldStress(cell,qp,0,0);
+      stressOld[6*pt+1] = oldStress(cell,qp,1,1);
+      stressOld[6*pt+2] = oldStress(cell,qp,2,2);
+      stressOld[6*pt+3] = oldStress(cell,qp,0,1);
+      stressOld[6*pt+4] = oldStress(cell,qp,1,2);
+      stressOld[6*pt+5] = oldStress(cell,qp,2,0);
 
       // copy data from the state manager to the LAMENT data structure
-      for(int iVar=0 ; iVar<numStateVariables ; iVar++){
-        const std::string& variableName = this->lamentMaterialModelStateVariableNames[iVar]+"_old";
-        Albany::MDArray stateVar = (*workset.stateArrayPtr)[variableName];
-        stateOld[iVar] = stateVar(cell,qp);
-      }
+      for(int iVar=0 ; iVar<numStateVariables ; iVar++)
+        stateOld[numStateVariables*pt+iVar] = oldStates[iVar](cell,qp);
+    }
+  }
 
-      // Make a call to the LAMENT material model to initialize the load step
-      this->lamentMaterialModel->loadStepInit(matp.get());
+  // Make a call to the LAMENT material model to initialize the load step
+  this->lamentMaterialModel->loadStepInit(matp.get());
 
-      // Get the stress from the LAMENT material
+  // Get the stress from the LAMENT material
 
-      // std::cout << "about to call lament->getStress()" << std::endl;
+  // std::cout << "about to call lament->getStress()" << std::endl;
 
-      this->lamentMaterialModel->getStress(matp.get());
+  this->lamentMaterialModel->getStress(matp.get());
+
+  // std::cout << "after calling lament->getStress() 2" << std::endl;
+
+  for (int cell=0; cell < (int)workset.numCells; ++cell) {
+    for (int qp=0; qp < (int)numQPs; ++qp) {
 
-      // std::cout << "after calling lament->getStress() 2" << std::endl;
+      int const pt = cell*numQPs + qp;
+      ScalarT const* const rot = &rotation[9*pt];
+      ScalarT const* const sig = &stressNew[6*pt];
 
       // rotate to get the Cauchy Stress
-      minitensor::Tensor<ScalarT> lameStress( stressNew[0], stressNew[3], stressNew[5],
-                                          stressNew[3], stressNew[1], stressNew[4],
-                                          stressNew[5], stressNew[4], stressNew[2] );
+      minitensor::Tensor<ScalarT> R( rot[0], rot[3], rot[8],
+                                 rot[6], rot[1], rot[4],
+                                 rot[5], rot[7], rot[2] );
+      minitensor::Tensor<ScalarT> lameStress( sig[0], sig[3], sig[5],
+                                          sig[3], sig[1], sig[4],
+                                          sig[5], sig[4], sig[2] );
       minitensor::Tensor<ScalarT> cauchy = R * lameStress * transpose(R);
 
       // DEBUGGING //
@@ -373,7 +393,7 @@ evaluateFields(typename Traits::EvalData workset)
 
       // copy state_new data from the LAMENT data structure to the corresponding state variable field
       for(int iVar=0 ; iVar<numStateVariables ; iVar++)
-	this->lamentMaterialModelStateVariableFields[iVar](cell,qp) = stateNew[iVar];
+	this->lamentMaterialModelStateVariableFields[iVar](cell,qp) = stateNew[numStateVariables*pt+iVar];
 
       // DEBUGGING //
       //if(cell==0 && qp==0){
@@ -16,6 +16,7 @@
 #include "Sacado_ParameterAccessor.hpp"
 #ifdef ALBANY_STOKHOS
 #include "Stokhos_KL_ExponentialRandomField.hpp"
+#include "PHAL_KLFieldCache.hpp"
 #endif
 #include "Teuchos_Array.hpp"
 
@@ -73,6 +74,9 @@ private:
 #ifdef ALBANY_STOKHOS
   //! Exponential random field
   Teuchos::RCP< Stokhos::KL::ExponentialRandomField<RealType>> exp_rf_kl;
+
+  //! Eigenfunctions of exp_rf_kl at the quad points
+  Teuchos::RCP<PHAL::KLFieldCache> kl_cache;
 #endif
 
   //! Values of the random variables
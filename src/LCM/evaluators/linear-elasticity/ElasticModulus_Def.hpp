@@ -58,6 +58,7 @@ ElasticModulus(Teuchos::ParameterList& p) :
 
     exp_rf_kl =
       Teuchos::rcp(new Stokhos::KL::ExponentialRandomField<RealType>(*elmd_list));
+    kl_cache = Teuchos::rcp(new PHAL::KLFieldCache(exp_rf_kl));
     int num_KL = exp_rf_kl->stochasticDimension();
 
     // Add KL random variables as Sacado-ized parameters
@@ -141,14 +142,8 @@ evaluateFields(typename Traits::EvalData workset)
   }
 #ifdef ALBANY_STOKHOS
   else {
-    for (int cell=0; cell < numCells; ++cell) {
-      for (int qp=0; qp < numQPs; ++qp) {
-	Teuchos::Array<MeshScalarT> point(numDims);
-	for (int i=0; i<numDims; i++)
-	  point[i] = Sacado::ScalarValue<MeshScalarT>::eval(coordVec(cell,qp,i));
-	elasticModulus(cell,qp) = exp_rf_kl->evaluate(point, rv);
-      }
-    }
+    kl_cache->evaluate(workset.wsIndex, numCells, numQPs, numDims,
+                       coordVec, rv, elasticModulus);
   }
 #endif
   if (isThermoElastic) {
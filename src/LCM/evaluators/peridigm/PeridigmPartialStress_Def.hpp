@@ -81,27 +81,25 @@ evaluateFields(typename Traits::EvalData workset)
   int worksetIndex = static_cast<int>(workset.wsIndex);
   PeridigmManager& peridigmManager = *PeridigmManager::self();
 
-  // Container for the partial stress values at each quadrature point in an element
-  std::vector< std::vector<RealType>> partialStressValues;
-  partialStressValues.resize(this->numQPs);
-  for(int i=0 ; i<this->numQPs ; ++i)
-    partialStressValues[i].resize(9);
+  // Partial stress values at every quadrature point of the workset, fetched in one call
+  std::vector<RealType> partialStressValues(9*workset.numCells*this->numQPs, 0.0);
+  peridigmManager.getPartialStress(blockName, worksetIndex, workset.numCells, this->numQPs, partialStressValues);
 
   RealType detJ, defGradTranspose[3][3], piolaStress[3][3], cauchyStress[3][3];
 
   for(int cell=0; cell < workset.numCells; ++cell){
-    peridigmManager.getPartialStress(blockName, worksetIndex, cell, partialStressValues);
     for (int qp=0; qp < this->numQPs; ++qp) {
 
-      this->stress(cell,qp,0,0) = partialStressValues[qp][0];
-      this->stress(cell,qp,1,1) = partialStressValues[qp][4];
-      this->stress(cell,qp,2,2) = partialStressValues[qp][8];
-      this->stress(cell,qp,0,1) = partialStressValues[qp][1];
-      this->stress(cell,qp,1,2) = partialStressValues[qp][5];
-      this->stress(cell,qp,2,0) = partialStressValues[qp][6];
-      this->stress(cell,qp,1,0) = partialStressValues[qp][3];
-      this->stress(cell,qp,2,1) = partialStressValues[qp][7];
-      this->stress(cell,qp,0,2) = partialStressValues[qp][2];
+      const RealType* values = &partialStressValues[9*(cell*this->numQPs+qp)];
+      this->stress(cell,qp,0,0) = values[0];
+      this->stress(cell,qp,1,1) = values[4];
+      this->stress(cell,qp,2,2) = values[8];
+      this->stress(cell,qp,0,1) = values[1];
+      this->stress(cell,qp,1,2) = values[5];
+      this->stress(cell,qp,2,0) = values[6];
+      this->stress(cell,qp,1,0) = values[3];
+      this->stress(cell,qp,2,1) = values[7];
+      this->stress(cell,qp,0,2) = values[2];
 
 //       piolaStress[0][0] = partialStressValues[qp][0];
 //       piolaStress[0][1] = partialStressValues[qp][1];
@@ -58,6 +58,7 @@ private:
   PHX::MDField<const ScalarT,Cell,QuadPoint,Dim,Dim> strain;
 
   PHX::MDField<const ScalarT,Cell,QuadPoint,Dim,Dim> defgrad;
+  PHX::MDField<const ScalarT,Cell,QuadPoint,Dim,Dim> defgradInv;
   PHX::MDField<const ScalarT,Cell,QuadPoint> J;
   PHX::MDField<const ScalarT,Cell,QuadPoint> elementLength;
 
@@ -82,27 +83,18 @@ private:
   bool enableTransient;
   bool haverhoCp;
   bool haveMechanics;
+  bool haveDefGradInv;
   unsigned int numNodes;
   unsigned int numQPs;
   unsigned int numDims;
   unsigned int worksetSize;
 
   // Temporary Views
-  Kokkos::DynRankView<ScalarT, PHX::Device> flux;
   Kokkos::DynRankView<ScalarT, PHX::Device> fluxdt;
   Kokkos::DynRankView<ScalarT, PHX::Device> pterm;
   Kokkos::DynRankView<ScalarT, PHX::Device> tpterm;
   Kokkos::DynRankView<ScalarT, PHX::Device> aterm;
 
-  // Work space FCs
-  Kokkos::DynRankView<ScalarT, PHX::Device> F_inv;
-  Kokkos::DynRankView<ScalarT, PHX::Device> F_invT;
-  Kokkos::DynRankView<ScalarT, PHX::Device> C;
-  Kokkos::DynRankView<ScalarT, PHX::Device> Cinv;
-  Kokkos::DynRankView<ScalarT, PHX::Device> JF_invT;
-  Kokkos::DynRankView<ScalarT, PHX::Device> KJF_invT;
-  Kokkos::DynRankView<ScalarT, PHX::Device> Kref;
-
   ScalarT porePbar, vol;
   ScalarT trialPbar;
 
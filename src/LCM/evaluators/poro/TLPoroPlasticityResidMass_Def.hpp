@@ -8,7 +8,7 @@
 #include "Phalanx_DataLayout.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
-#include "Intrepid2_RealSpaceTools.hpp"
+#include <MiniTensor.h>
 
 #include <typeinfo>
 namespace LCM {
@@ -56,6 +56,7 @@ namespace LCM {
     haveAbsorption(p.get<bool>("Have Absorption")),
     haverhoCp(false),
     haveMechanics(p.get<bool>("Have Mechanics", false)),
+    haveDefGradInv(false),
     stab_param_(p.get<RealType>("Stabilization Parameter"))
   {
     //  if (p.isType<bool>("Disable Transient"))
@@ -95,8 +96,16 @@ namespace LCM {
 
       haveMechanics = true;
 
-      defgrad = decltype(defgrad)(p.get<std::string>("DefGrad Name"), tensor_dl);
-      this->addDependentField(defgrad);
+      // F^{-1} is taken from the kinematics if it publishes it
+      if (p.isType<std::string>("Inverse DefGrad Name")) {
+        haveDefGradInv = true;
+        defgradInv = decltype(defgradInv)
+          (p.get<std::string>("Inverse DefGrad Name"), tensor_dl);
+        this->addDependentField(defgradInv);
+      } else {
+        defgrad = decltype(defgrad)(p.get<std::string>("DefGrad Name"), tensor_dl);
+        this->addDependentField(defgrad);
+      }
 
       J = decltype(J)(p.get<std::string>("DetDefGrad Name"), scalar_dl);
       this->addDependentField(J);
@@ -166,23 +175,12 @@ namespace LCM {
     if (haveConvection && haverhoCp)  this->utils.setFieldData(rhoCp,fm);
     if (haveMechanics) {
       this->utils.setFieldData(J,fm);
-      this->utils.setFieldData(defgrad,fm);
+      if (haveDefGradInv) this->utils.setFieldData(defgradInv,fm);
+      else this->utils.setFieldData(defgrad,fm);
     }
     this->utils.setFieldData(TResidual,fm);
 
-    if (haveMechanics) {
-      // Works space FCs
-      C = Kokkos::createDynRankView(TGrad.get_view(), "XXX", worksetSize, numQPs, numDims, numDims);
-      Cinv = Kokkos::createDynRankView(TGrad.get_view(), "XXX", worksetSize, numQPs, numDims, numDims);
-      F_inv = Kokkos::createDynRankView(TGrad.get_view(), "XXX", worksetSize, numQPs, numDims, numDims);
-      F_invT = Kokkos::createDynRankView(TGrad.get_view(), "XXX", worksetSize, numQPs, numDims, numDims);
-      JF_invT = Kokkos::createDynRankView(TGrad.get_view(), "XXX", worksetSize, numQPs, numDims, numDims);
-      KJF_invT = Kokkos::createDynRankView(TGrad.get_view(), "XXX", worksetSize, numQPs, numDims, numDims);
-      Kref = Kokkos::createDynRankView(TGrad.get_view(), "XXX", worksetSize, numQPs, numDims, numDims);
-    }
-
     // Allocate workspace
-    flux = Kokkos::createDynRankView(TGrad.get_view(), "XXX", worksetSize, numQPs, numDims);
     fluxdt = Kokkos::createDynRankView(TGrad.get_view(), "XXX", worksetSize, numQPs, numDims);
     pterm = Kokkos::createDynRankView(TGrad.get_view(), "XXX", worksetSize, numQPs);
     tpterm = Kokkos::createDynRankView(TGrad.get_view(), "XXX", worksetSize, numNodes, numQPs);
@@ -199,7 +197,6 @@ namespace LCM {
     //if (typeid(ScalarT) == typeid(RealType)) print = true;
 
     typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
-    typedef Intrepid2::RealSpaceTools<PHX::Device> RST;
 
     // Use previous time step for Backward Euler Integration
     Albany::MDArray porePressureold
@@ -235,20 +232,37 @@ namespace LCM {
     ScalarT dt = deltaTime(0);
 
     if (haveMechanics) {
-      RST::inverse(F_inv, defgrad.get_view());
-      RST::transpose(F_invT, F_inv);
-       FST::scalarMultiplyDataData(JF_invT, J.get_view(), F_invT);
-       FST::scalarMultiplyDataData(KJF_invT, kcPermeability.get_view(), JF_invT);
-      FST::tensorMultiplyDataData(Kref, F_inv, KJF_invT);
-      FST::tensorMultiplyDataData (flux, Kref, TGrad.get_view()); // flux_i = k I_ij p_j
+      // flux_i = k J C^{-1}_ij p_j, with C^{-1} = F^{-1} F^{-T}
+      minitensor::Tensor<ScalarT> F(numDims), Finv(numDims);
+      minitensor::Vector<ScalarT> FinvTgradp(numDims);
+      for (int cell=0; cell < workset.numCells; ++cell){
+        for (int qp=0; qp < numQPs; ++qp) {
+          if (haveDefGradInv) {
+            Finv.fill(defgradInv, cell, qp, 0, 0);
+          } else {
+            F.fill(defgrad, cell, qp, 0, 0);
+            Finv = minitensor::inverse(F);
+          }
+          ScalarT const kJ = kcPermeability(cell,qp) * J(cell,qp);
+          for (int l=0; l < numDims; ++l) {
+            FinvTgradp(l) = 0.0;
+            for (int j=0; j < numDims; ++j)
+              FinvTgradp(l) += Finv(j,l) * TGrad(cell,qp,j);
+          }
+          for (int i=0; i < numDims; ++i) {
+            ScalarT flux = 0.0;
+            for (int l=0; l < numDims; ++l)
+              flux += Finv(i,l) * FinvTgradp(l);
+            fluxdt(cell,qp,i) = -kJ * flux * dt;
+          }
+        }
+      }
     } else {
-       FST::scalarMultiplyDataData (flux, kcPermeability.get_view(), TGrad.get_view()); // flux_i = kc p_i
-    }
-
-    for (int cell=0; cell < workset.numCells; ++cell){
-      for (int qp=0; qp < numQPs; ++qp) {
-        for (int dim=0; dim <numDims; ++dim){
-          fluxdt(cell, qp, dim) = -flux(cell,qp,dim)*dt;
+      for (int cell=0; cell < workset.numCells; ++cell){
+        for (int qp=0; qp < numQPs; ++qp) {
+          for (int dim=0; dim <numDims; ++dim){
+            fluxdt(cell,qp,dim) = -kcPermeability(cell,qp)*TGrad(cell,qp,dim)*dt;
+          }
         }
       }
     }
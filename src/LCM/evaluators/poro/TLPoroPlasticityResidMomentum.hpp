@@ -56,11 +56,6 @@ private:
   int numDims;
   bool enableTransient;
 
-  // Work space FCs
-  Kokkos::DynRankView<ScalarT, PHX::Device> F_inv;
-  Kokkos::DynRankView<ScalarT, PHX::Device> F_invT;
-  Kokkos::DynRankView<ScalarT, PHX::Device> JF_invT;
-
 };
 }
 
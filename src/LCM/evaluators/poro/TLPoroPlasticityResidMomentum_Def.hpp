@@ -78,11 +78,6 @@ postRegistrationSetup(typename Traits::SetupData d,
 
   if (enableTransient) this->utils.setFieldData(uDotDot,fm);
   if (enableTransient) this->utils.setFieldData(wBF,fm);
-
-  // Works space FCs
-  F_inv = Kokkos::createDynRankView(J.get_view(), "XXX", worksetSize, numQPs, numDims, numDims);
-  F_invT = Kokkos::createDynRankView(J.get_view(), "XXX", worksetSize, numQPs, numDims, numDims);
-  JF_invT = Kokkos::createDynRankView(J.get_view(), "XXX", worksetSize, numQPs, numDims, numDims);
 }
 
 //**********************************************************************
@@ -90,12 +85,8 @@ template<typename EvalT, typename Traits>
 void TLPoroPlasticityResidMomentum<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
-  typedef Intrepid2::RealSpaceTools<PHX::Device> RST;
-  RST::inverse(F_inv, defgrad.get_view());
-  RST::transpose(F_invT, F_inv);
-  FST::scalarMultiplyDataData(JF_invT, J.get_view(), F_invT);
-  //FST::tensorMultiplyDataData(P.get_view(), TotalStress.get_view(), JF_invT);
+  // TotalStress is already the first Piola-Kirchhoff total stress, see
+  // TLPoroStress, so no pull-back with J F^{-T} is needed here
 
     for (int cell=0; cell < workset.numCells; ++cell) {
       for (int node=0; node < numNodes; ++node) {
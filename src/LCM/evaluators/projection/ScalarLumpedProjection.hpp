@@ -0,0 +1,66 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef SCALAR_LUMPED_PROJECTION_HPP
+#define SCALAR_LUMPED_PROJECTION_HPP
+
+#include "Phalanx_config.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_MDField.hpp"
+
+namespace LCM {
+/** \brief Lumped Scalar Projection Evaluator
+
+    This evaluator projects the hydrostatic stress from Gauss points to the
+    nodes of each element with a lumped (diagonal) mass matrix, and
+    interpolates the projection and its gradient back to the Gauss points.
+    Unlike ScalarL2ProjectionResidual it adds no equation to the global
+    system.
+
+*/
+
+template<typename EvalT, typename Traits>
+class ScalarLumpedProjection : public PHX::EvaluatorWithBaseImpl<Traits>,
+				public PHX::EvaluatorDerived<EvalT, Traits>  {
+
+public:
+
+  ScalarLumpedProjection(const Teuchos::ParameterList& p);
+
+  void postRegistrationSetup(typename Traits::SetupData d,
+                      PHX::FieldManager<Traits>& vm);
+
+  void evaluateFields(typename Traits::EvalData d);
+
+private:
+
+  typedef typename EvalT::ScalarT ScalarT;
+  typedef typename EvalT::MeshScalarT MeshScalarT;
+
+  // Input:
+  PHX::MDField<const MeshScalarT,Cell,Node,QuadPoint> wBF;
+  PHX::MDField<const MeshScalarT,Cell,Node,QuadPoint> BF;
+  PHX::MDField<const MeshScalarT,Cell,Node,QuadPoint,Dim> GradBF;
+  PHX::MDField<const ScalarT,Cell,QuadPoint,Dim, Dim> DefGrad;
+  PHX::MDField<const ScalarT,Cell,QuadPoint,Dim,Dim> Pstress;
+
+  unsigned int numNodes;
+  unsigned int numQPs;
+  unsigned int numDims;
+  unsigned int worksetSize;
+
+  Kokkos::DynRankView<ScalarT, PHX::Device> tauH;
+  Kokkos::DynRankView<ScalarT, PHX::Device> nodalTauH;
+
+  // Output:
+  PHX::MDField<ScalarT,Cell,QuadPoint> projectedStress;
+  PHX::MDField<ScalarT,Cell,QuadPoint,Dim> projectedStressGrad;
+
+};
+}
+
+#endif
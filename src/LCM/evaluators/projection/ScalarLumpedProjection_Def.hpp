@@ -0,0 +1,130 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Phalanx_DataLayout.hpp"
+#include "Teuchos_TestForException.hpp"
+
+#include <MiniTensor.h>
+
+namespace LCM {
+
+//**********************************************************************
+template <typename EvalT, typename Traits>
+ScalarLumpedProjection<EvalT, Traits>::ScalarLumpedProjection(
+    const Teuchos::ParameterList& p)
+    : wBF(p.get<std::string>("Weighted BF Name"),
+          p.get<Teuchos::RCP<PHX::DataLayout>>("Node QP Scalar Data Layout")),
+      BF(p.get<std::string>("BF Name"),
+         p.get<Teuchos::RCP<PHX::DataLayout>>("Node QP Scalar Data Layout")),
+      GradBF(
+          p.get<std::string>("Gradient BF Name"),
+          p.get<Teuchos::RCP<PHX::DataLayout>>("Node QP Vector Data Layout")),
+      DefGrad(
+          p.get<std::string>("Deformation Gradient Name"),
+          p.get<Teuchos::RCP<PHX::DataLayout>>("QP Tensor Data Layout")),
+      Pstress(
+          p.get<std::string>("Stress Name"),
+          p.get<Teuchos::RCP<PHX::DataLayout>>("QP Tensor Data Layout")),
+      projectedStress(
+          p.get<std::string>("QP Variable Name"),
+          p.get<Teuchos::RCP<PHX::DataLayout>>("QP Scalar Data Layout")),
+      projectedStressGrad(
+          p.get<std::string>("Gradient QP Variable Name"),
+          p.get<Teuchos::RCP<PHX::DataLayout>>("QP Vector Data Layout")) {
+  this->addDependentField(wBF);
+  this->addDependentField(BF);
+  this->addDependentField(GradBF);
+  this->addDependentField(DefGrad);
+  this->addDependentField(Pstress);
+
+  this->addEvaluatedField(projectedStress);
+  this->addEvaluatedField(projectedStressGrad);
+
+  Teuchos::RCP<PHX::DataLayout> vector_dl =
+      p.get<Teuchos::RCP<PHX::DataLayout>>("Node QP Vector Data Layout");
+  std::vector<PHX::DataLayout::size_type> dims;
+  vector_dl->dimensions(dims);
+
+  worksetSize = dims[0];
+  numNodes = dims[1];
+  numQPs = dims[2];
+  numDims = dims[3];
+
+  this->setName("ScalarLumpedProjection" + PHX::typeAsString<EvalT>());
+}
+
+//**********************************************************************
+template <typename EvalT, typename Traits>
+void
+ScalarLumpedProjection<EvalT, Traits>::postRegistrationSetup(
+    typename Traits::SetupData d, PHX::FieldManager<Traits>& fm) {
+  this->utils.setFieldData(wBF, fm);
+  this->utils.setFieldData(BF, fm);
+  this->utils.setFieldData(GradBF, fm);
+  this->utils.setFieldData(DefGrad, fm);
+  this->utils.setFieldData(Pstress, fm);
+
+  this->utils.setFieldData(projectedStress, fm);
+  this->utils.setFieldData(projectedStressGrad, fm);
+
+  // Allocate workspace for temporary variables
+  tauH = Kokkos::createDynRankView(
+      projectedStress.get_view(), "XXX", worksetSize, numQPs);
+  nodalTauH = Kokkos::createDynRankView(
+      projectedStress.get_view(), "XXX", worksetSize, numNodes);
+}
+
+//**********************************************************************
+template <typename EvalT, typename Traits>
+void
+ScalarLumpedProjection<EvalT, Traits>::evaluateFields(
+    typename Traits::EvalData workset) {
+  ScalarT J(1);
+
+  for (int cell = 0; cell < workset.numCells; ++cell) {
+    for (int qp = 0; qp < numQPs; ++qp) {
+      minitensor::Tensor<ScalarT> F(
+          minitensor::Source::ARRAY, numDims, DefGrad, cell, qp, 0, 0);
+      J = minitensor::det(F);
+      tauH(cell, qp) = 0.0;
+      for (int i = 0; i < numDims; i++) {
+        tauH(cell, qp) += J * Pstress(cell, qp, i, i) / numDims;
+      }
+    }
+  }
+
+  // Nodal values from the row-sum lumped mass of the element
+  for (int cell = 0; cell < workset.numCells; ++cell) {
+    for (int node = 0; node < numNodes; ++node) {
+      MeshScalarT mass(0.0);
+      nodalTauH(cell, node) = 0.0;
+      for (int qp = 0; qp < numQPs; ++qp) {
+        mass += wBF(cell, node, qp);
+        nodalTauH(cell, node) += tauH(cell, qp) * wBF(cell, node, qp);
+      }
+      nodalTauH(cell, node) /= mass;
+    }
+  }
+
+  // Interpolate the projection and its gradient back to the Gauss points
+  for (int cell = 0; cell < workset.numCells; ++cell) {
+    for (int qp = 0; qp < numQPs; ++qp) {
+      projectedStress(cell, qp) = 0.0;
+      for (int i = 0; i < numDims; i++) {
+        projectedStressGrad(cell, qp, i) = 0.0;
+      }
+      for (int node = 0; node < numNodes; ++node) {
+        projectedStress(cell, qp) += nodalTauH(cell, node) * BF(cell, node, qp);
+        for (int i = 0; i < numDims; i++) {
+          projectedStressGrad(cell, qp, i) +=
+              nodalTauH(cell, node) * GradBF(cell, node, qp, i);
+        }
+      }
+    }
+  }
+}
+//**********************************************************************
+}
@@ -7,6 +7,8 @@
 #ifndef SURFACE_BASIS_HPP
 #define SURFACE_BASIS_HPP
 
+#include <vector>
+
 #include "Phalanx_config.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
@@ -62,6 +64,7 @@ public:
   template<typename ST>
   void
   computeMidplaneCoords(
+      int const num_cells,
       PHX::MDField<const ST, Cell, Vertex, Dim> const coords,
       Kokkos::DynRankView<ST, PHX::Device> & midplane_coords);
 
@@ -72,7 +75,8 @@ public:
   ///
   template<typename ST>
   void
-  computeBasisVectors(Kokkos::DynRankView<ST, PHX::Device> const & midplane_coords,
+  computeBasisVectors(int const num_cells,
+      Kokkos::DynRankView<ST, PHX::Device> const & midplane_coords,
       PHX::MDField<ST, Cell, QuadPoint, Dim, Dim> basis);
 
   ///
@@ -84,6 +88,7 @@ public:
   ///
   void
   computeDualBasisVectors(
+      int const num_cells,
       Kokkos::DynRankView<MeshScalarT, PHX::Device> const & midplane_coords,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim> normal,
@@ -97,14 +102,51 @@ public:
   ///
   void
   computeJacobian(
+      int const num_cells,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
       PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const dual_basis,
       PHX::MDField<MeshScalarT, Cell, QuadPoint> area);
 
 private:
+  ///
+  /// Copies the reference geometry outputs of the first num_cells cells
+  /// from values (restore) or to values (save), always in the same order
+  ///
+  void
+  copyRefGeometry(
+      int const num_cells, std::vector<RealType> & values, bool const restore);
+
+  ///
+  /// Copies the cached reference geometry of the workset to the outputs
+  /// if its reference coordinates are unchanged; returns false otherwise
+  ///
+  bool
+  restoreRefGeometry(int const ws, int const num_cells);
+
+  ///
+  /// Caches the reference coordinates and geometry of the workset
+  ///
+  void
+  saveRefGeometry(int const ws, int const num_cells);
+
   unsigned int
   container_size, num_dims_, num_nodes_, num_qps_, num_surf_nodes_, num_surf_dims_;
 
+  ///
+  /// Reference coordinates and geometry of each workset. The reference
+  /// geometry only changes with the mesh, so it is computed once and
+  /// copied out while the coordinates stay the same. Only used when the
+  /// mesh scalar carries no derivatives.
+  ///
+  struct RefGeometry
+  {
+    std::vector<RealType> coords;
+    std::vector<RealType> values;
+  };
+
+  std::vector<RefGeometry>
+  ref_geometry_;
+
   bool
   need_current_basis_;
 
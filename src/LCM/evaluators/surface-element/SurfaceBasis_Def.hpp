@@ -9,6 +9,8 @@
 
 #include "Sacado_MathFunctions.hpp"
 
+#include <type_traits>
+
 namespace LCM {
 
 //
@@ -132,32 +134,134 @@ SurfaceBasis<EvalT, Traits>::postRegistrationSetup(
 template <typename EvalT, typename Traits>
 void
 SurfaceBasis<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset) {
-  for (int cell(0); cell < workset.numCells; ++cell) {
-    // for the reference geometry
+  int const num_cells = workset.numCells;
+
+  bool const can_cache = std::is_same<MeshScalarT, RealType>::value;
+
+  // for the reference geometry
+  if (can_cache == false ||
+      restoreRefGeometry(workset.wsIndex, num_cells) == false) {
     // compute the mid-plane coordinates
-    computeMidplaneCoords(reference_coords_, ref_midplane_coords_);
+    computeMidplaneCoords(num_cells, reference_coords_, ref_midplane_coords_);
 
     // compute basis vectors
-    computeBasisVectors(ref_midplane_coords_, ref_basis_);
+    computeBasisVectors(num_cells, ref_midplane_coords_, ref_basis_);
 
     // compute the dual
     computeDualBasisVectors(
-        ref_midplane_coords_, ref_basis_, ref_normal_, ref_dual_basis_);
+        num_cells, ref_midplane_coords_, ref_basis_, ref_normal_,
+        ref_dual_basis_);
 
     // compute the Jacobian
-    computeJacobian(ref_basis_, ref_dual_basis_, ref_area_);
+    computeJacobian(num_cells, ref_basis_, ref_dual_basis_, ref_area_);
+
+    if (can_cache == true) saveRefGeometry(workset.wsIndex, num_cells);
+  }
+
+  if (need_current_basis_) {
+    // for the current configuration
+    // compute the mid-plane coordinates
+    computeMidplaneCoords(num_cells, current_coords_, current_midplane_coords_);
+
+    // compute base vectors
+    computeBasisVectors(num_cells, current_midplane_coords_, current_basis_);
+  }
+}
+
+//
+//
+//
+template <typename EvalT, typename Traits>
+void
+SurfaceBasis<EvalT, Traits>::copyRefGeometry(
+    int const num_cells, std::vector<RealType>& values, bool const restore) {
+  using SV = Sacado::ScalarValue<MeshScalarT>;
 
-    if (need_current_basis_) {
-      // for the current configuration
-      // compute the mid-plane coordinates
-      computeMidplaneCoords(current_coords_, current_midplane_coords_);
+  if (restore == false) values.clear();
 
-      // compute base vectors
-      computeBasisVectors(current_midplane_coords_, current_basis_);
+  int k(0);
+  for (int cell(0); cell < num_cells; ++cell) {
+    for (int pt(0); pt < num_qps_; ++pt) {
+      for (int i(0); i < num_dims_; ++i) {
+        for (int j(0); j < num_dims_; ++j) {
+          if (restore == true) {
+            ref_basis_(cell, pt, i, j)      = values[k++];
+            ref_dual_basis_(cell, pt, i, j) = values[k++];
+          } else {
+            values.push_back(SV::eval(ref_basis_(cell, pt, i, j)));
+            values.push_back(SV::eval(ref_dual_basis_(cell, pt, i, j)));
+          }
+        }
+        if (restore == true) {
+          ref_normal_(cell, pt, i) = values[k++];
+        } else {
+          values.push_back(SV::eval(ref_normal_(cell, pt, i)));
+        }
+      }
+      if (restore == true) {
+        ref_area_(cell, pt) = values[k++];
+      } else {
+        values.push_back(SV::eval(ref_area_(cell, pt)));
+      }
     }
   }
 }
 
+//
+//
+//
+template <typename EvalT, typename Traits>
+bool
+SurfaceBasis<EvalT, Traits>::restoreRefGeometry(
+    int const ws, int const num_cells) {
+  if (ws >= ref_geometry_.size()) return false;
+
+  RefGeometry& geometry = ref_geometry_[ws];
+
+  if (geometry.coords.size() != num_cells * num_nodes_ * num_dims_) {
+    return false;
+  }
+
+  int k(0);
+  for (int cell(0); cell < num_cells; ++cell) {
+    for (int node(0); node < num_nodes_; ++node) {
+      for (int dim(0); dim < num_dims_; ++dim, ++k) {
+        if (Sacado::ScalarValue<MeshScalarT>::eval(
+                reference_coords_(cell, node, dim)) != geometry.coords[k]) {
+          return false;
+        }
+      }
+    }
+  }
+
+  copyRefGeometry(num_cells, geometry.values, true);
+  return true;
+}
+
+//
+//
+//
+template <typename EvalT, typename Traits>
+void
+SurfaceBasis<EvalT, Traits>::saveRefGeometry(
+    int const ws, int const num_cells) {
+  if (ws >= ref_geometry_.size()) ref_geometry_.resize(ws + 1);
+
+  RefGeometry& geometry = ref_geometry_[ws];
+
+  geometry.coords.clear();
+  for (int cell(0); cell < num_cells; ++cell) {
+    for (int node(0); node < num_nodes_; ++node) {
+      for (int dim(0); dim < num_dims_; ++dim) {
+        geometry.coords.push_back(Sacado::ScalarValue<MeshScalarT>::eval(
+            reference_coords_(cell, node, dim)));
+      }
+    }
+  }
+
+  copyRefGeometry(num_cells, geometry.values, false);
+}
+
 //
 //
 //
@@ -165,9 +269,10 @@ template <typename EvalT, typename Traits>
 template <typename ST>
 void
 SurfaceBasis<EvalT, Traits>::computeMidplaneCoords(
+    int const num_cells,
     PHX::MDField<const ST, Cell, Vertex, Dim> const coords,
     Kokkos::DynRankView<ST, PHX::Device>& midplane_coords) {
-  for (int cell(0); cell < midplane_coords.dimension(0); ++cell) {
+  for (int cell(0); cell < num_cells; ++cell) {
     // compute the mid-plane coordinates
     for (int node(0); node < num_surf_nodes_; ++node) {
       int top_node = node + num_surf_nodes_;
@@ -187,9 +292,10 @@ template <typename EvalT, typename Traits>
 template <typename ST>
 void
 SurfaceBasis<EvalT, Traits>::computeBasisVectors(
+    int const num_cells,
     Kokkos::DynRankView<ST, PHX::Device> const& midplane_coords,
     PHX::MDField<ST, Cell, QuadPoint, Dim, Dim> basis) {
-  for (int cell(0); cell < midplane_coords.dimension(0); ++cell) {
+  for (int cell(0); cell < num_cells; ++cell) {
     // get the midplane coordinates
     std::vector<minitensor::Vector<ST>> midplane_nodes(num_surf_nodes_);
 
@@ -229,11 +335,12 @@ SurfaceBasis<EvalT, Traits>::computeBasisVectors(
 template <typename EvalT, typename Traits>
 void
 SurfaceBasis<EvalT, Traits>::computeDualBasisVectors(
+    int const num_cells,
     Kokkos::DynRankView<MeshScalarT, PHX::Device> const& midplane_coords,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim> normal,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> dual_basis) {
-  int worksetSize = midplane_coords.dimension(0);
+  int worksetSize = num_cells;
 
   minitensor::Vector<MeshScalarT> g_0(0, 0, 0), g_1(0, 0, 0), g_2(0, 0, 0);
 
@@ -281,10 +388,11 @@ SurfaceBasis<EvalT, Traits>::computeDualBasisVectors(
 template <typename EvalT, typename Traits>
 void
 SurfaceBasis<EvalT, Traits>::computeJacobian(
+    int const num_cells,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const basis,
     PHX::MDField<MeshScalarT, Cell, QuadPoint, Dim, Dim> const dual_basis,
     PHX::MDField<MeshScalarT, Cell, QuadPoint> area) {
-  const int worksetSize = basis.dimension(0);
+  const int worksetSize = num_cells;
 
   for (int cell(0); cell < worksetSize; ++cell) {
     for (int pt(0); pt < num_qps_; ++pt) {
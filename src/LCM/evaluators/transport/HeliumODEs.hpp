@@ -13,6 +13,8 @@
 #include "Phalanx_MDField.hpp"
 #include "Albany_Layouts.hpp"
 
+#include <vector>
+
 namespace LCM {
   /// \brief
   ///
@@ -95,6 +97,22 @@ namespace LCM {
     std::string total_bubble_density_name_;
     std::string bubble_volume_fraction_name_;
 
+    ///
+    /// Points of the workset that carry tritium, in SoA layout. The local
+    /// Newton iterations sweep the whole batch at once and drop points
+    /// from the todo list as they converge.
+    ///
+    struct Batch
+    {
+      std::vector<int> cell, pt, todo;
+      std::vector<ScalarT> n1_old, nb_old, sb_old, d, g_old, g;
+      std::vector<ScalarT> n1, nb, sb, r0, r1, r2, norm_r2, goal_r2;
+
+      void resize(std::size_t const n);
+    };
+
+    Batch batch_;
+
   };
 }
 
@@ -113,7 +113,6 @@ evaluateFields(typename Traits::EvalData workset)
   // Declaring tangent, residual, norms, and increment for N-R
   minitensor::Tensor<ScalarT> tangent(3);
   minitensor::Vector<ScalarT> residual(3);
-  ScalarT norm_residual_2, norm_residual_goal_2;
   minitensor::Vector<ScalarT> increment(3);
 
   // tolarences and iterations for newton
@@ -156,8 +155,6 @@ evaluateFields(typename Traits::EvalData workset)
   // time step
   dt = delta_time_(0);
 
-  // loop over cells and points for implicit time integration
-
   // constants for computations
   const double pi = acos(-1.0);
   const double onethrd = 1.0 / 3.0;
@@ -165,9 +162,9 @@ evaluateFields(typename Traits::EvalData workset)
   const double cub_tfpi = std::cbrt(3.0 / 4.0 / pi);
 
   // temporary variables
-  ScalarT n1_old, nb_old, sb_old, n1, nb, sb;
+  ScalarT n1, nb, sb;
   ScalarT n1_exp, nb_exp, sb_exp;
-  ScalarT d, g_old, g;
+  ScalarT d, g_old;
 
   const double pi2 = pi * pi;
   const double cube_root_pi2 = std::cbrt(pi2);
@@ -176,148 +173,196 @@ evaluateFields(typename Traits::EvalData workset)
   const double cube_root_9 = std::cbrt(9.0);
   const double cube_root_pi2_9 = std::cbrt(pi2 / 9.0);
 
-  for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+  // gather the points with tritium into the batch; if no tritium exists
+  // (note that concentration is in mol, not atoms) there is no need to
+  // solve the ODEs and the state is carried over
+  Batch& b = batch_;
+  b.cell.clear();
+  b.pt.clear();
+  for (int cell = 0; cell < workset.numCells; ++cell) {
+    for (int pt = 0; pt < num_pts_; ++pt) {
+      if (total_concentration_(cell, pt) > tolerance) {
+        b.cell.push_back(cell);
+        b.pt.push_back(pt);
+      } else {
+        he_concentration_(cell, pt) = he_concentration_old(cell, pt);
+        total_bubble_density_(cell, pt) = total_bubble_density_old(cell, pt);
+        bubble_volume_fraction_(cell, pt) = bubble_volume_fraction_old(cell, pt);
+      }
+    }
+  }
 
-    for (std::size_t pt = 0; pt < num_pts_; ++pt) {
+  int const
+  num_batch = b.cell.size();
 
-      // temporary variables
-      n1_old = he_concentration_old(cell, pt);
-      nb_old = total_bubble_density_old(cell, pt);
-      sb_old = bubble_volume_fraction_old(cell, pt);
-      n1 = n1_old;
-      nb = nb_old;
-      sb = sb_old;
-      d = diffusion_coefficient_(cell, pt);
+  b.resize(num_batch);
 
-      // determine if any tritium exists - note that concentration is in mol (not atoms)
-      // if no tritium exists, no need to solve the ODEs
-      if (total_concentration_(cell, pt) > tolerance) {
+  for (int k = 0; k < num_batch; ++k) {
+    int const cell = b.cell[k];
+    int const pt = b.pt[k];
+    b.n1_old[k] = he_concentration_old(cell, pt);
+    b.nb_old[k] = total_bubble_density_old(cell, pt);
+    b.sb_old[k] = bubble_volume_fraction_old(cell, pt);
+    b.d[k] = diffusion_coefficient_(cell, pt);
 
-        // source terms for helium bubble generation
-        g_old = avogadros_num_ * t_decay_constant_
-            * total_concentration_old(cell, pt);
-        g = avogadros_num_ * t_decay_constant_ * total_concentration_(cell, pt);
-
-        // check if old bubble density is small
-        // if small, use an explict guess to avoid issues with 1/nb and 1/sb in tangent
-
-        if (nb_old < tolerance) {
-
-          // explicit time integration for predictor
-          // Note that two or more steps are required to obtain a finite nb if the
-          // total_concentration_old is zero.
-          dt_explicit = dt / explicit_sub_increments;
-          n1_exp = n1_old;
-          nb_exp = nb_old;
-          sb_exp = sb_old;
-
-          const ScalarT nb_exp2 = nb_exp * nb_exp;
-          const ScalarT cube_root_nb_exp2 = lcm_cbrt(nb_exp2);
-
-          for (int sub_increment = 0; sub_increment < explicit_sub_increments;
-              sub_increment++) {
-            n1 = n1_exp
-                + dt_explicit
-                    * (g_old - 32.0 * pi * he_radius_ * d * n1_exp * n1_exp
-                        -
-                        4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp)
-                            * cube_root_nb_exp2);
-            nb = nb_exp
-                + dt_explicit * (16.0 * pi * he_radius_ * d * n1_exp * n1_exp);
-            sb = sb_exp
-                + atomic_omega / eta_ * dt_explicit
-                    * (32. * pi * he_radius_ * d * n1_exp * n1_exp +
-                        4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp) *
-                            cube_root_nb_exp2);
-            n1_exp = n1;
-            nb_exp = nb;
-            sb_exp = sb;
-          }
-        }
-
-        ScalarT nb2 = nb * nb;
-        ScalarT cube_root_nb2 = lcm_cbrt(nb2);
-        ScalarT cube_root_sb = lcm_cbrt(sb);
-
-        // calculate initial residual for a relative tolerance
-        residual(0) = n1 - n1_old
-            - dt * (g - 32.0 * pi * he_radius_ * d * n1 * n1 -
-                4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-        residual(1) = nb - nb_old - dt * (16.0 * pi * he_radius_ * d * n1 * n1);
-        residual(2) = sb - sb_old
-            - atomic_omega / eta_ * dt * (32. * pi * he_radius_ * d * n1 * n1 +
-                4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-        norm_residual_2 = minitensor::norm_square(residual);
-        norm_residual_goal_2 = tolerance_2 * norm_residual_2;
-        int iter(0);
-
-        // N-R loop for implicit time integration
-        while (norm_residual_2 > norm_residual_goal_2 && iter < maxIterations) {
-
-          // Common factors w/cube_root
-          ScalarT cube_root_nb = lcm_cbrt(nb);
-          nb2 = nb * nb;
-          cube_root_nb2 = lcm_cbrt(nb2);
-          cube_root_sb = lcm_cbrt(sb);
-          ScalarT sb2 = sb * sb;
-          ScalarT cube_root_sb2 = lcm_cbrt(sb2);
-
-          // calculate tangent
-          tangent(0, 0) = 1.0
-              + 2.0 * dt * d * (32.0 * n1 * pi * he_radius_ + cube_root_6 *
-                  cube_root_nb2 * cube_root_pi2 * cube_root_sb);
-          tangent(0, 1) = 4.0 * cube_root_2 * dt * d * n1 * cube_root_pi2 *
-              cube_root_sb / cube_root_9 / cube_root_nb;
-          tangent(0, 2) = 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 *
-              cube_root_pi2_9 / cube_root_sb2;
-          tangent(1, 0) = -32.0 * dt * d * n1 * pi * he_radius_;
-          tangent(1, 1) = 1.0;
-          tangent(1, 2) = 0.0;
-          tangent(2, 0) = -2.0 * dt * d * atomic_omega
-              * (32.0 * n1 * pi * he_radius_ + cube_root_6 *
-                  cube_root_nb2 * cube_root_pi2 * cube_root_sb) / eta_;
-          tangent(2, 1) = -4.0 * cube_root_2 * dt * d * n1 * atomic_omega *
-              cube_root_pi2 * cube_root_sb / cube_root_9 / eta_ / cube_root_nb;
-          tangent(2, 2) = 1.0
-              - 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 *
-                  atomic_omega * cube_root_pi2_9 / eta_ / cube_root_sb2;
-
-          // find increment
-          increment = -minitensor::inverse(tangent) * residual;
-
-          // update quantities
-          n1 = n1 + increment(0);
-          nb = nb + increment(1);
-          sb = sb + increment(2);
-
-          nb2 = nb * nb;
-          cube_root_nb2 = lcm_cbrt(nb2);
-          cube_root_sb = lcm_cbrt(sb);
-
-          // find new residual and norm
-          residual(0) = n1 - n1_old
-              - dt * (g - 32. * pi * he_radius_ * d * n1 * n1 -
-                  4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
-          residual(1) = nb - nb_old
-              - dt * (16.0 * pi * he_radius_ * d * n1 * n1);
-          residual(2) = sb - sb_old
-              - atomic_omega / eta_ * dt
-                  * (32. * pi * he_radius_ * d * n1 * n1
-                      +
-                      4.0 * pi * d * n1 * cub_tfpi * cube_root_sb
-                          * cube_root_nb2);
-          norm_residual_2 = minitensor::norm_square(residual);
-          iter++;
-        }
+    // source terms for helium bubble generation
+    b.g_old[k] = avogadros_num_ * t_decay_constant_
+        * total_concentration_old(cell, pt);
+    b.g[k] = avogadros_num_ * t_decay_constant_ * total_concentration_(cell, pt);
+
+    b.n1[k] = b.n1_old[k];
+    b.nb[k] = b.nb_old[k];
+    b.sb[k] = b.sb_old[k];
+  }
+
+  // check if old bubble density is small
+  // if small, use an explict guess to avoid issues with 1/nb and 1/sb in tangent
+  for (int k = 0; k < num_batch; ++k) {
+    if (b.nb_old[k] < tolerance) {
+
+      // explicit time integration for predictor
+      // Note that two or more steps are required to obtain a finite nb if the
+      // total_concentration_old is zero.
+      dt_explicit = dt / explicit_sub_increments;
+      n1_exp = b.n1_old[k];
+      nb_exp = b.nb_old[k];
+      sb_exp = b.sb_old[k];
+      d = b.d[k];
+      g_old = b.g_old[k];
+
+      const ScalarT nb_exp2 = nb_exp * nb_exp;
+      const ScalarT cube_root_nb_exp2 = lcm_cbrt(nb_exp2);
+
+      for (int sub_increment = 0; sub_increment < explicit_sub_increments;
+          sub_increment++) {
+        n1 = n1_exp
+            + dt_explicit
+                * (g_old - 32.0 * pi * he_radius_ * d * n1_exp * n1_exp
+                    -
+                    4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp)
+                        * cube_root_nb_exp2);
+        nb = nb_exp
+            + dt_explicit * (16.0 * pi * he_radius_ * d * n1_exp * n1_exp);
+        sb = sb_exp
+            + atomic_omega / eta_ * dt_explicit
+                * (32. * pi * he_radius_ * d * n1_exp * n1_exp +
+                    4.0 * pi * d * n1_exp * cub_tfpi * lcm_cbrt(sb_exp) *
+                        cube_root_nb_exp2);
+        n1_exp = n1;
+        nb_exp = nb;
+        sb_exp = sb;
       }
 
-      // Update global fields
+      b.n1[k] = n1;
+      b.nb[k] = nb;
+      b.sb[k] = sb;
+    }
+  }
 
-      he_concentration_(cell, pt) = n1;
-      total_bubble_density_(cell, pt) = nb;
-      bubble_volume_fraction_(cell, pt) = sb;
+  // residual of the backward Euler update of point k
+  auto
+  compute_residual = [&](int const k)
+  {
+    ScalarT const n1 = b.n1[k], nb = b.nb[k], sb = b.sb[k], d = b.d[k];
+    ScalarT const cube_root_nb2 = lcm_cbrt(nb * nb);
+    ScalarT const cube_root_sb = lcm_cbrt(sb);
+
+    b.r0[k] = n1 - b.n1_old[k]
+        - dt * (b.g[k] - 32.0 * pi * he_radius_ * d * n1 * n1 -
+            4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
+    b.r1[k] = nb - b.nb_old[k] - dt * (16.0 * pi * he_radius_ * d * n1 * n1);
+    b.r2[k] = sb - b.sb_old[k]
+        - atomic_omega / eta_ * dt * (32. * pi * he_radius_ * d * n1 * n1 +
+            4.0 * pi * d * n1 * cub_tfpi * cube_root_sb * cube_root_nb2);
+    b.norm_r2[k] = b.r0[k] * b.r0[k] + b.r1[k] * b.r1[k] + b.r2[k] * b.r2[k];
+  };
+
+  // calculate initial residual for a relative tolerance
+  b.todo.clear();
+  for (int k = 0; k < num_batch; ++k) {
+    compute_residual(k);
+    b.goal_r2[k] = tolerance_2 * b.norm_r2[k];
+    if (b.norm_r2[k] > b.goal_r2[k]) b.todo.push_back(k);
+  }
+
+  // N-R loop for implicit time integration, over the points of the batch
+  // that have not converged yet
+  for (int iter = 0; iter < maxIterations && b.todo.empty() == false; ++iter) {
+
+    for (int const k : b.todo) {
+      n1 = b.n1[k];
+      nb = b.nb[k];
+      sb = b.sb[k];
+      d = b.d[k];
+
+      // Common factors w/cube_root
+      ScalarT cube_root_nb = lcm_cbrt(nb);
+      ScalarT cube_root_nb2 = lcm_cbrt(nb * nb);
+      ScalarT cube_root_sb = lcm_cbrt(sb);
+      ScalarT cube_root_sb2 = lcm_cbrt(sb * sb);
+
+      // calculate tangent
+      tangent(0, 0) = 1.0
+          + 2.0 * dt * d * (32.0 * n1 * pi * he_radius_ + cube_root_6 *
+              cube_root_nb2 * cube_root_pi2 * cube_root_sb);
+      tangent(0, 1) = 4.0 * cube_root_2 * dt * d * n1 * cube_root_pi2 *
+          cube_root_sb / cube_root_9 / cube_root_nb;
+      tangent(0, 2) = 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 *
+          cube_root_pi2_9 / cube_root_sb2;
+      tangent(1, 0) = -32.0 * dt * d * n1 * pi * he_radius_;
+      tangent(1, 1) = 1.0;
+      tangent(1, 2) = 0.0;
+      tangent(2, 0) = -2.0 * dt * d * atomic_omega
+          * (32.0 * n1 * pi * he_radius_ + cube_root_6 *
+              cube_root_nb2 * cube_root_pi2 * cube_root_sb) / eta_;
+      tangent(2, 1) = -4.0 * cube_root_2 * dt * d * n1 * atomic_omega *
+          cube_root_pi2 * cube_root_sb / cube_root_9 / eta_ / cube_root_nb;
+      tangent(2, 2) = 1.0
+          - 2.0 * cube_root_2 * dt * d * n1 * cube_root_nb2 *
+              atomic_omega * cube_root_pi2_9 / eta_ / cube_root_sb2;
+
+      residual(0) = b.r0[k];
+      residual(1) = b.r1[k];
+      residual(2) = b.r2[k];
+
+      // find increment
+      increment = -minitensor::inverse(tangent) * residual;
+
+      // update quantities
+      b.n1[k] = n1 + increment(0);
+      b.nb[k] = nb + increment(1);
+      b.sb[k] = sb + increment(2);
+
+      // find new residual and norm
+      compute_residual(k);
+    }
 
+    // drop the converged points
+    std::size_t num_todo = 0;
+    for (int const k : b.todo) {
+      if (b.norm_r2[k] > b.goal_r2[k]) b.todo[num_todo++] = k;
     }
+    b.todo.resize(num_todo);
+  }
+
+  // Update global fields
+  for (int k = 0; k < num_batch; ++k) {
+    int const cell = b.cell[k];
+    int const pt = b.pt[k];
+    he_concentration_(cell, pt) = b.n1[k];
+    total_bubble_density_(cell, pt) = b.nb[k];
+    bubble_volume_fraction_(cell, pt) = b.sb[k];
+  }
+}
+
+//------------------------------------------------------------------------------
+template<typename EvalT, typename Traits>
+void HeliumODEs<EvalT, Traits>::Batch::
+resize(std::size_t const n)
+{
+  for (std::vector<ScalarT>* v : {&n1_old, &nb_old, &sb_old, &d, &g_old, &g,
+      &n1, &nb, &sb, &r0, &r1, &r2, &norm_r2, &goal_r2}) {
+    v->resize(n);
   }
 }
 //------------------------------------------------------------------------------
@@ -159,6 +159,11 @@ private:
   minitensor::Tensor<RealType, CP::MAX_DIM>
   element_block_orientation_;
 
+  /// Orientation of each element block, by Workset::EBIndex, for element
+  /// blocks sharing this model; empty otherwise
+  std::vector<minitensor::Tensor<RealType, CP::MAX_DIM>>
+  block_orientations_;
+
   /// Number of slip families
   int
   num_family_{0};
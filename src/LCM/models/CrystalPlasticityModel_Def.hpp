@@ -5,6 +5,7 @@
 //*****************************************************************//
 
 #include "Teuchos_TestForException.hpp"
+#include "Teuchos_TwoDArray.hpp"
 /*
 #include "Teuchos_LAPACK.hpp"
 #include <Tsqr_Matrix.hpp>
@@ -114,6 +115,23 @@ CrystalPlasticityKernel(
     }
   }
 
+  if (p->isType<Teuchos::TwoDArray<RealType>>("Element Block Orientations")) {
+    Teuchos::TwoDArray<RealType> const &
+    orientations = p->get<Teuchos::TwoDArray<RealType>>(
+        "Element Block Orientations");
+
+    block_orientations_.resize(orientations.getNumRows());
+    for (int block = 0; block < block_orientations_.size(); ++block) {
+      block_orientations_[block].set_dimension(num_dims_);
+      for (int j = 0; j < num_dims_; ++j) {
+        for (int i = 0; i < num_dims_; ++i) {
+          block_orientations_[block](j, i) =
+              orientations(block, j * num_dims_ + i);
+        }
+      }
+    }
+  }
+
   verbosity_ = preader.getVerbosity();
 
 	integration_scheme_ = preader.getIntegrationScheme();
@@ -439,6 +457,13 @@ void CrystalPlasticityKernel<EvalT, Traits>::init(
     ALBANY_ASSERT(rotation_matrix_transpose_.is_null() == false,
         "Rotation matrix not found on genesis mesh");
   }
+  else if (block_orientations_.empty() == false)
+  {
+    ALBANY_ASSERT(workset.EBIndex >= 0 &&
+        workset.EBIndex < block_orientations_.size(),
+        "No lattice orientation for element block " << workset.EBName);
+    element_block_orientation_ = block_orientations_[workset.EBIndex];
+  }
 
   //
   // extract dependent MDFields
@@ -8,97 +8,96 @@
 #define LCM_ElastoViscoplasticModel_hpp
 
 #include "ElastoViscoplasticCore.hpp"
-#include "ConstitutiveModel.hpp"
+#include "../parallel_models/ParallelConstitutiveModel.hpp"
 
 namespace LCM
 {
 
-//! \brief Elasto Viscoplastic Constitutive Model
+//! \brief Elasto Viscoplastic Kernel, evaluated for each (cell, point)
 template<typename EvalT, typename Traits>
-class ElastoViscoplasticModel: public LCM::ConstitutiveModel<EvalT, Traits>
+struct ElastoViscoplasticKernel : public ParallelKernel<EvalT, Traits>
 {
-public:
-
-  using Base = LCM::ConstitutiveModel<EvalT, Traits>;
-  using DepFieldMap = typename Base::DepFieldMap;
-  using FieldMap = typename Base::FieldMap;
-
-  typedef typename EvalT::ScalarT ScalarT;
-  typedef typename EvalT::MeshScalarT MeshScalarT;
-  typedef typename Sacado::Fad::DFad<ScalarT> Fad;
-
-  using ConstitutiveModel<EvalT, Traits>::num_dims_;
-  using ConstitutiveModel<EvalT, Traits>::num_pts_;
-  using ConstitutiveModel<EvalT, Traits>::field_name_map_;
-
-  // optional temperature support
-  using ConstitutiveModel<EvalT, Traits>::have_temperature_;
-  using ConstitutiveModel<EvalT, Traits>::expansion_coeff_;
-  using ConstitutiveModel<EvalT, Traits>::ref_temperature_;
-  using ConstitutiveModel<EvalT, Traits>::heat_capacity_;
-  using ConstitutiveModel<EvalT, Traits>::density_;
-  using ConstitutiveModel<EvalT, Traits>::temperature_;
-  using ConstitutiveModel<EvalT, Traits>::have_total_concentration_;
-  using ConstitutiveModel<EvalT, Traits>::have_total_bubble_density_;
-  using ConstitutiveModel<EvalT, Traits>::have_bubble_volume_fraction_;
-  using ConstitutiveModel<EvalT, Traits>::total_concentration_;
-  using ConstitutiveModel<EvalT, Traits>::total_bubble_density_;
-  using ConstitutiveModel<EvalT, Traits>::bubble_volume_fraction_;
-
   ///
   /// Constructor
   ///
-  ElastoViscoplasticModel(Teuchos::ParameterList* p,
+  ElastoViscoplasticKernel(ConstitutiveModel<EvalT, Traits> &model,
+      Teuchos::ParameterList* p,
       const Teuchos::RCP<Albany::Layouts>& dl);
 
-  ///
-  /// Virtual Denstructor
-  ///
-  virtual
-  ~ElastoViscoplasticModel()
-  {};
+  ElastoViscoplasticKernel(const ElastoViscoplasticKernel&) = delete;
+  ElastoViscoplasticKernel& operator=(const ElastoViscoplasticKernel&) = delete;
 
-  ///
-  /// Method to compute the state (e.g. energy, stress, tangent)
-  ///
-  virtual
-  void
-  computeState(typename Traits::EvalData workset,
-      DepFieldMap dep_fields,
-      FieldMap eval_fields);
+  using ScalarT = typename EvalT::ScalarT;
+  using MeshScalarT = typename EvalT::MeshScalarT;
+  using ScalarField = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<const ScalarT>;
+  using BaseKernel = ParallelKernel<EvalT, Traits>;
+  using Workset = typename BaseKernel::Workset;
+  typedef typename Sacado::Fad::DFad<ScalarT> Fad;
 
-  virtual
-  void
-  computeStateParallel(typename Traits::EvalData workset,
-      DepFieldMap dep_fields,
-      FieldMap eval_fields){
-         TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "Not implemented.");
- }
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+  using BaseKernel::field_name_map_;
 
+  // optional temperature support
+  using BaseKernel::have_temperature_;
+  using BaseKernel::expansion_coeff_;
+  using BaseKernel::ref_temperature_;
+  using BaseKernel::heat_capacity_;
+  using BaseKernel::density_;
+  using BaseKernel::temperature_;
+  using BaseKernel::have_total_concentration_;
+  using BaseKernel::have_total_bubble_density_;
+  using BaseKernel::have_bubble_volume_fraction_;
+  using BaseKernel::total_concentration_;
+  using BaseKernel::total_bubble_density_;
+  using BaseKernel::bubble_volume_fraction_;
+
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+  using BaseKernel::addStateVariable;
+
+  // Dependent MDFields
+  ConstScalarField def_grad_field;
+  ConstScalarField J;
+  ConstScalarField poissons_ratio;
+  ConstScalarField elastic_modulus;
+  ConstScalarField yield_strength;
+  ConstScalarField hardening_modulus;
+  ConstScalarField recovery_modulus;
+  ConstScalarField flow_exp;
+  ConstScalarField flow_coeff;
+  ConstScalarField delta_time;
+
+  // Evaluated MDFields
+  ScalarField stress_field;
+  ScalarField Fp_field;
+  ScalarField eqps_field;
+  ScalarField eps_ss_field;
+  ScalarField kappa_field;
+  ScalarField void_volume_fraction_field;
+  ScalarField source_field;
+
+  // State Variables
+  Albany::MDArray Fp_field_old;
+  Albany::MDArray eqps_field_old;
+  Albany::MDArray eps_ss_field_old;
+  Albany::MDArray kappa_field_old;
+  Albany::MDArray void_volume_fraction_field_old;
+
+  void init(Workset &workset,
+      FieldMap<const ScalarT> &dep_fields,
+      FieldMap<ScalarT> &eval_fields);
+
+  ///
+  /// Return mapping at one integration point. The local Newton solve
+  /// only uses data owned by the call, so points run concurrently.
+  ///
+  KOKKOS_INLINE_FUNCTION
+  void operator() (int cell, int pt) const;
 
 private:
 
-  ///
-  /// Private to prohibit copying
-  ///
-  ElastoViscoplasticModel(const ElastoViscoplasticModel&);
-
-  ///
-  /// Private to prohibit copying
-  ///
-  ElastoViscoplasticModel& operator=(const ElastoViscoplasticModel&);
-
-  ///
-  /// compute stresses
-  ///
-  // template<typename ArgT>
-  // void
-  // computeStress(minitensor::Tensor<ScalarT> const & F,
-  //     minitensor::Tensor<ArgT> const & Fp,
-  //     minitensor::Tensor<ArgT> & T,
-  //     minitensor::Tensor<ArgT> & S,
-  //     std::vector<ArgT> & shear) const;
-
   ///
   /// Initial Void Volume
   ///xs
@@ -134,23 +133,6 @@ private:
   ///
   RealType alpha1_, alpha2_, Ra_;
 
-  ///
-  /// Flow Rule Scale Factor
-  ///
-  RealType f_scale_;
-
-  ///
-  /// Solution options
-  ///
-  bool apply_slip_predictor_;
-  minitensor::StepType step_type_;
-
-  RealType implicit_nonlinear_solver_relative_tolerance_;
-  RealType implicit_nonlinear_solver_absolute_tolerance_;
-  int implicit_nonlinear_solver_max_iterations_;
-  int implicit_nonlinear_solver_min_iterations_;
-
-
   ///
   /// flag to print convergence
   ///
@@ -161,8 +143,21 @@ private:
   ///
   template<typename T>
   T
-  compute_fstar(T f, RealType fc, RealType ff, RealType q1);
+  compute_fstar(T f, RealType fc, RealType ff, RealType q1) const;
+
+};
+
+//! \brief Elasto Viscoplastic Constitutive Model
+template<typename EvalT, typename Traits>
+class ElastoViscoplasticModel: public LCM::ParallelConstitutiveModel<EvalT, Traits, ElastoViscoplasticKernel<EvalT, Traits>>
+{
+public:
 
+  ///
+  /// Constructor
+  ///
+  ElastoViscoplasticModel(Teuchos::ParameterList* p,
+      const Teuchos::RCP<Albany::Layouts>& dl);
 };
 }
 
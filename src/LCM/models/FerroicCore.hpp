@@ -4,6 +4,8 @@
 #include <MiniTensor.h>
 #include <MiniNonlinearSolver.h>
 
+#include <array>
+
 namespace FM
 {
 
@@ -71,6 +73,13 @@ struct Transition
 
 
 
+///
+/// Index of each transition I*nVariants+J among the active transitions,
+/// or -1 if inactive. Fixed size, so that no per point solve allocates.
+///
+using TransitionMap = std::array<int, MAX_TRNS>;
+
+
 /******************************************************************************/
 // Service functions:
 /******************************************************************************/
@@ -112,9 +121,9 @@ template<typename DataT, typename ArgT>
 void
 computeBinFractions(
     minitensor::Vector<ArgT, FM::MAX_TRNS> const & xi,
-    Teuchos::Array<ArgT>                        & newFractions,
+    minitensor::Vector<ArgT, FM::MAX_VRNT>       & newFractions,
     Teuchos::Array<DataT>                 const & oldFractions,
-    Teuchos::Array<int>                   const & transitionMap,
+    TransitionMap                         const & transitionMap,
     Kokkos::DynRankView<DataT>            const & aMatrix);
 
 
@@ -134,7 +143,7 @@ computeInitialState(
 template<typename ArgT>
 void
 computeRelaxedState(
-    Teuchos::Array<ArgT>                const & fractions,
+    minitensor::Vector<ArgT,FM::MAX_VRNT> const & fractions,
     Teuchos::Array<FM::CrystalVariant>  const & crystalVariants,
     minitensor::Tensor<ArgT,FM::THREE_D> const & x,
     minitensor::Tensor<ArgT,FM::THREE_D>       & X,
@@ -148,8 +157,8 @@ template<typename DataT, typename ArgT>
 void
 computeResidual(
     minitensor::Vector<ArgT, FM::MAX_TRNS>       & residual,
-    Teuchos::Array<ArgT>                  const & fractions,
-    Teuchos::Array<int>                   const & transitionMap,
+    minitensor::Vector<ArgT, FM::MAX_VRNT> const & fractions,
+    TransitionMap                         const & transitionMap,
     Teuchos::Array<FM::Transition>        const & transitions,
     Teuchos::Array<FM::CrystalVariant>    const & crystalVariants,
     Teuchos::Array<DataT>                 const & tBarrier,
@@ -228,7 +237,7 @@ private:
   RealType m_dt;
   int m_numActiveTransitions;
 
-  Teuchos::Array<int> m_transitionMap;
+  TransitionMap m_transitionMap;
 };
 
 } // namespace FM
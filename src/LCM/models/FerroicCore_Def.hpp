@@ -37,7 +37,6 @@ FM::DomainSwitching<EvalT, M>::DomainSwitching(
   // set all transitions active for first residual eval
   //
   int nTransitions = m_transitions.size();
-  m_transitionMap.resize(nTransitions);
   for(int J=0; J<nTransitions; J++){
     m_transitionMap[J] = J;
   }
@@ -95,7 +94,8 @@ FM::DomainSwitching<EvalT, M>::gradient(minitensor::Vector<T, N> const & xi) con
 
   // apply transition increment
   //
-  Teuchos::Array<T> fractionsNew(m_binFractions.size());
+  minitensor::Vector<T, FM::MAX_VRNT> fractionsNew;
+  fractionsNew.set_dimension(m_binFractions.size());
   computeBinFractions(xi, fractionsNew, m_binFractions, m_transitionMap, m_aMatrix);
 
   minitensor::Tensor<T, FM::THREE_D> const
@@ -227,19 +227,25 @@ template<typename DataT, typename ArgT>
 void
 FM::computeBinFractions(
     minitensor::Vector<ArgT, FM::MAX_TRNS> const & xi,
-    Teuchos::Array<ArgT>                        & newFractions,
+    minitensor::Vector<ArgT, FM::MAX_VRNT>       & newFractions,
     Teuchos::Array<DataT>                 const & oldFractions,
-    Teuchos::Array<int>                   const & transitionMap,
+    FM::TransitionMap                     const & transitionMap,
     Kokkos::DynRankView<DataT>            const & aMatrix)
 /******************************************************************************/
 {
+  // Row I of aMatrix is only nonzero for the transitions out of (I*n+J)
+  // and into (J*n+I) variant I
   int nVariants = oldFractions.size();
-  int nTransitions = transitionMap.size();
   for(int I=0;I<nVariants;I++){
-    newFractions[I] = oldFractions[I];
-    for(int i=0;i<nTransitions;i++){
-      if(transitionMap[i] >= 0){
-        newFractions[I] += xi(transitionMap[i])*aMatrix(I,i);
+    newFractions(I) = oldFractions[I];
+    for(int J=0;J<nVariants;J++){
+      int from = I*nVariants+J;
+      if(transitionMap[from] >= 0){
+        newFractions(I) += xi(transitionMap[from])*aMatrix(I,from);
+      }
+      int to = J*nVariants+I;
+      if(J != I && transitionMap[to] >= 0){
+        newFractions(I) += xi(transitionMap[to])*aMatrix(I,to);
       }
     }
   }
@@ -290,7 +296,7 @@ FM::computeInitialState(
 template<typename ArgT>
 void
 FM::computeRelaxedState(
-    Teuchos::Array<ArgT>                const & fractions,
+    minitensor::Vector<ArgT,FM::MAX_VRNT> const & fractions,
     Teuchos::Array<FM::CrystalVariant>  const & crystalVariants,
     minitensor::Tensor<ArgT,FM::THREE_D> const & x,
     minitensor::Tensor<ArgT,FM::THREE_D>       & X,
@@ -330,8 +336,8 @@ template<typename DataT, typename ArgT>
 void
 FM::computeResidual(
     minitensor::Vector<ArgT, FM::MAX_TRNS>       & residual,
-    Teuchos::Array<ArgT>                  const & fractions,
-    Teuchos::Array<int>                   const & transitionMap,
+    minitensor::Vector<ArgT, FM::MAX_VRNT> const & fractions,
+    FM::TransitionMap                     const & transitionMap,
     Teuchos::Array<FM::Transition>        const & transitions,
     Teuchos::Array<FM::CrystalVariant>    const & crystalVariants,
     Teuchos::Array<DataT>                 const & tBarrier,
@@ -342,7 +348,7 @@ FM::computeResidual(
     minitensor::Vector<ArgT,FM::THREE_D>   const & linear_D)
 /******************************************************************************/
 {
-  int nVariants = fractions.size();
+  int nVariants = fractions.get_dimension();
   ArgT half = 1.0/2.0;
   for(int I=0;I<nVariants;I++){
     ArgT fracI = fractions[I];
@@ -357,18 +363,20 @@ FM::computeResidual(
       }
     }
   }
-  int nTransitions = transitions.size();
   for(int I=0;I<nVariants;I++){
     ArgT myRate(0.0);
     const CrystalVariant& variant = crystalVariants[I];
     myRate += dotdot(linear_x,dotdot(variant.C,linear_x)-dot(linear_D,variant.h))*half;
     myRate += dot(linear_D,dot(variant.b,linear_D)-dotdot(variant.h,linear_x))*half;
-    for(int i=0;i<nTransitions;i++){
-      if(transitionMap[i] >= 0){
-        DataT aVal = aMatrix(I,i);
-        if( aVal == 0.0 ) continue;
-        int lindex = transitionMap[i];
-        residual[lindex] += aVal*myRate;
+    // only the transitions out of and into variant I have aMatrix(I,i) != 0
+    for(int J=0;J<nVariants;J++){
+      int from = I*nVariants+J;
+      if(transitionMap[from] >= 0 && aMatrix(I,from) != 0.0){
+        residual[transitionMap[from]] += aMatrix(I,from)*myRate;
+      }
+      int to = J*nVariants+I;
+      if(J != I && transitionMap[to] >= 0 && aMatrix(I,to) != 0.0){
+        residual[transitionMap[to]] += aMatrix(I,to)*myRate;
       }
     }
   }
@@ -303,7 +303,14 @@ J2MiniKernel<EvalT, Traits>::operator()(int cell, int pt) const
 
     minitensor::Vector<ScalarT, nls_dim> x;
 
-    x(0) = 0.0;
+    // Start Newton from the root of the residual linearized at the old
+    // state. It is exact for linear hardening, and with saturation the
+    // residual is convex so the iterates decrease monotonically to the
+    // root. The iteration count is then nearly the same at all the points.
+    ScalarT const dH0 =
+        K + sat_exp * sat_mod * std::exp(-sat_exp * eqpsold(cell, pt));
+
+    x(0) = f / (2.0 * mubar + (2.0 / 3.0) * dH0);
 
     LCM::MiniSolver<MIN, STEP, NLS, EvalT, nls_dim> mini_solver(
         minimizer, step, j2nls, x);
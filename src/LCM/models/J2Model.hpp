@@ -8,79 +8,118 @@
 #define LCM_J2Model_hpp
 
 #include "Albany_Layouts.hpp"
-#include "LCM/models/ConstitutiveModel.hpp"
 #include "Phalanx_Evaluator_Derived.hpp"
 #include "Phalanx_Evaluator_WithBaseImpl.hpp"
 #include "Phalanx_MDField.hpp"
 #include "Phalanx_config.hpp"
+#include "../parallel_models/ParallelConstitutiveModel.hpp"
 
 namespace LCM {
 
-//! \brief J2 Plasticity Constitutive Model
+//! \brief J2 Plasticity Kernel, evaluated for each (cell, point)
 template<typename EvalT, typename Traits>
-class J2Model : public LCM::ConstitutiveModel<EvalT, Traits> {
- public:
-  using Base        = LCM::ConstitutiveModel<EvalT, Traits>;
-  using DepFieldMap = typename Base::DepFieldMap;
-  using FieldMap    = typename Base::FieldMap;
-
-  typedef typename EvalT::ScalarT     ScalarT;
-  typedef typename EvalT::MeshScalarT MeshScalarT;
-
-  using ConstitutiveModel<EvalT, Traits>::num_dims_;
-  using ConstitutiveModel<EvalT, Traits>::num_pts_;
-  using ConstitutiveModel<EvalT, Traits>::field_name_map_;
-
-  // optional temperature support
-  using ConstitutiveModel<EvalT, Traits>::have_temperature_;
-  using ConstitutiveModel<EvalT, Traits>::expansion_coeff_;
-  using ConstitutiveModel<EvalT, Traits>::ref_temperature_;
-  using ConstitutiveModel<EvalT, Traits>::heat_capacity_;
-  using ConstitutiveModel<EvalT, Traits>::density_;
-  using ConstitutiveModel<EvalT, Traits>::temperature_;
-
+struct J2Kernel : public ParallelKernel<EvalT, Traits>
+{
   ///
   /// Constructor
   ///
-  J2Model(Teuchos::ParameterList* p, const Teuchos::RCP<Albany::Layouts>& dl);
+  J2Kernel(
+      ConstitutiveModel<EvalT, Traits>&    model,
+      Teuchos::ParameterList*              p,
+      Teuchos::RCP<Albany::Layouts> const& dl);
 
   ///
-  /// Virtual Denstructor
+  /// No copy constructor
   ///
-  virtual ~J2Model(){};
+  J2Kernel(J2Kernel const&) = delete;
 
   ///
-  /// Method to compute the state (e.g. energy, stress, tangent)
+  /// No copy assignment
   ///
-  virtual void
-  computeState(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+  J2Kernel&
+  operator=(J2Kernel const&) = delete;
+
+  using ScalarT          = typename EvalT::ScalarT;
+  using ScalarField      = PHX::MDField<ScalarT>;
+  using ConstScalarField = PHX::MDField<ScalarT const>;
+  using BaseKernel       = ParallelKernel<EvalT, Traits>;
+  using Workset          = typename BaseKernel::Workset;
+
+  using BaseKernel::num_dims_;
+  using BaseKernel::num_pts_;
+  using BaseKernel::field_name_map_;
+
+  // optional temperature support
+  using BaseKernel::have_temperature_;
+  using BaseKernel::expansion_coeff_;
+  using BaseKernel::ref_temperature_;
+  using BaseKernel::heat_capacity_;
+  using BaseKernel::density_;
+  using BaseKernel::temperature_;
+
+  using BaseKernel::setDependentField;
+  using BaseKernel::setEvaluatedField;
+  using BaseKernel::addStateVariable;
+
+  // Dependent MDFields
+  ConstScalarField def_grad;
+  ConstScalarField J;
+  ConstScalarField poissons_ratio;
+  ConstScalarField elastic_modulus;
+  ConstScalarField yieldStrength;
+  ConstScalarField hardeningModulus;
+  ConstScalarField delta_time;
+
+  // Evaluated MDFields
+  ScalarField stress;
+  ScalarField Fp;
+  ScalarField eqps;
+  ScalarField yieldSurf;
+  ScalarField source;
+
+  Albany::MDArray Fpold;
+  Albany::MDArray eqpsold;
 
- private:
   ///
-  /// Private to prohibit copying
+  /// Saturation hardening constants
   ///
-  J2Model(const J2Model&);
+  RealType sat_mod_, sat_exp_;
+
+  void
+  init(
+      Workset&                 workset,
+      FieldMap<ScalarT const>& dep_fields,
+      FieldMap<ScalarT>&       eval_fields);
 
   ///
-  /// Private to prohibit copying
+  /// Return mapping at one integration point. The local Newton solve
+  /// only uses data owned by the call, so points run concurrently.
   ///
-  J2Model&
-  operator=(const J2Model&);
+  KOKKOS_INLINE_FUNCTION
+  void
+  operator()(int cell, int pt) const;
 
   ///
-  /// Saturation hardening constants
+  /// Return mapping with tensors of static dimension DIM, or of dimension
+  /// num_dims_ for minitensor::DYNAMIC. The static versions keep the
+  /// local tensors off the heap and let the tensor loops unroll.
   ///
-  RealType sat_mod_, sat_exp_;
+  template<minitensor::Index DIM>
+  KOKKOS_INLINE_FUNCTION
+  void
+  computeState(int cell, int pt) const;
+};
 
-  // Kokkos
-  virtual void
-  computeStateParallel(
-      typename Traits::EvalData workset,
-      DepFieldMap               dep_fields,
-      FieldMap                  eval_fields);
+//! \brief J2 Plasticity Constitutive Model
+template<typename EvalT, typename Traits>
+class J2Model
+    : public LCM::
+          ParallelConstitutiveModel<EvalT, Traits, J2Kernel<EvalT, Traits>> {
+ public:
+  ///
+  /// Constructor
+  ///
+  J2Model(Teuchos::ParameterList* p, const Teuchos::RCP<Albany::Layouts>& dl);
 };
 }
 
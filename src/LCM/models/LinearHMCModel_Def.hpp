@@ -110,7 +110,8 @@ computeState(typename Traits::EvalData workset,
 	macroStress(cell,qp,0,0) = C11 * macroStrain(cell,qp,0,0);
     break;
   case 2:
-    // Compute Stress (plane strain)
+    // Compute Stress (plane strain), and the micro and double stresses of all
+    // the scales at the same point while its data is at hand
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
       for (std::size_t qp=0; qp < num_pts_; ++qp) {
         auto e1 = macroStrain(cell,qp,0,0);
@@ -120,49 +121,44 @@ computeState(typename Traits::EvalData workset,
         macroStress(cell,qp,1,1) = C12*e1 + C11*e2;
         macroStress(cell,qp,0,1) = C44*e3;
         macroStress(cell,qp,1,0) = macroStress(cell,qp,0,1);
-      }
-    }
-    // Compute Micro Stress
-    for(int i=0; i<numMicroScales; i++){
-      auto &sd = strainDifference[i];
-      auto &ms = microStress[i];
-      ScalarT beta = betaParameter[i];
-      for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-        for (std::size_t qp=0; qp < num_pts_; ++qp) {
-          const ScalarT e1 = sd(cell,qp,0,0),
-                        e2 = sd(cell,qp,1,1),
-                        e3 = sd(cell,qp,0,1),
-                        e4 = sd(cell,qp,1,0);
-          ms(cell,qp,0,0) = beta*(C11*e1 + C12*e2);
-          ms(cell,qp,1,1) = beta*(C12*e1 + C11*e2);
-          ms(cell,qp,0,1) = beta*(C44*e3);
-          ms(cell,qp,1,0) = beta*(C44*e4);
-        }
-      }
-    }
-    // Compute Double Stress
-    for(int i=0; i<numMicroScales; i++){
-      auto &msg = microStrainGradient[i];
-      auto &ds = doubleStress[i];
-      ScalarT beta = lengthScale[i]*lengthScale[i]*betaParameter[i];
-      for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-        for (std::size_t qp=0; qp < num_pts_; ++qp) {
+
+        for(int i=0; i<numMicroScales; i++){
+          // Compute Micro Stress
+          auto &sd = strainDifference[i];
+          auto &ms = microStress[i];
+          const RealType beta = betaParameter[i];
+          {
+            const ScalarT e1 = sd(cell,qp,0,0),
+                          e2 = sd(cell,qp,1,1),
+                          e3 = sd(cell,qp,0,1),
+                          e4 = sd(cell,qp,1,0);
+            ms(cell,qp,0,0) = beta*(C11*e1 + C12*e2);
+            ms(cell,qp,1,1) = beta*(C12*e1 + C11*e2);
+            ms(cell,qp,0,1) = beta*(C44*e3);
+            ms(cell,qp,1,0) = beta*(C44*e4);
+          }
+
+          // Compute Double Stress
+          auto &msg = microStrainGradient[i];
+          auto &ds = doubleStress[i];
+          const RealType dbeta = lengthScale[i]*lengthScale[i]*beta;
           for (std::size_t k=0; k < num_dims_; ++k) {
             auto e1 = msg(cell,qp,0,0,k);
             auto e2 = msg(cell,qp,1,1,k);
             auto e3 = msg(cell,qp,0,1,k);
             auto e4 = msg(cell,qp,1,0,k);
-            ds(cell,qp,0,0,k) = beta*(C11*e1 + C12*e2);
-            ds(cell,qp,1,1,k) = beta*(C12*e1 + C11*e2);
-            ds(cell,qp,0,1,k) = beta*(C44*e3);
-            ds(cell,qp,1,0,k) = beta*(C44*e4);
+            ds(cell,qp,0,0,k) = dbeta*(C11*e1 + C12*e2);
+            ds(cell,qp,1,1,k) = dbeta*(C12*e1 + C11*e2);
+            ds(cell,qp,0,1,k) = dbeta*(C44*e3);
+            ds(cell,qp,1,0,k) = dbeta*(C44*e4);
           }
         }
       }
     }
     break;
   case 3:
-    // Compute Stress
+    // Compute Stress, and the micro and double stresses of all the scales at
+    // the same point while its data is at hand
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
       for (std::size_t qp=0; qp < num_pts_; ++qp) {
         auto e1 = macroStrain(cell,qp,0,0);
@@ -180,43 +176,37 @@ computeState(typename Traits::EvalData workset,
         macroStress(cell,qp,1,0) = macroStress(cell,qp,0,1);
         macroStress(cell,qp,2,0) = macroStress(cell,qp,0,2);
         macroStress(cell,qp,2,1) = macroStress(cell,qp,1,2);
-      }
-    }
-    // Compute Micro Stress
-    for(int i=0; i<numMicroScales; i++){
-      auto &sd = strainDifference[i];
-      auto &ms = microStress[i];
-      ScalarT beta = betaParameter[i];
-      for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-        for (std::size_t qp=0; qp < num_pts_; ++qp) {
-          auto e1 = sd(cell,qp,0,0);
-          auto e2 = sd(cell,qp,1,1);
-          auto e3 = sd(cell,qp,2,2);
-          auto e4 = sd(cell,qp,1,2);
-          auto e5 = sd(cell,qp,0,2);
-          auto e6 = sd(cell,qp,0,1);
-          auto e7 = sd(cell,qp,2,1);
-          auto e8 = sd(cell,qp,2,0);
-          auto e9 = sd(cell,qp,1,0);
-          ms(cell,qp,0,0) = beta*(C11*e1 + C12*e2 + C23*e3);
-          ms(cell,qp,1,1) = beta*(C12*e1 + C11*e2 + C23*e3);
-          ms(cell,qp,2,2) = beta*(C23*e1 + C23*e2 + C33*e3);
-          ms(cell,qp,1,2) = beta*(C44*e4);
-          ms(cell,qp,0,2) = beta*(C44*e5);
-          ms(cell,qp,0,1) = beta*(C66*e6);
-          ms(cell,qp,1,0) = beta*(C44*e9);
-          ms(cell,qp,2,0) = beta*(C44*e8);
-          ms(cell,qp,2,1) = beta*(C66*e7);
-        }
-      }
-    }
-    // Compute Double Stress
-    for(int i=0; i<numMicroScales; i++){
-      auto &msg = microStrainGradient[i];
-      auto &ds = doubleStress[i];
-      ScalarT beta = lengthScale[i]*lengthScale[i]*betaParameter[i];
-      for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-        for (std::size_t qp=0; qp < num_pts_; ++qp) {
+
+        for(int i=0; i<numMicroScales; i++){
+          // Compute Micro Stress
+          auto &sd = strainDifference[i];
+          auto &ms = microStress[i];
+          const RealType beta = betaParameter[i];
+          {
+            auto e1 = sd(cell,qp,0,0);
+            auto e2 = sd(cell,qp,1,1);
+            auto e3 = sd(cell,qp,2,2);
+            auto e4 = sd(cell,qp,1,2);
+            auto e5 = sd(cell,qp,0,2);
+            auto e6 = sd(cell,qp,0,1);
+            auto e7 = sd(cell,qp,2,1);
+            auto e8 = sd(cell,qp,2,0);
+            auto e9 = sd(cell,qp,1,0);
+            ms(cell,qp,0,0) = beta*(C11*e1 + C12*e2 + C23*e3);
+            ms(cell,qp,1,1) = beta*(C12*e1 + C11*e2 + C23*e3);
+            ms(cell,qp,2,2) = beta*(C23*e1 + C23*e2 + C33*e3);
+            ms(cell,qp,1,2) = beta*(C44*e4);
+            ms(cell,qp,0,2) = beta*(C44*e5);
+            ms(cell,qp,0,1) = beta*(C66*e6);
+            ms(cell,qp,1,0) = beta*(C44*e9);
+            ms(cell,qp,2,0) = beta*(C44*e8);
+            ms(cell,qp,2,1) = beta*(C66*e7);
+          }
+
+          // Compute Double Stress
+          auto &msg = microStrainGradient[i];
+          auto &ds = doubleStress[i];
+          const RealType dbeta = lengthScale[i]*lengthScale[i]*beta;
           for (std::size_t k=0; k < num_dims_; ++k) {
             auto e1 = msg(cell,qp,0,0,k);
             auto e2 = msg(cell,qp,1,1,k);
@@ -227,15 +217,15 @@ computeState(typename Traits::EvalData workset,
             auto e7 = msg(cell,qp,2,1,k);
             auto e8 = msg(cell,qp,2,0,k);
             auto e9 = msg(cell,qp,1,0,k);
-            ds(cell,qp,0,0,k) = beta*(C11*e1 + C12*e2 + C23*e3);
-            ds(cell,qp,1,1,k) = beta*(C12*e1 + C11*e2 + C23*e3);
-            ds(cell,qp,2,2,k) = beta*(C23*e1 + C23*e2 + C33*e3);
-            ds(cell,qp,1,2,k) = beta*(C44*e4);
-            ds(cell,qp,0,2,k) = beta*(C44*e5);
-            ds(cell,qp,0,1,k) = beta*(C66*e6);
-            ds(cell,qp,1,0,k) = beta*(C44*e9);
-            ds(cell,qp,2,0,k) = beta*(C44*e8);
-            ds(cell,qp,2,1,k) = beta*(C66*e7);
+            ds(cell,qp,0,0,k) = dbeta*(C11*e1 + C12*e2 + C23*e3);
+            ds(cell,qp,1,1,k) = dbeta*(C12*e1 + C11*e2 + C23*e3);
+            ds(cell,qp,2,2,k) = dbeta*(C23*e1 + C23*e2 + C33*e3);
+            ds(cell,qp,1,2,k) = dbeta*(C44*e4);
+            ds(cell,qp,0,2,k) = dbeta*(C44*e5);
+            ds(cell,qp,0,1,k) = dbeta*(C66*e6);
+            ds(cell,qp,1,0,k) = dbeta*(C44*e9);
+            ds(cell,qp,2,0,k) = dbeta*(C44*e8);
+            ds(cell,qp,2,1,k) = dbeta*(C66*e7);
           }
         }
       }
@@ -37,6 +37,7 @@ namespace LCM {
     name_map->insert( std::make_pair("Mechanical_Source","Mechanical_Source") );
     name_map->insert( std::make_pair("F","F") );
     name_map->insert( std::make_pair("J","J") );
+    name_map->insert( std::make_pair("F_inv","F_inv") );
     name_map->insert( std::make_pair("Velocity_Gradient","Velocity_Gradient") );
     name_map->insert( std::make_pair("Velocity_Gradient_Plastic","Velocity_Gradient_Plastic") );
 
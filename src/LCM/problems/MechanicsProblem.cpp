@@ -30,6 +30,7 @@ MechanicsProblem::MechanicsProblem(
     have_pore_pressure_eq_(false),
     have_transport_eq_(false),
     have_hydrostress_eq_(false),
+    have_hydrostress_lumped_(false),
     have_damage_eq_(false),
     have_stab_pressure_eq_(false),
     have_peridynamics_(false),
@@ -134,6 +135,14 @@ MechanicsProblem::MechanicsProblem(
       have_hydrostress_,
       have_hydrostress_eq_);
 
+  // The lumped projection of the hydrostatic stress is local to each element
+  // and replaces its equation in the global system
+  if (have_hydrostress_eq_ &&
+      params->sublist("HydroStress").get<bool>("Lumped Projection", false)) {
+    have_hydrostress_eq_     = false;
+    have_hydrostress_lumped_ = true;
+  }
+
   getVariableType(
       params->sublist("Damage"),
       "None",
@@ -179,7 +188,8 @@ MechanicsProblem::MechanicsProblem(
        << "\tTransport variables           : "
        << variableTypeToString(transport_type_) << '\n'
        << "\tHydroStress variables         : "
-       << variableTypeToString(hydrostress_type_) << '\n'
+       << variableTypeToString(hydrostress_type_)
+       << (have_hydrostress_lumped_ ? " (lumped projection)" : "") << '\n'
        << "\tDamage variables              : "
        << variableTypeToString(damage_type_) << '\n'
        << "\tStabilized Pressure variables : "
@@ -277,6 +287,8 @@ MechanicsProblem::MechanicsProblem(
         "Constitutive Model NOX Status Test");
   } else {
     nox_status_test_ = Teuchos::rcp(new NOX::StatusTest::ModelEvaluatorFlag);
+    // The application posts the reduction of the flag after each evaluation
+    params->set("Constitutive Model NOX Status Test", nox_status_test_);
   }
 
   bool
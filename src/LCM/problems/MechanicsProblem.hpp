@@ -310,6 +310,11 @@ protected:
   bool
   have_hydrostress_eq_;
 
+  /// Hydrostatic stress projected element by element with a lumped mass,
+  /// in place of its equation
+  bool
+  have_hydrostress_lumped_;
+
   /// Damage
   bool
   have_damage_;
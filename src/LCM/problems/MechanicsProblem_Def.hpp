@@ -8,6 +8,7 @@
 #include "Albany_ProblemUtils.hpp"
 #include "Albany_ResponseUtilities.hpp"
 #include "Albany_Utils.hpp"
+#include "Teuchos_TwoDArray.hpp"
 
 #include "PHAL_NSMaterialProperty.hpp"
 #include "PHAL_SaveStateField.hpp"
@@ -62,6 +63,7 @@
 #include "HDiffusionDeformationMatterResidual.hpp"
 #include "LatticeDefGrad.hpp"
 #include "ScalarL2ProjectionResidual.hpp"
+#include "ScalarLumpedProjection.hpp"
 #include "SurfaceHDiffusionDefResidual.hpp"
 #include "SurfaceL2ProjectionResidual.hpp"
 #include "TransportCoefficients.hpp"
@@ -188,6 +190,56 @@ MechanicsProblem::constructEvaluators(
 
     param_list.set<Teuchos::RCP<NOX::StatusTest::ModelEvaluatorFlag>>(
         "NOX Status Test", statusTest);
+
+    // When several element blocks (e.g. one per grain) share these
+    // evaluators, pass the lattice orientation of each block, by
+    // Workset::EBIndex. Row b holds R^T of block b, row major.
+    if (!meshSpecs.sepEvalsByEB && meshSpecs.ebNameToIndex.size() > 1 &&
+        !param_list.isParameter("Read Lattice Orientation From Mesh")) {
+      int const
+      num_blocks = meshSpecs.ebNameToIndex.size();
+
+      Teuchos::TwoDArray<RealType>
+      orientations(num_blocks, num_dims_ * num_dims_);
+
+      auto const
+      set_orientation = [&](int const block, Teuchos::ParameterList & e_list) {
+        for (int i = 0; i < num_dims_; ++i) {
+          Teuchos::Array<RealType> const
+          basis = e_list.get<Teuchos::Array<RealType>>(
+              Albany::strint("Basis Vector", i + 1));
+
+          RealType
+          norm = 0.0;
+          for (int j = 0; j < num_dims_; ++j) norm += basis[j] * basis[j];
+          norm = std::sqrt(norm);
+
+          for (int j = 0; j < num_dims_; ++j) {
+            orientations(block, j * num_dims_ + i) = basis[j] / norm;
+          }
+        }
+      };
+
+      for (auto const & eb : meshSpecs.ebNameToIndex) {
+        std::string const
+        eb_mat = material_db_->getElementBlockParam<std::string>(
+            eb.first, "material", matName);
+
+        Teuchos::ParameterList &
+        eb_list = material_db_->getElementBlockSublist(eb.first, eb_mat);
+
+        // Blocks without their own basis use the one of this block
+        if (eb_list.isSublist("Crystal Elasticity") == true &&
+            eb_list.sublist("Crystal Elasticity").isParameter("Basis Vector 1")) {
+          set_orientation(eb.second, eb_list.sublist("Crystal Elasticity"));
+        } else {
+          set_orientation(eb.second, param_list.sublist("Crystal Elasticity"));
+        }
+      }
+
+      param_list.set<Teuchos::TwoDArray<RealType>>(
+          "Element Block Orientations", orientations);
+    }
   }
 
   // volume averaging flags
@@ -413,6 +465,9 @@ MechanicsProblem::constructEvaluators(
   std::string
   J = (*fnm)["J"];
 
+  std::string
+  defgrad_inv = (*fnm)["F_inv"];
+
   // Poromechanics variables
   std::string
   totStress = (*fnm)["Total_Stress"];
@@ -1632,6 +1687,11 @@ MechanicsProblem::constructEvaluators(
       p->set<Teuchos::RCP<PHX::DataLayout>>(
           "QP Scalar Data Layout", dl_->qp_scalar);
 
+      // F^{-1} is shared by the pore pressure residual
+      if (have_pore_pressure_eq_) {
+        p->set<std::string>("Inverse DefGrad Name", defgrad_inv);
+      }
+
       if (Teuchos::nonnull(rc_mgr_)) {
         rc_mgr_->registerField(
             defgrad, dl_->qp_tensor, AAdapt::rc::Init::identity,
@@ -2180,6 +2240,7 @@ MechanicsProblem::constructEvaluators(
     if (have_mech_eq_) {
       p->set<bool>("Have Mechanics", true);
       p->set<std::string>("DefGrad Name", defgrad);
+      p->set<std::string>("Inverse DefGrad Name", defgrad_inv);
       p->set<Teuchos::RCP<PHX::DataLayout>>(
           "QP Tensor Data Layout", dl_->qp_tensor);
       p->set<std::string>("DetDefGrad Name", J);
@@ -2852,6 +2913,55 @@ MechanicsProblem::constructEvaluators(
     fm0.template registerEvaluator<EvalT>(ev);
   }
 
+  if (have_hydrostress_lumped_) {
+    // Lumped hydrostatic stress projection, without an equation
+
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        surface_element,
+        std::logic_error,
+        "The lumped HydroStress projection is not available for surface "
+        "elements.\n");
+
+    fm0.template registerEvaluator<EvalT>(
+        evalUtils.constructMapToPhysicalFrameEvaluator(cellType, cubature));
+
+    fm0.template registerEvaluator<EvalT>(
+        evalUtils.constructComputeBasisFunctionsEvaluator(
+            cellType, intrepidBasis, cubature));
+
+    Teuchos::RCP<Teuchos::ParameterList>
+    p = Teuchos::rcp(new Teuchos::ParameterList("HydroStress Projection"));
+
+    // Input
+    p->set<std::string>("Weighted BF Name", "wBF");
+    p->set<std::string>("BF Name", "BF");
+    p->set<Teuchos::RCP<PHX::DataLayout>>(
+        "Node QP Scalar Data Layout", dl_->node_qp_scalar);
+
+    p->set<std::string>("Gradient BF Name", "Grad BF");
+    p->set<Teuchos::RCP<PHX::DataLayout>>(
+        "Node QP Vector Data Layout", dl_->node_qp_vector);
+
+    p->set<std::string>("Deformation Gradient Name", defgrad);
+    p->set<Teuchos::RCP<PHX::DataLayout>>(
+        "QP Tensor Data Layout", dl_->qp_tensor);
+
+    p->set<std::string>("Stress Name", cauchy);
+
+    // Output
+    p->set<std::string>("QP Variable Name", hydroStress);
+    p->set<Teuchos::RCP<PHX::DataLayout>>(
+        "QP Scalar Data Layout", dl_->qp_scalar);
+
+    p->set<std::string>("Gradient QP Variable Name", "HydroStress Gradient");
+    p->set<Teuchos::RCP<PHX::DataLayout>>(
+        "QP Vector Data Layout", dl_->qp_vector);
+
+    ev = Teuchos::rcp(
+        new LCM::ScalarLumpedProjection<EvalT, PHAL::AlbanyTraits>(*p));
+    fm0.template registerEvaluator<EvalT>(ev);
+  }
+
   if (have_hydrostress_eq_ && surface_element) {
     // Hydrostress Projection Resid for Surface
     Teuchos::RCP<Teuchos::ParameterList>
@@ -43,6 +43,13 @@ namespace Albany {
     //! Get boolean telling code if SDBCs are utilized
     virtual bool useSDBCs() const {return use_sdbcs_; }
 
+    //! Displacement and temperature blocks, in the order of their offsets
+    virtual std::vector<int> getUnknownBlocking() const {
+      std::vector<int> blocking(2, 1);
+      blocking[X_offset < T_offset ? 0 : 1] = numDim;
+      return blocking;
+    }
+
     //! Build the PDE instantiations, boundary conditions, and initial solution
     virtual void buildProblem(
       Teuchos::ArrayRCP<Teuchos::RCP<Albany::MeshSpecsStruct>>  meshSpecs,
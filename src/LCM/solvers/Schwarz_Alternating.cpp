@@ -50,6 +50,12 @@ SchwarzAlternating(
   increase_factor_ = alt_system_params.get<ST>("Increase Factor", 1.0);
   output_interval_ = alt_system_params.get<int>("Exodus Write Interval", 1);
 
+  std::string const
+  schwarz_method =
+      alt_system_params.get<std::string>("Schwarz Method", "Multiplicative");
+
+  is_additive_ = schwarz_method == "Additive";
+
   // Firewalls
   ALBANY_ASSERT(min_iters_ >= 1);
   ALBANY_ASSERT(max_iters_ >= 1);
@@ -66,6 +72,7 @@ SchwarzAlternating(
   ALBANY_ASSERT(reduction_factor_ > 0.0);
   ALBANY_ASSERT(increase_factor_ >= 1.0);
   ALBANY_ASSERT(output_interval_ >= 1);
+  ALBANY_ASSERT(schwarz_method == "Multiplicative" || is_additive_ == true);
 
   //number of models
   num_subdomains_ = model_filenames.size();
@@ -655,6 +662,55 @@ printInternalElementState(Albany::StateArrayVec& esa, const std::string statenam
   }
 }
 
+//
+//
+//
+void
+SchwarzAlternating::
+saveCoupledSolutions(std::vector<CoupledSolution> & solutions) const
+{
+  solutions.resize(num_subdomains_);
+  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    saveCoupledSolution(subdomain, solutions);
+  }
+}
+
+//
+//
+//
+void
+SchwarzAlternating::
+saveCoupledSolution(
+    int const subdomain,
+    std::vector<CoupledSolution> & solutions) const
+{
+  auto const &
+  app = *apps_[subdomain];
+
+  solutions[subdomain] = {{app.getX(), app.getXdot(), app.getXdotdot()}};
+}
+
+//
+//
+//
+void
+SchwarzAlternating::
+restoreCoupledSolutions(
+    std::vector<CoupledSolution> const & solutions,
+    int const except) const
+{
+  for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
+    if (subdomain == except) continue;
+
+    auto &
+    app = *apps_[subdomain];
+
+    app.setX(solutions[subdomain][0]);
+    app.setXdot(solutions[subdomain][1]);
+    app.setXdotdot(solutions[subdomain][2]);
+  }
+}
+
 //
 // Schwarz Alternating loop, dynamic
 //
@@ -733,6 +789,11 @@ SchwarzLoopDynamics() const
       bool const
       is_initial_state = stop == 0 && num_iter_ == 0;
 
+      if (is_additive_ == true) {
+        saveCoupledSolutions(start_solutions_);
+        end_solutions_ = start_solutions_;
+      }
+
       for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
 
         fos << delim << std::endl;
@@ -740,6 +801,10 @@ SchwarzLoopDynamics() const
         fos << "Subdomain          :" << subdomain << '\n';
         fos << delim << std::endl;
 
+        if (is_additive_ == true) {
+          restoreCoupledSolutions(start_solutions_, subdomain);
+        }
+
         //Restore solution from previous Schwarz iteration before solve
         if (is_initial_state == true) {
           auto &
@@ -1011,8 +1076,16 @@ SchwarzLoopDynamics() const
         norms_final(subdomain) += dt2 * Thyra::norm(*this_acce_[subdomain]);
         norms_diff(subdomain)  += dt2 * Thyra::norm(*acce_diff_rcp);
 
+        if (is_additive_ == true) {
+          saveCoupledSolution(subdomain, end_solutions_);
+        }
+
       } //Subdomains loop
 
+      if (is_additive_ == true) {
+        restoreCoupledSolutions(end_solutions_, -1);
+      }
+
       if (failed_ == true) {
         fos << "INFO: Unable to continue Schwarz iteration " << num_iter_;
         fos << "\n";
@@ -1334,6 +1407,11 @@ SchwarzLoopQuasistatics() const
       bool const
       is_initial_state = stop == 0 && num_iter_ == 0;
 
+      if (is_additive_ == true) {
+        saveCoupledSolutions(start_solutions_);
+        end_solutions_ = start_solutions_;
+      }
+
       // Subdomain loop
       for (auto subdomain = 0; subdomain < num_subdomains_; ++subdomain) {
 
@@ -1389,6 +1467,10 @@ SchwarzLoopQuasistatics() const
         // Target time
         me.setCurrentTime(next_time);
 
+        if (is_additive_ == true) {
+          restoreCoupledSolutions(start_solutions_, subdomain);
+        }
+
         // Solve for each subdomain
         auto &
         solver = *(solvers_[subdomain]);
@@ -1451,6 +1533,10 @@ SchwarzLoopQuasistatics() const
         norms_final(subdomain) = Thyra::norm(curr_disp);
         norms_diff(subdomain) = Thyra::norm(disp_diff);
 
+        if (is_additive_ == true) {
+          saveCoupledSolution(subdomain, end_solutions_);
+        }
+
 #if defined(DEBUG)
         fos << "\n*** NOX: Previous solution ***\n";
         prev_disp.describe(fos, Teuchos::VERB_EXTREME);
@@ -1469,6 +1555,10 @@ SchwarzLoopQuasistatics() const
 #endif //DEBUG
       } // Subdomain loop
 
+      if (is_additive_ == true) {
+        restoreCoupledSolutions(end_solutions_, -1);
+      }
+
       if (failed_ == true) {
         fos << "INFO: Unable to continue Schwarz iteration " << num_iter_;
         fos << "\n";
@@ -7,6 +7,7 @@
 #if !defined(LCM_SchwarzAlternating_hpp)
 #define LCM_SchwarzAlternating_hpp
 
+#include <array>
 #include <functional>
 
 #include "Albany_AbstractSTKMeshStruct.hpp"
@@ -139,6 +140,23 @@ private:
   void
   reportFinals(std::ostream & os) const;
 
+  /// Solutions of all the subdomains, as seen by the Schwarz BCs
+  using CoupledSolution = std::array<Teuchos::RCP<Tpetra_Vector const>, 3>;
+
+  void
+  saveCoupledSolutions(std::vector<CoupledSolution> & solutions) const;
+
+  void
+  saveCoupledSolution(
+      int const subdomain,
+      std::vector<CoupledSolution> & solutions) const;
+
+  /// Make the Schwarz BCs see solutions, except for subdomain except
+  void
+  restoreCoupledSolutions(
+      std::vector<CoupledSolution> const & solutions,
+      int const except) const;
+
   void printInternalElementStates(const int subdomain, Teuchos::RCP<Albany::StateInfoStruct> sis) const; 
 
   void 
@@ -277,6 +295,18 @@ private:
   mutable std::vector<bool> 
   do_outputs_init_; 
 
+  // Additive Schwarz: every subdomain solve of a Schwarz iteration sees the
+  // solutions of the others from the previous iteration, so the result does
+  // not depend on the subdomain order.
+  bool
+  is_additive_{false};
+
+  mutable std::vector<CoupledSolution>
+  start_solutions_;
+
+  mutable std::vector<CoupledSolution>
+  end_solutions_;
+
   // Used if solving with loca or tempus
   bool
   is_static_{false};
@@ -63,21 +63,16 @@ Teuchos::RCP<Tpetra_CrsMatrix>
 Schwarz_BoundaryJacobian::
 getExplicitOperator() const
 {
-  auto const
-  max_num_cols = getDomainMap()->getNodeNumElements();
-
-  Teuchos::RCP<Tpetra_CrsMatrix>
-  K = Teuchos::rcp(
-      new Tpetra_CrsMatrix(getRangeMap(), getDomainMap(), max_num_cols));
-
-  auto const
-  zero = Teuchos::ScalarTraits<ST>::zero();
-
-  K->setAllToScalar(zero);
+  // The coupling block is zero. Build its (empty) matrix once, without
+  // reserving room for entries, and hand out the same one afterwards.
+  if (explicit_operator_.is_null() == true) {
+    explicit_operator_ = Teuchos::rcp(
+        new Tpetra_CrsMatrix(getRangeMap(), getDomainMap(), 0));
 
-  K->fillComplete();
+    explicit_operator_->fillComplete(getDomainMap(), getRangeMap());
+  }
 
-  return K;
+  return explicit_operator_;
 }
 
 //
@@ -96,7 +91,12 @@ apply(
   auto const
   zero = Teuchos::ScalarTraits<ST>::zero();
 
-  Y.putScalar(zero);
+  // Y = alpha * 0 * X + beta * Y, with beta = 0 overwriting Y
+  if (beta == zero) {
+    Y.putScalar(zero);
+  } else {
+    Y.scale(beta);
+  }
 }
 
 } //namespace LCM
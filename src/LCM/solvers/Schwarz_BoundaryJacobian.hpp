@@ -154,6 +154,10 @@ private:
 
   int
   n_models_;
+
+  // Explicit (zero) operator, built on first use
+  mutable Teuchos::RCP<Tpetra_CrsMatrix>
+  explicit_operator_;
 };
 
 } //namespace LCM
@@ -1108,6 +1108,9 @@ evalModelImpl(
     //IKT, 11/16/16: it may be desirable to move the following code into a separate
     //function, especially as we implement more preconditioners.
     if (Teuchos::nonnull(W_prec_outT) == true) {
+      // One-entry rows of the diagonal preconditioners
+      Teuchos::Array<ST> matrixEntriesT(1);
+      Teuchos::Array<Tpetra_GO> matrixIndicesT(1);
       for (auto m = 0; m < num_models_; ++m) {
         if (!precs_[m]->isFillActive())
           precs_[m]->resumeFill();
@@ -1140,8 +1143,6 @@ evalModelImpl(
           //Create Jacobi preconditioner
           for (auto i = 0; i < jacs_[m]->getNodeNumRows(); ++i) {
             GO global_row = jacs_[m]->getRowMap()->getGlobalElement(i);
-            Teuchos::Array<ST> matrixEntriesT(1);
-            Teuchos::Array<Tpetra_GO> matrixIndicesT(1);
             matrixEntriesT[0] = invdiag_constView[i];
             matrixIndicesT[0] = global_row;
             precs_[m]->replaceGlobalValues(
@@ -1172,13 +1173,12 @@ evalModelImpl(
               ->get1dViewNonConst();
           //Compute abs sum of each row and store in absrowsum vector
           for (auto i = 0; i < jacs_[m]->getNodeNumRows(); ++i) {
-            std::size_t NumEntries = jacs_[m]->getNumEntriesInLocalRow(i);
-            Teuchos::Array<LO> Indices(NumEntries);
-            Teuchos::Array<ST> Values(NumEntries);
+            Teuchos::ArrayView<LO const> Indices;
+            Teuchos::ArrayView<ST const> Values;
             //Get local row
-            jacs_[m]->getLocalRowCopy(i, Indices(), Values(), NumEntries);
+            jacs_[m]->getLocalRowView(i, Indices, Values);
             //Compute abs row rum
-            for (auto j = 0; j < NumEntries; j++)
+            for (auto j = 0; j < Values.size(); j++)
               absrowsum_nonconstView[i] += std::abs(Values[j]);
           }
           //Invert absrowsum
@@ -1193,8 +1193,6 @@ evalModelImpl(
           //Create diagonal abs row sum preconditioner
           for (auto i = 0; i < jacs_[m]->getNodeNumRows(); ++i) {
             GO global_row = jacs_[m]->getRowMap()->getGlobalElement(i);
-            Teuchos::Array<ST> matrixEntriesT(1);
-            Teuchos::Array<Tpetra_GO> matrixIndicesT(1);
             matrixEntriesT[0] = invabsrowsum_constView[i];
             matrixIndicesT[0] = global_row;
             precs_[m]->replaceGlobalValues(
@@ -1207,8 +1205,6 @@ evalModelImpl(
           //Create Identity
           for (auto i = 0; i < jacs_[m]->getNodeNumRows(); ++i) {
             GO global_row = jacs_[m]->getRowMap()->getGlobalElement(i);
-            Teuchos::Array<ST> matrixEntriesT(1);
-            Teuchos::Array<Tpetra_GO> matrixIndicesT(1);
             matrixEntriesT[0] = 1.0;
             matrixIndicesT[0] = global_row;
             precs_[m]->replaceGlobalValues(
@@ -1220,15 +1216,8 @@ evalModelImpl(
         if (precs_[m]->isFillActive())
           precs_[m]->fillComplete();
       }
-      Schwarz_CoupledJacobian jac(comm_);
-      Teuchos::RCP<Thyra::LinearOpBase<ST>> W_op =
-          jac.getThyraCoupledJacobian(precs_, apps_);
-      Teuchos::RCP<Thyra::DefaultPreconditioner<ST>> W_prec = Teuchos::rcp(
-          new Thyra::DefaultPreconditioner<ST>);
-      W_prec->initializeRight(W_op);
-      W_prec_outT = Teuchos::rcp_dynamic_cast<Thyra::PreconditionerBase<ST>>(
-          W_prec,
-          true);
+      // W_prec_outT comes from create_W_prec, whose blocked operator wraps
+      // precs_ itself, so the updated blocks are already in place.
     }
   }
 
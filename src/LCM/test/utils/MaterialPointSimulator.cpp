@@ -371,6 +371,9 @@ main(int ac, char* av[])
     bcPL.set<Teuchos::ParameterList*>("Material Parameters", &paramList);
     bcPL.set<std::string>("Parametrization Type Name", parametrization_type);
     bcPL.set<double>("Parametrization Interval Name", parametrization_interval);
+    bcPL.set<bool>(
+        "Screen Elliptic Points",
+        mpsParams.get<bool>("Screen Elliptic Points", false));
     bcPL.set<std::string>("Material Tangent Name", "Material Tangent");
     bcPL.set<std::string>("Ellipticity Flag Name", "Ellipticity_Flag");
     bcPL.set<std::string>("Bifurcation Direction Name", "Direction");
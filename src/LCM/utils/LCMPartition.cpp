@@ -15,6 +15,8 @@
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/connected_components.hpp>
 
+#include <Kokkos_Core.hpp>
+
 #include "Albany_Utils.hpp"
 #include "LCMPartition.h"
 
@@ -2527,31 +2529,50 @@ ConnectivityArray::partitionKMeans(double const length_scale)
     std::vector<minitensor::Index>
     point_to_generator(number_points);
 
-    for (minitensor::Index i = 0; i < domain_points_.size(); ++i) {
-      point_to_generator[i] = closest_point(domain_points_[i], centers);
+    // The closest generator of each point is independent of the others,
+    // so share the points among the host threads when Kokkos is running.
+    if (Kokkos::is_initialized() == true) {
+      std::vector<minitensor::Vector<double>> const &
+      points = domain_points_;
+
+      Kokkos::parallel_for(
+          Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(
+              0, static_cast<int>(number_points)),
+          [&](int const i) {
+            point_to_generator[i] = closest_point(points[i], centers);
+          });
+    } else {
+      for (minitensor::Index i = 0; i < number_points; ++i) {
+        point_to_generator[i] = closest_point(domain_points_[i], centers);
+      }
     }
 
-    // Determine cluster of points for each generator
-    std::vector<std::vector<minitensor::Vector<double>>>
-    clusters;
+    // Accumulate the points of each generator instead of copying them
+    // into clusters.
+    std::vector<minitensor::Vector<double>>
+    cluster_sums(
+        number_partitions,
+        minitensor::Vector<double>(getDimension(), minitensor::Filler::ZEROS));
 
-    clusters.resize(number_partitions);
+    std::vector<minitensor::Index>
+    cluster_sizes(number_partitions, 0);
 
     for (minitensor::Index p = 0; p < point_to_generator.size(); ++p) {
 
       minitensor::Index const
       c = point_to_generator[p];
 
-      clusters[c].push_back(domain_points_[p]);
+      cluster_sums[c] += domain_points_[p];
+      ++cluster_sizes[c];
 
     }
 
     // Compute centroids of each cluster and set generators to
     // these centroids.
-    for (minitensor::Index i = 0; i < clusters.size(); ++i) {
+    for (minitensor::Index i = 0; i < number_partitions; ++i) {
 
       // If center is empty then generator does not move.
-      if (clusters[i].size() == 0) {
+      if (cluster_sizes[i] == 0) {
         steps[i] = 0.0;
         std::cout << "Iteration: " << number_iterations;
         std::cout << ", center " << i << " has zero points." << '\n';
@@ -2559,7 +2580,7 @@ ConnectivityArray::partitionKMeans(double const length_scale)
       }
 
       minitensor::Vector<double> const
-      cluster_centroid = centroid(clusters[i]);
+      cluster_centroid = cluster_sums[i] / double(cluster_sizes[i]);
 
       // Update the generator
       minitensor::Vector<double> const
@@ -10,6 +10,9 @@
 #include "PHAL_AlbanyTraits.hpp"
 #include <Teuchos_LAPACK.hpp>
 #include <Sacado.hpp>
+#include <cmath>
+#include <utility>
+#include <vector>
 
 namespace LCM
 {
@@ -34,6 +37,20 @@ public:
   void computeFadInfo(std::vector<ScalarT> & A,
       std::vector<ScalarT> & X,
       std::vector<ScalarT> & B);
+protected:
+  // Solve A X = B in place, A column-major n x n and B n x nrhs. The small
+  // systems of the return mappings are factored inline with partial
+  // pivoting, which avoids the LAPACK call overhead; larger ones go to GESV.
+  // As with GESV, A is overwritten and B is left unchanged if A is singular.
+  void denseSolve(int n, int nrhs, RealType * A, RealType * B);
+
+  // Work arrays of the LAPACK calls, kept between the Newton iterations so
+  // that a solver reused at a point only allocates them once
+  std::vector<int> ipiv_;
+  std::vector<RealType> f_;
+  std::vector<RealType> dfdx_;
+  std::vector<RealType> dbdp_;
+  std::vector<RealType> dbdx_;
 };
 
 // -----------------------------------------------------------------------------
@@ -13,6 +13,73 @@ LocalNonlinearSolver_Base<EvalT, Traits>::LocalNonlinearSolver_Base() :
 {
 }
 
+template<typename EvalT, typename Traits>
+inline
+void
+LocalNonlinearSolver_Base<EvalT, Traits>::denseSolve(
+    int n, int nrhs, RealType * A, RealType * B)
+{
+  // scalar equations, as in J2 and creep
+  if (n == 1) {
+    if (A[0] == 0.0) return;
+    for (int j(0); j < nrhs; ++j)
+      B[j] /= A[0];
+    return;
+  }
+
+  int const max_inline_size = 16;
+  if (n > max_inline_size) {
+    int info(0);
+    ipiv_.resize(n);
+    lapack.GESV(n, nrhs, A, n, &ipiv_[0], B, n, &info);
+    return;
+  }
+
+  int piv[max_inline_size];
+
+  // LU factorization with partial pivoting
+  for (int k(0); k < n; ++k) {
+    int p = k;
+    RealType pmax = std::abs(A[k + n * k]);
+    for (int i(k + 1); i < n; ++i) {
+      RealType const a = std::abs(A[i + n * k]);
+      if (a > pmax) {
+        pmax = a;
+        p = i;
+      }
+    }
+    if (pmax == 0.0) return;
+    piv[k] = p;
+    if (p != k) {
+      for (int j(0); j < n; ++j)
+        std::swap(A[k + n * j], A[p + n * j]);
+    }
+    RealType const inv_pivot = 1.0 / A[k + n * k];
+    for (int i(k + 1); i < n; ++i)
+      A[i + n * k] *= inv_pivot;
+    for (int j(k + 1); j < n; ++j) {
+      RealType const akj = A[k + n * j];
+      for (int i(k + 1); i < n; ++i)
+        A[i + n * j] -= A[i + n * k] * akj;
+    }
+  }
+
+  // forward and back substitution for each right hand side
+  for (int r(0); r < nrhs; ++r) {
+    RealType * b = B + n * r;
+    for (int k(0); k < n; ++k)
+      if (piv[k] != k) std::swap(b[k], b[piv[k]]);
+    for (int k(0); k < n; ++k)
+      for (int i(k + 1); i < n; ++i)
+        b[i] -= A[i + n * k] * b[k];
+    for (int k(n - 1); k >= 0; --k) {
+      b[k] /= A[k + n * k];
+      for (int i(0); i < k; ++i)
+        b[i] -= A[i + n * k] * b[k];
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 // Specializations
 // -----------------------------------------------------------------------------
@@ -38,13 +105,8 @@ solve(
   // system size
   int numLocalVars = B.size();
 
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
-
-  // call LAPACK
-  this->lapack.GESV(numLocalVars, 1, &A[0], numLocalVars, &IPIV[0], &B[0],
-      numLocalVars, &info);
+  // solve in place
+  this->denseSolve(numLocalVars, 1, &A[0], &B[0]);
 
   // increment the solution
   for (int i(0); i < numLocalVars; ++i)
@@ -82,13 +144,11 @@ solve(
   // system size
   int numLocalVars = B.size();
 
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
-
   // fill B and dBdX
-  std::vector<RealType> F(numLocalVars);
-  std::vector<RealType> dFdX(numLocalVars * numLocalVars);
+  std::vector<RealType> & F = this->f_;
+  F.resize(numLocalVars);
+  std::vector<RealType> & dFdX = this->dfdx_;
+  dFdX.resize(numLocalVars * numLocalVars);
   for (int i(0); i < numLocalVars; ++i)
       {
     F[i] = B[i].val();
@@ -98,9 +158,8 @@ solve(
     }
   }
 
-  // call LAPACK
-  this->lapack.GESV(numLocalVars, 1, &dFdX[0], numLocalVars, &IPIV[0], &F[0],
-      numLocalVars, &info);
+  // solve in place
+  this->denseSolve(numLocalVars, 1, &dFdX[0], &F[0]);
 
   // increment the solution
   for (int i(0); i < numLocalVars; ++i)
@@ -122,12 +181,9 @@ computeFadInfo(
   TEUCHOS_TEST_FOR_EXCEPTION(numGlobalVars == 0, std::logic_error,
       "In LocalNonlinearSolver<Jacobian> the numGLobalVars is zero where it should be positive\n");
 
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
-
   // extract sensitivities of objective function(s) wrt p
-  std::vector<RealType> dBdP(numLocalVars * numGlobalVars);
+  std::vector<RealType> & dBdP = this->dbdp_;
+  dBdP.resize(numLocalVars * numGlobalVars);
   for (int i(0); i < numLocalVars; ++i) {
     for (int j(0); j < numGlobalVars; ++j) {
       dBdP[i + numLocalVars * j] = B[i].dx(j);
@@ -135,17 +191,17 @@ computeFadInfo(
   }
 
   // extract the jacobian
-  std::vector<RealType> dBdX(A.size());
+  std::vector<RealType> & dBdX = this->dbdx_;
+  dBdX.resize(A.size());
   for (int i(0); i < numLocalVars; ++i) {
     for (int j(0); j < numLocalVars; ++j) {
       dBdX[i + numLocalVars * j] = A[i + numLocalVars * j].val();
     }
   }
-  // call LAPACK to simultaneously solve for all dXdP
-  this->lapack.GESV(numLocalVars, numGlobalVars, &dBdX[0], numLocalVars,
-      &IPIV[0], &dBdP[0], numLocalVars, &info);
+  // factor once and solve for all dXdP simultaneously
+  this->denseSolve(numLocalVars, numGlobalVars, &dBdX[0], &dBdP[0]);
 
-  // unpack into globalX (recall that LAPACK stores dXdP in dBdP)
+  // unpack into globalX (recall that the solve stores dXdP in dBdP)
   for (int i(0); i < numLocalVars; ++i)
       {
     X[i].resize(numGlobalVars);
@@ -176,13 +232,11 @@ solve(
   // system size
   int numLocalVars = B.size();
 
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
-
   // fill B and dBdX
-  std::vector<RealType> F(numLocalVars);
-  std::vector<RealType> dFdX(numLocalVars * numLocalVars);
+  std::vector<RealType> & F = this->f_;
+  F.resize(numLocalVars);
+  std::vector<RealType> & dFdX = this->dfdx_;
+  dFdX.resize(numLocalVars * numLocalVars);
   for (int i(0); i < numLocalVars; ++i)
       {
     F[i] = B[i].val();
@@ -192,9 +246,8 @@ solve(
     }
   }
 
-  // call LAPACK
-  this->lapack.GESV(numLocalVars, 1, &dFdX[0], numLocalVars, &IPIV[0], &F[0],
-      numLocalVars, &info);
+  // solve in place
+  this->denseSolve(numLocalVars, 1, &dFdX[0], &F[0]);
 
   // increment the solution
   for (int i(0); i < numLocalVars; ++i)
@@ -215,12 +268,9 @@ computeFadInfo(
   TEUCHOS_TEST_FOR_EXCEPTION(numGlobalVars == 0, std::logic_error,
       "In LocalNonlinearSolver<Tangent, Traits> the numGLobalVars is zero where it should be positive\n");
 
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
-
   // extract sensitivites of objective function(s) wrt p
-  std::vector<RealType> dBdP(numLocalVars * numGlobalVars);
+  std::vector<RealType> & dBdP = this->dbdp_;
+  dBdP.resize(numLocalVars * numGlobalVars);
   for (int i(0); i < numLocalVars; ++i) {
     for (int j(0); j < numGlobalVars; ++j) {
       dBdP[i + numLocalVars * j] = B[i].dx(j);
@@ -228,18 +278,18 @@ computeFadInfo(
   }
 
   // extract the jacobian
-  std::vector<RealType> dBdX(A.size());
+  std::vector<RealType> & dBdX = this->dbdx_;
+  dBdX.resize(A.size());
   for (int i(0); i < numLocalVars; ++i) {
     for (int j(0); j < numLocalVars; ++j) {
       dBdX[i + numLocalVars * j] = A[i + numLocalVars * j].val();
     }
   }
 
-  // call LAPACK to simultaneously solve for all dXdP
-  this->lapack.GESV(numLocalVars, numGlobalVars, &dBdX[0], numLocalVars,
-      &IPIV[0], &dBdP[0], numLocalVars, &info);
+  // factor once and solve for all dXdP simultaneously
+  this->denseSolve(numLocalVars, numGlobalVars, &dBdX[0], &dBdP[0]);
 
-  // unpack into globalX (recall that LAPACK stores dXdP in dBdP)
+  // unpack into globalX (recall that the solve stores dXdP in dBdP)
   for (int i(0); i < numLocalVars; ++i)
       {
     X[i].resize(numGlobalVars);
@@ -270,13 +320,11 @@ solve(
   // system size
   int numLocalVars = B.size();
 
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
-
   // fill B and dBdX
-  std::vector<RealType> F(numLocalVars);
-  std::vector<RealType> dFdX(numLocalVars * numLocalVars);
+  std::vector<RealType> & F = this->f_;
+  F.resize(numLocalVars);
+  std::vector<RealType> & dFdX = this->dfdx_;
+  dFdX.resize(numLocalVars * numLocalVars);
   for (int i(0); i < numLocalVars; ++i)
       {
     F[i] = B[i].val();
@@ -286,9 +334,8 @@ solve(
     }
   }
 
-  // call LAPACK
-  this->lapack.GESV(numLocalVars, 1, &dFdX[0], numLocalVars, &IPIV[0], &F[0],
-      numLocalVars, &info);
+  // solve in place
+  this->denseSolve(numLocalVars, 1, &dFdX[0], &F[0]);
 
   // increment the solution
   for (int i(0); i < numLocalVars; ++i)
@@ -309,12 +356,9 @@ computeFadInfo(
   TEUCHOS_TEST_FOR_EXCEPTION(numGlobalVars == 0, std::logic_error,
       "In LocalNonlinearSolver<Tangent, Traits> the numGLobalVars is zero where it should be positive\n");
 
-  // data for the LAPACK call below
-  int info(0);
-  std::vector<int> IPIV(numLocalVars);
-
   // extract sensitivites of objective function(s) wrt p
-  std::vector<RealType> dBdP(numLocalVars * numGlobalVars);
+  std::vector<RealType> & dBdP = this->dbdp_;
+  dBdP.resize(numLocalVars * numGlobalVars);
   for (int i(0); i < numLocalVars; ++i) {
     for (int j(0); j < numGlobalVars; ++j) {
       dBdP[i + numLocalVars * j] = B[i].dx(j);
@@ -322,18 +366,18 @@ computeFadInfo(
   }
 
   // extract the jacobian
-  std::vector<RealType> dBdX(A.size());
+  std::vector<RealType> & dBdX = this->dbdx_;
+  dBdX.resize(A.size());
   for (int i(0); i < numLocalVars; ++i) {
     for (int j(0); j < numLocalVars; ++j) {
       dBdX[i + numLocalVars * j] = A[i + numLocalVars * j].val();
     }
   }
 
-  // call LAPACK to simultaneously solve for all dXdP
-  this->lapack.GESV(numLocalVars, numGlobalVars, &dBdX[0], numLocalVars,
-      &IPIV[0], &dBdP[0], numLocalVars, &info);
+  // factor once and solve for all dXdP simultaneously
+  this->denseSolve(numLocalVars, numGlobalVars, &dBdX[0], &dBdP[0]);
 
-  // unpack into globalX (recall that LAPACK stores dXdP in dBdP)
+  // unpack into globalX (recall that the solve stores dXdP in dBdP)
   for (int i(0); i < numLocalVars; ++i)
       {
     X[i].resize(numGlobalVars);
@@ -0,0 +1,393 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "MaterialPointDriver.hpp"
+
+#include <algorithm>
+
+#include <stk_mesh/base/CoordinateSystems.hpp>
+
+#include "ConstitutiveModelInterface.hpp"
+#include "ConstitutiveModelParameters.hpp"
+#include "FieldNameMap.hpp"
+#include "PHAL_SaveStateField.hpp"
+#include "SetField.hpp"
+#include "Teuchos_TestForException.hpp"
+
+namespace LCM {
+
+namespace {
+
+// Registers a SetField evaluator that copies values into the field name
+template<typename ScalarT>
+void
+registerSetField(
+    PHX::FieldManager<PHAL::AlbanyTraits> & fm,
+    std::string const & name,
+    Teuchos::RCP<PHX::DataLayout> const & layout,
+    Teuchos::ArrayRCP<ScalarT> const & values)
+{
+  using Residual = PHAL::AlbanyTraits::Residual;
+
+  Teuchos::ParameterList
+  p("SetField" + name);
+
+  p.set<std::string>("Evaluated Field Name", name);
+  p.set<Teuchos::RCP<PHX::DataLayout>>("Evaluated Field Data Layout", layout);
+  p.set<Teuchos::ArrayRCP<ScalarT>>("Field Values", values);
+
+  fm.registerEvaluator<Residual>(
+      Teuchos::rcp(new SetField<Residual, PHAL::AlbanyTraits>(p)));
+}
+
+} // anonymous namespace
+
+//
+//
+//
+MaterialPointDriver::MaterialPointDriver(
+    Teuchos::ParameterList const & material_params,
+    int const num_points,
+    bool const have_temperature) :
+    num_points_(num_points),
+    have_temperature_(have_temperature),
+    material_params_(material_params)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      num_points_ < 1, std::logic_error,
+      "MaterialPointDriver needs at least one material point.\n");
+
+  int const
+  num_dims = 3;
+
+  int const
+  num_vertices = 8;
+
+  int const
+  num_nodes = 8;
+
+  // Each point is a cell with a single integration point
+  dl_ = Teuchos::rcp(
+      new Albany::Layouts(num_points_, num_vertices, num_nodes, 1, num_dims));
+
+  LCM::FieldNameMap
+  field_name_map(false);
+
+  material_params_.set<Teuchos::RCP<std::map<std::string, std::string>>>(
+      "Name Map", field_name_map.getMap());
+  material_params_.set<bool>("Compute Tangent", false);
+  if (have_temperature_ == true) {
+    material_params_.set<bool>("Have Temperature", true);
+  }
+
+  // Kinematics, all points start undeformed
+  def_grad_ = Teuchos::ArrayRCP<ScalarT>(9 * num_points_, 0.0);
+  det_def_grad_ = Teuchos::ArrayRCP<ScalarT>(num_points_, 1.0);
+  strain_ = Teuchos::ArrayRCP<ScalarT>(9 * num_points_, 0.0);
+  delta_time_ = Teuchos::ArrayRCP<ScalarT>(1, 1.0);
+
+  for (int pt = 0; pt < num_points_; ++pt) {
+    def_grad_[9 * pt + 0] = 1.0;
+    def_grad_[9 * pt + 4] = 1.0;
+    def_grad_[9 * pt + 8] = 1.0;
+  }
+
+  registerSetField(field_manager_, "F", dl_->qp_tensor, def_grad_);
+  registerSetField(field_manager_, "J", dl_->qp_scalar, det_def_grad_);
+  registerSetField(field_manager_, "Strain", dl_->qp_tensor, strain_);
+  registerSetField(
+      field_manager_, "Delta Time", dl_->workset_scalar, delta_time_);
+
+  if (have_temperature_ == true) {
+    temperature_ = Teuchos::ArrayRCP<ScalarT>(num_points_, 0.0);
+    registerSetField(
+        field_manager_, "Temperature", dl_->qp_scalar, temperature_);
+  }
+
+  // Material parameters and model
+  Teuchos::ParameterList
+  cmp_params;
+
+  cmp_params.set<Teuchos::ParameterList *>(
+      "Material Parameters", &material_params_);
+
+  Teuchos::ParameterList
+  cmi_params;
+
+  cmi_params.set<Teuchos::ParameterList *>(
+      "Material Parameters", &material_params_);
+
+  if (have_temperature_ == true) {
+    cmp_params.set<std::string>("Temperature Name", "Temperature");
+    cmi_params.set<std::string>("Temperature Name", "Temperature");
+  }
+
+  field_manager_.registerEvaluator<Residual>(Teuchos::rcp(
+      new ConstitutiveModelParameters<Residual, Traits>(cmp_params, dl_)));
+
+  Teuchos::RCP<ConstitutiveModelInterface<Residual, Traits>>
+  cmi = Teuchos::rcp(
+      new ConstitutiveModelInterface<Residual, Traits>(cmi_params, dl_));
+
+  field_manager_.registerEvaluator<Residual>(cmi);
+
+  for (auto it = cmi->evaluatedFields().begin();
+       it != cmi->evaluatedFields().end(); ++it) {
+    field_manager_.requireField<Residual>(**it);
+  }
+
+  // State variables are saved straight into the state array of the
+  // driver, with the same evaluator the problems use
+  Teuchos::RCP<PHX::DataLayout>
+  dummy = Teuchos::rcp(new PHX::MDALayout<Dummy>(0));
+
+  for (int sv = 0; sv < cmi->getNumStateVars(); ++sv) {
+    cmi->fillStateVariableStruct(sv);
+
+    StateInit
+    init;
+
+    init.name = cmi->getName();
+    init.init_type = cmi->getInitType();
+    init.init_value = cmi->getInitValue();
+    init.save_old = cmi->getStateFlag();
+
+    Teuchos::RCP<PHX::DataLayout>
+    layout = cmi->getLayout();
+
+    std::vector<PHX::DataLayout::size_type>
+    dims;
+
+    layout->dimensions(dims);
+
+    allocateState(init.name, dims);
+    if (init.save_old == true) {
+      allocateState(init.name + "_old", dims);
+    }
+
+    Teuchos::ParameterList
+    p("Save " + init.name);
+
+    p.set<std::string>("State Name", init.name);
+    p.set<std::string>("Field Name", init.name);
+    p.set<Teuchos::RCP<PHX::DataLayout>>("State Field Layout", layout);
+
+    field_manager_.registerEvaluator<Residual>(Teuchos::rcp(
+        new PHAL::SaveStateField<Residual, Traits>(p)));
+
+    PHX::Tag<ScalarT>
+    save_tag(init.name, dummy);
+
+    field_manager_.requireField<Residual>(save_tag);
+
+    state_init_.push_back(init);
+    state_names_.push_back(init.name);
+  }
+
+  field_manager_.postRegistrationSetup("");
+
+  workset_.numCells = num_points_;
+  workset_.wsIndex = 0;
+  workset_.stateArrayPtr = &state_array_;
+
+  reset();
+}
+
+//
+//
+//
+void
+MaterialPointDriver::allocateState(
+    std::string const & name,
+    std::vector<PHX::DataLayout::size_type> const & dims)
+{
+  typedef stk::mesh::Cartesian Tag;
+
+  std::size_t
+  size = 1;
+
+  for (std::size_t i = 0; i < dims.size(); ++i) {
+    size *= dims[i];
+  }
+
+  std::vector<double> &
+  data = state_data_[name];
+
+  data.resize(size, 0.0);
+
+  Albany::MDArray &
+  array = state_array_[name];
+
+  switch (dims.size()) {
+
+  default:
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        true, std::logic_error,
+        "MaterialPointDriver: unsupported rank " << dims.size()
+        << " of state " << name << ".\n");
+    break;
+
+  case 1:
+    array.assign<Tag>(data.data(), dims[0]);
+    break;
+
+  case 2:
+    array.assign<Tag, Tag>(data.data(), dims[0], dims[1]);
+    break;
+
+  case 3:
+    array.assign<Tag, Tag, Tag>(data.data(), dims[0], dims[1], dims[2]);
+    break;
+
+  case 4:
+    array.assign<Tag, Tag, Tag, Tag>(
+        data.data(), dims[0], dims[1], dims[2], dims[3]);
+    break;
+
+  case 5:
+    array.assign<Tag, Tag, Tag, Tag, Tag>(
+        data.data(), dims[0], dims[1], dims[2], dims[3], dims[4]);
+    break;
+  }
+}
+
+//
+//
+//
+void
+MaterialPointDriver::setDefGrad(double const * const def_grad)
+{
+  for (int pt = 0; pt < num_points_; ++pt) {
+
+    double const * const
+    F = def_grad + 9 * pt;
+
+    std::copy(F, F + 9, &def_grad_[9 * pt]);
+
+    det_def_grad_[pt] =
+        F[0] * (F[4] * F[8] - F[5] * F[7]) -
+        F[1] * (F[3] * F[8] - F[5] * F[6]) +
+        F[2] * (F[3] * F[7] - F[4] * F[6]);
+
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        strain_[9 * pt + 3 * i + j] =
+            0.5 * (F[3 * i + j] + F[3 * j + i]) - (i == j ? 1.0 : 0.0);
+      }
+    }
+  }
+}
+
+//
+//
+//
+void
+MaterialPointDriver::setTemperature(double const * const temperature)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      have_temperature_ == false, std::logic_error,
+      "MaterialPointDriver was built without temperature.\n");
+
+  std::copy(temperature, temperature + num_points_, &temperature_[0]);
+}
+
+//
+//
+//
+void
+MaterialPointDriver::setTimeStep(double const delta_time)
+{
+  delta_time_[0] = delta_time;
+}
+
+//
+//
+//
+void
+MaterialPointDriver::step()
+{
+  field_manager_.preEvaluate<Residual>(workset_);
+  field_manager_.evaluateFields<Residual>(workset_);
+  field_manager_.postEvaluate<Residual>(workset_);
+
+  for (std::size_t i = 0; i < state_init_.size(); ++i) {
+    StateInit const &
+    init = state_init_[i];
+
+    if (init.save_old == false) continue;
+
+    std::vector<double> const &
+    data = state_data_[init.name];
+
+    std::copy(data.begin(), data.end(), state_data_[init.name + "_old"].begin());
+  }
+}
+
+//
+//
+//
+void
+MaterialPointDriver::reset()
+{
+  for (std::size_t i = 0; i < state_init_.size(); ++i) {
+
+    StateInit const &
+    init = state_init_[i];
+
+    for (int old = 0; old < (init.save_old == true ? 2 : 1); ++old) {
+
+      std::string const
+      name = old == 1 ? init.name + "_old" : init.name;
+
+      Albany::MDArray &
+      array = state_array_[name];
+
+      std::vector<double> &
+      data = state_data_[name];
+
+      if (init.init_type == "identity") {
+        std::vector<PHX::DataLayout::size_type>
+        dims;
+
+        array.dimensions(dims);
+
+        TEUCHOS_TEST_FOR_EXCEPTION(
+            dims.size() != 4 || dims[2] != dims[3], std::logic_error,
+            "MaterialPointDriver: state " << name
+            << " is not a tensor and cannot be the identity.\n");
+
+        std::fill(data.begin(), data.end(), 0.0);
+        for (std::size_t cell = 0; cell < dims[0]; ++cell) {
+          for (std::size_t qp = 0; qp < dims[1]; ++qp) {
+            for (std::size_t d = 0; d < dims[2]; ++d) {
+              array(cell, qp, d, d) = 1.0;
+            }
+          }
+        }
+      } else {
+        std::fill(data.begin(), data.end(), init.init_value);
+      }
+    }
+  }
+}
+
+//
+//
+//
+Albany::MDArray const &
+MaterialPointDriver::getState(std::string const & name) const
+{
+  Albany::StateArray::const_iterator
+  it = state_array_.find(name);
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      it == state_array_.end(), std::logic_error,
+      "MaterialPointDriver: no state " << name << ".\n");
+
+  return it->second;
+}
+
+} // namespace LCM
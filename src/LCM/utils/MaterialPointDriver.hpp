@@ -0,0 +1,178 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#if !defined(LCM_MaterialPointDriver_hpp)
+#define LCM_MaterialPointDriver_hpp
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Albany_Layouts.hpp"
+#include "Albany_StateInfoStruct.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_Workset.hpp"
+#include "Phalanx_FieldManager.hpp"
+#include "Teuchos_ArrayRCP.hpp"
+#include "Teuchos_ParameterList.hpp"
+
+namespace LCM {
+
+///
+/// Drives a constitutive model at a batch of material points.
+///
+/// The model is evaluated through ConstitutiveModelInterface on one
+/// workset that holds all the points, one cell with one integration
+/// point each. The state variables live in an Albany::StateArray owned
+/// by the driver, so neither a mesh nor a discretization, a state
+/// manager or a global solver is needed. Meant for calibration loops
+/// that push many deformation paths through a model.
+///
+class MaterialPointDriver
+{
+public:
+
+  using Residual = PHAL::AlbanyTraits::Residual;
+  using Traits = PHAL::AlbanyTraits;
+  using ScalarT = Residual::ScalarT;
+
+  ///
+  /// \param material_params The material sublist, with the "Material
+  /// Model" and its parameters, as in the material database
+  /// \param num_points Number of material points driven at once
+  /// \param have_temperature Whether the model is given a temperature
+  ///
+  MaterialPointDriver(
+      Teuchos::ParameterList const & material_params,
+      int const num_points,
+      bool const have_temperature = false);
+
+  int
+  getNumPoints() const
+  {
+    return num_points_;
+  }
+
+  ///
+  /// Deformation gradients of all the points, 9 components each in
+  /// row-major order. J and the small strain follow from them.
+  ///
+  void
+  setDefGrad(double const * const def_grad);
+
+  ///
+  /// Temperatures of all the points
+  ///
+  void
+  setTemperature(double const * const temperature);
+
+  void
+  setTimeStep(double const delta_time);
+
+  ///
+  /// Evaluates the model at the current deformation gradients. The new
+  /// state becomes the old state of the next step.
+  ///
+  void
+  step();
+
+  ///
+  /// Returns all the state variables to their initial values, to start
+  /// a new deformation path
+  ///
+  void
+  reset();
+
+  ///
+  /// State variable of all the points after the last step, indexed by
+  /// point, integration point (always 0) and components
+  ///
+  Albany::MDArray const &
+  getState(std::string const & name) const;
+
+  std::vector<std::string> const &
+  getStateNames() const
+  {
+    return state_names_;
+  }
+
+private:
+
+  MaterialPointDriver(MaterialPointDriver const &);
+  MaterialPointDriver & operator=(MaterialPointDriver const &);
+
+  void
+  allocateState(
+      std::string const & name,
+      std::vector<PHX::DataLayout::size_type> const & dims);
+
+  struct StateInit
+  {
+    std::string
+    name;
+
+    std::string
+    init_type;
+
+    double
+    init_value;
+
+    bool
+    save_old;
+  };
+
+  int
+  num_points_;
+
+  bool
+  have_temperature_;
+
+  Teuchos::ParameterList
+  material_params_;
+
+  Teuchos::RCP<Albany::Layouts>
+  dl_;
+
+  PHX::FieldManager<Traits>
+  field_manager_;
+
+  Teuchos::ArrayRCP<ScalarT>
+  def_grad_;
+
+  Teuchos::ArrayRCP<ScalarT>
+  det_def_grad_;
+
+  Teuchos::ArrayRCP<ScalarT>
+  strain_;
+
+  Teuchos::ArrayRCP<ScalarT>
+  temperature_;
+
+  Teuchos::ArrayRCP<ScalarT>
+  delta_time_;
+
+  std::vector<StateInit>
+  state_init_;
+
+  std::vector<std::string>
+  state_names_;
+
+  ///
+  /// Storage behind the state arrays, new and old states
+  ///
+  std::map<std::string, std::vector<double>>
+  state_data_;
+
+  Albany::StateArray
+  state_array_;
+
+  PHAL::Workset
+  workset_;
+};
+
+} // namespace LCM
+
+#endif // LCM_MaterialPointDriver_hpp
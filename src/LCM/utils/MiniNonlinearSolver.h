@@ -7,7 +7,10 @@
 #if !defined(LCM_MiniNonlinearSolver_h)
 #define LCM_MiniNonlinearSolver_h
 
+#include <algorithm>
+#include <cmath>
 #include <type_traits>
+#include <vector>
 
 #include "MiniTensor_Solvers.h"
 #include "PHAL_AlbanyTraits.hpp"
@@ -290,6 +293,9 @@ struct MiniSolverEqIneqROL<MIN, FN, EIC, PHAL::AlbanyTraits::DistParamDeriv, N,
 /// Call this when a converged solution is obtained on a system that is
 /// typed on a FAD type.
 /// Assuming that T is a FAD type and S is a simple type.
+/// By the implicit function theorem DxDp = -inv(DrDx) DrDp, where DrDp
+/// are the derivatives of r evaluated with x held constant. DrDx is
+/// factored once for all the columns of DrDp.
 ///
 template<typename T, typename S, minitensor::Index N>
 void
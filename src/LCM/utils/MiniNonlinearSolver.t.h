@@ -63,16 +63,17 @@ MiniSolver(
   auto const
   dimension = soln.get_dimension();
 
-  // Put values back in solution vector
+  // Put values back in solution vector. Its derivatives are dropped so
+  // that the gradient below only carries the partials wrt p.
   for (auto i = 0; i < dimension; ++i) {
-    soln(i).val() = soln_val(i);
+    soln(i) = soln_val(i);
   }
 
   // Get the Hessian evaluated at the solution.
   minitensor::Tensor<ValueT, N>
   DrDx = function.hessian(soln_val);
 
-  // Now compute gradient with solution that has Albany sensitivities.
+  // Gradient at the converged solution, with only its partials wrt p.
   minitensor::Vector<T, N>
   resi = function.gradient(soln);
 
@@ -110,16 +111,17 @@ MiniSolver(
   auto const
   dimension = soln.get_dimension();
 
-  // Put values back in solution vector
+  // Put values back in solution vector. Its derivatives are dropped so
+  // that the gradient below only carries the partials wrt p.
   for (auto i = 0; i < dimension; ++i) {
-    soln(i).val() = soln_val(i);
+    soln(i) = soln_val(i);
   }
 
   // Get the Hessian evaluated at the solution.
   minitensor::Tensor<ValueT, N>
   DrDx = function.hessian(soln_val);
 
-  // Now compute gradient with solution that has Albany sensitivities.
+  // Gradient at the converged solution, with only its partials wrt p.
   minitensor::Vector<T, N>
   resi = function.gradient(soln);
 
@@ -198,16 +200,17 @@ MiniSolverROL(
   auto const
   dimension = soln.get_dimension();
 
-  // Put values back in solution vector
+  // Put values back in solution vector. Its derivatives are dropped so
+  // that the gradient below only carries the partials wrt p.
   for (auto i = 0; i < dimension; ++i) {
-    soln(i).val() = soln_val(i);
+    soln(i) = soln_val(i);
   }
 
   // Get the Hessian evaluated at the solution.
   minitensor::Tensor<ValueT, N>
   DrDx = function.hessian(soln_val);
 
-  // Now compute gradient with solution that has Albany sensitivities.
+  // Gradient at the converged solution, with only its partials wrt p.
   minitensor::Vector<T, N>
   resi = function.gradient(soln);
 
@@ -246,16 +249,17 @@ MiniSolverROL(
   auto const
   dimension = soln.get_dimension();
 
-  // Put values back in solution vector
+  // Put values back in solution vector. Its derivatives are dropped so
+  // that the gradient below only carries the partials wrt p.
   for (auto i = 0; i < dimension; ++i) {
-    soln(i).val() = soln_val(i);
+    soln(i) = soln_val(i);
   }
 
   // Get the Hessian evaluated at the solution.
   minitensor::Tensor<ValueT, N>
   DrDx = function.hessian(soln_val);
 
-  // Now compute gradient with solution that has Albany sensitivities.
+  // Gradient at the converged solution, with only its partials wrt p.
   minitensor::Vector<T, N>
   resi = function.gradient(soln);
 
@@ -339,16 +343,17 @@ MiniSolverBoundsROL(
   auto const
   dimension = soln.get_dimension();
 
-  // Put values back in solution vector
+  // Put values back in solution vector. Its derivatives are dropped so
+  // that the gradient below only carries the partials wrt p.
   for (auto i = 0; i < dimension; ++i) {
-    soln(i).val() = soln_val(i);
+    soln(i) = soln_val(i);
   }
 
   // Get the Hessian evaluated at the solution.
   minitensor::Tensor<ValueT, N>
   DrDx = function.hessian(soln_val);
 
-  // Now compute gradient with solution that has Albany sensitivities.
+  // Gradient at the converged solution, with only its partials wrt p.
   minitensor::Vector<T, N>
   resi = function.gradient(soln);
 
@@ -388,16 +393,17 @@ MiniSolverBoundsROL(
   auto const
   dimension = soln.get_dimension();
 
-  // Put values back in solution vector
+  // Put values back in solution vector. Its derivatives are dropped so
+  // that the gradient below only carries the partials wrt p.
   for (auto i = 0; i < dimension; ++i) {
-    soln(i).val() = soln_val(i);
+    soln(i) = soln_val(i);
   }
 
   // Get the Hessian evaluated at the solution.
   minitensor::Tensor<ValueT, N>
   DrDx = function.hessian(soln_val);
 
-  // Now compute gradient with solution that has Albany sensitivities.
+  // Gradient at the converged solution, with only its partials wrt p.
   minitensor::Vector<T, N>
   resi = function.gradient(soln);
 
@@ -492,16 +498,17 @@ MiniSolverEqIneqROL(
   auto const
   dimension = soln.get_dimension();
 
-  // Put values back in solution vector
+  // Put values back in solution vector. Its derivatives are dropped so
+  // that the gradient below only carries the partials wrt p.
   for (auto i = 0; i < dimension; ++i) {
-    soln(i).val() = soln_val(i);
+    soln(i) = soln_val(i);
   }
 
   // Get the Hessian evaluated at the solution.
   minitensor::Tensor<ValueT, N>
   DrDx = function.hessian(soln_val);
 
-  // Now compute gradient with solution that has Albany sensitivities.
+  // Gradient at the converged solution, with only its partials wrt p.
   minitensor::Vector<T, N>
   resi = function.gradient(soln);
 
@@ -530,31 +537,88 @@ computeFADInfo(
 
   if (0 == dimension) return;
 
-  auto const
-  order = r[0].size();
+  // Components of r that do not depend on p may carry no derivatives.
+  int
+  order = 0;
+
+  for (auto i = 0; i < dimension; ++i) {
+    order = std::max(order, static_cast<int>(r(i).size()));
+  }
 
   // No FAD info. Nothing to do.
   if (order == 0) return;
 
-  // Extract sensitivities of r wrt p
-  minitensor::Matrix<S, N, minitensor::DYNAMIC>
-  DrDp(dimension, order);
+  // Factor DrDx once with partial pivoting, then back-substitute
+  // each column of DrDp straight into the derivatives of x.
+  minitensor::Tensor<S, N>
+  LU(DrDx);
+
+  std::vector<minitensor::Index>
+  perm(dimension);
 
   for (auto i = 0; i < dimension; ++i) {
-    for (auto j = 0; j < order; ++j) {
-      DrDp(i, j) = r(i).dx(j);
-    }
+    perm[i] = i;
   }
 
-  // Solve for all DxDp
-  minitensor::Matrix<S, N, minitensor::DYNAMIC>
-  DxDp = minitensor::solve(DrDx, DrDp);
+  for (auto k = 0; k < dimension; ++k) {
+    auto
+    p = k;
+
+    for (auto i = k + 1; i < dimension; ++i) {
+      if (std::abs(LU(i, k)) > std::abs(LU(p, k))) p = i;
+    }
+
+    if (LU(p, k) == 0.0) {
+      MT_ERROR_EXIT("Singular Hessian in MiniSolver sensitivities.");
+    }
+
+    if (p != k) {
+      std::swap(perm[p], perm[k]);
+      for (auto j = 0; j < dimension; ++j) {
+        std::swap(LU(p, j), LU(k, j));
+      }
+    }
+
+    for (auto i = k + 1; i < dimension; ++i) {
+      LU(i, k) /= LU(k, k);
+      for (auto j = k + 1; j < dimension; ++j) {
+        LU(i, j) -= LU(i, k) * LU(k, j);
+      }
+    }
+  }
 
-  // Pack into x.
   for (auto i = 0; i < dimension; ++i) {
     x(i).resize(order);
-    for (auto j = 0; j < order; ++j) {
-      x(i).fastAccessDx(j) = -DxDp(i, j);
+  }
+
+  minitensor::Vector<S, N>
+  b(dimension);
+
+  for (auto j = 0; j < order; ++j) {
+
+    for (auto i = 0; i < dimension; ++i) {
+      T const &
+      ri = r(perm[i]);
+
+      b(i) = j < ri.size() ? ri.fastAccessDx(j) : S(0.0);
+    }
+
+    for (auto i = 1; i < dimension; ++i) {
+      for (auto k = 0; k < i; ++k) {
+        b(i) -= LU(i, k) * b(k);
+      }
+    }
+
+    for (auto i = dimension; i-- > 0;) {
+      for (auto k = i + 1; k < dimension; ++k) {
+        b(i) -= LU(i, k) * b(k);
+      }
+      b(i) /= LU(i, i);
+    }
+
+    // Pack -DxDp into x.
+    for (auto i = 0; i < dimension; ++i) {
+      x(i).fastAccessDx(j) = -b(i);
     }
   }
 }
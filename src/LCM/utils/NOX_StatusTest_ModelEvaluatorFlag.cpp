@@ -6,8 +6,17 @@
 
 #include "NOX_StatusTest_ModelEvaluatorFlag.h"
 #include "Albany_Utils.hpp"
+#include <algorithm>
+#include <limits>
 #include <vector>
 
+namespace {
+
+double const
+lowest_diagnostic = std::numeric_limits<double>::lowest();
+
+} // anonymous namespace
+
 NOX::StatusTest::ModelEvaluatorFlag::
 ModelEvaluatorFlag() :
   status_(Unevaluated)
@@ -16,6 +25,9 @@ ModelEvaluatorFlag() :
 
 NOX::StatusTest::ModelEvaluatorFlag::~ModelEvaluatorFlag()
 {
+#ifdef ALBANY_MPI
+  if (pending_ == true) MPI_Wait(&request_, MPI_STATUS_IGNORE);
+#endif
 }
 
 NOX::StatusTest::StatusType NOX::StatusTest::ModelEvaluatorFlag::
@@ -57,40 +69,113 @@ NOX::StatusTest::StatusType NOX::StatusTest::ModelEvaluatorFlag::getStatus() con
   return status_;
 }
 
+int
+NOX::StatusTest::ModelEvaluatorFlag::addDiagnostic(std::string const & name)
+{
+  diagnostic_names_.push_back(name);
+  local_diagnostics_.push_back(lowest_diagnostic);
+  global_diagnostics_.push_back(lowest_diagnostic);
+  return diagnostic_names_.size() - 1;
+}
+
 void
-NOX::StatusTest::ModelEvaluatorFlag::syncFlag()
+NOX::StatusTest::ModelEvaluatorFlag::updateDiagnostic(int index, double value)
 {
-  std::vector<int> localVal(1), globalVal(1);
+  local_diagnostics_[index] = std::max(local_diagnostics_[index], value);
+}
+
+double
+NOX::StatusTest::ModelEvaluatorFlag::getDiagnostic(int index) const
+{
+  return global_diagnostics_[index];
+}
+
+void
+NOX::StatusTest::ModelEvaluatorFlag::postSyncFlag()
+{
+  // A newer evaluation supersedes a reduction still in flight
+  if (pending_ == true) {
+#ifdef ALBANY_MPI
+    MPI_Wait(&request_, MPI_STATUS_IGNORE);
+#endif
+    pending_ = false;
+  }
+
+  int localVal = 0;
   if(status_ == NOX::StatusTest::Unevaluated){
-    localVal[0] = 0;
+    localVal = 0;
   }
   else if(status_ == NOX::StatusTest::Converged){
-    localVal[0] = 1;
+    localVal = 1;
   }
   else if(status_ == NOX::StatusTest::Unconverged){
-    localVal[0] = 2;
+    localVal = 2;
   }
   else if(status_ == NOX::StatusTest::Failed){
-    localVal[0] = 3;
+    localVal = 3;
   }
 
-  Teuchos::RCP<Teuchos_Comm> teuchosComm = Albany::createTeuchosCommFromMpiComm(Albany_MPI_COMM_WORLD);
-  Teuchos::reduceAll(*teuchosComm, Teuchos::REDUCE_MAX, 1, &localVal[0], &globalVal[0]);
+  send_buffer_.resize(1 + local_diagnostics_.size());
+  recv_buffer_.resize(send_buffer_.size());
+  send_buffer_[0] = localVal;
+  std::copy(local_diagnostics_.begin(), local_diagnostics_.end(),
+            send_buffer_.begin() + 1);
+
+  // The diagnostics describe one evaluation
+  std::fill(local_diagnostics_.begin(), local_diagnostics_.end(),
+            lowest_diagnostic);
+
+#ifdef ALBANY_MPI
+  MPI_Iallreduce(send_buffer_.data(), recv_buffer_.data(),
+                 send_buffer_.size(), MPI_DOUBLE, MPI_MAX,
+                 Albany_MPI_COMM_WORLD, &request_);
+#else
+  recv_buffer_ = send_buffer_;
+#endif
+  pending_ = true;
+}
+
+void
+NOX::StatusTest::ModelEvaluatorFlag::syncFlag()
+{
+  if (pending_ == false) postSyncFlag();
+
+#ifdef ALBANY_MPI
+  MPI_Wait(&request_, MPI_STATUS_IGNORE);
+#endif
+  pending_ = false;
+
+  int const globalVal = static_cast<int>(recv_buffer_[0]);
+  std::copy(recv_buffer_.begin() + 1, recv_buffer_.end(),
+            global_diagnostics_.begin());
 
-  if(globalVal[0] == 0){
+  if(globalVal == 0){
     status_ = NOX::StatusTest::Unevaluated;
   }
-  else if(globalVal[0] == 1){
+  else if(globalVal == 1){
     status_ = NOX::StatusTest::Converged;
   }
-  else if(globalVal[0] == 2){
+  else if(globalVal == 2){
     status_ = NOX::StatusTest::Unconverged;
   }
-  else if(globalVal[0] == 3){
+  else if(globalVal == 3){
     status_ = NOX::StatusTest::Failed;
   }
 }
 
+void
+NOX::StatusTest::ModelEvaluatorFlag::reset()
+{
+  if (pending_ == true) {
+#ifdef ALBANY_MPI
+    MPI_Wait(&request_, MPI_STATUS_IGNORE);
+#endif
+    pending_ = false;
+  }
+  status_ = NOX::StatusTest::Unevaluated;
+  status_message_ = "";
+}
+
 std::ostream& NOX::StatusTest::ModelEvaluatorFlag::print(std::ostream& stream, int indent) const
 {
   for (int j = 0; j < indent; j ++){
@@ -100,6 +185,13 @@ std::ostream& NOX::StatusTest::ModelEvaluatorFlag::print(std::ostream& stream, i
   stream << "Model Evaluator Flag: ";
   stream << status_message_;
   stream << std::endl;
+  for (std::size_t i = 0; i < diagnostic_names_.size(); ++i) {
+    for (int j = 0; j < indent + 2; j ++){
+      stream << ' ';
+    }
+    stream << diagnostic_names_[i] << ": " << global_diagnostics_[i];
+    stream << std::endl;
+  }
 
   return stream;
 }
@@ -9,6 +9,13 @@
 
 #include "NOX_StatusTest_Generic.H"  // base class
 
+#include <string>
+#include <vector>
+
+#ifdef ALBANY_MPI
+#include <mpi.h>
+#endif
+
 namespace NOX {
 
 namespace StatusTest {
@@ -30,8 +37,28 @@ public:
 
   virtual NOX::StatusTest::StatusType getStatus() const;
 
+  //! Register a global diagnostic, reduced (max) with the flag. Every rank
+  //! must register the same diagnostics in the same order.
+  int addDiagnostic(std::string const & name);
+
+  //! Raise the local value of a diagnostic in the current evaluation
+  void updateDiagnostic(int index, double value);
+
+  //! Global value of a diagnostic as of the last reduction
+  double getDiagnostic(int index) const;
+
+  //! Post the reduction of the flag and the diagnostics of the evaluation
+  //! just finished. It is collective and must follow the last evaluation
+  //! before checkStatus, which completes it; changes of the flag in between
+  //! are overwritten by the reduced value.
+  void postSyncFlag();
+
+  //! Complete the posted reduction, or reduce now if none is posted
   void syncFlag();
 
+  //! Clear the flag and drop any reduction in flight, e.g. before a solve
+  void reset();
+
   virtual std::ostream& print(std::ostream& stream, int indent = 0) const;
 
   //! Current status
@@ -39,6 +66,32 @@ public:
 
   std::string
   status_message_;
+
+private:
+
+  std::vector<std::string>
+  diagnostic_names_;
+
+  std::vector<double>
+  local_diagnostics_;
+
+  std::vector<double>
+  global_diagnostics_;
+
+  //! Flag followed by the diagnostics, packed for a single reduction
+  std::vector<double>
+  send_buffer_;
+
+  std::vector<double>
+  recv_buffer_;
+
+  bool
+  pending_{false};
+
+#ifdef ALBANY_MPI
+  MPI_Request
+  request_;
+#endif
 };
 
 } // namespace StatusTest
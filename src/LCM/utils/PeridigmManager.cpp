@@ -9,6 +9,7 @@
 #include "PeridigmManager.hpp"
 #include "Peridigm_ProximitySearch.hpp"
 #include "Albany_Utils.hpp"
+#include "Petra_Converters.hpp"
 #include <stk_mesh/base/GetEntities.hpp>
 #include <stk_mesh/base/FieldBase.hpp>
 #include "Phalanx_DataLayout.hpp"
@@ -492,6 +493,10 @@ void LCM::PeridigmManager::initialize(const Teuchos::RCP<Teuchos::ParameterList>
 
   albanyOverlapSolutionVector = Teuchos::rcp(new Tpetra_Vector(tpetraMap));
 
+  // The lists of local ids are rebuilt with the importer at the next setCurrentTimeAndDisplacement()
+  albanyOverlapImporter = Teuchos::null;
+  worksetPartialStressLocalIds.clear();
+
   if(enableOptimizationBasedCoupling){
     obcOverlappingElementSearch();
   }
@@ -791,6 +796,8 @@ void LCM::PeridigmManager::obcOverlappingElementSearch()
 
   obcPeridynamicNodeCurrentCoords = Teuchos::rcp(new Epetra_Vector(epetraTempMap));
 
+  obcBuildInterpolationMatrix();
+
   // As a sanity check, determine the total number of overlapping peridynamic nodes
   vector<int> localVal(1), globalVal(1);
   localVal[0] = static_cast<int>(obcDataPoints->size());
@@ -803,6 +810,53 @@ void LCM::PeridigmManager::obcOverlappingElementSearch()
   }
 }
 
+void LCM::PeridigmManager::obcBuildInterpolationMatrix()
+{
+  // The overlap region is fixed, so the basis functions of the solid elements at the
+  // natural coordinates of the peridynamic nodes are evaluated once
+  const std::size_t numPoints = obcDataPoints->size();
+  Teuchos::RCP<const Tpetra_Map> pointMap = Teuchos::rcp(new Tpetra_Map(Teuchos::OrdinalTraits<Tpetra::global_size_t>::invalid(),
+                                                                       3*numPoints,
+                                                                       0,
+                                                                       teuchosComm));
+
+  std::size_t maxNumNodes = 0;
+  for(unsigned int iEvalPt=0 ; iEvalPt<numPoints ; iEvalPt++)
+    maxNumNodes = std::max<std::size_t>(maxNumNodes, bulkData->num_nodes((*obcDataPoints)[iEvalPt].albanyElement));
+
+  obcInterpolationMatrix = Teuchos::rcp(new Tpetra_CrsMatrix(pointMap, albanyOverlapSolutionVector->getMap(), maxNumNodes));
+
+  std::vector<Tpetra_GO> columns(maxNumNodes);
+  std::vector<ST> weights(maxNumNodes);
+  for(unsigned int iEvalPt=0 ; iEvalPt<numPoints ; iEvalPt++){
+
+    const OBCDataPoint& dataPoint = (*obcDataPoints)[iEvalPt];
+    int numNodes = bulkData->num_nodes(dataPoint.albanyElement);
+    const stk::mesh::Entity* nodes = bulkData->begin_nodes(dataPoint.albanyElement);
+
+    Kokkos::DynRankView<RealType, PHX::Device> refPoint("PPP", 1, 3);
+    for(int dof=0 ; dof<3 ; dof++)
+      refPoint(0, dof) = dataPoint.naturalCoords[dof];
+
+    Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType>> refBasis = Albany::getIntrepid2Basis(dataPoint.cellTopologyData);
+    Kokkos::DynRankView<RealType, PHX::Device> basisOnRefPoint("PPP", numNodes, 1);
+    refBasis->getValues(basisOnRefPoint, refPoint, Intrepid2::OPERATOR_VALUE);
+
+    for(int dof=0 ; dof<3 ; dof++){
+      for(int i=0 ; i<numNodes ; i++){
+        columns[i] = 3*(bulkData->identifier(nodes[i]) - 1) + dof;
+        weights[i] = basisOnRefPoint(i, 0);
+      }
+      obcInterpolationMatrix->insertGlobalValues(pointMap->getGlobalElement(3*iEvalPt+dof),
+                                                 Teuchos::arrayView(&columns[0], numNodes),
+                                                 Teuchos::arrayView(&weights[0], numNodes));
+    }
+  }
+
+  obcInterpolationMatrix->fillComplete(stkDisc->getMapT(), pointMap);
+  obcDataPointDisplacements = Teuchos::rcp(new Tpetra_Vector(pointMap));
+}
+
 double LCM::PeridigmManager::obcEvaluateFunctional(Epetra_Vector* obcFunctionalDerivWrtDisplacement)
 {
 
@@ -810,14 +864,15 @@ double LCM::PeridigmManager::obcEvaluateFunctional(Epetra_Vector* obcFunctionalD
     return 0.0;
   }
 
-  // Set up access to the current displacements of the nodes in the solid elements
-  Teuchos::ArrayRCP<const ST> albanyCurrentDisplacement = albanyOverlapSolutionVector->getData();
-  const Teuchos::RCP<const Tpetra_Map> albanyMap = albanyOverlapSolutionVector->getMap();
+  // Interpolate the current Albany displacements to the peridynamic nodes
+  obcInterpolationMatrix->apply(*albanySolutionVector, *obcDataPointDisplacements);
+  Teuchos::ArrayRCP<const ST> dataPointDisplacements = obcDataPointDisplacements->getData();
 
   // Load the current displacements into the obcDataPoints data structures
   Epetra_Vector& peridigmCurrentPositions = *(peridigm->getY());
-  Epetra_Import overlapCurrentCoordsImporter(obcPeridynamicNodeCurrentCoords->Map(), peridigmCurrentPositions.Map());
-  int err = obcPeridynamicNodeCurrentCoords->Import(peridigmCurrentPositions, overlapCurrentCoordsImporter, Insert);
+  if(obcCurrentCoordsImporter.is_null())
+    obcCurrentCoordsImporter = Teuchos::rcp(new Epetra_Import(obcPeridynamicNodeCurrentCoords->Map(), peridigmCurrentPositions.Map()));
+  int err = obcPeridynamicNodeCurrentCoords->Import(peridigmCurrentPositions, *obcCurrentCoordsImporter, Insert);
   TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "\n\n**** Error in PeridigmManager::obcEvaluateFunctional(), import operation failed!\n\n");
   for(unsigned int iEvalPt=0 ; iEvalPt<obcDataPoints->size() ; iEvalPt++){
     int localId = obcPeridynamicNodeCurrentCoords->Map().LID((*obcDataPoints)[iEvalPt].peridigmGlobalId);
@@ -826,14 +881,6 @@ double LCM::PeridigmManager::obcEvaluateFunctional(Epetra_Vector* obcFunctionalD
     }
   }
 
-  // Creating Overlapped obcFunctionalDerivWrtDisplacement
-  Teuchos::RCP<Epetra_Vector> obcFunctionalDerivWrtDisplacementOverlap;
-  Teuchos::RCP<Epetra_Export> overlapSolutionExporter;
-  if(obcFunctionalDerivWrtDisplacement != NULL){
-    obcFunctionalDerivWrtDisplacementOverlap = Teuchos::rcp<Epetra_Vector>(new Epetra_Vector(*stkDisc->getOverlapMap()));
-    overlapSolutionExporter = Teuchos::rcp<Epetra_Export>(new Epetra_Export(*stkDisc->getOverlapMap(), obcFunctionalDerivWrtDisplacement->Map()));
-  }
-
   Teuchos::RCP<Epetra_Vector> obcFunctionalDerivWrtDisplacementPeridynamicNodes;
   if(obcFunctionalDerivWrtDisplacement != NULL){
     std::vector<int> tempGlobalIds(3*obcDataPoints->size());
@@ -851,72 +898,22 @@ double LCM::PeridigmManager::obcEvaluateFunctional(Epetra_Vector* obcFunctionalD
     obcFunctionalDerivWrtDisplacementPeridynamicNodes = Teuchos::rcp<Epetra_Vector>(new Epetra_Vector(epetraTempMap));
   }
 
-  // We're interested in a single point in a single element in a three-dimensional simulation
-  int numCells = 1;
-  int numPoints = 1;
-  int numDim = 3;
-
-  Kokkos::DynRankView<RealType, PHX::Device> physPoints("PPP", numCells, numPoints, numDim);
-
-  Kokkos::DynRankView<RealType, PHX::Device> refPoints("PPP", numCells, numPoints, numDim);
-
   // Compute the difference in displacements at each peridynamic node
   Epetra_Vector displacementDiff(obcPeridynamicNodeCurrentCoords->Map());
   Epetra_Vector displacementDiffScaled(obcPeridynamicNodeCurrentCoords->Map());
   for(unsigned int iEvalPt=0 ; iEvalPt<obcDataPoints->size() ; iEvalPt++){
 
-    for(int dof=0 ; dof<3 ; dof++){
-      refPoints(0, 0, dof) = (*obcDataPoints)[iEvalPt].naturalCoords[dof];
-    }
-
-    int numNodes = bulkData->num_nodes((*obcDataPoints)[iEvalPt].albanyElement);
-    const stk::mesh::Entity* nodes = bulkData->begin_nodes((*obcDataPoints)[iEvalPt].albanyElement);
-
-    Kokkos::DynRankView<RealType, PHX::Device> cellWorkset("PPP", numCells, numNodes, numDim);
-    for(int i=0 ; i<numNodes ; i++){
-      int globalAlbanyNodeId = bulkData->identifier(nodes[i]) - 1;
-      Tpetra_Map::local_ordinal_type albanyLocalId = albanyMap->getLocalElement(3*globalAlbanyNodeId);
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(albanyLocalId == Teuchos::OrdinalTraits<LO>::invalid(), "\n\n**** Error in PeridigmManager::obcEvaluateFunctional(), invalid Albany local id.\n\n");
-      cellWorkset(0, i, 0) = albanyCurrentDisplacement[albanyLocalId];
-      cellWorkset(0, i, 1) = albanyCurrentDisplacement[albanyLocalId + 1];
-      cellWorkset(0, i, 2) = albanyCurrentDisplacement[albanyLocalId + 2];
-    }
-
-    shards::CellTopology cellTopology(&(*obcDataPoints)[iEvalPt].cellTopologyData);
-
-    Intrepid2::CellTools<PHX::Device>::mapToPhysicalFrame(physPoints, refPoints, cellWorkset, cellTopology);
-
-    // Record the difference between the Albany displacement at the point (which was just computed using Intrepid2) and
+    // Record the difference between the Albany displacement at the point and
     // the Peridigm displacement at the point
     for(int dof=0 ; dof<3 ; dof++){
-      displacementDiff[3*iEvalPt+dof] = physPoints(0,0,dof) - ((*obcDataPoints)[iEvalPt].currentCoords[dof] - (*obcDataPoints)[iEvalPt].initialCoords[dof]);
+      displacementDiff[3*iEvalPt+dof] = dataPointDisplacements[3*iEvalPt+dof] - ((*obcDataPoints)[iEvalPt].currentCoords[dof] - (*obcDataPoints)[iEvalPt].initialCoords[dof]);
       // Multiply the displacement vector by the sphere element volume
       displacementDiffScaled[3*iEvalPt+dof] = obcScaleFactor*displacementDiff[3*iEvalPt+dof]*(*obcDataPoints)[iEvalPt].sphereElementVolume;
     }
     if(obcFunctionalDerivWrtDisplacement != NULL) {
-      Kokkos::DynRankView<RealType, PHX::Device> refPoint("PPP", numPoints, numDim);
-      for(int dof=0 ; dof<3 ; dof++)
-        refPoint(0, dof) = refPoints(0, 0, dof);
-
-      Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType>> refBasis = Albany::getIntrepid2Basis((*obcDataPoints)[iEvalPt].cellTopologyData);
-      Kokkos::DynRankView<RealType, PHX::Device> basisOnRefPoint("PPP", numNodes, 1);
-      refBasis->getValues(basisOnRefPoint, refPoint, Intrepid2::OPERATOR_VALUE);
-
-      // Derivatives corresponding to nodal dof in Albany element
+      // Derivatives corresponding to dof at peridigm node
       double deriv[3];
       int globalNodeIds[3];
-      for(int i=0 ; i<numNodes ; i++) {
-        int globalAlbanyNodeId = bulkData->identifier(nodes[i]) - 1;
-
-        for(int dim=0; dim<3; ++dim) {
-          deriv[dim] = 2*displacementDiffScaled[3*iEvalPt+dim]*basisOnRefPoint(i,0);
-          globalNodeIds[dim] = 3*globalAlbanyNodeId + dim;
-        }
-        int err = obcFunctionalDerivWrtDisplacementOverlap->SumIntoGlobalValues(3, deriv, globalNodeIds);
-	TEUCHOS_TEST_FOR_EXCEPT_MSG(err != 0, "\n\n**** Error in PeridigmManager::obcEvaluateFunctional(), obcFunctionalDerivWrtDisplacementOverlap->SumIntoGlobalValues().\n\n");
-      }
-
-      // Derivatives corresponding to dof at peridigm node
       for(int dim=0; dim<3; ++dim) {
         deriv[dim] = -2*displacementDiffScaled[3*iEvalPt+dim];
         globalNodeIds[dim] = 3*((*obcDataPoints)[iEvalPt].peridigmGlobalId) + dim;
@@ -927,11 +924,19 @@ double LCM::PeridigmManager::obcEvaluateFunctional(Epetra_Vector* obcFunctionalD
     }
   }
 
-
-
   // Assemble the derivative of the functional
   if(obcFunctionalDerivWrtDisplacement != NULL) {
-    obcFunctionalDerivWrtDisplacement->Export(*obcFunctionalDerivWrtDisplacementOverlap, *overlapSolutionExporter, Add);
+    // Derivatives corresponding to nodal dof in Albany elements, through the transpose of the interpolation
+    Tpetra_Vector dataPointDeriv(obcInterpolationMatrix->getRangeMap());
+    Teuchos::ArrayRCP<ST> dataPointDerivValues = dataPointDeriv.getDataNonConst();
+    for(unsigned int i=0 ; i<3*obcDataPoints->size() ; i++)
+      dataPointDerivValues[i] = 2*displacementDiffScaled[i];
+    dataPointDerivValues = Teuchos::null;
+    Teuchos::RCP<Tpetra_Vector> albanyDeriv = Teuchos::rcp(new Tpetra_Vector(obcInterpolationMatrix->getDomainMap()));
+    obcInterpolationMatrix->apply(dataPointDeriv, *albanyDeriv, Teuchos::TRANS);
+    Epetra_Vector albanyDerivEpetra(obcFunctionalDerivWrtDisplacement->Map());
+    Petra::TpetraVector_To_EpetraVector(albanyDeriv, albanyDerivEpetra, Albany::createEpetraCommFromTeuchosComm(teuchosComm));
+    obcFunctionalDerivWrtDisplacement->Update(1.0, albanyDerivEpetra, 1.0);
 
     // Add in the contribution from the peridynamic nodes, which may be owned by a different processor
     Epetra_Vector temp(obcFunctionalDerivWrtDisplacement->Map());
@@ -965,8 +970,13 @@ void LCM::PeridigmManager::setCurrentTimeAndDisplacement(double time, const Teuc
 {
   if(hasPeridynamics){
 
-    Tpetra_Import tpetraImport(albanySolutionVector->getMap(), albanyOverlapSolutionVector->getMap());
-    albanyOverlapSolutionVector->doImport(*albanySolutionVector, tpetraImport, Tpetra::INSERT);
+    // The Albany maps only change with the mesh
+    if(albanyOverlapImporter.is_null() || albanyOverlapImporter->getSourceMap() != albanySolutionVector->getMap()){
+      albanyOverlapImporter = Teuchos::rcp(new Tpetra_Import(albanySolutionVector->getMap(), albanyOverlapSolutionVector->getMap()));
+      buildLocalIdLists();
+    }
+    albanyOverlapSolutionVector->doImport(*albanySolutionVector, *albanyOverlapImporter, Tpetra::INSERT);
+    this->albanySolutionVector = albanySolutionVector;
 
     currentTime = time;
     timeStep = currentTime - previousTime;
@@ -983,103 +993,132 @@ void LCM::PeridigmManager::setCurrentTimeAndDisplacement(double time, const Teuc
 
     // Peridynamic elements (sphere elements)
     Teuchos::ArrayRCP<const ST> albanyCurrentDisplacement = albanyOverlapSolutionVector->getData();
-    const Teuchos::RCP<const Tpetra_Map> albanyMap = albanyOverlapSolutionVector->getMap();
-    Tpetra_Map::local_ordinal_type albanyLocalId;
-    const Epetra_BlockMap& peridigmMap = peridigmCurrentPositions.Map();
-    int peridigmLocalId, globalId;
-
-    for(unsigned int i=0 ; i<sphereElementGlobalNodeIds.size() ; ++i){
-      globalId = sphereElementGlobalNodeIds[i];
-      peridigmLocalId = peridigmMap.LID(globalId);
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(peridigmLocalId == -1, "\n\n**** Error in PeridigmManager::setCurrentTimeAndDisplacement(), invalid Peridigm local id.\n\n");
-      albanyLocalId = albanyMap->getLocalElement(3*globalId);
-      TEUCHOS_TEST_FOR_EXCEPT_MSG(albanyLocalId == Teuchos::OrdinalTraits<LO>::invalid(), "\n\n**** Error in PeridigmManager::setCurrentTimeAndDisplacement(), invalid Albany local id.\n\n");
-      peridigmDisplacements[3*peridigmLocalId]   = albanyCurrentDisplacement[albanyLocalId];
-      peridigmDisplacements[3*peridigmLocalId+1] = albanyCurrentDisplacement[albanyLocalId+1];
-      peridigmDisplacements[3*peridigmLocalId+2] = albanyCurrentDisplacement[albanyLocalId+2];
-      peridigmCurrentPositions[3*peridigmLocalId]   = peridigmReferencePositions[3*peridigmLocalId] + peridigmDisplacements[3*peridigmLocalId];
-      peridigmCurrentPositions[3*peridigmLocalId+1] = peridigmReferencePositions[3*peridigmLocalId+1] + peridigmDisplacements[3*peridigmLocalId+1];
-      peridigmCurrentPositions[3*peridigmLocalId+2] = peridigmReferencePositions[3*peridigmLocalId+2] + peridigmDisplacements[3*peridigmLocalId+2];
-      peridigmVelocities[3*peridigmLocalId]   = (peridigmCurrentPositions[3*peridigmLocalId]   - previousSolutionPositions[3*peridigmLocalId])/timeStep;
-      peridigmVelocities[3*peridigmLocalId+1] = (peridigmCurrentPositions[3*peridigmLocalId+1] - previousSolutionPositions[3*peridigmLocalId+1])/timeStep;
-      peridigmVelocities[3*peridigmLocalId+2] = (peridigmCurrentPositions[3*peridigmLocalId+2] - previousSolutionPositions[3*peridigmLocalId+2])/timeStep;
+
+    for(unsigned int i=0 ; i<sphereElementPeridigmLocalIds.size() ; ++i){
+      const int peridigmLocalId = sphereElementPeridigmLocalIds[i];
+      const LO albanyLocalId = sphereElementAlbanyLocalIds[i];
+      for(int dof=0 ; dof<3 ; ++dof){
+        peridigmDisplacements[3*peridigmLocalId+dof] = albanyCurrentDisplacement[albanyLocalId+dof];
+        peridigmCurrentPositions[3*peridigmLocalId+dof] = peridigmReferencePositions[3*peridigmLocalId+dof] + peridigmDisplacements[3*peridigmLocalId+dof];
+        peridigmVelocities[3*peridigmLocalId+dof] = (peridigmCurrentPositions[3*peridigmLocalId+dof] - previousSolutionPositions[3*peridigmLocalId+dof])/timeStep;
+      }
     }
 
     // Partial stress elements (solid elements with peridynamic material points at each integration point)
+    // The material points are mapped to the current configuration with basis values computed once per topology.
+
+    for(unsigned int e=0 ; e<partialStressElements.size() ; ++e){
+      const PartialStressElement& element = partialStressElements[e];
+      const std::vector<RealType>& basisValues = getPartialStressBasisValues(element.cellTopologyData);
+      const std::vector<LO>& albanyLocalIds = partialStressAlbanyLocalIds[e];
+      const std::vector<int>& peridigmLocalIds = partialStressPeridigmLocalIds[e];
+      const int numNodes = albanyLocalIds.size();
+
+      for(unsigned int qp=0 ; qp<peridigmLocalIds.size() ; ++qp){
+        const int peridigmLocalId = peridigmLocalIds[qp];
+        const RealType* N = &basisValues[qp*numNodes];
+        for(int dof=0 ; dof<3 ; ++dof){
+          RealType position = 0.0;
+          for(int n=0 ; n<numNodes ; ++n)
+            position += N[n] * (element.albanyNodeInitialPositions[3*n+dof] + albanyCurrentDisplacement[albanyLocalIds[n]+dof]);
+          peridigmCurrentPositions[3*peridigmLocalId+dof] = position;
+          peridigmDisplacements[3*peridigmLocalId+dof] = position - peridigmReferencePositions[3*peridigmLocalId+dof];
+          peridigmVelocities[3*peridigmLocalId+dof] = (position - previousSolutionPositions[3*peridigmLocalId+dof])/timeStep;
+        }
+      }
+    }
+  }
+}
 
-    for(std::vector<PartialStressElement>::iterator it=partialStressElements.begin() ; it!=partialStressElements.end() ; it++){
-
-      // \todo This is brutal, need to store these data structures instead of re-creating them every time for every element.
-      // Can probably store things by block and use worksets to compute things in one big call.
-
-      shards::CellTopology cellTopology(&it->cellTopologyData);
-      Intrepid2::DefaultCubatureFactory cubFactory;
-      Teuchos::RCP<Intrepid2::Cubature<PHX::Device>> cubature = cubFactory.create<PHX::Device, RealType, RealType>(cellTopology, cubatureDegree);
-      const int numDim = cubature->getDimension();
-      const int numQuadPoints = cubature->getNumPoints();
-      const int numNodes = cellTopology.getNodeCount();
-      const int numCells = 1;
+void LCM::PeridigmManager::buildLocalIdLists()
+{
+  const Teuchos::RCP<const Tpetra_Map> albanyMap = albanyOverlapSolutionVector->getMap();
+  const Epetra_BlockMap& peridigmMap = peridigm->getY()->Map();
+
+  sphereElementPeridigmLocalIds.resize(sphereElementGlobalNodeIds.size());
+  sphereElementAlbanyLocalIds.resize(sphereElementGlobalNodeIds.size());
+  for(unsigned int i=0 ; i<sphereElementGlobalNodeIds.size() ; ++i){
+    const int globalId = sphereElementGlobalNodeIds[i];
+    sphereElementPeridigmLocalIds[i] = peridigmMap.LID(globalId);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(sphereElementPeridigmLocalIds[i] == -1, "\n\n**** Error in PeridigmManager::setCurrentTimeAndDisplacement(), invalid Peridigm local id.\n\n");
+    sphereElementAlbanyLocalIds[i] = albanyMap->getLocalElement(3*globalId);
+    TEUCHOS_TEST_FOR_EXCEPT_MSG(sphereElementAlbanyLocalIds[i] == Teuchos::OrdinalTraits<LO>::invalid(), "\n\n**** Error in PeridigmManager::setCurrentTimeAndDisplacement(), invalid Albany local id.\n\n");
+  }
 
-      // Get the quadrature points and weights
-      Kokkos::DynRankView<RealType, PHX::Device> quadratureRefPoints("quadratureRefPoints", numQuadPoints, numDim);
-      Kokkos::DynRankView<RealType, PHX::Device> quadratureRefWeights("quadratureRefWeights", numQuadPoints);
-      cubature->getCubature(quadratureRefPoints, quadratureRefWeights);
+  partialStressAlbanyLocalIds.resize(partialStressElements.size());
+  partialStressPeridigmLocalIds.resize(partialStressElements.size());
+  for(unsigned int e=0 ; e<partialStressElements.size() ; ++e){
+    const PartialStressElement& element = partialStressElements[e];
+
+    const int numNodesInElement = bulkData->num_nodes(element.albanyElement);
+    const stk::mesh::Entity* node = bulkData->begin_nodes(element.albanyElement);
+    partialStressAlbanyLocalIds[e].resize(numNodesInElement);
+    for(int i=0 ; i<numNodesInElement ; i++){
+      const int globalAlbanyNodeId = bulkData->identifier(node[i]) - 1;
+      partialStressAlbanyLocalIds[e][i] = albanyMap->getLocalElement(3*globalAlbanyNodeId);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(partialStressAlbanyLocalIds[e][i] == Teuchos::OrdinalTraits<LO>::invalid(), "\n\n**** Error in PeridigmManager::setCurrentTimeAndDisplacement(), invalid Albany local id.\n\n");
+    }
 
-      typedef PHX::KokkosViewFactory<RealType, PHX::Device> ViewFactory;
+    partialStressPeridigmLocalIds[e].resize(element.peridigmGlobalIds.size());
+    for(unsigned int i=0 ; i<element.peridigmGlobalIds.size() ; ++i){
+      std::map<int,int>::const_iterator it = peridigmGlobalIdToPeridigmLocalId.find(element.peridigmGlobalIds[i]);
+      TEUCHOS_TEST_FOR_EXCEPT_MSG(it == peridigmGlobalIdToPeridigmLocalId.end(), "\n\n**** Error in PeridigmManager::setCurrentTimeAndDisplacement(), invalid Peridigm local id.\n\n");
+      partialStressPeridigmLocalIds[e][i] = it->second;
+    }
+  }
+}
 
-      // Physical points, which are the physical (x, y, z) values of the quadrature points
-      Teuchos::RCP< PHX::MDALayout<Cell, QuadPoint, Dim>> physPointsLayout = Teuchos::rcp(new PHX::MDALayout<Cell, QuadPoint, Dim>(numCells, numQuadPoints, numDim));
-      PHX::MDField<RealType, Cell, QuadPoint, Dim> physPoints("Physical Points", physPointsLayout);
-      physPoints.setFieldData(ViewFactory::buildView(physPoints.fieldTag()));
+const std::vector<RealType>& LCM::PeridigmManager::getPartialStressBasisValues(const CellTopologyData& cellTopologyData)
+{
+  std::vector<RealType>& values = partialStressBasisValues[cellTopologyData.key];
+  if(!values.empty())
+    return values;
+
+  shards::CellTopology cellTopology(&cellTopologyData);
+  Intrepid2::DefaultCubatureFactory cubFactory;
+  Teuchos::RCP<Intrepid2::Cubature<PHX::Device>> cubature = cubFactory.create<PHX::Device, RealType, RealType>(cellTopology, cubatureDegree);
+  const int numDim = cubature->getDimension();
+  const int numQuadPoints = cubature->getNumPoints();
+  const int numNodes = cellTopology.getNodeCount();
+
+  // The map to the physical frame is linear in the nodal coordinates, so mapping the
+  // cell whose node n is at (1,0,0) and all others at the origin gives basis function n.
+  const int numCells = numNodes;
+
+  // Get the quadrature points and weights
+  Kokkos::DynRankView<RealType, PHX::Device> quadratureRefPoints("quadratureRefPoints", numQuadPoints, numDim);
+  Kokkos::DynRankView<RealType, PHX::Device> quadratureRefWeights("quadratureRefWeights", numQuadPoints);
+  cubature->getCubature(quadratureRefPoints, quadratureRefWeights);
 
-      // Reference points, which are the natural coordinates of the quadrature points
-      Teuchos::RCP< PHX::MDALayout<Cell, QuadPoint, Dim>> refPointsLayout = Teuchos::rcp(new PHX::MDALayout<Cell, QuadPoint, Dim>(numCells, numQuadPoints, numDim));
-      PHX::MDField<RealType, Cell, QuadPoint, Dim> refPoints("Reference Points", refPointsLayout);
-      refPoints.setFieldData(ViewFactory::buildView(refPoints.fieldTag()));
+  typedef PHX::KokkosViewFactory<RealType, PHX::Device> ViewFactory;
 
-      // Cell workset, which is the set of nodes for the given element
-      Teuchos::RCP< PHX::MDALayout<Cell, Node, Dim>> cellWorksetLayout = Teuchos::rcp(new PHX::MDALayout<Cell, Node, Dim>(numCells, numNodes, numDim));
-      PHX::MDField<RealType, Cell, Node, Dim> cellWorkset("Cell Workset", cellWorksetLayout);
-      cellWorkset.setFieldData(ViewFactory::buildView(cellWorkset.fieldTag()));
+  Teuchos::RCP< PHX::MDALayout<Cell, QuadPoint, Dim>> pointsLayout = Teuchos::rcp(new PHX::MDALayout<Cell, QuadPoint, Dim>(numCells, numQuadPoints, numDim));
+  PHX::MDField<RealType, Cell, QuadPoint, Dim> physPoints("Physical Points", pointsLayout);
+  physPoints.setFieldData(ViewFactory::buildView(physPoints.fieldTag()));
+  PHX::MDField<RealType, Cell, QuadPoint, Dim> refPoints("Reference Points", pointsLayout);
+  refPoints.setFieldData(ViewFactory::buildView(refPoints.fieldTag()));
+
+  Teuchos::RCP< PHX::MDALayout<Cell, Node, Dim>> cellWorksetLayout = Teuchos::rcp(new PHX::MDALayout<Cell, Node, Dim>(numCells, numNodes, numDim));
+  PHX::MDField<RealType, Cell, Node, Dim> cellWorkset("Cell Workset", cellWorksetLayout);
+  cellWorkset.setFieldData(ViewFactory::buildView(cellWorkset.fieldTag()));
+
+  for(int cell=0 ; cell<numCells ; ++cell){
+    for(int qp=0 ; qp<numQuadPoints ; ++qp)
+      for(int dim=0 ; dim<numDim ; ++dim)
+        refPoints(cell, qp, dim) = quadratureRefPoints(qp, dim);
+    for(int n=0 ; n<numNodes ; ++n)
+      for(int dim=0 ; dim<numDim ; ++dim)
+        cellWorkset(cell, n, dim) = (n == cell && dim == 0) ? 1.0 : 0.0;
+  }
 
-      // Copy the reference points from the Intrepid2::FieldContainer to a PHX::MDField
-      for(int qp=0 ; qp<numQuadPoints ; ++qp){
-	for(int dof=0 ; dof<3 ; ++dof){
-	  refPoints(0, qp, dof) = quadratureRefPoints(qp, dof);
-	}
-      }
+  Intrepid2::CellTools<PHX::Device>::mapToPhysicalFrame(physPoints.get_view(), refPoints.get_view(), cellWorkset.get_view(), cellTopology);
 
-      int numNodesInElement = bulkData->num_nodes(it->albanyElement);
-      const stk::mesh::Entity* node = bulkData->begin_nodes(it->albanyElement);
-      Teuchos::ArrayRCP<const ST> albanyCurrentDisplacement = albanyOverlapSolutionVector->getData();
-
-      for(int i=0 ; i<numNodesInElement ; i++){
-	int globalAlbanyNodeId = bulkData->identifier(node[i]) - 1;
-	Tpetra_Map::local_ordinal_type albanyLocalId = albanyMap->getLocalElement(3*globalAlbanyNodeId);
-	TEUCHOS_TEST_FOR_EXCEPT_MSG(albanyLocalId == Teuchos::OrdinalTraits<LO>::invalid(), "\n\n**** Error in PeridigmManager::setCurrentTimeAndDisplacement(), invalid Albany local id.\n\n");
-	cellWorkset(0, i, 0) = it->albanyNodeInitialPositions[3*i]   + albanyCurrentDisplacement[albanyLocalId];
-	cellWorkset(0, i, 1) = it->albanyNodeInitialPositions[3*i+1] + albanyCurrentDisplacement[albanyLocalId + 1];
-	cellWorkset(0, i, 2) = it->albanyNodeInitialPositions[3*i+2] + albanyCurrentDisplacement[albanyLocalId + 2];
-      }
+  values.resize(numQuadPoints*numNodes);
+  for(int qp=0 ; qp<numQuadPoints ; ++qp)
+    for(int n=0 ; n<numNodes ; ++n)
+      values[qp*numNodes+n] = physPoints(n, qp, 0);
 
-      // Determine the global (x,y,z) coordinates of the quadrature points
-      Intrepid2::CellTools<PHX::Device>::mapToPhysicalFrame(physPoints.get_view(), refPoints.get_view(), cellWorkset.get_view(), cellTopology);
-
-      for(unsigned int i=0 ; i<it->peridigmGlobalIds.size() ; ++i){
-	peridigmLocalId = peridigmGlobalIdToPeridigmLocalId[it->peridigmGlobalIds[i]];
-	TEUCHOS_TEST_FOR_EXCEPT_MSG(peridigmLocalId == -1, "\n\n**** Error in PeridigmManager::setCurrentTimeAndDisplacement(), invalid Peridigm local id.\n\n");
-	peridigmCurrentPositions[3*peridigmLocalId]   = physPoints(0, i, 0);
-	peridigmCurrentPositions[3*peridigmLocalId+1] = physPoints(0, i, 1);
-	peridigmCurrentPositions[3*peridigmLocalId+2] = physPoints(0, i, 2);
-	peridigmDisplacements[3*peridigmLocalId]   = peridigmCurrentPositions[3*peridigmLocalId]   - peridigmReferencePositions[3*peridigmLocalId];
-	peridigmDisplacements[3*peridigmLocalId+1] = peridigmCurrentPositions[3*peridigmLocalId+1] - peridigmReferencePositions[3*peridigmLocalId+1];
-	peridigmDisplacements[3*peridigmLocalId+2] = peridigmCurrentPositions[3*peridigmLocalId+2] - peridigmReferencePositions[3*peridigmLocalId+2];
-	peridigmVelocities[3*peridigmLocalId]   = (peridigmCurrentPositions[3*peridigmLocalId]   - previousSolutionPositions[3*peridigmLocalId])/timeStep;
-	peridigmVelocities[3*peridigmLocalId+1] = (peridigmCurrentPositions[3*peridigmLocalId+1] - previousSolutionPositions[3*peridigmLocalId+1])/timeStep;
-	peridigmVelocities[3*peridigmLocalId+2] = (peridigmCurrentPositions[3*peridigmLocalId+2] - previousSolutionPositions[3*peridigmLocalId+2])/timeStep;
-      }
-    }
-  }
+  return values;
 }
 
 void LCM::PeridigmManager::updateState()
@@ -1343,7 +1382,6 @@ void LCM::PeridigmManager::getPartialStress(std::string blockName, int worksetIn
     int globalElementId = worksetLocalIdToGlobalId[worksetIndex][worksetLocalElementId];
     std::vector<int>& peridigmGlobalIds = albanyPartialStressElementGlobalIdToPeridigmGlobalIds[globalElementId];
     Teuchos::RCP<const Epetra_Vector> data = peridigm->getBlockData(blockName, "Partial_Stress");
-    Teuchos::RCP<const Epetra_Vector> displacement = peridigm->getBlockData(blockName, "Displacement");
     for(unsigned int i=0 ; i<peridigmGlobalIds.size() ; ++i){
       int peridigmLocalId = data->Map().LID(peridigmGlobalIds[i]);
       TEUCHOS_TEST_FOR_EXCEPT_MSG(peridigmLocalId == -1, "\n\n**** Error in PeridigmManager::getPartialStress(), invalid global id.\n");
@@ -1354,6 +1392,34 @@ void LCM::PeridigmManager::getPartialStress(std::string blockName, int worksetIn
   }
 }
 
+void LCM::PeridigmManager::getPartialStress(const std::string& blockName, int worksetIndex, int numCells, int numQPs, std::vector<RealType>& partialStressValues)
+{
+  if(hasPeridynamics){
+
+    Teuchos::RCP<const Epetra_Vector> data = peridigm->getBlockData(blockName, "Partial_Stress");
+
+    // The material points of a workset only change with the mesh
+    std::vector<int>& localIds = worksetPartialStressLocalIds[blockName][worksetIndex];
+    if(localIds.size() != static_cast<std::size_t>(numCells*numQPs)){
+      localIds.resize(numCells*numQPs);
+      for(int cell=0 ; cell<numCells ; ++cell){
+        int globalElementId = worksetLocalIdToGlobalId[worksetIndex][cell];
+        const std::vector<int>& peridigmGlobalIds = albanyPartialStressElementGlobalIdToPeridigmGlobalIds[globalElementId];
+        TEUCHOS_TEST_FOR_EXCEPT_MSG(peridigmGlobalIds.size() != static_cast<std::size_t>(numQPs), "\n\n**** Error in PeridigmManager::getPartialStress(), unexpected number of material points.\n");
+        for(int qp=0 ; qp<numQPs ; ++qp){
+          localIds[cell*numQPs+qp] = data->Map().LID(peridigmGlobalIds[qp]);
+          TEUCHOS_TEST_FOR_EXCEPT_MSG(localIds[cell*numQPs+qp] == -1, "\n\n**** Error in PeridigmManager::getPartialStress(), invalid global id.\n");
+        }
+      }
+    }
+
+    partialStressValues.resize(9*localIds.size());
+    for(unsigned int i=0 ; i<localIds.size() ; ++i)
+      for(int j=0 ; j<9 ; ++j)
+        partialStressValues[9*i+j] = (*data)[9*localIds[i]+j];
+  }
+}
+
 Teuchos::RCP<const Epetra_Vector> LCM::PeridigmManager::getBlockData(std::string blockName, std::string fieldName)
 {
 
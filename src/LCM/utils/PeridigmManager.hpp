@@ -75,6 +75,9 @@ public:
   //! Identify the overlapping solid element for each peridynamic sphere element (applies only to overlapping discretizations).
   void obcOverlappingElementSearch();
 
+  //! Store the interpolation from the Albany displacements to the overlapping peridynamic nodes as a matrix.
+  void obcBuildInterpolationMatrix();
+
   //! Evaluate the functional for optimization-based coupling
   double obcEvaluateFunctional(Epetra_Vector* obcFunctionalDerivWrtDisplacement = NULL);
 
@@ -120,6 +123,9 @@ public:
   //! Retrieve the partial stress tensors for the quadrature points in the given element (evaluateInternalForce() must be called prior to getPartialStress()).
   void getPartialStress(std::string blockName, int worksetIndex, int worksetLocalElementId, std::vector< std::vector<RealType>>& partialStressValues);
 
+  //! Retrieve the partial stress tensors for all the quadrature points of the given workset, nine values per point, cell by cell.
+  void getPartialStress(const std::string& blockName, int worksetIndex, int numCells, int numQPs, std::vector<RealType>& partialStressValues);
+
   //! Accessor for the list of solid elements in the overlap region for optimization-based coupling.
   Teuchos::RCP< std::vector<OBCDataPoint>> getOBCDataPoints(){
     return obcDataPoints;
@@ -185,10 +191,42 @@ private:
 
   Teuchos::RCP<Epetra_Vector> obcPeridynamicNodeCurrentCoords;
 
+  //! Interpolation weights from the owned Albany displacements to the displacements at the obcDataPoints, three rows per point.
+  Teuchos::RCP<Tpetra_CrsMatrix> obcInterpolationMatrix;
+
+  Teuchos::RCP<Tpetra_Vector> obcDataPointDisplacements;
+
+  Teuchos::RCP<Epetra_Import> obcCurrentCoordsImporter;
+
   int cubatureDegree;
 
   Teuchos::RCP<Tpetra_Vector> albanyOverlapSolutionVector;
 
+  //! Owned Albany solution last passed to setCurrentTimeAndDisplacement()
+  Teuchos::RCP<const Tpetra_Vector> albanySolutionVector;
+
+  Teuchos::RCP<Tpetra_Import> albanyOverlapImporter;
+
+  //! Peridigm and Albany overlap local ids of the sphere element nodes, rebuilt with albanyOverlapImporter.
+  std::vector<int> sphereElementPeridigmLocalIds;
+  std::vector<LO> sphereElementAlbanyLocalIds;
+
+  //! For each partial stress element, the Albany overlap local ids of its nodes and the Peridigm local ids of its material points.
+  std::vector< std::vector<LO>> partialStressAlbanyLocalIds;
+  std::vector< std::vector<int>> partialStressPeridigmLocalIds;
+
+  //! Basis functions at the cubature points, numQuadPoints x numNodes, by cell topology key.
+  std::map< unsigned, std::vector<RealType>> partialStressBasisValues;
+
+  //! Local ids into the Peridigm partial stress block data of the material points of each workset, by block name and workset index.
+  std::map< std::string, std::map< int, std::vector<int>>> worksetPartialStressLocalIds;
+
+  //! Rebuild the local id lists above for the current maps.
+  void buildLocalIdLists();
+
+  //! Basis functions of the given topology at the partial stress cubature points.
+  const std::vector<RealType>& getPartialStressBasisValues(const CellTopologyData& cellTopologyData);
+
   //! Constructor, private to prohibit use.
   PeridigmManager();
 
@@ -59,8 +59,7 @@ SolutionSniffer::
 runPreSolve(NOX::Solver::Generic const & solver)
 {
   if(status_test_.is_null() == false){
-    status_test_->status_ = NOX::StatusTest::Unevaluated;
-    status_test_->status_message_ = "";
+    status_test_->reset();
   }
 
   NOX::Abstract::Vector const &
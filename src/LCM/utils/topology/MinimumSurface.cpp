@@ -18,6 +18,8 @@
 #include <cmath>
 #include <string>
 #include <sstream>
+#include <set>
+#include <limits>
 
 #include <boost/config.hpp>
 #include <boost/graph/graph_traits.hpp>
@@ -39,60 +41,11 @@ namespace LCM {
 std::vector<stk::mesh::Entity> Topology::getClosestNodes(
     std::vector<std::vector<double>> points)
 {
-  std::vector<stk::mesh::Entity> closestNodes;
-  stk::mesh::Entity nodeA;
-  stk::mesh::Entity nodeB;
-  stk::mesh::Entity nodeC;
-  std::vector<double> pointA, pointB, pointC;
-  double minDA, minDB, minDC;
-
   std::vector<stk::mesh::Entity> entities_D0 = getEntitiesByRank(
       get_bulk_data(),
       stk::topology::NODE_RANK); // get all the nodes
 
-  // iterator for the nodes
-  std::vector<stk::mesh::Entity>::const_iterator i_entities_d0;
-
-  // Before iterate, it is necessary to have a distance with which it
-  // is possible to compare the new distances to.
-  nodeA = entities_D0[0];
-  minDA = getDistanceNodeAndPoint(entities_D0[0], points[0]);
-
-  nodeB = entities_D0[0];
-  minDB = getDistanceNodeAndPoint(entities_D0[0], points[1]);
-
-  nodeC = entities_D0[0];
-  minDC = getDistanceNodeAndPoint(entities_D0[0], points[2]);
-
-  // For each of the nodes calculate distance from point1, point 2,
-  // point 3 if any distance is less than the min distance to that
-  // point update the min distance and the closest node for that point
-  for (i_entities_d0 = entities_D0.begin(); i_entities_d0 != entities_D0.end();
-      ++i_entities_d0) {
-    // adist is the distance between the current node and the first
-    // point, point A.
-    double aDist = getDistanceNodeAndPoint(*i_entities_d0, points[0]);
-    if (aDist < minDA) {
-      nodeA = *i_entities_d0;
-      minDA = aDist;
-    }
-
-    double bDist = getDistanceNodeAndPoint(*i_entities_d0, points[1]);
-    if (bDist < minDB) {
-      nodeB = *i_entities_d0;
-      minDB = bDist;
-    }
-
-    double cDist = getDistanceNodeAndPoint(*i_entities_d0, points[2]);
-    if (cDist < minDC) {
-      nodeC = *i_entities_d0;
-      minDC = cDist;
-    }
-  }
-  closestNodes.push_back(nodeA);
-  closestNodes.push_back(nodeB);
-  closestNodes.push_back(nodeC);
-  return closestNodes;
+  return getClosestNodesAmong(entities_D0, points);
 }
 
 //
@@ -105,108 +58,57 @@ std::vector<stk::mesh::Entity> Topology::getClosestNodesOnSurface(
 {
 
   // Obtain all the nodes that lie over the surface
-  // Obtain all the faces of the mesh
-  std::vector<stk::mesh::Entity> MeshFaces = getEntitiesByRank(
-      get_bulk_data(),
-      stk::topology::FACE_RANK);
-
-  // Find the faces (Entities of rank 2) that build the boundary of
-  // the given mesh
-  std::vector<stk::mesh::Entity> BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_faces;
-  for (I_faces = MeshFaces.begin(); I_faces != MeshFaces.end(); I_faces++) {
-    std::vector<stk::mesh::Entity> temp;
-    temp = getDirectlyConnectedEntities(*I_faces, stk::topology::ELEMENT_RANK);
-    // If the number of boundary entities of rank 3 is 1 then, this is
-    // a boundary face
-    if (temp.size() == 1) {
-      BoundaryFaces.push_back(*I_faces);
-    }
-  }
-
-  // Obtain the Edges that belong to the Boundary Faces delete the
-  // repeated edges
-  std::vector<stk::mesh::Entity> MeshEdges;
-  std::vector<stk::mesh::Entity>::const_iterator I_BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_Edges;
-  for (I_BoundaryFaces = BoundaryFaces.begin();
-      I_BoundaryFaces != BoundaryFaces.end(); I_BoundaryFaces++) {
-    std::vector<stk::mesh::Entity> boundaryEdges = getDirectlyConnectedEntities(
-        *I_BoundaryFaces,
-        stk::topology::EDGE_RANK);
-    for (I_Edges = boundaryEdges.begin(); I_Edges != boundaryEdges.end();
-        I_Edges++) {
-      if (findEntityInVector(MeshEdges, *I_Edges) == false) {
-        MeshEdges.push_back(*I_Edges);
-      }
-    }
-  }
+  //Obtain the edges that lie on the outer surface of the mesh
+  std::vector<stk::mesh::Entity> MeshEdges = meshEdgesShortestPath();
 
   // Obtain the nodes that lie on the surface
   // This vector contains all the nodes that lie on the surface
   std::vector<stk::mesh::Entity> entities_D0;
+  std::set<stk::mesh::Entity> foundNodes;
   for (unsigned int i = 0; i < MeshEdges.size(); ++i) {
     std::vector<stk::mesh::Entity> EdgeBoundaryNodes;
     EdgeBoundaryNodes = getDirectlyConnectedEntities(
         MeshEdges[i],
         stk::topology::NODE_RANK);
     for (unsigned int i = 0; i < EdgeBoundaryNodes.size(); i++) {
-      if (findEntityInVector(entities_D0, EdgeBoundaryNodes[i]) == false) {
+      if (foundNodes.insert(EdgeBoundaryNodes[i]).second == true) {
         entities_D0.push_back(EdgeBoundaryNodes[i]);
       }
     }
   }
 
-  std::vector<stk::mesh::Entity> closestNodes;
-  stk::mesh::Entity nodeA;
-  stk::mesh::Entity nodeB;
-  stk::mesh::Entity nodeC;
-  std::vector<double> pointA, pointB, pointC;
-  double minDA, minDB, minDC;
-
-  //iterator for the nodes
-  std::vector<stk::mesh::Entity>::const_iterator i_entities_d0;
-
-  // Before iterate, it is necessary to have a distance with which it
-  // is possible to compare the new distances to.
-  nodeA = entities_D0[0];
-  minDA = getDistanceNodeAndPoint(entities_D0[0], points[0]);
-
-  nodeB = entities_D0[0];
-  minDB = getDistanceNodeAndPoint(entities_D0[0], points[1]);
-
-  nodeC = entities_D0[0];
-  minDC = getDistanceNodeAndPoint(entities_D0[0], points[2]);
-
-  //For each of the nodes
-  //calculate distance from point1, point 2, point 3
-  //if any distance is less than the min distance to that point
-  //update the min distance and the closest node for that point
-  for (i_entities_d0 = entities_D0.begin(); i_entities_d0 != entities_D0.end();
-      ++i_entities_d0) {
-    //adist is the distance between the current node and the first
-    //point, point A.
-    double aDist = getDistanceNodeAndPoint(*i_entities_d0, points[0]);
-    if (aDist < minDA) {
-      nodeA = *i_entities_d0;
-      minDA = aDist;
-    }
-
-    double bDist = getDistanceNodeAndPoint(*i_entities_d0, points[1]);
-    if (bDist < minDB) {
-      nodeB = *i_entities_d0;
-      minDB = bDist;
-    }
+  return getClosestNodesAmong(entities_D0, points);
+}
 
-    double cDist = getDistanceNodeAndPoint(*i_entities_d0, points[2]);
-    if (cDist < minDC) {
-      nodeC = *i_entities_d0;
-      minDC = cDist;
+//
+// \brief Finds, for each point, the closest of the candidate nodes.
+//        The coordinates of each candidate are read once for all the
+//        points, and squared distances are compared. Ties go to the
+//        first candidate.
+//
+std::vector<stk::mesh::Entity> Topology::getClosestNodesAmong(
+    std::vector<stk::mesh::Entity> const & nodes,
+    std::vector<std::vector<double>> const & points)
+{
+  std::vector<stk::mesh::Entity> closestNodes(points.size(), nodes[0]);
+  std::vector<double> minDistances(
+      points.size(),
+      std::numeric_limits<double>::max());
+
+  for (std::vector<stk::mesh::Entity>::const_iterator i_nodes = nodes.begin();
+      i_nodes != nodes.end(); ++i_nodes) {
+    double const * const xyz = getEntityCoordinates(*i_nodes);
+    for (unsigned int i = 0; i < points.size(); ++i) {
+      double const x_dist = points[i][0] - xyz[0];
+      double const y_dist = points[i][1] - xyz[1];
+      double const z_dist = points[i][2] - xyz[2];
+      double const dist = x_dist * x_dist + y_dist * y_dist + z_dist * z_dist;
+      if (dist < minDistances[i]) {
+        closestNodes[i] = *i_nodes;
+        minDistances[i] = dist;
+      }
     }
   }
-  closestNodes.push_back(nodeA);
-  closestNodes.push_back(nodeB);
-  closestNodes.push_back(nodeC);
 
   return closestNodes;
 }
@@ -541,7 +443,9 @@ std::vector<stk::mesh::Entity> Topology::meshEdgesShortestPath()
 
   //Obtain the Edges that belong to the Boundary Faces
   //delete the repeated edges
+  //(a set keeps the lookup of the already found edges logarithmic)
   std::vector<stk::mesh::Entity> MeshEdges;
+  std::set<stk::mesh::Entity> foundEdges;
   std::vector<stk::mesh::Entity>::const_iterator I_BoundaryFaces;
   std::vector<stk::mesh::Entity>::const_iterator I_Edges;
   for (I_BoundaryFaces = BoundaryFaces.begin();
@@ -551,7 +455,7 @@ std::vector<stk::mesh::Entity> Topology::meshEdgesShortestPath()
         stk::topology::EDGE_RANK);
     for (I_Edges = boundaryEdges.begin(); I_Edges != boundaryEdges.end();
         I_Edges++) {
-      if (findEntityInVector(MeshEdges, *I_Edges) == false) {
+      if (foundEdges.insert(*I_Edges).second == true) {
         MeshEdges.push_back(*I_Edges);
       }
     }
@@ -757,42 +661,8 @@ std::vector<std::vector<int>> Topology::shortestpath(
   //Define the input graph
   Graph g;
 
-  //Obtain all the faces of the mesh
-  std::vector<stk::mesh::Entity> MeshFaces = getEntitiesByRank(
-      get_bulk_data(),
-      stk::topology::FACE_RANK);
-
-  //Find the faces (Entities of rank 2) that build the boundary of the
-  //given mesh
-  std::vector<stk::mesh::Entity> BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_faces;
-  for (I_faces = MeshFaces.begin(); I_faces != MeshFaces.end(); I_faces++) {
-    std::vector<stk::mesh::Entity> temp;
-    temp = getDirectlyConnectedEntities(*I_faces, stk::topology::ELEMENT_RANK);
-    //If the number of boundary entities of rank 3 is 1
-    //then, this is a boundary face
-    if (temp.size() == 1) {
-      BoundaryFaces.push_back(*I_faces);
-    }
-  }
-
-  //Obtain the Edges that belong to the Boundary Faces
-  //delete the repeated edges
-  std::vector<stk::mesh::Entity> MeshEdges;
-  std::vector<stk::mesh::Entity>::const_iterator I_BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_Edges;
-  for (I_BoundaryFaces = BoundaryFaces.begin();
-      I_BoundaryFaces != BoundaryFaces.end(); I_BoundaryFaces++) {
-    std::vector<stk::mesh::Entity> boundaryEdges = getDirectlyConnectedEntities(
-        *I_BoundaryFaces,
-        stk::topology::EDGE_RANK);
-    for (I_Edges = boundaryEdges.begin(); I_Edges != boundaryEdges.end();
-        I_Edges++) {
-      if (findEntityInVector(MeshEdges, *I_Edges) == false) {
-        MeshEdges.push_back(*I_Edges);
-      }
-    }
-  }
+  //Obtain the edges that lie on the outer surface of the mesh
+  std::vector<stk::mesh::Entity> MeshEdges = meshEdgesShortestPath();
 
   //Add the edges weights to the graph
   for (unsigned int i = 0; i < MeshEdges.size(); ++i) {
@@ -980,42 +850,8 @@ std::vector<std::vector<int>> Topology::edgesDirections()
 std::vector<std::vector<int>> Topology::edgesDirectionsOuterSurface()
 {
 
-  //Obtain all the faces of the mesh
-  std::vector<stk::mesh::Entity> MeshFaces = getEntitiesByRank(
-      get_bulk_data(),
-      stk::topology::FACE_RANK);
-
-  //Find the faces (Entities of rank 2) that build the boundary of the
-  //given mesh
-  std::vector<stk::mesh::Entity> BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_faces;
-  for (I_faces = MeshFaces.begin(); I_faces != MeshFaces.end(); I_faces++) {
-    std::vector<stk::mesh::Entity> temp;
-    temp = getDirectlyConnectedEntities(*I_faces, stk::topology::ELEMENT_RANK);
-    //If the number of boundary entities of rank 3 is 1
-    //then, this is a boundary face
-    if (temp.size() == 1) {
-      BoundaryFaces.push_back(*I_faces);
-    }
-  }
-
-  //Obtain the Edges that belong to the Boundary Faces
-  //delete the repeated edges
-  std::vector<stk::mesh::Entity> setOfEdges;
-  std::vector<stk::mesh::Entity>::const_iterator I_BoundaryFaces;
-  std::vector<stk::mesh::Entity>::const_iterator I_Edges;
-  for (I_BoundaryFaces = BoundaryFaces.begin();
-      I_BoundaryFaces != BoundaryFaces.end(); I_BoundaryFaces++) {
-    std::vector<stk::mesh::Entity> boundaryEdges = getDirectlyConnectedEntities(
-        *I_BoundaryFaces,
-        stk::topology::EDGE_RANK);
-    for (I_Edges = boundaryEdges.begin(); I_Edges != boundaryEdges.end();
-        I_Edges++) {
-      if (findEntityInVector(setOfEdges, *I_Edges) == false) {
-        setOfEdges.push_back(*I_Edges);
-      }
-    }
-  }
+  //Obtain the edges that lie on the outer surface of the mesh
+  std::vector<stk::mesh::Entity> setOfEdges = meshEdgesShortestPath();
 
   //Create a map that assigns new numbering to the Edges
   std::map<stk::mesh::Entity, int> edge_map;
@@ -3,6 +3,8 @@
 //    This Software is released under the BSD license detailed     //
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
+#include <algorithm>
+
 #include <boost/foreach.hpp>
 
 #include "stk_mesh/base/FEMHelpers.hpp"
@@ -996,7 +998,34 @@ Topology::splitOpenFaces()
   stk::mesh::BucketVector const &
   point_buckets = bulk_data.buckets(stk::topology::NODE_RANK);
 
-  stk::mesh::get_selected_entities(local_bulk, point_buckets, points);
+  if (open_points_.empty() == true) {
+    stk::mesh::get_selected_entities(local_bulk, point_buckets, points);
+  } else {
+    // Only the points opened through set_fracture_state can be open,
+    // visit them in the same (bucket) order as the full scan.
+    for (std::set<stk::mesh::Entity>::iterator i = open_points_.begin();
+        i != open_points_.end(); ++i) {
+
+      stk::mesh::Entity
+      point = *i;
+
+      if (bulk_data.is_valid(point) == true &&
+          local_bulk(bulk_data.bucket(point)) == true) {
+        points.push_back(point);
+      }
+    }
+
+    std::sort(points.begin(), points.end(),
+        [&bulk_data](stk::mesh::Entity a, stk::mesh::Entity b) {
+          stk::mesh::Bucket const & bucket_a = bulk_data.bucket(a);
+          stk::mesh::Bucket const & bucket_b = bulk_data.bucket(b);
+          return bucket_a.bucket_id() != bucket_b.bucket_id() ?
+              bucket_a.bucket_id() < bucket_b.bucket_id() :
+              bulk_data.bucket_ordinal(a) < bulk_data.bucket_ordinal(b);
+        });
+  }
+
+  open_points_.clear();
 
   // Collect open points
   for (stk::mesh::EntityVector::iterator i = points.begin(); i != points.end();
@@ -1398,6 +1427,8 @@ Topology::setEntitiesOpen()
   size_t
   counter = 0;
 
+  fracture_criterion_->prepare(get_bulk_data());
+
   // Iterate over the boundary entities
   for (EntityVectorIndex i = 0; i < boundary_entities.size(); ++i) {
 
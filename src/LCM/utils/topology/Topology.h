@@ -397,6 +397,15 @@ public:
   std::vector<stk::mesh::Entity>
   getClosestNodesOnSurface(std::vector<std::vector<double>> points);
 
+  ///
+  /// \brief Finds, for each point, the closest node among the
+  ///        given candidate nodes
+  ///
+  std::vector<stk::mesh::Entity>
+  getClosestNodesAmong(
+      std::vector<stk::mesh::Entity> const & nodes,
+      std::vector<std::vector<double>> const & points);
+
   ///
   /// \brief calculates the distance between a node and a point
   ///
@@ -783,6 +792,9 @@ public:
       *(stk::mesh::field_data(get_fracture_state_field(rank), e)) =
           static_cast<int>(fs);
     }
+    if (rank == stk::topology::NODE_RANK && fs == OPEN) {
+      open_points_.insert(e);
+    }
   }
 
   //
@@ -895,6 +907,11 @@ private:
   std::set<EntityPair>
   fractured_faces_;
 
+  /// Points opened since the last splitOpenFaces, so that it does not
+  /// have to scan all the points of the mesh
+  std::set<stk::mesh::Entity>
+  open_points_;
+
   std::vector<stk::topology>
   topologies_;
 
@@ -69,6 +69,13 @@ FractureCriterionTraction::check(
 
   if (is_embedded == false) return false;
 
+  bool const
+  is_candidate =
+      candidates_.count(bulk_data.identifier(element_0)) > 0 ||
+      candidates_.count(bulk_data.identifier(element_1)) > 0;
+
+  if (is_candidate == false) return false;
+
   // Now traction check
   stk::mesh::EntityVector
   nodes = get_topology().getBoundaryEntityNodes(interface);
@@ -132,6 +139,73 @@ FractureCriterionTraction::check(
   return effective_traction >= critical_traction_;
 }
 
+//
+// The effective traction on a face is bounded by max(1, 1/beta) times
+// the norm of the face stress, which is the average of its nodal
+// stresses. The Frobenius norm of the nodal stresses of an element then
+// bounds the effective traction on all its faces.
+//
+void
+FractureCriterionTraction::prepare(stk::mesh::BulkData & bulk_data)
+{
+  double const
+  scale = std::max(1.0, 1.0 / beta_);
+
+  double const
+  critical_norm2 =
+      (critical_traction_ / scale) * (critical_traction_ / scale);
+
+  minitensor::Index const
+  num_components = get_space_dimension() * get_space_dimension();
+
+  stk::mesh::Selector
+  bulk_selector = get_bulk_part();
+
+  stk::mesh::BucketVector const &
+  buckets = bulk_data.get_buckets(stk::topology::ELEMENT_RANK, bulk_selector);
+
+  for (size_t b = 0; b < buckets.size(); ++b) {
+
+    stk::mesh::Bucket const &
+    bucket = *buckets[b];
+
+    for (size_t e = 0; e < bucket.size(); ++e) {
+
+      stk::mesh::Entity
+      element = bucket[e];
+
+      stk::mesh::EntityId const
+      element_id = bulk_data.identifier(element);
+
+      if (candidates_.count(element_id) > 0) continue;
+
+      stk::mesh::Entity const *
+      nodes = bulk_data.begin_nodes(element);
+
+      size_t const
+      number_nodes = bulk_data.num_nodes(element);
+
+      for (size_t i = 0; i < number_nodes; ++i) {
+
+        double const * const
+        pstress = stk::mesh::field_data(*stress_field_, nodes[i]);
+
+        double
+        norm2 = 0.0;
+
+        for (minitensor::Index k = 0; k < num_components; ++k) {
+          norm2 += pstress[k] * pstress[k];
+        }
+
+        if (norm2 >= critical_norm2) {
+          candidates_.insert(element_id);
+          break;
+        }
+      }
+    }
+  }
+}
+
 minitensor::Vector<double> const &
 FractureCriterionTraction::getNormal(stk::mesh::EntityId const entity_id)
 {
@@ -13,6 +13,7 @@
 #define LCM_Topology_FractureCriterion_h
 
 #include <cassert>
+#include <set>
 
 #include <stk_mesh/base/FieldBase.hpp>
 
@@ -51,6 +52,16 @@ public:
   bool
   check(stk::mesh::BulkData & mesh, stk::mesh::Entity interface) = 0;
 
+  ///
+  /// Called once before the interfaces are checked. Criteria that can
+  /// rule out whole elements cheaply do it here.
+  ///
+  virtual
+  void
+  prepare(stk::mesh::BulkData & mesh)
+  {
+  }
+
   virtual
   ~AbstractFractureCriterion()
   {
@@ -249,6 +260,9 @@ public:
   bool
   check(stk::mesh::BulkData & bulk_data, stk::mesh::Entity interface);
 
+  void
+  prepare(stk::mesh::BulkData & bulk_data);
+
 private:
 
   FractureCriterionTraction();
@@ -274,6 +288,14 @@ private:
 
   std::map<stk::mesh::EntityId, minitensor::Vector<double>>
   normals_;
+
+  ///
+  /// Elements whose nodal stresses may reach the critical traction.
+  /// Only interfaces next to one of them get the full check. Elements
+  /// stay candidates once they have been one.
+  ///
+  std::set<stk::mesh::EntityId>
+  candidates_;
 };
 
 } // namespace LCM
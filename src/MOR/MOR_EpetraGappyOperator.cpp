@@ -0,0 +1,177 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include "MOR_EpetraGappyOperator.hpp"
+
+#include "Epetra_MultiVector.h"
+#include "Epetra_Comm.h"
+#include "Epetra_SerialDenseSolver.h"
+
+#include "Teuchos_Assert.hpp"
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_TypeNameTraits.hpp"
+
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+
+namespace MOR {
+
+using ::Teuchos::Array;
+using ::Teuchos::ArrayView;
+
+EpetraGappyOperator::EpetraGappyOperator(
+    const Epetra_Map &map,
+    const ArrayView<const GlobalIndex> &sampleLIDs,
+    const Epetra_MultiVector &residualBasis) :
+  map_(map),
+  sampleLIDs_(sampleLIDs),
+  basisSize_(residualBasis.NumVectors()),
+  weights_(residualBasis.NumVectors(), residualBasis.NumVectors()),
+  useTranspose_(false)
+{
+  TEUCHOS_ASSERT(map_.PointSameAs(residualBasis.Map()));
+  std::sort(sampleLIDs_.begin(), sampleLIDs_.end());
+
+  const int sampleCount = sampleLIDs_.size();
+  sampledBasis_.resize(sampleCount * basisSize_);
+  for (int s = 0; s < sampleCount; ++s) {
+    for (int j = 0; j < basisSize_; ++j) {
+      sampledBasis_[s * basisSize_ + j] = residualBasis[j][sampleLIDs_[s]];
+    }
+  }
+
+  // Gram matrix (S * U)^T * (S * U) of the sampled residual basis
+  Array<double> localGram(basisSize_ * basisSize_, 0.0), gram(basisSize_ * basisSize_);
+  for (int s = 0; s < sampleCount; ++s) {
+    const double *row = &sampledBasis_[s * basisSize_];
+    for (int i = 0; i < basisSize_; ++i) {
+      for (int j = 0; j < basisSize_; ++j) {
+        localGram[i + j * basisSize_] += row[i] * row[j];
+      }
+    }
+  }
+  if (basisSize_ > 0) {
+    map_.Comm().SumAll(localGram.getRawPtr(), gram.getRawPtr(), basisSize_ * basisSize_);
+  }
+
+  Epetra_SerialDenseMatrix gramInverse(Copy, gram.getRawPtr(), basisSize_, basisSize_, basisSize_);
+  if (basisSize_ > 0) {
+    Epetra_SerialDenseSolver solver;
+    {
+      const int ierr = solver.SetMatrix(gramInverse);
+      TEUCHOS_ASSERT(ierr == 0);
+    }
+    {
+      const int ierr = solver.Invert();
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          ierr != 0,
+          std::runtime_error,
+          "Sampled residual basis is rank-deficient, more samples than the " << basisSize_ << " residual basis vectors are needed");
+    }
+    const int ierr = weights_.Multiply('N', 'N', 1.0, gramInverse, gramInverse, 0.0);
+    TEUCHOS_ASSERT(ierr == 0);
+  }
+}
+
+const char *EpetraGappyOperator::Label() const
+{
+  static const std::string label = Teuchos::TypeNameTraits<EpetraGappyOperator>::name();
+  return label.c_str();
+}
+
+const Epetra_Map &EpetraGappyOperator::OperatorDomainMap() const
+{
+  return map_;
+}
+
+const Epetra_Map &EpetraGappyOperator::OperatorRangeMap() const
+{
+  return map_;
+}
+
+const Epetra_Comm &EpetraGappyOperator::Comm() const
+{
+  return map_.Comm();
+}
+
+int EpetraGappyOperator::SetUseTranspose(bool UseTranspose)
+{
+  // Symmetric operator
+  useTranspose_ = UseTranspose;
+  return 0;
+}
+
+bool EpetraGappyOperator::UseTranspose() const
+{
+  return useTranspose_;
+}
+
+int EpetraGappyOperator::Apply(const Epetra_MultiVector &X, Epetra_MultiVector &Y) const
+{
+  TEUCHOS_ASSERT(map_.PointSameAs(X.Map()) && map_.PointSameAs(Y.Map()));
+  TEUCHOS_ASSERT(X.NumVectors() == Y.NumVectors());
+
+  const int vectorCount = X.NumVectors();
+  const int sampleCount = sampleLIDs_.size();
+
+  // 1) components <- (S * U)^T * X, touching only the sampled entries
+  Array<double> localComponents(basisSize_ * vectorCount, 0.0), components(basisSize_ * vectorCount);
+  for (int v = 0; v < vectorCount; ++v) {
+    for (int s = 0; s < sampleCount; ++s) {
+      const double x = X[v][sampleLIDs_[s]];
+      const double *row = &sampledBasis_[s * basisSize_];
+      for (int j = 0; j < basisSize_; ++j) {
+        localComponents[j + v * basisSize_] += row[j] * x;
+      }
+    }
+  }
+  if (basisSize_ * vectorCount > 0) {
+    this->Comm().SumAll(localComponents.getRawPtr(), components.getRawPtr(), basisSize_ * vectorCount);
+  }
+
+  // 2) components <- ((S * U)^T * (S * U))^{-2} * components
+  Array<double> weighted(basisSize_ * vectorCount, 0.0);
+  for (int v = 0; v < vectorCount; ++v) {
+    for (int j = 0; j < basisSize_; ++j) {
+      for (int i = 0; i < basisSize_; ++i) {
+        weighted[i + v * basisSize_] += weights_(i, j) * components[j + v * basisSize_];
+      }
+    }
+  }
+
+  // 3) Y <- (S * U) * components
+  Y.PutScalar(0.0);
+  for (int v = 0; v < vectorCount; ++v) {
+    for (int s = 0; s < sampleCount; ++s) {
+      const double *row = &sampledBasis_[s * basisSize_];
+      double y = 0.0;
+      for (int j = 0; j < basisSize_; ++j) {
+        y += row[j] * weighted[j + v * basisSize_];
+      }
+      Y[v][sampleLIDs_[s]] = y;
+    }
+  }
+
+  return 0;
+}
+
+int EpetraGappyOperator::ApplyInverse(const Epetra_MultiVector &X, Epetra_MultiVector &Y) const
+{
+  // Not supported (rank-deficient operator)
+  return -1;
+}
+
+bool EpetraGappyOperator::HasNormInf() const
+{
+  return false;
+}
+
+double EpetraGappyOperator::NormInf() const
+{
+  return -1.0;
+}
+
+} // namespace MOR
@@ -0,0 +1,68 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#ifndef MOR_EPETRAGAPPYOPERATOR_HPP
+#define MOR_EPETRAGAPPYOPERATOR_HPP
+
+#include "Epetra_Operator.h"
+#include "Epetra_Map.h"
+#include "Epetra_SerialDenseMatrix.h"
+
+#include "Teuchos_Array.hpp"
+#include "Teuchos_ArrayView.hpp"
+
+class Epetra_MultiVector;
+
+namespace MOR {
+
+// Gappy POD metric S^T * (S * U)^{+T} * (S * U)^{+} * S, where S samples the entries sampleLIDs
+// and U is the residual basis. Minimizing the residual in this metric minimizes the gappy
+// reconstruction U * (S * U)^{+} * S * r of the residual r from its sampled entries only.
+class EpetraGappyOperator : public Epetra_Operator {
+public:
+#ifndef EPETRA_NO_32BIT_GLOBAL_INDICES
+  typedef int GlobalIndex;
+#else
+  typedef long long GlobalIndex;
+#endif
+
+  EpetraGappyOperator(
+      const Epetra_Map &map,
+      const Teuchos::ArrayView<const GlobalIndex> &sampleLIDs,
+      const Epetra_MultiVector &residualBasis);
+
+  // Overriden from Epetra_Operator
+  virtual const char *Label() const;
+
+  virtual const Epetra_Map &OperatorDomainMap() const;
+  virtual const Epetra_Map &OperatorRangeMap() const;
+  virtual const Epetra_Comm &Comm() const;
+
+  virtual bool UseTranspose() const;
+  virtual int SetUseTranspose(bool UseTranspose);
+
+  virtual int Apply(const Epetra_MultiVector &X, Epetra_MultiVector &Y) const;
+  virtual int ApplyInverse(const Epetra_MultiVector &X, Epetra_MultiVector &Y) const;
+
+  virtual bool HasNormInf() const;
+  virtual double NormInf() const;
+
+private:
+  Epetra_Map map_;
+  Teuchos::Array<int> sampleLIDs_;
+
+  // Rows of the residual basis at the samples, one row after the other
+  Teuchos::Array<double> sampledBasis_;
+  int basisSize_;
+
+  // ((S * U)^T * (S * U))^{-2}
+  Epetra_SerialDenseMatrix weights_;
+
+  bool useTranspose_;
+};
+
+} // namespace MOR
+
+#endif /* MOR_EPETRAGAPPYOPERATOR_HPP */
@@ -74,6 +74,11 @@ int getSnapshotPeriod(const RCP<ParameterList> &params)
   return params->get("Period", 1);
 }
 
+int getIncrementalBasisSize(const RCP<ParameterList> &params)
+{
+  return params->get("Incremental Basis Size", 0);
+}
+
 std::string getGeneralizedCoordinatesFilename(const RCP<ParameterList> &params)
 {
   const std::string outdir = params->get("Output Directory",".");
@@ -114,7 +119,8 @@ RCP<NOX::Epetra::Observer> ObserverFactory::create(const RCP<NOX::Epetra::Observ
       const RCP<ParameterList> params = this->getSnapParameters();
       const RCP<MultiVectorOutputFile> snapOutputFile = createSnapshotOutputFile(params);
       const int period = getSnapshotPeriod(params);
-      composite->addObserver(rcp(new SnapshotCollectionObserver(period, snapOutputFile)));
+      const int incrementalBasisSize = getIncrementalBasisSize(params);
+      composite->addObserver(rcp(new SnapshotCollectionObserver(period, snapOutputFile, incrementalBasisSize)));
     }
 
     if (this->computeProjectionError()) {
@@ -165,7 +171,8 @@ RCP<Rythmos::IntegrationObserverBase<double> > ObserverFactory::create(const RCP
       const RCP<ParameterList> params = this->getSnapParameters();
       const RCP<MultiVectorOutputFile> snapOutputFile = createSnapshotOutputFile(params);
       const int period = getSnapshotPeriod(params);
-      composite->addObserver(rcp(new RythmosSnapshotCollectionObserver(period, snapOutputFile)));
+      const int incrementalBasisSize = getIncrementalBasisSize(params);
+      composite->addObserver(rcp(new RythmosSnapshotCollectionObserver(period, snapOutputFile, incrementalBasisSize)));
       ++observersInComposite;
     }
 
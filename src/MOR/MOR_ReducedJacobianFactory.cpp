@@ -62,14 +62,24 @@ const Epetra_CrsMatrix &ReducedJacobianFactory::reducedMatrix(const Epetra_Multi
   TEUCHOS_ASSERT(leftProjector.NumVectors() == rightProjector_->NumVectors());
   TEUCHOS_ASSERT(result.Filled());
 
-  Epetra_Vector rowVector(result.RangeMap(), false);
+  // All the entries leftProjector^T * premultipliedRightProjector at once: a single
+  // multivector product (GEMM) and global reduction instead of one per reduced row
+  const Epetra_LocalMap componentMap = createComponentMap(leftProjector);
+  Epetra_MultiVector product(componentMap, premultipliedRightProjector_->NumVectors(), false);
+  {
+    const int err = reduce(leftProjector, *premultipliedRightProjector_, product);
+    TEUCHOS_ASSERT(err == 0);
+  }
+
+  Array<double> rowValues(result.NumMyCols());
   for (int i = 0; i<result.NumMyRows(); i++) {
      int NumEntries; int *Indices;
      int err = reducedGraph_.ExtractMyRowView(i, NumEntries, Indices);
      TEUCHOS_ASSERT(err == 0);
-     err = reduce(*premultipliedRightProjector_, *(leftProjector)(i), rowVector);
-     TEUCHOS_ASSERT(err == 0);
-     err = result.ReplaceMyValues(i, NumEntries, rowVector.Values(), Indices);
+     for (int j = 0; j < NumEntries; j++) {
+       rowValues[j] = product[Indices[j]][i];
+     }
+     err = result.ReplaceMyValues(i, NumEntries, rowValues.getRawPtr(), Indices);
      TEUCHOS_ASSERT(err == 0);
   }
 
@@ -9,6 +9,7 @@
 
 #include "MOR_SampleDofListFactory.hpp"
 #include "MOR_EpetraSamplingOperator.hpp"
+#include "MOR_EpetraGappyOperator.hpp"
 #include "MOR_ContainerUtils.hpp"
 #include "MOR_EpetraUtils.hpp"
 #include "MOR_BasisOps.hpp"
@@ -92,7 +93,7 @@ ReducedSpaceFactory::getSamplingOperator(
     const Teuchos::RCP<Teuchos::ParameterList> hyperreductionParams = Teuchos::sublist(params, "Hyper Reduction");
     const bool useHyperreduction = hyperreductionParams->get("Activate", false);
     if (useHyperreduction) {
-      const Teuchos::Tuple<std::string, 1> allowedHyperreductionTypes = Teuchos::tuple<std::string>("Collocation");
+      const Teuchos::Tuple<std::string, 2> allowedHyperreductionTypes = Teuchos::tuple<std::string>("Collocation", "Gappy POD");
       const std::string hyperreductionType = hyperreductionParams->get("Type", allowedHyperreductionTypes[0]);
       TEUCHOS_TEST_FOR_EXCEPTION(!contains(allowedHyperreductionTypes, hyperreductionType),
           std::out_of_range,
@@ -101,6 +102,12 @@ ReducedSpaceFactory::getSamplingOperator(
         const Teuchos::RCP<Teuchos::ParameterList> collocationParams = Teuchos::sublist(hyperreductionParams, "Collocation Data");
         const Teuchos::Array<int> sampleLocalEntries = samplingFactory_->create(collocationParams);
         result = Teuchos::rcp(new EpetraSamplingOperator(stateMap, sampleLocalEntries));
+      } else if (hyperreductionType == allowedHyperreductionTypes[1]) {
+        const Teuchos::RCP<Teuchos::ParameterList> gappyParams = Teuchos::sublist(hyperreductionParams, "Gappy POD Data");
+        const Teuchos::Array<int> sampleLocalEntries = samplingFactory_->create(gappyParams);
+        const Teuchos::RCP<const Epetra_MultiVector> residualBasis =
+          basisRepository_.getBasis(Teuchos::sublist(gappyParams, "Residual Basis"));
+        result = Teuchos::rcp(new EpetraGappyOperator(stateMap, sampleLocalEntries, *residualBasis));
       } else {
         TEUCHOS_TEST_FOR_EXCEPT_MSG(true, "Should not happen");
       }
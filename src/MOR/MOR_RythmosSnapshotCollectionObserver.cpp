@@ -22,8 +22,9 @@ using ::Teuchos::ParameterList;
 
 RythmosSnapshotCollectionObserver::RythmosSnapshotCollectionObserver(
     int period,
-    Teuchos::RCP<MultiVectorOutputFile> snapshotFile) :
-  snapshotCollector_(period, snapshotFile)
+    Teuchos::RCP<MultiVectorOutputFile> snapshotFile,
+    int incrementalBasisSize) :
+  snapshotCollector_(period, snapshotFile, incrementalBasisSize)
 {
   // Nothing to do
 }
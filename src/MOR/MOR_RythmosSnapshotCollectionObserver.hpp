@@ -18,7 +18,8 @@ class RythmosSnapshotCollectionObserver : public Rythmos::IntegrationObserverBas
 public:
   RythmosSnapshotCollectionObserver(
       int period,
-      Teuchos::RCP<MultiVectorOutputFile> snapshotFile);
+      Teuchos::RCP<MultiVectorOutputFile> snapshotFile,
+      int incrementalBasisSize = 0);
 
   // Overridden
   virtual Teuchos::RCP<Rythmos::IntegrationObserverBase<double> > cloneIntegrationObserver() const;
@@ -6,29 +6,49 @@
 #include "MOR_SnapshotCollection.hpp"
 
 #include "MOR_MultiVectorOutputFile.hpp"
+#include "MOR_BasisOps.hpp"
+
+#include "Epetra_LocalMap.h"
+#include "Epetra_LAPACK.h"
 
 #include "Teuchos_TestForException.hpp"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace MOR {
 
 SnapshotCollection::SnapshotCollection(
     int period,
-    const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile) :
+    const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile,
+    int incrementalBasisSize) :
   period_(period),
   snapshotFile_(snapshotFile),
-  skipCount_(0)
+  skipCount_(0),
+  incrementalBasisSize_(incrementalBasisSize)
 {
   TEUCHOS_TEST_FOR_EXCEPTION(
       period <= 0,
       std::out_of_range,
       "period = " << period << ", should have period > 0");
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      incrementalBasisSize < 0,
+      std::out_of_range,
+      "incrementalBasisSize = " << incrementalBasisSize << ", should have incrementalBasisSize >= 0");
 }
 
 // TODO: Avoid doing real work in destructor
 SnapshotCollection::~SnapshotCollection()
 {
+  if (incrementalBasisSize_ > 0)
+  {
+    if (Teuchos::nonnull(basis_))
+    {
+      snapshotFile_->write(*basis_);
+    }
+    return;
+  }
+
   const int vectorCount = snapshots_.size();
   if (vectorCount > 0)
   {
@@ -49,7 +69,14 @@ void SnapshotCollection::addVector(double stamp, const Epetra_Vector &value)
   if (skipCount_ == 0)
   {
     stamps_.push_back(stamp);
-    snapshots_.push_back(value);
+    if (incrementalBasisSize_ > 0)
+    {
+      this->updateBasis(value);
+    }
+    else
+    {
+      snapshots_.push_back(value);
+    }
     skipCount_ = period_ - 1;
   }
   else
@@ -58,4 +85,108 @@ void SnapshotCollection::addVector(double stamp, const Epetra_Vector &value)
   }
 }
 
+// Rank-one update of the thin SVD U * diag(s) of the snapshots collected so far (Brand, 2002).
+// Only the left singular vectors and the singular values are kept, truncated to incrementalBasisSize_.
+void SnapshotCollection::updateBasis(const Epetra_Vector &value)
+{
+  const int rank = singularValues_.size();
+
+  // 1) value = U * components + remainder, orthogonalized twice to keep U orthonormal
+  Epetra_Vector remainder(value);
+  Teuchos::Array<double> components(rank, 0.0);
+  if (rank > 0)
+  {
+    const Epetra_LocalMap componentMap(rank, 0, value.Comm());
+    Epetra_Vector product(componentMap, false);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+      {
+        const int ierr = reduce(*basis_, remainder, product);
+        TEUCHOS_TEST_FOR_EXCEPT(ierr != 0);
+      }
+      {
+        const int ierr = expandAdd(*basis_, product, -1.0, remainder);
+        TEUCHOS_TEST_FOR_EXCEPT(ierr != 0);
+      }
+      for (int i = 0; i < rank; ++i)
+      {
+        components[i] += product[i];
+      }
+    }
+  }
+
+  double valueNorm, remainderNorm;
+  value.Norm2(&valueNorm);
+  remainder.Norm2(&remainderNorm);
+  const double tolerance = 1.0e-12 * std::max(valueNorm, rank > 0 ? singularValues_[0] : 0.0);
+  const bool extend = remainderNorm > tolerance;
+  const int coreRows = rank + (extend ? 1 : 0);
+  if (coreRows == 0)
+  {
+    return;
+  }
+
+  // 2) SVD of the core matrix [diag(s), components; 0, |remainder|]
+  const int coreCols = rank + 1;
+  Teuchos::Array<double> core(coreRows * coreCols, 0.0);
+  for (int i = 0; i < rank; ++i)
+  {
+    core[i + i * coreRows] = singularValues_[i];
+    core[i + rank * coreRows] = components[i];
+  }
+  if (extend)
+  {
+    core[rank + rank * coreRows] = remainderNorm;
+  }
+
+  Teuchos::Array<double> coreSingularValues(coreRows);
+  Teuchos::Array<double> coreLeftVectors(coreRows * coreRows);
+  double coreRightVectors = 0.0; // Not referenced
+  int lwork = 5 * (coreRows + coreCols);
+  Teuchos::Array<double> work(lwork);
+  int info = 0;
+  const Epetra_LAPACK lapack;
+  lapack.GESVD('A', 'N', coreRows, coreCols, core.getRawPtr(), coreRows,
+      coreSingularValues.getRawPtr(), coreLeftVectors.getRawPtr(), coreRows,
+      &coreRightVectors, 1, work.getRawPtr(), &lwork, &info);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      info != 0,
+      std::runtime_error,
+      "Incremental snapshot SVD failed, GESVD info = " << info);
+
+  int newRank = std::min(coreRows, incrementalBasisSize_);
+  while (newRank > 1 && coreSingularValues[newRank - 1] <= 1.0e-12 * coreSingularValues[0])
+  {
+    --newRank;
+  }
+
+  // 3) U <- [U, remainder / |remainder|] * (leading left singular vectors of the core matrix)
+  Epetra_MultiVector augmentedBasis(value.Map(), coreRows, false);
+  for (int i = 0; i < rank; ++i)
+  {
+    *augmentedBasis(i) = *(*basis_)(i);
+  }
+  if (extend)
+  {
+    augmentedBasis(rank)->Scale(1.0 / remainderNorm, remainder);
+  }
+
+  const Epetra_LocalMap coreMap(coreRows, 0, value.Comm());
+  Epetra_MultiVector rotation(coreMap, newRank, false);
+  for (int j = 0; j < newRank; ++j)
+  {
+    for (int i = 0; i < coreRows; ++i)
+    {
+      rotation[j][i] = coreLeftVectors[i + j * coreRows];
+    }
+  }
+
+  basis_ = Teuchos::rcp(new Epetra_MultiVector(value.Map(), newRank, false));
+  {
+    const int ierr = expand(augmentedBasis, rotation, *basis_);
+    TEUCHOS_TEST_FOR_EXCEPT(ierr != 0);
+  }
+  singularValues_.assign(coreSingularValues.begin(), coreSingularValues.begin() + newRank);
+}
+
 } // namespace MOR
@@ -7,8 +7,10 @@
 #define MOR_SNAPSHOTCOLLECTION_HPP
 
 #include "Epetra_Vector.h"
+#include "Epetra_MultiVector.h"
 
 #include "Teuchos_RCP.hpp"
+#include "Teuchos_Array.hpp"
 
 #include <deque>
 
@@ -16,11 +18,16 @@ namespace MOR {
 
 class MultiVectorOutputFile;
 
+// Collects every period-th snapshot and writes them to snapshotFile on destruction.
+// When incrementalBasisSize > 0, the snapshots are not kept: instead, a truncated POD basis
+// of at most incrementalBasisSize vectors is updated as each snapshot arrives (incremental SVD)
+// and written in place of the snapshots.
 class SnapshotCollection {
 public:
   SnapshotCollection(
       int period,
-      const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile);
+      const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile,
+      int incrementalBasisSize = 0);
 
   ~SnapshotCollection();
   void addVector(double stamp, const Epetra_Vector &value);
@@ -33,6 +40,12 @@ private:
   std::deque<double> stamps_;
   std::deque<Epetra_Vector> snapshots_;
 
+  int incrementalBasisSize_;
+  Teuchos::RCP<Epetra_MultiVector> basis_;
+  Teuchos::Array<double> singularValues_;
+
+  void updateBasis(const Epetra_Vector &value);
+
   // Disallow copy and assignment
   SnapshotCollection(const SnapshotCollection &);
   SnapshotCollection &operator=(const SnapshotCollection &);
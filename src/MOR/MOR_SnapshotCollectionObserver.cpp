@@ -9,8 +9,9 @@ namespace MOR {
 
 SnapshotCollectionObserver::SnapshotCollectionObserver(
     int period,
-    const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile) :
-  snapshotCollector_(period, snapshotFile)
+    const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile,
+    int incrementalBasisSize) :
+  snapshotCollector_(period, snapshotFile, incrementalBasisSize)
 {
    // Nothing to do
 }
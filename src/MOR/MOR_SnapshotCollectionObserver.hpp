@@ -21,7 +21,8 @@ class SnapshotCollectionObserver : public NOX::Epetra::Observer
 public:
   SnapshotCollectionObserver(
       int period,
-      const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile);
+      const Teuchos::RCP<MultiVectorOutputFile> &snapshotFile,
+      int incrementalBasisSize = 0);
 
   virtual void observeSolution(const Epetra_Vector& solution);
   virtual void observeSolution(const Epetra_Vector& solution, double time_or_param_val);
@@ -0,0 +1,308 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// Times individual evaluators on a synthetic workset, for Residual and
+// Jacobian. The inputs of each evaluator are filled once, then only the
+// evaluator itself is run and timed. Prints cells/s and the bandwidth
+// implied by the fields the evaluator reads and writes, and writes the
+// same numbers as JSON.
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "Teuchos_CommandLineProcessor.hpp"
+#include "Teuchos_GlobalMPISession.hpp"
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_VerboseObject.hpp"
+
+#include "Phalanx_DataLayout.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_FieldManager.hpp"
+#include "Phalanx_MDField.hpp"
+#include "Shards_CellTopology.hpp"
+
+#include "Albany_EvaluatorUtils.hpp"
+#include "Albany_Layouts.hpp"
+#include "Albany_ProblemUtils.hpp"
+#include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_Workset.hpp"
+
+namespace {
+
+typedef PHAL::AlbanyTraits Traits;
+
+//! Fills a field with untimed synthetic data, repeating pattern over the
+//! flattened field. FAD values are seeded with one derivative each.
+template<typename EvalT, typename ValueT>
+class FillField :
+  public PHX::EvaluatorWithBaseImpl<Traits>,
+  public PHX::EvaluatorDerived<EvalT, Traits> {
+
+public:
+
+  FillField(const std::string& name,
+            const Teuchos::RCP<PHX::DataLayout>& dl,
+            const std::vector<RealType>& pattern,
+            const int fadSize) :
+    field(name, dl),
+    pattern(pattern),
+    fadSize(fadSize)
+  {
+    this->addEvaluatedField(field);
+    this->setName("Fill " + name);
+  }
+
+  void postRegistrationSetup(typename Traits::SetupData d,
+                             PHX::FieldManager<Traits>& fm)
+  {
+    this->utils.setFieldData(field, fm);
+  }
+
+  void evaluateFields(typename Traits::EvalData workset)
+  {
+    for (std::size_t i=0; i < field.size(); ++i)
+      fill(field[i], pattern[i % pattern.size()], i);
+  }
+
+private:
+
+  void fill(RealType& v, const RealType value, const std::size_t i) const
+  {
+    v = value;
+  }
+
+  template<typename FadT>
+  void fill(FadT& v, const RealType value, const std::size_t i) const
+  {
+    v = FadT(fadSize, value);
+    v.fastAccessDx(i % fadSize) = 1.0;
+  }
+
+  PHX::MDField<ValueT> field;
+  const std::vector<RealType> pattern;
+  const int fadSize;
+};
+
+struct Result {
+  std::string evaluator;
+  std::string evalType;
+  double seconds;
+  double cellsPerSecond;
+  double gbPerSecond;
+};
+
+//! Bytes of the dependent and evaluated fields of ev, for one workset
+double fieldBytes(const PHX::Evaluator<Traits>& ev, const int fadSize)
+{
+  double bytes = 0;
+  const std::vector<Teuchos::RCP<PHX::FieldTag> >* lists[2] =
+    {&ev.dependentFields(), &ev.evaluatedFields()};
+  for (int l=0; l < 2; ++l)
+    for (std::size_t f=0; f < lists[l]->size(); ++f) {
+      const PHX::FieldTag& tag = *(*lists[l])[f];
+      const bool real = tag.dataTypeInfo() == typeid(RealType);
+      bytes += tag.dataLayout().size() *
+        (real ? sizeof(RealType) : (1 + fadSize) * sizeof(RealType));
+    }
+  return bytes;
+}
+
+template<typename EvalT>
+void benchmark(const std::string& evalType,
+               const Teuchos::RCP<shards::CellTopology>& cellType,
+               const int worksetSize,
+               const int cubatureDegree,
+               const int fadSize,
+               const int repetitions,
+               std::vector<Result>& results)
+{
+  typedef typename EvalT::ScalarT ScalarT;
+  typedef typename EvalT::MeshScalarT MeshScalarT;
+
+  Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType> >
+    intrepidBasis = Albany::getIntrepid2Basis(*cellType->getCellTopologyData());
+  Intrepid2::DefaultCubatureFactory cubFactory;
+  Teuchos::RCP<Intrepid2::Cubature<PHX::Device> > cubature =
+    cubFactory.create<PHX::Device, RealType, RealType>(*cellType, cubatureDegree);
+
+  const int numDim = cellType->getDimension();
+  Teuchos::RCP<Albany::Layouts> dl = Teuchos::rcp(new Albany::Layouts(
+      worksetSize, cellType->getVertexCount(), intrepidBasis->getCardinality(),
+      cubature->getNumPoints(), numDim));
+  Albany::EvaluatorUtils<EvalT, Traits> evalUtils(dl);
+
+  std::vector<Teuchos::RCP<PHX::Evaluator<Traits> > > timed;
+  timed.push_back(evalUtils.constructComputeBasisFunctionsEvaluator(
+      cellType, intrepidBasis, cubature));
+  timed.push_back(evalUtils.constructDOFVecInterpolationEvaluator("Displacement"));
+  timed.push_back(evalUtils.constructDOFVecGradInterpolationEvaluator("Displacement"));
+
+  // Every cell is the reference cell; the vertices of the linear
+  // topologies are the nodes of their basis
+  const int numNodes = intrepidBasis->getCardinality();
+  Kokkos::DynRankView<RealType, PHX::Device>
+    dofCoords("dofCoords", numNodes, numDim);
+  intrepidBasis->getDofCoords(dofCoords);
+  typename Kokkos::DynRankView<RealType, PHX::Device>::HostMirror
+    dofCoordsHost = Kokkos::create_mirror_view(dofCoords);
+  Kokkos::deep_copy(dofCoordsHost, dofCoords);
+  std::vector<RealType> coords, displacement;
+  for (int node=0; node < numNodes; ++node)
+    for (int dim=0; dim < numDim; ++dim) {
+      coords.push_back(dofCoordsHost(node, dim));
+      displacement.push_back(1.0e-2 * (node + 1) * (dim + 1));
+    }
+
+  PHX::FieldManager<Traits> fm;
+  fm.template registerEvaluator<EvalT>(Teuchos::rcp(
+      new FillField<EvalT, MeshScalarT>("Coord Vec", dl->vertices_vector,
+                                        coords, fadSize)));
+  fm.template registerEvaluator<EvalT>(Teuchos::rcp(
+      new FillField<EvalT, ScalarT>("Displacement", dl->node_vector,
+                                    displacement, fadSize)));
+  for (std::size_t e=0; e < timed.size(); ++e) {
+    fm.template registerEvaluator<EvalT>(timed[e]);
+    for (std::size_t f=0; f < timed[e]->evaluatedFields().size(); ++f)
+      fm.template requireField<EvalT>(*timed[e]->evaluatedFields()[f]);
+  }
+
+  std::vector<PHX::index_size_type> derivative_dimensions;
+  derivative_dimensions.push_back(fadSize);
+  fm.template setKokkosExtendedDataTypeDimensions<EvalT>(derivative_dimensions);
+  fm.postRegistrationSetup("");
+
+  PHAL::Workset workset;
+  workset.numCells = worksetSize;
+  workset.wsIndex = 0;
+
+  // Fill the inputs and run the whole DAG once
+  fm.template preEvaluate<EvalT>(workset);
+  fm.template evaluateFields<EvalT>(workset);
+  fm.template postEvaluate<EvalT>(workset);
+
+  for (std::size_t e=0; e < timed.size(); ++e) {
+    PHX::Device::fence();
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int r=0; r < repetitions; ++r)
+      timed[e]->evaluateFields(workset);
+    PHX::Device::fence();
+    const double seconds = std::chrono::duration<double>(
+        std::chrono::high_resolution_clock::now() - start).count();
+
+    Result result;
+    result.evaluator = timed[e]->getName();
+    result.evalType = evalType;
+    result.seconds = seconds;
+    result.cellsPerSecond = seconds > 0 ?
+      double(worksetSize) * repetitions / seconds : 0;
+    result.gbPerSecond = seconds > 0 ?
+      1e-9 * fieldBytes(*timed[e], fadSize) * repetitions / seconds : 0;
+    results.push_back(result);
+  }
+}
+
+}
+
+int main(int argc, char *argv[]) {
+
+  Teuchos::GlobalMPISession mpiSession(&argc, &argv);
+  Kokkos::initialize(argc, argv);
+
+  Teuchos::RCP<Teuchos::FancyOStream>
+    out(Teuchos::VerboseObjectBase::getDefaultOStream());
+
+  Teuchos::CommandLineProcessor clp;
+  clp.setDocString(
+      "Times individual evaluators on a synthetic workset.\n");
+
+  std::string topology = "Hex8";
+  clp.setOption("topology", &topology, "Hex8, Tet4, Quad4 or Tri3");
+  int worksetSize = 1000;
+  clp.setOption("cells", &worksetSize, "Cells in the workset");
+  int cubatureDegree = 2;
+  clp.setOption("cubature", &cubatureDegree, "Cubature degree");
+  int fadSize = -1;
+  clp.setOption("fad-size", &fadSize,
+      "Derivative dimension of the Jacobian; nodes * dimension by default. "
+      "Must match the compiled length with static FAD types");
+  int repetitions = 100;
+  clp.setOption("repetitions", &repetitions, "Evaluations of each evaluator");
+  std::string jsonFile = "evaluator_benchmark.json";
+  clp.setOption("json", &jsonFile, "JSON output file");
+
+  clp.throwExceptions(false);
+  const Teuchos::CommandLineProcessor::EParseCommandLineReturn parseReturn =
+    clp.parse(argc, argv);
+  if (parseReturn == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED) {
+    Kokkos::finalize();
+    return 0;
+  }
+  if (parseReturn != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL) {
+    Kokkos::finalize();
+    return 1;
+  }
+
+  int status = 0;
+  try {
+    Teuchos::RCP<shards::CellTopology> cellType;
+    if (topology == "Hex8")
+      cellType = Teuchos::rcp(new shards::CellTopology(
+          shards::getCellTopologyData<shards::Hexahedron<8> >()));
+    else if (topology == "Tet4")
+      cellType = Teuchos::rcp(new shards::CellTopology(
+          shards::getCellTopologyData<shards::Tetrahedron<4> >()));
+    else if (topology == "Quad4")
+      cellType = Teuchos::rcp(new shards::CellTopology(
+          shards::getCellTopologyData<shards::Quadrilateral<4> >()));
+    else if (topology == "Tri3")
+      cellType = Teuchos::rcp(new shards::CellTopology(
+          shards::getCellTopologyData<shards::Triangle<3> >()));
+    TEUCHOS_TEST_FOR_EXCEPTION(cellType.is_null(), std::logic_error,
+        "Unknown topology " << topology << "\n");
+
+    if (fadSize < 0)
+      fadSize = cellType->getNodeCount() * cellType->getDimension();
+
+    std::vector<Result> results;
+    benchmark<PHAL::AlbanyTraits::Residual>("Residual", cellType,
+        worksetSize, cubatureDegree, fadSize, repetitions, results);
+    benchmark<PHAL::AlbanyTraits::Jacobian>("Jacobian", cellType,
+        worksetSize, cubatureDegree, fadSize, repetitions, results);
+
+    *out << "Topology " << topology << ", " << worksetSize << " cells, "
+         << "FAD size " << fadSize << ", " << repetitions << " repetitions\n";
+    for (std::size_t i=0; i < results.size(); ++i)
+      *out << "  [" << results[i].evalType << "] " << results[i].evaluator
+           << ": " << results[i].seconds << " s, "
+           << results[i].cellsPerSecond << " cells/s, "
+           << results[i].gbPerSecond << " GB/s\n";
+
+    std::ofstream json(jsonFile.c_str());
+    json << "{\n  \"topology\": \"" << topology << "\",\n"
+         << "  \"cells\": " << worksetSize << ",\n"
+         << "  \"fad_size\": " << fadSize << ",\n"
+         << "  \"repetitions\": " << repetitions << ",\n"
+         << "  \"results\": [\n";
+    for (std::size_t i=0; i < results.size(); ++i)
+      json << "    {\"evaluator\": \"" << results[i].evaluator
+           << "\", \"type\": \"" << results[i].evalType
+           << "\", \"seconds\": " << results[i].seconds
+           << ", \"cells_per_second\": " << results[i].cellsPerSecond
+           << ", \"gb_per_second\": " << results[i].gbPerSecond << "}"
+           << (i + 1 < results.size() ? ",\n" : "\n");
+    json << "  ]\n}\n";
+  }
+  catch (std::exception& e) {
+    *out << e.what() << std::endl;
+    status = 1;
+  }
+
+  Kokkos::finalize();
+  return status;
+}
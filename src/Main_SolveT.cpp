@@ -4,6 +4,7 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <fstream>
 #include <iostream>
 #include <string>
 
@@ -21,6 +22,7 @@
 #include "Teuchos_VerboseObject.hpp"
 #include "Thyra_DefaultProductVector.hpp"
 #include "Thyra_DefaultProductVectorSpace.hpp"
+#include "utility/PerformanceContext.hpp"
 
 // Uncomment for run time nan checking
 // This is set in the toplevel CMakeLists.txt file
@@ -310,6 +312,19 @@ main(int argc, char *argv[]) {
 
     setupTimer.~TimeMonitor();
 
+    // Write the setup phases as JSON if requested
+    {
+      const std::string profileFile =
+          slvrfctry.getParameters().sublist("Debug Output").get<std::string>(
+              "Startup Profile File Name", "");
+      if (!profileFile.empty()) {
+        std::ofstream profile;
+        if (comm->getRank() == 0) profile.open(profileFile.c_str());
+        util::PerformanceContext::instance().phaseMonitor().writeJSON(
+            comm.ptr(), profile);
+      }
+    }
+
     std::string solnMethod =
         slvrfctry.getParameters().sublist("Problem").get<std::string>(
             "Solution Method");
@@ -328,8 +343,31 @@ main(int argc, char *argv[]) {
     Teuchos::Array<
         Teuchos::Array<Teuchos::RCP<const Thyra::MultiVectorBase<ST>>>>
         thyraSensitivities;
-    Piro::PerformSolve(
-        *solver, solveParams, thyraResponses, thyraSensitivities);
+    {
+      util::PhaseGuard solvePhase(
+          util::PerformanceContext::instance().phaseMonitor(), "Solve");
+      Piro::PerformSolve(
+          *solver, solveParams, thyraResponses, thyraSensitivities);
+    }
+
+    // Write all the phases, including the fills of the solve nested under
+    // it, as CSV if the file name ends in .csv and as JSON otherwise
+    {
+      const std::string profileFile =
+          slvrfctry.getParameters().sublist("Debug Output").get<std::string>(
+              "Run Profile File Name", "");
+      if (!profileFile.empty()) {
+        std::ofstream profile;
+        if (comm->getRank() == 0) profile.open(profileFile.c_str());
+        const util::PhaseMonitor &phases =
+            util::PerformanceContext::instance().phaseMonitor();
+        const std::size_t n = profileFile.size();
+        if (n > 4 && profileFile.compare(n - 4, 4, ".csv") == 0)
+          phases.writeCSV(comm.ptr(), profile);
+        else
+          phases.writeJSON(comm.ptr(), profile);
+      }
+    }
 
     Teuchos::Array<Teuchos::RCP<const Tpetra_Vector>> responses;
     Teuchos::Array<Teuchos::Array<Teuchos::RCP<const Tpetra_MultiVector>>>
@@ -564,6 +602,13 @@ main(int argc, char *argv[]) {
             "xfinal_distributed_map.mm", *xfinal->getMap());
       }
     }
+
+    // Write the per-evaluator times and rates if requested
+    if (slvrfctry.getParameters().sublist("Debug Output").get<bool>(
+            "Report Evaluator Statistics", false)) {
+      app->collectEvaluatorStatistics();
+      util::PerformanceContext::instance().summarizeAll(comm.ptr(), *out);
+    }
   }
   TEUCHOS_STANDARD_CATCH_STATEMENTS(true, std::cerr, success);
   if (!success) status += 10000;
@@ -4,8 +4,10 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include <matrix_container.hpp>
 #include <communicator.hpp>
@@ -25,6 +27,7 @@
 #include "Teuchos_VerboseObject.hpp"
 #include "Thyra_DefaultProductVector.hpp"
 #include "Thyra_DefaultProductVectorSpace.hpp"
+#include "Thyra_VectorStdOps.hpp"
 
 #include "ATO_TopoTools.hpp"
 
@@ -112,6 +115,16 @@ class MPMD_App : public Plato::Application
     Teuchos::RCP<Tpetra_Import> m_importer;
     Teuchos::RCP<Tpetra_Export> m_exporter;
 
+    // Receive buffer of the shared fields, kept between exchanges
+    std::vector<double> m_fieldBuffer;
+
+    // Overlap node LID of each (cell, node) of each workset, cell major
+    std::vector<std::vector<LO>> m_wsOverlapLIDs;
+
+    // Nominal solution of the model, which is the initial guess of each
+    // solve; it is overwritten with the last solution
+    Teuchos::RCP<Thyra::VectorBase<ST>> m_initialGuess;
+
     pugi::xml_document m_inputTree;
   
     std::map<std::string,std::string> m_stateMap, m_distParamMap;
@@ -262,6 +275,31 @@ void MPMD_App::initialize()
   m_importer       = Teuchos::rcp(new Tpetra_Import(localNodeMapT, overlapNodeMapT));
   m_exporter       = Teuchos::rcp(new Tpetra_Export(overlapNodeMapT, localNodeMapT));
 
+  m_fieldBuffer.resize(m_localVector->getLocalLength());
+
+  // The element connectivity is fixed, so the node lookups of the field
+  // exchanges are done once
+  const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
+    wsElNodeID = disc->getWsElNodeID();
+  m_wsOverlapLIDs.resize(wsElNodeID.size());
+  for(int ws=0; ws<wsElNodeID.size(); ws++){
+    std::vector<LO>& lids = m_wsOverlapLIDs[ws];
+    for(int cell=0; cell<wsElNodeID[ws].size(); cell++)
+      for(int node=0; node<wsElNodeID[ws][cell].size(); node++)
+        lids.push_back(overlapNodeMapT->getLocalElement(wsElNodeID[ws][cell][node]));
+  }
+
+  // Warm start the solves of the optimization iterations from the previous
+  // solution, if the solver returns it as its last response
+  Teuchos::RCP<Thyra::ModelEvaluator<ST>> model = m_solverFactory->returnModelT();
+  if( Teuchos::nonnull(model) && m_solver->Ng() > 0 ){
+    Teuchos::RCP<Thyra::VectorBase<ST>> x = Teuchos::rcp_const_cast<Thyra::VectorBase<ST>>(
+      model->getNominalValues().get_x());
+    if( Teuchos::nonnull(x) &&
+        m_solver->get_g_space(m_solver->Ng()-1)->isCompatible(*x->space()) )
+      m_initialGuess = x;
+  }
+
 
 
   // parse Operation definition
@@ -382,6 +420,12 @@ MPMD_App::compute(const std::string & noOp)
 
     tpetraFromThyra(thyraResponses, thyraSensitivities, m_responses, m_sensitivities);
 
+    // The next design differs little from this one; start from its solution.
+    // The preconditioner objects live in the Piro solver across calls.
+    if( Teuchos::nonnull(m_initialGuess) && thyraResponses.size() == m_solver->Ng() &&
+        Teuchos::nonnull(thyraResponses.back()) )
+      Thyra::assign(m_initialGuess.ptr(), *thyraResponses.back());
+
 }
 
 
@@ -430,17 +474,12 @@ void MPMD_App::copyFieldIntoState(const std::string& name, const Plato::SharedDa
   Albany::StateArrayVec& dest = stateArrays.elemStateArrays;
   int numWorksets = dest.size();
 
-  Teuchos::RCP<Albany::AbstractDiscretization> disc = stateMgr.getDiscretization();
-  const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
-    wsElNodeID = disc->getWsElNodeID();
-
-  m_localVector->putScalar(0.0);
-  Teuchos::ArrayRCP<double> ltopo = m_localVector->get1dViewNonConst(); 
-  int numLocalVals = m_localVector->getLocalLength();
-
-  std::vector<double> outVector(numLocalVals);
-  sf.getData(outVector);
-  ltopo.assign(outVector.begin(),outVector.end());
+  // The owned values fill the whole local vector
+  sf.getData(m_fieldBuffer);
+  {
+    Teuchos::ArrayRCP<double> ltopo = m_localVector->get1dViewNonConst();
+    std::copy(m_fieldBuffer.begin(), m_fieldBuffer.end(), ltopo.begin());
+  }
 
   m_overlapVector->doImport(*m_localVector, *m_importer, Tpetra::INSERT);
   Teuchos::RCP<Albany::NodeFieldContainer>
@@ -450,17 +489,14 @@ void MPMD_App::copyFieldIntoState(const std::string& name, const Plato::SharedDa
     (*nodeContainer)[name+"_node"]->saveFieldVector(m_overlapVector,/*offset=*/0);
 
   // copy the field into the state manager
-  Teuchos::RCP<const Tpetra_Map> overlapNodeMap = m_overlapVector->getMap();
-  Teuchos::ArrayRCP<double> otopo = m_overlapVector->get1dViewNonConst(); 
+  Teuchos::ArrayRCP<const double> otopo = m_overlapVector->get1dView();
   for(int ws=0; ws<numWorksets; ws++){
     Albany::MDArray& wsTopo = dest[ws][name];
+    const std::vector<LO>& lids = m_wsOverlapLIDs[ws];
     int numCells = wsTopo.dimension(0), numNodes = wsTopo.dimension(1);
     for(int cell=0; cell<numCells; cell++)
-      for(int node=0; node<numNodes; node++){
-        int gid = wsElNodeID[ws][cell][node];
-        int lid = overlapNodeMap->getLocalElement(gid);
-        wsTopo(cell,node) = otopo[lid];
-      }
+      for(int node=0; node<numNodes; node++)
+        wsTopo(cell,node) = otopo[lids[cell*numNodes+node]];
   }
 }
 
@@ -493,21 +529,20 @@ void MPMD_App::copyFieldFromState(const std::string& name, Plato::SharedData& sf
   Albany::StateArrayVec& src = stateArrays.elemStateArrays;
   int numWorksets = src.size();
 
-  Teuchos::RCP<Albany::AbstractDiscretization> disc = stateMgr.getDiscretization();
-  const Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
-    wsElNodeID = disc->getWsElNodeID();
-
   m_overlapVector->putScalar(0.0);
 
   // copy the field from the state manager
-  for(int ws=0; ws<numWorksets; ws++){
-    Albany::MDArray& wsSrc = src[ws][name];
-    int numCells = wsSrc.dimension(0);
-    int numNodes = wsSrc.dimension(1);
-    for(int cell=0; cell<numCells; cell++)
-      for(int node=0; node<numNodes; node++) {
-        m_overlapVector->sumIntoGlobalValue(wsElNodeID[ws][cell][node],wsSrc(cell,node));
-      }
+  {
+    Teuchos::ArrayRCP<double> otopo = m_overlapVector->get1dViewNonConst();
+    for(int ws=0; ws<numWorksets; ws++){
+      Albany::MDArray& wsSrc = src[ws][name];
+      const std::vector<LO>& lids = m_wsOverlapLIDs[ws];
+      int numCells = wsSrc.dimension(0);
+      int numNodes = wsSrc.dimension(1);
+      for(int cell=0; cell<numCells; cell++)
+        for(int node=0; node<numNodes; node++)
+          otopo[lids[cell*numNodes+node]] += wsSrc(cell,node);
+    }
   }
 
   m_localVector->putScalar(0.0);
@@ -10,6 +10,7 @@
 
 #include "Albany_Utils.hpp"
 #include "Albany_SolverFactory.hpp"
+#include "Albany_TempusSession.hpp"
 #include "Albany_Memory.hpp"
 
 #include "Piro_PerformSolve.hpp"
@@ -23,9 +24,6 @@
 #include "Thyra_DefaultProductVector.hpp"
 #include "Thyra_DefaultProductVectorSpace.hpp"
 
-#include "Tempus_IntegratorBasic.hpp" 
-#include "Piro_ObserverToTempusIntegrationObserverAdapter.hpp"
-
 // Uncomment for run time nan checking
 // This is set in the toplevel CMakeLists.txt file
 //#define ALBANY_CHECK_FPE
@@ -274,14 +272,11 @@ int main(int argc, char *argv[]) {
       Albany::connect_vtune(comm->getRank());
     }
 
-    Albany::SolverFactory slvrfctry(cmd.xml_filename, comm);
-    RCP<Albany::Application> app;
-    const RCP<Thyra::ResponseOnlyModelEvaluatorBase<ST> > solver =
-      slvrfctry.createAndGetAlbanyAppT(app, comm, comm);
+    Albany::TempusSession session(cmd.xml_filename, comm);
     
     setupTimer.~TimeMonitor();
 
-    Teuchos::ParameterList &appPL = slvrfctry.getParameters();
+    Teuchos::ParameterList &appPL = session.getParameters();
     // Create debug output object
     Teuchos::ParameterList &debugParams =
       appPL.sublist("Debug Output", true);
@@ -292,34 +287,10 @@ int main(int argc, char *argv[]) {
     std::string solnMethod = appPL.sublist("Problem").get<std::string>("Solution Method"); 
     if (solnMethod == "Transient Tempus No Piro") { 
       //Start of code to use Tempus to perform time-integration without going through Piro
-      Teuchos::RCP<Thyra::ModelEvaluator<ST>> model = slvrfctry.returnModelT();
-      Teuchos::RCP<Teuchos::ParameterList> tempusPL = Teuchos::null; 
-      if (appPL.sublist("Piro").isSublist("Tempus")) {
-        tempusPL = Teuchos::rcp(&(appPL.sublist("Piro").sublist("Tempus")), false); 
-      }
-      else {
-        TEUCHOS_TEST_FOR_EXCEPTION(true,
-          Teuchos::Exceptions::InvalidParameter,
-          std::endl << "Error!  No Tempus sublist when attempting to run problem with Transient Tempus No Piro " <<
-          "Solution Method. " << std::endl);
-      }   
-      auto integrator = Tempus::integratorBasic<double>(tempusPL, model);
-      auto piro_observer = slvrfctry.returnObserverT(); 
-      Teuchos::RCP<Tempus::IntegratorObserver<double> > tempus_observer = Teuchos::null;
-      if (Teuchos::nonnull(piro_observer)) {
-        auto solutionHistory = integrator->getSolutionHistory();
-        auto timeStepControl = integrator->getTimeStepControl();
-        tempus_observer = Teuchos::rcp(new Piro::ObserverToTempusIntegrationObserverAdapter<double>(solutionHistory, 
-                                           timeStepControl, piro_observer));
-      }
-      if (Teuchos::nonnull(tempus_observer)) {
-        integrator->setObserver(tempus_observer); 
-        integrator->initialize(); 
-      }
-      bool integratorStatus = integrator->advanceTime(); 
-      double time = integrator->getTime();
+      bool integratorStatus = session.advance(); 
+      double time = session.getTime();
       *out << "\n Final time = " << time << "\n"; 
-      Teuchos::RCP<Thyra::VectorBase<double> > x = integrator->getX();
+      Teuchos::RCP<const Thyra::VectorBase<double> > x = session.getX();
       Teuchos::RCP<const Tpetra_Vector> x_tpetra = ConverterT::getConstTpetraVector(x);  
       if (writeToCoutSoln == true)  
         Albany::printTpetraVector(*out << "\nxfinal = \n", x_tpetra);
@@ -114,6 +114,38 @@ void set(ArrayT& a, const T& val);
 template<typename ArrayT, typename T>
 void scale(ArrayT& a, const T& val);
 
+/*! \brief Per-workset pointers to one named state of the workset state arrays.
+ *
+ * Evaluators that load or save a state in every fill look the state up once
+ * per workset instead of searching the state array map in every call. The
+ * state of a workset is looked up again if the workset's state array moved.
+ */
+class WorksetStateLookup {
+public:
+  explicit WorksetStateLookup(const std::string& stateName = "")
+    : stateName_(stateName) {}
+
+  //! The state of the workset, or NULL if its state array does not have it
+  Albany::MDArray* get(const Workset& workset) {
+    const unsigned int ws = workset.wsIndex;
+    if (ws >= src_.size()) {
+      src_.resize(ws + 1, NULL);
+      states_.resize(ws + 1, NULL);
+    }
+    if (src_[ws] != workset.stateArrayPtr) {
+      const Albany::StateArray::iterator it = workset.stateArrayPtr->find(stateName_);
+      states_[ws] = (it == workset.stateArrayPtr->end()) ? NULL : &it->second;
+      src_[ws] = workset.stateArrayPtr;
+    }
+    return states_[ws];
+  }
+
+private:
+  std::string stateName_;
+  std::vector<Albany::StateArray*> src_;
+  std::vector<Albany::MDArray*> states_;
+};
+
 // Create a MDALayout given tags and dimensions vector
 template<typename Tag0, typename Tag1, typename Tag2, typename Tag3,
          typename Tag4, typename Tag5, typename Tag6, typename Tag7>
@@ -42,6 +42,9 @@ class Application;
 } // namespace Albany
 #endif
 
+namespace PHAL {
+class SDirichletSweep;
+} // namespace PHAL
 
 namespace PHAL {
 
@@ -90,6 +93,9 @@ struct Workset {
 #endif
   //Tpetra analog of Jac
   Teuchos::RCP<Tpetra_CrsMatrix> JacT;
+  // Shared sweep of the strong Dirichlet conditions over JacT; if null, each
+  // SDirichlet evaluator edits JacT on its own
+  Teuchos::RCP<PHAL::SDirichletSweep> sdbcSweep;
 
 #if defined(ALBANY_EPETRA)
   Teuchos::RCP<Epetra_MultiVector> JV;
@@ -139,11 +145,21 @@ struct Workset {
   std::vector<PHX::index_size_type> Tangent_deriv_dims;
 
   Albany::AbstractDiscretization::WorksetConn wsElNodeEqID;
+  // Offsets of the element entries in the values of JacT; empty unless JacT
+  // is built on the discretization's overlap Jacobian graph
+  Albany::AbstractDiscretization::WorksetJacOffsets wsJacOffsets;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> >  wsElNodeID;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> >  wsCoords;
+  // Contiguous (cell, node, dim) copy of wsCoords; empty if the
+  // discretization does not provide one
+  Albany::AbstractDiscretization::WorksetCoordsView wsCoordsView;
   Teuchos::ArrayRCP<double>  wsSphereVolume;
   Teuchos::ArrayRCP<double*>  wsLatticeOrientation;
   std::string EBName;
+  // Index of EBName among the element blocks of the mesh
+  // (MeshSpecsStruct::ebNameToIndex), or -1 if unknown. Evaluators shared by
+  // several element blocks use it to look up per-block data.
+  int EBIndex;
 
   // Needed for Schwarz coupling and for dirichlet conditions based on dist parameters.
   Teuchos::RCP<Albany::AbstractDiscretization> disc;
@@ -182,6 +198,16 @@ struct Workset {
   // significantly reduce Jacobian calculation cost.
   bool ignore_residual;
 
+  // Flag indicating that the reference coordinates do not change during the
+  // run, so evaluators may cache geometric quantities per workset index.
+  bool cache_basis_functions{false};
+
+  // Flag letting evaluators of solution-independent fields reuse their
+  // outputs per workset (see PHAL::MDFieldMemoizer), and a counter that the
+  // application increments whenever a distributed parameter changes.
+  bool memoize_fields{false};
+  int dist_param_state{0};
+
   // Flag indicated whether we are solving the adjoint operator or the
   // forward operator.  This is used in the Albany application when
   // either the Jacobian or the transpose of the Jacobian is scattered.
@@ -241,6 +267,7 @@ struct Workset {
 
     os << "Printing workset data:" << std::endl;
     os << "\tEB name : " << EBName << std::endl;
+    os << "\tEB index : " << EBIndex << std::endl;
     os << "\tnumCells : " << numCells << std::endl;
     os << "\twsElNodeEqID : " << std::endl;
     for(int i = 0; i < wsElNodeEqID.dimension(0); i++)
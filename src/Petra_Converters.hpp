@@ -96,6 +96,38 @@ Teuchos::RCP<Tpetra_CrsMatrix> EpetraCrsMatrix_To_TpetraCrsMatrix(Epetra_CrsMatr
                                                                const Teuchos::RCP<const Teuchos::Comm<int> >& commT_,
                                                                const Teuchos::RCP< KokkosNode > &node = KokkosClassic::Details::getNode< KokkosNode >());
 
+//EpetraVector_To_TpetraVectorConst/NonConst: same, on a Tpetra::Map with the
+//same local elements as the map of epetraVector_, e.g. one kept by the
+//caller, which saves building the map on every call
+Teuchos::RCP<const Tpetra_Vector> EpetraVector_To_TpetraVectorConst(const Epetra_Vector& epetraVector_,
+                                                               const Teuchos::RCP<const Tpetra_Map>& mapT_);
+
+Teuchos::RCP<Tpetra_Vector> EpetraVector_To_TpetraVectorNonConst(const Epetra_Vector& epetraVector_,
+                                                               const Teuchos::RCP<const Tpetra_Map>& mapT_);
+
+// Tpetra copy of an Epetra_CrsMatrix kept across fills. The Tpetra graph and
+// matrix are built once per Epetra graph, instead of converting the maps,
+// graph and values on every call. Once the Tpetra matrix is assembled, its
+// values are copied row by row straight into the value arrays of the Epetra
+// matrix, which have the same (sorted) column order.
+class CrsMatrixBridge {
+public:
+  //! Tpetra matrix on the graph of epetraMatrix_. Its values are not copied
+  //! from the Epetra matrix.
+  Teuchos::RCP<Tpetra_CrsMatrix> getTpetraMatrix(Epetra_CrsMatrix& epetraMatrix_,
+                                                 const Teuchos::RCP<const Teuchos::Comm<int> >& commT_);
+
+  //! Copy the values of the Tpetra matrix into epetraMatrix_
+  void copyToEpetra(Epetra_CrsMatrix& epetraMatrix_,
+                    const Teuchos::RCP<const Epetra_Comm>& comm_);
+
+private:
+  //! Shares the data of the Epetra graph, to recognize it and keep it alive
+  Teuchos::RCP<Epetra_CrsGraph> epetraGraph_;
+  Teuchos::RCP<Tpetra_CrsMatrix> tpetraMatrix_;
+  //! True if every row has the same column indices in the same order
+  bool sameOrder_;
+};
 
 // Convenience class for conversions. One use case is to inherit from this class
 // and implement situation-specific conversion functionality using concise
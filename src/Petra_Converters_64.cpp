@@ -13,6 +13,7 @@
 #include "Teuchos_OrdinalTraits.hpp"
 #include "Teuchos_TestForException.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <stdexcept>
 #include <ostream>
@@ -338,6 +339,64 @@ Teuchos::RCP<Tpetra_CrsMatrix> Petra::EpetraCrsMatrix_To_TpetraCrsMatrix(Epetra_
 
 }
 
+Teuchos::RCP<const Tpetra_Vector> Petra::EpetraVector_To_TpetraVectorConst(const Epetra_Vector& epetraVector_,
+                                                               const Teuchos::RCP<const Tpetra_Map>& mapT_)
+{
+  return EpetraVector_To_TpetraVectorNonConst(epetraVector_, mapT_);
+}
+
+Teuchos::RCP<Tpetra_Vector> Petra::EpetraVector_To_TpetraVectorNonConst(const Epetra_Vector& epetraVector_,
+                                                               const Teuchos::RCP<const Tpetra_Map>& mapT_)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(mapT_->getNodeNumElements() != static_cast<std::size_t>(epetraVector_.MyLength()),
+                             std::logic_error,
+                             "Error in Petra::EpetraVector_To_TpetraVector! The Tpetra::Map does not have the local length of the Epetra_Vector." << std::endl);
+  ST *values;
+  epetraVector_.ExtractView(&values);
+  Teuchos::ArrayView<ST> valuesAV = Teuchos::arrayView(values, epetraVector_.MyLength());
+  return Teuchos::rcp(new Tpetra_Vector(mapT_, valuesAV));
+}
+
+Teuchos::RCP<Tpetra_CrsMatrix> Petra::CrsMatrixBridge::getTpetraMatrix(Epetra_CrsMatrix& epetraMatrix_,
+                                                                       const Teuchos::RCP<const Teuchos::Comm<int> >& commT_)
+{
+  if (Teuchos::nonnull(epetraGraph_) && epetraGraph_->DataPtr() == epetraMatrix_.Graph().DataPtr())
+    return tpetraMatrix_;
+
+  // New graph: convert it once, and check that the rows match entry by entry
+  tpetraMatrix_ = EpetraCrsMatrix_To_TpetraCrsMatrix(epetraMatrix_, commT_);
+  epetraGraph_ = Teuchos::rcp(new Epetra_CrsGraph(epetraMatrix_.Graph()));
+
+  sameOrder_ = true;
+  for (LO i = 0; sameOrder_ && i < epetraMatrix_.NumMyRows(); i++) {
+    LO NumEntries; LO *Indices;
+    epetraMatrix_.Graph().ExtractMyRowView(i, NumEntries, Indices);
+    LO NumEntriesT; const LO *IndicesT; const ST *ValuesT;
+    tpetraMatrix_->getLocalRowView(i, NumEntriesT, ValuesT, IndicesT);
+    sameOrder_ = NumEntries == NumEntriesT &&
+                 std::equal(Indices, Indices + NumEntries, IndicesT);
+  }
+  return tpetraMatrix_;
+}
+
+void Petra::CrsMatrixBridge::copyToEpetra(Epetra_CrsMatrix& epetraMatrix_,
+                                          const Teuchos::RCP<const Epetra_Comm>& comm_)
+{
+  if (!sameOrder_ || !epetraMatrix_.Filled()) {
+    TpetraCrsMatrix_To_EpetraCrsMatrix(tpetraMatrix_, epetraMatrix_, comm_);
+    epetraMatrix_.FillComplete(true);
+    return;
+  }
+
+  for (LO i = 0; i < epetraMatrix_.NumMyRows(); i++) {
+    LO NumEntries; ST *Values; LO *Indices;
+    epetraMatrix_.ExtractMyRowView(i, NumEntries, Values, Indices);
+    LO NumEntriesT; const LO *IndicesT; const ST *ValuesT;
+    tpetraMatrix_->getLocalRowView(i, NumEntriesT, ValuesT, IndicesT);
+    std::copy(ValuesT, ValuesT + NumEntriesT, Values);
+  }
+}
+
 #include "Albany_Utils.hpp"
 
 Petra::Converter::Converter (const Teuchos::RCP<const Teuchos_Comm>& commT)
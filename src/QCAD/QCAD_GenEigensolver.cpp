@@ -5,6 +5,7 @@
 //*****************************************************************//
 
 #include "QCAD_GenEigensolver.hpp"
+#include <algorithm>
 
 //#include "Stokhos.hpp"
 //#include "Stokhos_Epetra.hpp"
@@ -31,6 +32,8 @@
 #include "AnasaziLOBPCGSolMgr.hpp"
 #include "AnasaziBasicOutputManager.hpp"
 #include "AnasaziEpetraAdapter.hpp"
+#include "Epetra_InvOperator.h"
+#include "Ifpack.h"
 #include "Epetra_CrsMatrix.h"
 
 
@@ -60,6 +63,14 @@ GenEigensolver(const Teuchos::RCP<Teuchos::ParameterList>& eigensolveParams,
   blockSize = myParams->get<int>("Block Size",5);
   maxIters = myParams->get<int>("Maximum Iterations",500);
   conv_tol = myParams->get<double>("Convergece Tolerance",1.0e-8);
+  bUseLocking = myParams->get<bool>("Use Locking",true);
+  if(myParams->isParameter("Max Locked"))
+    lockingParams.set("Max Locked", myParams->get<int>("Max Locked"));
+  if(myParams->isParameter("Locking Tolerance"))
+    lockingParams.set("Locking Tolerance", myParams->get<double>("Locking Tolerance"));
+  bReuseEigenvectors = myParams->get<bool>("Reuse Eigenvectors",false);
+  precType = myParams->get<std::string>("Preconditioner Type","None");
+  bReusePreconditioner = myParams->get<bool>("Reuse Preconditioner",false);
 
   myComm = comm;
 }
@@ -184,6 +195,11 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
 
   Teuchos::RCP<Epetra_MultiVector> ivec = Teuchos::rcp( new Epetra_MultiVector(K->OperatorDomainMap(), blockSize) );
   ivec->Random();
+  if(bReuseEigenvectors && prevEvecs != Teuchos::null && prevEvecs->Map().SameAs(ivec->Map())) {
+    // fill the initial block with the previous eigenvectors, keeping random vectors for the rest
+    for(int i=0; i < std::min(blockSize, prevEvecs->NumVectors()); i++)
+      *((*ivec)(i)) = *((*prevEvecs)(i));
+  }
 
   // Create the eigenproblem.
   Teuchos::RCP<Anasazi::BasicEigenproblem<double, MV, OP> > eigenProblem =
@@ -195,6 +211,27 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
   // Set the number of eigenvalues requested
   eigenProblem->setNEV( nev );
 
+  // Set the preconditioner, an approximate inverse of K
+  if(precType != "None") {
+    if(prec == Teuchos::null || !bReusePreconditioner) {
+      Ifpack Ifpack_factory;
+      int OverlapLevel = 1; // must be >= 0. If Comm.NumProc() == 1, it is ignored.
+      precMatrix = K;
+      prec = Teuchos::rcp( Ifpack_factory.Create(precType, &*precMatrix, OverlapLevel) );
+      TEUCHOS_TEST_FOR_EXCEPTION(prec == Teuchos::null, Teuchos::Exceptions::InvalidParameter,
+         "Unknown Ifpack preconditioner type " << precType << " for the eigensolver.\n" << std::endl);
+
+      Teuchos::ParameterList Ifpack_list;
+      Ifpack_list.set("fact: drop tolerance", 1e-9);
+      Ifpack_list.set("fact: level-of-fill", 1);
+      Ifpack_list.set("schwarz: combine mode", "Add");
+      if( prec->SetParameters(Ifpack_list) != 0 || prec->Initialize() != 0 || prec->Compute() != 0 )
+        TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
+           "Error setting up the Ifpack preconditioner of the eigensolver.\n" << std::endl);
+    }
+    eigenProblem->setPrec( Teuchos::rcp( new Epetra_InvOperator(&*prec) ) );
+  }
+
   // Inform the eigenproblem that you are finishing passing it information
   bool bSuccess = eigenProblem->setProblem();
   TEUCHOS_TEST_FOR_EXCEPTION(!bSuccess, Teuchos::Exceptions::InvalidParameter,
@@ -208,7 +245,8 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
   eigenPL.set( "Maximum Iterations", maxIters );
   eigenPL.set( "Convergence Tolerance", conv_tol );
   eigenPL.set( "Full Ortho", true );
-  eigenPL.set( "Use Locking", true );
+  eigenPL.set( "Use Locking", bUseLocking );
+  eigenPL.setParameters( lockingParams );
   eigenPL.set( "Verbosity", Anasazi::IterationDetails );
 
   // Create the solver manager
@@ -221,6 +259,8 @@ QCAD::GenEigensolver::evalModel(const InArgs& inArgs,
   Anasazi::Eigensolution<double,MV> sol = eigenProblem->getSolution();
   std::vector<Anasazi::Value<double> > evals = sol.Evals;
   Teuchos::RCP<MV> evecs = sol.Evecs;
+  if(bReuseEigenvectors && sol.numVecs > 0)
+    prevEvecs = evecs;
 
   std::vector<double> evals_real(sol.numVecs);
   for(int i=0; i<sol.numVecs; i++) evals_real[i] = evals[i].realpart;
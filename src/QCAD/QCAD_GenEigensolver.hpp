@@ -13,6 +13,7 @@
 //#include "LOCA_Epetra.H"
 #include "Epetra_Map.h"
 #include "Epetra_Vector.h"
+#include "Epetra_CrsMatrix.h"
 //#include "Epetra_LocalMap.h"
 #include "EpetraExt_ModelEvaluator.h"
 #include "Teuchos_RCP.hpp"
@@ -20,6 +21,8 @@
 
 #include "Albany_StateManager.hpp"
 
+class Ifpack_Preconditioner;
+
 //#include "LOCA_Epetra_ModelEvaluatorInterface.H"
 //#include <NOX_Epetra_MultiVector.H>
 
@@ -74,6 +77,19 @@ namespace QCAD {
     std::string which;
     int nev, blockSize, maxIters;
     double conv_tol;
+    bool bUseLocking;
+    Teuchos::ParameterList lockingParams;
+
+    //Warm start: the eigenvectors of the previous solve start the next one, since
+    // the potential changes little between Poisson-Schrodinger iterations
+    bool bReuseEigenvectors;
+    mutable Teuchos::RCP<Epetra_MultiVector> prevEvecs;
+
+    //Optional Ifpack preconditioner of K, optionally kept from the first solve
+    std::string precType;
+    bool bReusePreconditioner;
+    mutable Teuchos::RCP<Ifpack_Preconditioner> prec;
+    mutable Teuchos::RCP<Epetra_CrsMatrix> precMatrix;
   };
 }
 #endif
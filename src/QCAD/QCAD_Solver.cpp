@@ -156,7 +156,9 @@ Solver(const Teuchos::RCP<Teuchos::ParameterList>& appParams,
     shiftPercentBelowMin = problemParams.get<double>("Eigensolver Percent Shift Below Potential Min", 1.0);
     ps_converge_tol = problemParams.get<double>("Iterative PS Convergence Tolerance", 1e-6);
     fixedPSOcc = problemParams.get<double>("Iterative PS Fixed Occupation", -1.0);
+    bWarmStartEvaluations = problemParams.get<bool>("Warm Start Evaluations", false);
   }
+  else bWarmStartEvaluations = false;
 
   // Get problem parameters used for Poisson-Schrodinger-CI mode
   if(problemNameBase == "Poisson Schrodinger CI") {
@@ -259,6 +261,13 @@ Solver(const Teuchos::RCP<Teuchos::ParameterList>& appParams,
     baseOutputExodusFilename = "UNUSED_OUTPUT_EXO_NAME";
   }
 
+  // Sub-solvers kept between evaluations (e.g. the points of a gate voltage sweep) so that
+  //  each evaluation starts from the converged state of the previous one.  Held through a
+  //  pointer, like currentEvalIndex, so it can be updated within evalModel(...).  Re-meshing
+  //  changes the discretization between evaluations, so nothing can be kept in that case.
+  if(bDiscretizationDependsOnParameters) bWarmStartEvaluations = false;
+  warmStart_subSolvers = Teuchos::rcp(new std::map<std::string, SolverSubSolver>);
+
 
   // Create Solver parameter lists based on problem name
   if( problemNameBase == "Poisson" ) {
@@ -1801,9 +1810,19 @@ bool QCAD::Solver::doPSLoop(const std::string& mode, const InArgs& inArgs,
   subSolvers[ "Schrodinger" ] = CreateSubSolver( "Schrodinger", getSubSolverParams("Schrodinger") , *solverComm); // no initial guess
   fillSingleSubSolverParams(inArgs, "Schrodinger", subSolvers[ "Schrodinger" ]);
   
-  //Create Poisson solver & fill its parameters.  Initialize with the solution from the InitPoisson solver
-  Teuchos::RCP<Epetra_Vector> initial_solnVec = subSolvers["InitPoisson"].responses_out->get_g(1); //get the *first* response vector (solution)
-  subSolvers[ "Poisson" ] = CreateSubSolver( "Poisson", getSubSolverParams("Poisson") , *solverComm,  initial_solnVec);
+  //Create Poisson solver & fill its parameters.  Initialize with the solution from the InitPoisson solver,
+  // or, when warm starting, reuse the previous evaluation's Poisson solver so that its nonlinear
+  // solve continues from the previous evaluation's converged potential.
+  std::map<std::string, SolverSubSolver>::const_iterator warmPoisson = warmStart_subSolvers->find("Poisson");
+  if(bWarmStartEvaluations && warmPoisson != warmStart_subSolvers->end()) {
+    if(bVerbose) *out << "QCAD Solve: Warm starting Poisson solver from previous evaluation" << std::endl;
+    subSolvers[ "Poisson" ] = warmPoisson->second;
+  }
+  else {
+    Teuchos::RCP<Epetra_Vector> initial_solnVec = subSolvers["InitPoisson"].responses_out->get_g(1); //get the *first* response vector (solution)
+    subSolvers[ "Poisson" ] = CreateSubSolver( "Poisson", getSubSolverParams("Poisson") , *solverComm,  initial_solnVec);
+    if(bWarmStartEvaluations) (*warmStart_subSolvers)[ "Poisson" ] = subSolvers[ "Poisson" ];
+  }
   fillSingleSubSolverParams(inArgs, "Poisson", subSolvers[ "Poisson" ]);  
 
   if(bVerbose) *out << "QCAD Solve: Beginning Poisson-Schrodinger solve loop" << std::endl;
@@ -2360,6 +2379,7 @@ QCAD::Solver::getValidProblemParameters() const
   validPL->set<double>("Eigensolver Percent Shift Below Potential Min", 1.0, "Percentage of energy range of potential to subtract from the potential's minimum to obtain the eigensolver's shift");
   validPL->set<double>("Iterative PS Convergence Tolerance", 1e-6, "Convergence criterion for iterative PS solver (max potential difference across mesh)");
   validPL->set<double>("Iterative PS Fixed Occupation", -1.0, "Fixed quantum orbital occupation for iterative PS solver (non equilibrium condition)");
+  validPL->set<bool>("Warm Start Evaluations", false, "Keep the Poisson solver between evaluations (e.g. voltage sweep points) and start each iterative PS solve from the previous converged potential");
 
   validPL->set<int>("Minimum CI Particles", 0, "Poisson Schrodinger CI mode only: the minimum number of particles to use in the CI phase");
   validPL->set<int>("Maximum CI Particles", 0, "Poisson Schrodinger CI mode only: the maximum number of particles to use in the CI phase");
@@ -145,6 +145,7 @@ namespace QCAD {
     std::string discretizationCreateCmd;
     std::string baseOutputExodusFilename;
     Teuchos::RCP<int> currentEvalIndex;
+    Teuchos::RCP<std::map<std::string, SolverSubSolver> > warmStart_subSolvers;
     Teuchos::RCP<Epetra_LocalMap> dummy_soln_map;
     Teuchos::RCP<Epetra_Vector> dummy_soln_vec;
 
@@ -172,6 +173,7 @@ namespace QCAD {
     int    nCIExcitations;        // the number of excitations used in CI calculation
     double fixedPSOcc;
     bool   bUseIntegratedPS;
+    bool   bWarmStartEvaluations; // reuse the Poisson solver of the previous evaluation
     bool   bUseTotalSpinSymmetry; // use S2 symmetry in CI calculation
   };
 
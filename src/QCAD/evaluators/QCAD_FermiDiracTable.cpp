@@ -0,0 +1,70 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+#include <cmath>
+
+#include "Teuchos_TestForException.hpp"
+#include "QCAD_FermiDiracTable.hpp"
+
+QCAD::FermiDiracTable::
+FermiDiracTable(const double order, const double spacing,
+                const double xMin, const double xMax) :
+  x0(xMin)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION (order != 0.5 && order != -0.5, std::logic_error,
+    std::endl << "Error!  Only the Fermi-Dirac integrals of order 1/2 and -1/2 can be tabulated ! " << std::endl);
+  TEUCHOS_TEST_FOR_EXCEPTION (spacing <= 0.0 || xMax <= xMin, std::logic_error,
+    std::endl << "Error!  Invalid Fermi-Dirac table spacing or range ! " << std::endl);
+
+  const int nPoints = static_cast<int>(std::ceil((xMax - xMin)/spacing)) + 1;
+  h = (xMax - xMin)/(nPoints - 1);
+  f.resize(nPoints);
+  df.resize(nPoints);
+
+  // Substituting t = u^2 in F_j(x) = 1/Gamma(j+1) int_0^inf t^j/(1+exp(t-x)) dt
+  // gives smooth integrands in u for both orders, with s = 1/(1+exp(u^2-x)):
+  //   F_{1/2}  = 4/sqrt(pi) int u^2 s du,  F_{1/2}'  = F_{-1/2}
+  //   F_{-1/2} = 2/sqrt(pi) int s du,      F_{-1/2}' = 2/sqrt(pi) int s(1-s) du
+  // integrated with the composite Simpson rule up to u^2 = max(x,0) + 50.
+  const double pi = std::acos(-1.0);
+  const int nIntervals = 2000;
+  for (int i=0; i<nPoints; i++) {
+    const double x = x0 + i*h;
+    const double du = std::sqrt(std::max(x, 0.0) + 50.0)/nIntervals;
+    double sum0 = 0.0, sum2 = 0.0, sum11 = 0.0;
+    for (int k=0; k<=nIntervals; k++) {
+      const double u = k*du;
+      const double s = 1.0/(1.0 + std::exp(u*u - x));
+      const double w = (k == 0 || k == nIntervals) ? 1.0 : ((k % 2) ? 4.0 : 2.0);
+      sum0  += w*s;
+      sum2  += w*u*u*s;
+      sum11 += w*s*(1.0 - s);
+    }
+    const double c = 2.0/std::sqrt(pi)*du/3.0;
+    if (order == 0.5) {
+      f[i]  = 2.0*c*sum2;
+      df[i] = c*sum0;
+    } else {
+      f[i]  = c*sum0;
+      df[i] = c*sum11;
+    }
+  }
+}
+
+void QCAD::FermiDiracTable::
+evaluate(const double x, double& value, double& derivative) const
+{
+  const int last = f.size() - 1;
+  const int i = std::min(std::max(static_cast<int>((x - x0)/h), 0), last - 1);
+  const double t = (x - x0)/h - i;
+  const double t2 = t*t, t3 = t2*t;
+
+  value = (2.*t3 - 3.*t2 + 1.)*f[i] + (t3 - 2.*t2 + t)*h*df[i]
+        + (-2.*t3 + 3.*t2)*f[i+1] + (t3 - t2)*h*df[i+1];
+  derivative = (6.*t2 - 6.*t)*(f[i] - f[i+1])/h + (3.*t2 - 4.*t + 1.)*df[i]
+             + (3.*t2 - 2.*t)*df[i+1];
+}
@@ -0,0 +1,42 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef QCAD_FERMIDIRACTABLE_HPP
+#define QCAD_FERMIDIRACTABLE_HPP
+
+#include <vector>
+
+namespace QCAD {
+
+/** \brief Tabulated Fermi-Dirac integral of order 1/2 or -1/2
+
+    The integral, normalized so that F_j(x) -> exp(x) as x -> -infinity, and
+    its derivative are computed by quadrature at equally spaced points of
+    [xMin, xMax]. They are then evaluated by cubic Hermite interpolation, so
+    that a Fad argument only costs one value and one derivative. The
+    interpolation error decreases as the fourth power of the spacing.
+*/
+class FermiDiracTable {
+public:
+
+  FermiDiracTable(const double order, const double spacing,
+                  const double xMin = -40.0, const double xMax = 60.0);
+
+  double xMin() const { return x0; }
+  double xMax() const { return x0 + h*(f.size()-1); }
+
+  //! Value and derivative for xMin() <= x <= xMax()
+  void evaluate(const double x, double& value, double& derivative) const;
+
+private:
+
+  double x0, h;
+  std::vector<double> f, df;
+};
+
+}
+
+#endif
@@ -24,6 +24,7 @@
 #include "Albany_MaterialDatabase.hpp"
 #include "QCAD_MeshRegion.hpp"
 #include "QCAD_EvaluatorTools.hpp"
+#include "QCAD_FermiDiracTable.hpp"
 
 namespace QCAD {
 /** 
@@ -206,6 +207,13 @@ namespace QCAD {
     //! specify carrier statistics and incomplete ionization
     std::string carrierStatistics;
     std::string incompIonization;
+
+    //! tabulated Fermi-Dirac integrals, null when the analytical approximations are used
+    Teuchos::RCP<const FermiDiracTable> fdIntOneHalfTable;
+    Teuchos::RCP<const FermiDiracTable> fdIntMinusOneHalfTable;
+
+    //! evaluate a tabulated Fermi-Dirac integral; false if x is out of the table range
+    inline bool evaluateFDTable(const FermiDiracTable& table, const ScalarT& x, ScalarT& fdInt) const;
         
     //! donor and acceptor concentrations (for element blocks nsilicon & psilicon)
     double dopingDonor;   // in [cm-3]
@@ -61,6 +61,15 @@ PoissonSource(Teuchos::ParameterList& p,
   bIncludeVxc = psList->get<bool>("Include exchange-correlation potential",false);
   fixedQuantumOcc = psList->get<double>("Fixed Quantum Occupation",-1.0);
 
+  std::string fdIntEvaluation = psList->get<std::string>("Fermi-Dirac Integral Evaluation", "Analytical");
+  if (fdIntEvaluation == "Tabulated") {
+    double fdTableSpacing = psList->get<double>("Fermi-Dirac Table Spacing", 0.05);
+    fdIntOneHalfTable = Teuchos::rcp(new FermiDiracTable(0.5, fdTableSpacing));
+    fdIntMinusOneHalfTable = Teuchos::rcp(new FermiDiracTable(-0.5, fdTableSpacing));
+  }
+  else TEUCHOS_TEST_FOR_EXCEPTION (fdIntEvaluation != "Analytical", Teuchos::Exceptions::InvalidParameter,
+    std::endl << "Error!  Unknown Fermi-Dirac integral evaluation " << fdIntEvaluation << " ! " << std::endl);
+
   // find element blocks and voltages applied on them
   std::string preName = "DBC on NS "; 
   std::string postName = " for DOF Phi";
@@ -441,6 +450,8 @@ QCAD::PoissonSource<EvalT,Traits>::getValidPoissonSourceParameters() const
   validPL->set<bool>("Include exchange-correlation potential",false, "Include the exchange correlation term in the output potential state");
   validPL->set<bool>("Imaginary Part of Coulomb Source",false,"When 'Quantum Region Source' equals 'coulomb', whether to use imaginary or real part as source term.");
   validPL->set<double>("Fixed Quantum Occupation",-1.0, "The fixed number of quantum orbitals (one orbital == spin * valley degeneracy e-) to fill (non-equilibrium).");
+  validPL->set<std::string>("Fermi-Dirac Integral Evaluation", "Analytical", "Analytical or Tabulated evaluation of the Fermi-Dirac integrals of order 1/2 and -1/2");
+  validPL->set<double>("Fermi-Dirac Table Spacing", 0.05, "Spacing of the tabulated Fermi-Dirac integrals; the error decreases as its fourth power");
 
   validPL->set<double>("Oxide Width", 0., "Oxide width for 1D MOSCapacitor device");
   validPL->set<double>("Silicon Width", 0., "Silicon width for 1D MOSCapacitor device");
@@ -1432,6 +1443,9 @@ QCAD::PoissonSource<EvalT,Traits>::computeFDIntOneHalf(const ScalarT x)
    // has error < 4e-3 in the entire x range.  
    
    ScalarT fdInt; 
+   if (fdIntOneHalfTable != Teuchos::null && evaluateFDTable(*fdIntOneHalfTable, x, fdInt))
+     return fdInt;
+
    if (x >= -50.0)
    {
      fdInt = pow(x,4.) + 50. + 33.6*x*(1.-0.68*exp(-0.17*pow((x+1.),2.0)));
@@ -2183,6 +2197,26 @@ void QCAD::PoissonSource<EvalT,Traits>::source_cloudcharges(typename Traits::Eva
   }
 }
 
+// **********************************************************************
+template<typename EvalT,typename Traits>
+inline bool
+QCAD::PoissonSource<EvalT,Traits>::evaluateFDTable(const FermiDiracTable& table, const ScalarT& x, ScalarT& fdInt) const
+{
+   // The table gives the value and the derivative at the value of x, so the 
+   // derivatives of x are only scaled once instead of going through each operation
+   const double xVal = Albany::ADValue(x);
+   if (xVal < table.xMin() || xVal > table.xMax())
+     return false;
+
+   double value, derivative;
+   table.evaluate(xVal, value, derivative);
+   fdInt = value + derivative*(x - xVal);
+   return true;
+}
+
+
+
+
 //! ----------------- Miscellaneous helper functions ---------------------
 
 
@@ -2198,6 +2232,9 @@ QCAD::PoissonSource<EvalT,Traits>::computeFDIntMinusOneHalf(const ScalarT x)
    // has error < 1e-5 in the entire x range.  
    
    ScalarT fdInt; 
+   if (fdIntMinusOneHalfTable != Teuchos::null && evaluateFDTable(*fdIntMinusOneHalfTable, x, fdInt))
+     return fdInt;
+
    double a1, a2, a3, a4, a5, a6, a7; 
    if (x <= 0.)  // eqn.(4) in the reference
    {
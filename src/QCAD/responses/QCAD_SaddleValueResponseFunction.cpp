@@ -14,6 +14,7 @@
 #include "Tpetra_Map.hpp"
 #include "QCAD_GreensFunctionTunneling.hpp"
 #include <fstream>
+#include <algorithm>
 #include "Petra_Converters.hpp" 
 
 //! Helper function prototypes
@@ -34,6 +35,12 @@ namespace QCAD
 	      std::pair<std::size_t, double> const& b);
   double averageOfVector(const std::vector<double>& v);
   double distance(const std::vector<double>* vCoords, int ind1, int ind2, std::size_t nDims);
+
+  //pointFn(d, radius) is zero for d > pointFnSupport * radius
+  const double pointFnSupport = sqrt(2*log(1e2));
+
+  //number of grid cells along each dimension is below 2^20, so cell indices fit in one long long
+  const long long maxGridCellsPerDim = 1 << 20;
 }
 
 QCAD::SaddleValueResponseFunction::
@@ -72,6 +79,7 @@ SaddleValueResponseFunction(
   bClimbing      = params.get<bool>("Climbing NEB", true);
   antiKinkFactor = params.get<double>("Anti-Kink Factor", 0.0);
   bAggregateWorksets = params.get<bool>("Aggregate Worksets", false);
+  bPointGridValid = false;
   bAdaptivePointSize = params.get<bool>("Adaptive Image Point Size", false);
   minAdaptivePointWt = params.get<double>("Adaptive Min Point Weight", 5);
   maxAdaptivePointWt = params.get<double>("Adaptive Max Point Weight", 10);
@@ -396,6 +404,7 @@ initializeImagePoints(const double current_time,
     vFieldValues.clear();
     vCoords.clear();
     vGrads.clear();
+    bPointGridValid = false;
 
     mode = "Accumulate all field data";
     Albany::FieldManagerScalarResponseFunction::evaluateResponseT(
@@ -541,6 +550,7 @@ initializeImagePointsT(const double current_time,
     vFieldValues.clear();
     vCoords.clear();
     vGrads.clear();
+    bPointGridValid = false;
 
     mode = "Accumulate all field data";
     Albany::FieldManagerScalarResponseFunction::evaluateResponseT(
@@ -2115,9 +2125,7 @@ getImagePointValues(const double current_time,
 
   if(bAggregateWorksets) {
     //Use cached field and coordinate values to perform fill    
-    for(std::size_t i=0; i<vFieldValues.size(); i++) {
-      addImagePointData( vCoords[i].data, vFieldValues[i], vGrads[i].data );
-    } 
+    addGriddedImagePointData();
   }
   else {
     mode = "Collect image point data";
@@ -2134,10 +2142,15 @@ getImagePointValues(const double current_time,
 				     current_time, xdotT.get(), NULL, *xT, p, *gT);
   }
 
-  //MPI -- sum weights, value, and gradient for each image pt
-  comm->SumAll( imagePtValues.data(),    globalPtValues,  nImagePts );
-  comm->SumAll( imagePtWeights.data(),   globalPtWeights, nImagePts );
-  comm->SumAll( imagePtGradComps.data(), globalPtGrads,   nImagePts*numDims );
+  //MPI -- sum weights, value, and gradient for each image pt, in a single reduction
+  std::vector<double> localPtData(nImagePts*(2+numDims)), globalPtData(nImagePts*(2+numDims));
+  std::copy(imagePtValues.data(), imagePtValues.data()+nImagePts, localPtData.begin());
+  std::copy(imagePtWeights.data(), imagePtWeights.data()+nImagePts, localPtData.begin()+nImagePts);
+  std::copy(imagePtGradComps.data(), imagePtGradComps.data()+nImagePts*numDims, localPtData.begin()+2*nImagePts);
+  comm->SumAll( localPtData.data(), globalPtData.data(), nImagePts*(2+numDims) );
+  std::copy(globalPtData.begin(), globalPtData.begin()+nImagePts, globalPtValues);
+  std::copy(globalPtData.begin()+nImagePts, globalPtData.begin()+2*nImagePts, globalPtWeights);
+  std::copy(globalPtData.begin()+2*nImagePts, globalPtData.end(), globalPtGrads);
 
   // Put summed data into imagePts, normalizing value and 
   //   gradient from different cell contributions
@@ -2185,9 +2198,7 @@ getFinalImagePointValues(const double current_time,
 
   if(bAggregateWorksets) {
     //Use cached field and coordinate values to perform fill    
-    for(std::size_t i=0; i<vFieldValues.size(); i++) {
-      addFinalImagePointData( vCoords[i].data, vFieldValues[i] );
-    } 
+    addGriddedFinalImagePointData();
   }
   else {
     mode = "Collect final image point data";
@@ -2209,8 +2220,12 @@ getFinalImagePointValues(const double current_time,
   if(nFinalPts > 0) {
     double*  globalPtValues   = new double [nFinalPts];
     double*  globalPtWeights  = new double [nFinalPts];
-    comm->SumAll( finalPtValues.data(),    globalPtValues,  nFinalPts );
-    comm->SumAll( finalPtWeights.data(),   globalPtWeights, nFinalPts );
+    std::vector<double> localPtData(2*nFinalPts), globalPtData(2*nFinalPts);
+    std::copy(finalPtValues.data(), finalPtValues.data()+nFinalPts, localPtData.begin());
+    std::copy(finalPtWeights.data(), finalPtWeights.data()+nFinalPts, localPtData.begin()+nFinalPts);
+    comm->SumAll( localPtData.data(), globalPtData.data(), 2*nFinalPts );
+    std::copy(globalPtData.begin(), globalPtData.begin()+nFinalPts, globalPtValues);
+    std::copy(globalPtData.begin()+nFinalPts, globalPtData.end(), globalPtWeights);
 
     // Put summed data into imagePts, normalizing value from different cell contributions
     for(std::size_t i=0; i<nFinalPts; i++) {
@@ -2263,9 +2278,7 @@ getImagePointValuesT(const double current_time,
 
   if(bAggregateWorksets) {
     //Use cached field and coordinate values to perform fill    
-    for(std::size_t i=0; i<vFieldValues.size(); i++) {
-      addImagePointData( vCoords[i].data, vFieldValues[i], vGrads[i].data );
-    } 
+    addGriddedImagePointData();
   }
   else {
     mode = "Collect image point data";
@@ -2273,10 +2286,15 @@ getImagePointValuesT(const double current_time,
 				     current_time, xdotT, NULL, xT, p, gT);
   }
 
-  //MPI -- sum weights, value, and gradient for each image pt
-  Teuchos::reduceAll<LO, ST>(*commT, Teuchos::REDUCE_SUM, nImagePts, imagePtValues.data(), globalPtValues); 
-  Teuchos::reduceAll<LO, ST>(*commT, Teuchos::REDUCE_SUM, nImagePts, imagePtWeights.data(), globalPtWeights); 
-  Teuchos::reduceAll<LO, ST>(*commT, Teuchos::REDUCE_SUM, nImagePts*numDims, imagePtGradComps.data(), globalPtGrads); 
+  //MPI -- sum weights, value, and gradient for each image pt, in a single reduction
+  std::vector<ST> localPtData(nImagePts*(2+numDims)), globalPtData(nImagePts*(2+numDims));
+  std::copy(imagePtValues.data(), imagePtValues.data()+nImagePts, localPtData.begin());
+  std::copy(imagePtWeights.data(), imagePtWeights.data()+nImagePts, localPtData.begin()+nImagePts);
+  std::copy(imagePtGradComps.data(), imagePtGradComps.data()+nImagePts*numDims, localPtData.begin()+2*nImagePts);
+  Teuchos::reduceAll<LO, ST>(*commT, Teuchos::REDUCE_SUM, nImagePts*(2+numDims), localPtData.data(), globalPtData.data()); 
+  std::copy(globalPtData.begin(), globalPtData.begin()+nImagePts, globalPtValues);
+  std::copy(globalPtData.begin()+nImagePts, globalPtData.begin()+2*nImagePts, globalPtWeights);
+  std::copy(globalPtData.begin()+2*nImagePts, globalPtData.end(), globalPtGrads);
   //comm.SumAll( imagePtValues.data(),    globalPtValues,  nImagePts );
   //comm.SumAll( imagePtWeights.data(),   globalPtWeights, nImagePts );
   //comm.SumAll( imagePtGradComps.data(), globalPtGrads,   nImagePts*numDims );
@@ -2574,6 +2592,123 @@ addFinalImagePointData(const double* p, double value)
   return;
 }
 
+void QCAD::SaddleValueResponseFunction::
+buildPointGrid()
+{
+  // Cells about the size of the support of an image point, so that a query
+  //  visits a few cells per dimension
+  std::size_t nPts = vCoords.size();
+  gridCellSize = imagePtSize*pointFnSupport;
+  for(std::size_t k=0; k<numDims; k++) {
+    double cmin = 0.0, cmax = 0.0;
+    for(std::size_t i=0; i<nPts; i++) {
+      if(i == 0 || vCoords[i].data[k] < cmin) cmin = vCoords[i].data[k];
+      if(i == 0 || vCoords[i].data[k] > cmax) cmax = vCoords[i].data[k];
+    }
+    gridOrigin[k] = cmin;
+    gridCellSize = std::max(gridCellSize, (cmax - cmin) / (maxGridCellsPerDim-1));
+  }
+  if(gridCellSize <= 0) gridCellSize = 1.0;
+
+  std::vector<std::pair<long long, int> > cellOfPt(nPts);
+  for(std::size_t i=0; i<nPts; i++) {
+    long long key = 0;
+    for(int k=numDims-1; k>=0; k--)
+      key = key*maxGridCellsPerDim + (long long)((vCoords[i].data[k] - gridOrigin[k]) / gridCellSize);
+    cellOfPt[i] = std::make_pair(key, (int)i);
+  }
+  std::sort(cellOfPt.begin(), cellOfPt.end());
+
+  gridCellKeys.clear();
+  gridCellStart.clear();
+  gridPointIndices.resize(nPts);
+  for(std::size_t i=0; i<nPts; i++) {
+    if(i == 0 || cellOfPt[i].first != cellOfPt[i-1].first) {
+      gridCellKeys.push_back(cellOfPt[i].first);
+      gridCellStart.push_back(i);
+    }
+    gridPointIndices[i] = cellOfPt[i].second;
+  }
+  gridCellStart.push_back(nPts);
+  bPointGridValid = true;
+}
+
+void QCAD::SaddleValueResponseFunction::
+getGridNeighbors(const mathVector& center, double radius, std::vector<int>& neighbors) const
+{
+  neighbors.clear();
+  double R = radius*pointFnSupport*(1+1e-8); // margin for round-off at the support boundary
+  long long lo[MAX_DIMENSIONS], hi[MAX_DIMENSIONS], ind[MAX_DIMENSIONS];
+  for(std::size_t k=0; k<numDims; k++) {
+    double clo = floor((center[k] - R - gridOrigin[k]) / gridCellSize);
+    double chi = floor((center[k] + R - gridOrigin[k]) / gridCellSize);
+    if(chi < 0 || clo > maxGridCellsPerDim-1) return; // no points in range
+    lo[k] = ind[k] = (long long)std::max(clo, 0.0);
+    hi[k] = (long long)std::min(chi, (double)(maxGridCellsPerDim-1));
+  }
+
+  // loop over the cells of the box [lo,hi], first index fastest
+  while(true) {
+    long long key = 0;
+    for(int k=numDims-1; k>=0; k--) key = key*maxGridCellsPerDim + ind[k];
+    std::vector<long long>::const_iterator it = std::lower_bound(gridCellKeys.begin(), gridCellKeys.end(), key);
+    if(it != gridCellKeys.end() && *it == key) {
+      std::size_t c = it - gridCellKeys.begin();
+      neighbors.insert(neighbors.end(), gridPointIndices.begin()+gridCellStart[c], gridPointIndices.begin()+gridCellStart[c+1]);
+    }
+    std::size_t k = 0;
+    while(k < numDims && ind[k] == hi[k]) { ind[k] = lo[k]; k++; }
+    if(k == numDims) break;
+    ind[k]++;
+  }
+  // same order as a loop over all points, so that sums are unchanged
+  std::sort(neighbors.begin(), neighbors.end());
+}
+
+void QCAD::SaddleValueResponseFunction::
+addGriddedImagePointData()
+{
+  if(!bPointGridValid) buildPointGrid();
+
+  double w, effDims = (bLockToPlane && numDims > 2) ? 2 : numDims;
+  std::vector<int> neighbors;
+  for(std::size_t i=0; i<nImagePts; i++) {
+    getGridNeighbors(imagePts[i].coords, imagePts[i].radius, neighbors);
+    for(std::size_t n=0; n<neighbors.size(); n++) {
+      int j = neighbors[n];
+      w = pointFn(imagePts[i].coords.distanceTo(vCoords[j].data) , imagePts[i].radius );
+      if(w > 0) {
+	imagePtWeights[i] += w;
+	imagePtValues[i] += w*vFieldValues[j];
+	for(std::size_t k=0; k<effDims; k++)
+	  imagePtGradComps[k*nImagePts+i] += w*vGrads[j].data[k];
+      }
+    }
+  }
+  return;
+}
+
+void QCAD::SaddleValueResponseFunction::
+addGriddedFinalImagePointData()
+{
+  if(!bPointGridValid) buildPointGrid();
+
+  double w;
+  std::vector<int> neighbors;
+  for(std::size_t i=0; i< finalPts.size(); i++) {
+    getGridNeighbors(finalPts[i].coords, finalPts[i].radius, neighbors);
+    for(std::size_t n=0; n<neighbors.size(); n++) {
+      int j = neighbors[n];
+      w = pointFn(finalPts[i].coords.distanceTo(vCoords[j].data) , finalPts[i].radius );
+      if(w > 0) {
+	finalPtWeights[i] += w;
+	finalPtValues[i] += w*vFieldValues[j];
+      }
+    }
+  }
+  return;
+}
+
 void QCAD::SaddleValueResponseFunction::
 accumulatePointData(const double* p, double value, double* grad)
 {
@@ -159,6 +159,10 @@ namespace QCAD {
 		     Tpetra_MultiVector* dg_dxdotdotT,
 		     Tpetra_MultiVector* dg_dpT);
 
+    //! Responses and gradients run the saddle point algorithms, not a single
+    //! workset sweep
+    virtual bool sharesResponseSweep() const { return false; }
+    virtual bool sharesGradientSweep() const { return false; }
 
 #if defined(ALBANY_EPETRA)
     //! Post process responses
@@ -285,6 +289,17 @@ namespace QCAD {
     //! function giving distribution of weights for "point"
     double pointFn(double d, double radius) const;
 
+    //! bin the aggregated points (vCoords) on a uniform grid
+    void buildPointGrid();
+
+    //! indices, in increasing order, of the aggregated points where pointFn(., radius) may be nonzero
+    void getGridNeighbors(const mathVector& center, double radius, std::vector<int>& neighbors) const;
+
+    //! same accumulation as addImagePointData / addFinalImagePointData over all aggregated points,
+    //!  visiting only the points near each image point
+    void addGriddedImagePointData();
+    void addGriddedFinalImagePointData();
+
     //! helper function to get the highest image point (the one with the largest value)
     int getHighestPtIndex() const;
 
@@ -309,6 +324,15 @@ namespace QCAD {
     std::vector<maxDimPt> vCoords;
     std::vector<maxDimPt> vGrads;
 
+    //! uniform grid over vCoords: sorted (linearized) cell indices of the nonempty cells,
+    //!  and the points of each cell in CSR format
+    bool bPointGridValid;
+    double gridCellSize;
+    double gridOrigin[MAX_DIMENSIONS];
+    std::vector<long long> gridCellKeys;
+    std::vector<int> gridCellStart;
+    std::vector<int> gridPointIndices;
+
     //! data for level set method
     std::vector<double> vlsFieldValues;
     std::vector<double> vlsCellAreas;
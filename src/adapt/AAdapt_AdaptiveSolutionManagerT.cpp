@@ -102,8 +102,16 @@ AAdapt::AdaptiveSolutionManagerT::AdaptiveSolutionManagerT(
   //IKT, 1/20/15: the following is needed to ensure Laplace matrix is non-diagonal
   //for Aeras problems that have hyperviscosity and are integrated using an explicit time
   //integration scheme.
-  const Teuchos::RCP<const Tpetra_CrsGraph> overlapJacGraphT = disc_
-      ->getImplicitOverlapJacobianGraphT();
+  //An explicit scheme with a matrix-free Laplace operator only assembles the
+  //lumped mass, which fits the diagonal graph.
+  const bool matrixFreeLaplace =
+      problemParams->isSublist("Shallow Water Problem") &&
+      problemParams->sublist("Shallow Water Problem").get<bool>(
+          "Matrix-Free Hyperviscosity", false);
+  const Teuchos::RCP<const Tpetra_CrsGraph> overlapJacGraphT =
+      disc_->isExplicitScheme() && !matrixFreeLaplace ?
+          disc_->getImplicitOverlapJacobianGraphT() :
+          disc_->getOverlapJacobianGraphT();
 #else
   const Teuchos::RCP<const Tpetra_CrsGraph> overlapJacGraphT = disc_
       ->getOverlapJacobianGraphT();
@@ -327,12 +335,21 @@ void AAdapt::AdaptiveSolutionManagerT::resizeMeshDataArrays(
     const Teuchos::RCP<const Tpetra_CrsGraph> &overlapJacGraphT)
 {
 
-  importerT = Teuchos::rcp(new Tpetra_Import(mapT, overlapMapT));
-  exporterT = Teuchos::rcp(new Tpetra_Export(overlapMapT, mapT));
+  // The maps of an adaptation step that left the layout of the unknowns
+  // as it was are new objects, but the communication plans and the
+  // overlapped vectors built for the old ones can be kept
+  const bool sameMaps = Teuchos::nonnull(importerT) &&
+    importerT->getSourceMap()->isSameAs(*mapT) &&
+    importerT->getTargetMap()->isSameAs(*overlapMapT);
+
+  if (!sameMaps) {
+    importerT = Teuchos::rcp(new Tpetra_Import(mapT, overlapMapT));
+    exporterT = Teuchos::rcp(new Tpetra_Export(overlapMapT, mapT));
 
-  overlapped_soln = Teuchos::rcp(new Tpetra_MultiVector(overlapMapT, num_time_deriv + 1, false));
+    overlapped_soln = Teuchos::rcp(new Tpetra_MultiVector(overlapMapT, num_time_deriv + 1, false));
 
-  overlapped_fT = Teuchos::rcp(new Tpetra_Vector(overlapMapT));
+    overlapped_fT = Teuchos::rcp(new Tpetra_Vector(overlapMapT));
+  }
   overlapped_jacT = Teuchos::rcp(new Tpetra_CrsMatrix(overlapJacGraphT));
 
   // This call allocates the non-overlapped MV
@@ -379,17 +396,40 @@ AAdapt::AdaptiveSolutionManagerT::scatterXT(
     const Tpetra_Vector* x_dotdotT)
 {
 
-  overlapped_soln->getVectorNonConst(0)->doImport(xT, *importerT, Tpetra::INSERT);
-
-  if (x_dotT){
-     TEUCHOS_TEST_FOR_EXCEPTION(overlapped_soln->getNumVectors() < 2, std::logic_error,
-         "AdaptiveSolutionManager error: x_dotT defined but only a single solution vector is available");
-     overlapped_soln->getVectorNonConst(1)->doImport(*x_dotT, *importerT, Tpetra::INSERT);
+  TEUCHOS_TEST_FOR_EXCEPTION(x_dotT && overlapped_soln->getNumVectors() < 2, std::logic_error,
+      "AdaptiveSolutionManager error: x_dotT defined but only a single solution vector is available");
+  TEUCHOS_TEST_FOR_EXCEPTION(x_dotdotT && overlapped_soln->getNumVectors() < 3, std::logic_error,
+      "AdaptiveSolutionManager error: x_dotdotT defined but xDotDot isn't defined in the multivector");
+
+  // With time derivatives, x, x_dot and x_dotdot are gathered as the
+  // columns of one owned multivector, so one import (a single round of
+  // messages) updates all the columns of the overlapped solution
+  if (x_dotT) {
+    const size_t numVecs = x_dotdotT ? 3 : 2;
+    if (Teuchos::is_null(owned_soln) ||
+        owned_soln->getMap() != importerT->getSourceMap())
+      owned_soln = Teuchos::rcp(new Tpetra_MultiVector(
+            importerT->getSourceMap(), overlapped_soln->getNumVectors(), false));
+
+    Tpetra::deep_copy(*owned_soln->getVectorNonConst(0), xT);
+    Tpetra::deep_copy(*owned_soln->getVectorNonConst(1), *x_dotT);
+    if (x_dotdotT)
+      Tpetra::deep_copy(*owned_soln->getVectorNonConst(2), *x_dotdotT);
+
+    if (numVecs == overlapped_soln->getNumVectors()) {
+      overlapped_soln->doImport(*owned_soln, *importerT, Tpetra::INSERT);
+    }
+    else {
+      const Teuchos::Range1D cols(0, numVecs - 1);
+      overlapped_soln->subViewNonConst(cols)->doImport(
+          *owned_soln->subView(cols), *importerT, Tpetra::INSERT);
+    }
+    return;
   }
 
+  overlapped_soln->getVectorNonConst(0)->doImport(xT, *importerT, Tpetra::INSERT);
+
   if (x_dotdotT){
-     TEUCHOS_TEST_FOR_EXCEPTION(overlapped_soln->getNumVectors() < 3, std::logic_error,
-         "AdaptiveSolutionManager error: x_dotdotT defined but xDotDot isn't defined in the multivector");
      overlapped_soln->getVectorNonConst(2)->doImport(*x_dotdotT, *importerT, Tpetra::INSERT);
 
 	  /*OG uncomment this to enable Laplace calculations in Aeras::Hydrostatic
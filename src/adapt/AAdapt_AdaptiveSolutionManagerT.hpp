@@ -61,6 +61,8 @@ public:
 
    Teuchos::RCP<Thyra::MultiVectorBase<double> > getCurrentSolution();
 
+   //! Import the owned solution and the time derivatives given into the
+   //! overlapped solution
    void scatterXT(
        const Tpetra_Vector& xT,
        const Tpetra_Vector* x_dotT,
@@ -81,6 +83,9 @@ private:
     Teuchos::RCP<Tpetra_MultiVector> current_soln;
     Teuchos::RCP<Tpetra_MultiVector> overlapped_soln;
 
+    // Owned x, x_dot and x_dotdot gathered for one import in scatterXT
+    Teuchos::RCP<Tpetra_MultiVector> owned_soln;
+
     // Number of time derivative vectors that we need to support
     const int num_time_deriv;
 
@@ -11,11 +11,38 @@
 #include "AAdapt_AnalyticFunction.hpp"
 #include "Teuchos_TestForException.hpp"
 #include "Teuchos_Exceptions.hpp"
+#include "Kokkos_Core.hpp"
 
 #include "Aeras_ShallowWaterConstants.hpp"
 
 const double pi = 3.141592653589793;
 
+namespace {
+
+// Evaluates f.compute on every point in parallel. The first point is done on
+// the calling thread, so the data checks some functions make in compute throw
+// from there rather than from a worker.
+template<typename Function>
+void parallelCompute(Function& f, const int numPoints, const int neq, const int numDim,
+                     double* x, const double* X) {
+  if (numPoints == 0) return;
+
+  f.Function::compute(x, X);
+  Kokkos::parallel_for("AnalyticFunction::computeBatch",
+                       Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(1, numPoints),
+                       [&](const int p) {
+    f.Function::compute(x + p * neq, X + p * numDim);
+  });
+}
+
+} // namespace
+
+void AAdapt::AnalyticFunction::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  for (int p = 0; p < numPoints; ++p)
+    compute(x + p * neq, X + p * numDim);
+}
+
 
 // Factory method to build functions based on a string
 Teuchos::RCP<AAdapt::AnalyticFunction> AAdapt::createAnalyticFunction(
@@ -179,6 +206,10 @@ void AAdapt::ConstantFunction::compute(double* x, const double* X) {
     for(int i = 0; i < neq; i++)
       x[i] = data[i];
 }
+void AAdapt::ConstantFunction::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 
 //*****************************************************************************
 AAdapt::StepX::StepX(int neq_, int numDim_,
@@ -211,6 +242,10 @@ void AAdapt::StepX::compute(double* x, const double* X) {
         x[0] = T;
     }
 }
+void AAdapt::StepX::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 
 //*****************************************************************************
 AAdapt::TemperatureStep::TemperatureStep(int neq_, int numDim_,
@@ -255,6 +290,10 @@ void AAdapt::TemperatureStep::compute(double* x, const double* X) {
         x[0] = T;
     }
 }
+void AAdapt::TemperatureStep::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 
 //*****************************************************************************
 AAdapt::DispConstTemperatureStep::DispConstTemperatureStep(int neq_, int numDim_,
@@ -302,6 +341,10 @@ void AAdapt::DispConstTemperatureStep::compute(double* x, const double* X) {
         x[3] = T;
     }
 }
+void AAdapt::DispConstTemperatureStep::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 
 //*****************************************************************************
 AAdapt::DispConstTemperatureLinear::DispConstTemperatureLinear(int neq_, int numDim_,
@@ -361,6 +404,10 @@ void AAdapt::DispConstTemperatureLinear::compute(double* x, const double* X) {
     // assign temperature
     x[3] = b + m * X[coord];
 }
+void AAdapt::DispConstTemperatureLinear::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 
 //*****************************************************************************
 AAdapt::TemperatureLinear::TemperatureLinear(int neq_, int numDim_,
@@ -417,6 +464,10 @@ void AAdapt::TemperatureLinear::compute(double* x, const double* X) {
     // assign temperature
     x[0] = b + m * X[coord];
 }
+void AAdapt::TemperatureLinear::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 
 //*****************************************************************************
 // Private convenience function
@@ -518,6 +569,10 @@ AAdapt::GaussSin::GaussSin(int neq_, int numDim_, Teuchos::Array<double> data_)
 void AAdapt::GaussSin::compute(double* x, const double* X) {
   x[0] =     sin(pi * X[0]) + 0.5 * data[0] * X[0] * (1.0 - X[0]);
 }
+void AAdapt::GaussSin::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 
 //*****************************************************************************
 AAdapt::GaussCos::GaussCos(int neq_, int numDim_, Teuchos::Array<double> data_)
@@ -530,6 +585,10 @@ AAdapt::GaussCos::GaussCos(int neq_, int numDim_, Teuchos::Array<double> data_)
 void AAdapt::GaussCos::compute(double* x, const double* X) {
   x[0] = 1 + cos(2 * pi * X[0]) + 0.5 * data[0] * X[0] * (1.0 - X[0]);
 }
+void AAdapt::GaussCos::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::LinearY::LinearY(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -544,6 +603,10 @@ void AAdapt::LinearY::compute(double* x, const double* X) {
 
   if(numDim > 2) x[2] = 0.0;
 }
+void AAdapt::LinearY::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::Linear::Linear(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -562,6 +625,10 @@ void AAdapt::Linear::compute(double* x, const double* X) {
     x[eq] = s;
   }
 }
+void AAdapt::Linear::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::ConstantBox::ConstantBox(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -585,6 +652,10 @@ void AAdapt::ConstantBox::compute(double* x, const double* X) {
     }
   }
 }
+void AAdapt::ConstantBox::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::AboutZ::AboutZ(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -599,6 +670,10 @@ void AAdapt::AboutZ::compute(double* x, const double* X) {
 
   if(neq > 2) x[2] = 0.0;
 }
+void AAdapt::AboutZ::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::RadialZ::RadialZ(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -613,6 +688,10 @@ void AAdapt::RadialZ::compute(double* x, const double* X) {
 
   if(neq > 2) x[2] = 0.0;
 }
+void AAdapt::RadialZ::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::AboutLinearZ::AboutLinearZ(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -626,6 +705,10 @@ void AAdapt::AboutLinearZ::compute(double* x, const double* X) {
   x[1] =  data[0] * X[0] * X[2];
   x[2] = 0.0;
 }
+void AAdapt::AboutLinearZ::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::GaussianZ::GaussianZ(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -645,6 +728,10 @@ void AAdapt::GaussianZ::compute(double* x, const double* X) {
   x[1] = 0.0;
   x[2] =  a * std::exp(- d * d / c / c / 2.0);
 }
+void AAdapt::GaussianZ::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::Circle::Circle(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -668,6 +755,10 @@ void AAdapt::Circle::compute(double* x, const double* X) {
     x[2] = 0.0; 
   }*/
 }
+void AAdapt::Circle::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::GaussianPress::GaussianPress(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -683,6 +774,10 @@ void AAdapt::GaussianPress::compute(double* x, const double* X) {
 
   x[neq - 1] = data[0] * exp(-data[1] * ((X[0] - data[2]) * (X[0] - data[2]) + (X[1] - data[3]) * (X[1] - data[3])));
 }
+void AAdapt::GaussianPress::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::SinCos::SinCos(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -696,6 +791,10 @@ void AAdapt::SinCos::compute(double* x, const double* X) {
   x[1] = cos(2.0 * pi * X[0]) * sin(2.0 * pi * X[1]);
   x[2] = sin(2.0 * pi * X[0]) * sin(2.0 * pi * X[1]);
 }
+void AAdapt::SinCos::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::SinScalar::SinScalar(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -710,6 +809,10 @@ void AAdapt::SinScalar::compute(double* x, const double* X) {
     x[0] *= sin(pi / data[dim] * X[dim]);
   }
 }
+void AAdapt::SinScalar::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::TaylorGreenVortex::TaylorGreenVortex(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
@@ -724,6 +827,10 @@ void AAdapt::TaylorGreenVortex::compute(double* x, const double* X) {
   x[2] = sin(2.0 * pi * X[0]) * cos(2.0 * pi * X[1]); //initial v-velocity
   x[3] = cos(2.0 * pi * X[0]) + cos(2.0 * pi * X[1]); //initial temperature
 }
+void AAdapt::TaylorGreenVortex::computeBatch(int numPoints, int neq, int numDim,
+    double* x, const double* X) {
+  parallelCompute(*this, numPoints, neq, numDim, x, X);
+}
 //*****************************************************************************
 AAdapt::AcousticWave::AcousticWave(int neq_, int numDim_, Teuchos::Array<double> data_)
   : numDim(numDim_), neq(neq_), data(data_) {
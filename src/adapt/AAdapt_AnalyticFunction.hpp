@@ -30,6 +30,12 @@ class AnalyticFunction {
   public:
     virtual ~AnalyticFunction() {}
     virtual void compute(double* x, const double* X) = 0;
+
+    // Evaluate at numPoints points stored point-major: point p reads
+    // X[p*numDim..] and updates x[p*neq..]. The default calls compute on each
+    // point in turn; functions without internal state run them in parallel.
+    virtual void computeBatch(int numPoints, int neq, int numDim,
+                              double* x, const double* X);
 };
 
 // Factory method to build functions based on a string name
@@ -43,6 +49,8 @@ class ConstantFunction : public AnalyticFunction {
   public:
     ConstantFunction(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -53,6 +61,8 @@ class StepX : public AnalyticFunction {
   public:
     StepX(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -63,6 +73,8 @@ class TemperatureStep : public AnalyticFunction {
   public:
     TemperatureStep(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -73,6 +85,8 @@ class DispConstTemperatureStep : public AnalyticFunction {
   public:
     DispConstTemperatureStep(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -83,6 +97,8 @@ class TemperatureLinear : public AnalyticFunction {
   public:
     TemperatureLinear(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector Y
     int neq;    // size of solution vector
@@ -93,6 +109,8 @@ class DispConstTemperatureLinear : public AnalyticFunction {
   public:
     DispConstTemperatureLinear(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector Y
     int neq;    // size of solution vector
@@ -137,6 +155,8 @@ class GaussSin : public AnalyticFunction {
   public:
     GaussSin(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -147,6 +167,8 @@ class GaussCos : public AnalyticFunction {
   public:
     GaussCos(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -157,6 +179,8 @@ class LinearY : public AnalyticFunction {
   public:
     LinearY(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -167,6 +191,8 @@ class Linear : public AnalyticFunction {
   public:
     Linear(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -177,6 +203,8 @@ class ConstantBox : public AnalyticFunction {
   public:
   ConstantBox(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -187,6 +215,8 @@ class AboutZ : public AnalyticFunction {
   public:
     AboutZ(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -197,6 +227,8 @@ class RadialZ : public AnalyticFunction {
   public:
     RadialZ(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -207,6 +239,8 @@ class AboutLinearZ : public AnalyticFunction {
   public:
     AboutLinearZ(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -217,6 +251,8 @@ class GaussianZ : public AnalyticFunction {
   public:
   GaussianZ(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -227,6 +263,8 @@ class Circle : public AnalyticFunction {
   public:
     Circle(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -237,6 +275,8 @@ class GaussianPress : public AnalyticFunction {
   public:
     GaussianPress(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -247,6 +287,8 @@ class SinCos : public AnalyticFunction {
   public:
     SinCos(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -257,6 +299,8 @@ class SinScalar : public AnalyticFunction {
   public:
     SinScalar(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -267,6 +311,8 @@ class TaylorGreenVortex : public AnalyticFunction {
   public:
     TaylorGreenVortex(int neq_, int numDim_, Teuchos::Array<double> data_);
     void compute(double* x, const double* X);
+    void computeBatch(int numPoints, int neq, int numDim,
+                      double* x, const double* X);
   private:
     int numDim; // size of coordinate vector X
     int neq;    // size of solution vector x
@@ -9,10 +9,13 @@
 #include "AAdapt_SPRSizeField.hpp"
 #include "AAdapt_ConstantSizeField.hpp"
 
+#include <apfMDS.h>
+
 namespace AAdapt {
 
 ExtrudedAdapt::ExtrudedAdapt(const Teuchos::RCP<Albany::APFDiscretization>& disc):
-  MeshAdaptMethod(disc) {
+  MeshAdaptMethod(disc),
+  column_order(0) {
   mesh = mesh_struct->getMesh();
   model_extrusions.push_back(ma::ModelExtrusion(
         mesh->findModelEntity(1, 2),
@@ -84,11 +87,50 @@ void ExtrudedAdapt::postProcessShrunkenMesh() {
 
 void ExtrudedAdapt::postProcessFinalMesh() {
   std::cerr << "post-processing final (extrude)...\n";
+  /* one flat field per layer holds the position of the vertex in a
+     column-major order; the extrusion assembles them into one field
+     like it does for the solution */
+  for (size_t l = 0; l < nlayers; ++l) {
+    apf::Field* f = apf::createFieldOn(mesh,
+        ma::getFlatName("column_order", l).c_str(), apf::SCALAR);
+    apf::MeshIterator* it = mesh->begin(0);
+    apf::MeshEntity* v;
+    double column = 0;
+    while ((v = mesh->iterate(it))) {
+      apf::setScalar(f, v, 0, column * nlayers + l);
+      ++column;
+    }
+    mesh->end(it);
+  }
   ma::extrude(mesh, model_extrusions, nlayers);
+  column_order = mesh->findField("column_order");
   std::cerr << "extrusion done.\n";
   std::cerr << "mesh dim is now " << mesh->getDimension() << ", "
     << mesh->count(0) << " vertices, "
     << mesh->count(mesh->getDimension()) << " elements.\n";
 }
 
+void ExtrudedAdapt::reorderMesh() {
+  if (!column_order) {
+    MeshAdaptMethod::reorderMesh();
+    return;
+  }
+  /* The vertices of a column are consecutive, as the layered numbering of
+     extruded STK meshes makes them, so the rows a column couples to are
+     contiguous in the rebuilt maps and graph */
+  apf::MeshTag* order = mesh->createIntTag("column_order", 1);
+  apf::MeshIterator* it = mesh->begin(0);
+  apf::MeshEntity* v;
+  while ((v = mesh->iterate(it))) {
+    int o = static_cast<int>(apf::getScalar(column_order, v, 0));
+    mesh->setIntTag(v, order, &o);
+  }
+  mesh->end(it);
+  apf::destroyField(column_order);
+  column_order = 0;
+  apf::reorderMdsMesh(mesh, order);
+  apf::removeTagFromDimension(mesh, order, 0);
+  mesh->destroyTag(order);
+}
+
 }
@@ -27,11 +27,16 @@ class ExtrudedAdapt : public MeshAdaptMethod {
     void postProcessShrunkenMesh();
     void postProcessFinalMesh();
 
+    //! Number the vertices column by column, bottom to top
+    void reorderMesh();
+
   private:
     MeshAdaptMethod* helper;
     ma::Mesh* mesh;
     ma::ModelExtrusions model_extrusions;
     size_t nlayers;
+    //! Column-major vertex order, carried through the extrusion
+    apf::Field* column_order;
 };
 
 }
@@ -7,6 +7,7 @@
 
 
 #include <cmath>
+#include <vector>
 
 #include <Teuchos_CommHelpers.hpp>
 
@@ -18,6 +19,43 @@ namespace AAdapt {
 
 const double pi = 3.141592653589793;
 
+namespace {
+
+// Evaluates f once per node reached by the worksets, instead of once per
+// element node, and stores the result in soln (indexed by local dof id).
+// The current values of soln are passed to f as the starting x.
+void computeAtNodes(AnalyticFunction& f, double* soln, const int solnLength,
+                    const Albany::AbstractDiscretization::Conn& wsElNodeEqID,
+                    const Teuchos::ArrayRCP<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > >& coords,
+                    const int neq, const int numDim)
+{
+  std::vector<char>   visited(solnLength, 0);
+  std::vector<int>    dofs;
+  std::vector<double> x, X;
+
+  for (int ws=0; ws < wsElNodeEqID.size(); ws++) {
+    for (int el=0; el < wsElNodeEqID[ws].dimension(0); el++) {
+      for (int ln=0; ln < wsElNodeEqID[ws].dimension(1); ln++) {
+        const int lid = wsElNodeEqID[ws](el,ln,0);
+        if (visited[lid]) continue;
+        visited[lid] = 1;
+
+        for (int i=0; i<neq; i++) {
+          dofs.push_back(wsElNodeEqID[ws](el,ln,i));
+          x.push_back(soln[dofs.back()]);
+        }
+        for (int i=0; i<numDim; i++) X.push_back(coords[ws][el][ln][i]);
+      }
+    }
+  }
+
+  f.computeBatch(dofs.size() / neq, neq, numDim, x.data(), X.data());
+
+  for (std::size_t k=0; k<dofs.size(); k++) soln[dofs[k]] = x[k];
+}
+
+} // namespace
+
 
 Teuchos::RCP<const Teuchos::ParameterList>
 getValidInitialConditionParameters(const Teuchos::ArrayRCP<std::string>& wsEBNames) {
@@ -215,22 +253,8 @@ wsElNodeEqID[ws](el,ln,5) = DOF[1],eq[2] (z eqn)
 
     Teuchos::RCP<AAdapt::AnalyticFunction> initFunc = Teuchos::rcp(new AAdapt::ExpressionParser(neq, numDim, expressionX, expressionY, expressionZ));
 
-    // Loop over all worksets, elements, all local nodes: compute soln as a function of coord
-    std::vector<double> x(neq);
-
-    for(int ws = 0; ws < wsElNodeEqID.size(); ws++) {
-      for(int el = 0; el < wsElNodeEqID[ws].dimension(0); el++) {
-        for(int ln = 0; ln < wsElNodeEqID[ws].dimension(1); ln++) {
-          const double* X = coords[ws][el][ln];
-
-          for(int i = 0; i < neq; i++) x[i] = (*soln)[wsElNodeEqID[ws](el,ln,i)];
-
-          initFunc->compute(&x[0], X);
-
-          for(int i = 0; i < neq; i++)(*soln)[wsElNodeEqID[ws](el,ln,i)] = x[i];
-        }
-      }
-    }
+    // Compute soln as a function of coord at every local node
+    computeAtNodes(*initFunc, soln->Values(), soln->MyLength(), wsElNodeEqID, coords, neq, numDim);
 
   }
 
@@ -243,22 +267,8 @@ wsElNodeEqID[ws](el,ln,5) = DOF[1],eq[2] (z eqn)
     Teuchos::RCP<AAdapt::AnalyticFunction> initFunc
       = createAnalyticFunction(name, neq, numDim, data);
 
-    // Loop over all worksets, elements, all local nodes: compute soln as a function of coord
-    std::vector<double> x(neq);
-
-    for(int ws = 0; ws < wsElNodeEqID.size(); ws++) {
-      for(int el = 0; el < wsElNodeEqID[ws].dimension(0); el++) {
-        for(int ln = 0; ln < wsElNodeEqID[ws].dimension(1); ln++) {
-          const double* X = coords[ws][el][ln];
-
-          for(int i = 0; i < neq; i++) x[i] = (*soln)[wsElNodeEqID[ws](el,ln,i)];
-
-          initFunc->compute(&x[0], X);
-
-          for(int i = 0; i < neq; i++)(*soln)[wsElNodeEqID[ws](el,ln,i)] = x[i];
-        }
-      }
-    }
+    // Compute soln as a function of coord at every local node
+    computeAtNodes(*initFunc, soln->Values(), soln->MyLength(), wsElNodeEqID, coords, neq, numDim);
 
   }
 
@@ -420,16 +430,9 @@ void InitialConditionsT(const Teuchos::RCP<Tpetra_Vector>& solnT,
 
     Teuchos::RCP<AAdapt::AnalyticFunction> initFunc = Teuchos::rcp(new AAdapt::ExpressionParser(neq, numDim, expressionX, expressionY, expressionZ));
 
-    // Loop over all worksets, elements, all local nodes: compute soln as a function of coord
-    std::vector<double> x; x.resize(neq);
-    for (int ws=0; ws < wsElNodeEqID.size(); ws++) {
-      for (int el=0; el < wsElNodeEqID[ws].dimension(0); el++) {
-        for (int ln=0; ln < wsElNodeEqID[ws].dimension(1); ln++) {
-          const double* X = coords[ws][el][ln];
-          for (int i=0; i<neq; i++) x[i] = solnT_nonconstView[wsElNodeEqID[ws](el,ln,i)];
-          initFunc->compute(&x[0],X);
-          for (int i=0; i<neq; i++) solnT_nonconstView[wsElNodeEqID[ws](el,ln,i)] = x[i];
-    } } }
+    // Compute soln as a function of coord at every local node
+    computeAtNodes(*initFunc, solnT_nonconstView.getRawPtr(), solnT_nonconstView.size(),
+                   wsElNodeEqID, coords, neq, numDim);
 
   }
 
@@ -442,16 +445,9 @@ void InitialConditionsT(const Teuchos::RCP<Tpetra_Vector>& solnT,
     Teuchos::RCP<AAdapt::AnalyticFunction> initFunc
       = createAnalyticFunction(name, neq, numDim, data);
   
-    // Loop over all worksets, elements, all local nodes: compute soln as a function of coord
-    std::vector<double> x; x.resize(neq);
-    for (int ws=0; ws < wsElNodeEqID.size(); ws++) {
-      for (int el=0; el < wsElNodeEqID[ws].dimension(0); el++) {
-        for (int ln=0; ln < wsElNodeEqID[ws].dimension(1); ln++) {
-          const double* X = coords[ws][el][ln];
-          for (int i=0; i<neq; i++) x[i] = solnT_nonconstView[wsElNodeEqID[ws](el,ln,i)];
-          initFunc->compute(&x[0],X);
-          for (int i=0; i<neq; i++) solnT_nonconstView[wsElNodeEqID[ws](el,ln,i)] = x[i];
-    } } }
+    // Compute soln as a function of coord at every local node
+    computeAtNodes(*initFunc, solnT_nonconstView.getRawPtr(), solnT_nonconstView.size(),
+                   wsElNodeEqID, coords, neq, numDim);
 
   }
 
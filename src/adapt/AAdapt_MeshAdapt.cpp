@@ -4,7 +4,10 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
+#include <map>
 
 #include <Teuchos_DefaultComm.hpp>
 #include <Teuchos_CommHelpers.hpp>
@@ -14,7 +17,6 @@
 #include <PCU.h>
 #include <parma.h>
 #include <apfZoltan.h>
-#include <apfMDS.h> // for reorderMdsMesh
 
 #include "AAdapt_ConstantSizeField.hpp"
 #include "AAdapt_ScaledSizeField.hpp"
@@ -133,6 +135,8 @@ bool AAdapt::MeshAdapt::queryAdaptationCriteria(int iteration)
         return true;
     return false;
   }
+  if (strategy == "Error Indicator")
+    return iteration > 1 && checkErrorIndicator();
   if (strategy == "PLDriven") {
     if(adapt_params_->get<bool>("AdaptNow", false)){
       adapt_params_->set<bool>("AdaptNow", false);
@@ -145,6 +149,65 @@ bool AAdapt::MeshAdapt::queryAdaptationCriteria(int iteration)
   return false;
 }
 
+/* Cheap test run at every adaptation check, so that the size field and
+ * ma::adapt only run when the QP states have drifted enough since the last
+ * adaptation. An element has changed when the norm of its indicator state
+ * moved by more than "Element Change Tolerance" relative to its value at the
+ * last adaptation; the mesh is adapted once more than "Changed Element
+ * Fraction" of all the elements have changed. The reference norms are only
+ * reset by an adaptation, so slow drifts accumulate.
+ */
+bool AAdapt::MeshAdapt::checkErrorIndicator()
+{
+  const std::string name = adapt_params_->get<std::string>("Error Indicator State",
+      adapt_params_->get<std::string>("State Variable", ""));
+  TEUCHOS_TEST_FOR_EXCEPTION(name.empty(), std::logic_error,
+      "Remesh Strategy Error Indicator needs an \"Error Indicator State\"\n");
+  const double tol = adapt_params_->get<double>("Element Change Tolerance", 0.1);
+  const double fraction = adapt_params_->get<double>("Changed Element Fraction", 0.05);
+
+  Albany::StateArrayVec& esa = disc->getStateArrays().elemStateArrays;
+  const bool reset = indicator_norms.size() != esa.size();
+  if (reset)
+    indicator_norms.resize(esa.size());
+
+  long local[2] = {0, 0};
+  for (std::size_t ws = 0; ws < esa.size(); ++ws) {
+    Albany::StateArray::iterator it = esa[ws].find(name);
+    TEUCHOS_TEST_FOR_EXCEPTION(it == esa[ws].end(), std::logic_error,
+        "Error Indicator State \"" << name << "\" is not a state variable\n");
+    const Albany::MDArray& state = it->second;
+    const std::size_t numCells = state.dimension(0);
+    const std::size_t perCell = numCells > 0 ? state.size() / numCells : 0;
+    const double* data = state.contiguous_data();
+
+    std::vector<double>& norms = indicator_norms[ws];
+    const bool fresh = reset || norms.size() != numCells;
+    if (fresh)
+      norms.resize(numCells);
+
+    for (std::size_t cell = 0; cell < numCells; ++cell) {
+      double norm = 0.0;
+      for (std::size_t k = 0; k < perCell; ++k)
+        norm += data[cell*perCell + k] * data[cell*perCell + k];
+      norm = std::sqrt(norm);
+      if (fresh)
+        norms[cell] = norm;
+      else if (std::abs(norm - norms[cell]) > tol * std::max(norms[cell], 1e-12))
+        ++local[0];
+    }
+    local[1] += numCells;
+  }
+
+  long global[2] = {0, 0};
+  Teuchos::reduceAll(*teuchos_comm_, Teuchos::REDUCE_SUM, 2, local, global);
+
+  const bool adapt = global[1] > 0 && global[0] > fraction * global[1];
+  *output_stream_ << "Error indicator: " << global[0] << " of " << global[1]
+                  << " elements changed, " << (adapt ? "adapting" : "not adapting")
+                  << std::endl;
+  return adapt;
+}
 
 void AAdapt::MeshAdapt::initAdapt()
 {
@@ -206,11 +269,44 @@ namespace {
     m->end(it);
   }
 
-  void runParmaVtxElm(ma::Mesh* m, double maxImb)
+  /* Weigh each element by the relative assembly cost of its element block,
+   * e.g. the cost of its material model and QP states. Blocks that are not
+   * listed weigh 1. */
+  void setBlockElmWeights(ma::Mesh* m, ma::Tag* weights,
+                          apf::StkModels& sets,
+                          Teuchos::ParameterList const& blockWeights)
+  {
+    const int dim = m->getDimension();
+    std::map<apf::ModelEntity*, double> modelWeights;
+    ma::Entity* e;
+    apf::MeshIterator* it = m->begin(dim);
+    while ((e = m->iterate(it))) {
+      apf::ModelEntity* mr = m->toModel(e);
+      std::map<apf::ModelEntity*, double>::iterator w = modelWeights.find(mr);
+      if (w == modelWeights.end()) {
+        apf::StkModel* block = sets.invMaps[dim][mr];
+        double weight = 1.0;
+        if (block && blockWeights.isParameter(block->stkName))
+          weight = blockWeights.get<double>(block->stkName);
+        TEUCHOS_TEST_FOR_EXCEPTION(weight <= 0, std::logic_error,
+            "Element block load weights must be positive" << std::endl);
+        w = modelWeights.insert(std::make_pair(mr, weight)).first;
+      }
+      m->setDoubleTag(e,weights,&w->second);
+    }
+    m->end(it);
+  }
+
+  void runParmaVtxElm(ma::Mesh* m, double maxImb,
+                      apf::StkModels& sets,
+                      Teuchos::ParameterList const* blockWeights)
   {
     ma::Tag* weights = m->createDoubleTag("ma_weight",1);
     setUnitEntWeights(m,weights,0);
-    setUnitEntWeights(m,weights,m->getDimension());
+    if (blockWeights)
+      setBlockElmWeights(m,weights,sets,*blockWeights);
+    else
+      setUnitEntWeights(m,weights,m->getDimension());
     apf::Balancer* b = Parma_MakeVtxElmBalancer(m);
     b->balance(weights,maxImb);
     delete b;
@@ -219,9 +315,16 @@ namespace {
     m->destroyTag(weights);
   }
 
-  void runZoltanBal(ma::Mesh* m, double maxImb)
+  void runZoltanBal(ma::Mesh* m, double maxImb,
+                    apf::StkModels& sets,
+                    Teuchos::ParameterList const* blockWeights)
   {
-    ma::Tag* weights = Parma_WeighByMemory(m);
+    ma::Tag* weights;
+    if (blockWeights) {
+      weights = m->createDoubleTag("ma_weight",1);
+      setBlockElmWeights(m,weights,sets,*blockWeights);
+    } else
+      weights = Parma_WeighByMemory(m);
     apf::Balancer* b = makeZoltanBalancer(m, apf::GRAPH, apf::REPARTITION);
     b->balance(weights,maxImb);
     delete b;
@@ -229,11 +332,13 @@ namespace {
     m->destroyTag(weights);
   }
 
-  void postBalance(ma::Mesh* m, std::string const& method, double maxImb) {
+  void postBalance(ma::Mesh* m, std::string const& method, double maxImb,
+                   apf::StkModels& sets,
+                   Teuchos::ParameterList const* blockWeights) {
     if (method == "zoltan") {
-      runZoltanBal(m, maxImb);
+      runZoltanBal(m, maxImb, sets, blockWeights);
     } else if (method == "parma") {
-      runParmaVtxElm(m, maxImb);
+      runParmaVtxElm(m, maxImb, sets, blockWeights);
     } else if (method == "none") {
     } else {
       TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
@@ -252,13 +357,18 @@ void AAdapt::MeshAdapt::afterAdapt()
     adapt_params_->get<Teuchos::Array<std::string> >(
         "Load Balancing", defaultStArgs);
   double maxImb = adapt_params_->get<double>("Maximum LB Imbalance", 1.30);
-  postBalance(mesh, loadBalancing[2], maxImb);
+  Teuchos::ParameterList const* blockWeights =
+    adapt_params_->isSublist("Element Block Load Weights") ?
+    &adapt_params_->sublist("Element Block Load Weights") : 0;
+  postBalance(mesh, loadBalancing[2], maxImb,
+              pumi_discretization->getPUMIMeshStruct()->getSets(),
+              blockWeights);
 
   szField->postProcessFinalMesh();
 
   mesh->verify();
 
-  apf::reorderMdsMesh(mesh);
+  szField->reorderMesh();
 
   if (adapt_params_->get<bool>("Write Adapted SMB Files", false)) {
     std::ostringstream smbOutName;
@@ -277,6 +387,9 @@ void AAdapt::MeshAdapt::afterAdapt()
   if (should_transfer_ip_data)
     pumi_discretization->detachQPData();
 
+  // The error indicator is measured from the states on the new mesh
+  indicator_norms.clear();
+
   ncalls++;
 }
 
@@ -508,6 +621,9 @@ AAdapt::MeshAdapt::getValidAdapterParameters() const
 
   validPL->set<Teuchos::Array<int> >("Remesh Step Number", defaultArgs, "Iteration step at which to remesh the problem");
   validPL->set<std::string>("Remesh Strategy", "", "Strategy to use when remeshing: Continuous - remesh every step.");
+  validPL->set<std::string>("Error Indicator State", "", "QP state measured by the Error Indicator remesh strategy, defaults to State Variable");
+  validPL->set<double>("Element Change Tolerance", 0.1, "Relative change of an element's indicator state that counts it as changed");
+  validPL->set<double>("Changed Element Fraction", 0.05, "Fraction of changed elements that triggers adaptation");
   validPL->set<bool>("AdaptNow", false, "Used to force an adaptation step");
   validPL->set<bool>("Should Coarsen", true, "Set to false to disable mesh coarsening operations.");
   validPL->set<int>("Max Number of Mesh Adapt Iterations", 1, "Number of iterations to limit meshadapt to");
@@ -518,6 +634,7 @@ AAdapt::MeshAdapt::getValidAdapterParameters() const
   validPL->set<std::string>("State Variable", "", "SPR operates on this variable");
   validPL->set<Teuchos::Array<std::string> >("Load Balancing", defaultStArgs, "Turn on predictive load balancing");
   validPL->set<double>("Maximum LB Imbalance", 1.3, "Set maximum imbalance tolerance for predictive laod balancing");
+  validPL->sublist("Element Block Load Weights", false, "Relative assembly cost of an element of each element block, used as element weights when balancing after adaptation");
   validPL->set<std::string>("Adaptation Displacement Vector", "", "Name of APF displacement field");
   validPL->set<bool>("Transfer IP Data", false, "Turn on solution transfer of integration point data");
   validPL->set<double>("Minimum Part Density", 1000, "Minimum elements per part: triggers partition shrinking");
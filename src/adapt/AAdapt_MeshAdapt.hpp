@@ -7,6 +7,8 @@
 #ifndef AADAPT_MESHADAPT_HPP
 #define AADAPT_MESHADAPT_HPP
 
+#include <vector>
+
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_ParameterList.hpp"
 
@@ -68,6 +70,12 @@ private:
 
   bool should_transfer_ip_data;
 
+  //! Per-element norms of the indicator state at the last adaptation,
+  //! by workset
+  std::vector<std::vector<double> > indicator_norms;
+
+  bool checkErrorIndicator();
+
   Teuchos::RCP<rc::Manager> rc_mgr;
 
   void initRcMgr();
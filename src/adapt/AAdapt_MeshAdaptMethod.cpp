@@ -6,6 +6,8 @@
 
 #include "AAdapt_MeshAdaptMethod.hpp"
 
+#include <apfMDS.h>
+
 namespace AAdapt {
 
 MeshAdaptMethod::MeshAdaptMethod(
@@ -16,6 +18,10 @@ MeshAdaptMethod::MeshAdaptMethod(
 {
 }
 
+void MeshAdaptMethod::reorderMesh() {
+  apf::reorderMdsMesh(mesh_struct->getMesh());
+}
+
 void MeshAdaptMethod::setCommonMeshAdaptOptions(
     const Teuchos::RCP<Teuchos::ParameterList>& adapt_params_,
     ma::Input *in) {
@@ -30,6 +30,11 @@ struct MeshAdaptMethod {
   virtual void postProcessShrunkenMesh() = 0;
   virtual void postProcessFinalMesh() = 0;
 
+  //! Reorder the entities of the final mesh before the discretization is
+  //! rebuilt from it. The default is the breadth-first order of
+  //! apf::reorderMdsMesh.
+  virtual void reorderMesh();
+
 protected:
 
   Teuchos::RCP<Albany::APFDiscretization> apf_disc;
@@ -41,13 +41,19 @@ void Omega_h_Method::preProcessShrunkenMesh() {
 
 void Omega_h_Method::adaptMesh(const Teuchos::RCP<Teuchos::ParameterList>& adapt_params_) {
   apf::to_omega_h(&mesh_osh, mesh_apf);
-  apf::clear(mesh_apf);
   mesh_osh.set_parting(OMEGA_H_GHOSTED);
   Omega_h::add_implied_metric_tag(&mesh_osh);
   Omega_h::generate_target_metric_tag(&mesh_osh, metric_opts);
-  while (Omega_h::approach_metric(&mesh_osh, adapt_opts)) {
-    Omega_h::adapt(&mesh_osh, adapt_opts);
+  // If the mesh already satisfies the target metric nothing is adapted,
+  // so keep the APF mesh and skip the conversion back
+  if (!Omega_h::approach_metric(&mesh_osh, adapt_opts)) {
+    mesh_osh = Omega_h::Mesh(&library_osh);
+    return;
   }
+  apf::clear(mesh_apf);
+  do {
+    Omega_h::adapt(&mesh_osh, adapt_opts);
+  } while (Omega_h::approach_metric(&mesh_osh, adapt_opts));
   apf::from_omega_h(mesh_apf, &mesh_osh);
   mesh_osh = Omega_h::Mesh(&library_osh);
 }
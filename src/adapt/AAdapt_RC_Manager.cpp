@@ -129,12 +129,13 @@ void transformStateArray (const unsigned int wi, const Direction::Enum dir,
     }
   } break;
   case Transformation::right_polar_LieR_LieS: {
+    // Local tensors, reused over all (cell, qp).
+    minitensor::Tensor<RealType> F(mda1.dimension(2)), RS[2];
+    minitensor::Tensor<RealType> R(mda1.dimension(2)), S(mda2.dimension(2));
     loop(mda1, cell, 0) loop(mda1, qp, 1) {
       if (dir == Direction::G2g) {
         // Copy mda2 (provisional) -> local.
-        minitensor::Tensor<RealType> F(mda1.dimension(2));
         loop(mda2, i, 2) loop(mda2, j, 3) F(i, j) = mda2(cell, qp, i, j);
-        minitensor::Tensor<RealType> RS[2];
         calc_right_polar_LieR_LieS_G2g(F, RS);
         // Copy local -> mda1, mda2.
         loop(mda1, i, 2) loop(mda1, j, 3) {
@@ -143,7 +144,6 @@ void transformStateArray (const unsigned int wi, const Direction::Enum dir,
         }
       } else {
         // Copy mda1,2 -> local.
-        minitensor::Tensor<RealType> R(mda1.dimension(2)), S(mda2.dimension(2));
         loop(mda1, i, 2) loop(mda1, j, 3) {
           R(i, j) = mda1(cell, qp, i, j);
           S(i, j) = mda2(cell, qp, i, j);
@@ -211,21 +211,21 @@ fillMassMatrix (const PHAL::Workset& workset, const BasisField& bf,
   filled_[workset.wsIndex] = true;
 
   const size_type num_node = bf.dimension(1), num_qp = bf.dimension(2);
-  for (unsigned int cell = 0; cell < workset.numCells; ++cell)
+  Teuchos::Array<Tpetra_GO> cols(num_node);
+  Teuchos::Array<ST> vals(num_node);
+  for (unsigned int cell = 0; cell < workset.numCells; ++cell) {
+    for (size_type cnode = 0; cnode < num_node; ++cnode)
+      cols[cnode] = workset.wsElNodeID[cell][cnode];
     for (size_type rnode = 0; rnode < num_node; ++rnode) {
-      const GO row = workset.wsElNodeID[cell][rnode];
-      Teuchos::Array<Tpetra_GO> cols;
-      Teuchos::Array<ST> vals;
       for (size_type cnode = 0; cnode < num_node; ++cnode) {
-        const GO col = workset.wsElNodeID[cell][cnode];
-        cols.push_back(col);
         ST v = 0;
         for (size_type qp = 0; qp < num_qp; ++qp)
           v += wbf(cell, rnode, qp) * bf(cell, cnode, qp);
-        vals.push_back(v);
+        vals[cnode] = v;
       }
-      M_->insertGlobalValues(row, cols, vals);
+      M_->insertGlobalValues(cols[rnode], cols, vals);
     }
+  }
 }
 
 void Projector::
@@ -243,46 +243,57 @@ fillRhs (const PHX::MDField<const RealType>& f_G_qp, Manager::Field& f,
         new Tpetra_MultiVector(ol_node_map_, ncol, true));
   }
 
+  switch (rank) {
+  case 0:
+  case 1:
+    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "!impl");
+    break;
+  case 2:
+    break;
+  default:
+    std::stringstream ss;
+    ss << "invalid rank: " << f.name << " with rank " << rank;
+    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, ss.str());
+  }
+
+  // Sum directly into the local data of the overlapping MVs. The g values at a
+  // QP do not depend on the node, so transform once per QP.
+  const int nmv = f.num_g_fields;
+  Teuchos::ArrayRCP< Teuchos::ArrayRCP<RealType> > mv[2];
+  for (int fi = 0; fi < nmv; ++fi) mv[fi] = f.data_->mv[fi]->get2dViewNonConst();
+  std::vector<LO> rows(num_node);
+  minitensor::Tensor<RealType> F(ndim), RS[2];
+
   const Transformation::Enum transformation = f.data_->transformation;
-  for (int cell = 0; cell < (int) workset.numCells; ++cell)
-    for (int node = 0; node < num_node; ++node) {
-      const GO row = workset.wsElNodeID[cell][node];
-      for (int qp = 0; qp < num_qp; ++qp) {
-        switch (rank) {
-        case 0:
-        case 1:
-          TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "!impl");
-          break;
-        case 2: {
-          switch (transformation) {
-          case Transformation::none: {
+  for (int cell = 0; cell < (int) workset.numCells; ++cell) {
+    for (int node = 0; node < num_node; ++node)
+      rows[node] = ol_node_map_->getLocalElement(
+        workset.wsElNodeID[cell][node]);
+    for (int qp = 0; qp < num_qp; ++qp) {
+      switch (transformation) {
+      case Transformation::none: {
+        for (int node = 0; node < num_node; ++node) {
+          const RealType w = wbf(cell, node, qp);
+          for (int i = 0, col = 0; i < ndim; ++i)
+            for (int j = 0; j < ndim; ++j, ++col)
+              mv[0][col][rows[node]] += f_G_qp(cell, qp, i, j) * w;
+        }
+      } break;
+      case Transformation::right_polar_LieR_LieS: {
+        loop(f_G_qp, i, 2) loop(f_G_qp, j, 3)
+          F(i, j) = f_G_qp(cell, qp, i, j);
+        calc_right_polar_LieR_LieS_G2g(F, RS);
+        for (int node = 0; node < num_node; ++node) {
+          const RealType w = wbf(cell, node, qp);
+          for (int fi = 0; fi < nmv; ++fi)
             for (int i = 0, col = 0; i < ndim; ++i)
               for (int j = 0; j < ndim; ++j, ++col)
-                f.data_->mv[0]->sumIntoGlobalValue(
-                  row, col, f_G_qp(cell, qp, i, j) * wbf(cell, node, qp));
-          } break;
-          case Transformation::right_polar_LieR_LieS: {
-            minitensor::Tensor<RealType> F(ndim);
-            loop(f_G_qp, i, 2) loop(f_G_qp, j, 3)
-              F(i, j) = f_G_qp(cell, qp, i, j);
-            minitensor::Tensor<RealType> RS[2];
-            calc_right_polar_LieR_LieS_G2g(F, RS);
-            for (int fi = 0; fi < f.num_g_fields; ++fi) {
-              for (int i = 0, col = 0; i < ndim; ++i)
-                for (int j = 0; j < ndim; ++j, ++col)
-                  f.data_->mv[fi]->sumIntoGlobalValue(
-                    row, col, RS[fi](i, j) * wbf(cell, node, qp));
-            }
-          } break;
-          }
-        } break;
-        default:
-          std::stringstream ss;
-          ss << "invalid rank: " << f.name << " with rank " << rank;
-          TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, ss.str());
+                mv[fi][col][rows[node]] += RS[fi](i, j) * w;
         }
+      } break;
       }
     }
+  }
 }
 
 void Projector::project (Manager::Field& f) {
@@ -334,37 +345,43 @@ interp (const Manager::Field& f, const PHAL::Workset& workset,
     num_node = bf.dimension(1), num_qp = bf.dimension(2),
     ndim = rank >= 1 ? mda1.dimension(2) : 1;
 
+  switch (rank) {
+  case 0:
+  case 1:
+    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "!impl");
+    break;
+  case 2:
+    break;
+  default:
+    std::stringstream ss;
+    ss << "invalid rank: " << f.name << " with rank " << rank;
+    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, ss.str());
+  }
+
   Albany::MDArray* mdas[2]; mdas[0] = &mda1; mdas[1] = &mda2;
   const int nmv = f.num_g_fields;
-
-  for (int cell = 0; cell < (int) workset.numCells; ++cell)
-    for (int qp = 0; qp < num_qp; ++qp) {
-      switch (rank) {
-      case 0:
-      case 1:
-        TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, "!impl");
-        break;
-      case 2: {
-        for (int i = 0; i < ndim; ++i)
-          for (int j = 0; j < ndim; ++j)
-            mda1(cell, qp, i, j) = 0;
-        for (int node = 0; node < num_node; ++node) {
-          const GO grow = workset.wsElNodeID[cell][node];
-          const LO row = ol_node_map_->getLocalElement(grow);
-          for (int i = 0, col = 0; i < ndim; ++i)
-            for (int j = 0; j < ndim; ++j, ++col)
-              for (int fi = 0; fi < nmv; ++fi)
-                (*mdas[fi])(cell, qp, i, j) +=
-                  f.data_->mv[fi]->getVector(col)->get1dView()[row] *
-                  bf(cell, node, qp);
-        }
-      } break;
-      default:
-        std::stringstream ss;
-        ss << "invalid rank: " << f.name << " with rank " << rank;
-        TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error, ss.str());
+  // Take the views of the nodal data and the local rows once rather than per
+  // entry.
+  Teuchos::ArrayRCP< Teuchos::ArrayRCP<const RealType> > mv[2];
+  for (int fi = 0; fi < nmv; ++fi) mv[fi] = f.data_->mv[fi]->get2dView();
+  std::vector<LO> rows(num_node);
+
+  for (int cell = 0; cell < (int) workset.numCells; ++cell) {
+    for (int node = 0; node < num_node; ++node)
+      rows[node] = ol_node_map_->getLocalElement(
+        workset.wsElNodeID[cell][node]);
+    for (int qp = 0; qp < num_qp; ++qp)
+      for (int fi = 0; fi < nmv; ++fi) {
+        Albany::MDArray& mda = *mdas[fi];
+        for (int i = 0, col = 0; i < ndim; ++i)
+          for (int j = 0; j < ndim; ++j, ++col) {
+            RealType v = 0;
+            for (int node = 0; node < num_node; ++node)
+              v += mv[fi][col][rows[node]] * bf(cell, node, qp);
+            mda(cell, qp, i, j) = v;
+          }
       }
-    }
+  }
 }
 
 bool Projector::is_filled (int wi) {
@@ -11,6 +11,8 @@
 #include <spr.h>
 #include <apfShape.h>
 
+#include <Teuchos_TimeMonitor.hpp>
+
 AAdapt::SPRSizeField::SPRSizeField(const Teuchos::RCP<Albany::APFDiscretization>& disc) :
   MeshAdaptMethod(disc),
   elemGIDws(disc->getElemGIDws()),
@@ -38,6 +40,12 @@ AAdapt::SPRSizeField::adaptMesh(
 void
 AAdapt::SPRSizeField::preProcessShrunkenMesh() {
 
+  // The patch recovery itself runs inside SCOREC spr; time it here so its
+  // cost can be compared against ma::adapt.
+  static Teuchos::RCP<Teuchos::Time> sprTime =
+    Teuchos::TimeMonitor::getNewTimer("Albany: SPR Error Estimate");
+  Teuchos::TimeMonitor sprTimer(*sprTime);
+
   if ( using_state ) {
     computeErrorFromStateVariable();
   } else {
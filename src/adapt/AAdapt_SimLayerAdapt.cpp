@@ -72,6 +72,10 @@ bool SimLayerAdapt::queryAdaptationCriteria(int iteration)
     return true;
   }
   /* BRD */
+  // Without adaptation of the deposited part the mesh only changes when a
+  // layer is added
+  if (!adapt_params_->get<bool>("Adapt Deposited Part", true))
+    return false;
   std::string strategy = adapt_params_->get<std::string>("Remesh Strategy", "Step Number");
   if (strategy == "None")
     return false;
@@ -477,24 +481,9 @@ bool SimLayerAdapt::adaptMesh()
     assert( res_fields[i] );
   }
 
-  /* compute the size field via SPR error estimation on the gradient
-     of the chosen solution field */
-  int spr_idx = adapt_params_->get<int>("SPR Solution Index", 0);
-  apf::Field* grad_ip_fld = spr::getGradIPField(
-      soln_fields[spr_idx], "grad_sol", apf_ms->cubatureDegree);
-  apf::Field* size_fld;
-  if (adapt_params_->isType<long int>("Target Element Count")) {
-    long N = adapt_params_->get<long int>("Target Element Count");
-    size_fld = spr::getTargetSPRSizeField(grad_ip_fld, N);
-  }
-  else if (adapt_params_->isType<double>("Error Bound")) {
-    double error_bound = adapt_params_->get<double>("Error Bound", 0.1);
-    size_fld = spr::getSPRSizeField(grad_ip_fld, error_bound);
-  }
-  else
-    TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
-        "invalid SimAdapt SPR inputs\n");
-  apf::destroyField(grad_ip_fld);
+  /* when only depositing layers, the regions already meshed are left
+     as they are and only the new layer is meshed */
+  bool should_adapt = adapt_params_->get<bool>("Adapt Deposited Part", true);
 
   /* get some layer addition information */
   double t4 = PCU_Time();
@@ -509,37 +498,10 @@ bool SimLayerAdapt::adaptMesh()
   // Use a mesh size for the current layer that is 1/3 the slice thickness
   double layerSize = adapt_params_->get<double>("Layer Mesh Size", sliceThickness / 3.0);
 
-  double max_size = adapt_params_->get<double>("Max Size", 1e10);
-  double min_size = adapt_params_->get<double>("Min Size", 1e-2);
-  double gradation = adapt_params_->get<double>("Gradation", 0.3);
-  assert(min_size <= max_size);
-
   bool should_debug = adapt_params_->get<bool>("Debug", false);
 
-  /* create the Simmetrix adapter */
-  pACase mcase = MS_newMeshCase(Simmetrix_model);
-  pModelItem domain = GM_domain(Simmetrix_model);
-  MS_setMeshCurv(mcase,domain, ONLY_CURV_TYPE, 0.025);
-  MS_setMinCurvSize(mcase,domain, ONLY_CURV_TYPE, 0.0025);
-  MS_setMeshSize(mcase,domain, RELATIVE, 1.0, NULL);
-  pMSAdapt adapter = MSA_createFromCase(mcase,sim_pm);
-  MSA_setSizeGradation(adapter, DO_GRADE, gradation);  // no broomsticks allowed
-
-  /* BRD */
-  /* copy the size field from APF to the Simmetrix adapter */
-  apf::MeshEntity* v;
-  apf::MeshIterator* it = apf_m->begin(0);
-  while ((v = apf_m->iterate(it))) {
-    double size = apf::getScalar(size_fld, v, 0);
-    size = std::min(max_size, size);
-    size = std::max(min_size, size);
-    MSA_setVertexSize(adapter, (pVertex) v, size);
-    apf::setScalar(size_fld, v, 0, size);
-  }
-  apf_m->end(it);
-
-  /* tell the Simmetrix adapter to transfer the soln/residual fields &
-     old temperature field (if specified) */
+  /* the soln/residual fields & old temperature field (if specified)
+     are transferred by the Simmetrix adapter and extended to the new layer */
   std::vector<pField> sim_soln_fields;
   std::vector<pField> sim_res_fields;
   pField sim_told_field = 0;
@@ -555,75 +517,126 @@ bool SimLayerAdapt::adaptMesh()
     sim_told_field = apf::getSIMField(told_field);
     PList_append(sim_fld_lst, sim_told_field);
   }
-  MSA_setMapFields(adapter, sim_fld_lst);
 
-  /* BRD */
-  GRIter regions = GM_regionIter(Simmetrix_model);
-  pGRegion gr1;
+  if (should_adapt) {
+
+    /* compute the size field via SPR error estimation on the gradient
+       of the chosen solution field */
+    int spr_idx = adapt_params_->get<int>("SPR Solution Index", 0);
+    apf::Field* grad_ip_fld = spr::getGradIPField(
+        soln_fields[spr_idx], "grad_sol", apf_ms->cubatureDegree);
+    apf::Field* size_fld;
+    if (adapt_params_->isType<long int>("Target Element Count")) {
+      long N = adapt_params_->get<long int>("Target Element Count");
+      size_fld = spr::getTargetSPRSizeField(grad_ip_fld, N);
+    }
+    else if (adapt_params_->isType<double>("Error Bound")) {
+      double error_bound = adapt_params_->get<double>("Error Bound", 0.1);
+      size_fld = spr::getSPRSizeField(grad_ip_fld, error_bound);
+    }
+    else
+      TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
+          "invalid SimAdapt SPR inputs\n");
+    apf::destroyField(grad_ip_fld);
+
+    double max_size = adapt_params_->get<double>("Max Size", 1e10);
+    double min_size = adapt_params_->get<double>("Min Size", 1e-2);
+    double gradation = adapt_params_->get<double>("Gradation", 0.3);
+    assert(min_size <= max_size);
+
+    /* create the Simmetrix adapter */
+    pACase mcase = MS_newMeshCase(Simmetrix_model);
+    pModelItem domain = GM_domain(Simmetrix_model);
+    MS_setMeshCurv(mcase,domain, ONLY_CURV_TYPE, 0.025);
+    MS_setMinCurvSize(mcase,domain, ONLY_CURV_TYPE, 0.0025);
+    MS_setMeshSize(mcase,domain, RELATIVE, 1.0, NULL);
+    pMSAdapt adapter = MSA_createFromCase(mcase,sim_pm);
+    MSA_setSizeGradation(adapter, DO_GRADE, gradation);  // no broomsticks allowed
+
+    /* BRD */
+    /* copy the size field from APF to the Simmetrix adapter */
+    apf::MeshEntity* v;
+    apf::MeshIterator* it = apf_m->begin(0);
+    while ((v = apf_m->iterate(it))) {
+      double size = apf::getScalar(size_fld, v, 0);
+      size = std::min(max_size, size);
+      size = std::max(min_size, size);
+      MSA_setVertexSize(adapter, (pVertex) v, size);
+      apf::setScalar(size_fld, v, 0, size);
+    }
+    apf_m->end(it);
 
-  // Constrain the top face & reset sizes
-  int layer;
-  while (gr1=GRIter_next(regions)) {
-    if (GEN_numNativeIntAttribute(gr1,"SimLayer")==1) {
-      GEN_nativeIntAttribute(gr1,"SimLayer",&layer);
-      if (layer==Simmetrix_currentLayer) {
-        pPList faceList = GR_faces(gr1);
-        void *ent, *iter = 0;
-        while(ent = PList_next(faceList,&iter)) {
-          pGFace gf = static_cast<pGFace>(ent);
-          if (GEN_numNativeIntAttribute(gf,"SimLayer")==1) {
-            GEN_nativeIntAttribute(gf,"SimLayer",&layer);
-            if (layer==Simmetrix_currentLayer+1) {
-              MSA_setNoModification(adapter,gf);
-              for(int np=0;np<PM_numParts(sim_pm);np++) {
-                pVertex mv;
-                VIter allVerts = M_classifiedVertexIter(PM_mesh(sim_pm,np),gf,1);
-                while ( mv = VIter_next(allVerts) ) {
-                  MSA_setVertexSize(adapter,mv,layerSize);  // should be same as top layer size in meshModel
-                  apf::setScalar(size_fld, reinterpret_cast<apf::MeshEntity*>(mv), 0, layerSize);
+    /* tell the Simmetrix adapter to transfer the fields */
+    MSA_setMapFields(adapter, sim_fld_lst);
+
+    /* BRD */
+    GRIter regions = GM_regionIter(Simmetrix_model);
+    pGRegion gr1;
+
+    // Constrain the top face & reset sizes
+    int layer;
+    while (gr1=GRIter_next(regions)) {
+      if (GEN_numNativeIntAttribute(gr1,"SimLayer")==1) {
+        GEN_nativeIntAttribute(gr1,"SimLayer",&layer);
+        if (layer==Simmetrix_currentLayer) {
+          pPList faceList = GR_faces(gr1);
+          void *ent, *iter = 0;
+          while(ent = PList_next(faceList,&iter)) {
+            pGFace gf = static_cast<pGFace>(ent);
+            if (GEN_numNativeIntAttribute(gf,"SimLayer")==1) {
+              GEN_nativeIntAttribute(gf,"SimLayer",&layer);
+              if (layer==Simmetrix_currentLayer+1) {
+                MSA_setNoModification(adapter,gf);
+                for(int np=0;np<PM_numParts(sim_pm);np++) {
+                  pVertex mv;
+                  VIter allVerts = M_classifiedVertexIter(PM_mesh(sim_pm,np),gf,1);
+                  while ( mv = VIter_next(allVerts) ) {
+                    MSA_setVertexSize(adapter,mv,layerSize);  // should be same as top layer size in meshModel
+                    apf::setScalar(size_fld, reinterpret_cast<apf::MeshEntity*>(mv), 0, layerSize);
+                  }
+                  VIter_delete(allVerts);
                 }
-                VIter_delete(allVerts);
               }
             }
           }
+          PList_delete(faceList);
         }
-        PList_delete(faceList);
       }
     }
-  }
-  GRIter_delete(regions);
-  /* BRD */
+    GRIter_delete(regions);
+    /* BRD */
 
-  if (should_debug) {
-    std::stringstream ss;
-    ss << "preadapt_" << callcount;
-    std::string s = ss.str();
-    apf::writeVtkFiles(s.c_str(), apf_m);
-  }
+    if (should_debug) {
+      std::stringstream ss;
+      ss << "preadapt_" << callcount;
+      std::string s = ss.str();
+      apf::writeVtkFiles(s.c_str(), apf_m);
+    }
 
-  apf::destroyField(size_fld);
-  double t5 = PCU_Time();
-  if (!PCU_Comm_Self())
-    fprintf(stderr,"adaptMesh(): preparing mesh adapt in %f seconds\n",t5-t4);
+    apf::destroyField(size_fld);
+    double t5 = PCU_Time();
+    if (!PCU_Comm_Self())
+      fprintf(stderr,"adaptMesh(): preparing mesh adapt in %f seconds\n",t5-t4);
 
-  double t5b = PCU_Time();
+    double t5b = PCU_Time();
 
-  /* run the adapter */
-  pProgress progress = Progress_new();
-  MSA_adapt(adapter, progress);
-  Progress_delete(progress);
-  MSA_delete(adapter);
-  MS_deleteMeshCase(mcase);
+    /* run the adapter */
+    pProgress progress = Progress_new();
+    MSA_adapt(adapter, progress);
+    Progress_delete(progress);
+    MSA_delete(adapter);
+    MS_deleteMeshCase(mcase);
 
-  double t5bb = PCU_Time();
-  if (!PCU_Comm_Self())
-    fprintf(stderr,"adaptMesh(): mesh adapt in %f seconds\n",t5bb-t5b);
+    double t5bb = PCU_Time();
+    if (!PCU_Comm_Self())
+      fprintf(stderr,"adaptMesh(): mesh adapt in %f seconds\n",t5bb-t5b);
     
-  if (should_debug) {
-    std::stringstream ss;
-    ss << "postadapt_" << callcount;
-    std::string s = ss.str();
-    apf::writeVtkFiles(s.c_str(), apf_m);
+    if (should_debug) {
+      std::stringstream ss;
+      ss << "postadapt_" << callcount;
+      std::string s = ss.str();
+      apf::writeVtkFiles(s.c_str(), apf_m);
+    }
   }
 
   /* BRD */
@@ -682,6 +695,7 @@ Teuchos::RCP<const Teuchos::ParameterList> SimLayerAdapt::getValidAdapterParamet
   validPL->set<bool>("Add Layer", true, "Turn on/off adding layer");
   validPL->set<double>("Uniform Temperature New Layer", 20.0, "Uniform Layer Temperature");
   validPL->set<double>("First Layer Time", 0.0, "Overrides time to place first layer");
+  validPL->set<bool>("Adapt Deposited Part", true, "Adapt the mesh of the deposited layers; if false only new layers are meshed");
   validPL->set<bool>("Equilibrate", false, "Should equilibration be turned on after adaptation");
   validPL->set<std::string>("Remesh Strategy", "", "Strategy for when to adapt");
   validPL->set<int>("Remesh Every N Step Number", 1, "Remesh every Nth load/time step");
@@ -125,6 +125,38 @@ class AbstractDiscretization {
     //! Get map from (Ws, El, Local Node, Eq) -> unkLID
     virtual const Conn& getWsElNodeEqID() const = 0;
 
+    using WorksetJacOffsets = Kokkos::View<LO****, Kokkos::LayoutRight, PHX::Device>;
+
+    //! Get map from (Ws, El, Local Node, Eq, Local Unk) -> offset of the entry
+    //! in the values of a CrsMatrix built on getOverlapJacobianGraphT(), or -1
+    //! if the graph has no such entry. Empty if the discretization does not
+    //! precompute the offsets.
+    virtual const WorksetArray<WorksetJacOffsets>::type& getWsJacOffsets() const {
+      static const WorksetArray<WorksetJacOffsets>::type no_offsets;
+      return no_offsets;
+    }
+
+    using WorksetCoordsView = Kokkos::View<double***, Kokkos::LayoutRight, PHX::Device>;
+
+    //! Get map from (Ws, El, Local Node, Dim) -> coordinate, a contiguous copy
+    //! of getCoords(). Empty if the discretization does not provide it.
+    virtual const WorksetArray<WorksetCoordsView>::type& getCoordsViews() const {
+      static const WorksetArray<WorksetCoordsView>::type no_coords;
+      return no_coords;
+    }
+
+    using WorksetNodeFlags = Kokkos::View<int**, Kokkos::LayoutRight, PHX::Device>;
+
+    //! Get map from (Ws, El, Local Node) -> 1 if the node is interior to the
+    //! element: it is owned and not shared, belongs to no other element and
+    //! to no node set, so that its unknowns only couple within the element.
+    //! Candidates for static condensation. Empty if the discretization does
+    //! not tag them.
+    virtual const WorksetArray<WorksetNodeFlags>::type& getWsElInteriorNodes() const {
+      static const WorksetArray<WorksetNodeFlags>::type no_flags;
+      return no_flags;
+    }
+
     //! Get map from (Ws, El, Local Node) -> unkGID
     virtual const WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<GO> > >::type&
       getWsElNodeID() const = 0;
@@ -190,6 +222,14 @@ class AbstractDiscretization {
     //! Retrieve Vector (length num worksets) of Physics Index
     virtual const WorksetArray<int>::type& getWsPhysIndex() const = 0;
 
+    //! Retrieve Vector (length num worksets) of workset colors. Worksets of
+    //! the same color share no nodes and may be assembled concurrently.
+    //! Empty if the discretization does not color its worksets.
+    virtual const WorksetArray<int>::type& getWsColors() const {
+      static const WorksetArray<int>::type no_colors;
+      return no_colors;
+    }
+
     //! Retrieve connectivity map from elementGID to workset
     virtual WsLIDList&  getElemGIDws() = 0;
     virtual const WsLIDList&  getElemGIDws() const = 0;
@@ -64,6 +64,49 @@ struct LayeredMeshNumbering {
       column_id = id%stride;
     }
   }
+
+  //! Ids of the numLevels levels of a column, from the base to the top
+  void getColumnIds(const T column_id, std::vector<T>& ids) const {
+    ids.resize(numLevels);
+    for (T il = 0; il < numLevels; ++il)
+      ids[il] = getId(column_id, il);
+  }
+
+  //! Trapezoidal weights of the levels, for vertical averages in the
+  //! normalized coordinate
+  std::vector<double> getLevelWeights() const {
+    std::vector<double> weights(numLevels, 0.0);
+    for (T il = 0; il < numLayers; ++il) {
+      weights[il]   += 0.5*layers_ratio[il];
+      weights[il+1] += 0.5*layers_ratio[il];
+    }
+    return weights;
+  }
+
+  //! Normalized coordinate of the levels, from 0 at the base to 1 at the top
+  std::vector<double> getLevelCoordinates() const {
+    std::vector<double> sigma(numLevels);
+    sigma[0] = 0.;
+    for (T il = 1; il < numLayers; ++il)
+      sigma[il] = sigma[il-1] + layers_ratio[il-1];
+    sigma[numLayers] = 1.;
+    return sigma;
+  }
+
+  //! Sweep up a column: integral[il] is the trapezoidal integral, in the
+  //! normalized coordinate, of values(id) from the base to level il
+  template <typename Values>
+  void integrateColumn(const T column_id, const Values& values,
+                       std::vector<double>& integral) const {
+    integral.resize(numLevels);
+    integral[0] = 0;
+    double below = values(getId(column_id, 0));
+    for (T il = 0; il < numLayers; ++il) {
+      const double above = values(getId(column_id, il+1));
+      integral[il+1] = integral[il] + 0.5*(below + above)*layers_ratio[il];
+      below = above;
+    }
+  }
 };
 
 class CellSpecs {
@@ -9,8 +9,70 @@
 
 #include "Moertel_InterfaceT.hpp"
 
+#include <algorithm>
+
 const int printLevel = 4;
 
+namespace {
+
+typedef Albany::ContactManager::SideBox SideBox;
+
+// Coarse search: the sides of each set whose boxes, grown by tol, overlap a box of the other set.
+// Sort and sweep along the axis on which the boxes are most spread out.
+void
+findOverlappingSides(const std::vector<SideBox>& a, const std::vector<SideBox>& b, const double tol,
+                     std::set<int>& a_hits, std::set<int>& b_hits){
+
+  const std::vector<SideBox>* sets[2] = { &a, &b };
+  std::set<int>* hits[2] = { &a_hits, &b_hits };
+
+  double cmin[2] = { 1e300, 1e300 }, cmax[2] = { -1e300, -1e300 };
+  for(int s = 0; s < 2; s++)
+    for(std::size_t i = 0; i < sets[s]->size(); i++)
+      for(int d = 0; d < 2; d++){
+        const double c = 0.5 * ((*sets[s])[i].lo[d] + (*sets[s])[i].hi[d]);
+        cmin[d] = std::min(cmin[d], c);
+        cmax[d] = std::max(cmax[d], c);
+      }
+  const int sweep = (cmax[1] - cmin[1] > cmax[0] - cmin[0]) ? 1 : 0;
+  const int other = 1 - sweep;
+
+  // (start of the box along the sweep axis, set, index in the set)
+  std::vector<std::pair<double, std::pair<int, std::size_t> > > starts;
+  for(int s = 0; s < 2; s++)
+    for(std::size_t i = 0; i < sets[s]->size(); i++)
+      starts.push_back(std::make_pair((*sets[s])[i].lo[sweep] - tol, std::make_pair(s, i)));
+  std::sort(starts.begin(), starts.end());
+
+  std::vector<std::size_t> active[2];
+  for(std::size_t e = 0; e < starts.size(); e++){
+    const double start = starts[e].first;
+    const int s = starts[e].second.first;
+    const SideBox& box = (*sets[s])[starts[e].second.second];
+
+    // Drop the boxes that end before this one starts
+    for(int t = 0; t < 2; t++)
+      for(std::size_t k = 0; k < active[t].size(); )
+        if((*sets[t])[active[t][k]].hi[sweep] + tol < start){
+          active[t][k] = active[t].back();
+          active[t].pop_back();
+        }
+        else k++;
+
+    const int t = 1 - s;
+    for(std::size_t k = 0; k < active[t].size(); k++){
+      const SideBox& candidate = (*sets[t])[active[t][k]];
+      if(box.lo[other] - tol <= candidate.hi[other] + tol && candidate.lo[other] - tol <= box.hi[other] + tol){
+        hits[s]->insert(box.side_GID);
+        hits[t]->insert(candidate.side_GID);
+      }
+    }
+    active[s].push_back(starts[e].second.second);
+  }
+}
+
+}
+
 Albany::ContactManager::ContactManager(const Teuchos::RCP<Teuchos::ParameterList>& params_,
     const Albany::AbstractDiscretization& disc_,
 	const Teuchos::ArrayRCP<Teuchos::RCP<Albany::MeshSpecsStruct> >& meshSpecs_) :
@@ -98,12 +160,30 @@ Albany::ContactManager::ContactManager(const Teuchos::RCP<Teuchos::ParameterList
   const int number_of_mortar_pairs = masterSideNames.size();
   ALBANY_ASSERT(number_of_mortar_pairs == slaveSideNames.size(), "Input error: number of master and slave interfaces differ.");
 
+  // Optional coarse search: only the sides whose bounding boxes come within this distance of a side
+  // of the opposite surface are handed to Moertel. A negative value hands it all the sides.
+  const double searchTolerance = paramList.get<double>("Coarse Search Tolerance", -1.0);
+
+  std::vector<std::set<int> > slaveCandidates(number_of_mortar_pairs), masterCandidates(number_of_mortar_pairs);
+  if(searchTolerance >= 0.0){
+    for(int pair = 0; pair < number_of_mortar_pairs; pair++){
+      std::vector<SideBox> slaveBoxes, masterBoxes;
+      getSideBoxes(slaveSideNames[pair], slaveBoxes);
+      getSideBoxes(masterSideNames[pair], masterBoxes);
+      findOverlappingSides(slaveBoxes, masterBoxes, searchTolerance, slaveCandidates[pair], masterCandidates[pair]);
+      std::cout << "Coarse search kept " << slaveCandidates[pair].size() << " of " << slaveBoxes.size()
+                << " slave and " << masterCandidates[pair].size() << " of " << masterBoxes.size()
+                << " master sides of contact pair " << pair << std::endl;
+    }
+  }
+
   int interface_ctr = 0;
 
   // Loop over all the master interfaces
   for(int pair = 0; pair < number_of_mortar_pairs; pair++){
 
-      processSS(interface_ctr, slaveSideNames[pair], 0 /* Slave side */, mortarside, sfile);
+      processSS(interface_ctr, slaveSideNames[pair], 0 /* Slave side */, mortarside, sfile,
+                searchTolerance >= 0.0 ? &slaveCandidates[pair] : NULL);
 
       interface_ctr++;
 
@@ -112,7 +192,8 @@ Albany::ContactManager::ContactManager(const Teuchos::RCP<Teuchos::ParameterList
   // Loop over all the slave interfaces
   for(int pair = 0; pair < number_of_mortar_pairs; pair++){
 
-      processSS(interface_ctr, masterSideNames[pair], 1 /* mortar side */, nonmortarside, mfile);
+      processSS(interface_ctr, masterSideNames[pair], 1 /* mortar side */, nonmortarside, mfile,
+                searchTolerance >= 0.0 ? &masterCandidates[pair] : NULL);
 
       interface_ctr++;
 
@@ -147,10 +228,51 @@ Albany::ContactManager::ContactManager(const Teuchos::RCP<Teuchos::ParameterList
 
 }
 
+// Bounding boxes of the sides of a side set, in the (x, y) plane used for the Moertel nodes
+void
+Albany::ContactManager::getSideBoxes(const std::string& sideSetName, std::vector<SideBox>& boxes) const {
+
+  for(int workset = 0; workset < disc.getWsElNodeID().size(); workset++){
+
+    const Albany::SideSetList& ssList = disc.getSideSets(workset);
+
+    Albany::SideSetList::const_iterator it_side_set = ssList.find(sideSetName);
+
+    if(it_side_set == ssList.end()) continue;
+
+    const std::vector<Albany::SideStruct>& theSideSet = it_side_set->second;
+
+    for (std::size_t side=0; side < theSideSet.size(); ++side) {
+
+      const int elem_LID   = theSideSet[side].elem_LID;
+      const int elem_side  = theSideSet[side].side_local_id;
+      const int elem_block = theSideSet[side].elem_ebIndex;
+      const CellTopologyData_Subcell& subcell_side =  meshSpecs[elem_block]->ctd.side[elem_side];
+      const int numSideNodes = subcell_side.topology->node_count;
+      const Teuchos::ArrayRCP<GO>& elNodeID = disc.getWsElNodeID()[workset][elem_LID];
+
+      SideBox box;
+      box.side_GID = theSideSet[side].side_GID;
+      for (int d = 0; d < 2; ++d) {
+        box.lo[d] =  1e300;
+        box.hi[d] = -1e300;
+      }
+      for (int i = 0; i < numSideNodes; ++i) {
+        LO lnodeId = disc.getMapT()->getLocalElement(elNodeID[subcell_side.node[i]]);
+        for (int d = 0; d < 2; ++d) {
+          box.lo[d] = std::min(box.lo[d], coordArray[3 * lnodeId + d]);
+          box.hi[d] = std::max(box.hi[d], coordArray[3 * lnodeId + d]);
+        }
+      }
+      boxes.push_back(box);
+    }
+  }
+}
+
 // Process all the contact surfaces and insert the data into a Moertel Interface
 void
 Albany::ContactManager::processSS(const int ctr, const std::string& sideSetName, int s_or_mortar, 
-         int mortarside, std::ofstream& stream ){
+         int mortarside, std::ofstream& stream, const std::set<int>* candidateSides ){
 
   // one interface per side set name
   Teuchos::RCP<MoertelT::InterfaceT<ST, LO, Tpetra_GO, KokkosNode> > moertelInterface
@@ -193,6 +315,9 @@ Albany::ContactManager::processSS(const int ctr, const std::string& sideSetName,
         const CellTopologyData_Subcell& subcell_side =  meshSpecs[elem_block]->ctd.side[elem_side];
         int numSideNodes = subcell_side.topology->node_count;
 
+        // Skip the sides the coarse search found too far from the opposite surface
+        if(candidateSides != NULL && candidateSides->count(side_GID) == 0) continue;
+
              stream << "side = " << side << std::endl;
              stream << "wsIndex = " << workset << std::endl;
              stream << "    element that owns side GID = " << elem_GID << std::endl;
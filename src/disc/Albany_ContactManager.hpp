@@ -17,6 +17,8 @@
 
 #include <iostream>
 #include <fstream>
+#include <set>
+#include <vector>
 
 
 /** \brief This class implements the Mortar contact algorithm. Here is the overall sketch of how things work:
@@ -67,12 +69,21 @@ class ContactManager {
     //! Destructor
     virtual ~ContactManager() {}
 
+    //! Axis-aligned bounding box of a contact side, used by the coarse search
+    struct SideBox {
+      int side_GID;
+      double lo[2];
+      double hi[2];
+    };
+
   private:
 
     ContactManager();
 
     void processSS(const int ctr, const std::string& sideSetName, int s_or_mortar,
-         int mortarside, std::ofstream& stream );
+         int mortarside, std::ofstream& stream, const std::set<int>* candidateSides = NULL );
+
+    void getSideBoxes(const std::string& sideSetName, std::vector<SideBox>& boxes) const;
 
     Teuchos::RCP<Teuchos::ParameterList> params;
 
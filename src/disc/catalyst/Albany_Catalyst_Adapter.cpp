@@ -8,6 +8,7 @@
 
 #include "Albany_Catalyst_EpetraDataArray.hpp"
 #include "Albany_Catalyst_Grid.hpp"
+#include "Albany_Catalyst_TeuchosArrayRCPDataArray.hpp"
 
 #include "Teuchos_Array.hpp"
 #include "Teuchos_TestForException.hpp"
@@ -22,6 +23,7 @@
 #include <vtkPointData.h>
 #include <vtkPVInstantiator.h>
 
+#include <chrono>
 #include <iostream>
 
 namespace Albany {
@@ -32,11 +34,50 @@ Adapter * Adapter::instance = NULL;
 class Adapter::Private
 {
 public:
+  typedef std::chrono::steady_clock Clock;
+
   // Used by Catalyst to create a dummy grid object:
   static vtkObjectBase* MakeGrid(void*) { return Grid::New(); }
-  Private() { processor->Initialize(); }
+  Private()
+    : samplingInterval(1),
+      maxTimeFraction(1.0),
+      numUpdates(0),
+      coProcessTime(0.0),
+      start(Clock::now())
+  { processor->Initialize(); }
   ~Private() { processor->Finalize(); }
+
+  //! Decimation: whether this update should be offered to the pipelines.
+  bool sample()
+  {
+    if (numUpdates++ % samplingInterval != 0)
+      return false;
+    if (maxTimeFraction >= 1.0)
+      return true;
+    const double elapsed =
+        std::chrono::duration<double>(Clock::now() - start).count();
+    return coProcessTime <= maxTimeFraction * elapsed;
+  }
+
+  void coProcess(vtkCPDataDescription *desc, vtkUnstructuredGridBase *grid,
+                 vtkDataArray *scalars)
+  {
+    const Clock::time_point begin = Clock::now();
+    scalars->SetName("Scalars_");
+    grid->GetPointData()->SetScalars(scalars);
+    desc->GetInputDescriptionByName("input")->SetGrid(grid);
+    processor->CoProcess(desc);
+    coProcessTime +=
+        std::chrono::duration<double>(Clock::now() - begin).count();
+  }
+
   vtkNew<vtkCPProcessor> processor;
+  int samplingInterval;
+  double maxTimeFraction;
+  int numUpdates;
+  // Wall time spent in CoProcess, and the start of the run.
+  double coProcessTime;
+  Clock::time_point start;
 };
 
 Adapter::Adapter()
@@ -59,6 +100,14 @@ Adapter::initialize(const Teuchos::RCP<Teuchos::ParameterList>& catalystParams)
     delete Adapter::instance;
   Adapter::instance = new Adapter();
 
+  Private *d = Adapter::instance->d;
+  d->samplingInterval = catalystParams->get<int>("Sampling Interval", 1);
+  d->maxTimeFraction =
+      catalystParams->get<double>("Maximum Time Fraction", 1.0);
+  TEUCHOS_TEST_FOR_EXCEPTION(d->samplingInterval < 1, std::logic_error,
+                             "Catalyst \"Sampling Interval\" must be at "
+                             "least 1." << std::endl);
+
   // Register our Grid class with Catalyst so that it can be used in a pipeline.
   if (vtkClientServerInterpreterInitializer *intInit =
       vtkClientServerInterpreterInitializer::GetInitializer()) {
@@ -106,6 +155,8 @@ bool Adapter::addPipeline(vtkCPPipeline *pipeline)
 void Adapter::update(int timeStep, double time, Decorator &decorator,
                      const Epetra_Vector &soln)
 {
+  if (!d->sample())
+    return;
   vtkNew<vtkCPDataDescription> desc;
   desc->AddInput("input");
   desc->SetTimeData(time, timeStep);
@@ -115,12 +166,31 @@ void Adapter::update(int timeStep, double time, Decorator &decorator,
 
     vtkNew<EpetraDataArray> pointScalars;
     pointScalars->SetEpetraVector(soln);
-    pointScalars->SetName("Scalars_");
-    grid->GetPointData()->SetScalars(pointScalars.GetPointer());
 
-    desc->GetInputDescriptionByName("input")->SetGrid(grid);
+    d->coProcess(desc.GetPointer(), grid, pointScalars.GetPointer());
+  }
+}
+
+void Adapter::update(int timeStep, double time, Decorator &decorator,
+                     const Tpetra_Vector &overlapSoln)
+{
+  if (!d->sample())
+    return;
+  vtkNew<vtkCPDataDescription> desc;
+  desc->AddInput("input");
+  desc->SetTimeData(time, timeStep);
+  if (d->processor->RequestDataDescription(desc.GetPointer())) {
+    typedef vtkSmartPointer<vtkUnstructuredGridBase> GridRCP;
+    GridRCP grid = GridRCP::Take(decorator.newVtkUnstructuredGrid());
+
+    // The data array is read only, so the const cast does not let the
+    // pipeline modify the solution.
+    vtkNew<TeuchosArrayRCPDataArray<double> > pointScalars;
+    pointScalars->SetArrayRCP(
+        Teuchos::arcp_const_cast<double>(overlapSoln.getData()),
+        decorator.getNumEq());
 
-    d->processor->CoProcess(desc.GetPointer());
+    d->coProcess(desc.GetPointer(), grid, pointScalars.GetPointer());
   }
 }
 
@@ -135,6 +205,11 @@ Adapter::getValidAdapterParameters()
   validPL->set<Teuchos::Array<std::string> >(
         "Pipeline Files", Teuchos::Array<std::string>(),
         "Filenames that contains Catalyst pipeline commands.");
+  validPL->set<int>("Sampling Interval", 1,
+                    "Offer only every n-th solution output to the pipelines");
+  validPL->set<double>("Maximum Time Fraction", 1.0,
+                       "Skip co-processing while it has taken more than this "
+                       "fraction of the wall time of the run");
 
   return validPL;
 }
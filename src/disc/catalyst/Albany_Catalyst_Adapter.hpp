@@ -9,6 +9,7 @@
 
 #include <string>
 #include "Teuchos_ParameterList.hpp"
+#include "Albany_DataTypes.hpp"
 
 class Epetra_Vector;
 class vtkCPPipeline;
@@ -36,6 +37,11 @@ public:
   void update(int timeStep, double time, Decorator &decorator,
               const Epetra_Vector &soln);
 
+  //! Update catalyst with an overlapped solution. The solution data is
+  //! passed to the pipeline without a copy, with one component per equation.
+  void update(int timeStep, double time, Decorator &decorator,
+              const Tpetra_Vector &overlapSoln);
+
   //! Validate parameter list
   static Teuchos::RCP<const Teuchos::ParameterList> getValidAdapterParameters();
 
@@ -244,6 +244,11 @@ const WorksetArray<int>::type& Decorator::getWsPhysIndex() const
   return discretization->getWsPhysIndex();
 }
 
+const WorksetArray<int>::type& Decorator::getWsColors() const
+{
+  return discretization->getWsColors();
+}
+
 WsLIDList& Decorator::getElemGIDws() {
   return discretization->getElemGIDws();
 }
@@ -348,14 +353,14 @@ void Decorator::writeSolution(
 
 void Decorator::writeSolutionT(
     const Tpetra_Vector &solutionT, const double time, const bool overlapped) {
-  /* TODO: should react to this */
+  updateAdapterT(solutionT, time, overlapped);
   discretization->writeSolutionT(solutionT, time, overlapped);
 }
 
 void Decorator::writeSolutionT(
     const Tpetra_Vector &solutionT, const Tpetra_Vector &solution_dotT, 
     const double time, const bool overlapped) {
-  /* TODO: should react to this */
+  updateAdapterT(solutionT, time, overlapped);
   discretization->writeSolutionT(solutionT, solution_dotT, time, overlapped);
 }
 
@@ -363,7 +368,7 @@ void Decorator::writeSolutionT(
     const Tpetra_Vector &solutionT, const Tpetra_Vector &solution_dotT, 
     const Tpetra_Vector &solution_dotdotT, 
     const double time, const bool overlapped) {
-  /* TODO: should react to this */
+  updateAdapterT(solutionT, time, overlapped);
   discretization->writeSolutionT(
       solutionT, solution_dotT, solution_dotdotT, time, overlapped);
 }
@@ -417,6 +422,28 @@ void Decorator::writeSolutionMVToFile(const Tpetra_MultiVector& solutionT,
   discretization->writeSolutionMVToFile(solutionT, time, overlapped);
 }
 
+void Decorator::updateAdapterT(
+    const Tpetra_Vector &solutionT, const double time, const bool overlapped) {
+  Adapter *adapter = Adapter::get();
+  if (!adapter)
+    return;
+  if (overlapped) {
+    adapter->update(this->timestep++, time, *this, solutionT);
+    return;
+  }
+  // The grid points are the overlap nodes, so bring the owned solution to the
+  // overlap map. The importer and vector are kept until the maps change.
+  const Teuchos::RCP<const Tpetra_Map> overlapMap = this->getOverlapMapT();
+  if (importerT.is_null() ||
+      importerT->getSourceMap().get() != solutionT.getMap().get() ||
+      importerT->getTargetMap().get() != overlapMap.get()) {
+    importerT = Teuchos::rcp(new Tpetra_Import(solutionT.getMap(), overlapMap));
+    overlapSolutionT = Teuchos::rcp(new Tpetra_Vector(overlapMap, false));
+  }
+  overlapSolutionT->doImport(solutionT, *importerT, Tpetra::INSERT);
+  adapter->update(this->timestep++, time, *this, *overlapSolutionT);
+}
+
 Teuchos::RCP<LayeredMeshNumbering<LO> > Decorator::getLayeredMeshNumbering() {
   return discretization->getLayeredMeshNumbering();
 }
@@ -156,6 +156,9 @@ public:
   //! Retrieve Vector (length num worksets) of physics set index
   const WorksetArray<int>::type&  getWsPhysIndex() const override;
 
+  //! Retrieve Vector (length num worksets) of workset colors
+  const WorksetArray<int>::type&  getWsColors() const override;
+
   //! Get connectivity map from elementGID to workset
   WsLIDList& getElemGIDws() override;
   const WsLIDList&  getElemGIDws() const override;
@@ -228,8 +231,17 @@ private:
   //! Private to prohibit copying
   Decorator& operator=(const Decorator&);
 
+  //! Pass the solution to the Catalyst adapter, importing it to the overlap
+  //! map if needed.
+  void updateAdapterT(const Tpetra_Vector &solutionT, const double time,
+                      const bool overlapped);
+
   Teuchos::RCP<Albany::AbstractDiscretization> discretization;
   int timestep;
+
+  //! Overlapped solution and its importer, rebuilt when the maps change.
+  Teuchos::RCP<Tpetra_Vector> overlapSolutionT;
+  Teuchos::RCP<Tpetra_Import> importerT;
 };
 
 } // end namespace Catalyst
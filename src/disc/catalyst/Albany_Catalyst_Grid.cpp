@@ -13,6 +13,7 @@
 
 #include <vtkIdTypeArray.h>
 
+#include <algorithm>
 #include <cassert>
 #include <string>
 #include <vector>
@@ -28,9 +29,7 @@ vtkStandardNewMacro(GridImplementation)
 
 GridImplementation::GridImplementation()
   : Discretization(NULL),
-    DegreesOfFreedom(0),
-    ElementsWsLid(NULL),
-    ElementOffset(0)
+    DegreesOfFreedom(0)
 {
 }
 
@@ -47,18 +46,6 @@ bool GridImplementation::SetDecorator(Decorator *decorator)
 {
   this->Discretization = decorator;
   this->DegreesOfFreedom = decorator->getNumEq();
-  this->NodeLookup = decorator->getWsElNodeEqID();
-
-  this->ElementsWsLid = &decorator->getElemGIDws();
-  // The key of the first entry in the ElementsWsLid is the offset we should
-  // use when accessing the ids:
-  if (this->ElementsWsLid->size() > 0) {
-    WsLIDList::const_iterator first = this->ElementsWsLid->begin();
-    this->ElementOffset = first->first;
-  }
-  else {
-    this->ElementOffset = 0;
-  }
 
   // Build topology LUT
   typedef ArrayRCP<RCP<Albany::MeshSpecsStruct> > MeshSpecsT;
@@ -85,93 +72,103 @@ bool GridImplementation::SetDecorator(Decorator *decorator)
                                "block " << elName);
   }
 
+  // Flatten the connectivity once, so that the per-cell queries from the
+  // pipeline are array lookups rather than element map searches.
+  const WsLIDList &elements = decorator->getElemGIDws();
+  const Albany::AbstractDiscretization::Conn &nodeLookup =
+      decorator->getWsElNodeEqID();
+  const int neq = this->DegreesOfFreedom;
+
+  this->CellWorkset.clear();
+  this->CellWorkset.reserve(elements.size());
+  this->CellOffsets.assign(1, 0);
+  this->CellOffsets.reserve(elements.size() + 1);
+  this->Connectivity.clear();
+  this->Connectivity.reserve(elements.size() * this->GetMaxCellSize());
+  for (WsLIDList::const_iterator it = elements.begin(), itEnd = elements.end();
+       it != itEnd; ++it) {
+    const int ws = it->second.ws;
+    const int lid = it->second.LID;
+    const auto &wsLookup = nodeLookup[ws];
+    const std::size_t first = this->Connectivity.size();
+    for (int node = 0; node < wsLookup.dimension_1(); ++node)
+      this->Connectivity.push_back(
+          static_cast<vtkIdType>(wsLookup(lid, node, 0) / neq));
+
+    // For wedge, swap points 0 <--> 1 and 3 <--> 4. All other supported cells
+    // in VTK match shards' winding.
+    if (this->CellTypeLookup[ws] == VTK_WEDGE) {
+      vtkIdType *pts = &this->Connectivity[first];
+      std::swap(pts[0], pts[1]);
+      std::swap(pts[3], pts[4]);
+    }
+
+    this->CellWorkset.push_back(ws);
+    this->CellOffsets.push_back(
+        static_cast<vtkIdType>(this->Connectivity.size()));
+  }
+
+  this->PointCellOffsets.clear();
+  this->PointCells.clear();
+
   return true;
 }
 
 vtkIdType GridImplementation::GetNumberOfCells()
 {
-  return static_cast<vtkIdType>(this->ElementsWsLid->size());
+  return static_cast<vtkIdType>(this->CellWorkset.size());
 }
 
 int GridImplementation::GetCellType(vtkIdType cellId)
 {
-  int ws = -1;
-  int unused = -1;
-  this->GetWorksetFromCellId(cellId, ws, unused);
+  const int ws = (cellId >= 0 && cellId < this->GetNumberOfCells())
+      ? this->CellWorkset[cellId] : -1;
   return this->GetCellTypeFromWorkset(ws);
 }
 
 void GridImplementation::GetCellPoints(vtkIdType cellId, vtkIdList *ptIds)
 {
-  int ws = -1;
-  int lid = -1;
-  this->GetWorksetFromCellId(cellId, ws, lid);
-  auto wsLookup = this->NodeLookup[ws];
-  vtkIdType cellSize = static_cast<vtkIdType>(wsLookup.dimension_1());
+  const vtkIdType first = this->CellOffsets[cellId];
+  const vtkIdType cellSize = this->CellOffsets[cellId + 1] - first;
   ptIds->SetNumberOfIds(cellSize);
-
-  vtkIdType* ptIdsPtr = ptIds->GetPointer(0);
-  auto neq = this->DegreesOfFreedom;
-
-  for (int node = 0; node < cellSize; ++node) {
-    ptIdsPtr[node] = wsLookup(lid, node, 0) / neq;
-  }
-
-  // For wedge, swap points 0 <--> 1 and 3 <--> 4. All other supported cells
-  // in VTK match shards' winding.
-  if (this->GetCellTypeFromWorkset(ws) == VTK_WEDGE) {
-    using namespace std;
-    vtkIdType *pts = ptIds->GetPointer(0);
-    swap(pts[0], pts[1]);
-    swap(pts[3], pts[4]);
-  }
+  std::copy(this->Connectivity.begin() + first,
+            this->Connectivity.begin() + first + cellSize,
+            ptIds->GetPointer(0));
 }
 
-namespace {
-// predicate for find_if in GetPointCells
-struct WsLidMatcher {
-  wsLid needle;
-  WsLidMatcher() { needle.ws = 0; needle.LID = 0; }
-  bool operator()(const WsLIDList::value_type &val) const
-  {
-    return (val.second.ws == needle.ws && val.second.LID== needle.LID);
-  }
-};
-} // end anon namespace
+void GridImplementation::BuildPointCells()
+{
+  vtkIdType numPoints = 0;
+  for (std::size_t i = 0; i < this->Connectivity.size(); ++i)
+    numPoints = std::max(numPoints, this->Connectivity[i] + 1);
+
+  // Count, prefix sum, then fill.
+  this->PointCellOffsets.assign(numPoints + 1, 0);
+  for (std::size_t i = 0; i < this->Connectivity.size(); ++i)
+    ++this->PointCellOffsets[this->Connectivity[i] + 1];
+  for (vtkIdType pt = 0; pt < numPoints; ++pt)
+    this->PointCellOffsets[pt + 1] += this->PointCellOffsets[pt];
+
+  std::vector<vtkIdType> next(this->PointCellOffsets.begin(),
+                              this->PointCellOffsets.end() - 1);
+  this->PointCells.resize(this->Connectivity.size());
+  for (vtkIdType cell = 0; cell < this->GetNumberOfCells(); ++cell)
+    for (vtkIdType i = this->CellOffsets[cell];
+         i < this->CellOffsets[cell + 1]; ++i)
+      this->PointCells[next[this->Connectivity[i]]++] = cell;
+}
 
 void GridImplementation::GetPointCells(vtkIdType ptId, vtkIdList *cellIds)
 {
-  // This is slow. Might be worth optimizing if it becomes a bottleneck.
-  using Teuchos::ArrayRCP;
-  typedef ArrayRCP<ArrayRCP<int> > NodeLevel;
-  typedef ArrayRCP<NodeLevel> LidLevel;
-
   cellIds->Reset();
-
-  // We'll use these to keep track of our iteration progress and lookup cellids:
-  WsLidMatcher matcher;
-  int &ws = matcher.needle.ws;
-  int &lid = matcher.needle.LID;
-
-  // For lookups
-  WsLIDList::const_iterator haystackBegin = this->ElementsWsLid->begin();
-  WsLIDList::const_iterator haystackEnd = this->ElementsWsLid->end();
-  WsLIDList::const_iterator result;
-
-  // Search for matching pt ids by iterating through all cells.
-  for (ws = 0; ws < this->NodeLookup.size(); ++ws) {
-    auto& wsLookup = this->NodeLookup[ws];
-    for (lid = 0; lid < wsLookup.dimension_0(); ++lid) {
-      for (int node = 0; node < wsLookup.dimension_1(); ++node) {
-        if (static_cast<vtkIdType>(wsLookup(lid, node, 0) / this->DegreesOfFreedom)
-            == ptId) {
-          result = std::find_if(haystackBegin, haystackEnd, matcher);
-          if (result != haystackEnd)
-            cellIds->InsertNextId(static_cast<vtkIdType>(result->first));
-        }
-      }
-    }
-  }
+  if (this->PointCellOffsets.empty())
+    this->BuildPointCells();
+  if (ptId < 0 ||
+      ptId + 1 >= static_cast<vtkIdType>(this->PointCellOffsets.size()))
+    return;
+  for (vtkIdType i = this->PointCellOffsets[ptId];
+       i < this->PointCellOffsets[ptId + 1]; ++i)
+    cellIds->InsertNextId(this->PointCells[i]);
 }
 
 int GridImplementation::GetMaxCellSize()
@@ -185,44 +182,14 @@ int GridImplementation::GetMaxCellSize()
 
 void GridImplementation::GetIdsOfCellsOfType(int type, vtkIdTypeArray *array)
 {
-  // All cells within a workset are homogeneous, so just look for the entries
-  // CellTypeLookup, which is indexed by WS, then lookup all of the cell ids
-  // in the global element map.
-
-  // Find worksets:
-  std::vector<int> worksets;
-  {
-    typedef std::vector<VTKCellType>::const_iterator TypeIterT;
-    TypeIterT begin(this->CellTypeLookup.begin());
-    TypeIterT end = this->CellTypeLookup.end();
-    TypeIterT typeIter = begin;
-    while (typeIter != end) {
-      if (*typeIter == static_cast<VTKCellType>(type))
-        worksets.push_back(typeIter - begin);
-      ++typeIter;
-    }
-  }
-
-  // There are usually about 50 cells/workset:
+  // All cells within a workset are homogeneous, so the type of a cell is the
+  // type of its workset.
+  array->Reset();
   array->SetNumberOfComponents(1);
-  array->Allocate(static_cast<vtkIdType>(50 * worksets.size()));
-
-  // Get cells:
-  {
-    WsLIDList::const_iterator iter = this->ElementsWsLid->begin();
-    WsLIDList::const_iterator end = this->ElementsWsLid->end();
-
-    typedef std::vector<int>::iterator WsIterT;
-    WsIterT wsBegin = worksets.begin();
-    WsIterT wsEnd = worksets.end();
-
-    std::sort(wsBegin, wsEnd);
-
-    while (iter != end) {
-      if (std::binary_search(wsBegin, wsEnd, iter->second.ws))
-        array->InsertNextValue(static_cast<vtkIdType>(iter->second.ws));
-    }
-  }
+  for (vtkIdType cell = 0; cell < this->GetNumberOfCells(); ++cell)
+    if (this->CellTypeLookup[this->CellWorkset[cell]] ==
+        static_cast<VTKCellType>(type))
+      array->InsertNextValue(cell);
 }
 
 int GridImplementation::IsHomogeneous()
@@ -330,22 +297,6 @@ inline vtkIdType GridImplementation::GetCellSize(VTKCellType cellType)
   }
 }
 
-inline void GridImplementation::GetWorksetFromCellId(vtkIdType cellId,
-                                                     int &ws, int &lid)
-{
-  WsLIDList::const_iterator match =
-      this->ElementsWsLid->find(static_cast<int>(cellId) + this->ElementOffset);
-  if (match != this->ElementsWsLid->end()) {
-    const wsLid &result = match->second;
-    ws = result.ws;
-    lid = result.LID;
-  }
-  else {
-    ws = -1;
-    lid = -1;
-  }
-}
-
 VTKCellType GridImplementation::GetCellTypeFromWorkset(int ws)
 {
   return (ws >= 0 && ws < this->CellTypeLookup.size())
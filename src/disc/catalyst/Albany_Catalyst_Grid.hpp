@@ -9,6 +9,8 @@
 
 #include "vtkObject.h"
 
+#include <vector>
+
 #include "vtkMappedUnstructuredGrid.h" // For mapped unstructured grid wrapper
 
 #include "Albany_Catalyst_Decorator.hpp" // For decorator class
@@ -25,6 +27,14 @@ public:
 
   bool SetDecorator(Decorator *decorator);
 
+  //! Contiguous cell connectivity: the points of cell i are
+  //! GetConnectivity()[GetCellOffsets()[i] .. GetCellOffsets()[i+1]), already
+  //! in VTK winding.
+  const std::vector<vtkIdType> &GetConnectivity() const
+  { return this->Connectivity; }
+  const std::vector<vtkIdType> &GetCellOffsets() const
+  { return this->CellOffsets; }
+
   // API for vtkMappedUnstructuredGrid's implementation.
   vtkIdType GetNumberOfCells();
   int GetCellType(vtkIdType cellId);
@@ -55,22 +65,22 @@ private:
 
   int DegreesOfFreedom;
 
-  // lookup [wsId][wsElLid][elNodeInd][0] / neq = global node id
-  using Conn = Albany::AbstractDiscretization::Conn;
-  Conn NodeLookup;
-
-  // Map of all elements, global element id -> struct { int ws, int lid }
-  const WsLIDList *ElementsWsLid;
+  // Cell ids are the positions of the elements in the (sorted) element map of
+  // the discretization. Indexed by cell id:
+  std::vector<int> CellWorkset;
+  std::vector<vtkIdType> CellOffsets; // size = number of cells + 1
+  std::vector<vtkIdType> Connectivity;
 
-  // Offset of the keys in ElementsWsLid:
-  int ElementOffset;
+  // Point -> cells, in the same offsets/values layout. Built on first use.
+  std::vector<vtkIdType> PointCellOffsets;
+  std::vector<vtkIdType> PointCells;
+  void BuildPointCells();
 
   // Indexed by workset:
   std::vector<const CellTopologyData *> TopologyLookup;
   std::vector<VTKCellType> CellTypeLookup;
   static VTKCellType TopologyToCellType(const CellTopologyData *ctd);
   static vtkIdType GetCellSize(VTKCellType cellType);
-  void GetWorksetFromCellId(vtkIdType cellId, int &ws, int &lid);
   VTKCellType GetCellTypeFromWorkset(int ws);
 };
 
@@ -879,24 +879,32 @@ void Albany::APFDiscretization::computeGraphs()
   overlap_graph =
     Teuchos::rcp(new Epetra_CrsGraph(Copy, *overlap_map,
                                      neq*nodes_per_element, false));
+#endif
+  /* all the rows of an element couple to the same columns, so they are
+     inserted at once instead of one entry at a time */
+  Teuchos::Array<Tpetra_GO> cols;
+#if defined(ALBANY_EPETRA)
+  Teuchos::Array<EpetraInt> ecols;
 #endif
   for (size_t i=0; i < cells.size(); ++i) {
     apf::NewArray<long> cellNodes;
     apf::getElementNumbers(globalNumbering,cells[i],cellNodes);
+    cols.resize(n_nodes_in_elem[i]*neq);
+    for (int l=0; l < n_nodes_in_elem[i]; ++l)
+      for (int m=0; m < neq; ++m)
+        cols[l*neq + m] = getDOF(cellNodes[l],m);
+#if defined(ALBANY_EPETRA)
+    ecols.resize(cols.size());
+    for (int c=0; c < cols.size(); ++c)
+      ecols[c] = Teuchos::as<EpetraInt>(cols[c]);
+#endif
     for (int j=0; j < n_nodes_in_elem[i]; ++j) {
       for (int k=0; k < neq; ++k) {
         GO row = getDOF(cellNodes[j],k);
-        for (int l=0; l < n_nodes_in_elem[i]; ++l) {
-          for (int m=0; m < neq; ++m) {
-            Tpetra_GO col = getDOF(cellNodes[l],m);
-            auto colAV = Teuchos::arrayView(&col, 1);
-            overlap_graphT->insertGlobalIndices(row, colAV);
+        overlap_graphT->insertGlobalIndices(row, cols());
 #if defined(ALBANY_EPETRA)
-            EpetraInt ecol = Teuchos::as<EpetraInt>(col);
-            overlap_graph->InsertGlobalIndices(row,1,&ecol);
+        overlap_graph->InsertGlobalIndices(row,ecols.size(),ecols.getRawPtr());
 #endif
-          }
-        }
       }
     }
   }
@@ -1295,18 +1303,68 @@ void Albany::APFDiscretization::computeSideSets()
   m->end(it);
 }
 
+namespace {
+
+// Copy one QP state between the state arrays and an APF field, one
+// setComponents/getComponents call per QP straight from the state storage.
+// APF stores vectors and tensors with 3 and 3x3 components; in lower
+// dimensions the components of a QP are packed through a small buffer.
+void transferQPState(
+    const std::vector<std::vector<apf::MeshEntity*> >& buckets,
+    std::vector<Albany::StateArray>& elemStateArrays,
+    std::string const& stateName,
+    const unsigned nqp,
+    const int spdim,
+    const int rank,
+    apf::Field* f,
+    const bool toAPF)
+{
+  const int ncomp = rank == 0 ? 1 : (rank == 1 ? spdim : spdim * spdim);
+  const int nfcomp = apf::countComponents(f);
+  const bool packed = ncomp != nfcomp;
+  double buf[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+  for (std::size_t b=0; b < buckets.size(); ++b) {
+    const std::vector<apf::MeshEntity*>& buck = buckets[b];
+    Albany::MDArray& ar = elemStateArrays[b][stateName];
+    double* const data = ar.contiguous_data();
+    for (std::size_t e=0; e < buck.size(); ++e) {
+      for (std::size_t p=0; p < nqp; ++p) {
+        double* const qp = data + (e * nqp + p) * ncomp;
+        if (!packed) {
+          if (toAPF)
+            apf::setComponents(f, buck[e], p, qp);
+          else
+            apf::getComponents(f, buck[e], p, qp);
+          continue;
+        }
+        if (!toAPF)
+          apf::getComponents(f, buck[e], p, buf);
+        for (int i=0; i < (rank == 2 ? spdim : ncomp); ++i) {
+          for (int j=0; j < (rank == 2 ? spdim : 1); ++j) {
+            const int k = rank == 2 ? i * spdim + j : i;
+            const int kf = rank == 2 ? i * 3 + j : i;
+            if (toAPF)
+              buf[kf] = qp[k];
+            else
+              qp[k] = buf[kf];
+          }
+        }
+        if (toAPF)
+          apf::setComponents(f, buck[e], p, buf);
+      }
+    }
+  }
+}
+
+}  // namespace
+
 void Albany::APFDiscretization::copyQPScalarToAPF(
     unsigned nqp,
     std::string const& stateName,
     apf::Field* f)
 {
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e)
-      for (std::size_t p=0; p < nqp; ++p)
-        apf::setScalar(f,buck[e],p,ar(e,p));
-  }
+  transferQPState(buckets, stateArrays.elemStateArrays, stateName, nqp,
+                  meshStruct->problemDim, 0, f, true);
 }
 
 void Albany::APFDiscretization::copyQPVectorToAPF(
@@ -1314,19 +1372,8 @@ void Albany::APFDiscretization::copyQPVectorToAPF(
     std::string const& stateName,
     apf::Field* f)
 {
-  const int spdim = meshStruct->problemDim;
-  apf::Vector3 v(0,0,0);
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        for (std::size_t i=0; i < spdim; ++i)
-          v[i] = ar(e,p,i);
-        apf::setVector(f,buck[e],p,v);
-      }
-    }
-  }
+  transferQPState(buckets, stateArrays.elemStateArrays, stateName, nqp,
+                  meshStruct->problemDim, 1, f, true);
 }
 
 void Albany::APFDiscretization::copyQPTensorToAPF(
@@ -1334,20 +1381,8 @@ void Albany::APFDiscretization::copyQPTensorToAPF(
     std::string const& stateName,
     apf::Field* f)
 {
-  const int spdim = meshStruct->problemDim;
-  apf::Matrix3x3 v(0,0,0,0,0,0,0,0,0);
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        for (std::size_t i=0; i < spdim; ++i)
-          for (std::size_t j=0; j < spdim; ++j)
-            v[i][j] = ar(e,p,i,j);
-        apf::setMatrix(f,buck[e],p,v);
-      }
-    }
-  }
+  transferQPState(buckets, stateArrays.elemStateArrays, stateName, nqp,
+                  meshStruct->problemDim, 2, f, true);
 }
 
 void Albany::APFDiscretization::copyQPStatesToAPF(
@@ -1358,7 +1393,7 @@ void Albany::APFDiscretization::copyQPStatesToAPF(
   apf::Mesh2* m = meshStruct->getMesh();
   for (std::size_t i=0; i < meshStruct->qpscalar_states.size(); ++i) {
     PUMIQPData<double, 2>& state = *(meshStruct->qpscalar_states[i]);
-    if (!copyAll && !state.output)
+    if (!copyAll && !(state.output && meshStruct->isOutputField(state.name)))
       continue;
     int nqp = state.dims[1];
     f = apf::createField(m,state.name.c_str(),apf::SCALAR,fs);
@@ -1366,7 +1401,7 @@ void Albany::APFDiscretization::copyQPStatesToAPF(
   }
   for (std::size_t i=0; i < meshStruct->qpvector_states.size(); ++i) {
     PUMIQPData<double, 3>& state = *(meshStruct->qpvector_states[i]);
-    if (!copyAll && !state.output)
+    if (!copyAll && !(state.output && meshStruct->isOutputField(state.name)))
       continue;
     int nqp = state.dims[1];
     f = apf::createField(m,state.name.c_str(),apf::VECTOR,fs);
@@ -1374,7 +1409,7 @@ void Albany::APFDiscretization::copyQPStatesToAPF(
   }
   for (std::size_t i=0; i < meshStruct->qptensor_states.size(); ++i) {
     PUMIQPData<double, 4>& state = *(meshStruct->qptensor_states[i]);
-    if (!copyAll && !state.output)
+    if (!copyAll && !(state.output && meshStruct->isOutputField(state.name)))
       continue;
     int nqp = state.dims[1];
     f = apf::createField(m,state.name.c_str(),apf::MATRIX,fs);
@@ -1389,15 +1424,18 @@ void Albany::APFDiscretization::removeQPStatesFromAPF()
   apf::Mesh2* m = meshStruct->getMesh();
   for (std::size_t i=0; i < meshStruct->qpscalar_states.size(); ++i) {
     PUMIQPData<double, 2>& state = *(meshStruct->qpscalar_states[i]);
-    apf::destroyField(m->findField(state.name.c_str()));
+    if (apf::Field* f = m->findField(state.name.c_str()))
+      apf::destroyField(f);
   }
   for (std::size_t i=0; i < meshStruct->qpvector_states.size(); ++i) {
     PUMIQPData<double, 3>& state = *(meshStruct->qpvector_states[i]);
-    apf::destroyField(m->findField(state.name.c_str()));
+    if (apf::Field* f = m->findField(state.name.c_str()))
+      apf::destroyField(f);
   }
   for (std::size_t i=0; i < meshStruct->qptensor_states.size(); ++i) {
     PUMIQPData<double, 4>& state = *(meshStruct->qptensor_states[i]);
-    apf::destroyField(m->findField(state.name.c_str()));
+    if (apf::Field* f = m->findField(state.name.c_str()))
+      apf::destroyField(f);
   }
 }
 
@@ -1406,16 +1444,8 @@ void Albany::APFDiscretization::copyQPScalarFromAPF(
     std::string const& stateName,
     apf::Field* f)
 {
-  apf::Mesh2* m = meshStruct->getMesh();
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p = 0; p < nqp; ++p) {
-        ar(e,p) = apf::getScalar(f,buck[e],p);
-      }
-    }
-  }
+  transferQPState(buckets, stateArrays.elemStateArrays, stateName, nqp,
+                  meshStruct->problemDim, 0, f, false);
 }
 
 void Albany::APFDiscretization::copyQPVectorFromAPF(
@@ -1423,20 +1453,8 @@ void Albany::APFDiscretization::copyQPVectorFromAPF(
     std::string const& stateName,
     apf::Field* f)
 {
-  const int spdim = meshStruct->problemDim;
-  apf::Mesh2* m = meshStruct->getMesh();
-  apf::Vector3 v(0,0,0);
-  for (std::size_t b=0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        apf::getVector(f,buck[e],p,v);
-        for (std::size_t i=0; i < spdim; ++i)
-          ar(e,p,i) = v[i];
-      }
-    }
-  }
+  transferQPState(buckets, stateArrays.elemStateArrays, stateName, nqp,
+                  meshStruct->problemDim, 1, f, false);
 }
 
 void Albany::APFDiscretization::copyQPTensorFromAPF(
@@ -1444,22 +1462,8 @@ void Albany::APFDiscretization::copyQPTensorFromAPF(
     std::string const& stateName,
     apf::Field* f)
 {
-  const int spdim = meshStruct->problemDim;
-  apf::Mesh2* m = meshStruct->getMesh();
-  apf::Matrix3x3 v(0,0,0,0,0,0,0,0,0);
-  for (std::size_t b = 0; b < buckets.size(); ++b) {
-    std::vector<apf::MeshEntity*>& buck = buckets[b];
-    Albany::MDArray& ar = stateArrays.elemStateArrays[b][stateName];
-    for (std::size_t e=0; e < buck.size(); ++e) {
-      for (std::size_t p=0; p < nqp; ++p) {
-        apf::getMatrix(f,buck[e],p,v);
-        for (std::size_t i=0; i < spdim; ++i) {
-          for (std::size_t j=0; j < spdim; ++j)
-            ar(e,p,i,j) = v[i][j];
-        }
-      }
-    }
-  }
+  transferQPState(buckets, stateArrays.elemStateArrays, stateName, nqp,
+                  meshStruct->problemDim, 2, f, false);
 }
 
 void Albany::APFDiscretization::copyQPStatesFromAPF()
@@ -1504,7 +1508,8 @@ copyNodalDataToAPF (const bool copy_all) {
     TEUCHOS_TEST_FOR_EXCEPTION(
       nd.is_null(), std::logic_error,
       "A node field container is not a PUMINodeDataBase");
-    if ( ! copy_all && ! nd->output) continue;
+    if ( ! copy_all && ! (nd->output && meshStruct->isOutputField(nd->name)))
+      continue;
 
     int value_type;
     switch (nd->ndims()) {
@@ -1533,7 +1538,8 @@ void Albany::APFDiscretization::removeNodalDataFromAPF () {
     Teuchos::RCP<Albany::PUMINodeDataBase<RealType> >
       nd = Teuchos::rcp_dynamic_cast<Albany::PUMINodeDataBase<RealType>>(
         nfs->second);
-    apf::destroyField(m->findField(nd->name.c_str()));
+    if (apf::Field* f = m->findField(nd->name.c_str()))
+      apf::destroyField(f);
   }
 }
 
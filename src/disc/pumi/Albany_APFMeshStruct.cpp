@@ -240,6 +240,8 @@ void Albany::APFMeshStruct::init(
   } // else
 
   shouldWriteAsciiVtk = params->get<bool>("Write ASCII VTK Files", false);
+  outputFieldNames = params->get<Teuchos::Array<std::string> >(
+      "Output Field Names", Teuchos::Array<std::string>());
 
 }
 
@@ -543,6 +545,8 @@ Albany::APFMeshStruct::getValidDiscretizationParameters() const
       "Offset DOF numberings to start at 2^31 - 1 to test GO types");
 
   validPL->set<bool>("Write ASCII VTK Files", false, "");
+  validPL->set<Teuchos::Array<std::string> >("Output Field Names", defaultFields,
+      "Fields written to the output files, all output fields if empty");
 
   return validPL;
 }
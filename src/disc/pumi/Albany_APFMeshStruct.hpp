@@ -20,6 +20,8 @@
 #endif
 #include <PHAL_Dimension.hpp>
 
+#include <algorithm>
+
 #include <apf.h>
 #include <apfMesh2.h>
 #if defined(HAVE_STK) && defined(ALBANY_SEACAS)
@@ -121,6 +123,14 @@ class APFMeshStruct : public Albany::AbstractMeshStruct {
     bool shouldLoadFELIXData;
     bool shouldWriteAsciiVtk;
 
+    //! Fields written to the output files, all of them if empty
+    Teuchos::Array<std::string> outputFieldNames;
+    bool isOutputField(const std::string& name) const {
+      return outputFieldNames.empty() ||
+        std::find(outputFieldNames.begin(), outputFieldNames.end(), name)
+          != outputFieldNames.end();
+    }
+
     int neq; //! number of equations (components) per node in the solution and residual
     int numDim; //! mesh element dimensionality
     int problemDim; //! (hackish) problem dimensionality, for < 3D problems
@@ -10,6 +10,9 @@
 #define ALBANY_PUMIQPDATA_HPP
 
 
+#include <memory>
+#include <utility>
+
 #include "Teuchos_RCP.hpp"
 #include "Teuchos_ParameterList.hpp"
 
@@ -18,6 +21,21 @@
 
 namespace Albany {
 
+  // Allocator that leaves new elements uninitialized, so the pages of a
+  // buffer are first touched where PUMIQPData::getMDA initializes them
+  template<typename T>
+  struct PUMIQPData_Allocator : std::allocator<T> {
+    template<typename U> struct rebind { typedef PUMIQPData_Allocator<U> other; };
+    PUMIQPData_Allocator() {}
+    template<typename U>
+    PUMIQPData_Allocator(const PUMIQPData_Allocator<U>& a) : std::allocator<T>(a) {}
+    template<typename U> void construct(U* p) { ::new(static_cast<void*>(p)) U; }
+    template<typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+      ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+  };
+
   // Helper class for PUMIQPData
   template<typename DataType, unsigned Dim>
   struct PUMIQPData_Traits { };
@@ -37,11 +55,16 @@ namespace Albany {
     typedef typename traits_type::field_type field_type;
 
     void reAllocateBuffer(const std::size_t nelems);
+
+    //! Array of the next bucket. Its values are zeroed in a Kokkos loop over
+    //! its elements on the host execution space, so with bound threads each
+    //! page is placed on the NUMA domain of the thread that processes those
+    //! elements in the evaluators.
     Albany::MDArray getMDA(const std::size_t nElemsInBucket);
 
     const std::string name;      // Name of data field
     const bool output;           // Is field output to disk each time step (or at end of simulation)?
-    std::vector<DataType> buffer;        // array storage for shards::Array
+    std::vector<DataType, PUMIQPData_Allocator<DataType> > buffer; // array storage for shards::Array
     std::vector<PHX::DataLayout::size_type> dims;
     int nfield_dofs;                    // total number of dofs in this field
     std::size_t beginning_index;        // Buffer starting location for the next array allocation
@@ -8,6 +8,8 @@
 
 #include "Albany_PUMIQPData.hpp"
 
+#include <Kokkos_Core.hpp>
+
 template<typename DataType, unsigned Dim, class traits>
 Albany::PUMIQPData<DataType, Dim, traits>::PUMIQPData(const std::string& name_,
                const std::vector<PHX::DataLayout::size_type>& dim, const bool output_) :
@@ -30,6 +32,8 @@ Albany::PUMIQPData<DataType, Dim, traits>::reAllocateBuffer(const std::size_t ne
 
   std::size_t total_size = nelems * nfield_dofs;
 
+  // Release the old storage so the new pages are untouched until getMDA
+  std::vector<DataType, PUMIQPData_Allocator<DataType> >().swap(buffer);
   buffer.resize(total_size);
 
   beginning_index = 0;
@@ -44,7 +48,16 @@ Albany::PUMIQPData<DataType, Dim, traits>::getMDA(const std::size_t nelems){
 
   unsigned total_size = nelems * nfield_dofs;
 
-  field_type the_array = traits_type::buildArray(&buffer[beginning_index], nelems, dims);
+  DataType* const data = &buffer[beginning_index];
+  const int ndofs = nfield_dofs;
+  Kokkos::parallel_for(
+    Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, nelems),
+    [=] (const int cell) {
+      for (int i = 0; i < ndofs; ++i)
+        data[cell*ndofs + i] = DataType(0);
+    });
+
+  field_type the_array = traits_type::buildArray(data, nelems, dims);
 
   beginning_index += total_size;
 
@@ -6,6 +6,8 @@
 
 #include "Albany_PUMIVtk.hpp"
 
+#include <vector>
+
 Albany::PUMIVtk::
 PUMIVtk(const Teuchos::RCP<APFMeshStruct>& meshStruct,
         const Teuchos::RCP<const Teuchos_Comm>& commT_) :
@@ -93,8 +95,22 @@ writeFile(const double time_value){
 void
 Albany::PUMIVtk::
 callAPFWrite(std::string const& path) {
+  apf::Mesh2* m = mesh_struct->getMesh();
+  if (mesh_struct->outputFieldNames.empty()) {
+    if (mesh_struct->shouldWriteAsciiVtk)
+      apf::writeASCIIVtkFiles(path.c_str(), m);
+    else
+      apf::writeVtkFiles(path.c_str(), m);
+    return;
+  }
+  // Only write the requested fields that are attached to the mesh, the
+  // others (solution history, residual, ...) stay out of the files
+  std::vector<std::string> fields;
+  for (int i = 0; i < mesh_struct->outputFieldNames.size(); ++i)
+    if (m->findField(mesh_struct->outputFieldNames[i].c_str()))
+      fields.push_back(mesh_struct->outputFieldNames[i]);
   if (mesh_struct->shouldWriteAsciiVtk)
-    apf::writeASCIIVtkFiles(path.c_str(), mesh_struct->getMesh());
+    apf::writeASCIIVtkFiles(path.c_str(), m, fields);
   else
-    apf::writeVtkFiles(path.c_str(), mesh_struct->getMesh());
+    apf::writeVtkFiles(path.c_str(), m, fields);
 }
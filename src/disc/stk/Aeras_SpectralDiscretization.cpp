@@ -228,6 +228,7 @@ Aeras::SpectralDiscretization::getJacobianGraphT() const
 Teuchos::RCP<const Tpetra_CrsGraph>
 Aeras::SpectralDiscretization::getImplicitJacobianGraphT() const
 {
+  computeImplicitGraphs();
   return implicit_graphT;
 }
 
@@ -251,9 +252,20 @@ Aeras::SpectralDiscretization::getOverlapJacobianGraphT() const
 Teuchos::RCP<const Tpetra_CrsGraph>
 Aeras::SpectralDiscretization::getImplicitOverlapJacobianGraphT() const
 {
+  computeImplicitGraphs();
   return implicit_overlap_graphT;
 }
 
+void
+Aeras::SpectralDiscretization::computeImplicitGraphs() const
+{
+  if (Teuchos::nonnull(implicit_overlap_graphT)) return;
+  // Building the graphs does not change the discretization
+  SpectralDiscretization& self = const_cast<SpectralDiscretization&>(*this);
+  implicit_overlap_graphT = self.computeOverlapGraph();
+  implicit_graphT = self.computeOwnedGraph(implicit_overlap_graphT);
+}
+
 
 #if defined(ALBANY_EPETRA)
 Teuchos::RCP<const Epetra_Map>
@@ -3654,16 +3666,18 @@ Aeras::SpectralDiscretization::updateMesh()
   // only call this function for hydrostatic (numLevels > 0)
 
   if (explicit_scheme == true) { //explicit scheme
-    //populate implicit_graphT, needed to populate Laplace operator for hyperviscosity
-    implicit_overlap_graphT = computeOverlapGraph();
-    implicit_graphT = computeOwnedGraph(implicit_overlap_graphT);
+    //implicit_graphT, needed to populate Laplace operator for hyperviscosity,
+    //is built on first use: a matrix-free Laplace operator never needs it
+    implicit_overlap_graphT = Teuchos::null;
+    implicit_graphT = Teuchos::null;
     computeGraphs_Explicit();
   }
   else { //implicit scheme
+    //the implicit graphs are the Jacobian graphs
     overlap_graphT = computeOverlapGraph();
     graphT = computeOwnedGraph(overlap_graphT);
-    implicit_overlap_graphT = computeOverlapGraph();
-    implicit_graphT = computeOwnedGraph(overlap_graphT);
+    implicit_overlap_graphT = overlap_graphT;
+    implicit_graphT = graphT;
   }
 
 #ifdef WRITE_TO_MATRIX_MARKET_TO_MM_FILE
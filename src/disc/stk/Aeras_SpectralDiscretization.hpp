@@ -650,6 +650,9 @@ namespace Aeras
     Teuchos::RCP<Tpetra_CrsGraph> computeOverlapGraph();
     Teuchos::RCP<Tpetra_CrsGraph> computeOwnedGraph(Teuchos::RCP<Tpetra_CrsGraph> overlap_graphT_);
 
+    //! Build the implicit graphs if they are not built yet. Collective.
+    void computeImplicitGraphs() const;
+
     //  The following function allocates the graph of a diagonal Jacobian,
     //  relevant for explicit schemes.
     void computeGraphs_Explicit();
@@ -729,13 +732,13 @@ namespace Aeras
     Teuchos::RCP<Tpetra_CrsGraph> graphT;
 
     //! Jacobian matrix implicit graph
-    Teuchos::RCP<Tpetra_CrsGraph> implicit_graphT;
+    mutable Teuchos::RCP<Tpetra_CrsGraph> implicit_graphT;
 
     //! Overlapped Jacobian matrix graph
     Teuchos::RCP<Tpetra_CrsGraph> overlap_graphT;
 
     //! Overlapped Jacobian matrix implicit graph
-    Teuchos::RCP<Tpetra_CrsGraph> implicit_overlap_graphT;
+    mutable Teuchos::RCP<Tpetra_CrsGraph> implicit_overlap_graphT;
 
     //! Processor ID
     unsigned int myPID;
@@ -62,6 +62,12 @@ namespace Albany {
     bool exoOutput;
     std::string exoOutFile;
     int exoOutputInterval;
+    //! Bytes of the reals written to the Exodus output: 4 or 8
+    int exoOutputPrecision = 8;
+    //! NetCDF4 zlib level of the Exodus output, 0 for no compression
+    int exoCompressionLevel = 0;
+    //! Whether the QP states are written to the Exodus output
+    bool exoOutputQPStates = true;
     std::string cdfOutFile;
     bool cdfOutput;
     unsigned nLat;
@@ -5,8 +5,13 @@
 //*****************************************************************//
 
 
+#include <cctype>
 #include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "Albany_AsciiSTKMeshStruct.hpp"
 #include "Teuchos_VerboseObject.hpp"
@@ -36,6 +41,82 @@
 //uncomment the following line if you want debug output to be printed to screen
 //#define OUTPUT_TO_SCREEN
 
+namespace {
+
+//! An ascii mesh file, read into memory at once and parsed row by row
+class AsciiTable {
+public:
+
+  AsciiTable () : pos(NULL), end(NULL) {}
+
+  //! Read the whole file; returns false if it cannot be opened
+  bool open (const char* name) {
+    FILE* file = fopen(name, "rb");
+    if (file == NULL) return false;
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data.resize(size > 0 ? size : 0);
+    const std::size_t nread = data.empty() ? 0 : fread(&data[0], 1, data.size(), file);
+    fclose(file);
+    data.resize(nread);
+    data.push_back('\0');
+    fileName = name;
+    pos = &data[0];
+    end = pos + nread;
+    return true;
+  }
+
+  //! The number on the current row, the rest of which is skipped
+  double header () {
+    while (pos != end && std::isspace(static_cast<unsigned char>(*pos))) ++pos;
+    double value;
+    get(value);
+    nextRow();
+    return value;
+  }
+
+  //! The first n values of the current row, the rest of which is skipped
+  template<typename T>
+  void row (const int n, T* values) {
+    for (int k=0; k<n; ++k)
+      get(values[k]);
+    nextRow();
+  }
+
+  void nextRow () {
+    while (pos != end && *pos != '\n') ++pos;
+    if (pos != end) ++pos;
+  }
+
+private:
+
+  // A value must be on the current row
+  void skipBlanks () {
+    while (pos != end && (*pos == ' ' || *pos == '\t' || *pos == '\r')) ++pos;
+    TEUCHOS_TEST_FOR_EXCEPTION(pos == end || *pos == '\n', std::runtime_error,
+        "Error in AsciiSTKMeshStruct: missing value in file " << fileName << ".\n");
+  }
+
+  void check (const char* last) {
+    TEUCHOS_TEST_FOR_EXCEPTION(last == pos, std::runtime_error,
+        "Error in AsciiSTKMeshStruct: cannot read a number in file " << fileName << ".\n");
+    pos = last;
+  }
+
+  void get (double& value)    { skipBlanks(); char* last; value = std::strtod(pos, &last); check(last); }
+  void get (int& value)       { skipBlanks(); char* last; value = int(std::strtol(pos, &last, 10)); check(last); }
+  void get (long& value)      { skipBlanks(); char* last; value = std::strtol(pos, &last, 10); check(last); }
+  void get (long long& value) { skipBlanks(); char* last; value = std::strtoll(pos, &last, 10); check(last); }
+
+  std::vector<char> data;
+  std::string fileName;
+  const char* pos;
+  const char* end;
+};
+
+} // namespace
+
 
 //Constructor for meshes read from ASCII file
 Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
@@ -107,36 +188,27 @@ Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
 
     //read in coordinates of mesh -- right now hard coded for 3D
     //assumes mesh file is called "xyz" and its first row is the number of nodes
-    FILE *meshfile = fopen(meshfilename,"r");
-    if (meshfile == NULL) { //check if coordinates file exists
+    AsciiTable meshfile;
+    if (!meshfile.open(meshfilename)) { //check if coordinates file exists
       *out << "Error in AsciiSTKMeshStruct: coordinates file " << meshfilename <<" not found!"<< std::endl;
       TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
           std::endl << "Error in AsciiSTKMeshStruct: coordinates file " << meshfilename << " not found!"<< std::endl);
     }
-    double temp;
-    fseek(meshfile, 0, SEEK_SET);
-    safe_fscanf(1, meshfile, "%lf", &temp);
-    NumNodes = int(temp);
+    NumNodes = int(meshfile.header());
 #ifdef OUTPUT_TO_SCREEN
     *out << "numNodes: " << NumNodes << std::endl;
 #endif
     xyz = new double[NumNodes][3];
-    char buffer[100];
-    safe_fgets(buffer, 100, meshfile);
     for (int i=0; i<NumNodes; i++){
-      safe_fgets(buffer, 100, meshfile);
-      safe_sscanf(3, buffer, "%lf %lf %lf", &xyz[i][0], &xyz[i][1], &xyz[i][2]);
+      meshfile.row(3, xyz[i]);
       //*out << "i: " << i << ", x: " << xyz[i][0] << ", y: " << xyz[i][1] << ", z: " << xyz[i][2] << std::endl;
      }
     //read in surface height data from mesh
     //assumes surface height file is called "sh" and its first row is the number of nodes
-    FILE *shfile = fopen(shfilename,"r");
-    have_sh = false;
-    if (shfile != NULL) have_sh = true;
+    AsciiTable shfile;
+    have_sh = shfile.open(shfilename);
     if (have_sh) {
-      fseek(shfile, 0, SEEK_SET);
-      safe_fscanf(1, shfile, "%lf", &temp);
-      int NumNodesSh = int(temp);
+      int NumNodesSh = int(shfile.header());
 #ifdef OUTPUT_TO_SCREEN
       *out << "NumNodesSh: " << NumNodesSh<< std::endl;
 #endif
@@ -146,52 +218,41 @@ Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
             std::endl << "Error in AsciiSTKMeshStruct: sh file must have same number nodes as xyz file!  numNodes in xyz = " << NumNodes << ", numNodes in sh = "<< NumNodesSh << std::endl);
       }
       sh = new double[NumNodes];
-      safe_fgets(buffer, 100, shfile);
       for (int i=0; i<NumNodes; i++){
-        safe_fgets(buffer, 100, shfile);
-        safe_sscanf(1, buffer, "%lf", &sh[i]);
+        shfile.row(1, &sh[i]);
         //*out << "i: " << i << ", sh: " << sh[i] << std::endl;
        }
      }
      //read in connectivity file -- right now hard coded for 3D hexes
      //assumes mesh file is called "eles" and its first row is the number of elements
-     FILE *confile = fopen(confilename,"r");
-     if (confile == NULL) { //check if element connectivity file exists
+     AsciiTable confile;
+     if (!confile.open(confilename)) { //check if element connectivity file exists
       *out << "Error in AsciiSTKMeshStruct: element connectivity file " << confilename <<" not found!"<< std::endl;
       TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
           std::endl << "Error in AsciiSTKMeshStruct: element connectivity file " << confilename << " not found!"<< std::endl);
      }
-     fseek(confile, 0, SEEK_SET);
-     safe_fscanf(1, confile, "%lf", &temp);
-     NumEles = int(temp);
+     NumEles = int(confile.header());
 #ifdef OUTPUT_TO_SCREEN
      *out << "numEles: " << NumEles << std::endl;
 #endif
      eles = new int[NumEles][8];
-     safe_fgets(buffer, 100, confile);
      for (int i=0; i<NumEles; i++){
-        safe_fgets(buffer, 100, confile);
-        safe_sscanf(8, buffer, "%i %i %i %i %i %i %i %i", &eles[i][0], &eles[i][1], &eles[i][2], &eles[i][3], &eles[i][4], &eles[i][5], &eles[i][6], &eles[i][7]);
+        confile.row(8, eles[i]);
         //*out << "elt # " << i << ": " << eles[i][0] << " " << eles[i][1] << " " << eles[i][2] << " " << eles[i][3] << " " << eles[i][4] << " "
         //                  << eles[i][5] << " " << eles[i][6] << " " << eles[i][7] << std::endl;
      }
     //read in basal face connectivity file from ascii file
     //assumes basal face connectivity file is called "bf" and its first row is the number of faces on basal boundary
-    FILE *bffile = fopen(bffilename,"r");
-    have_bf = false;
-    if (bffile != NULL) have_bf = true;
+    AsciiTable bffile;
+    have_bf = bffile.open(bffilename);
     if (have_bf) {
-      fseek(bffile, 0, SEEK_SET);
-      safe_fscanf(1, bffile, "%lf", &temp);
-      NumBasalFaces = int(temp);
+      NumBasalFaces = int(bffile.header());
 #ifdef OUTPUT_TO_SCREEN
       *out << "numBasalFaces: " << NumBasalFaces << std::endl;
 #endif
       bf = new int[NumBasalFaces][5]; //1st column of bf: element # that face belongs to, 2rd-5th columns of bf: connectivity (hard-coded for quad faces)
-      safe_fgets(buffer, 100, bffile);
       for (int i=0; i<NumBasalFaces; i++){
-        safe_fgets(buffer, 100, bffile);
-        safe_sscanf(5, buffer, "%i %i %i %i %i", &bf[i][0], &bf[i][1], &bf[i][2], &bf[i][3], &bf[i][4]);
+        bffile.row(5, bf[i]);
         //*out << "face #:" << bf[i][0] << ", face conn:" << bf[i][1] << " " << bf[i][2] << " " << bf[i][3] << " " << bf[i][4] << std::endl;
        }
      }
@@ -205,17 +266,15 @@ Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
      }
      else {//parallel run: read global element IDs from file.
            //This file should have a header like the other files, and length NumEles.
-       FILE *geIDsfile = fopen(geIDsfilename,"r");
-       if (geIDsfile == NULL) { //check if global element IDs file exists
+       AsciiTable geIDsfile;
+       if (!geIDsfile.open(geIDsfilename)) { //check if global element IDs file exists
          *out << "Error in AsciiSTKMeshStruct: global element IDs file " << geIDsfilename <<" not found!"<< std::endl;
          TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
             std::endl << "Error in AsciiSTKMeshStruct: global element IDs file " << geIDsfilename << " not found!"<< std::endl);
        }
-       fseek(geIDsfile, 0, SEEK_SET);
-       safe_fgets(buffer, 100, geIDsfile);
+       geIDsfile.nextRow();
        for (int i=0; i<NumEles; i++){
-         safe_fgets(buffer, 100, geIDsfile);
-         safe_sscanf(1, buffer, "" ST_LLI" ", &globalElesID[i]);
+         geIDsfile.row(1, &globalElesID[i]);
          globalElesID[i] = globalElesID[i]-1; //subtract 1 b/c global element IDs file assumed to be 1-based not 0-based
          //*out << "local element ID #:" << i << ", global element ID #:" << globalElesID[i] << std::endl;
        }
@@ -230,17 +289,15 @@ Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
      }
      else {//parallel run: read global node IDs from file.
            //This file should have a header like the other files, and length NumNodes
-       FILE *gnIDsfile = fopen(gnIDsfilename,"r");
-       if (gnIDsfile == NULL) { //check if global node IDs file exists
+       AsciiTable gnIDsfile;
+       if (!gnIDsfile.open(gnIDsfilename)) { //check if global node IDs file exists
          *out << "Error in AsciiSTKMeshStruct: global node IDs file " << gnIDsfilename <<" not found!"<< std::endl;
          TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
             std::endl << "Error in AsciiSTKMeshStruct: global node IDs file " << gnIDsfilename << " not found!"<< std::endl);
        }
-       fseek(gnIDsfile, 0, SEEK_SET);
-       safe_fgets(buffer, 100, gnIDsfile);
+       gnIDsfile.nextRow();
        for (int i=0; i<NumNodes; i++){
-         safe_fgets(buffer, 100, gnIDsfile);
-         safe_sscanf(1, buffer, "" ST_LLI" ", &globalNodesID[i]);
+         gnIDsfile.row(1, &globalNodesID[i]);
          globalNodesID[i] = globalNodesID[i]-1; //subtract 1 b/c global node IDs file assumed to be 1-based not 0-based
          //*out << "local node ID #:" << i << ", global node ID #:" << globalNodesID[i] << std::endl;
        }
@@ -254,61 +311,52 @@ Albany::AsciiSTKMeshStruct::AsciiSTKMeshStruct(
      }
      else {//parallel run: read basal face IDs from file.
            //This file should have a header like the other files, and length NumBasalFaces
-       FILE *bfIDsfile = fopen(bfIDsfilename,"r");
-       fseek(bfIDsfile, 0, SEEK_SET);
-       safe_fgets(buffer, 100, bfIDsfile);
+       AsciiTable bfIDsfile;
+       if (!bfIDsfile.open(bfIDsfilename) && NumBasalFaces > 0) { //check if basal face IDs file exists
+         *out << "Error in AsciiSTKMeshStruct: basal face IDs file " << bfIDsfilename <<" not found!"<< std::endl;
+         TEUCHOS_TEST_FOR_EXCEPTION(true, Teuchos::Exceptions::InvalidParameter,
+            std::endl << "Error in AsciiSTKMeshStruct: basal face IDs file " << bfIDsfilename << " not found!"<< std::endl);
+       }
+       bfIDsfile.nextRow();
        for (int i=0; i<NumBasalFaces; i++){
-         safe_fgets(buffer, 100, bfIDsfile);
-         safe_sscanf(1, buffer, "" ST_LLI" ", &basalFacesID[i]);
+         bfIDsfile.row(1, &basalFacesID[i]);
          basalFacesID[i] = basalFacesID[i]-1; //subtract 1 b/c basal face IDs file assumed to be 1-based not 0-based
          //*out << "local face ID #:" << i << ", global face ID #:" << basalFacesID[i] << std::endl;
        }
      }
     //read in flow factor (flwa) data from mesh
     //assumes flow factor file is called "flwa" and its first row is the number of elements in the mesh
-    FILE *flwafile = fopen(flwafilename,"r");
-    have_flwa = false;
-    if (flwafile != NULL) have_flwa = true;
+    AsciiTable flwafile;
+    have_flwa = flwafile.open(flwafilename);
     if (have_flwa) {
-      fseek(flwafile, 0, SEEK_SET);
-      safe_fscanf(1, flwafile, "%lf", &temp);
+      flwafile.header();
       flwa = new double[NumEles];
-      safe_fgets(buffer, 100, flwafile);
       for (int i=0; i<NumEles; i++){
-        safe_fgets(buffer, 100, flwafile);
-        safe_sscanf(1, buffer, "%lf", &flwa[i]);
+        flwafile.row(1, &flwa[i]);
         //*out << "i: " << i << ", flwa: " << flwa[i] << std::endl;
        }
      }
     //read in temperature data from mesh
     //assumes temperature file is called "temp" and its first row is the number of elements in the mesh
-    FILE *tempfile = fopen(tempfilename,"r");
-    have_temp = false;
-    if (tempfile != NULL) have_temp = true;
+    AsciiTable tempfile;
+    have_temp = tempfile.open(tempfilename);
     if (have_temp) {
-      fseek(tempfile, 0, SEEK_SET);
-      safe_fscanf(1, tempfile, "%lf", &temp);
+      tempfile.header();
       temper = new double[NumEles];
-      safe_fgets(buffer, 100, tempfile);
       for (int i=0; i<NumEles; i++){
-        safe_fgets(buffer, 100, tempfile);
-        safe_sscanf(1, buffer, "%lf", &temper[i]);
+        tempfile.row(1, &temper[i]);
         //*out << "i: " << i << ", temp: " << temper[i] << std::endl;
        }
      }
     //read in basal friction (beta) data from mesh
     //assumes basal friction file is called "beta" and its first row is the number of nodes
-    FILE *betafile = fopen(betafilename,"r");
-    have_beta = false;
-    if (betafile != NULL) have_beta = true;
+    AsciiTable betafile;
+    have_beta = betafile.open(betafilename);
     if (have_beta) {
-      fseek(betafile, 0, SEEK_SET);
-      safe_fscanf(1, betafile, "%lf", &temp);
+      betafile.header();
       beta = new double[NumNodes];
-      safe_fgets(buffer, 100, betafile);
       for (int i=0; i<NumNodes; i++){
-        safe_fgets(buffer, 100, betafile);
-        safe_sscanf(1, buffer, "%lf", &beta[i]);
+        betafile.row(1, &beta[i]);
         //*out << "i: " << i << ", beta: " << beta[i] << std::endl;
        }
      }
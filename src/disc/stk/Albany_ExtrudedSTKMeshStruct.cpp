@@ -1362,6 +1362,7 @@ Teuchos::RCP<const Teuchos::ParameterList> Albany::ExtrudedSTKMeshStruct::getVal
   validPL->set<int>("NumLayers", 10, "Number of vertical Layers of the extruded mesh. In a vertical column, the mesh will have numLayers+1 nodes");
   validPL->set<bool>("Use Glimmer Spacing", false, "When true, the layer spacing is computed according to Glimmer formula (layers are denser close to the bedrock)");
   validPL->set<bool>("Columnwise Ordering", false, "True for Columnwise ordering, false for Layerwise ordering");
+  validPL->set<bool>("MueLu Semi-Coarsening", false, "Pass the vertical lines to MueLu and enable semi-coarsening with line smoothing");
 
   validPL->set<std::string>("Thickness Field Name","thickness","Name of the 'thickness' field to use for extrusion");
   validPL->set<std::string>("Surface Height Field Name","surface_height","Name of the 'surface_height' field to use for extrusion");
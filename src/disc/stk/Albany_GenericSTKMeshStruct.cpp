@@ -4,7 +4,9 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
 #include <iostream>
+#include "Teuchos_CommHelpers.hpp"
 #include "Teuchos_VerboseObject.hpp"
 #include "Tpetra_ComputeGatherMap.hpp"
 
@@ -196,13 +198,22 @@ void Albany::GenericSTKMeshStruct::SetupFieldData(
   if (exoOutput)
     exoOutFile = params->get<std::string>("Exodus Output File Name");
   exoOutputInterval = params->get<int>("Exodus Write Interval", 1);
+  exoOutputPrecision = params->get<int>("Exodus Output Precision", 8);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      exoOutputPrecision != 4 && exoOutputPrecision != 8, std::logic_error,
+      "Exodus Output Precision must be 4 or 8, not " << exoOutputPrecision << "\n");
+  exoCompressionLevel = params->get<int>("Exodus Compression Level", 0);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      exoCompressionLevel < 0 || exoCompressionLevel > 9, std::logic_error,
+      "Exodus Compression Level must be between 0 and 9, not " << exoCompressionLevel << "\n");
+  exoOutputQPStates = params->get<bool>("Exodus Output QP States", true);
   cdfOutput = params->isType<std::string>("NetCDF Output File Name");
   if (cdfOutput)
     cdfOutFile = params->get<std::string>("NetCDF Output File Name");
 
   nLat       =  params->get("NetCDF Output Number of Latitudes",100);
   nLon       =  params->get("NetCDF Output Number of Longitudes",100);
-  cdfOutputInterval = params->get<int>("NetCDF Write Interval", 1);
+  cdfOutputInterval = params->get<int>("NetCDF Write Interval", exoOutputInterval);
 
 
   //get the type of transformation of STK mesh 
@@ -448,6 +459,34 @@ int Albany::GenericSTKMeshStruct::computeWorksetSize(const int worksetSizeMax,
   }
 }
 
+int Albany::GenericSTKMeshStruct::
+computeAutomaticWorksetSize(const std::vector<std::string>& ebNames,
+                            const std::vector<const CellTopologyData*>& ctds,
+                            std::ostream& os) const
+{
+  const int cacheKB = params->get<int>("Workset Cache Size", 1024);
+  TEUCHOS_TEST_FOR_EXCEPTION(cacheKB < 1, std::logic_error,
+      "Error! Workset Cache Size must be positive, not " << cacheKB << ".\n");
+
+  // Cost model: the derivative fields at the quadrature points dominate the
+  // workset data. A cell of n nodes carries about n points, each with a
+  // value and numDim gradient components of n+1 doubles (the value and one
+  // derivative per node of a single equation).
+  int worksetSize = 0;
+  for (std::size_t eb = 0; eb < ctds.size(); ++eb) {
+    const double n = ctds[eb]->node_count;
+    const double bytesPerCell = sizeof(double)*(numDim + 1)*n*(n + 1);
+    const int ebWorksetSize =
+      std::max(1, static_cast<int>(1024.0*cacheKB / bytesPerCell));
+    os << "Automatic Workset Size for element block " << ebNames[eb]
+       << " (" << ctds[eb]->name << "): " << ebWorksetSize << std::endl;
+    worksetSize = (eb == 0) ? ebWorksetSize : std::min(worksetSize, ebWorksetSize);
+  }
+  os << "Automatic Workset Size: " << worksetSize
+     << " (set \"Workset Size\" to pin it)" << std::endl;
+  return worksetSize;
+}
+
 namespace {
 
 void only_keep_connectivity_to_specified_ranks(stk::mesh::BulkData& mesh,
@@ -633,6 +672,48 @@ void Albany::GenericSTKMeshStruct::rebalanceInitialMeshT(const Teuchos::RCP<cons
 
 }
 
+void Albany::GenericSTKMeshStruct::rebalanceAndRefineInitialMeshT(const Teuchos::RCP<const Teuchos_Comm>& commT){
+
+  // Rebalance the coarse mesh, which is cheaper to migrate than the refined one
+  rebalanceInitialMeshT(commT);
+
+  // Refinement is local to each rank, so the refined mesh stays balanced
+  uniformRefineMesh(commT);
+
+}
+
+
+namespace {
+
+const char* const rebalanceWeightName = "rebalance_weight";
+
+#ifdef ALBANY_ZOLTAN
+//! Total number of shared nodes over all ranks: a measure of the cut of the
+//! element partition.
+double sharedNodeCut(const stk::mesh::BulkData& bulkData,
+                     const stk::mesh::MetaData& metaData,
+                     const Teuchos::Comm<int>& comm)
+{
+  const double localShared = stk::mesh::count_selected_entities(
+      stk::mesh::Selector(metaData.globally_shared_part()),
+      bulkData.buckets(stk::topology::NODE_RANK));
+  double globalShared = 0;
+  Teuchos::reduceAll(comm, Teuchos::REDUCE_SUM, 1, &localShared,
+                     &globalShared);
+  return globalShared;
+}
+#endif
+
+} // namespace
+
+void Albany::GenericSTKMeshStruct::declareRebalanceWeightField()
+{
+  if (!params->isSublist("Rebalance Block Weights")) return;
+  stk::mesh::Field<double>& weights =
+    metaData->declare_field<stk::mesh::Field<double> >(
+      stk::topology::ELEMENT_RANK, rebalanceWeightName);
+  stk::mesh::put_field(weights, metaData->universal_part());
+}
 
 void Albany::GenericSTKMeshStruct::rebalanceAdaptedMeshT(const Teuchos::RCP<Teuchos::ParameterList>& params_,
                                                         const Teuchos::RCP<const Teuchos::Comm<int> >& comm){
@@ -671,6 +752,42 @@ void Albany::GenericSTKMeshStruct::rebalanceAdaptedMeshT(const Teuchos::RCP<Teuc
 
       std::cout << "Before rebalance: Imbalance threshold is = " << imbalance << endl;
 
+    // Per element block cost weights. Blocks that are not listed weigh 1.
+    stk::mesh::Field<double>* weights =
+      metaData->get_field<stk::mesh::Field<double> >(
+        stk::topology::ELEMENT_RANK, rebalanceWeightName);
+    if (weights != NULL) {
+      const Teuchos::ParameterList& block_weights =
+        params_->sublist("Rebalance Block Weights");
+      std::vector<double> eb_weights(partVec.size(), 1.0);
+      for (Teuchos::ParameterList::ConstIterator it = block_weights.begin();
+           it != block_weights.end(); ++it) {
+        const std::string& eb_name = block_weights.name(it);
+        std::map<std::string, int>::const_iterator eb =
+          ebNameToIndex.find(eb_name);
+        TEUCHOS_TEST_FOR_EXCEPTION(eb == ebNameToIndex.end(), std::logic_error,
+          "Rebalance Block Weights: unknown element block " << eb_name << "\n");
+        eb_weights[eb->second] = block_weights.get<double>(eb_name);
+        TEUCHOS_TEST_FOR_EXCEPTION(eb_weights[eb->second] <= 0.0,
+          std::logic_error,
+          "Rebalance Block Weights: the weight of " << eb_name
+          << " must be positive\n");
+      }
+      for (std::map<int, stk::mesh::Part*>::const_iterator eb = partVec.begin();
+           eb != partVec.end(); ++eb) {
+        const stk::mesh::BucketVector& buckets = bulkData->get_buckets(
+          stk::topology::ELEMENT_RANK, stk::mesh::Selector(*eb->second));
+        for (std::size_t b = 0; b < buckets.size(); ++b) {
+          double* w = stk::mesh::field_data(*weights, *buckets[b]);
+          std::fill(w, w + buckets[b]->size(), eb_weights[eb->first]);
+        }
+      }
+    }
+
+    const double cut_before = sharedNodeCut(*bulkData, *metaData, *comm);
+    const double elem_imbalance_before = stk::rebalance::check_balance(
+      *bulkData, weights, stk::topology::ELEMENT_RANK, &owned_selector);
+
     // Use Zoltan to determine new partition. Set the desired parameters (if any) from the input file
 
     Teuchos::ParameterList graph_options;
@@ -695,7 +812,7 @@ void Albany::GenericSTKMeshStruct::rebalanceAdaptedMeshT(const Teuchos::RCP<Teuc
     const Teuchos::MpiComm<int>* mpiComm = dynamic_cast<const Teuchos::MpiComm<int>* > (comm.get());
 
     stk::rebalance::Zoltan zoltan_partition(*bulkData, *mpiComm->getRawMpiComm(), numDim, graph_options);
-    stk::rebalance::rebalance(*bulkData, owned_selector, coordinates_field, NULL, zoltan_partition);
+    stk::rebalance::rebalance(*bulkData, owned_selector, coordinates_field, weights, zoltan_partition);
 
     imbalance = stk::rebalance::check_balance(*bulkData, NULL,
       stk::topology::NODE_RANK, &selector);
@@ -703,6 +820,17 @@ void Albany::GenericSTKMeshStruct::rebalanceAdaptedMeshT(const Teuchos::RCP<Teuc
     if(comm->getRank() == 0)
       std::cout << "After rebalance: Imbalance threshold is = " << imbalance << endl;
 
+    const double cut_after = sharedNodeCut(*bulkData, *metaData, *comm);
+    const double elem_imbalance_after = stk::rebalance::check_balance(
+      *bulkData, weights, stk::topology::ELEMENT_RANK, &owned_selector);
+
+    if(comm->getRank() == 0) {
+      std::cout << "Rebalance: " << (weights != NULL ? "weighted " : "")
+                << "element imbalance " << elem_imbalance_before << " -> "
+                << elem_imbalance_after << ", shared nodes " << cut_before
+                << " -> " << cut_after << endl;
+    }
+
 #if 0 // Other experiments at rebalancing
 
     // Configure Zoltan to use graph-based partitioning
@@ -1771,9 +1899,15 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
 #endif
   validPL->set<bool>("Output DTK Field to Exodus", true, "Boolean indicating whether to write dtk field to exodus file");  
   validPL->set<int>("Exodus Write Interval", 3, "Step interval to write solution data to Exodus file");
+  validPL->set<int>("Exodus Output Precision", 8,
+      "Bytes of the reals written to the Exodus output: 8 (double) or 4 (float, for visualization only)");
+  validPL->set<int>("Exodus Compression Level", 0,
+      "Write the Exodus output as NetCDF4 with this zlib compression level (1 to 9); 0 does not compress");
+  validPL->set<bool>("Exodus Output QP States", true,
+      "Write the QP states to the Exodus output. Use a Checkpoint File Name to keep them for restarts otherwise");
   validPL->set<std::string>("NetCDF Output File Name", "",
       "Request NetCDF output to given file name. Requires SEACAS build");
-  validPL->set<int>("NetCDF Write Interval", 1, "Step interval to write solution data to NetCDF file");
+  validPL->set<int>("NetCDF Write Interval", 1, "Step interval to write solution data to NetCDF file (default: Exodus Write Interval)");
   validPL->set<int>("NetCDF Output Number of Latitudes", 1,
       "Number of samples in Latitude direction for NetCDF output. Default is 100.");
   validPL->set<int>("NetCDF Output Number of Longitudes", 1,
@@ -1783,8 +1917,23 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
   validPL->set<int>("Cubature Degree", 3, "Integration order sent to Intrepid2");
   validPL->set<std::string>("Cubature Rule", "", "Integration rule sent to Intrepid2: GAUSS, GAUSS_RADAU_LEFT, GAUSS_RADAU_RIGHT, GAUSS_LOBATTO");
   validPL->set<int>("Workset Size", DEFAULT_WORKSET_SIZE, "Upper bound on workset (bucket) size");
+  validPL->set<bool>("Automatic Workset Size", false,
+                     "Choose the workset size from the element topologies and the Workset Cache Size");
+  validPL->set<int>("Workset Cache Size", 1024,
+                    "Target size in KB of the per-cell data of one workset, used by Automatic Workset Size");
   validPL->set<bool>("Use Automatic Aura", false, "Use automatic aura with BulkData");
   validPL->set<bool>("Interleaved Ordering", true, "Flag for interleaved or blocked unknown ordering");
+  validPL->set<bool>("Precompute Jacobian Offsets", false,
+                     "Precompute the Jacobian value offsets of each element so the scatter needs no column search");
+  validPL->set<std::string>("Checkpoint File Name", "",
+                            "Write a per-rank binary checkpoint of the mesh fields with each exodus output");
+  validPL->set<double>("Checkpoint MTBF", 0.0,
+                       "Mean time between failures of the system in seconds. If positive, the checkpoint "
+                       "interval is chosen from it and the measured write cost instead of the exodus output");
+  validPL->set<bool>("Contiguous Workset Coordinates", false,
+                     "Keep a contiguous copy of the element coordinates of each workset for the coordinate gather");
+  validPL->set<std::string>("Node Ordering", "None",
+                            "Local numbering of the nodes: None (mesh order), RCM or Hilbert");
   validPL->set<bool>("Separate Evaluators by Element Block", false,
                      "Flag for different evaluation trees for each Element Block");
   validPL->set<std::string>("Transform Type", "None", "None or ISMIP-HOM Test A"); //for FELIX problem that require tranformation of STK mesh
@@ -1831,6 +1980,7 @@ Albany::GenericSTKMeshStruct::getValidGenericSTKParameters(std::string listname)
   validPL->set<std::string>("STK Initial Enrich", "", "stk::percept enrichment option to apply after the mesh is input");
   validPL->set<std::string>("STK Initial Convert", "", "stk::percept conversion option to apply after the mesh is input");
   validPL->set<bool>("Rebalance Mesh", false, "Parallel re-load balance initial mesh after generation");
+  validPL->sublist("Rebalance Block Weights", false, "Cost weight of the elements of each listed element block for the rebalance (default 1)");
   validPL->set<int>("Number of Refinement Passes", 1, "Number of times to apply the refinement process");
 
   validPL->sublist("Side Set Discretizations", false, "A sublist containing info for storing side discretizations");
@@ -84,9 +84,21 @@ namespace Albany {
     //! Utility function that uses some integer arithmetic to choose a good worksetSize
     int computeWorksetSize(const int worksetSizeMax, const int ebSizeMax) const;
 
+    //! Upper bound on the workset size for "Automatic Workset Size". For each
+    //! element block, the largest workset whose per-cell data fits in
+    //! "Workset Cache Size" is printed to os. STK buckets share a single
+    //! capacity, so the smallest of these sizes is returned.
+    int computeAutomaticWorksetSize(const std::vector<std::string>& ebNames,
+                                    const std::vector<const CellTopologyData*>& ctds,
+                                    std::ostream& os) const;
+
     //! Re-load balance mesh
     void rebalanceInitialMeshT(const Teuchos::RCP<const Teuchos::Comm<int> >& comm);
 
+    //! Declare the element weight field used by the rebalance if "Rebalance
+    //! Block Weights" is given. Must be called before the meta data commit.
+    void declareRebalanceWeightField();
+
     //! Sets all mesh parts as IO parts (will be written to file)
     void setAllPartsIO();
 
@@ -97,6 +109,14 @@ namespace Albany {
     //! Perform initial uniform refinement of the mesh
     void uniformRefineMesh(const Teuchos::RCP<const Teuchos_Comm>& commT);
 
+    //! Rebalance the initial mesh if indicated, then refine it if indicated.
+    //! Uniform refinement splits every element into the same number of
+    //! children on the rank owning it, so the balance of the coarse mesh
+    //! carries over. Distributing the coarse mesh first lets every rank
+    //! refine its own part, instead of refining the whole (e.g. serial) mesh
+    //! and migrating the refined one.
+    void rebalanceAndRefineInitialMeshT(const Teuchos::RCP<const Teuchos_Comm>& commT);
+
     //! Creates a node set from a side set
     void addNodeSetsFromSideSets ();
 
@@ -5,6 +5,7 @@
 //*****************************************************************//
 
 
+#include <cstring>
 #include <iostream>
 
 #include "Albany_GmshSTKMeshStruct.hpp"
@@ -326,11 +327,8 @@ void Albany::GmshSTKMeshStruct::setFieldAndBulkData(
   // Gmsh is for sure using a serial mesh. We hard code it here, in case the user did not set it
   params->set<bool>("Use Serial Mesh", true);
 
-  // Refine the mesh before starting the simulation if indicated
-  uniformRefineMesh(commT);
-
-  // Rebalance the mesh before starting the simulation if indicated
-  rebalanceInitialMeshT(commT);
+  // Rebalance and refine the mesh before starting the simulation if indicated
+  rebalanceAndRefineInitialMeshT(commT);
 #endif
 
   // Loading required input fields from file
@@ -738,7 +736,7 @@ void Albany::GmshSTKMeshStruct::loadAsciiMesh (const std::string& fname)
 void Albany::GmshSTKMeshStruct::loadBinaryMesh (const std::string& fname)
 {
   std::ifstream ifile;
-  ifile.open(fname.c_str());
+  ifile.open(fname.c_str(), std::ios::in | std::ios::binary);
   if (!ifile.is_open())
   {
       TEUCHOS_TEST_FOR_EXCEPTION(true, std::runtime_error, "Error! Cannot open mesh file '" << fname << "'.\n");
@@ -748,6 +746,12 @@ void Albany::GmshSTKMeshStruct::loadBinaryMesh (const std::string& fname)
   std::getline (ifile, line); // $MeshFormat
   std::getline (ifile, line); // 2.0 file-type data-size
 
+  std::stringstream iss (line);
+  float version;
+  int file_type, data_size;
+  iss >> version >> file_type >> data_size;
+  TEUCHOS_TEST_FOR_EXCEPTION (data_size!=static_cast<int>(sizeof(double)), std::runtime_error, "Error! Binary mesh must store reals in " << sizeof(double) << " bytes.\n");
+
   // Check file endianness
   union
   {
@@ -758,8 +762,8 @@ void Albany::GmshSTKMeshStruct::loadBinaryMesh (const std::string& fname)
   ifile.read (one.c, sizeof (int) );
   TEUCHOS_TEST_FOR_EXCEPTION (one.i!=1, std::runtime_error, "Error! Uncompatible binary format.\n");
 
-  // Start reading nodes
-  ifile.seekg (0, std::ios::beg);
+  // Start reading nodes. The sections are searched from the current position, so that the
+  // search never runs through binary data.
   while (std::getline (ifile, line) && line != "$Nodes")
   {
     // Keep swallowing lines...
@@ -772,16 +776,18 @@ void Albany::GmshSTKMeshStruct::loadBinaryMesh (const std::string& fname)
   TEUCHOS_TEST_FOR_EXCEPTION (NumNodes<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of nodes.\n");
   pts = new double[NumNodes][3];
 
-  // Read the nodes
-  int id;
+  // Read all the nodes at once. Each one is an int id followed by three doubles.
+  const std::size_t node_size = sizeof(int) + 3*sizeof(double);
+  std::vector<char> buffer (NumNodes*node_size);
+  ifile.read (&buffer[0], buffer.size());
+  TEUCHOS_TEST_FOR_EXCEPTION (!ifile, std::runtime_error, "Error! Nodes section is truncated.\n");
   for (int i=0; i<NumNodes; ++i)
   {
-    ifile.read (reinterpret_cast<char*> (&id), sizeof (int) );
-    ifile.read (reinterpret_cast<char*> (pts[i]), 3 * sizeof (double) );
+    std::memcpy (pts[i], &buffer[i*node_size+sizeof(int)], 3*sizeof(double));
   }
+  std::vector<char>().swap(buffer);
 
   // Start reading elements (cells and sides)
-  ifile.seekg (0, std::ios::beg);
   while (std::getline (ifile, line) && line != "$Elements")
   {
     // Keep swallowing lines...
@@ -793,15 +799,33 @@ void Albany::GmshSTKMeshStruct::loadBinaryMesh (const std::string& fname)
   int num_entities = std::atoi (line.c_str() );
   TEUCHOS_TEST_FOR_EXCEPTION (num_entities<=0, Teuchos::Exceptions::InvalidParameter, "Error! Invalid number of mesh elements.\n");
 
+  const std::streampos elements_begin = ifile.tellg();
+
+  // Number of nodes of the supported entity types
+  auto entity_nodes = [](const int e_type) -> int {
+    switch (e_type)
+    {
+      case 1:  return 2; // 2-pt Line
+      case 2:  return 3; // 3-pt Triangle
+      case 3:  return 4; // 4-pt Quad
+      case 4:  return 4; // 4-pt Tetra
+      case 5:  return 8; // 8-pt Hexa
+      case 15: return 1; // Point
+      default:
+        TEUCHOS_TEST_FOR_EXCEPTION (true, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported.\n");
+    }
+    return 0;
+  };
+
   // Gmsh lists elements and sides (and some points) all toghether, and does not specify beforehand what kind of elements
   // the mesh has. Hence, we need to scan the entity list once to establish what kind of elements we have. We support
-  // linear Tetrahedra/Hexahedra in 3D and linear Triangle/Quads in 2D
-  std::vector<int> tmp;
+  // linear Tetrahedra/Hexahedra in 3D and linear Triangle/Quads in 2D. The scan only reads the block headers.
   int nb_tetra(0), nb_hexa(0), nb_tria(0), nb_quad(0), nb_line(0), n_tags(0), e_type(0), entities_found(0);
   while (entities_found<num_entities)
   {
     int header[3];
     ifile.read(reinterpret_cast<char*> (header), 3*sizeof(int));
+    TEUCHOS_TEST_FOR_EXCEPTION (!ifile, std::runtime_error, "Error! Element section is truncated.\n");
 
     TEUCHOS_TEST_FOR_EXCEPTION (header[1]<=0, std::logic_error, "Error! Invalid number of elements of this type.\n");
     TEUCHOS_TEST_FOR_EXCEPTION (header[2]<=0, std::logic_error, "Error! Invalid number of tags.\n");
@@ -810,49 +834,23 @@ void Albany::GmshSTKMeshStruct::loadBinaryMesh (const std::string& fname)
     entities_found += header[1];
     n_tags = header[2];
 
-    int length;
     switch (e_type)
     {
-      case 1: // 2-pt Line
-        length = 1+n_tags+2; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        nb_line += header[1];
-        break;
-      case 2: // 3-pt Triangle
-        length = 1+n_tags+3; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        nb_tria += header[1];
-        break;
-      case 3: // 4-pt Quad
-        length = 1+n_tags+4; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        nb_quad += header[1];
-        break;
-      case 4: // 4-pt Tetra
-        length = 1+n_tags+4; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        nb_quad += header[1];
-        break;
-      case 5: // 8-pt Hexa
-        length = 1+n_tags+8; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        nb_quad += header[1];
-        break;
-      case 15: // Point
-        break;
-      default:
-        TEUCHOS_TEST_FOR_EXCEPTION (true, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported.\n");
+      case 1: nb_line  += header[1]; break;
+      case 2: nb_tria  += header[1]; break;
+      case 3: nb_quad  += header[1]; break;
+      case 4: nb_tetra += header[1]; break;
+      case 5: nb_hexa  += header[1]; break;
     }
+
+    const std::streamoff length = 1+n_tags+entity_nodes(e_type); // id, tags, points
+    ifile.seekg (header[1]*length*sizeof(int), std::ios::cur);
   }
   TEUCHOS_TEST_FOR_EXCEPTION (nb_tetra*nb_hexa!=0, std::logic_error, "Error! Cannot mix tetrahedra and hexahedra.\n");
   TEUCHOS_TEST_FOR_EXCEPTION (nb_tria*nb_quad!=0, std::logic_error, "Error! Cannot mix triangles and quadrilaterals.\n");
   TEUCHOS_TEST_FOR_EXCEPTION (nb_tetra+nb_hexa+nb_tria+nb_quad==0, std::logic_error, "Error! Can only handle 2D and 3D geometries.\n");
 
+  // Node ids, followed by the tag
   lines = new int*[3];
   tetra = new int*[5];
   trias = new int*[4];
@@ -860,7 +858,7 @@ void Albany::GmshSTKMeshStruct::loadBinaryMesh (const std::string& fname)
   quads = new int*[5];
   for (int i(0); i<5; ++i)
     tetra[i] = new int[nb_tetra];
-  for (int i(0); i<5; ++i)
+  for (int i(0); i<4; ++i)
     trias[i] = new int[nb_tria];
   for (int i(0); i<9; ++i)
     hexas[i] = new int[nb_hexa];
@@ -914,101 +912,46 @@ void Albany::GmshSTKMeshStruct::loadBinaryMesh (const std::string& fname)
     sides = lines;
   }
 
-  // Reset the stream to the beginning of the element section
-  ifile.seekg (0, std::ios::beg);
-  while (std::getline (ifile, line) && line != "$Elements")
-  {
-    // Keep swallowing lines...
-  }
-  std::getline(ifile,line); // Skip line with number of elements
+  // Go back to the beginning of the element list, and read it one block at a time
+  ifile.clear();
+  ifile.seekg (elements_begin);
 
   entities_found = 0;
   int iline(0), itria(0), iquad(0), itetra(0), ihexa(0);
+  std::vector<int> tmp;
   while (entities_found<num_entities)
   {
     int header[3];
     ifile.read(reinterpret_cast<char*> (header), 3*sizeof(int));
 
-    TEUCHOS_TEST_FOR_EXCEPTION (header[1]<=0, std::logic_error, "Error! Invalid number of elements of this type.\n");
-    TEUCHOS_TEST_FOR_EXCEPTION (header[2]<=0, std::logic_error, "Error! Invalid number of tags.\n");
-
     e_type = header[0];
     entities_found += header[1];
     n_tags = header[2];
 
-    int length;
+    const int num_nodes = entity_nodes(e_type);
+    const int length = 1+n_tags+num_nodes; // id, tags, points
+    tmp.resize(header[1]*length);
+    ifile.read (reinterpret_cast<char*> (&tmp[0]), tmp.size()*sizeof(int));
+    TEUCHOS_TEST_FOR_EXCEPTION (!ifile, std::runtime_error, "Error! Element section is truncated.\n");
+
+    int** entities;
+    int* index;
     switch (e_type)
     {
-      case 1: // 2-pt Line
-        length = 1+n_tags+2; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        for (int j(0); j<header[1]; ++j, ++iline)
-        {
-          lines[0][j] = tmp[sizeof(int)*(j*length+1+n_tags)];   // First pt
-          lines[1][j] = tmp[sizeof(int)*(j*length+1+n_tags+1)];
-          lines[2][j] = tmp[sizeof(int)*(j*length+1)];          // Use first tag
-        }
-        break;
-      case 2: // 3-pt Triangle
-        length = 1+n_tags+3; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        for (int j(0); j<header[1]; ++j, ++itria)
-        {
-          trias[0][j] = tmp[sizeof(int)*(j*length+1+n_tags)];   // First pt
-          trias[1][j] = tmp[sizeof(int)*(j*length+1+n_tags+1)];
-          trias[2][j] = tmp[sizeof(int)*(j*length+1+n_tags+2)];
-          trias[3][j] = tmp[sizeof(int)*(j*length+1)];          // Use first tag
-        }
-        break;
-      case 3: // 4-pt Quad
-        length = 1+n_tags+4; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        for (int j(0); j<header[1]; ++j, ++iquad)
-        {
-          quads[0][j] = tmp[sizeof(int)*(j*length+1+n_tags)];   // First pt
-          quads[1][j] = tmp[sizeof(int)*(j*length+1+n_tags+1)];
-          quads[2][j] = tmp[sizeof(int)*(j*length+1+n_tags+2)];
-          quads[3][j] = tmp[sizeof(int)*(j*length+1+n_tags+3)];
-          quads[4][j] = tmp[sizeof(int)*(j*length+1)];          // Use first tag
-        }
-        break;
-      case 4: // 4-pt Tetra
-        length = 1+n_tags+4; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        for (int j(0); j<header[1]; ++j, ++itetra)
-        {
-          tetra[0][j] = tmp[sizeof(int)*(j*length+1+n_tags)];   // First pt
-          tetra[1][j] = tmp[sizeof(int)*(j*length+1+n_tags+1)];
-          tetra[2][j] = tmp[sizeof(int)*(j*length+1+n_tags+2)];
-          tetra[3][j] = tmp[sizeof(int)*(j*length+1+n_tags+3)];
-          tetra[4][j] = tmp[sizeof(int)*(j*length+1)];          // Use first tag
-        }
-        break;
-      case 5: // 8-pt Hexa
-        length = 1+n_tags+8; // id, tags, points
-        tmp.resize(header[1]*length);
-        ifile.read (reinterpret_cast<char*> (&tmp[0]), header[1]*length*sizeof(int));
-        for (int j(0); j<header[1]; ++j, ++ihexa)
-        {
-          hexas[0][j] = tmp[sizeof(int)*(j*length+1+n_tags)];   // First pt
-          hexas[1][j] = tmp[sizeof(int)*(j*length+1+n_tags+1)];
-          hexas[2][j] = tmp[sizeof(int)*(j*length+1+n_tags+2)];
-          hexas[3][j] = tmp[sizeof(int)*(j*length+1+n_tags+3)];
-          hexas[4][j] = tmp[sizeof(int)*(j*length+1+n_tags+4)];
-          hexas[5][j] = tmp[sizeof(int)*(j*length+1+n_tags+5)];
-          hexas[6][j] = tmp[sizeof(int)*(j*length+1+n_tags+6)];
-          hexas[7][j] = tmp[sizeof(int)*(j*length+1+n_tags+7)];
-          hexas[8][j] = tmp[sizeof(int)*(j*length+1)];          // Use first tag
-        }
-        break;
-      case 15: // Point
-        break;
-      default:
-        TEUCHOS_TEST_FOR_EXCEPTION (true, Teuchos::Exceptions::InvalidParameter, "Error! Element type not supported.\n");
+      case 1: entities = lines; index = &iline;  break;
+      case 2: entities = trias; index = &itria;  break;
+      case 3: entities = quads; index = &iquad;  break;
+      case 4: entities = tetra; index = &itetra; break;
+      case 5: entities = hexas; index = &ihexa;  break;
+      default: continue; // Point
+    }
+
+    for (int j(0); j<header[1]; ++j, ++(*index))
+    {
+      const int* entity = &tmp[j*length];
+      for (int k(0); k<num_nodes; ++k)
+        entities[k][*index] = entity[1+n_tags+k];
+      entities[num_nodes][*index] = entity[1]; // Use first tag
     }
   }
 
@@ -7,9 +7,11 @@
 
 #ifdef ALBANY_SEACAS
 
+#include <algorithm>
 #include <iostream>
 
 #include "Albany_IossSTKMeshStruct.hpp"
+#include "Albany_STKCheckpoint.hpp"
 #include "Teuchos_VerboseObject.hpp"
 
 #include <Shards_BasicTopologies.hpp>
@@ -199,6 +201,16 @@ Albany::IossSTKMeshStruct::IossSTKMeshStruct(
   get_element_block_sizes(*mesh_data, el_blocks);
   TEUCHOS_TEST_FOR_EXCEPT(el_blocks.size() != partVec.size());
 
+  if (params->get<bool>("Automatic Workset Size", false)) {
+    std::vector<std::string> ebNames(numEB);
+    std::vector<const CellTopologyData*> ctds(numEB);
+    for (int eb=0; eb<numEB; eb++) {
+      ebNames[eb] = partVec[eb]->name();
+      ctds[eb] = metaData->get_cell_topology(*partVec[eb]).getCellTopologyData();
+    }
+    worksetSizeMax = this->computeAutomaticWorksetSize(ebNames, ctds, *out);
+  }
+
   int ebSizeMax =  *std::max_element(el_blocks.begin(), el_blocks.end());
   int worksetSize = this->computeWorksetSize(worksetSizeMax, ebSizeMax);
 
@@ -291,11 +303,21 @@ Albany::IossSTKMeshStruct::setFieldAndBulkData (
   mesh_data->add_all_mesh_fields_as_input_fields();
   std::vector<stk::io::MeshField> missing;
 
+  this->declareRebalanceWeightField();
+
   metaData->commit();
 
   // Restart index to read solution from exodus file.
   int index = params->get("Restart Index",-1); // Default to no restart
   double res_time = params->get<double>("Restart Time",-1.0); // Default to no restart
+
+  // A checkpoint written by STKDiscretization replaces the exodus restart
+  const std::string checkpoint =
+    params->get<std::string>("Restart Checkpoint File Name", "");
+  if (!checkpoint.empty()) {
+    index = -1;
+    res_time = -1.0;
+  }
   Ioss::Region& region = *(mesh_data->get_input_io_region());
   /*
    * The following code block reads a single mesh on PE 0, then distributes the mesh across
@@ -396,6 +418,15 @@ Albany::IossSTKMeshStruct::setFieldAndBulkData (
 
   } // End Parallel Read - or running in serial
 
+  std::vector<std::string> checkpointFields;
+  if (!checkpoint.empty()) {
+    *out << "Restart Checkpoint File Name set, reading fields from checkpoint : "
+         << checkpoint << std::endl;
+    m_restartDataTime = readSTKCheckpoint(checkpoint, *bulkData, checkpointFields,
+                                          params->get<int>("Restart Checkpoint Ranks", 0));
+    m_hasRestartSolution = true;
+  }
+
   if(m_hasRestartSolution){
 
     Teuchos::Array<std::string> default_field;
@@ -417,6 +448,16 @@ Albany::IossSTKMeshStruct::setFieldAndBulkData (
     *out << "Found field \"" << exo_fld_names[i] << "\" in exodus file" << std::endl; } */
 
     for (std::size_t i=0; i<sis->size(); i++) { Albany::StateStruct& st = *((*sis)[i]);
+      // The checkpoint restores every state it holds
+      if (!checkpoint.empty()) {
+        if (std::find(checkpointFields.begin(), checkpointFields.end(), st.name) !=
+            checkpointFields.end()) {
+          *out << "Restarting from field \"" << st.name << "\" found in checkpoint." << std::endl;
+          st.restartDataAvailable = true;
+        }
+        continue;
+      }
+
       if(elem_blocks[0]->field_exists(st.name))
 
         for(std::size_t j = 0; j < restart_fields.size(); j++)
@@ -500,11 +541,8 @@ Albany::IossSTKMeshStruct::setFieldAndBulkData (
   // Loading required input fields from file
   this->loadRequiredInputFields (req,commT);
 
-  // Refine the mesh before starting the simulation if indicated
-  uniformRefineMesh(commT);
-
-  // Rebalance the mesh before starting the simulation if indicated
-  rebalanceInitialMeshT(commT);
+  // Rebalance and refine the mesh before starting the simulation if indicated
+  rebalanceAndRefineInitialMeshT(commT);
 
   // Build additional mesh connectivity needed for mesh fracture (if indicated)
   computeAddlConnectivity();
@@ -578,6 +616,10 @@ Albany::IossSTKMeshStruct::getValidDiscretizationParameters() const
   validPL->set<std::string>("Pamgen Input File Name", "", "File Name For Pamgen Mesh Input");
   validPL->set<int>("Restart Index", 1, "Exodus time index to read for inital guess/condition.");
   validPL->set<double>("Restart Time", 1.0, "Exodus solution time to read for inital guess/condition.");
+  validPL->set<std::string>("Restart Checkpoint File Name", "",
+      "Checkpoint written with Checkpoint File Name to restart from instead of the exodus fields");
+  validPL->set<int>("Restart Checkpoint Ranks", 0,
+      "Number of ranks the restart checkpoint was written with, if not the current one; its entities are then redistributed by id");
   validPL->set<Teuchos::ParameterList>("Required Fields Info",Teuchos::ParameterList());
   validPL->set<bool>("Write points coordinates to ascii file", "", "Write the mesh points coordinates to file?");
 
@@ -0,0 +1,401 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stk_mesh/base/FieldBase.hpp>
+#include <stk_mesh/base/GetEntities.hpp>
+#include <stk_mesh/base/MetaData.hpp>
+
+#include "Albany_STKCheckpoint.hpp"
+#include "Teuchos_TestForException.hpp"
+
+namespace {
+
+const char     checkpointMagic[8] = {'A', 'L', 'B', 'C', 'K', 'P', 'T', '1'};
+const uint32_t checkpointVersion  = 1;
+
+std::string
+rankFileName(const std::string& fileName, const int numProcs, const int proc)
+{
+  std::ostringstream name;
+  name << fileName << "." << numProcs << "." << proc;
+  return name.str();
+}
+
+//! Locally owned and shared entities of rank, sorted by id
+std::vector<stk::mesh::Entity>
+checkpointEntities(
+    const stk::mesh::BulkData& bulkData,
+    const stk::mesh::EntityRank rank)
+{
+  const stk::mesh::MetaData& metaData = bulkData.mesh_meta_data();
+  const stk::mesh::Selector  selector =
+      stk::mesh::Selector(metaData.locally_owned_part()) |
+      stk::mesh::Selector(metaData.globally_shared_part());
+  std::vector<stk::mesh::Entity> entities;
+  stk::mesh::get_selected_entities(
+      selector, bulkData.buckets(rank), entities);
+  std::sort(
+      entities.begin(),
+      entities.end(),
+      [&bulkData](const stk::mesh::Entity a, const stk::mesh::Entity b) {
+        return bulkData.identifier(a) < bulkData.identifier(b);
+      });
+  return entities;
+}
+
+template <typename T>
+void
+put(std::ofstream& file, const T& value)
+{
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+//! Bounds checked reader of the mapped file
+class Cursor {
+ public:
+  Cursor(const char* data, const std::size_t size, const std::string& name)
+      : data_(data), size_(size), pos_(0), name_(name)
+  {
+  }
+
+  const char*
+  take(const std::size_t bytes)
+  {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        bytes > size_ - pos_,
+        std::runtime_error,
+        "Checkpoint " << name_ << " is truncated.\n");
+    const char* const p = data_ + pos_;
+    pos_ += bytes;
+    return p;
+  }
+
+  template <typename T>
+  T
+  get()
+  {
+    T value;
+    std::memcpy(&value, take(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+ private:
+  const char* const data_;
+  const std::size_t size_;
+  std::size_t       pos_;
+  const std::string name_;
+};
+
+//! Read only mapping of a checkpoint file
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& name) : data_(NULL), size_(0)
+  {
+    const int fd = open(name.c_str(), O_RDONLY);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        fd < 0,
+        std::runtime_error,
+        "Cannot open checkpoint " << name
+                                  << ". Set Restart Checkpoint Ranks to the "
+                                     "number of ranks it was written with.\n");
+    struct stat st;
+    const bool  haveSize = fstat(fd, &st) == 0;
+    size_ = haveSize ? st.st_size : 0;
+    void* const map = (size_ > 0) ?
+        mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        map == MAP_FAILED,
+        std::runtime_error,
+        "Cannot map checkpoint " << name << ".\n");
+    data_ = static_cast<const char*>(map);
+  }
+
+  ~MappedFile() { munmap(const_cast<char*>(data_), size_); }
+
+  const char*
+  data() const
+  {
+    return data_;
+  }
+  std::size_t
+  size() const
+  {
+    return size_;
+  }
+
+ private:
+  MappedFile(const MappedFile&);
+  MappedFile& operator=(const MappedFile&);
+
+  const char* data_;
+  std::size_t size_;
+};
+
+//! Entities of one rank file, and whether each field was restored with the
+//! expected size on all of them
+struct RestoreStatus {
+  std::vector<std::set<uint64_t>>   restoredIds;
+  std::map<std::string, bool>       fieldRestored;
+};
+
+//! Restore the fields of bulkData from the rank file name written by rank
+//! proc of numProcs. With the same decomposition the entities of the file
+//! are the locally owned and shared entities of bulkData, in order, and the
+//! blobs are copied straight back. Otherwise the entities are looked up by
+//! id and those this rank does not own or share are skipped.
+double
+readRankFile(
+    const std::string&   name,
+    const int            numProcs,
+    const int            proc,
+    stk::mesh::BulkData& bulkData,
+    RestoreStatus&       status)
+{
+  const MappedFile map(name);
+  Cursor           cursor(map.data(), map.size(), name);
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      std::memcmp(
+          cursor.take(sizeof(checkpointMagic)),
+          checkpointMagic,
+          sizeof(checkpointMagic)) != 0 ||
+          cursor.get<uint32_t>() != checkpointVersion,
+      std::runtime_error,
+      name << " is not an Albany checkpoint.\n");
+  const int32_t fileProcs = cursor.get<int32_t>();
+  const int32_t fileProc  = cursor.get<int32_t>();
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      fileProcs != numProcs || fileProc != proc,
+      std::runtime_error,
+      "Checkpoint " << name << " was written by rank " << fileProc << " of "
+                    << fileProcs << ".\n");
+  const double time = cursor.get<double>();
+
+  stk::mesh::MetaData&        metaData = bulkData.mesh_meta_data();
+  const stk::mesh::EntityRank numRanks = cursor.get<uint32_t>();
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      numRanks != metaData.entity_rank_count(),
+      std::runtime_error,
+      "Checkpoint " << name << " has " << numRanks << " entity ranks.\n");
+  status.restoredIds.resize(numRanks);
+
+  const bool sameDecomposition = numProcs == bulkData.parallel_size();
+  const stk::mesh::Selector selector =
+      stk::mesh::Selector(metaData.locally_owned_part()) |
+      stk::mesh::Selector(metaData.globally_shared_part());
+
+  for (stk::mesh::EntityRank rank = stk::topology::NODE_RANK;
+       rank < numRanks;
+       ++rank) {
+    const uint64_t    numEntities = cursor.get<uint64_t>();
+    const char* const ids = cursor.take(numEntities * sizeof(uint64_t));
+
+    // Local entity of each entity of the file, invalid if not on this rank
+    std::vector<stk::mesh::Entity> entities;
+    if (sameDecomposition) {
+      // The same decomposition gives the same entities on this rank
+      entities = checkpointEntities(bulkData, rank);
+      bool sameEntities = numEntities == entities.size();
+      for (std::size_t i = 0; sameEntities && i < entities.size(); ++i) {
+        uint64_t id;
+        std::memcpy(&id, ids + i * sizeof(uint64_t), sizeof(uint64_t));
+        sameEntities = id == bulkData.identifier(entities[i]);
+      }
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          !sameEntities,
+          std::runtime_error,
+          "Checkpoint " << name << " was written for another decomposition "
+                        << "(entity rank " << rank << ").\n");
+    } else {
+      entities.resize(numEntities);
+      for (std::size_t i = 0; i < numEntities; ++i) {
+        uint64_t id;
+        std::memcpy(&id, ids + i * sizeof(uint64_t), sizeof(uint64_t));
+        const stk::mesh::Entity entity = bulkData.get_entity(rank, id);
+        if (bulkData.is_valid(entity) && selector(bulkData.bucket(entity)))
+          entities[i] = entity;
+      }
+    }
+    std::set<uint64_t>& restoredIds = status.restoredIds[rank];
+    for (std::size_t i = 0; i < entities.size(); ++i)
+      if (bulkData.is_valid(entities[i]))
+        restoredIds.insert(bulkData.identifier(entities[i]));
+
+    const uint32_t numFields = cursor.get<uint32_t>();
+    for (uint32_t f = 0; f < numFields; ++f) {
+      const uint32_t    nameSize = cursor.get<uint32_t>();
+      const std::string fieldName(cursor.take(nameSize), nameSize);
+      const uint64_t    bytes = cursor.get<uint64_t>();
+      const char* const data  = cursor.take(numEntities * bytes);
+
+      stk::mesh::FieldBase* const field = metaData.get_field(rank, fieldName);
+      if (field == NULL) continue;
+      bool restored = true;
+      for (std::size_t i = 0; i < entities.size(); ++i) {
+        if (!bulkData.is_valid(entities[i])) continue;
+        const uint64_t size =
+            stk::mesh::field_bytes_per_entity(*field, entities[i]);
+        if (size == 0) continue;
+        if (size != bytes) {
+          restored = false;
+          continue;
+        }
+        std::memcpy(
+            stk::mesh::field_data(*field, entities[i]), data + i * bytes, size);
+      }
+      const auto it = status.fieldRestored.find(fieldName);
+      if (it == status.fieldRestored.end())
+        status.fieldRestored[fieldName] = restored;
+      else
+        it->second = it->second && restored;
+    }
+  }
+
+  return time;
+}
+
+}  // namespace
+
+void
+Albany::writeSTKCheckpoint(
+    const std::string&         fileName,
+    const stk::mesh::BulkData& bulkData,
+    const double               time)
+{
+  const std::string  name = rankFileName(
+      fileName, bulkData.parallel_size(), bulkData.parallel_rank());
+  std::ofstream      file(name.c_str(), std::ios::binary | std::ios::trunc);
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !file, std::runtime_error, "Cannot open checkpoint " << name << ".\n");
+
+  const stk::mesh::MetaData&      metaData = bulkData.mesh_meta_data();
+  const stk::mesh::FieldVector&   fields   = metaData.get_fields();
+  const stk::mesh::EntityRank     numRanks = metaData.entity_rank_count();
+
+  file.write(checkpointMagic, sizeof(checkpointMagic));
+  put(file, checkpointVersion);
+  put(file, static_cast<int32_t>(bulkData.parallel_size()));
+  put(file, static_cast<int32_t>(bulkData.parallel_rank()));
+  put(file, time);
+  put(file, static_cast<uint32_t>(numRanks));
+
+  std::vector<char> zeros;
+  for (stk::mesh::EntityRank rank = stk::topology::NODE_RANK; rank < numRanks;
+       ++rank) {
+    const std::vector<stk::mesh::Entity> entities =
+        checkpointEntities(bulkData, rank);
+    put(file, static_cast<uint64_t>(entities.size()));
+    for (std::size_t i = 0; i < entities.size(); ++i)
+      put(file, static_cast<uint64_t>(bulkData.identifier(entities[i])));
+
+    // Fields with data on this rank, each as one entity-major blob. Entities
+    // on which a field is not defined are written as zeros.
+    std::vector<const stk::mesh::FieldBase*> rankFields;
+    std::vector<uint64_t>                    bytes;
+    for (std::size_t f = 0; f < fields.size(); ++f) {
+      if (fields[f]->entity_rank() != rank) continue;
+      uint64_t maxBytes = 0;
+      for (std::size_t i = 0; i < entities.size(); ++i)
+        maxBytes = std::max<uint64_t>(
+            maxBytes, stk::mesh::field_bytes_per_entity(*fields[f], entities[i]));
+      if (maxBytes == 0) continue;
+      rankFields.push_back(fields[f]);
+      bytes.push_back(maxBytes);
+    }
+
+    put(file, static_cast<uint32_t>(rankFields.size()));
+    for (std::size_t f = 0; f < rankFields.size(); ++f) {
+      const std::string& fieldName = rankFields[f]->name();
+      put(file, static_cast<uint32_t>(fieldName.size()));
+      file.write(fieldName.data(), fieldName.size());
+      put(file, bytes[f]);
+      zeros.assign(bytes[f], 0);
+      for (std::size_t i = 0; i < entities.size(); ++i) {
+        const uint64_t size =
+            stk::mesh::field_bytes_per_entity(*rankFields[f], entities[i]);
+        if (size == bytes[f]) {
+          file.write(
+              static_cast<const char*>(
+                  stk::mesh::field_data(*rankFields[f], entities[i])),
+              size);
+        } else {
+          file.write(zeros.data(), bytes[f]);
+        }
+      }
+    }
+  }
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      !file, std::runtime_error, "Cannot write checkpoint " << name << ".\n");
+}
+
+double
+Albany::readSTKCheckpoint(
+    const std::string&        fileName,
+    stk::mesh::BulkData&      bulkData,
+    std::vector<std::string>& restoredFields,
+    const int                 numProcs)
+{
+  restoredFields.clear();
+
+  const int writtenProcs = numProcs > 0 ? numProcs : bulkData.parallel_size();
+  RestoreStatus status;
+  double        time = 0.0;
+  if (writtenProcs == bulkData.parallel_size()) {
+    time = readRankFile(
+        rankFileName(fileName, writtenProcs, bulkData.parallel_rank()),
+        writtenProcs,
+        bulkData.parallel_rank(),
+        bulkData,
+        status);
+  } else {
+    // Another decomposition: pick this rank's entities out of every file
+    for (int proc = 0; proc < writtenProcs; ++proc) {
+      time = readRankFile(
+          rankFileName(fileName, writtenProcs, proc),
+          writtenProcs,
+          proc,
+          bulkData,
+          status);
+    }
+
+    const stk::mesh::EntityRank numRanks = status.restoredIds.size();
+    for (stk::mesh::EntityRank rank = stk::topology::NODE_RANK;
+         rank < numRanks;
+         ++rank) {
+      const std::vector<stk::mesh::Entity> entities =
+          checkpointEntities(bulkData, rank);
+      for (std::size_t i = 0; i < entities.size(); ++i) {
+        TEUCHOS_TEST_FOR_EXCEPTION(
+            status.restoredIds[rank].count(bulkData.identifier(entities[i])) ==
+                0,
+            std::runtime_error,
+            "Checkpoint " << fileName << " has no data for entity "
+                          << bulkData.identifier(entities[i]) << " of rank "
+                          << rank << ".\n");
+      }
+    }
+  }
+
+  for (const auto& it : status.fieldRestored)
+    if (it.second) restoredFields.push_back(it.first);
+
+  return time;
+}
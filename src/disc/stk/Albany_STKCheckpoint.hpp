@@ -0,0 +1,50 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef ALBANY_STKCHECKPOINT_HPP
+#define ALBANY_STKCHECKPOINT_HPP
+
+#include <string>
+#include <vector>
+
+#include <stk_mesh/base/BulkData.hpp>
+
+namespace Albany {
+
+/*! \brief Per-rank binary checkpoint of the STK field data.
+ *
+ *  Each rank writes the field data of its locally owned and shared entities
+ *  to <fileName>.<numRanks>.<rank> as one contiguous blob per field, keyed by
+ *  the entity ids. A restart with the same decomposition maps its file and
+ *  copies the blobs back into the fields. A restart on another number of
+ *  ranks maps every file of the checkpoint and copies the blobs of its own
+ *  entities, looked up by id. This bypasses the Exodus field reads (one Ioss
+ *  variable per QP component for QP states) and their redistribution. The
+ *  mesh itself is still read through Ioss.
+ */
+
+//! Write the checkpoint of all the fields of bulkData, labeled with time
+void
+writeSTKCheckpoint(
+    const std::string&          fileName,
+    const stk::mesh::BulkData&  bulkData,
+    const double                time);
+
+//! Restore the fields of bulkData from the checkpoint written by numProcs
+//! ranks (the current number of ranks if not positive). Throws if a file is
+//! missing, if the same number of ranks had another decomposition, or if an
+//! entity of this rank is in none of the files. Returns the time of the
+//! checkpoint and the names of the restored fields.
+double
+readSTKCheckpoint(
+    const std::string&        fileName,
+    stk::mesh::BulkData&      bulkData,
+    std::vector<std::string>& restoredFields,
+    const int                 numProcs = 0);
+
+}  // namespace Albany
+
+#endif  // ALBANY_STKCHECKPOINT_HPP
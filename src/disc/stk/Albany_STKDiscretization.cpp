@@ -4,13 +4,20 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <limits>
+#include <set>
 
 #include "Albany_BucketArray.hpp"
 #include "Albany_NodalGraphUtils.hpp"
+#include "Albany_STKCheckpoint.hpp"
 #include "Albany_STKDiscretization.hpp"
 #include "Albany_STKNodeFieldContainer.hpp"
 #include "Albany_Utils.hpp"
+#include "Teuchos_Time.hpp"
+#include "utility/PerformanceContext.hpp"
 
 #ifdef ALBANY_CONTACT
 #include "Albany_ContactManager.hpp"
@@ -39,6 +46,7 @@
 
 #ifdef ALBANY_SEACAS
 #include <Ionit_Initializer.h>
+#include <Ioss_PropertyManager.h>
 #include <netcdf.h>
 
 #ifdef ALBANY_PAR_NETCDF
@@ -69,6 +77,71 @@ const Tpetra::global_size_t INVALID =
 // Uncomment the following line if you want debug output to be printed to screen
 // #define OUTPUT_TO_SCREEN
 
+namespace {
+
+// Position of the integer point x along a Hilbert curve with 2^bits cells
+// per direction. x is overwritten. J. Skilling, "Programming the Hilbert
+// curve", AIP Conf. Proc. 707 (2004).
+uint64_t
+hilbertIndex(unsigned* x, const int dim, const int bits)
+{
+  const unsigned M = 1u << (bits - 1);
+
+  // Inverse undo excess work
+  for (unsigned Q = M; Q > 1; Q >>= 1) {
+    const unsigned P = Q - 1;
+    for (int i = 0; i < dim; ++i) {
+      if (x[i] & Q) {
+        x[0] ^= P;
+      } else {
+        const unsigned t = (x[0] ^ x[i]) & P;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i = 1; i < dim; ++i) x[i] ^= x[i - 1];
+  unsigned t = 0;
+  for (unsigned Q = M; Q > 1; Q >>= 1)
+    if (x[dim - 1] & Q) t ^= Q - 1;
+  for (int i = 0; i < dim; ++i) x[i] ^= t;
+
+  // Interleave the transposed bits, most significant first
+  uint64_t h = 0;
+  for (int b = bits - 1; b >= 0; --b)
+    for (int i = 0; i < dim; ++i) h = (h << 1) | ((x[i] >> b) & 1u);
+  return h;
+}
+
+// Copy a node field to the <Cell,Node,...> layout of a NodalDataToElemNode
+// state. elemNodes holds numElemNodes nodes per element, of which the first
+// numStateNodes carry the state; the numComps components of a node are
+// contiguous both in the field and in the state (natural ordering).
+template <class FieldType>
+void
+gatherToElemNodes(
+    const FieldType&                      field,
+    const std::vector<stk::mesh::Entity>& elemNodes,
+    const int                             numElemNodes,
+    const int                             numStateNodes,
+    const int                             numComps,
+    double*                               values)
+{
+  const int numElems = elemNodes.size() / numElemNodes;
+  for (int i = 0; i < numElems; ++i) {
+    for (int j = 0; j < numStateNodes; ++j) {
+      const double* entry =
+          stk::mesh::field_data(field, elemNodes[i * numElemNodes + j]);
+      std::copy(entry, entry + numComps, values);
+      values += numComps;
+    }
+  }
+}
+
+}  // namespace
+
 Albany::STKDiscretization::STKDiscretization(
     const Teuchos::RCP<Teuchos::ParameterList>&  discParams_,
     Teuchos::RCP<Albany::AbstractSTKMeshStruct>& stkMeshStruct_,
@@ -87,8 +160,32 @@ Albany::STKDiscretization::STKDiscretization(
       neq(stkMeshStruct_->neq),
       stkMeshStruct(stkMeshStruct_),
       sideSetEquations(sideSetEquations_),
-      interleavedOrdering(stkMeshStruct_->interleavedOrdering)
+      interleavedOrdering(stkMeshStruct_->interleavedOrdering),
+      precomputeJacobianOffsets(
+          Teuchos::nonnull(discParams_) &&
+          discParams_->get<bool>("Precompute Jacobian Offsets", false)),
+      contiguousWorksetCoords(
+          Teuchos::nonnull(discParams_) &&
+          discParams_->get<bool>("Contiguous Workset Coordinates", false)),
+      checkpointFileName(
+          Teuchos::nonnull(discParams_) ?
+              discParams_->get<std::string>("Checkpoint File Name", "") :
+              ""),
+      checkpointMTBF(
+          Teuchos::nonnull(discParams_) ?
+              discParams_->get<double>("Checkpoint MTBF", 0.0) :
+              0.0),
+      nodeOrdering(
+          Teuchos::nonnull(discParams_) ?
+              discParams_->get<std::string>("Node Ordering", "None") :
+              "None")
 {
+  TEUCHOS_TEST_FOR_EXCEPTION(
+      nodeOrdering != "None" && nodeOrdering != "RCM" &&
+          nodeOrdering != "Hilbert",
+      std::logic_error,
+      "Unknown Node Ordering " << nodeOrdering
+                               << "; valid options are None, RCM, Hilbert\n");
 #if defined(ALBANY_EPETRA)
   comm = Albany::createEpetraCommFromTeuchosComm(commT_);
 #endif
@@ -700,6 +797,21 @@ Albany::STKDiscretization::setupMLCoords()
       coordMV->replaceLocalValue(node_lid, j, X[j]);
   }
 
+  // Extruded meshes know their vertical lines; let MueLu coarsen along them.
+  if (Teuchos::nonnull(discParams) &&
+      discParams->get<bool>("MueLu Semi-Coarsening", false) &&
+      rigidBodyModes->isMueLuUsed()) {
+    const Teuchos::RCP<LayeredMeshNumbering<LO>> layeredMeshNumbering =
+        stkMeshStruct->layered_mesh_numbering;
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        layeredMeshNumbering.is_null(),
+        std::logic_error,
+        "MueLu Semi-Coarsening requires an extruded mesh.\n");
+    rigidBodyModes->setSemiCoarsening(
+        layeredMeshNumbering->numLayers,
+        layeredMeshNumbering->ordering == LayeredMeshOrdering::COLUMN);
+  }
+
   rigidBodyModes->setCoordinatesAndNullspace(coordMV, mapT);
 
   // Some optional matrix-market output was tagged on here; keep that
@@ -947,6 +1059,10 @@ Albany::STKDiscretization::writeSolutionToFileT(
            << stkMeshStruct->exoOutFile << std::endl;
     }
   }
+  writeCheckpoint(
+      time,
+      stkMeshStruct->exoOutput &&
+          !(outputInterval % stkMeshStruct->exoOutputInterval));
   if (stkMeshStruct->cdfOutput &&
       !(outputInterval % stkMeshStruct->cdfOutputInterval)) {
     double time_label = monotonicTimeLabel(time);
@@ -963,17 +1079,16 @@ Albany::STKDiscretization::writeSolutionToFileT(
   outputInterval++;
 
   for (auto it : sideSetDiscretizations) {
-    if (overlapped) {
-      Tpetra_Vector           ss_solnT(it.second->getOverlapMapT());
-      const Tpetra_CrsMatrix& P = *ov_projectorsT.at(it.first);
-      P.apply(solnT, ss_solnT);
-      it.second->writeSolutionToFileT(ss_solnT, time, overlapped);
-    } else {
-      Tpetra_Vector           ss_solnT(it.second->getMapT());
-      const Tpetra_CrsMatrix& P = *projectorsT.at(it.first);
-      P.apply(solnT, ss_solnT);
-      it.second->writeSolutionToFileT(ss_solnT, time, overlapped);
-    }
+    // Project into a vector kept across writes; it is only reallocated if
+    // the side set map changed
+    Teuchos::RCP<Tpetra_Vector>& ss_solnT =
+        overlapped ? ov_ss_solnsT[it.first] : ss_solnsT[it.first];
+    Teuchos::RCP<const Tpetra_Map> ss_mapT =
+        overlapped ? it.second->getOverlapMapT() : it.second->getMapT();
+    if (ss_solnT.is_null() || ss_solnT->getMap() != ss_mapT)
+      ss_solnT = Teuchos::rcp(new Tpetra_Vector(ss_mapT));
+    projectToSideSet(it.first, solnT, *ss_solnT, overlapped);
+    it.second->writeSolutionToFileT(*ss_solnT, time, overlapped);
   }
 #endif
 }
@@ -1023,6 +1138,10 @@ Albany::STKDiscretization::writeSolutionMVToFile(
            << stkMeshStruct->exoOutFile << std::endl;
     }
   }
+  writeCheckpoint(
+      time,
+      stkMeshStruct->exoOutput &&
+          !(outputInterval % stkMeshStruct->exoOutputInterval));
   if (stkMeshStruct->cdfOutput &&
       !(outputInterval % stkMeshStruct->cdfOutputInterval)) {
     double time_label = monotonicTimeLabel(time);
@@ -1039,23 +1158,62 @@ Albany::STKDiscretization::writeSolutionMVToFile(
   outputInterval++;
 
   for (auto it : sideSetDiscretizations) {
-    if (overlapped) {
-      Tpetra_MultiVector ss_solnT(
-          it.second->getOverlapMapT(), solnT.getNumVectors());
-      const Tpetra_CrsMatrix& P = *ov_projectorsT.at(it.first);
-      P.apply(solnT, ss_solnT);
-      it.second->writeSolutionMVToFile(ss_solnT, time, overlapped);
-    } else {
-      Tpetra_MultiVector ss_solnT(it.second->getMapT(), solnT.getNumVectors());
-      const Tpetra_CrsMatrix& P = *projectorsT.at(it.first);
-      P.apply(solnT, ss_solnT);
-      it.second->writeSolutionMVToFile(ss_solnT, time, overlapped);
-    }
+    Teuchos::RCP<Tpetra_MultiVector>& ss_solnT =
+        overlapped ? ov_ss_solnMVsT[it.first] : ss_solnMVsT[it.first];
+    Teuchos::RCP<const Tpetra_Map> ss_mapT =
+        overlapped ? it.second->getOverlapMapT() : it.second->getMapT();
+    if (ss_solnT.is_null() || ss_solnT->getMap() != ss_mapT ||
+        ss_solnT->getNumVectors() != solnT.getNumVectors())
+      ss_solnT = Teuchos::rcp(
+          new Tpetra_MultiVector(ss_mapT, solnT.getNumVectors()));
+    projectToSideSet(it.first, solnT, *ss_solnT, overlapped);
+    it.second->writeSolutionMVToFile(*ss_solnT, time, overlapped);
   }
 
 #endif
 }
 
+void
+Albany::STKDiscretization::writeCheckpoint(
+    const double time,
+    const bool   exoStep)
+{
+  if (checkpointFileName.empty()) return;
+
+  if (checkpointMTBF <= 0) {
+    if (!exoStep) return;
+  } else {
+    // Young's interval sqrt(2 C M), with Daly's correction -C, minimizes
+    // the expected time lost to a failure plus the time spent writing for
+    // a write cost C and a mean time between failures M. The first
+    // checkpoint, at the first output, measures C.
+    const double now = Teuchos::Time::wallTime();
+    if (lastCheckpointWallTime < 0) lastCheckpointWallTime = now;
+    if (checkpointCost > 0) {
+      const double C = checkpointCost, M = checkpointMTBF;
+      const double interval =
+          C < 0.5 * M ? std::sqrt(2.0 * C * M) - C : M;
+      // All ranks take the same decision
+      double elapsed = now - lastCheckpointWallTime, maxElapsed;
+      Teuchos::reduceAll<int, double>(
+          *commT, Teuchos::REDUCE_MAX, 1, &elapsed, &maxElapsed);
+      if (maxElapsed < interval) return;
+    }
+  }
+
+  const double start = Teuchos::Time::wallTime();
+  writeSTKCheckpoint(checkpointFileName, bulkData, time);
+  double cost = Teuchos::Time::wallTime() - start;
+  Teuchos::reduceAll<int, double>(
+      *commT, Teuchos::REDUCE_MAX, 1, &cost, &checkpointCost);
+  lastCheckpointWallTime = Teuchos::Time::wallTime();
+
+  if (commT->getRank() == 0)
+    *out << "Albany::STKDiscretization::writeSolution: writing time " << time
+         << " to checkpoint " << checkpointFileName << " in " << checkpointCost
+         << " s" << std::endl;
+}
+
 double
 Albany::STKDiscretization::monotonicTimeLabel(const double time)
 {
@@ -1099,10 +1257,12 @@ Albany::STKDiscretization::setResidualFieldT(const Tpetra_Vector& residualT)
 
   // Setting the residual on the side set meshes
   for (auto it : sideSetDiscretizations) {
-    const Tpetra_CrsMatrix& P = *ov_projectorsT.at(it.first);
-    Tpetra_Vector           ss_residualT(it.second->getOverlapMapT());
-    P.apply(residualT, ss_residualT);
-    it.second->setResidualFieldT(ss_residualT);
+    Teuchos::RCP<Tpetra_Vector>& ss_residualT = ov_ss_residualsT[it.first];
+    if (ss_residualT.is_null() ||
+        ss_residualT->getMap() != it.second->getOverlapMapT())
+      ss_residualT = Teuchos::rcp(new Tpetra_Vector(it.second->getOverlapMapT()));
+    projectToSideSet(it.first, residualT, *ss_residualT, true);
+    it.second->setResidualFieldT(*ss_residualT);
   }
 #endif
 }
@@ -1611,6 +1771,15 @@ Albany::STKDiscretization::computeNodalMaps(bool overlapped)
     stk::mesh::get_selected_entities(
         selector, bulkData.buckets(stk::topology::NODE_RANK), nodes);
 
+    // Number the local DOFs in the requested node order
+    if (!nodeOrder.empty())
+      std::sort(
+          nodes.begin(),
+          nodes.end(),
+          [this](const stk::mesh::Entity a, const stk::mesh::Entity b) {
+            return nodeOrder.at(gid(a)) < nodeOrder.at(gid(b));
+          });
+
     numNodes = nodes.size();
 
     Teuchos::Array<Tpetra_GO> indicesT(numNodes * nComp);
@@ -1641,6 +1810,127 @@ Albany::STKDiscretization::computeNodalMaps(bool overlapped)
   }
 }
 
+void
+Albany::STKDiscretization::computeNodeOrder()
+{
+  nodeOrder.clear();
+  if (nodeOrdering == "None") return;
+
+  stk::mesh::Selector select_overlap_in_part =
+      stk::mesh::Selector(metaData.universal_part()) &
+      (stk::mesh::Selector(metaData.locally_owned_part()) |
+       stk::mesh::Selector(metaData.globally_shared_part()));
+
+  std::vector<stk::mesh::Entity> nodes;
+  stk::mesh::get_selected_entities(
+      select_overlap_in_part, bulkData.buckets(stk::topology::NODE_RANK), nodes);
+  const LO numNodes = nodes.size();
+
+  std::vector<LO> order;
+  order.reserve(numNodes);
+
+  if (nodeOrdering == "Hilbert") {
+    // Sort the nodes along a Hilbert curve through their bounding box
+    AbstractSTKFieldContainer::VectorFieldType* coordinates_field =
+        stkMeshStruct->getCoordinatesField();
+    const int dim  = stkMeshStruct->numDim;
+    const int bits = 16;
+
+    double lo[3] = {0.0, 0.0, 0.0}, hi[3] = {0.0, 0.0, 0.0};
+    for (LO i = 0; i < numNodes; ++i) {
+      const double* x = stk::mesh::field_data(*coordinates_field, nodes[i]);
+      for (int d = 0; d < dim; ++d) {
+        lo[d] = (i == 0) ? x[d] : std::min(lo[d], x[d]);
+        hi[d] = (i == 0) ? x[d] : std::max(hi[d], x[d]);
+      }
+    }
+
+    const double maxCell = (1u << bits) - 1;
+    std::vector<std::pair<uint64_t, LO>> keys(numNodes);
+    for (LO i = 0; i < numNodes; ++i) {
+      const double* x = stk::mesh::field_data(*coordinates_field, nodes[i]);
+      unsigned      cell[3] = {0, 0, 0};
+      for (int d = 0; d < dim; ++d) {
+        const double width = hi[d] - lo[d];
+        cell[d] =
+            width > 0.0 ? static_cast<unsigned>(maxCell * (x[d] - lo[d]) / width)
+                        : 0;
+      }
+      keys[i] = std::make_pair(hilbertIndex(cell, dim, bits), i);
+    }
+    std::sort(keys.begin(), keys.end());
+    for (LO i = 0; i < numNodes; ++i) order.push_back(keys[i].second);
+  } else {
+    // Reverse Cuthill-McKee over the nodes connected by locally owned
+    // elements
+    std::unordered_map<GO, LO> index;
+    for (LO i = 0; i < numNodes; ++i) index[gid(nodes[i])] = i;
+
+    std::vector<std::vector<LO>> adjacency(numNodes);
+    stk::mesh::Selector          select_owned_in_part =
+        stk::mesh::Selector(metaData.universal_part()) &
+        stk::mesh::Selector(metaData.locally_owned_part());
+    const stk::mesh::BucketVector& buckets = bulkData.get_buckets(
+        stk::topology::ELEMENT_RANK, select_owned_in_part);
+    std::vector<LO> elemNodes;
+    for (std::size_t b = 0; b < buckets.size(); ++b) {
+      const stk::mesh::Bucket& bucket = *buckets[b];
+      for (std::size_t e = 0; e < bucket.size(); ++e) {
+        stk::mesh::Entity const* rel = bulkData.begin_nodes(bucket[e]);
+        const int numElemNodes = bulkData.num_nodes(bucket[e]);
+        elemNodes.clear();
+        for (int j = 0; j < numElemNodes; ++j) {
+          const auto it = index.find(gid(rel[j]));
+          if (it != index.end()) elemNodes.push_back(it->second);
+        }
+        for (std::size_t j = 0; j < elemNodes.size(); ++j)
+          for (std::size_t k = 0; k < elemNodes.size(); ++k)
+            if (j != k) adjacency[elemNodes[j]].push_back(elemNodes[k]);
+      }
+    }
+    for (LO i = 0; i < numNodes; ++i) {
+      std::vector<LO>& adj = adjacency[i];
+      std::sort(adj.begin(), adj.end());
+      adj.erase(std::unique(adj.begin(), adj.end()), adj.end());
+    }
+
+    const auto byDegree = [&adjacency](const LO a, const LO b) {
+      return adjacency[a].size() < adjacency[b].size();
+    };
+
+    // Start each connected component from one of its lowest degree nodes
+    std::vector<LO> starts(numNodes);
+    for (LO i = 0; i < numNodes; ++i) starts[i] = i;
+    std::stable_sort(starts.begin(), starts.end(), byDegree);
+
+    std::vector<bool> visited(numNodes, false);
+    std::vector<LO>   next;
+    for (LO s = 0; s < numNodes; ++s) {
+      if (visited[starts[s]]) continue;
+      std::size_t head = order.size();
+      order.push_back(starts[s]);
+      visited[starts[s]] = true;
+      // Breadth first, visiting the neighbors of each node by degree
+      while (head < order.size()) {
+        const LO node = order[head++];
+        next.clear();
+        for (std::size_t k = 0; k < adjacency[node].size(); ++k) {
+          const LO neighbor = adjacency[node][k];
+          if (!visited[neighbor]) {
+            visited[neighbor] = true;
+            next.push_back(neighbor);
+          }
+        }
+        std::stable_sort(next.begin(), next.end(), byDegree);
+        order.insert(order.end(), next.begin(), next.end());
+      }
+    }
+    std::reverse(order.begin(), order.end());
+  }
+
+  for (LO i = 0; i < numNodes; ++i) nodeOrder[gid(nodes[order[i]])] = i;
+}
+
 void
 Albany::STKDiscretization::computeOwnedNodesAndUnknowns()
 {
@@ -1726,9 +2016,6 @@ Albany::STKDiscretization::computeGraphsUpToFillComplete()
   overlap_graphT =
       Teuchos::null;  // delete existing graph happens here on remesh
 
-  overlap_graphT =
-      Teuchos::rcp(new Tpetra_CrsGraph(overlap_mapT, neq * nodes_per_element));
-
   stk::mesh::Selector select_owned_in_part =
       stk::mesh::Selector(metaData.universal_part()) &
       stk::mesh::Selector(metaData.locally_owned_part());
@@ -1752,30 +2039,60 @@ Albany::STKDiscretization::computeGraphsUpToFillComplete()
     }
   }
 
-  for (std::size_t i = 0; i < cells.size(); i++) {
-    stk::mesh::Entity        e         = cells[i];
-    stk::mesh::Entity const* node_rels = bulkData.begin_nodes(e);
-    const size_t             num_nodes = bulkData.num_nodes(e);
-
-    // loop over local nodes
-    for (std::size_t j = 0; j < num_nodes; j++) {
-      stk::mesh::Entity rowNode = node_rels[j];
-
-      // loop over eqs
-      for (std::size_t k = 0; k < globalEqns.size(); ++k) {
-        row = getGlobalDOF(gid(rowNode), globalEqns[k]);
-        for (std::size_t l = 0; l < num_nodes; l++) {
-          stk::mesh::Entity colNode = node_rels[l];
-          for (std::size_t m = 0; m < neq; m++)  // Note: here we cycle through
-                                                 // ALL the eqns (not just the
-                                                 // global ones),
-          {  //       since they could all be coupled with this eq
-            col   = getGlobalDOF(gid(colNode), m);
-            colAV = Teuchos::arrayView(&col, 1);
-            overlap_graphT->insertGlobalIndices(row, colAV);
-          }
-        }
-      }
+  // Node-to-node adjacency through the locally owned elements, stored as
+  // offsets/values. Each overlap node then contributes one row per global
+  // equation with all of its columns, unique, in a single insert, and the
+  // graph is allocated with the exact length of those rows. The graph is left
+  // dynamic since side set equations and Peridigm add entries afterwards.
+  std::vector<std::size_t> adjOffsets(overlapnodes.size() + 1, 0);
+  std::vector<GO>          adjNodes;
+  adjNodes.reserve(overlapnodes.size() * nodes_per_element);
+  for (std::size_t inode = 0; inode < overlapnodes.size(); ++inode) {
+    stk::mesh::Entity        node     = overlapnodes[inode];
+    stk::mesh::Entity const* elems    = bulkData.begin_elements(node);
+    const size_t             num_elem = bulkData.num_elements(node);
+    const std::size_t        first    = adjNodes.size();
+    for (std::size_t ie = 0; ie < num_elem; ++ie) {
+      if (!bulkData.bucket(elems[ie]).owned()) continue;
+      stk::mesh::Entity const* node_rels = bulkData.begin_nodes(elems[ie]);
+      const size_t             num_nodes = bulkData.num_nodes(elems[ie]);
+      for (std::size_t l = 0; l < num_nodes; ++l)
+        adjNodes.push_back(gid(node_rels[l]));
+    }
+    std::sort(adjNodes.begin() + first, adjNodes.end());
+    adjNodes.erase(
+        std::unique(adjNodes.begin() + first, adjNodes.end()), adjNodes.end());
+    adjOffsets[inode + 1] = adjNodes.size();
+  }
+
+  Teuchos::ArrayRCP<std::size_t> numEntriesPerRow(
+      overlap_mapT->getNodeNumElements(), 0);
+  for (std::size_t inode = 0; inode < overlapnodes.size(); ++inode) {
+    const std::size_t rowLength =
+        neq * (adjOffsets[inode + 1] - adjOffsets[inode]);
+    for (std::size_t k = 0; k < globalEqns.size(); ++k) {
+      row = getGlobalDOF(gid(overlapnodes[inode]), globalEqns[k]);
+      numEntriesPerRow[overlap_mapT->getLocalElement(row)] = rowLength;
+    }
+  }
+  overlap_graphT = Teuchos::rcp(new Tpetra_CrsGraph(
+      overlap_mapT,
+      Teuchos::arcp_const_cast<const std::size_t>(numEntriesPerRow)));
+
+  // Note: all the eqns (not just the global ones) are columns, since they
+  // could all be coupled with the row eq
+  Teuchos::Array<Tpetra_GO> cols;
+  for (std::size_t inode = 0; inode < overlapnodes.size(); ++inode) {
+    const std::size_t first = adjOffsets[inode];
+    const std::size_t num_adj = adjOffsets[inode + 1] - first;
+    if (num_adj == 0) continue;
+    cols.resize(neq * num_adj);
+    for (std::size_t l = 0; l < num_adj; ++l)
+      for (std::size_t m = 0; m < neq; ++m)
+        cols[neq * l + m] = getGlobalDOF(adjNodes[first + l], m);
+    for (std::size_t k = 0; k < globalEqns.size(); ++k) {
+      row = getGlobalDOF(gid(overlapnodes[inode]), globalEqns[k]);
+      overlap_graphT->insertGlobalIndices(row, cols());
     }
   }
 
@@ -1908,6 +2225,9 @@ Albany::STKDiscretization::insertPeridigmNonzerosIntoGraph()
 
     // Call fillComplete() for the overlap graph and create the non-overlap map
     fillCompleteGraphs();
+
+    // The overlap graph changed, so the entry offsets must be recomputed
+    computeJacobianOffsets();
   }
 #endif
 #endif
@@ -2015,67 +2335,57 @@ Albany::STKDiscretization::computeWorksetInfo()
 
       nodesOnElemStateVec[b].resize(nodal_states.size());
 
+      // Element nodes of the bucket, shared by all the nodal states
+      const int dim0 = buck.size();  // may be different from dim[0];
+      const int numElemNodes = bulkData.num_nodes(buck[0]);
+      std::vector<stk::mesh::Entity> elemNodes;
+      if (nodal_states.size() > 0) {
+        elemNodes.resize(dim0 * numElemNodes);
+        for (int i = 0; i < dim0; i++) {
+          stk::mesh::Entity const* rel = bulkData.begin_nodes(buck[i]);
+          std::copy(rel, rel + numElemNodes, &elemNodes[i * numElemNodes]);
+        }
+      }
+
       for (int is = 0; is < nodal_states.size(); ++is) {
         const std::string&                    name = nodal_states[is]->name;
         const Albany::StateStruct::FieldDims& dim  = nodal_states[is]->dim;
         MDArray&             array    = stateArrays.elemStateArrays[b][name];
         std::vector<double>& stateVec = nodesOnElemStateVec[b][is];
-        int                  dim0 = buck.size();  // may be different from dim[0];
+        int numComps = 1;
+        for (int d = 2; d < dim.size(); ++d) numComps *= dim[d];
+        stateVec.resize(dim0 * dim[1] * numComps);
         switch (dim.size()) {
           case 2:  // scalar
           {
             const ScalarFieldType& field = *metaData.get_field<ScalarFieldType>(
                 stk::topology::NODE_RANK, name);
-            stateVec.resize(dim0 * dim[1]);
             array.assign<ElemTag, NodeTag>(stateVec.data(), dim0, dim[1]);
-            for (int i = 0; i < dim0; i++) {
-              stk::mesh::Entity        element = buck[i];
-              stk::mesh::Entity const* rel     = bulkData.begin_nodes(element);
-              for (int j = 0; j < dim[1]; j++) {
-                stk::mesh::Entity rowNode = rel[j];
-                array(i, j) = *stk::mesh::field_data(field, rowNode);
-              }
-            }
+            gatherToElemNodes(
+                field, elemNodes, numElemNodes, dim[1], numComps,
+                stateVec.data());
             break;
           }
           case 3:  // vector
           {
             const VectorFieldType& field = *metaData.get_field<VectorFieldType>(
                 stk::topology::NODE_RANK, name);
-            stateVec.resize(dim0 * dim[1] * dim[2]);
             array.assign<ElemTag, NodeTag, CompTag>(
                 stateVec.data(), dim0, dim[1], dim[2]);
-            for (int i = 0; i < dim0; i++) {
-              stk::mesh::Entity        element = buck[i];
-              stk::mesh::Entity const* rel     = bulkData.begin_nodes(element);
-              for (int j = 0; j < dim[1]; j++) {
-                stk::mesh::Entity rowNode = rel[j];
-                double*           entry = stk::mesh::field_data(field, rowNode);
-                for (int k = 0; k < dim[2]; k++) array(i, j, k) = entry[k];
-              }
-            }
+            gatherToElemNodes(
+                field, elemNodes, numElemNodes, dim[1], numComps,
+                stateVec.data());
             break;
           }
           case 4:  // tensor
           {
             const TensorFieldType& field = *metaData.get_field<TensorFieldType>(
                 stk::topology::NODE_RANK, name);
-            stateVec.resize(dim0 * dim[1] * dim[2] * dim[3]);
             array.assign<ElemTag, NodeTag, CompTag, CompTag>(
                 stateVec.data(), dim0, dim[1], dim[2], dim[3]);
-            for (int i = 0; i < dim0; i++) {
-              stk::mesh::Entity        element = buck[i];
-              stk::mesh::Entity const* rel     = bulkData.begin_nodes(element);
-              for (int j = 0; j < dim[1]; j++) {
-                stk::mesh::Entity rowNode = rel[j];
-                double*           entry = stk::mesh::field_data(field, rowNode);
-                for (int k = 0; k < dim[2]; k++)
-                  for (int l = 0; l < dim[3]; l++)
-                    array(i, j, k, l) = entry[k * dim[3] + l];  // check this,
-                                                                // is stride
-                                                                // Correct?
-              }
-            }
+            gatherToElemNodes(
+                field, elemNodes, numElemNodes, dim[1], numComps,
+                stateVec.data());
             break;
           }
         }
@@ -2408,6 +2718,178 @@ Albany::STKDiscretization::computeWorksetInfo()
       }
     }
   }
+
+  computeWorksetColors();
+
+  computeJacobianOffsets();
+
+  computeCoordsViews();
+}
+
+void
+Albany::STKDiscretization::computeWorksetColors()
+{
+  int const num_ws        = wsElNodeID.size();
+  int const num_ovl_nodes = overlap_node_mapT->getNodeNumElements();
+
+  // Worksets touching each overlap node, in increasing workset order
+  std::vector<std::vector<int>> node_ws(num_ovl_nodes);
+  for (int ws = 0; ws < num_ws; ++ws) {
+    for (int i = 0; i < wsElNodeID[ws].size(); ++i) {
+      for (int j = 0; j < wsElNodeID[ws][i].size(); ++j) {
+        LO const lid = overlap_node_mapT->getLocalElement(wsElNodeID[ws][i][j]);
+        std::vector<int>& wss = node_ws[lid];
+        if (wss.empty() || wss.back() != ws) wss.push_back(ws);
+      }
+    }
+  }
+
+  // Assign each workset the smallest color not used by a neighbor
+  wsColors.resize(num_ws);
+  for (int ws = 0; ws < num_ws; ++ws) wsColors[ws] = -1;
+
+  std::vector<int> forbidden(num_ws, -1);
+  for (int ws = 0; ws < num_ws; ++ws) {
+    for (int i = 0; i < wsElNodeID[ws].size(); ++i) {
+      for (int j = 0; j < wsElNodeID[ws][i].size(); ++j) {
+        LO const lid = overlap_node_mapT->getLocalElement(wsElNodeID[ws][i][j]);
+        for (auto nbr : node_ws[lid]) {
+          if (wsColors[nbr] >= 0) forbidden[wsColors[nbr]] = ws;
+        }
+      }
+    }
+    int color = 0;
+    while (forbidden[color] == ws) ++color;
+    wsColors[ws] = color;
+  }
+}
+
+void
+Albany::STKDiscretization::computeInteriorNodes()
+{
+  int const num_ws        = wsElNodeID.size();
+  int const num_ovl_nodes = overlap_node_mapT->getNodeNumElements();
+
+  // Elements of this rank touching each overlap node
+  std::vector<int> node_elems(num_ovl_nodes, 0);
+  for (int ws = 0; ws < num_ws; ++ws) {
+    for (int i = 0; i < wsElNodeID[ws].size(); ++i) {
+      for (int j = 0; j < wsElNodeID[ws][i].size(); ++j) {
+        ++node_elems[overlap_node_mapT->getLocalElement(wsElNodeID[ws][i][j])];
+      }
+    }
+  }
+
+  // Nodes of node sets carry Dirichlet conditions and are kept global
+  for (auto const& ns : nodeSetGIDs) {
+    for (auto const node_gid : ns.second) {
+      LO const lid = overlap_node_mapT->getLocalElement(node_gid);
+      if (lid >= 0) node_elems[lid] = 0;
+    }
+  }
+
+  wsElInteriorNodes.resize(num_ws);
+  for (int ws = 0; ws < num_ws; ++ws) {
+    int const num_elems = wsElNodeID[ws].size();
+    int const num_nodes = num_elems > 0 ? wsElNodeID[ws][0].size() : 0;
+    wsElInteriorNodes[ws] = WorksetNodeFlags("wsElInteriorNodes", num_elems, num_nodes);
+    auto flags = Kokkos::create_mirror_view(wsElInteriorNodes[ws]);
+    for (int i = 0; i < num_elems; ++i) {
+      for (int j = 0; j < num_nodes; ++j) {
+        GO const node_gid = wsElNodeID[ws][i][j];
+        LO const lid      = overlap_node_mapT->getLocalElement(node_gid);
+        stk::mesh::Entity const node =
+            bulkData.get_entity(stk::topology::NODE_RANK, node_gid + 1);
+        flags(i, j) = node_elems[lid] == 1 &&
+                      node_mapT->getLocalElement(node_gid) >= 0 &&
+                      !bulkData.in_shared(bulkData.entity_key(node));
+      }
+    }
+    Kokkos::deep_copy(wsElInteriorNodes[ws], flags);
+  }
+}
+
+void
+Albany::STKDiscretization::computeJacobianOffsets()
+{
+  wsJacOffsets = Albany::WorksetArray<WorksetJacOffsets>::type();
+  if (!precomputeJacobianOffsets) return;
+
+  // A CrsMatrix built on the overlap graph stores its values in the order of
+  // the local graph entries, with the column indices of each row sorted
+  using LocalGraph       = Tpetra_CrsGraph::local_graph_type;
+  auto const local_graph = overlap_graphT->getLocalGraph();
+  typename LocalGraph::row_map_type::non_const_type::HostMirror row_map(
+      "row_map", local_graph.row_map.dimension(0));
+  auto const entries = Kokkos::create_mirror_view(local_graph.entries);
+  Kokkos::deep_copy(row_map, local_graph.row_map);
+  Kokkos::deep_copy(entries, local_graph.entries);
+  Teuchos::RCP<const Tpetra_Map> const col_mapT = overlap_graphT->getColMap();
+
+  int const num_ws = wsElNodeEqID.size();
+  wsJacOffsets.resize(num_ws);
+  for (int ws = 0; ws < num_ws; ++ws) {
+    auto const eq_id = Kokkos::create_mirror_view(wsElNodeEqID[ws]);
+    Kokkos::deep_copy(eq_id, wsElNodeEqID[ws]);
+    int const num_cells = eq_id.dimension(0);
+    int const num_nodes = eq_id.dimension(1);
+    int const num_eqs   = eq_id.dimension(2);
+    int const num_unks  = num_nodes * num_eqs;
+
+    wsJacOffsets[ws] = WorksetJacOffsets(
+        "wsJacOffsets", num_cells, num_nodes, num_eqs, num_unks);
+    auto offsets = Kokkos::create_mirror_view(wsJacOffsets[ws]);
+
+    // Element unknowns as column indices of the overlap graph
+    std::vector<LO> cols(num_unks);
+    for (int cell = 0; cell < num_cells; ++cell) {
+      for (int unk = 0; unk < num_unks; ++unk) {
+        LO const lid = eq_id(cell, unk / num_eqs, unk % num_eqs);
+        cols[unk] =
+            col_mapT->getLocalElement(overlap_mapT->getGlobalElement(lid));
+      }
+      for (int node = 0; node < num_nodes; ++node) {
+        for (int eq = 0; eq < num_eqs; ++eq) {
+          LO const        row   = eq_id(cell, node, eq);
+          LO const* const first = entries.data() + row_map(row);
+          LO const* const last  = entries.data() + row_map(row + 1);
+          for (int unk = 0; unk < num_unks; ++unk) {
+            LO const* const it = std::lower_bound(first, last, cols[unk]);
+            offsets(cell, node, eq, unk) =
+                (it != last && *it == cols[unk]) ? it - entries.data() : -1;
+          }
+        }
+      }
+    }
+    Kokkos::deep_copy(wsJacOffsets[ws], offsets);
+  }
+}
+
+void
+Albany::STKDiscretization::computeCoordsViews()
+{
+  wsCoordsViews = Albany::WorksetArray<WorksetCoordsView>::type();
+  if (!contiguousWorksetCoords) return;
+
+  // coords points into the STK coordinate field, or to the shifted copies of
+  // periodic nodes. The views are rebuilt with the worksets, which is when
+  // the coordinates change.
+  int const num_dim = stkMeshStruct->numDim;
+  int const num_ws  = coords.size();
+  wsCoordsViews.resize(num_ws);
+  for (int ws = 0; ws < num_ws; ++ws) {
+    int const num_cells = coords[ws].size();
+    int const num_nodes = num_cells > 0 ? coords[ws][0].size() : 0;
+
+    wsCoordsViews[ws] =
+        WorksetCoordsView("wsCoordsViews", num_cells, num_nodes, num_dim);
+    auto ws_coords = Kokkos::create_mirror_view(wsCoordsViews[ws]);
+    for (int cell = 0; cell < num_cells; ++cell)
+      for (int node = 0; node < num_nodes; ++node)
+        for (int dim = 0; dim < num_dim; ++dim)
+          ws_coords(cell, node, dim) = coords[ws][cell][node][dim];
+    Kokkos::deep_copy(wsCoordsViews[ws], ws_coords);
+  }
 }
 
 void
@@ -2680,7 +3162,21 @@ Albany::STKDiscretization::setupExodusOutput()
     mesh_data = Teuchos::rcp(
         new stk::io::StkMeshIoBroker(Albany::getMpiCommFromTeuchosComm(commT)));
     mesh_data->set_bulk_data(bulkData);
-    outputFileIdx = mesh_data->create_output_mesh(str, stk::io::WRITE_RESULTS);
+
+    // Reals in single precision and zlib compression shrink the output of
+    // long runs; both only apply to the visualization output, the
+    // checkpoint keeps the fields as they are
+    Ioss::PropertyManager properties;
+    if (stkMeshStruct->exoOutputPrecision == 4)
+      properties.add(Ioss::Property("REAL_SIZE_DB", 4));
+    if (stkMeshStruct->exoCompressionLevel > 0) {
+      properties.add(Ioss::Property("FILE_TYPE", "netcdf4"));
+      properties.add(Ioss::Property(
+          "COMPRESSION_LEVEL", stkMeshStruct->exoCompressionLevel));
+      properties.add(Ioss::Property("COMPRESSION_SHUFFLE", 1));
+    }
+    outputFileIdx = mesh_data->create_output_mesh(
+        str, stk::io::WRITE_RESULTS, properties);
 
     // Adding mesh global variables
     for (auto& it : stkMeshStruct->getFieldContainer()->getMeshVectorStates()) {
@@ -2695,8 +3191,28 @@ Albany::STKDiscretization::setupExodusOutput()
           outputFileIdx, it.first, mvs, stk::util::ParameterType::INTEGER);
     }
 
+    // QP states left out of the output are still in the checkpoint
+    std::set<const stk::mesh::FieldBase*> skipped;
+    if (!stkMeshStruct->exoOutputQPStates) {
+      Teuchos::RCP<AbstractSTKFieldContainer> container =
+          stkMeshStruct->getFieldContainer();
+      skipped.insert(
+          container->getQPScalarStates().begin(),
+          container->getQPScalarStates().end());
+      skipped.insert(
+          container->getQPVectorStates().begin(),
+          container->getQPVectorStates().end());
+      skipped.insert(
+          container->getQPTensorStates().begin(),
+          container->getQPTensorStates().end());
+      skipped.insert(
+          container->getQPTensor3States().begin(),
+          container->getQPTensor3States().end());
+    }
+
     const stk::mesh::FieldVector& fields = mesh_data->meta_data().get_fields();
     for (size_t i = 0; i < fields.size(); i++) {
+      if (skipped.count(fields[i])) continue;
       // Hacky, but doesn't appear to be a way to query if a field is already
       // going to be output.
       try {
@@ -2829,6 +3345,26 @@ value(const std::vector<double>& soln, const std::pair<double, double>& ref)
   return x;
 }
 
+//! Values of the C element basis functions at ref
+std::vector<double>
+basisValues(const int C, const std::pair<double, double>& ref)
+{
+  const Teuchos::RCP<Intrepid2::Basis<PHX::Device, RealType, RealType>>
+      HGRAD_Basis = Basis(C);
+
+  const int numPoints = 1;
+  Kokkos::DynRankView<RealType, PHX::Device> basisVals("SSS", C, numPoints);
+  Kokkos::DynRankView<RealType, PHX::Device> tempPoints("SSS", numPoints, 2);
+  tempPoints(0, 0) = ref.first;
+  tempPoints(0, 1) = ref.second;
+
+  HGRAD_Basis->getValues(basisVals, tempPoints, Intrepid2::OPERATOR_VALUE);
+
+  std::vector<double> weights(C);
+  for (unsigned j = 0; j < C; ++j) weights[j] = basisVals(j, 0);
+  return weights;
+}
+
 void
 value(
     double                            x[3],
@@ -3057,6 +3593,7 @@ setup_latlon_interp(
         Albany::STKDiscretization::interp interp;
         interp.parametric_coords  = paramtric;
         interp.latitude_longitude = std::pair<unsigned, unsigned>(i, j);
+        interp.weights            = basisValues(coords[b][e].size(), paramtric);
         interpdata[b][e].push_back(interp);
         ++count;
       }
@@ -3074,19 +3611,107 @@ Albany::STKDiscretization::processNetCDFOutputRequestT(
     const Tpetra_Vector& solution_fieldT)
 {
 #ifdef ALBANY_SEACAS
-// IK, 10/13/14: need to implement!
+  const std::size_t nlat     = stkMeshStruct->nLat;
+  const std::size_t nlon     = stkMeshStruct->nLon;
+  const std::size_t gridSize = nlat * nlon;
+
+  // The element node values need the overlapped solution
+  Teuchos::RCP<const Tpetra_Vector> ovlp_solnT =
+      Teuchos::rcpFromRef(solution_fieldT);
+  if (!solution_fieldT.getMap()->isSameAs(*overlap_mapT)) {
+    if (netCDFImporterT.is_null())
+      netCDFImporterT = Teuchos::rcp(new Tpetra_Import(mapT, overlap_mapT));
+    const Teuchos::RCP<Tpetra_Vector> importedT =
+        Teuchos::rcp(new Tpetra_Vector(overlap_mapT));
+    importedT->doImport(solution_fieldT, *netCDFImporterT, Tpetra::INSERT);
+    ovlp_solnT = importedT;
+  }
+  const Teuchos::ArrayRCP<const ST> soln = ovlp_solnT->get1dView();
+
+  // Interpolate to the grid points in the elements of this rank, with the
+  // weights computed in setupNetCDFOutput. Grid points on element edges
+  // shared by ranks take the largest of the (equal up to roundoff) values.
+  const double        fillVal = -9999.0;
+  std::vector<double> localGrid(neq * gridSize, fillVal);
+  for (int b = 0; b < interpolateData.size(); ++b) {
+    for (int e = 0; e < interpolateData[b].size(); ++e) {
+      const std::vector<interp>& points = interpolateData[b][e];
+      for (std::size_t p = 0; p < points.size(); ++p) {
+        const std::size_t grid =
+            points[p].latitude_longitude.first * nlon +
+            points[p].latitude_longitude.second;
+        const std::vector<double>& weights = points[p].weights;
+        for (int n = 0; n < neq; ++n) {
+          double x = 0;
+          for (int j = 0; j < weights.size(); ++j)
+            x += weights[j] * soln[wsElNodeEqID[b](e, j, n)];
+          localGrid[n * gridSize + grid] = x;
+        }
+      }
+    }
+  }
+  std::vector<double> grid(neq * gridSize);
+  Teuchos::reduceAll<int, double>(
+      *commT, Teuchos::REDUCE_MAX, localGrid.size(), &localGrid[0], &grid[0]);
+
+#ifdef ALBANY_PAR_NETCDF
+  // Each rank writes a band of latitudes, collectively
+  const std::size_t rank     = commT->getRank();
+  const std::size_t numRanks = commT->getSize();
+  const std::size_t latBegin = rank * nlat / numRanks;
+  const std::size_t latEnd   = (rank + 1) * nlat / numRanks;
+#else
+  const std::size_t latBegin = 0;
+  const std::size_t latEnd   = nlat;
 #endif
+  const std::size_t start[] = {netCDFOutputRequest, 0, latBegin, 0};
+  const std::size_t count[] = {1, 1, latEnd - latBegin, nlon};
+  for (int n = 0; n < neq; ++n) {
+#ifdef ALBANY_PAR_NETCDF
+    if (netCDFp)
+      if (const int ierr =
+              nc_var_par_access(netCDFp, varSolns[n], NC_COLLECTIVE))
+        TEUCHOS_TEST_FOR_EXCEPTION(
+            true,
+            std::logic_error,
+            "nc_var_par_access returned error code " << ierr << " - "
+                                                     << nc_strerror(ierr)
+                                                     << std::endl);
+#endif
+    if (netCDFp)
+      if (const int ierr = nc_put_vara_double(
+              netCDFp,
+              varSolns[n],
+              start,
+              count,
+              &grid[n * gridSize + latBegin * nlon]))
+        TEUCHOS_TEST_FOR_EXCEPTION(
+            true,
+            std::logic_error,
+            "nc_put_vara_double returned error code " << ierr << " - "
+                                                      << nc_strerror(ierr)
+                                                      << std::endl);
+  }
+  if (netCDFp)
+    if (const int ierr = nc_sync(netCDFp))
+      TEUCHOS_TEST_FOR_EXCEPTION(
+          true,
+          std::logic_error,
+          "nc_sync returned error code " << ierr << " - " << nc_strerror(ierr)
+                                         << std::endl);
+
+  return netCDFOutputRequest++;
+#else
   return 0;
+#endif
 }
 
 int
 Albany::STKDiscretization::processNetCDFOutputRequestMV(
     const Tpetra_MultiVector& solution_fieldT)
 {
-#ifdef ALBANY_SEACAS
-// IK, 10/13/14: need to implement!
-#endif
-  return 0;
+  // Only the solution itself goes to the lat/lon grid
+  return processNetCDFOutputRequestT(*solution_fieldT.getVector(0));
 }
 
 void
@@ -3451,6 +4076,53 @@ Albany::STKDiscretization::printVertexConnectivity()
   }
 }
 
+namespace {
+
+// Each row of a side set projector has at most one entry, equal to 1: the
+// volume dof the side dof is injected from. Its local id in the domain map
+// is all a projection needs.
+Kokkos::View<LO*, Kokkos::HostSpace>
+buildProjectorLIDs(const Tpetra_CrsMatrix& P)
+{
+  const Tpetra_Map& colMapT    = *P.getColMap();
+  const Tpetra_Map& domainMapT = *P.getDomainMap();
+  Kokkos::View<LO*, Kokkos::HostSpace> lids(
+      "projector lids", P.getRowMap()->getNodeNumElements());
+  Teuchos::ArrayView<const LO> indices;
+  Teuchos::ArrayView<const ST> values;
+  for (LO row = 0; row < lids.dimension_0(); ++row) {
+    P.getLocalRowView(row, indices, values);
+    lids(row) = indices.size() == 0 ?
+        -1 :
+        domainMapT.getLocalElement(colMapT.getGlobalElement(indices[0]));
+  }
+  return lids;
+}
+
+}  // namespace
+
+void
+Albany::STKDiscretization::projectToSideSet(
+    const std::string&        sideSetName,
+    const Tpetra_MultiVector& x,
+    Tpetra_MultiVector&       ss_x,
+    const bool                overlapped) const
+{
+  const Kokkos::View<LO*, Kokkos::HostSpace> lids =
+      getSideSetProjectorLIDs(sideSetName, overlapped);
+  for (size_t j = 0; j < x.getNumVectors(); ++j) {
+    const Teuchos::ArrayRCP<const ST> xj   = x.getData(j);
+    const Teuchos::ArrayRCP<ST>       ss_j = ss_x.getDataNonConst(j);
+    const ST* const                   xp   = xj.getRawPtr();
+    ST* const                         ssp  = ss_j.getRawPtr();
+    Kokkos::parallel_for(
+        "STKDiscretization::projectToSideSet",
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(
+            0, lids.dimension_0()),
+        [=](const int i) { ssp[i] = lids(i) >= 0 ? xp[lids(i)] : 0.0; });
+  }
+}
+
 void
 Albany::STKDiscretization::buildSideSetProjectors()
 {
@@ -3538,6 +4210,7 @@ Albany::STKDiscretization::buildSideSetProjectors()
     ov_P->setAllToScalar(1.0);
     ov_P->fillComplete();
     ov_projectorsT[sideSetName] = ov_P;
+    ov_projectorLIDs[sideSetName] = buildProjectorLIDs(*ov_P);
 
     // ...then the non-overlapped
     graphP =
@@ -3583,6 +4256,7 @@ Albany::STKDiscretization::buildSideSetProjectors()
     P->setAllToScalar(1.0);
     P->fillComplete();
     projectorsT[sideSetName] = P;
+    projectorLIDs[sideSetName] = buildProjectorLIDs(*P);
 
 #ifdef ALBANY_EPETRA
     P_E = Petra::TpetraCrsMatrix_To_EpetraCrsMatrix(ov_P, comm);
@@ -3597,6 +4271,10 @@ Albany::STKDiscretization::buildSideSetProjectors()
 void
 Albany::STKDiscretization::updateMesh()
 {
+  util::PhaseMonitor& phases =
+      util::PerformanceContext::instance().phaseMonitor();
+  util::PhaseGuard updateMeshPhase(phases, "STKDiscretization::updateMesh");
+
   const Albany::StateInfoStruct& nodal_param_states =
       stkMeshStruct->getFieldContainer()->getNodalParameterSIS();
   nodalDOFsStructContainer.addEmptyDOFsStruct("ordinary_solution", "", neq);
@@ -3614,46 +4292,69 @@ Albany::STKDiscretization::updateMesh()
         param_state.name, param_state.meshPart, numComps);
   }
 
-  computeNodalMaps(false);
+  {
+    util::PhaseGuard phase(phases, "maps");
+
+    computeNodeOrder();
+
+    computeNodalMaps(false);
 
-  computeOwnedNodesAndUnknowns();
+    computeOwnedNodesAndUnknowns();
 
 #ifdef OUTPUT_TO_SCREEN
-  // write owned maps to matrix market file for debug
-  Tpetra_MatrixMarket_Writer::writeMapFile("mapT0.mm", *mapT);
-  Tpetra_MatrixMarket_Writer::writeMapFile("node_mapT0.mm", *node_mapT);
+    // write owned maps to matrix market file for debug
+    Tpetra_MatrixMarket_Writer::writeMapFile("mapT0.mm", *mapT);
+    Tpetra_MatrixMarket_Writer::writeMapFile("node_mapT0.mm", *node_mapT);
 #endif
 
-  setupMLCoords();
+    setupMLCoords();
 
-  computeNodalMaps(true);
+    computeNodalMaps(true);
 
-  computeOverlapNodesAndUnknowns();
+    computeOverlapNodesAndUnknowns();
 
-  transformMesh();
+    transformMesh();
+  }
 
-  computeGraphs();
+  {
+    util::PhaseGuard phase(phases, "graphs");
+    computeGraphs();
+  }
 
-  computeWorksetInfo();
+  {
+    util::PhaseGuard phase(phases, "worksets");
+    computeWorksetInfo();
+  }
 #ifdef OUTPUT_TO_SCREEN
   printConnectivity();
 #endif
 
-  computeNodeSets();
-
-  computeSideSets();
+  {
+    util::PhaseGuard phase(phases, "node sets");
+    computeNodeSets();
+    computeInteriorNodes();
+  }
 
-  setupExodusOutput();
+  {
+    util::PhaseGuard phase(phases, "side sets");
+    computeSideSets();
+  }
 
-  // Build the node graph needed for the mass matrix for solution transfer and
-  // projection operations
-  // FIXME this only needs to be called if we are using the L2 Projection
-  // response
-  meshToGraph();
-  //  printVertexConnectivity();
-  setupNetCDFOutput();
-// meshToGraph();
-// printVertexConnectivity();
+  {
+    util::PhaseGuard phase(phases, "output setup");
+
+    setupExodusOutput();
+
+    // Build the node graph needed for the mass matrix for solution transfer and
+    // projection operations
+    // FIXME this only needs to be called if we are using the L2 Projection
+    // response
+    meshToGraph();
+    //  printVertexConnectivity();
+    setupNetCDFOutput();
+    // meshToGraph();
+    // printVertexConnectivity();
+  }
 
 #ifdef OUTPUT_TO_SCREEN
   printCoords();
@@ -3661,9 +4362,12 @@ Albany::STKDiscretization::updateMesh()
 
   // If the mesh struct stores sideSet mesh structs, we update them
   if (stkMeshStruct->sideSetMeshStructs.size() > 0) {
+    util::PhaseGuard phase(phases, "side set discretizations");
     for (auto it : stkMeshStruct->sideSetMeshStructs) {
       Teuchos::RCP<STKDiscretization> side_disc =
           Teuchos::rcp(new STKDiscretization(discParams, it.second, commT));
+      // Side meshes are rebuilt from this mesh on restart
+      side_disc->checkpointFileName.clear();
       side_disc->updateMesh();
       sideSetDiscretizations.insert(std::make_pair(it.first, side_disc));
       sideSetDiscretizationsSTK.insert(std::make_pair(it.first, side_disc));
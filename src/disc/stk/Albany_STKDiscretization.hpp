@@ -7,6 +7,7 @@
 #ifndef ALBANY_STKDISCRETIZATION_HPP
 #define ALBANY_STKDISCRETIZATION_HPP
 
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -327,6 +328,30 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   //! Retrieve Vector (length num worksets) of physics set index
   const Albany::WorksetArray<int>::type&
   getWsPhysIndex() const;
+  //! Retrieve Vector (length num worksets) of workset colors
+  const Albany::WorksetArray<int>::type&
+  getWsColors() const
+  {
+    return wsColors;
+  }
+  //! Retrieve Vector (length num worksets) of Jacobian value offsets
+  const Albany::WorksetArray<WorksetJacOffsets>::type&
+  getWsJacOffsets() const
+  {
+    return wsJacOffsets;
+  }
+  //! Retrieve Vector (length num worksets) of contiguous element coordinates
+  const Albany::WorksetArray<WorksetCoordsView>::type&
+  getCoordsViews() const
+  {
+    return wsCoordsViews;
+  }
+  //! Retrieve Vector (length num worksets) of element-interior node flags
+  const Albany::WorksetArray<WorksetNodeFlags>::type&
+  getWsElInteriorNodes() const
+  {
+    return wsElInteriorNodes;
+  }
 
 #if defined(ALBANY_EPETRA)
   void
@@ -465,6 +490,29 @@ class STKDiscretization : public Albany::AbstractDiscretization {
     return sideNodeNumerationMap;
   }
 
+  //! Local id in the (overlapped) solution map of the volume dof of each
+  //! local dof of the (overlapped) side set solution map, -1 if there is
+  //! none. The side set projectors are injections, so these ids are all
+  //! they contain.
+  const Kokkos::View<LO*, Kokkos::HostSpace>&
+  getSideSetProjectorLIDs(
+      const std::string& sideSetName,
+      const bool         overlapped) const
+  {
+    return overlapped ? ov_projectorLIDs.at(sideSetName)
+                      : projectorLIDs.at(sideSetName);
+  }
+
+  //! ss_x = P x with the projector of the side set, as a gather through
+  //! getSideSetProjectorLIDs. x must be on the (overlapped) solution map
+  //! and ss_x on the (overlapped) side set solution map.
+  void
+  projectToSideSet(
+      const std::string&        sideSetName,
+      const Tpetra_MultiVector& x,
+      Tpetra_MultiVector&       ss_x,
+      const bool                overlapped) const;
+
   //! Flag if solution has a restart values -- used in Init Cond
   bool
   hasRestartSolution() const
@@ -543,6 +591,8 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   {
     std::pair<double, double>     parametric_coords;
     std::pair<unsigned, unsigned> latitude_longitude;
+    // Element basis function values at parametric_coords
+    std::vector<double>           weights;
   };
 
   const stk::mesh::MetaData&
@@ -620,9 +670,19 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   double
   monotonicTimeLabel(const double time);
 
+  //! Write the checkpoint if one is due at this output; exoStep tells
+  //! whether the exodus output was written
+  void
+  writeCheckpoint(const double time, const bool exoStep);
+
   void
   computeNodalMaps(bool overlapped);
 
+  //! Local order of the overlap nodes requested by "Node Ordering". The
+  //! nodal maps number their local DOFs in this order.
+  void
+  computeNodeOrder();
+
   //! Process STK mesh for CRS Graphs
   virtual void
   computeGraphs();
@@ -638,6 +698,19 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   //! Process STK mesh for Workset/Bucket Info
   void
   computeWorksetInfo();
+  //! Greedy coloring of the worksets such that no two worksets of the
+  //! same color share a node
+  void
+  computeWorksetColors();
+  //! Offsets of the element Jacobian entries in the overlap graph
+  void
+  computeJacobianOffsets();
+  //! Flag the nodes whose unknowns only couple within their element
+  void
+  computeInteriorNodes();
+  //! Contiguous copies of the element coordinates of each workset
+  void
+  computeCoordsViews();
   //! Process STK mesh for NodeSets
   void
   computeNodeSets();
@@ -749,6 +822,10 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   Teuchos::RCP<Tpetra_MultiVector>        coordMV;
   Albany::WorksetArray<std::string>::type wsEBNames;
   Albany::WorksetArray<int>::type         wsPhysIndex;
+  Albany::WorksetArray<int>::type         wsColors;
+  Albany::WorksetArray<WorksetJacOffsets>::type wsJacOffsets;
+  Albany::WorksetArray<WorksetCoordsView>::type wsCoordsViews;
+  Albany::WorksetArray<WorksetNodeFlags>::type  wsElInteriorNodes;
   Albany::WorksetArray<Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*>>>::type
                                                          coords;
   Albany::WorksetArray<Teuchos::ArrayRCP<double>>::type  sphereVolume;
@@ -785,6 +862,9 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   std::vector<int> varSolns;
   Albany::WorksetArray<Teuchos::ArrayRCP<std::vector<interp>>>::type
       interpolateData;
+  //! Owned to overlapped solution import of the NetCDF output, built on
+  //! first use
+  Teuchos::RCP<Tpetra_Import> netCDFImporterT;
 
   // Storage used in periodic BCs to un-roll coordinates. Pointers saved for
   // destructor.
@@ -803,6 +883,15 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   std::map<std::string, std::map<GO, std::vector<int>>> sideNodeNumerationMap;
   std::map<std::string, Teuchos::RCP<Tpetra_CrsMatrix>> projectorsT;
   std::map<std::string, Teuchos::RCP<Tpetra_CrsMatrix>> ov_projectorsT;
+  // Volume dof local ids of the projectors, see getSideSetProjectorLIDs
+  std::map<std::string, Kokkos::View<LO*, Kokkos::HostSpace>> projectorLIDs;
+  std::map<std::string, Kokkos::View<LO*, Kokkos::HostSpace>> ov_projectorLIDs;
+  // Side set solutions written to file, reused across writes
+  std::map<std::string, Teuchos::RCP<Tpetra_Vector>>      ss_solnsT;
+  std::map<std::string, Teuchos::RCP<Tpetra_Vector>>      ov_ss_solnsT;
+  std::map<std::string, Teuchos::RCP<Tpetra_MultiVector>> ss_solnMVsT;
+  std::map<std::string, Teuchos::RCP<Tpetra_MultiVector>> ov_ss_solnMVsT;
+  std::map<std::string, Teuchos::RCP<Tpetra_Vector>>      ov_ss_residualsT;
 #ifdef ALBANY_EPETRA
   std::map<std::string, Teuchos::RCP<Epetra_CrsMatrix>> projectors;
   std::map<std::string, Teuchos::RCP<Epetra_CrsMatrix>> ov_projectors;
@@ -817,6 +906,24 @@ class STKDiscretization : public Albany::AbstractDiscretization {
   size_t outputFileIdx;
 #endif
   bool interleavedOrdering;
+  bool precomputeJacobianOffsets;
+  bool contiguousWorksetCoords;
+
+  //! Per-rank checkpoint written with each exodus output, see
+  //! Albany_STKCheckpoint.hpp
+  std::string checkpointFileName;
+
+  //! Mean time between failures of the system in seconds. If positive, the
+  //! checkpoint is written at the interval minimizing the expected lost
+  //! time instead of with each exodus output.
+  double checkpointMTBF;
+  //! Wall time of the last checkpoint write and wall clock at its end
+  double checkpointCost         = 0;
+  double lastCheckpointWallTime = -1;
+
+  //! "None", "RCM" or "Hilbert", and the resulting position of each node
+  std::string                     nodeOrdering;
+  std::unordered_map<GO, LO>      nodeOrder;
 
  private:
   Teuchos::RCP<Tpetra_CrsGraph> nodalGraph;
@@ -115,6 +115,22 @@ template<unsigned Dim, class traits = albany_stk_mesh_traits<Dim> >
     //! Build the mesh
     void buildMesh(const Teuchos::RCP<const Teuchos_Comm>& commT);
 
+    //! Elements of the brick of this rank in a process grid over the mesh
+    Teuchos::Array<GO> brickElementGIDs(const Teuchos::RCP<const Teuchos_Comm>& commT) const;
+
+    //! Declare the sharing of the nodes from the structure of the mesh and
+    //! the owners of the neighbouring elements, instead of the all to all
+    //! exchange of fix_node_sharing
+    void setNodeSharing();
+
+    //! Rank owning the element with logical coordinates elemIdx
+    int elemOwner(const GO elemIdx[]) const;
+
+    //! First index of chunk c when n indices are split over p ranks like a
+    //! GloballyDistributed Tpetra_Map, and the chunk owning index e
+    static GO chunkBegin(int c, GO n, int p);
+    static int chunkOwner(GO e, GO n, int p);
+
 
     //! Build a parameter list that contains valid input parameters
     Teuchos::RCP<const Teuchos::ParameterList>
@@ -136,6 +152,9 @@ template<unsigned Dim, class traits = albany_stk_mesh_traits<Dim> >
     bool periodic_x, periodic_y, periodic_z;
     bool triangles; // Defaults to false, meaning quad elements
 
+    bool brickDecomposition; // Each rank owns a brick of elements instead of a range of GIDs
+    int brickProcs[traits_type::size]; // Process grid of the brick decomposition
+
   };
 
 // Explicit template definitions in support of the above
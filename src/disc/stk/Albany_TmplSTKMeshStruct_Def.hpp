@@ -7,7 +7,10 @@
 
 #include <cinttypes>
 #include <iostream>
+#include <set>
+#include <algorithm>
 #include "Teuchos_VerboseObject.hpp"
+#include "Teuchos_TimeMonitor.hpp"
 #include "Albany_TmplSTKMeshStruct.hpp"
 #include <Shards_BasicTopologies.hpp>
 #include <stk_mesh/base/Entity.hpp>
@@ -40,7 +43,8 @@ Albany::TmplSTKMeshStruct<Dim, traits>::TmplSTKMeshStruct(
   periodic_x(params->get("Periodic_x BC", false)),
   periodic_y(params->get("Periodic_y BC", false)),
   periodic_z(params->get("Periodic_z BC", false)),
-  triangles(false)
+  triangles(false),
+  brickDecomposition(params->get("Brick Decomposition", false) && Dim > 1)
 {
 
 /*
@@ -333,8 +337,31 @@ Albany::TmplSTKMeshStruct<Dim, traits>::TmplSTKMeshStruct(
   // Create just enough of the mesh to figure out number of owned elements
   // so that the problem setup can know the worksetSize
 
-  // Distribute the elems equally. Build total_elems elements, with nodeIDs starting at StartIndex
-  elem_map = Teuchos::rcp(new Tpetra_Map(total_elems, StartIndex, commT, Tpetra::GloballyDistributed));
+  if (brickDecomposition) {
+    // Factor the ranks into a process grid, giving each prime factor to the
+    // direction with the most elements per rank, so that the bricks are as
+    // close to cubes as the factorization allows
+    int numProcs = commT->getSize();
+    for (unsigned idx=0; idx < Dim; idx++)
+      brickProcs[idx] = 1;
+    for (int f=2; numProcs > 1; ) {
+      if (numProcs % f != 0) { ++f; continue; }
+      unsigned dmax = 0;
+      for (unsigned idx=1; idx < Dim; idx++)
+        if (nelem[idx]*brickProcs[dmax] > nelem[dmax]*brickProcs[idx])
+          dmax = idx;
+      brickProcs[dmax] *= f;
+      numProcs /= f;
+    }
+
+    // Each rank owns its brick directly: the GIDs are known analytically and
+    // the elements never have to be redistributed
+    const Teuchos::Array<GO> myElems = brickElementGIDs(commT);
+    elem_map = Teuchos::rcp(new Tpetra_Map(total_elems, myElems(), StartIndex, commT));
+  }
+  else
+    // Distribute the elems equally. Build total_elems elements, with nodeIDs starting at StartIndex
+    elem_map = Teuchos::rcp(new Tpetra_Map(total_elems, StartIndex, commT, Tpetra::GloballyDistributed));
 
   int worksetSize = this->computeWorksetSize(worksetSizeMax, elem_map->getNodeNumElements() * (triangles ? 2 : 1));
 
@@ -435,17 +462,14 @@ Albany::TmplSTKMeshStruct<Dim, traits>::setFieldAndBulkData(
   buildMesh(commT);
 
   // STK
-  Albany::fix_node_sharing(*bulkData);
+  setNodeSharing();
   bulkData->modification_end();
 
   this->loadRequiredInputFields (req,commT);
   this->setDefaultCoordinates3d();
 
-  // Refine the mesh before starting the simulation if indicated
-  uniformRefineMesh(commT);
-
-  // Rebalance the mesh before starting the simulation if indicated
-  rebalanceInitialMeshT(commT);
+  // Rebalance and refine the mesh before starting the simulation if indicated
+  rebalanceAndRefineInitialMeshT(commT);
 
   // Build additional mesh connectivity needed for mesh fracture (if indicated)
   computeAddlConnectivity();
@@ -456,6 +480,122 @@ Albany::TmplSTKMeshStruct<Dim, traits>::setFieldAndBulkData(
   this->finalizeSideSetMeshStructs(commT, side_set_req, side_set_sis, worksetSize);
 }
 
+template<unsigned Dim, class traits>
+Teuchos::Array<GO>
+Albany::TmplSTKMeshStruct<Dim, traits>::brickElementGIDs(const Teuchos::RCP<const Teuchos_Comm>& commT) const
+{
+  // Rank r sits at (r % p_x, (r / p_x) % p_y, r / (p_x p_y)) in the process grid
+  GO lo[3] = {0, 0, 0}, hi[3] = {1, 1, 1}, stride[3] = {0, 0, 0};
+  int rank = commT->getRank();
+  GO elemStride = 1;
+  for (unsigned idx=0; idx < Dim; idx++) {
+    const int c = rank % brickProcs[idx];
+    rank /= brickProcs[idx];
+    lo[idx] = chunkBegin(c, nelem[idx], brickProcs[idx]);
+    hi[idx] = chunkBegin(c+1, nelem[idx], brickProcs[idx]);
+    stride[idx] = elemStride;
+    elemStride *= nelem[idx];
+  }
+
+  Teuchos::Array<GO> gids;
+  gids.reserve((hi[0]-lo[0])*(hi[1]-lo[1])*(hi[2]-lo[2]));
+  for (GO k=lo[2]; k<hi[2]; k++)
+    for (GO j=lo[1]; j<hi[1]; j++)
+      for (GO i=lo[0]; i<hi[0]; i++)
+        gids.push_back(i*stride[0] + j*stride[1] + k*stride[2]);
+
+  return gids;
+}
+
+template<unsigned Dim, class traits>
+void
+Albany::TmplSTKMeshStruct<Dim, traits>::setNodeSharing()
+{
+  TEUCHOS_FUNC_TIME_MONITOR("> Albany Setup: TmplSTKMeshStruct::setNodeSharing");
+
+  const bool periodic[3] = {periodic_x, periodic_y, periodic_z};
+  const int myRank = bulkData->parallel_rank();
+
+  GO nodes[3];
+  for (unsigned idx=0; idx < Dim; idx++)
+    nodes[idx] = periodic[idx] ? nelem[idx] : nelem[idx] + 1;
+
+  std::vector<stk::mesh::Entity> meshNodes;
+  stk::mesh::get_entities(*bulkData, stk::topology::NODE_RANK, meshNodes);
+
+  std::set<int> sharers;
+  for (const auto& node : meshNodes) {
+    GO node_GID = bulkData->identifier(node) - 1;
+
+    // Logical coordinates of the (at most two) elements touching the node in each direction
+    GO adj[3][2];
+    int numAdj[3] = {1, 1, 1};
+    adj[1][0] = adj[2][0] = 0;
+    for (unsigned idx=0; idx < Dim; idx++) {
+      const GO n = node_GID % nodes[idx];
+      node_GID /= nodes[idx];
+      numAdj[idx] = 0;
+      if (n > 0)
+        adj[idx][numAdj[idx]++] = n - 1;
+      else if (periodic[idx] && nelem[idx] > 1)
+        adj[idx][numAdj[idx]++] = nelem[idx] - 1;
+      if (n < nelem[idx])
+        adj[idx][numAdj[idx]++] = n;
+    }
+
+    sharers.clear();
+    GO elemIdx[3];
+    for (int k=0; k<numAdj[2]; k++)
+      for (int j=0; j<numAdj[1]; j++)
+        for (int i=0; i<numAdj[0]; i++) {
+          elemIdx[0] = adj[0][i]; elemIdx[1] = adj[1][j]; elemIdx[2] = adj[2][k];
+          const int owner = elemOwner(elemIdx);
+          if (owner != myRank)
+            sharers.insert(owner);
+        }
+
+    for (const int proc : sharers)
+      bulkData->add_node_sharing(node, proc);
+  }
+}
+
+template<unsigned Dim, class traits>
+int
+Albany::TmplSTKMeshStruct<Dim, traits>::elemOwner(const GO elemIdx[]) const
+{
+  if (!brickDecomposition) {
+    GO elem_GID = 0, elemStride = 1;
+    for (unsigned idx=0; idx < Dim; idx++) {
+      elem_GID += elemIdx[idx]*elemStride;
+      elemStride *= nelem[idx];
+    }
+    return chunkOwner(elem_GID, elem_map->getGlobalNumElements(), elem_map->getComm()->getSize());
+  }
+
+  int owner = 0, procStride = 1;
+  for (unsigned idx=0; idx < Dim; idx++) {
+    owner += procStride*chunkOwner(elemIdx[idx], nelem[idx], brickProcs[idx]);
+    procStride *= brickProcs[idx];
+  }
+  return owner;
+}
+
+template<unsigned Dim, class traits>
+GO
+Albany::TmplSTKMeshStruct<Dim, traits>::chunkBegin(int c, GO n, int p)
+{
+  // The first n % p chunks get one extra index
+  return c*(n/p) + std::min<GO>(c, n%p);
+}
+
+template<unsigned Dim, class traits>
+int
+Albany::TmplSTKMeshStruct<Dim, traits>::chunkOwner(GO e, GO n, int p)
+{
+  const GO q = n/p, r = n%p;
+  return (e < r*(q+1)) ? e/(q+1) : r + (e - r*(q+1))/q;
+}
+
 template <unsigned Dim, class traits>
 void
 Albany::TmplSTKMeshStruct<Dim, traits>::DeclareParts(
@@ -1443,6 +1583,7 @@ Albany::TmplSTKMeshStruct<2>::getValidDiscretizationParameters() const
   validPL->set<double>("1D Scale", 1.0, "Width of X discretization");
   validPL->set<double>("2D Scale", 1.0, "Height of Y discretization");
   validPL->set<std::string>("Cell Topology", "Quad" , "Quad or Tri Cell Topology");
+  validPL->set<bool>("Brick Decomposition", false, "Give each rank a brick of a process grid over the mesh, computed without communication");
   validPL->sublist("Required Fields Info", false, "Info for the loading of the required fields");
   validPL->set<bool>("Write points coordinates to ascii file", false, "If true, writes the mesh points coordinates on file");
 
@@ -1478,6 +1619,7 @@ Albany::TmplSTKMeshStruct<3>::getValidDiscretizationParameters() const
   validPL->set<double>("1D Scale", 1.0, "Width of X discretization");
   validPL->set<double>("2D Scale", 1.0, "Depth of Y discretization");
   validPL->set<double>("3D Scale", 1.0, "Height of Z discretization");
+  validPL->set<bool>("Brick Decomposition", false, "Give each rank a brick of a process grid over the mesh, computed without communication");
   validPL->sublist("Required Fields Info", false, "Info for the loading of the required fields");
   validPL->set<int>("Number Of Time Derivatives", 1, "Number of time derivatives in use in the problem");
 
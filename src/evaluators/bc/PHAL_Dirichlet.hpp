@@ -21,6 +21,7 @@
 
 #include "Sacado_ParameterAccessor.hpp"
 #include "PHAL_AlbanyTraits.hpp"
+#include "PHAL_DirichletRows.hpp"
 
 namespace PHAL {
 /** \brief Gathers solution values from the Newton solution vector into
@@ -93,6 +94,9 @@ class Dirichlet<PHAL::AlbanyTraits::Jacobian,Traits>
 public:
   Dirichlet(Teuchos::ParameterList& p);
   void evaluateFields(typename Traits::EvalData d);
+private:
+  //! Rows of the node set in the Jacobian, rebuilt when its graph changes
+  Teuchos::RCP<DirichletRows> rows;
 };
 
 // **************************************************************
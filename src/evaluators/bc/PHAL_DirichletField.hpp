@@ -47,7 +47,22 @@ class DirichletField_Base : public PHAL::DirichletBase<EvalT, Traits> {
     DirichletField_Base(Teuchos::ParameterList& p);
 
   protected:
+    //! Rebuild the solution and field local ids of the node set dofs if the
+    //! node set or the field map changed, e.g. after a mesh update
+    void updateFieldLIDs(typename Traits::EvalData d);
+
+    //! Set f = x - p on the node set dofs, in one host parallel loop
+    void setResidual(typename Traits::EvalData d) const;
+
     std::string field_name;
+
+    //! Solution and field local ids of the node set dofs
+    Kokkos::View<LO*, Kokkos::HostSpace> solLIDs;
+    Kokkos::View<LO*, Kokkos::HostSpace> fieldLIDs;
+
+    //! Node set storage and field map the local ids were built from
+    const std::vector<int>* lidsNodesSrc;
+    Teuchos::RCP<const Tpetra_Map> lidsFieldMap;
 };
 
 // **************************************************************
@@ -72,6 +87,9 @@ class DirichletField<PHAL::AlbanyTraits::Jacobian, Traits>
     DirichletField(Teuchos::ParameterList& p);
     typedef typename PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
     void evaluateFields(typename Traits::EvalData d);
+  private:
+    //! Rows of the node set in the Jacobian, rebuilt when its graph changes
+    Teuchos::RCP<DirichletRows> rows;
 };
 
 // **************************************************************
@@ -24,6 +24,56 @@ DirichletField_Base(Teuchos::ParameterList& p) :
 
   // Get field type and corresponding layouts
   field_name = p.get<std::string>("Field Name");
+  lidsNodesSrc = NULL;
+}
+
+// **********************************************************************
+template <typename EvalT, typename Traits>
+void DirichletField_Base<EvalT, Traits>::
+updateFieldLIDs(typename Traits::EvalData dirichletWorkset) {
+
+  const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
+  Teuchos::RCP<const Tpetra_Map> fieldNodeMap = dirichletWorkset.disc->getNodeMapT(this->field_name);
+  const std::vector<int>* nodesSrc = nsNodes.empty() ? NULL : nsNodes.data();
+  if (nodesSrc == lidsNodesSrc && fieldNodeMap == lidsFieldMap &&
+      solLIDs.dimension_0() == nsNodes.size())
+    return;
+
+  const Albany::NodalDOFManager& fieldDofManager = dirichletWorkset.disc->getDOFManager(this->field_name);
+  //MP: If the parameter is scalar, then the parameter offset is seto to zero. Otherwise the parameter offset is the same of the solution's one.
+  bool isFieldScalar = (fieldNodeMap->getNodeNumElements() == dirichletWorkset.disc->getMapT(this->field_name)->getNodeNumElements());
+  int fieldOffset = isFieldScalar ? 0 : this->offset;
+  const std::vector<GO>& nsNodesGIDs = dirichletWorkset.disc->getNodeSetGIDs().find(this->nodeSetID)->second;
+
+  solLIDs = Kokkos::View<LO*, Kokkos::HostSpace>("DirichletField solLIDs", nsNodes.size());
+  fieldLIDs = Kokkos::View<LO*, Kokkos::HostSpace>("DirichletField fieldLIDs", nsNodes.size());
+  for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
+    solLIDs(inode) = nsNodes[inode][this->offset];
+    fieldLIDs(inode) = fieldDofManager.getLocalDOF(fieldNodeMap->getLocalElement(nsNodesGIDs[inode]),fieldOffset);
+  }
+  lidsNodesSrc = nodesSrc;
+  lidsFieldMap = fieldNodeMap;
+}
+
+// **********************************************************************
+template <typename EvalT, typename Traits>
+void DirichletField_Base<EvalT, Traits>::
+setResidual(typename Traits::EvalData dirichletWorkset) const {
+
+  Teuchos::ArrayRCP<const ST> pT = dirichletWorkset.distParamLib->get(this->field_name)->vector()->get1dView();
+  Teuchos::ArrayRCP<const ST> xT_constView = dirichletWorkset.xT->get1dView();
+  Teuchos::ArrayRCP<ST> fT_nonconstView = dirichletWorkset.fT->get1dViewNonConst();
+
+  const ST* p = pT.getRawPtr();
+  const ST* x = xT_constView.getRawPtr();
+  ST* f = fT_nonconstView.getRawPtr();
+  const Kokkos::View<LO*, Kokkos::HostSpace> sol = solLIDs;
+  const Kokkos::View<LO*, Kokkos::HostSpace> fld = fieldLIDs;
+  Kokkos::parallel_for("DirichletField::setResidual",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, sol.dimension_0()),
+      [=] (const int inode) {
+        f[sol(inode)] = x[sol(inode)] - p[fld(inode)];
+      });
 }
 
 // **********************************************************************
@@ -41,28 +91,8 @@ void
 DirichletField<PHAL::AlbanyTraits::Residual, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset) {
 
-
-  const Albany::NodalDOFManager& fieldDofManager = dirichletWorkset.disc->getDOFManager(this->field_name);
-  //MP: If the parameter is scalar, then the parameter offset is seto to zero. Otherwise the parameter offset is the same of the solution's one.
-  Teuchos::RCP<const Tpetra_Map> fieldNodeMap = dirichletWorkset.disc->getNodeMapT(this->field_name);
-  bool isFieldScalar = (fieldNodeMap->getNodeNumElements() == dirichletWorkset.disc->getMapT(this->field_name)->getNodeNumElements());
-  int fieldOffset = isFieldScalar ? 0 : this->offset;
-  const std::vector<GO>& nsNodesGIDs = dirichletWorkset.disc->getNodeSetGIDs().find(this->nodeSetID)->second;
-
-  Teuchos::RCP<Tpetra_Vector> pvecT = dirichletWorkset.distParamLib->get(this->field_name)->vector();
-  Teuchos::ArrayRCP<const ST> pT = pvecT->get1dView();
-  Teuchos::RCP<Tpetra_Vector> fT = dirichletWorkset.fT;
-  Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
-  Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
-  Teuchos::ArrayRCP<ST> fT_nonconstView = fT->get1dViewNonConst();
-
-  const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
-  for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
-      int lunk = nsNodes[inode][this->offset];
-      GO node_gid = nsNodesGIDs[inode];
-      int lfield = fieldDofManager.getLocalDOF(fieldNodeMap->getLocalElement(node_gid),fieldOffset);
-      fT_nonconstView[lunk] = xT_constView[lunk] - pT[lfield];
-  }
+  this->updateFieldLIDs(dirichletWorkset);
+  this->setResidual(dirichletWorkset);
 }
 
 // **********************************************************************
@@ -79,24 +109,24 @@ template<typename Traits>
 void DirichletField<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset) {
 
-  const Albany::NodalDOFManager& fieldDofManager = dirichletWorkset.disc->getDOFManager(this->field_name);
-  Teuchos::RCP<const Tpetra_Map> fieldNodeMap = dirichletWorkset.disc->getNodeMapT(this->field_name);
-  bool isFieldScalar = (fieldNodeMap->getNodeNumElements() == dirichletWorkset.disc->getMapT(this->field_name)->getNodeNumElements());
-  int fieldOffset = isFieldScalar ? 0 : this->offset;
-  const std::vector<GO>& nsNodesGIDs = dirichletWorkset.disc->getNodeSetGIDs().find(this->nodeSetID)->second;
-  Teuchos::RCP<Tpetra_Vector> pvecT = dirichletWorkset.distParamLib->get(this->field_name)->vector();
-  Teuchos::ArrayRCP<const ST> pT = pvecT->get1dView();
   Teuchos::RCP<Tpetra_Vector> fT = dirichletWorkset.fT;
-  Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
-  Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
   Teuchos::RCP<Tpetra_CrsMatrix> jacT = dirichletWorkset.JacT;
 
   const RealType j_coeff = dirichletWorkset.j_coeff;
   const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
 
   bool fillResid = (fT != Teuchos::null);
-  Teuchos::ArrayRCP<ST> fT_nonconstView;                                         
-  if (fillResid) fT_nonconstView = fT->get1dViewNonConst();
+  if (fillResid) {
+    this->updateFieldLIDs(dirichletWorkset);
+    this->setResidual(dirichletWorkset);
+  }
+
+  if (jacT->getCrsGraph()->isFillComplete()) {
+    if (rows == Teuchos::null || !rows->isCompatible(*jacT, nsNodes))
+      rows = Teuchos::rcp(new DirichletRows(*jacT, nsNodes, this->offset));
+    if (rows->setRows(*jacT, j_coeff))
+      return;
+  }
 
   Teuchos::Array<LO> index(1);
   Teuchos::Array<ST> value(1); 
@@ -117,12 +147,6 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
       jacT->replaceLocalValues(lunk, matrixIndicesT(), matrixEntriesT()); 
 
       jacT->replaceLocalValues(lunk, index(), value()); 
-      
-      if (fillResid) {
-        GO node_gid = nsNodesGIDs[inode];
-        int lfield = fieldDofManager.getLocalDOF(fieldNodeMap->getLocalElement(node_gid),fieldOffset);
-        fT_nonconstView[lunk] = xT_constView[lunk] - pT[lfield];
-      }
   }
 }
 
@@ -140,53 +164,36 @@ template<typename Traits>
 void DirichletField<PHAL::AlbanyTraits::Tangent, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset) {
 
-  const Albany::NodalDOFManager& fieldDofManager = dirichletWorkset.disc->getDOFManager(this->field_name);
-  Teuchos::RCP<const Tpetra_Map> fieldNodeMap = dirichletWorkset.disc->getNodeMapT(this->field_name);
-  bool isFieldScalar = (fieldNodeMap->getNodeNumElements() == dirichletWorkset.disc->getMapT(this->field_name)->getNodeNumElements());
-  int fieldOffset = isFieldScalar ? 0 : this->offset;
-  const std::vector<GO>& nsNodesGIDs = dirichletWorkset.disc->getNodeSetGIDs().find(this->nodeSetID)->second;
-
-  Teuchos::RCP<Tpetra_Vector> pvecT = dirichletWorkset.distParamLib->get(this->field_name)->vector();
-  Teuchos::ArrayRCP<const ST> pT = pvecT->get1dView();
   Teuchos::RCP<Tpetra_Vector> fT = dirichletWorkset.fT;
   Teuchos::RCP<Tpetra_MultiVector> fpT = dirichletWorkset.fpT;
   Teuchos::RCP<Tpetra_MultiVector> JVT = dirichletWorkset.JVT;
-  Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
   Teuchos::RCP<const Tpetra_MultiVector> VxT = dirichletWorkset.VxT;
-  
-  Teuchos::ArrayRCP<const ST> VxT_constView; 
-  Teuchos::ArrayRCP<ST> fT_nonconstView;                                         
-  if (fT != Teuchos::null) fT_nonconstView = fT->get1dViewNonConst();
-  Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();                                       
 
   const RealType j_coeff = dirichletWorkset.j_coeff;
   const std::vector<std::vector<int> >& nsNodes =
     dirichletWorkset.nodeSets->find(this->nodeSetID)->second;
 
-  for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
-    int lunk = nsNodes[inode][this->offset];
+  if (fT != Teuchos::null) {
+    this->updateFieldLIDs(dirichletWorkset);
+    this->setResidual(dirichletWorkset);
+  }
 
-    if (fT != Teuchos::null) { 
-      GO node_gid = nsNodesGIDs[inode];
-      int lfield = fieldDofManager.getLocalDOF(fieldNodeMap->getLocalElement(node_gid),fieldOffset);
-      fT_nonconstView[lunk] = xT_constView[lunk] - pT[lfield];
-    }
-    
-    if (JVT != Teuchos::null) {
-      Teuchos::ArrayRCP<ST> JVT_nonconstView; 
-      for (int i=0; i<dirichletWorkset.num_cols_x; i++) {
-        JVT_nonconstView = JVT->getDataNonConst(i); 
-        VxT_constView = VxT->getData(i); 
-	      JVT_nonconstView[lunk] = j_coeff*VxT_constView[lunk];
+  if (JVT != Teuchos::null) {
+    for (int i=0; i<dirichletWorkset.num_cols_x; i++) {
+      Teuchos::ArrayRCP<ST> JVT_nonconstView = JVT->getDataNonConst(i);
+      Teuchos::ArrayRCP<const ST> VxT_constView = VxT->getData(i);
+      for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
+        int lunk = nsNodes[inode][this->offset];
+        JVT_nonconstView[lunk] = j_coeff*VxT_constView[lunk];
       }
     }
-    
-    if (fpT != Teuchos::null) {
-      Teuchos::ArrayRCP<ST> fpT_nonconstView;                                         
-      for (int i=0; i<dirichletWorkset.num_cols_p; i++) {
-        fpT_nonconstView = fpT->getDataNonConst(i); 
-	      fpT_nonconstView[lunk] = 0;
-      }
+  }
+
+  if (fpT != Teuchos::null) {
+    for (int i=0; i<dirichletWorkset.num_cols_p; i++) {
+      Teuchos::ArrayRCP<ST> fpT_nonconstView = fpT->getDataNonConst(i);
+      for (unsigned int inode = 0; inode < nsNodes.size(); inode++)
+        fpT_nonconstView[nsNodes[inode][this->offset]] = 0;
     }
   }
 }
@@ -221,21 +228,15 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
     //non-const view of VpT
     Teuchos::ArrayRCP<ST> VpT_nonconstView;
     if(isFieldParameter) {
-      const Albany::NodalDOFManager& fieldDofManager = dirichletWorkset.disc->getDOFManager(this->field_name);
-      Teuchos::RCP<const Tpetra_Map> fieldNodeMap = dirichletWorkset.disc->getNodeMapT(this->field_name);
-      bool isFieldScalar = (fieldNodeMap->getNodeNumElements() == dirichletWorkset.disc->getMapT(this->field_name)->getNodeNumElements());
-      int fieldOffset = isFieldScalar ? 0 : this->offset;
-      const std::vector<GO>& nsNodesGIDs = dirichletWorkset.disc->getNodeSetGIDs().find(this->nodeSetID)->second;
-      for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
-        int lunk = nsNodes[inode][this->offset];
-        GO node_gid = nsNodesGIDs[inode];
-        int lfield = fieldDofManager.getLocalDOF(fieldNodeMap->getLocalElement(node_gid),fieldOffset);
-        for (int col=0; col<num_cols; ++col) {
-          VpT_nonconstView = VpT->getDataNonConst(col);
-          fpVT_nonconstView = fpVT->getDataNonConst(col);
-          fpVT_nonconstView[lfield] -= VpT_nonconstView[lunk];
+      this->updateFieldLIDs(dirichletWorkset);
+      for (int col=0; col<num_cols; ++col) {
+        VpT_nonconstView = VpT->getDataNonConst(col);
+        fpVT_nonconstView = fpVT->getDataNonConst(col);
+        for (unsigned int inode = 0; inode < this->solLIDs.dimension_0(); inode++) {
+          const LO lunk = this->solLIDs(inode);
+          fpVT_nonconstView[this->fieldLIDs(inode)] -= VpT_nonconstView[lunk];
           VpT_nonconstView[lunk] = 0.0;
-         }
+        }
       }
     }
     else {
@@ -253,20 +254,12 @@ evaluateFields(typename Traits::EvalData dirichletWorkset) {
   // for (df/dp)*V we zero out corresponding entries in df/dp
   else {
     if(isFieldParameter) {
-      const Albany::NodalDOFManager& fieldDofManager = dirichletWorkset.disc->getDOFManager(this->field_name);
-      Teuchos::RCP<const Tpetra_Map> fieldNodeMap = dirichletWorkset.disc->getNodeMapT(this->field_name);
-      bool isFieldScalar = (fieldNodeMap->getNodeNumElements() == dirichletWorkset.disc->getMapT(this->field_name)->getNodeNumElements());
-      int fieldOffset = isFieldScalar ? 0 : this->offset;
-      const std::vector<GO>& nsNodesGIDs = dirichletWorkset.disc->getNodeSetGIDs().find(this->nodeSetID)->second;
-      for (unsigned int inode = 0; inode < nsNodes.size(); inode++) {
-        int lunk = nsNodes[inode][this->offset];
-        GO node_gid = nsNodesGIDs[inode];
-        int lfield = fieldDofManager.getLocalDOF(fieldNodeMap->getLocalElement(node_gid),fieldOffset);
-        for (int col=0; col<num_cols; ++col) {
-          //(*fpV)[col][lunk] = 0.0;
-          fpVT_nonconstView = fpVT->getDataNonConst(col);
-          fpVT_nonconstView[lunk] = -double(col == lfield);
-        }
+      this->updateFieldLIDs(dirichletWorkset);
+      for (int col=0; col<num_cols; ++col) {
+        //(*fpV)[col][lunk] = 0.0;
+        fpVT_nonconstView = fpVT->getDataNonConst(col);
+        for (unsigned int inode = 0; inode < this->solLIDs.dimension_0(); inode++)
+          fpVT_nonconstView[this->solLIDs(inode)] = -double(col == this->fieldLIDs(inode));
       }
     }
     else {
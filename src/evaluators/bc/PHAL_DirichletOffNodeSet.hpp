@@ -38,18 +38,37 @@ namespace PHAL {
 template<typename EvalT, typename Traits>
 class DirichletOffNodeSet;
 
+template<typename EvalT, typename Traits>
+class DirichletOffNodeSet_Base : public DirichletBase<EvalT, Traits>
+{
+public:
+  DirichletOffNodeSet_Base(Teuchos::ParameterList& p);
+protected:
+  //! Local dofs below num_local_dofs that are not on the node sets. The rows
+  //! are rebuilt if the node sets or num_local_dofs changed, e.g. after a
+  //! mesh update.
+  const std::vector<LO>& offNodeSetRows(typename Traits::EvalData d, const LO num_local_dofs);
+
+  std::vector<std::string>  nodeSets;
+private:
+  std::vector<LO> offRows;
+
+  //! Node set storage and number of dofs the rows were built from
+  std::vector<const std::vector<int>*> rowsNodesSrc;
+  std::vector<size_t> rowsNodesSize;
+  LO rowsNumDofs;
+};
+
 // **************************************************************
 // Residual
 // **************************************************************
 template<typename Traits>
 class DirichletOffNodeSet<PHAL::AlbanyTraits::Residual,Traits>
-            : public DirichletBase<PHAL::AlbanyTraits::Residual, Traits>
+            : public DirichletOffNodeSet_Base<PHAL::AlbanyTraits::Residual, Traits>
 {
 public:
   DirichletOffNodeSet(Teuchos::ParameterList& p);
   void evaluateFields(typename Traits::EvalData d);
-private:
-  std::vector<std::string>  nodeSets;
 };
 
 // **************************************************************
@@ -57,13 +76,11 @@ private:
 // **************************************************************
 template<typename Traits>
 class DirichletOffNodeSet<PHAL::AlbanyTraits::Jacobian,Traits>
-            : public DirichletBase<PHAL::AlbanyTraits::Jacobian, Traits>
+            : public DirichletOffNodeSet_Base<PHAL::AlbanyTraits::Jacobian, Traits>
 {
 public:
   DirichletOffNodeSet(Teuchos::ParameterList& p);
   void evaluateFields(typename Traits::EvalData d);
-private:
-  std::vector<std::string> nodeSets;
 };
 
 // **************************************************************
@@ -71,12 +88,10 @@ private:
 // **************************************************************
 template<typename Traits>
 class DirichletOffNodeSet<PHAL::AlbanyTraits::Tangent,Traits>
-   : public DirichletBase<PHAL::AlbanyTraits::Tangent, Traits> {
+   : public DirichletOffNodeSet_Base<PHAL::AlbanyTraits::Tangent, Traits> {
 public:
   DirichletOffNodeSet(Teuchos::ParameterList& p);
   void evaluateFields(typename Traits::EvalData d);
-private:
-  std::vector<std::string>  nodeSets;
 };
 
 // **************************************************************
@@ -84,12 +99,10 @@ private:
 // **************************************************************
 template<typename Traits>
 class DirichletOffNodeSet<PHAL::AlbanyTraits::DistParamDeriv,Traits>
-   : public DirichletBase<PHAL::AlbanyTraits::DistParamDeriv, Traits> {
+   : public DirichletOffNodeSet_Base<PHAL::AlbanyTraits::DistParamDeriv, Traits> {
 public:
   DirichletOffNodeSet(Teuchos::ParameterList& p);
   void evaluateFields(typename Traits::EvalData d);
-private:
-  std::vector<std::string>  nodeSets;
 };
 
 } // Namespace PHAL
@@ -11,7 +11,7 @@
 #include "Sacado_ParameterRegistration.hpp"
 #include "Tpetra_CrsMatrix.hpp"
 
-#include<set> 
+#include <algorithm>
 
 // **********************************************************************
 // Genereric Template Code for Constructor and PostRegistrationSetup
@@ -21,44 +21,89 @@ namespace PHAL
 {
 
 // **********************************************************************
-// Specialization: Residual
-// **********************************************************************
-template<typename Traits>
-DirichletOffNodeSet<PHAL::AlbanyTraits::Residual, Traits>::
-DirichletOffNodeSet(Teuchos::ParameterList& p) :
-  DirichletBase<PHAL::AlbanyTraits::Residual, Traits>(p),
-  nodeSets (*p.get<Teuchos::RCP<std::vector<std::string> > >("Node Sets"))
+template<typename EvalT, typename Traits>
+DirichletOffNodeSet_Base<EvalT, Traits>::
+DirichletOffNodeSet_Base(Teuchos::ParameterList& p) :
+  DirichletBase<EvalT, Traits>(p),
+  nodeSets (*p.get<Teuchos::RCP<std::vector<std::string> > >("Node Sets")),
+  rowsNumDofs(-1)
 {
 }
 
 // **********************************************************************
-template<typename Traits>
-void DirichletOffNodeSet<PHAL::AlbanyTraits::Residual, Traits>::
-evaluateFields(typename Traits::EvalData dirichletWorkset)
+template<typename EvalT, typename Traits>
+const std::vector<LO>& DirichletOffNodeSet_Base<EvalT, Traits>::
+offNodeSetRows(typename Traits::EvalData dirichletWorkset, const LO num_local_dofs)
 {
-  // Gather all node IDs from all the stored nodesets
-  std::set<int> nodeSetsRows;
+  bool changed = (num_local_dofs != rowsNumDofs || rowsNodesSrc.size() != nodeSets.size());
+  for (int ins(0); !changed && ins<nodeSets.size(); ++ins)
+  {
+    const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(nodeSets[ins])->second;
+    changed = (nsNodes.data() != rowsNodesSrc[ins] || nsNodes.size() != rowsNodesSize[ins]);
+  }
+  if (!changed)
+    return offRows;
+
+  // Flag the dofs of all the stored nodesets, and keep the others
+  std::vector<char> onNodeSets(num_local_dofs, 0);
+  rowsNodesSrc.resize(nodeSets.size());
+  rowsNodesSize.resize(nodeSets.size());
   for (int ins(0); ins<nodeSets.size(); ++ins)
   {
     const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(nodeSets[ins])->second;
     for (int inode=0; inode<nsNodes.size(); ++inode)
     {
-      nodeSetsRows.insert(nsNodes[inode][this->offset]);
+      const int row = nsNodes[inode][this->offset];
+      if (row < num_local_dofs)
+        onNodeSets[row] = 1;
     }
+    rowsNodesSrc[ins] = nsNodes.data();
+    rowsNodesSize[ins] = nsNodes.size();
+  }
+
+  offRows.clear();
+  offRows.reserve(num_local_dofs - std::count(onNodeSets.begin(), onNodeSets.end(), 1));
+  for (LO row=0; row<num_local_dofs; ++row)
+  {
+    if (!onNodeSets[row])
+      offRows.push_back(row);
   }
+  rowsNumDofs = num_local_dofs;
 
+  return offRows;
+}
+
+// **********************************************************************
+// Specialization: Residual
+// **********************************************************************
+template<typename Traits>
+DirichletOffNodeSet<PHAL::AlbanyTraits::Residual, Traits>::
+DirichletOffNodeSet(Teuchos::ParameterList& p) :
+  DirichletOffNodeSet_Base<PHAL::AlbanyTraits::Residual, Traits>(p)
+{
+}
+
+// **********************************************************************
+template<typename Traits>
+void DirichletOffNodeSet<PHAL::AlbanyTraits::Residual, Traits>::
+evaluateFields(typename Traits::EvalData dirichletWorkset)
+{
   Teuchos::RCP<Tpetra_Vector> fT = dirichletWorkset.fT;
   Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
   Teuchos::ArrayRCP<ST> fT_nonconstView = fT->get1dViewNonConst();
 
-  // Loop on all local dofs and set the BC on those not in nodeSetsRows
-  LO num_local_dofs = fT->getMap()->getNodeNumElements();
-  for (LO row=0; row<num_local_dofs; ++row)
-  {
-    if (nodeSetsRows.find(row)==nodeSetsRows.end())
-      fT_nonconstView[row] = xT_constView[row] - this->value;
-  }
+  // Set the BC on the local dofs not on the node sets
+  const std::vector<LO>& rows = this->offNodeSetRows(dirichletWorkset, fT->getMap()->getNodeNumElements());
+  const LO* row = rows.data();
+  const ST* x = xT_constView.getRawPtr();
+  ST* f = fT_nonconstView.getRawPtr();
+  const ST value = this->value;
+  Kokkos::parallel_for("DirichletOffNodeSet::setResidual",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, rows.size()),
+      [=] (const int i) {
+        f[row[i]] = x[row[i]] - value;
+      });
 }
 
 // **********************************************************************
@@ -67,8 +112,7 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
 template<typename Traits>
 DirichletOffNodeSet<PHAL::AlbanyTraits::Jacobian, Traits>::
 DirichletOffNodeSet(Teuchos::ParameterList& p) :
-  DirichletBase<PHAL::AlbanyTraits::Jacobian, Traits>(p),
-  nodeSets (*p.get<Teuchos::RCP<std::vector<std::string> > >("Node Sets"))
+  DirichletOffNodeSet_Base<PHAL::AlbanyTraits::Jacobian, Traits>(p)
 {
 }
 
@@ -77,17 +121,6 @@ template<typename Traits>
 void DirichletOffNodeSet<PHAL::AlbanyTraits::Jacobian, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
-  // Gather all node IDs from all the stored nodesets
-  std::set<int> nodeSetsRows;
-  for (int ins(0); ins<nodeSets.size(); ++ins)
-  {
-    const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(nodeSets[ins])->second;
-    for (int inode=0; inode<nsNodes.size(); ++inode)
-    {
-      nodeSetsRows.insert(nsNodes[inode][this->offset]);
-    }
-  }
-
   Teuchos::RCP<Tpetra_Vector> fT = dirichletWorkset.fT;
   Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
@@ -107,30 +140,27 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   Teuchos::Array<ST> matrixEntriesT;
   Teuchos::Array<LO> matrixIndicesT;
 
-  // Loop on all local dofs and set the BC on those not in nodeSetsRows
-  LO num_local_dofs = jacT->getRangeMap()->getNodeNumElements();
-  for (LO row=0; row<num_local_dofs; ++row)
+  // Set the BC on the local dofs not on the node sets
+  const std::vector<LO>& rows = this->offNodeSetRows(dirichletWorkset, jacT->getRangeMap()->getNodeNumElements());
+  for (int irow=0; irow<rows.size(); ++irow)
   {
-    if (nodeSetsRows.find(row)==nodeSetsRows.end())
-    {
-      // It's a row not on the given node sets
-      index[0] = row;
+    const LO row = rows[irow];
+    index[0] = row;
 
-      numEntriesT = jacT->getNumEntriesInLocalRow(row);
-      matrixEntriesT.resize(numEntriesT);
-      matrixIndicesT.resize(numEntriesT);
+    numEntriesT = jacT->getNumEntriesInLocalRow(row);
+    matrixEntriesT.resize(numEntriesT);
+    matrixIndicesT.resize(numEntriesT);
 
-      jacT->getLocalRowCopy(row, matrixIndicesT(), matrixEntriesT(), numEntriesT);
+    jacT->getLocalRowCopy(row, matrixIndicesT(), matrixEntriesT(), numEntriesT);
 
-      for (int i=0; i<numEntriesT; i++)
-        matrixEntriesT[i]=0;
+    for (int i=0; i<numEntriesT; i++)
+      matrixEntriesT[i]=0;
 
-      jacT->replaceLocalValues(row, matrixIndicesT(), matrixEntriesT());
-      jacT->replaceLocalValues(row, index(), value());
+    jacT->replaceLocalValues(row, matrixIndicesT(), matrixEntriesT());
+    jacT->replaceLocalValues(row, index(), value());
 
-      if (fillResid)
-        fT_nonconstView[row] = xT_constView[row] - this->value.val();
-    }
+    if (fillResid)
+      fT_nonconstView[row] = xT_constView[row] - this->value.val();
   }
 }
 
@@ -140,8 +170,7 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
 template<typename Traits>
 DirichletOffNodeSet<PHAL::AlbanyTraits::Tangent, Traits>::
 DirichletOffNodeSet(Teuchos::ParameterList& p) :
-  DirichletBase<PHAL::AlbanyTraits::Tangent, Traits>(p),
-  nodeSets (*p.get<Teuchos::RCP<std::vector<std::string> > >("Node Sets"))
+  DirichletOffNodeSet_Base<PHAL::AlbanyTraits::Tangent, Traits>(p)
 {
 }
 
@@ -150,62 +179,46 @@ template<typename Traits>
 void DirichletOffNodeSet<PHAL::AlbanyTraits::Tangent, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
-  // Gather all node IDs from all the stored nodesets
-  std::set<int> nodeSetsRows;
-  for (int ins(0); ins<nodeSets.size(); ++ins)
-  {
-    const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(nodeSets[ins])->second;
-    for (int inode=0; inode<nsNodes.size(); ++inode)
-    {
-      nodeSetsRows.insert(nsNodes[inode][this->offset]);
-    }
-  }
-
   Teuchos::RCP<Tpetra_Vector> fT = dirichletWorkset.fT;
   Teuchos::RCP<Tpetra_MultiVector> fpT = dirichletWorkset.fpT;
   Teuchos::RCP<Tpetra_MultiVector> JVT = dirichletWorkset.JVT;
   Teuchos::RCP<const Tpetra_Vector> xT = dirichletWorkset.xT;
   Teuchos::RCP<const Tpetra_MultiVector> VxT = dirichletWorkset.VxT;
 
-  Teuchos::ArrayRCP<const ST> VxT_constView;
-  Teuchos::ArrayRCP<ST> fT_nonconstView;
-  if (fT != Teuchos::null)
-    fT_nonconstView = fT->get1dViewNonConst();
-  Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
-
   const RealType j_coeff = dirichletWorkset.j_coeff;
-  // Loop on all local dofs and set the BC on those not in nodeSetsRows
+  // Set the BC on the local dofs not on the node sets
   LO num_local_dofs = fpT!=Teuchos::null ? fpT->getMap()->getNodeNumElements() :
                      (JVT!=Teuchos::null ? JVT->getMap()->getNodeNumElements() :
                      (fT!=Teuchos::null ? fT->getMap()->getNodeNumElements() : 0));
-  for (LO row=0; row<num_local_dofs; ++row)
+  const std::vector<LO>& rows = this->offNodeSetRows(dirichletWorkset, num_local_dofs);
+
+  if (fT != Teuchos::null)
+  {
+    Teuchos::ArrayRCP<ST> fT_nonconstView = fT->get1dViewNonConst();
+    Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
+    for (int irow=0; irow<rows.size(); ++irow)
+      fT_nonconstView[rows[irow]] = xT_constView[rows[irow]] - this->value.val();
+  }
+
+  if (JVT != Teuchos::null)
+  {
+    for (int i=0; i<dirichletWorkset.num_cols_x; i++)
+    {
+      Teuchos::ArrayRCP<ST> JVT_nonconstView = JVT->getDataNonConst(i);
+      Teuchos::ArrayRCP<const ST> VxT_constView = VxT->getData(i);
+      for (int irow=0; irow<rows.size(); ++irow)
+        JVT_nonconstView[rows[irow]] = j_coeff*VxT_constView[rows[irow]];
+    }
+  }
+
+  if (fpT != Teuchos::null)
   {
-    if (nodeSetsRows.find(row)==nodeSetsRows.end())
+    for (int i=0; i<dirichletWorkset.num_cols_p; i++)
     {
-      // It's a row not on the given node sets
-      if (fT != Teuchos::null)
-        fT_nonconstView[row] = xT_constView[row] - this->value.val();
-
-      if (JVT != Teuchos::null)
-      {
-        Teuchos::ArrayRCP<ST> JVT_nonconstView;
-        for (int i=0; i<dirichletWorkset.num_cols_x; i++)
-        {
-          JVT_nonconstView = JVT->getDataNonConst(i);
-          VxT_constView = VxT->getData(i);
-          JVT_nonconstView[row] = j_coeff*VxT_constView[row];
-        }
-      }
-
-      if (fpT != Teuchos::null)
-      {
-        Teuchos::ArrayRCP<ST> fpT_nonconstView;
-        for (int i=0; i<dirichletWorkset.num_cols_p; i++)
-        {
-          fpT_nonconstView = fpT->getDataNonConst(i);
-          fpT_nonconstView[row] = -this->value.dx(dirichletWorkset.param_offset+i);
-        }
-      }
+      Teuchos::ArrayRCP<ST> fpT_nonconstView = fpT->getDataNonConst(i);
+      const ST dvalue = -this->value.dx(dirichletWorkset.param_offset+i);
+      for (int irow=0; irow<rows.size(); ++irow)
+        fpT_nonconstView[rows[irow]] = dvalue;
     }
   }
 }
@@ -216,7 +229,7 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
 template<typename Traits>
 DirichletOffNodeSet<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 DirichletOffNodeSet(Teuchos::ParameterList& p) :
-  DirichletBase<PHAL::AlbanyTraits::DistParamDeriv, Traits>(p)
+  DirichletOffNodeSet_Base<PHAL::AlbanyTraits::DistParamDeriv, Traits>(p)
 {
 }
 
@@ -225,65 +238,19 @@ template<typename Traits>
 void DirichletOffNodeSet<PHAL::AlbanyTraits::DistParamDeriv, Traits>::
 evaluateFields(typename Traits::EvalData dirichletWorkset)
 {
-  // Gather all node IDs from all the stored nodesets
-  std::set<int> nodeSetsRows;
-  for (int ins(0); ins<nodeSets.size(); ++ins)
-  {
-    const std::vector<std::vector<int> >& nsNodes = dirichletWorkset.nodeSets->find(nodeSets[ins])->second;
-    for (int inode=0; inode<nsNodes.size(); ++inode)
-    {
-      nodeSetsRows.insert(nsNodes[inode][this->offset]);
-    }
-  }
-
   Teuchos::RCP<Tpetra_MultiVector> fpVT = dirichletWorkset.fpVT;
-  //non-const view of fpVT
-  Teuchos::ArrayRCP<ST> fpVT_nonconstView;
   bool trans = dirichletWorkset.transpose_dist_param_deriv;
   int num_cols = fpVT->getNumVectors();
-  LO num_local_dofs = fpVT->getMap()->getNodeNumElements();
-
-  // For (df/dp)^T*V we zero out corresponding entries in V
-  if (trans)
-  {
-    Teuchos::RCP<Tpetra_MultiVector> VpT = dirichletWorkset.Vp_bcT;
-    //non-const view of VpT
-    Teuchos::ArrayRCP<ST> VpT_nonconstView;
+  const std::vector<LO>& rows = this->offNodeSetRows(dirichletWorkset, fpVT->getMap()->getNodeNumElements());
 
-    // Loop on all local dofs and set the BC on those not in nodeSetsRows
-    for (LO row=0; row<num_local_dofs; ++row)
-    {
-      if (nodeSetsRows.find(row)==nodeSetsRows.end())
-      {
-        // It's a row not on the given node sets
-
-        for (int col=0; col<num_cols; ++col)
-        {
-          //(*Vp)[col][row] = 0.0;
-          VpT_nonconstView = VpT->getDataNonConst(col);
-          VpT_nonconstView[row] = 0.0;
-        }
-      }
-    }
-  }
+  // For (df/dp)^T*V we zero out corresponding entries in V,
   // for (df/dp)*V we zero out corresponding entries in df/dp
-  else
+  Teuchos::RCP<Tpetra_MultiVector> zeroT = trans ? dirichletWorkset.Vp_bcT : fpVT;
+  for (int col=0; col<num_cols; ++col)
   {
-    // Loop on all local dofs and set the BC on those not in nodeSetsRows
-    for (LO row=0; row<num_local_dofs; ++row)
-    {
-      if (nodeSetsRows.find(row)==nodeSetsRows.end())
-      {
-        // It's a row not on the given node sets
-
-        for (int col=0; col<num_cols; ++col)
-        {
-          //(*fpV)[col][row] = 0.0;
-          fpVT_nonconstView = fpVT->getDataNonConst(col);
-          fpVT_nonconstView[row] = 0.0;
-        }
-      }
-    }
+    Teuchos::ArrayRCP<ST> zeroT_nonconstView = zeroT->getDataNonConst(col);
+    for (int irow=0; irow<rows.size(); ++irow)
+      zeroT_nonconstView[rows[irow]] = 0.0;
   }
 }
 
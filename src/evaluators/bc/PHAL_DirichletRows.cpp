@@ -0,0 +1,76 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include <algorithm>
+
+#include "PHAL_DirichletRows.hpp"
+#include "Albany_Utils.hpp"
+
+PHAL::DirichletRows::DirichletRows(
+    const Tpetra_CrsMatrix&              jacT,
+    const std::vector<std::vector<int>>& nsNodes,
+    const int                            offset)
+    : graphT_(jacT.getCrsGraph())
+{
+  ALBANY_ASSERT(
+      graphT_->isFillComplete(), "DirichletRows needs a fill-complete graph");
+
+  using LocalGraph = Tpetra_CrsGraph::local_graph_type;
+  const LocalGraph local_graph = graphT_->getLocalGraph();
+  const LocalGraph::row_map_type::non_const_type::HostMirror row_map(
+      "row_map", local_graph.row_map.dimension(0));
+  Kokkos::deep_copy(row_map, local_graph.row_map);
+  const auto entries = Kokkos::create_mirror_view(local_graph.entries);
+  Kokkos::deep_copy(entries, local_graph.entries);
+
+  const Tpetra_Map& rowMapT = *graphT_->getRowMap();
+  const Tpetra_Map& colMapT = *graphT_->getColMap();
+
+  const size_t numNodes = nsNodes.size();
+  rows_.resize(numNodes);
+  begin_.resize(numNodes);
+  end_.resize(numNodes);
+  diag_.resize(numNodes);
+  for (size_t i = 0; i < numNodes; ++i) {
+    const LO row = nsNodes[i][offset];
+    rows_[i]     = row;
+    begin_[i]    = row_map(row);
+    end_[i]      = row_map(row + 1);
+
+    // Column indices are sorted within each row of a fill-complete graph
+    const LO col = colMapT.getLocalElement(rowMapT.getGlobalElement(row));
+    const Tpetra_LO* const first = entries.data() + begin_[i];
+    const Tpetra_LO* const last  = entries.data() + end_[i];
+    const Tpetra_LO* const it    = std::lower_bound(first, last, col);
+    diag_[i] = (col >= 0 && it != last && *it == col) ?
+        static_cast<long long>(it - entries.data()) : -1;
+  }
+}
+
+bool
+PHAL::DirichletRows::isCompatible(
+    const Tpetra_CrsMatrix&              jacT,
+    const std::vector<std::vector<int>>& nsNodes) const
+{
+  return jacT.getCrsGraph() == graphT_ && nsNodes.size() == rows_.size();
+}
+
+bool
+PHAL::DirichletRows::setRows(Tpetra_CrsMatrix& jacT, const ST diag) const
+{
+  // The local matrix is only set up after the first fillComplete
+  const auto valuesD = jacT.getLocalMatrix().values;
+  if (valuesD.dimension(0) != graphT_->getNodeNumEntries()) return false;
+
+  const auto values = Kokkos::create_mirror_view(valuesD);
+  Kokkos::deep_copy(values, valuesD);
+  for (size_t i = 0; i < rows_.size(); ++i) {
+    for (size_t k = begin_[i]; k < end_[i]; ++k) values(k) = 0.0;
+    if (diag_[i] >= 0) values(diag_[i]) = diag;
+  }
+  Kokkos::deep_copy(valuesD, values);
+  return true;
+}
@@ -0,0 +1,64 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_DIRICHLETROWS_HPP
+#define PHAL_DIRICHLETROWS_HPP
+
+#include <vector>
+
+#include "Albany_DataTypes.hpp"
+
+namespace PHAL {
+
+/*! \brief Jacobian rows of the dofs of one node set component.
+ *
+ *  Holds the local row ids of the node set dofs, and for each row the range of
+ *  its entries and the offset of its diagonal in the values of a CrsMatrix on
+ *  a fill-complete graph. Dirichlet conditions then edit the rows with one
+ *  pass over the values array, instead of a row view and a replace per node.
+ *
+ *  Build new rows whenever the graph or the node set changes, e.g. after
+ *  adaptation.
+ */
+class DirichletRows {
+ public:
+  DirichletRows(
+      const Tpetra_CrsMatrix&                jacT,
+      const std::vector<std::vector<int>>&   nsNodes,
+      const int                              offset);
+
+  //! True if the rows were computed for the graph of jacT and this node set
+  bool
+  isCompatible(
+      const Tpetra_CrsMatrix&              jacT,
+      const std::vector<std::vector<int>>& nsNodes) const;
+
+  //! Local row ids of the node set dofs
+  const std::vector<LO>&
+  rows() const
+  {
+    return rows_;
+  }
+
+  //! Zero the rows and set their diagonal entries to diag. Returns false, and
+  //! leaves jacT alone, if the local values of jacT are not available yet.
+  bool
+  setRows(Tpetra_CrsMatrix& jacT, const ST diag) const;
+
+ private:
+  Teuchos::RCP<const Tpetra_CrsGraph> graphT_;
+
+  std::vector<LO>     rows_;
+  std::vector<size_t> begin_;
+  std::vector<size_t> end_;
+
+  //! Value offset of the diagonal of each row, -1 if it is not in the graph
+  std::vector<long long> diag_;
+};
+
+}  // namespace PHAL
+
+#endif  // PHAL_DIRICHLETROWS_HPP
@@ -125,6 +125,20 @@ evaluateFields(typename Traits::EvalData dirichletWorkset)
   Teuchos::ArrayRCP<ST> fT_nonconstView;
   if (fillResid) fT_nonconstView = fT->get1dViewNonConst();
 
+  if (jacT->getCrsGraph()->isFillComplete()) {
+    if (rows == Teuchos::null || !rows->isCompatible(*jacT, nsNodes))
+      rows = Teuchos::rcp(new DirichletRows(*jacT, nsNodes, this->offset));
+    if (rows->setRows(*jacT, j_coeff)) {
+      if (fillResid) {
+        const std::vector<LO>& lunks = rows->rows();
+        for (unsigned int inode = 0; inode < lunks.size(); inode++)
+          fT_nonconstView[lunks[inode]] =
+              xT_constView[lunks[inode]] - this->value.val();
+      }
+      return;
+    }
+  }
+
   Teuchos::Array<LO> index(1);
   Teuchos::Array<ST> value(1);
   size_t numEntriesT;
@@ -23,9 +23,35 @@
 
 #include "Albany_MaterialDatabase.hpp"
 
+#include "Teuchos_any.hpp"
+
+#include <map>
+
 
 namespace PHAL {
 
+/** \brief Side caches shared by the Neumann evaluators of one set of BCs
+
+    Neumann evaluators on the same side set, with the same side cubature,
+    group the same sides and compute the same side geometry. BCUtils passes
+    one instance of this to all of them ("Side Caches"), so that they share
+    a single cache per evaluation type instead of building one each.
+*/
+class NeumannSideCaches {
+public:
+  //! Cache stored under key, created on first request
+  template<typename T>
+  Teuchos::RCP<T> get (const std::string& key) {
+    Teuchos::any& entry = entries[key];
+    if (entry.empty())
+      entry = Teuchos::rcp(new T());
+    return Teuchos::any_cast<Teuchos::RCP<T> >(entry);
+  }
+
+private:
+  std::map<std::string, Teuchos::any> entries;
+};
+
 /** \brief Neumann boundary condition evaluator
 
 */
@@ -157,8 +183,9 @@ protected:
                          const int cellDims,
                          int local_side_id);
 
-   // Do the side integration
-  void evaluateNeumannContribution(typename Traits::EvalData d);
+   // Do the side integration. Returns the cells of the workset with a side
+   // on the side set; neumann is only filled (and nonzero) on those.
+  const std::vector<int>& evaluateNeumannContribution(typename Traits::EvalData d);
 
   // Input:
   //! Coordinate vector at vertices
@@ -233,6 +260,41 @@ protected:
 
   std::vector<ScalarT> matScaling;
 
+  //! Cells of one element block of a workset that touch the side set through
+  //! one local side, with their side geometry when it is cached
+  struct SideGroup {
+    int numCells = 0;
+    Kokkos::DynRankView<int, PHX::Device> cells;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> physPointsSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobianSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> trans_basis_refPointsSide;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_trans_basis_refPointsSide;
+  };
+
+  //! Side set of one workset grouped by element block and local side. The
+  //! geometry is only kept for fixed reference coordinates
+  //! (see PHAL::Workset::cache_basis_functions).
+  struct CachedSideSet {
+    //! Sides and coordinates the entry was built for; both are reallocated
+    //! when the mesh is updated or adapted
+    const void* sides = nullptr;
+    const void* coords = nullptr;
+    bool hasGeometry = false;
+    std::vector<int> ebIndexVec;
+    std::vector<std::vector<SideGroup> > groups;
+    //! Cells with a side on the side set, in increasing order
+    std::vector<int> cells;
+  };
+  //! Per workset; shared with the other Neumann evaluators on this side set
+  //! when "Side Caches" is given
+  Teuchos::RCP<std::vector<CachedSideSet> > sideCache;
+  //! Returned for worksets that the side set does not touch
+  const std::vector<int> noSideCells;
+
+  //! Entry of workset d in the cache, regrouped if its sides changed
+  CachedSideSet& groupSides(typename Traits::EvalData d,
+                            const std::vector<Albany::SideStruct>& sideSet);
+
 };
 
 template<typename EvalT, typename Traits> class Neumann;
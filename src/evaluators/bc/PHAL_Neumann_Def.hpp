@@ -7,7 +7,9 @@
 
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
+#include <algorithm>
 #include <string>
+#include <type_traits>
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
 #include "Sacado_ParameterRegistration.hpp"
@@ -318,6 +320,16 @@ NeumannBase(const Teuchos::ParameterList& p) :
 
   int cubatureDegree = (p.get<int>("Cubature Degree") > 0 ) ? p.get<int>("Cubature Degree") : meshSpecs->cubatureDegree;
 
+  if (p.isParameter("Side Caches")) {
+    std::stringstream key;
+    key << sideSetID << " " << cubatureDegree << " " << coordVec.fieldTag().name()
+        << " " << PHX::typeAsString<EvalT>();
+    sideCache = p.get<Teuchos::RCP<NeumannSideCaches> >("Side Caches")
+                 ->get<std::vector<CachedSideSet> >(key.str());
+  }
+  else
+    sideCache = Teuchos::rcp(new std::vector<CachedSideSet>());
+
   numSidesOnElem = elem_top->side_count;
   sideType.resize(numSidesOnElem);
   cubatureSide.resize(numSidesOnElem);
@@ -429,7 +441,7 @@ postRegistrationSetup(typename Traits::SetupData d,
 }
 
 template<typename EvalT, typename Traits>
-void NeumannBase<EvalT, Traits>::
+const std::vector<int>& NeumannBase<EvalT, Traits>::
 evaluateNeumannContribution(typename Traits::EvalData workset)
 {
 
@@ -445,6 +457,14 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
     TEUCHOS_TEST_FOR_EXCEPTION(true, std::logic_error,
          "Side sets defined in input file but not properly specified on the mesh" << std::endl);
 
+  const Albany::SideSetList& ssList = *(workset.sideSets);
+  Albany::SideSetList::const_iterator it = ssList.find(this->sideSetID);
+
+  if(it == ssList.end()) return noSideCells; // This sideset does not exist in this workset (GAH - this can go away
+                                             // once we move logic to BCUtils
+
+  const std::vector<Albany::SideStruct>& sideSet = it->second;
+
   // neumann data type is always ScalarT, but the deriv dimentsion
   // actually needed depends on BC type. For many it just needs
   // deriv dimentsions from MeshScalarT (cloned from coordVec).
@@ -505,14 +525,6 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
 
   //std::cout << "NNN " << neumann(0,0,0) << std::endl;
 
-  const Albany::SideSetList& ssList = *(workset.sideSets);
-  Albany::SideSetList::const_iterator it = ssList.find(this->sideSetID);
-
-  const std::vector<Albany::SideStruct>& sideSet = it->second;
-
-  if(it == ssList.end()) return; // This sideset does not exist in this workset (GAH - this can go away
-                                  // once we move logic to BCUtils
-
   using DynRankViewRealT = Kokkos::DynRankView<RealType, PHX::Device>;
   using DynRankViewMeshScalarT = Kokkos::DynRankView<MeshScalarT, PHX::Device>;
   using DynRankViewScalarT = Kokkos::DynRankView<ScalarT, PHX::Device>;
@@ -541,49 +553,20 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
 
   DynRankViewScalarT data;
 
-  //! For each element block, and for each local side id (e.g. side_id=0,1,2,3,4 for a Prism) we want to identify all the physical cells associated to that side id and block.
-  //! In this way we can group them and call Intrepid2 function for a group of cells, which is more effective.
-  //! At this point we do not know the number of blocks in this workset (If we assumed to have elements of the same block in a workset we could skip some of this).
-  //! Also we do not know before the evaluator how many cells are associated to a local side id.
-
-  std::map<int, int> ordinalEbIndex;
-  std::vector<int> ebIndexVec;
-  std::vector<std::vector<int> > numCellsOnSidesOnBlocks;
-  std::vector<std::vector<Kokkos::DynRankView<int, PHX::Device> > > cellsOnSidesOnBlocks;
-  for (auto const& it_side : sideSet) {
-    const int ebIndex = it_side.elem_ebIndex;
-    const int elem_LID = it_side.elem_LID;
-    const int elem_side = it_side.side_local_id;
+  CachedSideSet& sides = groupSides(workset, sideSet);
 
-    if(ordinalEbIndex.insert(std::pair<int,int>(ebIndex,ordinalEbIndex.size())).second) {
-      numCellsOnSidesOnBlocks.push_back(std::vector<int>(numSidesOnElem, 0));
-      ebIndexVec.push_back(ebIndex);
-    }
-
-    numCellsOnSidesOnBlocks[ordinalEbIndex[ebIndex]][elem_side]++;
-  }
-  cellsOnSidesOnBlocks.resize(ordinalEbIndex.size());
-  for (int ib=0; ib<ordinalEbIndex.size(); ib++) {
-    cellsOnSidesOnBlocks[ib].resize(numSidesOnElem);
-    for (int is=0; is<numSidesOnElem; is++) {
-      cellsOnSidesOnBlocks[ib][is] = Kokkos::DynRankView<int, PHX::Device>("cellOnSide_i", numCellsOnSidesOnBlocks[ib][is]);
-      numCellsOnSidesOnBlocks[ib][is]=0;
-    }
-  }
-
-  for (auto const& it_side : sideSet) {
-    const int iBlock = ordinalEbIndex[it_side.elem_ebIndex];
-    const int elem_LID = it_side.elem_LID;
-    const int elem_side = it_side.side_local_id;
-
-    cellsOnSidesOnBlocks[iBlock][elem_side](numCellsOnSidesOnBlocks[iBlock][elem_side]++) = elem_LID;
-  }
+  // Coordinates carrying derivatives may change between fills
+  const bool useCache = workset.cache_basis_functions &&
+                        std::is_same<MeshScalarT, RealType>::value;
+  if (!useCache)
+    sides.hasGeometry = false;
 
   // Loop over the sides that form the boundary condition
-  for (int iblock = 0; iblock < ordinalEbIndex.size(); ++iblock)
+  for (int iblock = 0; iblock < sides.groups.size(); ++iblock)
   for (int side = 0; side < numSidesOnElem; ++side)
   {
-    int numCells_ =  numCellsOnSidesOnBlocks[iblock][side];
+    SideGroup& group = sides.groups[iblock][side];
+    int numCells_ =  group.numCells;
     if( numCells_ == 0) continue;
 
     // Get the data that corresponds to the side
@@ -591,64 +574,83 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
     int sideDims = sideType[side]->getDimension();
     int numQPsSide = cubatureSide[side]->getNumPoints();
 
-    Kokkos::DynRankView<int, PHX::Device> cellVec  = cellsOnSidesOnBlocks[iblock][side];
+    Kokkos::DynRankView<int, PHX::Device> cellVec  = group.cells;
 
-    //need to resize containers because they depend on side topology
-    cubPointsSide = DynRankViewRealT(cubPointsSide_buffer.data(), numQPsSide, sideDims);
-    refPointsSide = DynRankViewRealT(refPointsSide_buffer.data(), numQPsSide, cellDims);
-    cubWeightsSide = DynRankViewRealT(cubWeightsSide_buffer.data(), numQPsSide);
-    basis_refPointsSide = DynRankViewRealT(basis_refPointsSide_buffer.data(), numNodes, numQPsSide);
-
-    physPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsSide_buffer, physPointsSide_buffer.data(), numCells_, numQPsSide, cellDims);
-    jacobianSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_buffer, jacobianSide_buffer.data(), numCells_, numQPsSide, cellDims, cellDims);
-    jacobianSide_det = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_det_buffer, jacobianSide_det_buffer.data(), numCells_, numQPsSide);
-    weighted_measure = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_measure_buffer, weighted_measure_buffer.data(), numCells_, numQPsSide);
-    trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(trans_basis_refPointsSide_buffer, trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
-    weighted_trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_trans_basis_refPointsSide_buffer, weighted_trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
-    physPointsCell =Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsCell_buffer, physPointsCell_buffer.data(), numCells_, numNodes, cellDims);
-
-
-    cubatureSide[side]->getCubature(cubPointsSide, cubWeightsSide);
+    if (sides.hasGeometry) {
+      physPointsSide = group.physPointsSide;
+      jacobianSide = group.jacobianSide;
+      trans_basis_refPointsSide = group.trans_basis_refPointsSide;
+      weighted_trans_basis_refPointsSide = group.weighted_trans_basis_refPointsSide;
+    }
+    else {
+      //need to resize containers because they depend on side topology
+      cubPointsSide = DynRankViewRealT(cubPointsSide_buffer.data(), numQPsSide, sideDims);
+      refPointsSide = DynRankViewRealT(refPointsSide_buffer.data(), numQPsSide, cellDims);
+      cubWeightsSide = DynRankViewRealT(cubWeightsSide_buffer.data(), numQPsSide);
+      basis_refPointsSide = DynRankViewRealT(basis_refPointsSide_buffer.data(), numNodes, numQPsSide);
 
-    // Copy the coordinate data over to a temp container
-    for (std::size_t node=0; node < numNodes; ++node)
-      for (std::size_t dim=0; dim < cellDims; ++dim)
-        for (std::size_t iCell=0; iCell < numCells_; ++iCell)
-          physPointsCell(iCell, node, dim) = coordVec(cellVec(iCell),node,dim);
+      physPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsSide_buffer, physPointsSide_buffer.data(), numCells_, numQPsSide, cellDims);
+      jacobianSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_buffer, jacobianSide_buffer.data(), numCells_, numQPsSide, cellDims, cellDims);
+      jacobianSide_det = Kokkos::createViewWithType<DynRankViewMeshScalarT>(jacobianSide_det_buffer, jacobianSide_det_buffer.data(), numCells_, numQPsSide);
+      weighted_measure = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_measure_buffer, weighted_measure_buffer.data(), numCells_, numQPsSide);
+      trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(trans_basis_refPointsSide_buffer, trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
+      weighted_trans_basis_refPointsSide = Kokkos::createViewWithType<DynRankViewMeshScalarT>(weighted_trans_basis_refPointsSide_buffer, weighted_trans_basis_refPointsSide_buffer.data(), numCells_, numNodes, numQPsSide);
+      physPointsCell =Kokkos::createViewWithType<DynRankViewMeshScalarT>(physPointsCell_buffer, physPointsCell_buffer.data(), numCells_, numNodes, cellDims);
 
-    // Map side cubature points to the reference parent cell based on the appropriate side (elem_side)
-    Intrepid2::CellTools<PHX::Device>::mapToReferenceSubcell
-      (refPointsSide, cubPointsSide, sideDims, side, *cellType);
 
-    // Calculate side geometry
-    Intrepid2::CellTools<PHX::Device>::setJacobian
-       (jacobianSide, refPointsSide, physPointsCell, *cellType);
+      cubatureSide[side]->getCubature(cubPointsSide, cubWeightsSide);
 
-    Intrepid2::CellTools<PHX::Device>::setJacobianDet(jacobianSide_det, jacobianSide);
+      // Copy the coordinate data over to a temp container
+      for (std::size_t node=0; node < numNodes; ++node)
+        for (std::size_t dim=0; dim < cellDims; ++dim)
+          for (std::size_t iCell=0; iCell < numCells_; ++iCell)
+            physPointsCell(iCell, node, dim) = coordVec(cellVec(iCell),node,dim);
 
-    if (sideDims < 2) { //for 1 and 2D, get weighted edge measure
-      Intrepid2::FunctionSpaceTools<PHX::Device>::computeEdgeMeasure
-        (weighted_measure, jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
-    }
-    else { //for 3D, get weighted face measure
-      Intrepid2::FunctionSpaceTools<PHX::Device>::computeFaceMeasure
-        (weighted_measure, jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
-    }
+      // Map side cubature points to the reference parent cell based on the appropriate side (elem_side)
+      Intrepid2::CellTools<PHX::Device>::mapToReferenceSubcell
+        (refPointsSide, cubPointsSide, sideDims, side, *cellType);
 
-    // Values of the basis functions at side cubature points, in the reference parent cell domain
-    intrepidBasis->getValues(basis_refPointsSide, refPointsSide, Intrepid2::OPERATOR_VALUE);
+      // Calculate side geometry
+      Intrepid2::CellTools<PHX::Device>::setJacobian
+         (jacobianSide, refPointsSide, physPointsCell, *cellType);
 
-    // Transform values of the basis functions
-    Intrepid2::FunctionSpaceTools<PHX::Device>::HGRADtransformVALUE
-      (trans_basis_refPointsSide, basis_refPointsSide);
+      Intrepid2::CellTools<PHX::Device>::setJacobianDet(jacobianSide_det, jacobianSide);
 
-    // Multiply with weighted measure
-    Intrepid2::FunctionSpaceTools<PHX::Device>::multiplyMeasure
-      (weighted_trans_basis_refPointsSide, weighted_measure, trans_basis_refPointsSide);
+      if (sideDims < 2) { //for 1 and 2D, get weighted edge measure
+        Intrepid2::FunctionSpaceTools<PHX::Device>::computeEdgeMeasure
+          (weighted_measure, jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
+      }
+      else { //for 3D, get weighted face measure
+        Intrepid2::FunctionSpaceTools<PHX::Device>::computeFaceMeasure
+          (weighted_measure, jacobianSide, cubWeightsSide, side, *cellType, temporary_buffer);
+      }
 
-    // Map cell (reference) cubature points to the appropriate side (elem_side) in physical space
-    Intrepid2::CellTools<PHX::Device>::mapToPhysicalFrame
-      (physPointsSide, refPointsSide, physPointsCell, intrepidBasis);
+      // Values of the basis functions at side cubature points, in the reference parent cell domain
+      intrepidBasis->getValues(basis_refPointsSide, refPointsSide, Intrepid2::OPERATOR_VALUE);
+
+      // Transform values of the basis functions
+      Intrepid2::FunctionSpaceTools<PHX::Device>::HGRADtransformVALUE
+        (trans_basis_refPointsSide, basis_refPointsSide);
+
+      // Multiply with weighted measure
+      Intrepid2::FunctionSpaceTools<PHX::Device>::multiplyMeasure
+        (weighted_trans_basis_refPointsSide, weighted_measure, trans_basis_refPointsSide);
+
+      // Map cell (reference) cubature points to the appropriate side (elem_side) in physical space
+      Intrepid2::CellTools<PHX::Device>::mapToPhysicalFrame
+        (physPointsSide, refPointsSide, physPointsCell, intrepidBasis);
+
+      if (useCache) {
+        group.physPointsSide = Kokkos::createDynRankView(physPointsSide, "physPointsSide", numCells_, numQPsSide, cellDims);
+        group.jacobianSide = Kokkos::createDynRankView(jacobianSide, "jacobianSide", numCells_, numQPsSide, cellDims, cellDims);
+        group.trans_basis_refPointsSide = Kokkos::createDynRankView(trans_basis_refPointsSide, "trans_basis_refPointsSide", numCells_, numNodes, numQPsSide);
+        group.weighted_trans_basis_refPointsSide = Kokkos::createDynRankView(weighted_trans_basis_refPointsSide, "weighted_trans_basis_refPointsSide", numCells_, numNodes, numQPsSide);
+        Kokkos::deep_copy(group.physPointsSide, physPointsSide);
+        Kokkos::deep_copy(group.jacobianSide, jacobianSide);
+        Kokkos::deep_copy(group.trans_basis_refPointsSide, trans_basis_refPointsSide);
+        Kokkos::deep_copy(group.weighted_trans_basis_refPointsSide, weighted_trans_basis_refPointsSide);
+      }
+    }
 
 
     // Map cell (reference) degree of freedom points to the appropriate side (elem_side)
@@ -770,14 +772,14 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
 
       case INTJUMP:
        {
-         const ScalarT elem_scale = matScaling[ebIndexVec[iblock]];
+         const ScalarT elem_scale = matScaling[sides.ebIndexVec[iblock]];
          calc_dudn_const(data, physPointsSide, jacobianSide, *cellType, cellDims, side, elem_scale);
          break;
        }
 
       case ROBIN:
        {
-         const ScalarT elem_scale = matScaling[ebIndexVec[iblock]];
+         const ScalarT elem_scale = matScaling[sides.ebIndexVec[iblock]];
          calc_dudn_robin(data, physPointsSide, dofSide, jacobianSide, *cellType, cellDims, side, elem_scale, robin_vals);
          break;
        }
@@ -837,6 +839,65 @@ evaluateNeumannContribution(typename Traits::EvalData workset)
                   data(iCell, qp, dim) * weighted_trans_basis_refPointsSide(iCell, node, qp);
     }
   }
+  sides.hasGeometry = useCache;
+  return sides.cells;
+}
+
+template<typename EvalT, typename Traits>
+typename NeumannBase<EvalT, Traits>::CachedSideSet&
+NeumannBase<EvalT, Traits>::
+groupSides(typename Traits::EvalData workset,
+           const std::vector<Albany::SideStruct>& sideSet)
+{
+  if (workset.wsIndex >= sideCache->size())
+    sideCache->resize(workset.wsIndex + 1);
+
+  CachedSideSet& sides = (*sideCache)[workset.wsIndex];
+  if (sides.sides == sideSet.data() && sides.coords == workset.wsCoords.getRawPtr())
+    return sides;
+
+  //! For each element block, and for each local side id (e.g. side_id=0,1,2,3,4 for a Prism) we want to identify all the physical cells associated to that side id and block.
+  //! In this way we can group them and call Intrepid2 function for a group of cells, which is more effective.
+  //! At this point we do not know the number of blocks in this workset (If we assumed to have elements of the same block in a workset we could skip some of this).
+  //! Also we do not know before the evaluator how many cells are associated to a local side id.
+
+  sides.sides = sideSet.data();
+  sides.coords = workset.wsCoords.getRawPtr();
+  sides.hasGeometry = false;
+  sides.ebIndexVec.clear();
+  sides.groups.clear();
+
+  std::map<int, int> ordinalEbIndex;
+  for (auto const& it_side : sideSet) {
+    const int ebIndex = it_side.elem_ebIndex;
+    const int elem_side = it_side.side_local_id;
+
+    if(ordinalEbIndex.insert(std::pair<int,int>(ebIndex,ordinalEbIndex.size())).second) {
+      sides.groups.push_back(std::vector<SideGroup>(numSidesOnElem));
+      sides.ebIndexVec.push_back(ebIndex);
+    }
+
+    sides.groups[ordinalEbIndex[ebIndex]][elem_side].numCells++;
+  }
+  for (int ib=0; ib<sides.groups.size(); ib++) {
+    for (int is=0; is<numSidesOnElem; is++) {
+      SideGroup& group = sides.groups[ib][is];
+      group.cells = Kokkos::DynRankView<int, PHX::Device>("cellOnSide_i", group.numCells);
+      group.numCells=0;
+    }
+  }
+
+  sides.cells.clear();
+  for (auto const& it_side : sideSet) {
+    SideGroup& group = sides.groups[ordinalEbIndex[it_side.elem_ebIndex]][it_side.side_local_id];
+    group.cells(group.numCells++) = it_side.elem_LID;
+    sides.cells.push_back(it_side.elem_LID);
+  }
+  std::sort(sides.cells.begin(), sides.cells.end());
+  sides.cells.erase(std::unique(sides.cells.begin(), sides.cells.end()),
+                    sides.cells.end());
+
+  return sides;
 }
 
 template<typename EvalT, typename Traits>
@@ -1507,10 +1568,11 @@ evaluateFields(typename Traits::EvalData workset)
   Teuchos::ArrayRCP<ST> fT_nonconstView = fT->get1dViewNonConst();
 
   // Fill in "neumann" array
-  this->evaluateNeumannContribution(workset);
+  const std::vector<int>& sideCells =
+    this->evaluateNeumannContribution(workset);
 
   // Place it at the appropriate offset into F
-  for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+  for (const int cell : sideCells) {
     for (std::size_t node = 0; node < this->numNodes; ++node)
       for (std::size_t dim = 0; dim < this->numDOFsSet; ++dim){
         fT_nonconstView[nodeID(cell,node,this->offset[dim])] += this->neumann(cell, node, dim);
@@ -1607,13 +1669,14 @@ evaluateFields(typename Traits::EvalData workset)
 
 
   // Fill in "neumann" array
-  this->evaluateNeumannContribution(workset);
+  const std::vector<int>& sideCells =
+    this->evaluateNeumannContribution(workset);
   int lcol;
   Teuchos::Array<LO> rowT(1);
   Teuchos::Array<LO> colT(1);
   Teuchos::Array<ST> value(1);
 
-  for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+  for (const int cell : sideCells) {
     for (std::size_t node = 0; node < this->numNodes; ++node)
       for (std::size_t dim = 0; dim < this->numDOFsSet; ++dim){
 
@@ -1674,7 +1737,7 @@ evaluateFields(typename Traits::EvalData workset)
 
    is_adjoint=workset.is_adjoint;
 
-   Kokkos::parallel_for(Neumann_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), Neumann_Policy(0,workset.numCells),*this);
 
 //   if ( !JacT->isFillActive())
 //    JacT->fillComplete();
@@ -1705,9 +1768,10 @@ evaluateFields(typename Traits::EvalData workset)
 
   // Fill the local "neumann" array with cell contributions
 
-  this->evaluateNeumannContribution(workset);
+  const std::vector<int>& sideCells =
+    this->evaluateNeumannContribution(workset);
 
-  for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+  for (const int cell : sideCells) {
     for (std::size_t node = 0; node < this->numNodes; ++node)
       for (std::size_t dim = 0; dim < this->numDOFsSet; ++dim){
 
@@ -1751,12 +1815,13 @@ evaluateFields(typename Traits::EvalData workset)
 
   // Fill the local "neumann" array with cell contributions
 
-  this->evaluateNeumannContribution(workset);
+  const std::vector<int>& sideCells =
+    this->evaluateNeumannContribution(workset);
 
   if (trans) {
     int neq = workset.numEqs;
     const Albany::IDArray&  wsElDofs = workset.distParamLib->get(workset.dist_param_deriv_name)->workset_elem_dofs()[workset.wsIndex];
-    for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+    for (const int cell : sideCells) {
       const Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> >& local_Vp =
         workset.local_Vp[cell];
       const int num_deriv = local_Vp.size()/neq;
@@ -1779,7 +1844,7 @@ evaluateFields(typename Traits::EvalData workset)
   }
 
   else {
-    for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
+    for (const int cell : sideCells) {
       const Teuchos::ArrayRCP<Teuchos::ArrayRCP<double> >& local_Vp =
         workset.local_Vp[cell];
       const int num_deriv = local_Vp.size();
@@ -60,6 +60,11 @@ public:
 
   void
   evaluateFields(typename Traits::EvalData d);
+
+private:
+  //! Rows of the node set in the Jacobian, rebuilt when its graph changes
+  Teuchos::RCP<DirichletRows>
+  rows_;
 };
 
 //
@@ -0,0 +1,129 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "PHAL_SDirichletSweep.hpp"
+#include "Albany_Utils.hpp"
+#include "Teuchos_CommHelpers.hpp"
+
+bool
+PHAL::SDirichletSweep::begin(const Tpetra_CrsMatrix& jacT)
+{
+  const Teuchos::RCP<const Tpetra_CrsGraph> graphT = jacT.getCrsGraph();
+
+  // The local matrix is only set up after the first fillComplete
+  active_ = graphT->isFillComplete() &&
+      jacT.getLocalMatrix().values.dimension(0) == graphT->getNodeNumEntries();
+  if (!active_) return false;
+
+  if (graphT != graphT_) setGraph(graphT);
+  mask_.assign(jacT.getNodeNumRows(), 0);
+  return true;
+}
+
+void
+PHAL::SDirichletSweep::setGraph(
+    const Teuchos::RCP<const Tpetra_CrsGraph>& graphT)
+{
+  graphT_ = graphT;
+
+  // This construction is expensive, it is done once per graph
+  importT_ = Teuchos::rcp(
+      new Tpetra_Import(graphT_->getRowMap(), graphT_->getColMap()));
+
+  const LocalGraph local_graph = graphT_->getLocalGraph();
+  row_ptrs_ = LocalGraph::row_map_type::non_const_type::HostMirror(
+      "row_ptrs", local_graph.row_map.dimension(0));
+  Kokkos::deep_copy(row_ptrs_, local_graph.row_map);
+  cols_ = Kokkos::create_mirror_view(local_graph.entries);
+  Kokkos::deep_copy(cols_, local_graph.entries);
+
+  last_mask_.clear();
+}
+
+void
+PHAL::SDirichletSweep::buildTouchedRows()
+{
+  using IntVector = Tpetra::Vector<int, Tpetra_LO, Tpetra_GO, KokkosNode>;
+
+  IntVector rowIsDBC(graphT_->getRowMap());
+  IntVector colIsDBC(graphT_->getColMap());
+
+  rowIsDBC.modify<Kokkos::HostSpace>();
+  {
+    const auto data = rowIsDBC.getLocalView<Kokkos::HostSpace>();
+    for (size_t row = 0; row < mask_.size(); ++row) data(row, 0) = mask_[row];
+  }
+  colIsDBC.doImport(rowIsDBC, *importT_, Tpetra::ADD);
+
+  const auto colData = colIsDBC.getLocalView<Kokkos::HostSpace>();
+  col_mask_.resize(colData.dimension(0));
+  for (size_t col = 0; col < col_mask_.size(); ++col)
+    col_mask_[col] = colData(col, 0) > 0 ? 1 : 0;
+
+  std::vector<LO> touched;
+  for (size_t row = 0; row < mask_.size(); ++row) {
+    const bool rowIsMarked = col_mask_[row] > 0;
+    for (size_t k = row_ptrs_(row); k < row_ptrs_(row + 1); ++k) {
+      const LO col = cols_(k);
+      if (col == static_cast<LO>(row)) continue;
+      if (rowIsMarked || col_mask_[col] > 0) {
+        touched.push_back(row);
+        break;
+      }
+    }
+  }
+  touched_rows_ =
+      Kokkos::View<LO*, Kokkos::HostSpace>("touched_rows", touched.size());
+  for (size_t i = 0; i < touched.size(); ++i) touched_rows_(i) = touched[i];
+
+  last_mask_ = mask_;
+}
+
+void
+PHAL::SDirichletSweep::apply(Tpetra_CrsMatrix& jacT)
+{
+  if (!active_) return;
+  active_ = false;
+
+  ALBANY_ASSERT(
+      jacT.getCrsGraph() == graphT_,
+      "SDirichletSweep applied to another Jacobian than the one it began with");
+
+  // The import is collective, so every rank rebuilds if any mask changed
+  const int changed = mask_ != last_mask_ ? 1 : 0;
+  int       changedAny = 0;
+  Teuchos::reduceAll(
+      *graphT_->getComm(), Teuchos::REDUCE_MAX, changed,
+      Teuchos::outArg(changedAny));
+  if (changedAny > 0) buildTouchedRows();
+
+  const auto touchedRows = touched_rows_;
+  if (touchedRows.dimension(0) == 0) return;
+
+  const auto valuesD = jacT.getLocalMatrix().values;
+  const auto values  = Kokkos::create_mirror_view(valuesD);
+  Kokkos::deep_copy(values, valuesD);
+
+  const auto       rowPtrs = row_ptrs_;
+  const auto       cols    = cols_;
+  const int* const colMask = col_mask_.data();
+
+  // Touched rows own disjoint ranges of the values array
+  Kokkos::parallel_for(
+      "SDirichletSweep::apply",
+      Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(
+          0, touchedRows.dimension(0)),
+      [=](const int i) {
+        const LO   row      = touchedRows(i);
+        const bool rowIsDBC = colMask[row] > 0;
+        for (size_t k = rowPtrs(row); k < rowPtrs(row + 1); ++k) {
+          const LO col = cols(k);
+          if (col == row) continue;
+          if (rowIsDBC || colMask[col] > 0) values(k) = 0.0;
+        }
+      });
+  Kokkos::deep_copy(valuesD, values);
+}
@@ -0,0 +1,79 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_SDIRICHLETSWEEP_HPP
+#define PHAL_SDIRICHLETSWEEP_HPP
+
+#include <vector>
+
+#include "Albany_DataTypes.hpp"
+
+namespace PHAL {
+
+/*! \brief One Jacobian sweep for all the strong Dirichlet conditions.
+ *
+ *  The SDirichlet evaluators only mark their rows in a shared mask, and the
+ *  off-diagonal entries of all the marked rows and columns are zeroed in one
+ *  pass over the local values once every condition has been evaluated. The
+ *  importer from the row map to the column map, and the list of rows with
+ *  entries to zero, are kept as long as the graph and the mask do not change,
+ *  so the other rows are not visited at all.
+ */
+class SDirichletSweep {
+ public:
+  //! Clear the mask for a new evaluation of jacT. Returns false, and the
+  //! sweep stays inactive, if the local values of jacT are not available yet.
+  bool
+  begin(const Tpetra_CrsMatrix& jacT);
+
+  bool
+  isActive() const
+  {
+    return active_;
+  }
+
+  //! Mark a local row as a strong Dirichlet row
+  void
+  markRow(const LO row)
+  {
+    mask_[row] = 1;
+  }
+
+  //! Zero the off-diagonal entries of the marked rows and columns of jacT
+  void
+  apply(Tpetra_CrsMatrix& jacT);
+
+ private:
+  void
+  setGraph(const Teuchos::RCP<const Tpetra_CrsGraph>& graphT);
+
+  void
+  buildTouchedRows();
+
+  bool active_ = false;
+
+  Teuchos::RCP<const Tpetra_CrsGraph> graphT_;
+  Teuchos::RCP<const Tpetra_Import>   importT_;
+
+  using LocalGraph = Tpetra_CrsGraph::local_graph_type;
+
+  LocalGraph::row_map_type::non_const_type::HostMirror row_ptrs_;
+  LocalGraph::entries_type::HostMirror                 cols_;
+
+  //! Rows marked in this evaluation, and the mask the sweep was built for
+  std::vector<int> mask_;
+  std::vector<int> last_mask_;
+
+  //! Marked rows and columns in the column map
+  std::vector<int> col_mask_;
+
+  //! Rows with at least one off-diagonal entry to zero
+  Kokkos::View<LO*, Kokkos::HostSpace> touched_rows_;
+};
+
+}  // namespace PHAL
+
+#endif  // PHAL_SDIRICHLETSWEEP_HPP
@@ -9,6 +9,7 @@
 
 #include "Albany_Application.hpp"
 #include "PHAL_SDirichlet.hpp"
+#include "PHAL_SDirichletSweep.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Sacado_ParameterRegistration.hpp"
 #include "Teuchos_TestForException.hpp"
@@ -116,6 +117,63 @@ evaluateFields(typename Traits::EvalData dirichlet_workset) {
   Teuchos::Array<LO>
   indices;
 
+  int const 
+  spatial_dimension = dirichlet_workset.spatial_dimension_; 
+
+#if defined(ALBANY_LCM)
+  auto const &
+  fixed_dofs = dirichlet_workset.fixed_dofs_;
+#endif
+
+  // Local rows of this condition
+  std::vector<LO>
+  dbc_rows;
+
+#if defined (ALBANY_LCM)
+  if (dirichlet_workset.is_schwarz_bc_ == false) { //regular SDBC
+#endif
+    if (J->getCrsGraph()->isFillComplete() &&
+        (rows_ == Teuchos::null || !rows_->isCompatible(*J, ns_nodes))) {
+      rows_ = Teuchos::rcp(new DirichletRows(*J, ns_nodes, this->offset));
+    }
+    if (rows_ != Teuchos::null && rows_->isCompatible(*J, ns_nodes)) {
+      dbc_rows = rows_->rows();
+    } else {
+      dbc_rows.reserve(ns_nodes.size());
+      for (size_t ns_node = 0; ns_node < ns_nodes.size(); ns_node++) {
+        dbc_rows.push_back(ns_nodes[ns_node][this->offset]);
+      }
+    }
+#if defined (ALBANY_LCM)
+  }
+  else { //special case for Schwarz SDBC 
+    for (size_t ns_node = 0; ns_node < ns_nodes.size(); ns_node++) {
+      for (int offset = 0; offset < spatial_dimension; ++offset) {
+        auto dof = ns_nodes[ns_node][offset];
+        // If this DOF already has a DBC, skip it.
+        if (fixed_dofs.find(dof) != fixed_dofs.end()) continue;
+        dbc_rows.push_back(dof);
+      }
+    }
+  }
+#endif
+
+  // With a shared sweep, only mark the rows; the Jacobian entries of all the
+  // conditions are zeroed at once after the last one
+  auto const &
+  sweep = dirichlet_workset.sdbcSweep;
+
+  if (sweep != Teuchos::null && sweep->isActive() == true) {
+    for (auto dof : dbc_rows) {
+      sweep->markRow(dof);
+      if (fill_residual == true) {
+        f_view[dof] = 0.0;
+        x_view[dof] = this->value.val();
+      }
+    }
+    return;
+  }
+
   using IntVec = Tpetra::Vector<int, Tpetra_LO, Tpetra_GO, KokkosNode>;
   using Import = Tpetra::Import<Tpetra_LO, Tpetra_GO, KokkosNode>;
   Teuchos::RCP<const Import> import;
@@ -133,39 +191,14 @@ evaluateFields(typename Traits::EvalData dirichlet_workset) {
 
   IntVec row_is_dbc(row_map);
   IntVec col_is_dbc(col_map);
-  
-  int const 
-  spatial_dimension = dirichlet_workset.spatial_dimension_; 
-
-#if defined(ALBANY_LCM)
-  auto const &
-  fixed_dofs = dirichlet_workset.fixed_dofs_;
-#endif
 
   row_is_dbc.template modify<Kokkos::HostSpace>();
   {
     auto row_is_dbc_data = row_is_dbc.template getLocalView<Kokkos::HostSpace>();
     ALBANY_ASSERT(row_is_dbc_data.extent(1) == 1);
-#if defined (ALBANY_LCM)
-    if (dirichlet_workset.is_schwarz_bc_ == false) { //regular SDBC
-#endif
-      for (size_t ns_node = 0; ns_node < ns_nodes.size(); ns_node++) {
-        auto dof = ns_nodes[ns_node][this->offset];
-        row_is_dbc_data(dof, 0) = 1;
-      }
-#if defined (ALBANY_LCM)
-    }
-    else { //special case for Schwarz SDBC 
-      for (size_t ns_node = 0; ns_node < ns_nodes.size(); ns_node++) {
-        for (int offset = 0; offset < spatial_dimension; ++offset) {
-          auto dof = ns_nodes[ns_node][offset];
-          // If this DOF already has a DBC, skip it.
-          if (fixed_dofs.find(dof) != fixed_dofs.end()) continue;
-          row_is_dbc_data(dof,0) = 1;
-        }
-      }
+    for (auto dof : dbc_rows) {
+      row_is_dbc_data(dof, 0) = 1;
     }
-#endif
   }
   col_is_dbc.doImport(row_is_dbc, *import, Tpetra::ADD);
   auto col_is_dbc_data = col_is_dbc.template getLocalView<Kokkos::HostSpace>();
@@ -174,6 +207,42 @@ evaluateFields(typename Traits::EvalData dirichlet_workset) {
   num_local_rows = J->getNodeNumRows();
   auto min_local_row = row_map->getMinLocalIndex();
   auto max_local_row = row_map->getMaxLocalIndex();
+
+  // Zero the entries of the DBC rows and columns in one pass over the local
+  // values, once the local matrix is set up by the first fillComplete
+  auto const
+  local_matrix = J->getLocalMatrix();
+
+  if (local_matrix.values.dimension(0) ==
+      J->getCrsGraph()->getNodeNumEntries()) {
+    using RowPtrs = Tpetra_CrsGraph::local_graph_type::row_map_type::
+        non_const_type::HostMirror;
+    RowPtrs row_ptrs("row_ptrs", local_matrix.graph.row_map.dimension(0));
+    Kokkos::deep_copy(row_ptrs, local_matrix.graph.row_map);
+    auto cols = Kokkos::create_mirror_view(local_matrix.graph.entries);
+    Kokkos::deep_copy(cols, local_matrix.graph.entries);
+    auto values = Kokkos::create_mirror_view(local_matrix.values);
+    Kokkos::deep_copy(values, local_matrix.values);
+
+    for (auto local_row = min_local_row; local_row <= max_local_row;
+         ++local_row) {
+      auto row_is_dbc = col_is_dbc_data(local_row, 0) > 0;
+
+      if (row_is_dbc && fill_residual == true) {
+        f_view[local_row] = 0.0;
+        x_view[local_row] = this->value.val();
+      }
+
+      for (auto k = row_ptrs(local_row); k < row_ptrs(local_row + 1); ++k) {
+        auto local_col = cols(k);
+        if (local_col == local_row) continue;
+        if (row_is_dbc || col_is_dbc_data(local_col, 0) > 0) values(k) = 0.0;
+      }
+    }
+    Kokkos::deep_copy(local_matrix.values, values);
+    return;
+  }
+
   for (auto local_row = min_local_row; local_row <= max_local_row; ++local_row) {
     auto num_row_entries = J->getNumEntriesInLocalRow(local_row);
 
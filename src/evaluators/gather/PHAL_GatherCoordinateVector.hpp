@@ -54,6 +54,22 @@ private:
   std::size_t worksetSize;
   std::size_t numVertices;
   std::size_t numDim;
+
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+public:
+  typedef typename PHX::Device::execution_space ExecutionSpace;
+
+  struct PHAL_GatherCoordsView_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, PHAL_GatherCoordsView_Tag> PHAL_GatherCoordsView_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const PHAL_GatherCoordsView_Tag&, const int& cell) const;
+
+private:
+  // Contiguous coordinates of the workset, see PHAL::Workset::wsCoordsView
+  Kokkos::View<const double***, Kokkos::LayoutRight, PHX::Device> wsCoordsView;
+  int numCells;
+#endif
 };
 
 }
@@ -61,19 +61,50 @@ void GatherCoordinateVector<EvalT, Traits>::postRegistrationSetup(typename Trait
   numDim = dims[2];
 }
 
+// **********************************************************************
+#ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void GatherCoordinateVector<EvalT, Traits>::
+operator() (const PHAL_GatherCoordsView_Tag&, const int& cell) const
+{
+  const int src = cell < numCells ? cell : 0;
+  for (std::size_t node = 0; node < numVertices; ++node)
+    for (std::size_t eq = 0; eq < numDim; ++eq)
+      coordVec(cell,node,eq) = wsCoordsView(src,node,eq);
+}
+#endif
+
 // **********************************************************************
 template<typename EvalT, typename Traits>
 void GatherCoordinateVector<EvalT, Traits>::evaluateFields(typename Traits::EvalData workset)
 { 
   unsigned int numCells = workset.numCells;
   Teuchos::ArrayRCP<Teuchos::ArrayRCP<double*> > wsCoords = workset.wsCoords;
+  const bool haveCoordsView =
+    workset.wsCoordsView.dimension(0) == numCells &&
+    workset.wsCoordsView.dimension(1) >= numVertices &&
+    workset.wsCoordsView.dimension(2) >= numDim;
 
 #ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
   if( dispVecName.is_null() ){
-    for (std::size_t cell=0; cell < numCells; ++cell) {
-      for (std::size_t node = 0; node < numVertices; ++node) {
-        for (std::size_t eq=0; eq < numDim; ++eq) { 
-          coordVec(cell,node,eq) = wsCoords[cell][node][eq]; 
+    if (haveCoordsView) {
+      // Contiguous copy of the coordinates provided by the discretization
+      const Albany::AbstractDiscretization::WorksetCoordsView&
+        wsCoordsView = workset.wsCoordsView;
+      for (std::size_t cell=0; cell < numCells; ++cell) {
+        for (std::size_t node = 0; node < numVertices; ++node) {
+          for (std::size_t eq=0; eq < numDim; ++eq) { 
+            coordVec(cell,node,eq) = wsCoordsView(cell,node,eq); 
+          }
+        }
+      }
+    } else {
+      for (std::size_t cell=0; cell < numCells; ++cell) {
+        for (std::size_t node = 0; node < numVertices; ++node) {
+          for (std::size_t eq=0; eq < numDim; ++eq) { 
+            coordVec(cell,node,eq) = wsCoords[cell][node][eq]; 
+          }
         }
       }
     }
@@ -117,6 +148,15 @@ void GatherCoordinateVector<EvalT, Traits>::evaluateFields(typename Traits::Eval
     }
   }
 #else
+  if (dispVecName.is_null() && haveCoordsView) {
+    // Copy the contiguous coordinates on the device, padding the excess
+    // cells with the first one
+    this->wsCoordsView = workset.wsCoordsView;
+    this->numCells = numCells;
+    Kokkos::parallel_for(this->getName(), PHAL_GatherCoordsView_Policy(0, worksetSize), *this);
+    return;
+  }
+
  typedef Kokkos::View<MeshScalarT***,PHX::Device> view_type;
  typedef typename view_type::HostMirror host_view_type;
   
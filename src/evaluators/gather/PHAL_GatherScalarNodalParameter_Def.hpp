@@ -74,11 +74,11 @@ evaluateFields(typename Traits::EvalData workset)
   }
   Teuchos::ArrayRCP<const ST> pvecT_constView = pvecT->get1dView();
 
-  const Albany::IDArray& wsElDofs = workset.distParamLib->get(this->param_name)->workset_elem_dofs()[workset.wsIndex];
+  const DistParam::elem_lid_view_type& lids = workset.distParamLib->get(this->param_name)->workset_elem_lids(workset.wsIndex);
 
   for (std::size_t cell = 0; cell < workset.numCells; ++cell)
     for (std::size_t node = 0; node < this->numNodes; ++node) {
-      const LO lid = wsElDofs((int)cell,(int)node,0);
+      const LO lid = lids(cell,node);
       (this->val)(cell,node) = (lid >= 0 ) ? pvecT_constView[lid] : 0;
     }
 }
@@ -113,7 +113,7 @@ evaluateFields(typename Traits::EvalData workset)
   Teuchos::ArrayRCP<const ST> pvecT_constView = pvecT->get1dView();
 
   auto nodeID = workset.wsElNodeEqID;
-  const Albany::IDArray& wsElDofs = workset.distParamLib->get(this->param_name)->workset_elem_dofs()[workset.wsIndex];
+  const DistParam::elem_lid_view_type& lids = workset.distParamLib->get(this->param_name)->workset_elem_lids(workset.wsIndex);
 
   // Are we differentiating w.r.t. this parameter?
   bool is_active = (workset.dist_param_deriv_name == this->param_name);
@@ -127,7 +127,7 @@ evaluateFields(typename Traits::EvalData workset)
       for (std::size_t node = 0; node < num_deriv; ++node) {
 
         // Initialize Fad type for parameter value
-        const LO id = wsElDofs((int)cell,(int)node,0);
+        const LO id = lids(cell,node);
         double pvec_id = (id >= 0) ? pvecT_constView[id] : 0;
         ParamScalarT v(num_deriv, node, pvec_id);
         v.setUpdateValue(!workset.ignore_residual);
@@ -155,7 +155,7 @@ evaluateFields(typename Traits::EvalData workset)
         else {
           local_Vp.resize(num_deriv);
           for (std::size_t node = 0; node < num_deriv; ++node) {
-            const LO id = wsElDofs((int)cell,(int)node,0);
+            const LO id = lids(cell,node);
             local_Vp[node].resize(num_cols);
             for (std::size_t col=0; col<num_cols; ++col)
               local_Vp[node][col] = (id >= 0) ? VpT.getData(col)[id] : 0;
@@ -169,7 +169,7 @@ evaluateFields(typename Traits::EvalData workset)
   else {
     for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
       for (std::size_t node = 0; node < this->numNodes; ++node) {
-        const LO lid = wsElDofs((int)cell,(int)node,0);
+        const LO lid = lids(cell,node);
         (this->val)(cell,node) = (lid >= 0) ? pvecT_constView[lid] : 0;
       }
     }
@@ -190,45 +190,39 @@ public:
 private:
   typedef typename PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
   const int numFields;
+
+  //! Set the value and the single nonzero derivative of an entry in place,
+  //! instead of assigning a temporary FadType, which allocates for DFad
+  KOKKOS_INLINE_FUNCTION
+  static void seed (typename PHAL::Ref<ScalarT>::type valref, const ST x,
+                    const int unk, const double coeff) {
+    valref.val() = x;
+    const int num_dof = valref.size();
+    for (int i = 0; i < num_dof; ++i)
+      valref.fastAccessDx(i) = 0.0;
+    valref.fastAccessDx(unk) = coeff;
+  }
  
 #ifdef ALBANY_KOKKOS_UNDER_DEVELOPMENT 
 public:
+  // Each kernel gathers x, and xdot and xdotdot when requested, in one pass
   struct PHAL_GatherJacRank2_Tag{};
-  struct PHAL_GatherJacRank2_Transient_Tag{};
-  struct PHAL_GatherJacRank2_Acceleration_Tag{};
-
   struct PHAL_GatherJacRank1_Tag{};
-  struct PHAL_GatherJacRank1_Transient_Tag{};
-  struct PHAL_GatherJacRank1_Acceleration_Tag{};
-
   struct PHAL_GatherJacRank0_Tag{};
-  struct PHAL_GatherJacRank0_Transient_Tag{};
-  struct PHAL_GatherJacRank0_Acceleration_Tag{};
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const PHAL_GatherJacRank2_Tag&, const int& cell) const;
-  KOKKOS_INLINE_FUNCTION
-  void operator() (const PHAL_GatherJacRank2_Transient_Tag&, const int& cell) const;
-  KOKKOS_INLINE_FUNCTION
-  void operator() (const PHAL_GatherJacRank2_Acceleration_Tag&, const int& cell) const;
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const PHAL_GatherJacRank1_Tag&, const int& cell) const;
-  KOKKOS_INLINE_FUNCTION
-  void operator() (const PHAL_GatherJacRank1_Transient_Tag&, const int& cell) const;
-  KOKKOS_INLINE_FUNCTION
-  void operator() (const PHAL_GatherJacRank1_Acceleration_Tag&, const int& cell) const;
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const PHAL_GatherJacRank0_Tag&, const int& cell) const;
-  KOKKOS_INLINE_FUNCTION
-  void operator() (const PHAL_GatherJacRank0_Transient_Tag&, const int& cell) const;
-  KOKKOS_INLINE_FUNCTION
-  void operator() (const PHAL_GatherJacRank0_Acceleration_Tag&, const int& cell) const;
  
 private:
   int neq, numDim;
   double j_coeff, n_coeff, m_coeff;
+  bool gatherTransient, gatherAcceleration;
 
   typedef GatherSolutionBase<PHAL::AlbanyTraits::Jacobian, Traits> Base;
   using Base::nodeID;
@@ -244,14 +238,8 @@ private:
 
   typedef typename PHX::Device::execution_space ExecutionSpace;
   typedef Kokkos::RangePolicy<ExecutionSpace,PHAL_GatherJacRank2_Tag> PHAL_GatherJacRank2_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace,PHAL_GatherJacRank2_Transient_Tag> PHAL_GatherJacRank2_Transient_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace,PHAL_GatherJacRank2_Acceleration_Tag> PHAL_GatherJacRank2_Acceleration_Policy;
   typedef Kokkos::RangePolicy<ExecutionSpace,PHAL_GatherJacRank1_Tag> PHAL_GatherJacRank1_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace,PHAL_GatherJacRank1_Transient_Tag> PHAL_GatherJacRank1_Transient_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace,PHAL_GatherJacRank1_Acceleration_Tag> PHAL_GatherJacRank1_Acceleration_Policy;
   typedef Kokkos::RangePolicy<ExecutionSpace,PHAL_GatherJacRank0_Tag> PHAL_GatherJacRank0_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace,PHAL_GatherJacRank0_Transient_Tag> PHAL_GatherJacRank0_Transient_Policy;
-  typedef Kokkos::RangePolicy<ExecutionSpace,PHAL_GatherJacRank0_Acceleration_Tag> PHAL_GatherJacRank0_Acceleration_Policy;
 
 #endif
 };
@@ -379,31 +379,31 @@ evaluateFields(typename Traits::EvalData workset)
 
   if (this->tensorRank == 2){
     numDim = this->valTensor.dimension(2);
-    Kokkos::parallel_for(PHAL_GatherSolRank2_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), PHAL_GatherSolRank2_Policy(0,workset.numCells),*this);
     cudaCheckError();
 
     if (workset.transientTerms && this->enableTransient) {
-      Kokkos::parallel_for(PHAL_GatherSolRank2_Transient_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_GatherSolRank2_Transient_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
 
     if (workset.accelerationTerms && this->enableAcceleration) {
-      Kokkos::parallel_for(PHAL_GatherSolRank2_Acceleration_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_GatherSolRank2_Acceleration_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
   }
   
   else if (this->tensorRank == 1){
-    Kokkos::parallel_for(PHAL_GatherSolRank1_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), PHAL_GatherSolRank1_Policy(0,workset.numCells),*this);
     cudaCheckError();
 
     if (workset.transientTerms && this->enableTransient) {
-      Kokkos::parallel_for(PHAL_GatherSolRank1_Transient_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_GatherSolRank1_Transient_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
 
     if (workset.accelerationTerms && this->enableAcceleration) {
-      Kokkos::parallel_for(PHAL_GatherSolRank1_Acceleration_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_GatherSolRank1_Acceleration_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
   }
@@ -416,7 +416,7 @@ evaluateFields(typename Traits::EvalData workset)
     }
     d_val=val_kokkos.template view<ExecutionSpace>();
 
-    Kokkos::parallel_for(PHAL_GatherSolRank0_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), PHAL_GatherSolRank0_Policy(0,workset.numCells),*this);
     cudaCheckError();
 
     if (workset.transientTerms && this->enableTransient){ 
@@ -427,7 +427,7 @@ evaluateFields(typename Traits::EvalData workset)
       }
       d_val_dot=val_dot_kokkos.template view<ExecutionSpace>();
 
-      Kokkos::parallel_for(PHAL_GatherSolRank0_Transient_Policy(0,workset.numCells),*this);  
+      Kokkos::parallel_for(this->getName(), PHAL_GatherSolRank0_Transient_Policy(0,workset.numCells),*this);  
       cudaCheckError();
     }
     if (workset.accelerationTerms && this->enableAcceleration){
@@ -438,7 +438,7 @@ evaluateFields(typename Traits::EvalData workset)
       }
       d_val_dotdot=val_dotdot_kokkos.template view<ExecutionSpace>();
 
-      Kokkos::parallel_for(PHAL_GatherSolRank0_Acceleration_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_GatherSolRank0_Acceleration_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
   }
@@ -484,37 +484,15 @@ operator() (const PHAL_GatherJacRank2_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; ++node){
     int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
-      typename PHAL::Ref<ScalarT>::type valref = (this->valTensor)(cell,node,eq/numDim,eq%numDim);
-      valref=FadType(valref.size(), xT_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =j_coeff;
-    }
-  }
-}
-
-template<typename Traits>
-KOKKOS_INLINE_FUNCTION
-void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
-operator() (const PHAL_GatherJacRank2_Transient_Tag&, const int& cell) const{
-  for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
-    for (int eq = 0; eq < numFields; eq++){
-      typename PHAL::Ref<ScalarT>::type valref = (this->valTensor_dot)(cell,node,eq/numDim,eq%numDim);
-      valref =FadType(valref.size(), xdotT_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =m_coeff;
-    }
-  }
-}
-
-template<typename Traits>
-KOKKOS_INLINE_FUNCTION
-void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
-operator() (const PHAL_GatherJacRank2_Acceleration_Tag&, const int& cell) const{
-  for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
-    for (int eq = 0; eq < numFields; eq++){
-      typename PHAL::Ref<ScalarT>::type valref = (this->valTensor_dotdot)(cell,node,eq/numDim,eq%numDim);
-      valref=FadType(valref.size(), xdotdotT_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =n_coeff;
+      const int lid = nodeID(cell,node,this->offset+eq);
+      seed((this->valTensor)(cell,node,eq/numDim,eq%numDim),
+           xT_constView(lid), firstunk + eq, j_coeff);
+      if (gatherTransient)
+        seed((this->valTensor_dot)(cell,node,eq/numDim,eq%numDim),
+             xdotT_constView(lid), firstunk + eq, m_coeff);
+      if (gatherAcceleration)
+        seed((this->valTensor_dotdot)(cell,node,eq/numDim,eq%numDim),
+             xdotdotT_constView(lid), firstunk + eq, n_coeff);
     }
   }
 }
@@ -526,37 +504,15 @@ operator() (const PHAL_GatherJacRank1_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; node++){
     int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
-      typename PHAL::Ref<ScalarT>::type valref = (this->valVec)(cell,node,eq);
-      valref =FadType(valref.size(), xT_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =j_coeff;
-    }
-  }
-}
-
-template<typename Traits>
-KOKKOS_INLINE_FUNCTION
-void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
-operator() (const PHAL_GatherJacRank1_Transient_Tag&, const int& cell) const{
-  for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
-    for (int eq = 0; eq < numFields; eq++){
-      typename PHAL::Ref<ScalarT>::type valref = (this->valVec_dot)(cell,node,eq);
-      valref =FadType(valref.size(), xdotT_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =m_coeff;
-    }
-  }  
-}
-
-template<typename Traits>
-KOKKOS_INLINE_FUNCTION
-void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
-operator() (const PHAL_GatherJacRank1_Acceleration_Tag&, const int& cell) const{
-  for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
-    for (int eq = 0; eq < numFields; eq++){
-      typename PHAL::Ref<ScalarT>::type valref = (this->valVec_dotdot)(cell,node,eq);
-      valref =FadType(valref.size(), xdotdotT_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =n_coeff;
+      const int lid = nodeID(cell,node,this->offset+eq);
+      seed((this->valVec)(cell,node,eq), xT_constView(lid), firstunk + eq,
+           j_coeff);
+      if (gatherTransient)
+        seed((this->valVec_dot)(cell,node,eq), xdotT_constView(lid),
+             firstunk + eq, m_coeff);
+      if (gatherAcceleration)
+        seed((this->valVec_dotdot)(cell,node,eq), xdotdotT_constView(lid),
+             firstunk + eq, n_coeff);
     }
   }
 }
@@ -568,37 +524,14 @@ operator() (const PHAL_GatherJacRank0_Tag&, const int& cell) const{
   for (int node = 0; node < this->numNodes; ++node){
     int firstunk = neq * node + this->offset;
     for (int eq = 0; eq < numFields; eq++){
-      typename PHAL::Ref<ScalarT>::type valref = d_val[eq](cell,node);
-      valref =FadType(valref.size(), xT_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =j_coeff;
-    }
-  }
-}
-
-template<typename Traits>
-KOKKOS_INLINE_FUNCTION
-void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
-operator() (const PHAL_GatherJacRank0_Transient_Tag&, const int& cell) const{
-  for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
-    for (int eq = 0; eq < numFields; eq++){
-      typename PHAL::Ref<ScalarT>::type valref = d_val_dot[eq](cell,node);
-      valref =FadType(valref.size(), xdotT_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) =m_coeff;
-    }
-  }
-}
-
-template<typename Traits>
-KOKKOS_INLINE_FUNCTION
-void GatherSolution<PHAL::AlbanyTraits::Jacobian, Traits>::
-operator() (const PHAL_GatherJacRank0_Acceleration_Tag&, const int& cell) const{
-  for (int node = 0; node < this->numNodes; ++node){
-    int firstunk = neq * node + this->offset;
-    for (int eq = 0; eq < numFields; eq++){
-      typename PHAL::Ref<ScalarT>::type valref = d_val_dotdot[eq](cell,node);
-      valref = FadType(valref.size(), xdotdotT_constView(nodeID(cell,node,this->offset+eq)));
-      valref.fastAccessDx(firstunk + eq) = n_coeff;
+      const int lid = nodeID(cell,node,this->offset+eq);
+      seed(d_val[eq](cell,node), xT_constView(lid), firstunk + eq, j_coeff);
+      if (gatherTransient)
+        seed(d_val_dot[eq](cell,node), xdotT_constView(lid), firstunk + eq,
+             m_coeff);
+      if (gatherAcceleration)
+        seed(d_val_dotdot[eq](cell,node), xdotdotT_constView(lid),
+             firstunk + eq, n_coeff);
     }
   }
 }
@@ -625,40 +558,31 @@ evaluateFields(typename Traits::EvalData workset)
   int numDim = 0;
   if (this->tensorRank==2) numDim = this->valTensor.dimension(2); // only needed for tensor fields
 
-  for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
-    const int neq = nodeID.dimension(2);
-    const std::size_t num_dof = neq * this->numNodes;
+  const bool gatherTransient = workset.transientTerms && this->enableTransient;
+  const bool gatherAcceleration =
+    workset.accelerationTerms && this->enableAcceleration;
+  const int neq = nodeID.dimension(2);
 
+  // One pass over the nodes gathers x, xdot and xdotdot
+  for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       int firstunk = neq * node + this->offset;
       for (std::size_t eq = 0; eq < numFields; eq++) {
-        typename PHAL::Ref<ScalarT>::type
-          valref = (this->tensorRank == 0 ? this->val[eq](cell,node) :
-                    this->tensorRank == 1 ? this->valVec(cell,node,eq) :
-                    this->valTensor(cell,node, eq/numDim, eq%numDim));
-        valref = FadType(valref.size(), xT_constView[nodeID(cell,node,this->offset + eq)]);
-        // valref.setUpdateValue(!workset.ignore_residual); Not used anymore
-        valref.fastAccessDx(firstunk + eq) = workset.j_coeff;
-      }
-      if (workset.transientTerms && this->enableTransient) {
-        for (std::size_t eq = 0; eq < numFields; eq++) {
-        typename PHAL::Ref<ScalarT>::type
-          valref = (this->tensorRank == 0 ? this->val_dot[eq](cell,node) :
-                    this->tensorRank == 1 ? this->valVec_dot(cell,node,eq) :
-                    this->valTensor_dot(cell,node, eq/numDim, eq%numDim));
-        valref = FadType(valref.size(), xdotT_constView[nodeID(cell,node,this->offset + eq)]);
-        valref.fastAccessDx(firstunk + eq) = workset.m_coeff;
-        }
-      }
-      if (workset.accelerationTerms && this->enableAcceleration) {
-        for (std::size_t eq = 0; eq < numFields; eq++) {
-        typename PHAL::Ref<ScalarT>::type
-          valref = (this->tensorRank == 0 ? this->val_dotdot[eq](cell,node) :
-                    this->tensorRank == 1 ? this->valVec_dotdot(cell,node,eq) :
-                    this->valTensor_dotdot(cell,node, eq/numDim, eq%numDim));
-        valref = FadType(valref.size(), xdotdotT_constView[nodeID(cell,node,this->offset + eq)]);
-        valref.fastAccessDx(firstunk + eq) = workset.n_coeff;
-        }
+        const LO lid = nodeID(cell,node,this->offset + eq);
+        seed(this->tensorRank == 0 ? this->val[eq](cell,node) :
+             this->tensorRank == 1 ? this->valVec(cell,node,eq) :
+             this->valTensor(cell,node, eq/numDim, eq%numDim),
+             xT_constView[lid], firstunk + eq, workset.j_coeff);
+        if (gatherTransient)
+          seed(this->tensorRank == 0 ? this->val_dot[eq](cell,node) :
+               this->tensorRank == 1 ? this->valVec_dot(cell,node,eq) :
+               this->valTensor_dot(cell,node, eq/numDim, eq%numDim),
+               xdotT_constView[lid], firstunk + eq, workset.m_coeff);
+        if (gatherAcceleration)
+          seed(this->tensorRank == 0 ? this->val_dotdot[eq](cell,node) :
+               this->tensorRank == 1 ? this->valVec_dotdot(cell,node,eq) :
+               this->valTensor_dotdot(cell,node, eq/numDim, eq%numDim),
+               xdotdotT_constView[lid], firstunk + eq, workset.n_coeff);
       }
     }
   }
@@ -676,6 +600,8 @@ evaluateFields(typename Traits::EvalData workset)
   j_coeff=workset.j_coeff;
   m_coeff=workset.m_coeff;
   n_coeff=workset.n_coeff;
+  gatherTransient = workset.transientTerms && this->enableTransient;
+  gatherAcceleration = workset.accelerationTerms && this->enableAcceleration;
 
   // Get Tpetra vector view from a specific device 
   auto xT_2d = workset.xT->template getLocalView<PHX::Device>();
@@ -692,33 +618,13 @@ evaluateFields(typename Traits::EvalData workset)
   if (this->tensorRank == 2) {
     numDim = this->valTensor.dimension(2);
 
-    Kokkos::parallel_for(PHAL_GatherJacRank2_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), PHAL_GatherJacRank2_Policy(0,workset.numCells),*this);
     cudaCheckError();
-
-    if (workset.transientTerms && this->enableTransient) {
-      Kokkos::parallel_for(PHAL_GatherJacRank2_Transient_Policy(0,workset.numCells),*this);
-      cudaCheckError();
-    }
-
-    if (workset.accelerationTerms && this->enableAcceleration) {
-      Kokkos::parallel_for(PHAL_GatherJacRank2_Acceleration_Policy(0,workset.numCells),*this);
-      cudaCheckError();
-    }
   } 
 
   else if (this->tensorRank == 1) {
-    Kokkos::parallel_for(PHAL_GatherJacRank1_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), PHAL_GatherJacRank1_Policy(0,workset.numCells),*this);
     cudaCheckError();
-
-    if (workset.transientTerms && this->enableTransient) {
-      Kokkos::parallel_for(PHAL_GatherJacRank1_Transient_Policy(0,workset.numCells),*this);
-      cudaCheckError();
-    }
-
-    if (workset.accelerationTerms && this->enableAcceleration) {
-      Kokkos::parallel_for(PHAL_GatherJacRank1_Acceleration_Policy(0,workset.numCells),*this);
-      cudaCheckError();
-    }
   }
 
   else {
@@ -729,32 +635,24 @@ evaluateFields(typename Traits::EvalData workset)
     }
     d_val=val_kokkos.template view<ExecutionSpace>();
 
-    Kokkos::parallel_for(PHAL_GatherJacRank0_Policy(0,workset.numCells),*this);
-    cudaCheckError();
-
-    if (workset.transientTerms && this->enableTransient) {
-    // Get MDField views from std::vector
+    if (gatherTransient) {
       for (int i =0; i<numFields;i++) {
         //val_dot_kokkos[i]=this->val_dot[i].get_view();
         val_dot_kokkos[i]=this->val_dot[i].get_static_view();
       }
       d_val_dot=val_dot_kokkos.template view<ExecutionSpace>();
-
-      Kokkos::parallel_for(PHAL_GatherJacRank0_Transient_Policy(0,workset.numCells),*this);
-      cudaCheckError();
     }
 
-    if (workset.accelerationTerms && this->enableAcceleration) {
-    // Get MDField views from std::vector
+    if (gatherAcceleration) {
       for (int i =0; i<numFields;i++) {
         //val_dotdot_kokkos[i]=this->val_dotdot[i].get_view();
         val_dotdot_kokkos[i]=this->val_dotdot[i].get_static_view();
       }
-      d_val_dot=val_dotdot_kokkos.template view<ExecutionSpace>();
-
-      Kokkos::parallel_for(PHAL_GatherJacRank0_Acceleration_Policy(0,workset.numCells),*this);
-      cudaCheckError();
+      d_val_dotdot=val_dotdot_kokkos.template view<ExecutionSpace>();
     }
+
+    Kokkos::parallel_for(this->getName(), PHAL_GatherJacRank0_Policy(0,workset.numCells),*this);
+    cudaCheckError();
   }
 
 #ifdef ALBANY_TIMER
@@ -807,6 +705,18 @@ evaluateFields(typename Traits::EvalData workset)
   //get const (read-only) view of xT and xdotT
   Teuchos::ArrayRCP<const ST> xT_constView = xT->get1dView();
 
+  // Host views of the seed multivectors, read one row across all the
+  // directions at a time
+  typedef decltype(VxT->template getLocalView<Kokkos::HostSpace>()) MVHostView;
+  MVHostView Vx, Vxdot, Vxdotdot;
+  if (VxT != Teuchos::null)
+    Vx = VxT->template getLocalView<Kokkos::HostSpace>();
+  if (VxdotT != Teuchos::null)
+    Vxdot = VxdotT->template getLocalView<Kokkos::HostSpace>();
+  if (VxdotdotT != Teuchos::null)
+    Vxdotdot = VxdotdotT->template getLocalView<Kokkos::HostSpace>();
+  const int num_cols_x = workset.num_cols_x;
+
   Teuchos::RCP<ParamVec> params = workset.params;
   //int num_cols_tot = workset.param_offset + workset.num_cols_p;
 
@@ -820,14 +730,14 @@ evaluateFields(typename Traits::EvalData workset)
           valref = ((this->tensorRank == 2) ? (this->valTensor)(cell,node,eq/numDim,eq%numDim) :
                     (this->tensorRank == 1) ? (this->valVec)(cell,node,eq) :
                     (this->val[eq])(cell,node));
+        const LO row = nodeID(cell,node,this->offset + eq);
         if (VxT != Teuchos::null && workset.j_coeff != 0.0) {
-          valref = TanFadType(valref.size(), xT_constView[nodeID(cell,node,this->offset + eq)]);
-          for (int k=0; k<workset.num_cols_x; k++)
-            valref.fastAccessDx(k) =
-              workset.j_coeff*VxT->getData(k)[nodeID(cell,node,this->offset + eq)];
+          valref = TanFadType(valref.size(), xT_constView[row]);
+          for (int k=0; k<num_cols_x; k++)
+            valref.fastAccessDx(k) = workset.j_coeff*Vx(row,k);
         }
         else
-          valref = TanFadType(xT_constView[nodeID(cell,node,this->offset + eq)]);
+          valref = TanFadType(xT_constView[row]);
       }
    }
 
@@ -840,11 +750,11 @@ evaluateFields(typename Traits::EvalData workset)
           valref = ((this->tensorRank == 2) ? (this->valTensor_dot)(cell,node,eq/numDim,eq%numDim) :
                     (this->tensorRank == 1) ? (this->valVec_dot)(cell,node,eq) :
                     (this->val_dot[eq])(cell,node));
-          valref = TanFadType(valref.size(), xdotT_constView[nodeID(cell,node,this->offset + eq)]);
+          const LO row = nodeID(cell,node,this->offset + eq);
+          valref = TanFadType(valref.size(), xdotT_constView[row]);
           if (VxdotT != Teuchos::null && workset.m_coeff != 0.0) {
-            for (int k=0; k<workset.num_cols_x; k++)
-              valref.fastAccessDx(k) =
-                workset.m_coeff*VxdotT->getData(k)[nodeID(cell,node,this->offset + eq)];
+            for (int k=0; k<num_cols_x; k++)
+              valref.fastAccessDx(k) = workset.m_coeff*Vxdot(row,k);
           }
         }
       }
@@ -859,11 +769,11 @@ evaluateFields(typename Traits::EvalData workset)
                     (this->tensorRank == 1) ? (this->valVec_dotdot)(cell,node,eq) :
                     (this->val_dotdot[eq])(cell,node));
 
-          valref = TanFadType(valref.size(), xdotdotT_constView[nodeID(cell,node,this->offset + eq)]);
+          const LO row = nodeID(cell,node,this->offset + eq);
+          valref = TanFadType(valref.size(), xdotdotT_constView[row]);
           if (VxdotdotT != Teuchos::null && workset.n_coeff != 0.0) {
-            for (int k=0; k<workset.num_cols_x; k++)
-              valref.fastAccessDx(k) =
-                workset.n_coeff*VxdotdotT->getData(k)[nodeID(cell,node,this->offset + eq)];
+            for (int k=0; k<num_cols_x; k++)
+              valref.fastAccessDx(k) = workset.n_coeff*Vxdotdot(row,k);
           }
         }
       }
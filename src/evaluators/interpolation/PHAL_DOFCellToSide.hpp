@@ -13,6 +13,7 @@
 #include "Phalanx_MDField.hpp"
 
 #include "Albany_Layouts.hpp"
+#include "PHAL_SideSetCells.hpp"
 
 namespace PHAL {
 /** \brief Finite Element CellToSide Evaluator
@@ -38,6 +39,7 @@ public:
 private:
 
   std::string                     sideSetName;
+  SideSetCells                    sideSetCells;
   std::vector<std::vector<int> >  sideNodes;
   std::vector<int>                dims;
 
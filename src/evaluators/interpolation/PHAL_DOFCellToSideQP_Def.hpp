@@ -14,7 +14,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 DOFCellToSideQPBase<EvalT, Traits, ScalarT>::
 DOFCellToSideQPBase(const Teuchos::ParameterList& p,
                     const Teuchos::RCP<Albany::Layouts>& dl) :
-  sideSetName (p.get<std::string> ("Side Set Name"))
+  sideSetName (p.get<std::string> ("Side Set Name")),
+  sideSetCells (sideSetName)
 {
   TEUCHOS_TEST_FOR_EXCEPTION (dl->side_layouts.find(sideSetName)==dl->side_layouts.end(), std::runtime_error,
                               "Error! Layout for side set " << sideSetName << " not found.\n");
@@ -129,67 +130,99 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFCellToSideQPBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  if (workset.sideSets->find(sideSetName)==workset.sideSets->end())
+  if (!sideSetCells.update(workset))
     return;
 
-  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(sideSetName);
-  for (auto const& it_side : sideSet)
+  // Dispatch on the layout once, then sweep the sides of the workset
+  const int numSides = sideSetCells.size();
+  switch (layout)
   {
-    // Get the local data of side and cell
-    const int cell = it_side.elem_LID;
-    const int side = it_side.side_local_id;
-
-    switch (layout)
-    {
-      case CELL_SCALAR:
+    case CELL_SCALAR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
         for (int qp=0; qp<dims_side[2]; ++qp)
           val_side_qp(cell,side,qp) = val_cell(cell);
-        break;
+      }
+      break;
 
-      case CELL_VECTOR:
+    case CELL_VECTOR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
         for (int qp=0; qp<dims_side[2]; ++qp)
           for (int i=0; i<dims_side[3]; ++i)
             val_side_qp(cell,side,qp,i) = val_cell(cell,i);
-        break;
+      }
+      break;
 
-      case CELL_TENSOR:
+    case CELL_TENSOR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
         for (int qp=0; qp<dims_side[2]; ++qp)
           for (int i=0; i<dims_side[3]; ++i)
             for (int j=0; j<dims_side[4]; ++j)
               val_side_qp(cell,side,qp,i,j) = val_cell(cell,i,j);
-        break;
+      }
+      break;
 
-      case NODE_SCALAR:
+    case NODE_SCALAR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
+        const std::vector<int>& nodes = sideNodes[side];
         for (int qp=0; qp<dims_side[3]; ++qp)
         {
-          val_side_qp(cell,side,qp) = 0;
+          ScalarT sum = 0;
           for (int node=0; node<dims_side[2]; ++node)
-            val_side_qp(cell,side,qp) += val_cell(cell,sideNodes[side][node]) * BF(cell,side,node,qp);
+            sum += val_cell(cell,nodes[node]) * BF(cell,side,node,qp);
+          val_side_qp(cell,side,qp) = sum;
         }
-        break;
+      }
+      break;
 
-      case NODE_VECTOR:
+    case NODE_VECTOR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
+        const std::vector<int>& nodes = sideNodes[side];
         for (int qp=0; qp<dims_side[2]; ++qp)
           for (int i=0; i<dims_cell[3]; ++i)
           {
-            val_side_qp(cell,side,qp,i) = 0;
+            ScalarT sum = 0;
             for (int node=0; node<dims_side[2]; ++node)
-                val_side_qp(cell,side,qp,i) += val_cell(cell,sideNodes[side][node],i) * BF(cell,side,node,qp);
+              sum += val_cell(cell,nodes[node],i) * BF(cell,side,node,qp);
+            val_side_qp(cell,side,qp,i) = sum;
           }
-        break;
-      case NODE_TENSOR:
+      }
+      break;
+
+    case NODE_TENSOR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
+        const std::vector<int>& nodes = sideNodes[side];
         for (int qp=0; qp<dims_side[2]; ++qp)
           for (int i=0; i<dims_cell[3]; ++i)
             for (int j=0; j<dims_cell[4]; ++j)
             {
-              val_side_qp(cell,side,qp,i,j) = 0;
+              ScalarT sum = 0;
               for (int node=0; node<dims_cell[2]; ++node)
-                val_side_qp(cell,side,qp,i,j) += val_cell(cell,sideNodes[side][node],i,j) * BF(cell,side,node,qp);
+                sum += val_cell(cell,nodes[node],i,j) * BF(cell,side,node,qp);
+              val_side_qp(cell,side,qp,i,j) = sum;
             }
-        break;
-      default:
-        TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error, "Error! Invalid layout (this error should have happened earlier though).\n");
-    }
+      }
+      break;
+
+    default:
+      TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error, "Error! Invalid layout (this error should have happened earlier though).\n");
   }
 }
 
@@ -14,7 +14,8 @@ template<typename EvalT, typename Traits, typename ScalarT>
 DOFCellToSideBase<EvalT, Traits, ScalarT>::
 DOFCellToSideBase(const Teuchos::ParameterList& p,
                   const Teuchos::RCP<Albany::Layouts>& dl) :
-  sideSetName (p.get<std::string> ("Side Set Name"))
+  sideSetName (p.get<std::string> ("Side Set Name")),
+  sideSetCells (sideSetName)
 {
   TEUCHOS_TEST_FOR_EXCEPTION (dl->side_layouts.find(sideSetName)==dl->side_layouts.end(), std::runtime_error,
                               "Error! Layout for side set " << sideSetName << " not found.\n");
@@ -121,52 +122,81 @@ template<typename EvalT, typename Traits, typename ScalarT>
 void DOFCellToSideBase<EvalT, Traits, ScalarT>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  if (workset.sideSets->find(sideSetName)==workset.sideSets->end()) return;
+  if (!sideSetCells.update(workset)) return;
 
-  const std::vector<Albany::SideStruct>& sideSet = workset.sideSets->at(sideSetName);
-  for (auto const& it_side : sideSet)
+  // Dispatch on the layout once, then sweep the sides of the workset
+  const int numSides = sideSetCells.size();
+  switch (layout)
   {
-    // Get the local data of side and cell
-    const int cell = it_side.elem_LID;
-    const int side = it_side.side_local_id;
-
-    switch (layout)
-    {
-      case CELL_SCALAR:
+    case CELL_SCALAR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
         val_side(cell,side) = val_cell(cell);
-        break;
+      }
+      break;
 
-      case CELL_VECTOR:
+    case CELL_VECTOR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
         for (int i=0; i<dims[2]; ++i)
           val_side(cell,side,i) = val_cell(cell,i);
-        break;
+      }
+      break;
 
-      case CELL_TENSOR:
+    case CELL_TENSOR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
         for (int i=0; i<dims[2]; ++i)
           for (int j=0; j<dims[3]; ++j)
             val_side(cell,side,i,j) = val_cell(cell,i,j);
-        break;
+      }
+      break;
 
-      case NODE_SCALAR:
+    case NODE_SCALAR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
+        const std::vector<int>& nodes = sideNodes[side];
         for (int node=0; node<dims[2]; ++node)
-          val_side(cell,side,node) = val_cell(cell,sideNodes[side][node]);
-        break;
+          val_side(cell,side,node) = val_cell(cell,nodes[node]);
+      }
+      break;
 
-      case NODE_VECTOR:
-      case VERTEX_VECTOR:
+    case NODE_VECTOR:
+    case VERTEX_VECTOR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
+        const std::vector<int>& nodes = sideNodes[side];
         for (int node=0; node<dims[2]; ++node)
           for (int i=0; i<dims[3]; ++i)
-            val_side(cell,side,node,i) = val_cell(cell,sideNodes[side][node],i);
-        break;
-      case NODE_TENSOR:
+            val_side(cell,side,node,i) = val_cell(cell,nodes[node],i);
+      }
+      break;
+
+    case NODE_TENSOR:
+      for (int s=0; s<numSides; ++s)
+      {
+        const int cell = sideSetCells.cell(s);
+        const int side = sideSetCells.side(s);
+        const std::vector<int>& nodes = sideNodes[side];
         for (int node=0; node<dims[2]; ++node)
           for (int i=0; i<dims[3]; ++i)
             for (int j=0; j<dims[4]; ++j)
-              val_side(cell,side,node,i,j) = val_cell(cell,sideNodes[side][node],i,j);
-        break;
-      default:
-        TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error, "Error! Invalid layout (this error should have happened earlier though).\n");
-    }
+              val_side(cell,side,node,i,j) = val_cell(cell,nodes[node],i,j);
+      }
+      break;
+
+    default:
+      TEUCHOS_TEST_FOR_EXCEPTION (true, std::logic_error, "Error! Invalid layout (this error should have happened earlier though).\n");
   }
 }
 
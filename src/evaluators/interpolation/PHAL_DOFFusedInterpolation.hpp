@@ -0,0 +1,127 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_DOF_FUSED_INTERPOLATION_HPP
+#define PHAL_DOF_FUSED_INTERPOLATION_HPP 1
+
+#include "Phalanx_config.hpp"
+#include "Phalanx_Evaluator_WithBaseImpl.hpp"
+#include "Phalanx_Evaluator_Derived.hpp"
+#include "Phalanx_MDField.hpp"
+
+#include "Albany_Layouts.hpp"
+
+namespace PHAL {
+/** \brief Fused Finite Element Interpolation Evaluator
+
+    This evaluator interpolates several nodal scalar and vector DOFs to
+    their values and gradients at quad points, in one sweep over the basis
+    functions. It replaces one DOF(Vec)Interpolation and one
+    DOF(Vec)GradInterpolation evaluator per field, which each stream BF or
+    GradBF from memory.
+
+    The values keep the names of the nodal fields, and the gradients are
+    named with a " Gradient" suffix, as with the separate evaluators.
+*/
+
+template<typename EvalT, typename Traits, typename ScalarT>
+class DOFFusedInterpolationBase : public PHX::EvaluatorWithBaseImpl<Traits>,
+                                  public PHX::EvaluatorDerived<EvalT, Traits>
+{
+public:
+
+  DOFFusedInterpolationBase(const Teuchos::ParameterList& p,
+                            const Teuchos::RCP<Albany::Layouts>& dl);
+
+  void postRegistrationSetup(typename Traits::SetupData d,
+                             PHX::FieldManager<Traits>& vm);
+
+  void evaluateFields(typename Traits::EvalData d);
+
+protected:
+
+  typedef typename EvalT::MeshScalarT MeshScalarT;
+
+  // Input:
+  //! Values at nodes
+  std::vector<PHX::MDField<const ScalarT,Cell,Node>> val_node;
+  std::vector<PHX::MDField<const ScalarT,Cell,Node,VecDim>> vec_val_node;
+  //! Basis Functions
+  PHX::MDField<const RealType,Cell,Node,QuadPoint> BF;
+  PHX::MDField<const MeshScalarT,Cell,Node,QuadPoint,Dim> GradBF;
+
+  // Output:
+  //! Values and gradients at quadrature points
+  std::vector<PHX::MDField<ScalarT,Cell,QuadPoint>> val_qp;
+  std::vector<PHX::MDField<ScalarT,Cell,QuadPoint,Dim>> grad_val_qp;
+  std::vector<PHX::MDField<ScalarT,Cell,QuadPoint,VecDim>> vec_val_qp;
+  std::vector<PHX::MDField<ScalarT,Cell,QuadPoint,VecDim,Dim>> vec_grad_val_qp;
+
+  //! Offsets of the first DOF of each field in the solution, -1 if unknown
+  Teuchos::Array<int> offsets;
+  Teuchos::Array<int> vec_offsets;
+
+  std::size_t numNodes;
+  std::size_t numQPs;
+  std::size_t numDims;
+  std::size_t vecDim;
+};
+
+/** \brief Fast Fused Finite Element Interpolation Evaluator
+
+    Same as DOFFusedInterpolationBase, exploiting the sparsity pattern of
+    the derivatives in the Jacobian evaluation, like the FastSolution*
+    interpolation evaluators. Only valid when every field is the solution
+    or a part of it, with its offset given.
+*/
+template<typename EvalT, typename Traits, typename ScalarT>
+class FastSolutionFusedInterpolationBase : public DOFFusedInterpolationBase<EvalT, Traits, ScalarT>
+{
+public:
+
+  FastSolutionFusedInterpolationBase(const Teuchos::ParameterList& p, const Teuchos::RCP<Albany::Layouts>& dl)
+    : DOFFusedInterpolationBase<EvalT, Traits, ScalarT>(p, dl) {
+    this->setName("FastSolutionFusedInterpolationBase"+PHX::typeAsString<EvalT>());
+  };
+
+  void evaluateFields(typename Traits::EvalData d) {
+    DOFFusedInterpolationBase<EvalT, Traits, ScalarT>::evaluateFields(d);
+  }
+};
+
+//! Specialization for Jacobian evaluation taking advantage of known sparsity
+#ifndef ALBANY_MESH_DEPENDS_ON_SOLUTION
+template<typename Traits>
+class FastSolutionFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>
+  : public DOFFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>
+{
+public:
+
+  FastSolutionFusedInterpolationBase(const Teuchos::ParameterList& p,
+                                     const Teuchos::RCP<Albany::Layouts>& dl)
+    : DOFFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>(p, dl) {
+    this->setName("FastSolutionFusedInterpolationBase"+PHX::typeAsString<PHAL::AlbanyTraits::Jacobian>());
+  };
+
+  void evaluateFields(typename Traits::EvalData d);
+
+private:
+
+  typedef PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+  typedef PHAL::AlbanyTraits::Jacobian::MeshScalarT MeshScalarT;
+};
+#endif //ALBANY_MESH_DEPENDS_ON_SOLUTION
+
+// Some shortcut names
+template<typename EvalT, typename Traits>
+using DOFFusedInterpolation = DOFFusedInterpolationBase<EvalT,Traits,typename EvalT::ScalarT>;
+
+template<typename EvalT, typename Traits>
+using FastSolutionFusedInterpolation = FastSolutionFusedInterpolationBase<EvalT,Traits,typename EvalT::ScalarT>;
+
+} // Namespace PHAL
+
+#endif // PHAL_DOF_FUSED_INTERPOLATION_HPP
@@ -0,0 +1,221 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#include "Teuchos_TestForException.hpp"
+#include "Phalanx_DataLayout.hpp"
+
+namespace PHAL {
+
+  //**********************************************************************
+  template<typename EvalT, typename Traits, typename ScalarT>
+  DOFFusedInterpolationBase<EvalT, Traits, ScalarT>::
+  DOFFusedInterpolationBase(const Teuchos::ParameterList& p,
+                            const Teuchos::RCP<Albany::Layouts>& dl) :
+    BF     (p.get<std::string>  ("BF Name"), dl->node_qp_scalar),
+    GradBF (p.get<std::string>  ("Gradient BF Name"), dl->node_qp_gradient)
+  {
+    const Teuchos::Array<std::string> names =
+      p.isParameter("Scalar DOF Names") ?
+      p.get<Teuchos::Array<std::string> >("Scalar DOF Names") : Teuchos::Array<std::string>();
+    const Teuchos::Array<std::string> vec_names =
+      p.isParameter("Vector DOF Names") ?
+      p.get<Teuchos::Array<std::string> >("Vector DOF Names") : Teuchos::Array<std::string>();
+
+    offsets = p.isParameter("Scalar DOF Offsets") ?
+      p.get<Teuchos::Array<int> >("Scalar DOF Offsets") : Teuchos::Array<int>(names.size(), -1);
+    vec_offsets = p.isParameter("Vector DOF Offsets") ?
+      p.get<Teuchos::Array<int> >("Vector DOF Offsets") : Teuchos::Array<int>(vec_names.size(), -1);
+
+    TEUCHOS_TEST_FOR_EXCEPTION (offsets.size()!=names.size() || vec_offsets.size()!=vec_names.size(),
+                                Teuchos::Exceptions::InvalidParameter,
+                                "Error! There must be one offset per DOF name.\n");
+
+    for (int i=0; i<names.size(); ++i) {
+      val_node.push_back(PHX::MDField<const ScalarT,Cell,Node>(names[i], dl->node_scalar));
+      val_qp.push_back(PHX::MDField<ScalarT,Cell,QuadPoint>(names[i], dl->qp_scalar));
+      grad_val_qp.push_back(PHX::MDField<ScalarT,Cell,QuadPoint,Dim>(names[i]+" Gradient", dl->qp_gradient));
+
+      this->addDependentField(val_node[i].fieldTag());
+      this->addEvaluatedField(val_qp[i]);
+      this->addEvaluatedField(grad_val_qp[i]);
+    }
+    for (int i=0; i<vec_names.size(); ++i) {
+      vec_val_node.push_back(PHX::MDField<const ScalarT,Cell,Node,VecDim>(vec_names[i], dl->node_vector));
+      vec_val_qp.push_back(PHX::MDField<ScalarT,Cell,QuadPoint,VecDim>(vec_names[i], dl->qp_vector));
+      vec_grad_val_qp.push_back(PHX::MDField<ScalarT,Cell,QuadPoint,VecDim,Dim>(vec_names[i]+" Gradient", dl->qp_vecgradient));
+
+      this->addDependentField(vec_val_node[i].fieldTag());
+      this->addEvaluatedField(vec_val_qp[i]);
+      this->addEvaluatedField(vec_grad_val_qp[i]);
+    }
+
+    this->addDependentField(BF.fieldTag());
+    this->addDependentField(GradBF.fieldTag());
+
+    this->setName("DOFFusedInterpolationBase"+PHX::typeAsString<EvalT>());
+
+    std::vector<PHX::DataLayout::size_type> dims;
+    GradBF.fieldTag().dataLayout().dimensions(dims);
+    numNodes = dims[1];
+    numQPs   = dims[2];
+    numDims  = dims[3];
+
+    dl->node_vector->dimensions(dims);
+    vecDim   = dims[2];
+
+    TEUCHOS_TEST_FOR_EXCEPTION (numDims>3, Teuchos::Exceptions::InvalidParameter,
+                                "Error! DOFFusedInterpolation supports at most 3 dimensions.\n");
+  }
+
+  //**********************************************************************
+  template<typename EvalT, typename Traits, typename ScalarT>
+  void DOFFusedInterpolationBase<EvalT, Traits, ScalarT>::
+  postRegistrationSetup(typename Traits::SetupData d,
+                        PHX::FieldManager<Traits>& fm)
+  {
+    for (std::size_t i=0; i<val_node.size(); ++i) {
+      this->utils.setFieldData(val_node[i],fm);
+      this->utils.setFieldData(val_qp[i],fm);
+      this->utils.setFieldData(grad_val_qp[i],fm);
+    }
+    for (std::size_t i=0; i<vec_val_node.size(); ++i) {
+      this->utils.setFieldData(vec_val_node[i],fm);
+      this->utils.setFieldData(vec_val_qp[i],fm);
+      this->utils.setFieldData(vec_grad_val_qp[i],fm);
+    }
+    this->utils.setFieldData(BF,fm);
+    this->utils.setFieldData(GradBF,fm);
+  }
+
+  //**********************************************************************
+  template<typename EvalT, typename Traits, typename ScalarT>
+  void DOFFusedInterpolationBase<EvalT, Traits, ScalarT>::
+  evaluateFields(typename Traits::EvalData workset)
+  {
+    const std::size_t numFields    = val_node.size();
+    const std::size_t numVecFields = vec_val_node.size();
+
+    // Each BF/GradBF entry is loaded once and applied to all the fields
+    MeshScalarT gbf[3];
+    for (std::size_t cell=0; cell < workset.numCells; ++cell) {
+      for (std::size_t qp=0; qp < numQPs; ++qp) {
+        for (std::size_t f=0; f<numFields; ++f) {
+          val_qp[f](cell,qp) = 0.0;
+          for (std::size_t dim=0; dim<numDims; ++dim)
+            grad_val_qp[f](cell,qp,dim) = 0.0;
+        }
+        for (std::size_t f=0; f<numVecFields; ++f) {
+          for (std::size_t i=0; i<vecDim; ++i) {
+            vec_val_qp[f](cell,qp,i) = 0.0;
+            for (std::size_t dim=0; dim<numDims; ++dim)
+              vec_grad_val_qp[f](cell,qp,i,dim) = 0.0;
+          }
+        }
+
+        for (std::size_t node=0; node < numNodes; ++node) {
+          const RealType bf = BF(cell,node,qp);
+          for (std::size_t dim=0; dim<numDims; ++dim)
+            gbf[dim] = GradBF(cell,node,qp,dim);
+
+          for (std::size_t f=0; f<numFields; ++f) {
+            const ScalarT& v = val_node[f](cell,node);
+            val_qp[f](cell,qp) += v * bf;
+            for (std::size_t dim=0; dim<numDims; ++dim)
+              grad_val_qp[f](cell,qp,dim) += v * gbf[dim];
+          }
+          for (std::size_t f=0; f<numVecFields; ++f) {
+            for (std::size_t i=0; i<vecDim; ++i) {
+              const ScalarT& v = vec_val_node[f](cell,node,i);
+              vec_val_qp[f](cell,qp,i) += v * bf;
+              for (std::size_t dim=0; dim<numDims; ++dim)
+                vec_grad_val_qp[f](cell,qp,i,dim) += v * gbf[dim];
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Specialization for Jacobian evaluation taking advantage of known sparsity
+  //**********************************************************************
+#ifndef ALBANY_MESH_DEPENDS_ON_SOLUTION
+  template<typename Traits>
+  void FastSolutionFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
+  evaluateFields(typename Traits::EvalData workset)
+  {
+    // Fields that are not part of the solution have dense derivatives
+    for (int f=0; f<this->offsets.size(); ++f)
+      if (this->offsets[f]<0) {
+        DOFFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, ScalarT>::evaluateFields(workset);
+        return;
+      }
+    for (int f=0; f<this->vec_offsets.size(); ++f)
+      if (this->vec_offsets[f]<0) {
+        DOFFusedInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, ScalarT>::evaluateFields(workset);
+        return;
+      }
+
+    const std::size_t numFields    = this->val_node.size();
+    const std::size_t numVecFields = this->vec_val_node.size();
+    if (numFields+numVecFields==0) return;
+
+    const int num_dof = numFields>0 ? this->val_node[0](0,0).size() : this->vec_val_node[0](0,0,0).size();
+    const int neq = workset.wsElNodeEqID.dimension(2);
+
+    MeshScalarT gbf[3];
+    for (std::size_t cell=0; cell < workset.numCells; ++cell) {
+      for (std::size_t qp=0; qp < this->numQPs; ++qp) {
+        for (std::size_t f=0; f<numFields; ++f) {
+          this->val_qp[f](cell,qp) = ScalarT(num_dof, 0.0);
+          for (std::size_t dim=0; dim<this->numDims; ++dim)
+            this->grad_val_qp[f](cell,qp,dim) = ScalarT(num_dof, 0.0);
+        }
+        for (std::size_t f=0; f<numVecFields; ++f) {
+          for (std::size_t i=0; i<this->vecDim; ++i) {
+            this->vec_val_qp[f](cell,qp,i) = ScalarT(num_dof, 0.0);
+            for (std::size_t dim=0; dim<this->numDims; ++dim)
+              this->vec_grad_val_qp[f](cell,qp,i,dim) = ScalarT(num_dof, 0.0);
+          }
+        }
+
+        for (std::size_t node=0; node < this->numNodes; ++node) {
+          const RealType bf = this->BF(cell,node,qp);
+          for (std::size_t dim=0; dim<this->numDims; ++dim)
+            gbf[dim] = this->GradBF(cell,node,qp,dim);
+
+          for (std::size_t f=0; f<numFields; ++f) {
+            const ScalarT& v = this->val_node[f](cell,node);
+            const int k = neq*node+this->offsets[f];
+            ScalarT& val = this->val_qp[f](cell,qp);
+            val.val() += v.val() * bf;
+            val.fastAccessDx(k) += v.fastAccessDx(k) * bf;
+            for (std::size_t dim=0; dim<this->numDims; ++dim) {
+              ScalarT& grad = this->grad_val_qp[f](cell,qp,dim);
+              grad.val() += v.val() * gbf[dim];
+              grad.fastAccessDx(k) += v.fastAccessDx(k) * gbf[dim];
+            }
+          }
+          for (std::size_t f=0; f<numVecFields; ++f) {
+            for (std::size_t i=0; i<this->vecDim; ++i) {
+              const ScalarT& v = this->vec_val_node[f](cell,node,i);
+              const int k = neq*node+this->vec_offsets[f]+i;
+              ScalarT& val = this->vec_val_qp[f](cell,qp,i);
+              val.val() += v.val() * bf;
+              val.fastAccessDx(k) += v.fastAccessDx(k) * bf;
+              for (std::size_t dim=0; dim<this->numDims; ++dim) {
+                ScalarT& grad = this->vec_grad_val_qp[f](cell,qp,i,dim);
+                grad.val() += v.val() * gbf[dim];
+                grad.fastAccessDx(k) += v.fastAccessDx(k) * gbf[dim];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+#endif //ALBANY_MESH_DEPENDS_ON_SOLUTION
+
+} // Namespace PHAL
@@ -138,10 +138,10 @@ evaluateFields(typename Traits::EvalData workset)
 
   const team_policy policy(numTeams, 1, 16);
 
-   Kokkos::parallel_for(policy, *this);
+   Kokkos::parallel_for(this->getName(), policy, *this);
 
 #else
- Kokkos::parallel_for(DOFGradInterpolationBase_Residual_Policy(0,workset.numCells),*this);
+ Kokkos::parallel_for(this->getName(), DOFGradInterpolationBase_Residual_Policy(0,workset.numCells),*this);
 #endif
 
 #ifdef ALBANY_TIMER
@@ -215,7 +215,7 @@ evaluateFields(typename Traits::EvalData workset)
  num_dof = this->val_node(0,0).size();
  neq = workset.wsElNodeEqID.dimension(2);
 
- Kokkos::parallel_for(FastSolutionGradInterpolationBase_Jacobian_Policy(0,workset.numCells),*this);
+ Kokkos::parallel_for(this->getName(), FastSolutionGradInterpolationBase_Jacobian_Policy(0,workset.numCells),*this);
 
 #ifdef ALBANY_TIMER
  PHX::Device::fence();
@@ -35,7 +35,7 @@ public:
 
   void evaluateFields(typename Traits::EvalData d);
 
-private:
+protected:
 
   // Input:
   //! Values at nodes
@@ -51,6 +51,50 @@ private:
   std::size_t numQPs;
 };
 
+/** \brief Fast Finite Element Interpolation Evaluator
+
+    This evaluator interpolates nodal DOF values to quad points.
+    It is an optimized version of DOFInterpolationBase that exploits the sparsity pattern of the derivatives in the Jacobian evaluation
+    WARNING: it does not work for general fields: it works when the field to be interpolated is the solution
+             or a part (one component) of the solution
+*/
+template<typename EvalT, typename Traits, typename ScalarT>
+class FastSolutionInterpolationBase : public DOFInterpolationBase<EvalT, Traits, ScalarT>
+{
+public:
+  FastSolutionInterpolationBase(const Teuchos::ParameterList& p, const Teuchos::RCP<Albany::Layouts>& dl)
+    : DOFInterpolationBase<EvalT, Traits, ScalarT>(p, dl) {
+    this->setName("FastSolutionInterpolationBase"+PHX::typeAsString<EvalT>());
+  };
+
+  void evaluateFields(typename Traits::EvalData d) {
+    DOFInterpolationBase<EvalT, Traits, ScalarT>::evaluateFields(d);
+  }
+};
+
+#ifndef ALBANY_MESH_DEPENDS_ON_SOLUTION
+template<typename Traits>
+class FastSolutionInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>
+      : public DOFInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT> {
+
+public:
+
+  FastSolutionInterpolationBase(const Teuchos::ParameterList& p,
+                                const Teuchos::RCP<Albany::Layouts>& dl)
+    : DOFInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>(p, dl) {
+    this->setName("FastSolutionInterpolationBase"+PHX::typeAsString<PHAL::AlbanyTraits::Jacobian>());
+    offset = p.get<int>("Offset of First DOF");
+  }
+
+  void evaluateFields(typename Traits::EvalData d);
+
+private:
+
+  typedef PHAL::AlbanyTraits::Jacobian::ScalarT ScalarT;
+  std::size_t offset;
+};
+#endif //ALBANY_MESH_DEPENDS_ON_SOLUTION
+
 // Some shortcut names
 template<typename EvalT, typename Traits>
 using DOFInterpolation = DOFInterpolationBase<EvalT,Traits,typename EvalT::ScalarT>;
@@ -61,6 +105,9 @@ using DOFInterpolationMesh = DOFInterpolationBase<EvalT,Traits,typename EvalT::M
 template<typename EvalT, typename Traits>
 using DOFInterpolationParam = DOFInterpolationBase<EvalT,Traits,typename EvalT::ParamScalarT>;
 
+template<typename EvalT, typename Traits>
+using FastSolutionInterpolation = FastSolutionInterpolationBase<EvalT,Traits,typename EvalT::ScalarT>;
+
 } // Namespace PHAL
 
 #endif // PHAL_DOF_INTERPOLATION_HPP
@@ -64,5 +64,30 @@ evaluateFields(typename Traits::EvalData workset)
   }
 }
 
+//Specialization for Jacobian evaluation taking advantage of the sparsity of the derivatives
+//**********************************************************************
+#ifndef ALBANY_MESH_DEPENDS_ON_SOLUTION
+template<typename Traits>
+void FastSolutionInterpolationBase<PHAL::AlbanyTraits::Jacobian, Traits, typename PHAL::AlbanyTraits::Jacobian::ScalarT>::
+evaluateFields(typename Traits::EvalData workset)
+{
+  const int num_dof = this->val_node(0,0).size();
+  const int neq = workset.wsElNodeEqID.dimension(2);
+
+  // Each nodal value only depends on its own DOF, so only one derivative
+  // component per node is touched instead of num_dof
+  for (std::size_t cell=0; cell < workset.numCells; ++cell) {
+    for (std::size_t qp=0; qp < this->numQPs; ++qp) {
+      ScalarT& vqp = this->val_qp(cell,qp);
+      vqp = ScalarT(num_dof, this->val_node(cell, 0).val() * this->BF(cell, 0, qp));
+      vqp.fastAccessDx(offset) = this->val_node(cell, 0).fastAccessDx(offset) * this->BF(cell, 0, qp);
+      for (std::size_t node=1; node < this->numNodes; ++node) {
+        vqp.val() += this->val_node(cell, node).val() * this->BF(cell, node, qp);
+        vqp.fastAccessDx(neq*node+offset) += this->val_node(cell, node).fastAccessDx(neq*node+offset) * this->BF(cell, node, qp);
+      }
+    }
+  }
 }
+#endif //ALBANY_MESH_DEPENDS_ON_SOLUTION
 
+}
@@ -106,7 +106,7 @@ namespace PHAL {
  auto start = std::chrono::high_resolution_clock::now();
 #endif
   //Kokkos::deep_copy(grad_val_qp.get_kokkos_view(), 0.0);
-  Kokkos::parallel_for(DOFVecGradInterpolationBase_Residual_Policy(0,workset.numCells),*this);
+  Kokkos::parallel_for(this->getName(), DOFVecGradInterpolationBase_Residual_Policy(0,workset.numCells),*this);
 
 #ifdef ALBANY_TIMER
  PHX::Device::fence();
@@ -177,7 +177,7 @@ namespace PHAL {
    num_dof = this->val_node(0,0,0).size();
    neq = workset.wsElNodeEqID.dimension(2);
 
-   Kokkos::parallel_for(FastSolutionVecGradInterpolationBase_Jacobian_Policy(0,workset.numCells),*this);
+   Kokkos::parallel_for(this->getName(), FastSolutionVecGradInterpolationBase_Jacobian_Policy(0,workset.numCells),*this);
 
 #ifdef ALBANY_TIMER
   PHX::Device::fence();
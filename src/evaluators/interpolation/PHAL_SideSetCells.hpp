@@ -0,0 +1,78 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_SIDE_SET_CELLS_HPP
+#define PHAL_SIDE_SET_CELLS_HPP
+
+#include <string>
+#include <vector>
+
+#include "PHAL_AlbanyTraits.hpp"
+
+namespace PHAL {
+
+/*! \brief Flat (cell, local side) index of one side set, per workset.
+ *
+ *  The cell/side transfer evaluators (DOFCellToSide, DOFCellToSideQP,
+ *  DOFSideToCell) loop over the sides of a side set in every evaluation. This
+ *  keeps the cell and local side id of each side in two arrays per workset,
+ *  so the transfers are plain loops over them. The index of a workset is
+ *  rebuilt when its side set storage changes, e.g. after adaptation.
+ */
+class SideSetCells {
+public:
+  explicit SideSetCells (const std::string& sideSetName = "")
+    : sideSetName_(sideSetName) {}
+
+  //! Index of the workset; returns false if the workset has no such sides
+  bool update (const Workset& workset)
+  {
+    const Albany::SideSetList::const_iterator it = workset.sideSets->find(sideSetName_);
+    if (it==workset.sideSets->end() || it->second.empty())
+      return false;
+
+    const std::vector<Albany::SideStruct>& sideSet = it->second;
+    const unsigned int ws = workset.wsIndex;
+    if (ws>=entries_.size())
+      entries_.resize(ws+1);
+
+    Entry& entry = entries_[ws];
+    if (entry.src!=sideSet.data() || entry.cells.size()!=sideSet.size())
+    {
+      entry.cells.resize(sideSet.size());
+      entry.sides.resize(sideSet.size());
+      for (std::size_t i=0; i<sideSet.size(); ++i)
+      {
+        entry.cells[i] = sideSet[i].elem_LID;
+        entry.sides[i] = sideSet[i].side_local_id;
+      }
+      entry.src = sideSet.data();
+    }
+    current_ = &entry;
+    return true;
+  }
+
+  //! Number of sides, and cell and local side id of side i, of the workset
+  //! of the last successful update
+  int size () const { return current_->cells.size(); }
+  int cell (const int i) const { return current_->cells[i]; }
+  int side (const int i) const { return current_->sides[i]; }
+
+private:
+  struct Entry {
+    const Albany::SideStruct* src = nullptr;
+    std::vector<int> cells;
+    std::vector<int> sides;
+  };
+
+  std::string         sideSetName_;
+  std::vector<Entry>  entries_;
+  const Entry*        current_ = nullptr;
+};
+
+} // Namespace PHAL
+
+#endif // PHAL_SIDE_SET_CELLS_HPP
@@ -32,6 +32,24 @@ public:
 
   void evaluateFields(typename Traits::EvalData d);
 
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct AdvDiffResid_Tag{};
+  struct AdvDiffResid_AugForm1_Tag{};
+  struct AdvDiffResid_AugForm2_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, AdvDiffResid_Tag> AdvDiffResid_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, AdvDiffResid_AugForm1_Tag> AdvDiffResid_AugForm1_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, AdvDiffResid_AugForm2_Tag> AdvDiffResid_AugForm2_Policy;
+
+  //! Residual of one cell, one functor per form of the equation
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const AdvDiffResid_Tag& tag, const int& cell) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const AdvDiffResid_AugForm1_Tag& tag, const int& cell) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const AdvDiffResid_AugForm2_Tag& tag, const int& cell) const;
+
 private:
 
   typedef typename EvalT::ScalarT ScalarT;
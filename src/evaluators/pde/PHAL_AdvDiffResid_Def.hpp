@@ -100,67 +100,103 @@ postRegistrationSetup(typename Traits::SetupData d,
 
 //**********************************************************************
 template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
 void AdvDiffResid<EvalT, Traits>::
-evaluateFields(typename Traits::EvalData workset)
+operator() (const AdvDiffResid_Tag& tag, const int& cell) const
 {
-  typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
-
-  if (useAugForm == false) { //standard form of advection-diffusion equation
-    for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-      for (std::size_t node=0; node < numNodes; ++node) {
-        for (std::size_t i=0; i<vecDim; i++)  
-          Residual(cell,node,i) = 0.0;
-          for (std::size_t qp=0; qp < numQPs; ++qp) {
-            //du/dt + a*du/dx + b*du/dy - mu*delta(u) = 0
-            Residual(cell,node,0) += UDot(cell,qp,0)*wBF(cell,node,qp) + 
-                                     a*UGrad(cell,qp,0,0)*wBF(cell,node,qp) +
-                                     b*UGrad(cell,qp,0,1)*wBF(cell,node,qp) +  
-                                     mu*UGrad(cell,qp,0,0)*wGradBF(cell,node,qp,0) + 
-                                     mu*UGrad(cell,qp,0,1)*wGradBF(cell,node,qp,1); 
-          }
-       }        
-    }
+  //standard form of advection-diffusion equation
+  for (int node=0; node < numNodes; ++node)
+    for (int i=0; i < vecDim; i++)
+      Residual(cell,node,i) = 0.0;
+
+  for (int qp=0; qp < numQPs; ++qp) {
+    //du/dt + a*du/dx + b*du/dy - mu*delta(u) = 0
+    ScalarT const valTerm = UDot(cell,qp,0) + a*UGrad(cell,qp,0,0) + b*UGrad(cell,qp,0,1);
+    for (int node=0; node < numNodes; ++node)
+      Residual(cell,node,0) += valTerm*wBF(cell,node,qp) +
+                               mu*UGrad(cell,qp,0,0)*wGradBF(cell,node,qp,0) +
+                               mu*UGrad(cell,qp,0,1)*wGradBF(cell,node,qp,1);
   }
-  else { //augmented form of advection diffusion equation
-    if (formType == 1) {
-      for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-        for (std::size_t node=0; node < numNodes; ++node) {
-          for (std::size_t i=0; i<vecDim; i++)  
-            Residual(cell,node,i) = 0.0;
-            for (std::size_t qp=0; qp < numQPs; ++qp) {
-              //du/dt + (a,b).q - mu*div(q) = 0
-              Residual(cell,node,0) += UDot(cell,qp,0)*wBF(cell,node,qp) + 
-                                       a*U(cell,qp,1)*wBF(cell,node,qp) +
-                                       b*U(cell,qp,2)*wBF(cell,node,qp) +  
-                                       mu*U(cell,qp,1)*wGradBF(cell,node,qp,0) + 
-                                       mu*U(cell,qp,2)*wGradBF(cell,node,qp,1);
-              //q - grad(u) = 0 
-              Residual(cell,node,1) += U(cell,qp,1)*wBF(cell,node,qp) - UGrad(cell,qp,0,0)*wBF(cell,node,qp); 
-              Residual(cell,node,2) += U(cell,qp,2)*wBF(cell,node,qp) - UGrad(cell,qp,0,1)*wBF(cell,node,qp); 
-            }
-          }        
-       }
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void AdvDiffResid<EvalT, Traits>::
+operator() (const AdvDiffResid_AugForm1_Tag& tag, const int& cell) const
+{
+  for (int node=0; node < numNodes; ++node)
+    for (int i=0; i < vecDim; i++)
+      Residual(cell,node,i) = 0.0;
+
+  for (int qp=0; qp < numQPs; ++qp) {
+    //du/dt + (a,b).q - mu*div(q) = 0
+    ScalarT const valTerm0 = UDot(cell,qp,0) + a*U(cell,qp,1) + b*U(cell,qp,2);
+    //q - grad(u) = 0
+    ScalarT const valTerm1 = U(cell,qp,1) - UGrad(cell,qp,0,0);
+    ScalarT const valTerm2 = U(cell,qp,2) - UGrad(cell,qp,0,1);
+    for (int node=0; node < numNodes; ++node) {
+      Residual(cell,node,0) += valTerm0*wBF(cell,node,qp) +
+                               mu*U(cell,qp,1)*wGradBF(cell,node,qp,0) +
+                               mu*U(cell,qp,2)*wGradBF(cell,node,qp,1);
+      Residual(cell,node,1) += valTerm1*wBF(cell,node,qp);
+      Residual(cell,node,2) += valTerm2*wBF(cell,node,qp);
     }
-    else if (formType == 2) { 
-      for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-        for (std::size_t node=0; node < numNodes; ++node) {
-          for (std::size_t i=0; i<vecDim; i++)  
-            Residual(cell,node,i) = 0.0;
-            for (std::size_t qp=0; qp < numQPs; ++qp) {
-              //du/dt + q = 0
-              Residual(cell,node,0) += UDot(cell,qp,0)*wBF(cell,node,qp) + 
-                                       U(cell,qp,1)*wBF(cell,node,qp) +
-                                       U(cell,qp,2)*wBF(cell,node,qp);
-              //q - (a,b).grad(u) + mu*delta(u) = 0
-              Residual(cell,node,1) += U(cell,qp,1)*wBF(cell,node,qp) - a*UGrad(cell,qp,0,0)*wBF(cell,node,qp) 
-                                    -  mu*UGrad(cell,qp,0,0)*wGradBF(cell,node,qp,0); 
-              Residual(cell,node,2) += U(cell,qp,2)*wBF(cell,node,qp) - b*UGrad(cell,qp,0,1)*wBF(cell,node,qp) 
-                                    -  mu*UGrad(cell,qp,0,1)*wGradBF(cell,node,qp,1);
-            }
-          }        
-        }
-      }
+  }
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void AdvDiffResid<EvalT, Traits>::
+operator() (const AdvDiffResid_AugForm2_Tag& tag, const int& cell) const
+{
+  for (int node=0; node < numNodes; ++node)
+    for (int i=0; i < vecDim; i++)
+      Residual(cell,node,i) = 0.0;
+
+  for (int qp=0; qp < numQPs; ++qp) {
+    //du/dt + q = 0
+    ScalarT const valTerm0 = UDot(cell,qp,0) + U(cell,qp,1) + U(cell,qp,2);
+    //q - (a,b).grad(u) + mu*delta(u) = 0
+    ScalarT const valTerm1 = U(cell,qp,1) - a*UGrad(cell,qp,0,0);
+    ScalarT const valTerm2 = U(cell,qp,2) - b*UGrad(cell,qp,0,1);
+    for (int node=0; node < numNodes; ++node) {
+      Residual(cell,node,0) += valTerm0*wBF(cell,node,qp);
+      Residual(cell,node,1) += valTerm1*wBF(cell,node,qp)
+                            -  mu*UGrad(cell,qp,0,0)*wGradBF(cell,node,qp,0);
+      Residual(cell,node,2) += valTerm2*wBF(cell,node,qp)
+                            -  mu*UGrad(cell,qp,0,1)*wGradBF(cell,node,qp,1);
     }
+  }
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void AdvDiffResid<EvalT, Traits>::
+evaluateFields(typename Traits::EvalData workset)
+{
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  if (useAugForm == false) {
+    for (int cell=0; cell < workset.numCells; ++cell)
+      (*this)(AdvDiffResid_Tag(), cell);
+  }
+  else if (formType == 1) {
+    for (int cell=0; cell < workset.numCells; ++cell)
+      (*this)(AdvDiffResid_AugForm1_Tag(), cell);
+  }
+  else if (formType == 2) {
+    for (int cell=0; cell < workset.numCells; ++cell)
+      (*this)(AdvDiffResid_AugForm2_Tag(), cell);
+  }
+#else
+  if (useAugForm == false)
+    Kokkos::parallel_for(this->getName(), AdvDiffResid_Policy(0, workset.numCells), *this);
+  else if (formType == 1)
+    Kokkos::parallel_for(this->getName(), AdvDiffResid_AugForm1_Policy(0, workset.numCells), *this);
+  else if (formType == 2)
+    Kokkos::parallel_for(this->getName(), AdvDiffResid_AugForm2_Policy(0, workset.numCells), *this);
+#endif
 }
 
 //**********************************************************************
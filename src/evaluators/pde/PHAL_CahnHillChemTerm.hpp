@@ -36,6 +36,13 @@ public:
 
   ScalarT& getValue(const std::string &n);
 
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct CahnHillChemTerm_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, CahnHillChemTerm_Tag> CahnHillChemTerm_Policy;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const CahnHillChemTerm_Tag& tag, const int& cell) const;
+
 
 private:
  
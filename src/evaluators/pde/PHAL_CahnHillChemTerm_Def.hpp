@@ -11,7 +11,7 @@
 
 
 template<typename ScalarT>
-inline ScalarT Sqr (const ScalarT& num) {
+KOKKOS_INLINE_FUNCTION ScalarT Sqr (const ScalarT& num) {
   return num * num;
 }
 
@@ -63,19 +63,32 @@ postRegistrationSetup(typename Traits::SetupData d,
 
 //**********************************************************************
 template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
 void CahnHillChemTerm<EvalT, Traits>::
-evaluateFields(typename Traits::EvalData workset)
+operator() (const CahnHillChemTerm_Tag& tag, const int& cell) const
 {
 
 // Equations 1.1 and 2.2 in Garcke, Rumpf, and Weikard
 // psi(rho) = 0.25 * (rho^2 - b^2)^2
 
-  for (std::size_t cell=0; cell < workset.numCells; ++cell) 
-    for (std::size_t qp=0; qp < numQPs; ++qp)
+  for (int qp=0; qp < numQPs; ++qp)
+
+    // chemTerm(cell, qp) = 0.25 * Sqr(Sqr(rho(cell, qp)) - Sqr(b)) - w(cell, qp);
+    chemTerm(cell, qp) = ( Sqr<ScalarT>(rho(cell, qp)) - Sqr<ScalarT>(b) ) * rho(cell, qp) - w(cell, qp);
 
-      // chemTerm(cell, qp) = 0.25 * Sqr(Sqr(rho(cell, qp)) - Sqr(b)) - w(cell, qp);
-      chemTerm(cell, qp) = ( Sqr<ScalarT>(rho(cell, qp)) - Sqr<ScalarT>(b) ) * rho(cell, qp) - w(cell, qp);
+}
 
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void CahnHillChemTerm<EvalT, Traits>::
+evaluateFields(typename Traits::EvalData workset)
+{
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  for (int cell=0; cell < workset.numCells; ++cell)
+    (*this)(CahnHillChemTerm_Tag(), cell);
+#else
+  Kokkos::parallel_for(this->getName(), CahnHillChemTerm_Policy(0, workset.numCells), *this);
+#endif
 }
 
 template<typename EvalT, typename Traits>
@@ -35,6 +35,14 @@ public:
 
   void evaluateFields(typename Traits::EvalData d);
 
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct CahnHillRhoResid_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, CahnHillRhoResid_Tag> CahnHillRhoResid_Policy;
+
+  //! Residual of one cell, in a single pass over its QPs
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const CahnHillRhoResid_Tag& tag, const int& cell) const;
+
   ScalarT& getValue(const std::string &n);
 
 private:
@@ -52,8 +60,6 @@ private:
   // Output:
   PHX::MDField<ScalarT,Cell,Node> rhoResidual;
 
-  Kokkos::DynRankView<ScalarT, PHX::Device> gamma_term;
-
   unsigned int numQPs, numDims, numNodes, worksetSize;
 
   ScalarT gamma;
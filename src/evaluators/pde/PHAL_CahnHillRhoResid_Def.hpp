@@ -71,35 +71,51 @@ postRegistrationSetup(typename Traits::SetupData d,
 
   this->utils.setFieldData(rhoResidual,fm);
 
-  gamma_term = Kokkos::createDynRankView(rhoGrad.get_view(), "XXX", worksetSize, numQPs, numDims);
-
 }
 
 //**********************************************************************
 template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
 void CahnHillRhoResid<EvalT, Traits>::
-evaluateFields(typename Traits::EvalData workset)
+operator() (const CahnHillRhoResid_Tag& tag, const int& cell) const
 {
 
 // Form Equation 2.2
 
-  typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
-
-  for (std::size_t cell=0; cell < workset.numCells; ++cell) 
-    for (std::size_t qp=0; qp < numQPs; ++qp) 
-      for (std::size_t i=0; i < numDims; ++i) 
+// The sources are summed once per QP and contracted with wBF in the same
+// pass as the gradient term, instead of one integrate per term.
 
-        gamma_term(cell, qp, i) = rhoGrad(cell,qp,i) * gamma; 
+  for (std::size_t node=0; node < numNodes; ++node)
+    rhoResidual(cell, node) = 0.0;
 
-  FST::integrate(rhoResidual.get_view(), gamma_term, wGradBF.get_view(), false); // "false" overwrites
+  for (std::size_t qp=0; qp < numQPs; ++qp) {
 
-  FST::integrate(rhoResidual.get_view(), chemTerm.get_view(), wBF.get_view(), true); // "true" sums into
+    ScalarT source = chemTerm(cell, qp);
+    if(haveNoise)
+      source += noiseTerm(cell, qp);
 
-  if(haveNoise)
+    for (std::size_t node=0; node < numNodes; ++node) {
+      ScalarT gradTerm = rhoGrad(cell, qp, 0) * wGradBF(cell, node, qp, 0);
+      for (std::size_t i=1; i < numDims; ++i)
+        gradTerm += rhoGrad(cell, qp, i) * wGradBF(cell, node, qp, i);
 
-    FST::integrate(rhoResidual.get_view(), noiseTerm.get_view(), wBF.get_view(), true); // "true" sums into
+      rhoResidual(cell, node) += gamma * gradTerm + source * wBF(cell, node, qp);
+    }
+  }
 
+}
 
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void CahnHillRhoResid<EvalT, Traits>::
+evaluateFields(typename Traits::EvalData workset)
+{
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  for (int cell=0; cell < workset.numCells; ++cell)
+    (*this)(CahnHillRhoResid_Tag(), cell);
+#else
+  Kokkos::parallel_for(this->getName(), CahnHillRhoResid_Policy(0, workset.numCells), *this);
+#endif
 }
 
 template<typename EvalT, typename Traits>
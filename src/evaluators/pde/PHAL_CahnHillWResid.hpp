@@ -33,6 +33,14 @@ public:
 
   void evaluateFields(typename Traits::EvalData d);
 
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct CahnHillWResid_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, CahnHillWResid_Tag> CahnHillWResid_Policy;
+
+  //! Residual of one cell, in a single pass over its QPs
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const CahnHillWResid_Tag& tag, const int& cell) const;
+
 private:
 
   typedef typename EvalT::ScalarT ScalarT;
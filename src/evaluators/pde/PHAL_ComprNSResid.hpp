@@ -32,6 +32,19 @@ public:
 
   void evaluateFields(typename Traits::EvalData d);
 
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct ComprNSResid_2D_Tag{};
+  struct ComprNSResid_3D_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, ComprNSResid_2D_Tag> ComprNSResid_2D_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, ComprNSResid_3D_Tag> ComprNSResid_3D_Policy;
+
+  //! Residual of one cell
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const ComprNSResid_2D_Tag& tag, const int& cell) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const ComprNSResid_3D_Tag& tag, const int& cell) const;
+
 private:
 
   typedef typename EvalT::ScalarT ScalarT;
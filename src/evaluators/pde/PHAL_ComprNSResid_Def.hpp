@@ -131,70 +131,93 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(Residual,fm);
 }
 
+//**********************************************************************
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void ComprNSResid<EvalT, Traits>::
+operator() (const ComprNSResid_2D_Tag& tag, const int& cell) const
+{
+  //2D case; order of variables is rho, u, v, T
+  for (int node=0; node < numNodes; ++node) {
+    for (int i=0; i<vecDim; i++)
+       Residual(cell,node,i) = 0.0;
+    for (int qp=0; qp < numQPs; ++qp) {
+       Residual(cell,node,0) = qFluctDot(cell,qp,0)*wBF(cell,node,qp);  //d(rho)/dt
+       for (int i=1; i < vecDim; i++) {
+          Residual(cell,node,i) = qFluct(cell,qp,0)*qFluctDot(cell,qp,i)*wBF(cell,node,qp); //rho*du_i/dt; rho*dT/dt
+       }
+    }
+    for (int qp=0; qp < numQPs; ++qp) {
+       Residual(cell, node, 0) += qFluct(cell,qp,0)*(qFluctGrad(cell,qp,1,0)+qFluctGrad(cell,qp,2,1))*wBF(cell,node,qp) //rho*div(u)
+                                + (qFluct(cell,qp,1)*qFluctGrad(cell,qp,0,0) + qFluct(cell,qp,2)*qFluctGrad(cell,qp,0,1))*wBF(cell,node,qp) //u*d(rho)/dx + v*d(rho)/dy
+                                + force(cell,qp,0)*wBF(cell,node,qp); //f0
+       Residual(cell, node, 1) += qFluct(cell,qp,0)*(qFluct(cell,qp,1)*qFluctGrad(cell,qp,1,0) + qFluct(cell,qp,2)*qFluctGrad(cell,qp,1,1))*wBF(cell,node,qp) //rho*(u*du/dx + v*du/dy)
+                                + Rgas*(qFluct(cell,qp,0)*qFluctGrad(cell,qp,3,0) + qFluct(cell,qp,3)*qFluctGrad(cell,qp,0,0))*wBF(cell,node,qp) //R*(rho*dT/dx + T*d(rho)/dx)
+                                + 1.0/Re*tau11(cell,qp)*wGradBF(cell,node,qp,0) //tau11
+                                + 1.0/Re*tau12(cell,qp)*wGradBF(cell,node,qp,1)//tau12
+                                + force(cell,qp,1)*wBF(cell,node,qp); //f1
+       Residual(cell, node, 2) += qFluct(cell,qp,0)*(qFluct(cell,qp,1)*qFluctGrad(cell,qp,2,0) + qFluct(cell,qp,2)*qFluctGrad(cell,qp,2,1))*wBF(cell,node,qp) //rho*(u*dv/dx + v*dv/dy)
+                                + Rgas*(qFluct(cell,qp,0)*qFluctGrad(cell,qp,3,1) + qFluct(cell,qp,3)*qFluctGrad(cell,qp,0,1))*wBF(cell,node,qp) //R*(rho*dT/dy + T*d(rho)/dy)
+                                + 1.0/Re*tau12(cell,qp)*wGradBF(cell,node,qp,0) //tau21
+                                + 1.0/Re*tau22(cell,qp)*wGradBF(cell,node,qp,1) //tau22
+                                + force(cell,qp,2)*wBF(cell,node,qp); //f2
+       Residual(cell, node, 3) += qFluct(cell,qp,0)*(qFluct(cell,qp,1)*qFluctGrad(cell,qp,3,0) + qFluct(cell,qp,2)*qFluctGrad(cell,qp,3,1) //rho*(u*dT/dx + v*dT/dy)
+                                + (gamma_gas - 1.0)*qFluct(cell,qp,3)*(qFluctGrad(cell,qp,1,0) + qFluctGrad(cell,qp,2,1)))*wBF(cell,node,qp) //(gamma-1)*T*div(u)
+                                - (gamma_gas - 1.0)/Rgas*qFluctGrad(cell,qp,1,0)*1.0/Re*tau11(cell,qp)*wBF(cell,node,qp) //-(gamma-1)/R*du/dx*tau11
+                                - (gamma_gas - 1.0)/Rgas*1.0/Re*qFluctGrad(cell,qp,2,0)*tau12(cell,qp)*wBF(cell,node,qp) //-(gamma-1)/R*(dv/dx*tau12)
+                                - (gamma_gas - 1.0)/Rgas*1.0/Re*qFluctGrad(cell,qp,1,1)*tau12(cell,qp)*wBF(cell,node,qp) //-(gamma-1)/R*(du/dy*tau12)
+                                - (gamma_gas - 1.0)/Rgas*qFluctGrad(cell,qp,2,1)*1.0/Re*tau22(cell,qp)*wBF(cell,node,qp) // -(gamma-1)/R*dv/dy*tau22
+                                + gamma_gas*kappa(cell,qp)/(Pr*Re)*(qFluctGrad(cell,qp,3,0)*wGradBF(cell,node,qp,0) + qFluctGrad(cell,qp,3,1)*wGradBF(cell,node,qp,1)) //gamma*kappa/(Pr*Re)*(Delta T)
+                                + force(cell,qp,3)*wBF(cell,node,qp);  //f3
+    }
+  }
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void ComprNSResid<EvalT, Traits>::
+operator() (const ComprNSResid_3D_Tag& tag, const int& cell) const
+{
+  //3D case - TO IMPLEMENT
+  for (int node=0; node < numNodes; ++node) {
+    for (int i=0; i<vecDim; i++)
+       Residual(cell,node,i) = 0.0;
+    for (int qp=0; qp < numQPs; ++qp) {
+       for (int i=0; i < vecDim; i++) {
+          Residual(cell,node,i) = qFluctDot(cell,qp,i)*wBF(cell,node,qp);
+       }
+    }
+    for (int qp=0; qp < numQPs; ++qp) {
+       Residual(cell, node, 0) += 0.0;
+       Residual(cell, node, 1) += 0.0;
+       Residual(cell, node, 2) += 0.0;
+       Residual(cell, node, 3) += 0.0;
+       Residual(cell, node, 4) += 0.0;
+    }
+  }
+}
+
 //**********************************************************************
 template<typename EvalT, typename Traits>
 void ComprNSResid<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
-
-  if (numDims == 2) { //2D case; order of variables is rho, u, v, T
-      for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-        for (std::size_t node=0; node < numNodes; ++node) {
-          for (std::size_t i=0; i<vecDim; i++) 
-             Residual(cell,node,i) = 0.0; 
-          for (std::size_t qp=0; qp < numQPs; ++qp) {
-             Residual(cell,node,0) = qFluctDot(cell,qp,0)*wBF(cell,node,qp);  //d(rho)/dt
-             for (std::size_t i=1; i < vecDim; i++) {
-                Residual(cell,node,i) = qFluct(cell,qp,0)*qFluctDot(cell,qp,i)*wBF(cell,node,qp); //rho*du_i/dt; rho*dT/dt 
-             }
-          }
-          for (std::size_t qp=0; qp < numQPs; ++qp) {
-             Residual(cell, node, 0) += qFluct(cell,qp,0)*(qFluctGrad(cell,qp,1,0)+qFluctGrad(cell,qp,2,1))*wBF(cell,node,qp) //rho*div(u)
-                                      + (qFluct(cell,qp,1)*qFluctGrad(cell,qp,0,0) + qFluct(cell,qp,2)*qFluctGrad(cell,qp,0,1))*wBF(cell,node,qp) //u*d(rho)/dx + v*d(rho)/dy  
-                                      + force(cell,qp,0)*wBF(cell,node,qp); //f0
-             Residual(cell, node, 1) += qFluct(cell,qp,0)*(qFluct(cell,qp,1)*qFluctGrad(cell,qp,1,0) + qFluct(cell,qp,2)*qFluctGrad(cell,qp,1,1))*wBF(cell,node,qp) //rho*(u*du/dx + v*du/dy)
-                                      + Rgas*(qFluct(cell,qp,0)*qFluctGrad(cell,qp,3,0) + qFluct(cell,qp,3)*qFluctGrad(cell,qp,0,0))*wBF(cell,node,qp) //R*(rho*dT/dx + T*d(rho)/dx) 
-                                      + 1.0/Re*tau11(cell,qp)*wGradBF(cell,node,qp,0) //tau11
-                                      + 1.0/Re*tau12(cell,qp)*wGradBF(cell,node,qp,1)//tau12
-                                      + force(cell,qp,1)*wBF(cell,node,qp); //f1
-             Residual(cell, node, 2) += qFluct(cell,qp,0)*(qFluct(cell,qp,1)*qFluctGrad(cell,qp,2,0) + qFluct(cell,qp,2)*qFluctGrad(cell,qp,2,1))*wBF(cell,node,qp) //rho*(u*dv/dx + v*dv/dy)
-                                      + Rgas*(qFluct(cell,qp,0)*qFluctGrad(cell,qp,3,1) + qFluct(cell,qp,3)*qFluctGrad(cell,qp,0,1))*wBF(cell,node,qp) //R*(rho*dT/dy + T*d(rho)/dy)
-                                      + 1.0/Re*tau12(cell,qp)*wGradBF(cell,node,qp,0) //tau21
-                                      + 1.0/Re*tau22(cell,qp)*wGradBF(cell,node,qp,1) //tau22
-                                      + force(cell,qp,2)*wBF(cell,node,qp); //f2
-             Residual(cell, node, 3) += qFluct(cell,qp,0)*(qFluct(cell,qp,1)*qFluctGrad(cell,qp,3,0) + qFluct(cell,qp,2)*qFluctGrad(cell,qp,3,1) //rho*(u*dT/dx + v*dT/dy) 
-                                      + (gamma_gas - 1.0)*qFluct(cell,qp,3)*(qFluctGrad(cell,qp,1,0) + qFluctGrad(cell,qp,2,1)))*wBF(cell,node,qp) //(gamma-1)*T*div(u)
-                                      - (gamma_gas - 1.0)/Rgas*qFluctGrad(cell,qp,1,0)*1.0/Re*tau11(cell,qp)*wBF(cell,node,qp) //-(gamma-1)/R*du/dx*tau11 
-                                      - (gamma_gas - 1.0)/Rgas*1.0/Re*qFluctGrad(cell,qp,2,0)*tau12(cell,qp)*wBF(cell,node,qp) //-(gamma-1)/R*(dv/dx*tau12)
-                                      - (gamma_gas - 1.0)/Rgas*1.0/Re*qFluctGrad(cell,qp,1,1)*tau12(cell,qp)*wBF(cell,node,qp) //-(gamma-1)/R*(du/dy*tau12)
-                                      - (gamma_gas - 1.0)/Rgas*qFluctGrad(cell,qp,2,1)*1.0/Re*tau22(cell,qp)*wBF(cell,node,qp) // -(gamma-1)/R*dv/dy*tau22
-                                      + gamma_gas*kappa(cell,qp)/(Pr*Re)*(qFluctGrad(cell,qp,3,0)*wGradBF(cell,node,qp,0) + qFluctGrad(cell,qp,3,1)*wGradBF(cell,node,qp,1)) //gamma*kappa/(Pr*Re)*(Delta T)
-                                      + force(cell,qp,3)*wBF(cell,node,qp);  //f3 
-           } 
-          } 
-        }
-     }
-   else if (numDims == 3) { //3D case - TO IMPLEMENT
-      for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-        for (std::size_t node=0; node < numNodes; ++node) {
-          for (std::size_t i=0; i<vecDim; i++) 
-             Residual(cell,node,i) = 0.0; 
-          for (std::size_t qp=0; qp < numQPs; ++qp) {
-             for (std::size_t i=0; i < vecDim; i++) {
-                Residual(cell,node,i) = qFluctDot(cell,qp,i)*wBF(cell,node,qp); 
-             }
-          }
-          for (std::size_t qp=0; qp < numQPs; ++qp) {
-             Residual(cell, node, 0) += 0.0;  
-             Residual(cell, node, 1) += 0.0;  
-             Residual(cell, node, 2) += 0.0;  
-             Residual(cell, node, 3) += 0.0;  
-             Residual(cell, node, 4) += 0.0;  
-            } 
-          } 
-        }
-     }
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  if (numDims == 2) {
+    for (int cell=0; cell < workset.numCells; ++cell)
+      (*this)(ComprNSResid_2D_Tag(), cell);
+  }
+  else if (numDims == 3) {
+    for (int cell=0; cell < workset.numCells; ++cell)
+      (*this)(ComprNSResid_3D_Tag(), cell);
+  }
+#else
+  if (numDims == 2)
+    Kokkos::parallel_for(this->getName(), ComprNSResid_2D_Policy(0, workset.numCells), *this);
+  else if (numDims == 3)
+    Kokkos::parallel_for(this->getName(), ComprNSResid_3D_Policy(0, workset.numCells), *this);
+#endif
 }
 
 //**********************************************************************
@@ -34,8 +34,26 @@ public:
 
   void evaluateFields(typename Traits::EvalData d);
 
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct ComprNSViscosity_Constant_Tag{};
+  struct ComprNSViscosity_Sutherland_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, ComprNSViscosity_Constant_Tag> ComprNSViscosity_Constant_Policy;
+  typedef Kokkos::RangePolicy<ExecutionSpace, ComprNSViscosity_Sutherland_Tag> ComprNSViscosity_Sutherland_Policy;
+
+  //! Viscosities and viscous stresses of one cell, in a single pass over
+  //! its QPs
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const ComprNSViscosity_Constant_Tag& tag, const int& cell) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const ComprNSViscosity_Sutherland_Tag& tag, const int& cell) const;
 
 private:
+
+  //! 2D viscous stresses at one QP
+  KOKKOS_INLINE_FUNCTION
+  void stresses (const int cell, const int qp) const;
+
  
   typedef typename EvalT::MeshScalarT MeshScalarT;
 
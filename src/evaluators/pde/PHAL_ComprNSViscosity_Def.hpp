@@ -115,63 +115,85 @@ postRegistrationSetup(typename Traits::SetupData d,
 
 //**********************************************************************
 template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
 void ComprNSViscosity<EvalT, Traits>::
-evaluateFields(typename Traits::EvalData workset)
+stresses (const int cell, const int qp) const
+{
+  tau11(cell,qp) = mu(cell,qp)*2.0*qFluctGrad(cell,qp,1,0) + lambda(cell,qp)*(qFluctGrad(cell,qp,1,0) + qFluctGrad(cell,qp,2,1)); //mu*2*du/dx + lambda*div(u)
+  tau12(cell,qp) = mu(cell,qp)*(qFluctGrad(cell,qp,1,1) + qFluctGrad(cell,qp,2,0)); //mu*(du/dy + dv/dx)
+  tau13(cell,qp) = 0.0;
+  tau22(cell,qp) = mu(cell,qp)*2.0*qFluctGrad(cell,qp,2,1) + lambda(cell,qp)*(qFluctGrad(cell,qp,1,0) + qFluctGrad(cell,qp,2,1)); //mu*2*dv/dy + lambda*div(u)
+  tau23(cell,qp) = 0.0;
+  tau33(cell,qp) = 0.0;
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void ComprNSViscosity<EvalT, Traits>::
+operator() (const ComprNSViscosity_Constant_Tag& tag, const int& cell) const
+{
+  for (int qp=0; qp < numQPs; ++qp) {
+    mu(cell,qp) = 1.0;
+    kappa(cell,qp) = mu(cell,qp)*Cp/Pr/kapparef;
+    mu(cell,qp) = 1.0/muref; //non-dimensionalize mu
+    lambda(cell,qp) = -2.0/3.0*mu(cell,qp); //Stokes' hypothesis
+    stresses(cell, qp);
+  }
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
+void ComprNSViscosity<EvalT, Traits>::
+operator() (const ComprNSViscosity_Sutherland_Tag& tag, const int& cell) const
 {
-  //Visocisity coefficients
-  if (visc_type == CONSTANT){
-    for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-      for (std::size_t qp=0; qp < numQPs; ++qp) {
-        mu(cell,qp) = 1.0;
-        kappa(cell,qp) = mu(cell,qp)*Cp/Pr/kapparef; 
-        mu(cell,qp) = 1.0/muref; //non-dimensionalize mu 
-        lambda(cell,qp) = -2.0/3.0*mu(cell,qp); //Stokes' hypothesis 
-      }
-    }
+  for (int qp=0; qp < numQPs; ++qp) {
+    ScalarT T = qFluct(cell,qp,vecDim-1)*Tref; //temperature (dimensional)
+    mu(cell,qp) = (1.458e-6)*sqrt(T*T*T)/(T + 110.4); //mu = (1.458e-6)*T^(1/5)/(T + 110.4)
+    kappa(cell,qp) = mu(cell,qp)*Cp/Pr/kapparef;
+    mu(cell,qp) = mu(cell,qp)/muref; //non-dimensionalize mu
+    lambda(cell,qp) = -2.0/3.0*mu(cell,qp); //Stokes' hypothesis
+    stresses(cell, qp);
   }
-  else if (visc_type == SUTHERLAND){
-    for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-      for (std::size_t qp=0; qp < numQPs; ++qp) {
-        ScalarT T = qFluct(cell,qp,vecDim-1)*Tref; //temperature (dimensional)
-        mu(cell,qp) = (1.458e-6)*sqrt(T*T*T)/(T + 110.4); //mu = (1.458e-6)*T^(1/5)/(T + 110.4) 
-        kappa(cell,qp) = mu(cell,qp)*Cp/Pr/kapparef; 
-        mu(cell,qp) = mu(cell,qp)/muref; //non-dimensionalize mu 
-        lambda(cell,qp) = -2.0/3.0*mu(cell,qp); //Stokes' hypothesis
-      }
-    }
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void ComprNSViscosity<EvalT, Traits>::
+evaluateFields(typename Traits::EvalData workset)
+{
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    numDims == 3, std::logic_error,
+    "The 3D viscous stresses of ComprNSViscosity have qFluct in them with"
+    " the wrong indexing: there should be 3, not 4. Inspection does not"
+    " reveal what should be fixed. I suspect qFluct should be qFluctGrad,"
+    " but I can't be sure. I suspect there is no test coverage of this"
+    " codepath, so for now I'll do the safe thing and throw an exception.");
+
+  //Visocisity coefficients and viscous stresses
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  if (visc_type == CONSTANT) {
+    for (int cell=0; cell < workset.numCells; ++cell)
+      (*this)(ComprNSViscosity_Constant_Tag(), cell);
   }
-  //Viscous stresses
-  for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-    for (std::size_t qp=0; qp < numQPs; ++qp) {
-      tau11(cell,qp) = mu(cell,qp)*2.0*qFluctGrad(cell,qp,1,0) + lambda(cell,qp)*(qFluctGrad(cell,qp,1,0) + qFluctGrad(cell,qp,2,1)); //mu*2*du/dx + lambda*div(u) 
-      tau12(cell,qp) = mu(cell,qp)*(qFluctGrad(cell,qp,1,1) + qFluctGrad(cell,qp,2,0)); //mu*(du/dy + dv/dx)
-      tau13(cell,qp) = 0.0; 
-      tau22(cell,qp) = mu(cell,qp)*2.0*qFluctGrad(cell,qp,2,1) + lambda(cell,qp)*(qFluctGrad(cell,qp,1,0) + qFluctGrad(cell,qp,2,1)); //mu*2*dv/dy + lambda*div(u) 
-      tau23(cell,qp) = 0.0; 
-      tau33(cell,qp) = 0.0; 
-    }
+  else if (visc_type == SUTHERLAND) {
+    for (int cell=0; cell < workset.numCells; ++cell)
+      (*this)(ComprNSViscosity_Sutherland_Tag(), cell);
   }
-  if (numDims == 3) {//3D case 
-    for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-      for (std::size_t qp=0; qp < numQPs; ++qp) {
-        tau11(cell,qp) += lambda(cell,qp)*qFluctGrad(cell,qp,3,2); //+lambda*dw/dz 
-        tau13(cell,qp) += mu(cell,qp)*(qFluctGrad(cell,qp,1,2) + qFluctGrad(cell,qp,3,0)); //mu*(du/dz + dw/dx)
-        tau22(cell,qp) += lambda(cell,qp)*qFluctGrad(cell,qp,3,2); //+lambda*dw/dz 
-        tau23(cell,qp) += mu(cell,qp)*(qFluctGrad(cell,qp,2,3) + qFluctGrad(cell,qp,3,1)); //mu*(dv/dz + dw/dy)
-        TEUCHOS_TEST_FOR_EXCEPTION(
-          true, std::logic_error,
-          "This next line has qFluct in it with the wrong indexing: there"
-          " should be 3, not 4. Inspection does not reveal what should be"
-          " fixed. I suspect qFluct should be qFluctGrad, but I can't be"
-          " sure. I suspect there is no test coverage of this codepath, so"
-          " for now I'll do the safe thing and throw an exception. I also"
-          " have to inactivate the code, as it won't compile with Kokkos.");
-#if 0
-        tau33(cell,qp) += 2.0*mu(cell,qp)*qFluctGrad(cell,qp,3,2) + lambda(cell,qp)*(qFluctGrad(cell,qp,1,0) + qFluctGrad(cell,qp,2,1) + qFluct(cell,qp,3,2)); //mu*2*dw/dz + lambda*div(u) 
+#else
+  if (visc_type == CONSTANT)
+    Kokkos::parallel_for(this->getName(), ComprNSViscosity_Constant_Policy(0, workset.numCells), *this);
+  else if (visc_type == SUTHERLAND)
+    Kokkos::parallel_for(this->getName(), ComprNSViscosity_Sutherland_Policy(0, workset.numCells), *this);
 #endif
-      }
-    }
-  }
+
+  // 3D case, once the indexing above is sorted out:
+  //   tau11(cell,qp) += lambda(cell,qp)*qFluctGrad(cell,qp,3,2); //+lambda*dw/dz
+  //   tau13(cell,qp) += mu(cell,qp)*(qFluctGrad(cell,qp,1,2) + qFluctGrad(cell,qp,3,0)); //mu*(du/dz + dw/dx)
+  //   tau22(cell,qp) += lambda(cell,qp)*qFluctGrad(cell,qp,3,2); //+lambda*dw/dz
+  //   tau23(cell,qp) += mu(cell,qp)*(qFluctGrad(cell,qp,2,3) + qFluctGrad(cell,qp,3,1)); //mu*(dv/dz + dw/dy)
+  //   tau33(cell,qp) += 2.0*mu(cell,qp)*qFluctGrad(cell,qp,3,2) + lambda(cell,qp)*(qFluctGrad(cell,qp,1,0) + qFluctGrad(cell,qp,2,1) + qFluct(cell,qp,3,2)); //mu*2*dw/dz + lambda*div(u)
 }
 
 }
@@ -40,6 +40,14 @@ public:
 
   virtual ScalarT& getValue(const std::string &n) {return ksqr;};
 
+  typedef Kokkos::View<int***, PHX::Device>::execution_space ExecutionSpace;
+  struct HelmholtzResid_Tag{};
+  typedef Kokkos::RangePolicy<ExecutionSpace, HelmholtzResid_Tag> HelmholtzResid_Policy;
+
+  //! Both residuals of one cell, in a single pass over its QPs
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const HelmholtzResid_Tag& tag, const int& cell) const;
+
 private:
 
   // Input:
@@ -59,6 +67,8 @@ private:
   // Output:
   PHX::MDField<ScalarT,Cell,Node> UResidual;
   PHX::MDField<ScalarT,Cell,Node> VResidual;
+
+  int numNodes, numQPs, numDims;
 };
 }
 
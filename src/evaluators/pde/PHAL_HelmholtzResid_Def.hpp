@@ -56,6 +56,12 @@ HelmholtzResid(const Teuchos::ParameterList& p) :
 
   this->setName("HelmholtzResid" );
 
+  std::vector<PHX::DataLayout::size_type> dims;
+  wGradBF.fieldTag().dataLayout().dimensions(dims);
+  numNodes = dims[1];
+  numQPs   = dims[2];
+  numDims  = dims[3];
+
   // Add K-Squared wavelength as a Sacado-ized parameter
   Teuchos::RCP<ParamLib> paramLib =
     p.get< Teuchos::RCP<ParamLib> >("Parameter Library");
@@ -85,31 +91,49 @@ postRegistrationSetup(typename Traits::SetupData d,
 
 //**********************************************************************
 template<typename EvalT, typename Traits>
+KOKKOS_INLINE_FUNCTION
 void HelmholtzResid<EvalT, Traits>::
-evaluateFields(typename Traits::EvalData workset)
+operator() (const HelmholtzResid_Tag& tag, const int& cell) const
 {
-  typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
-  typedef Intrepid2::RealSpaceTools<PHX::Device> RST;
-
-  FST::integrate(UResidual.get_view(), UGrad.get_view(), wGradBF.get_view(), false); // "false" overwrites
-  FST::integrate(VResidual.get_view(), VGrad.get_view(), wGradBF.get_view(), false);
-
-  PHAL::scale(UResidual, -1.0);
-  PHAL::scale(VResidual, -1.0);
-
-  if (haveSource) {
-    FST::integrate(UResidual.get_view(), USource.get_view(), wBF.get_view(), true); // "true" sums into
-    FST::integrate(VResidual.get_view(), VSource.get_view(), wBF.get_view(), true);
+  for (int node=0; node < numNodes; ++node) {
+    UResidual(cell, node) = 0.0;
+    VResidual(cell, node) = 0.0;
   }
 
-  auto U_ksqr = create_copy("U_ksqr", U.get_view());
-  auto V_ksqr = create_copy("V_ksqr", V.get_view());
-
-  RST::scale(U_ksqr, U.get_view(), ksqr);
-  RST::scale(V_ksqr, V.get_view(), ksqr);
+  for (int qp=0; qp < numQPs; ++qp) {
+
+    ScalarT USrc = ksqr * U(cell, qp);
+    ScalarT VSrc = ksqr * V(cell, qp);
+    if (haveSource) {
+      USrc += USource(cell, qp);
+      VSrc += VSource(cell, qp);
+    }
+
+    for (int node=0; node < numNodes; ++node) {
+      ScalarT UGradTerm = UGrad(cell, qp, 0) * wGradBF(cell, node, qp, 0);
+      ScalarT VGradTerm = VGrad(cell, qp, 0) * wGradBF(cell, node, qp, 0);
+      for (int dim=1; dim < numDims; ++dim) {
+        UGradTerm += UGrad(cell, qp, dim) * wGradBF(cell, node, qp, dim);
+        VGradTerm += VGrad(cell, qp, dim) * wGradBF(cell, node, qp, dim);
+      }
+
+      UResidual(cell, node) += USrc * wBF(cell, node, qp) - UGradTerm;
+      VResidual(cell, node) += VSrc * wBF(cell, node, qp) - VGradTerm;
+    }
+  }
+}
 
-  FST::integrate(UResidual.get_view(), U_ksqr, wBF.get_view(), true); // "true" sums into
-  FST::integrate(VResidual.get_view(), V_ksqr, wBF.get_view(), true);
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void HelmholtzResid<EvalT, Traits>::
+evaluateFields(typename Traits::EvalData workset)
+{
+#ifndef ALBANY_KOKKOS_UNDER_DEVELOPMENT
+  for (int cell=0; cell < workset.numCells; ++cell)
+    (*this)(HelmholtzResid_Tag(), cell);
+#else
+  Kokkos::parallel_for(this->getName(), HelmholtzResid_Policy(0, workset.numCells), *this);
+#endif
 
  // Potential code for "attenuation"  (1 - 0.05i)k^2 \phi
  /*
@@ -83,30 +83,29 @@ template<typename EvalT, typename Traits>
 void NSContinuityResid<EvalT, Traits>::
 evaluateFields(typename Traits::EvalData workset)
 {
-  typedef Intrepid2::FunctionSpaceTools<PHX::Device> FST;
-
   for (std::size_t cell=0; cell < workset.numCells; ++cell) {
     for (std::size_t qp=0; qp < numQPs; ++qp) {
-      divergence(cell,qp) = 0.0;
+      ScalarT div = 0.0;
       for (std::size_t i=0; i < numDims; ++i) {
-        divergence(cell,qp) += rho(cell,qp)*VGrad(cell,qp,i,i);
+        div += VGrad(cell,qp,i,i);
       }
+      divergence(cell,qp) = rho(cell,qp)*div;
     }
-  }
-  
-  FST::integrate(CResidual.get_view(), divergence, wBF.get_view(),  
-                          false); // "false" overwrites
 
-  if (havePSPG) {
-    for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-      for (std::size_t node=0; node < numNodes; ++node) {          
-	for (std::size_t qp=0; qp < numQPs; ++qp) {               
-	  for (std::size_t j=0; j < numDims; ++j) { 
-	    CResidual(cell,node) += 
-	      rho(cell,qp)*TauM(cell,qp)*Rm(cell,qp,j)*wGradBF(cell,node,qp,j);
-	  }  
-	}    
-      }
+    // Galerkin and PSPG terms of each node in one pass
+    for (std::size_t node=0; node < numNodes; ++node) {          
+      ScalarT res = 0.0;
+      for (std::size_t qp=0; qp < numQPs; ++qp) {               
+        res += divergence(cell,qp)*wBF(cell,node,qp);
+        if (havePSPG) {
+          ScalarT rmGradBF = 0.0;
+          for (std::size_t j=0; j < numDims; ++j) { 
+            rmGradBF += Rm(cell,qp,j)*wGradBF(cell,node,qp,j);
+          }  
+          res += rho(cell,qp)*TauM(cell,qp)*rmGradBF;
+        }
+      }    
+      CResidual(cell,node) = res;
     }
   }
 
@@ -75,10 +75,11 @@ evaluateFields(typename Traits::EvalData workset)
     for (std::size_t qp=0; qp < numQPs; ++qp) {      
       for (std::size_t i=0; i < numDims; ++i) {        
         for (std::size_t j=0; j < numDims; ++j) {
-          Gc(cell,qp,i,j) = 0.0;
+          MeshScalarT gc = 0.0;
           for (std::size_t alpha=0; alpha < numDims; ++alpha) {  
-            Gc(cell,qp,i,j) += jacobian_inv(cell,qp,alpha,i)*jacobian_inv(cell,qp,alpha,j); 
+            gc += jacobian_inv(cell,qp,alpha,i)*jacobian_inv(cell,qp,alpha,j); 
           }
+          Gc(cell,qp,i,j) = gc;
         } 
       } 
     }
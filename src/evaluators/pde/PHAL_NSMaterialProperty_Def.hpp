@@ -114,6 +114,7 @@ NSMaterialProperty(Teuchos::ParameterList& p) :
 
     exp_rf_kl =
       Teuchos::rcp(new Stokhos::KL::ExponentialRandomField<RealType>(*mp_list));
+    kl_cache = Teuchos::rcp(new KLFieldCache(exp_rf_kl));
     int num_KL = exp_rf_kl->stochasticDimension();
 
     // Add KL random variables as Sacado-ized parameters
@@ -288,17 +289,14 @@ evaluateFields(typename Traits::EvalData workset)
   }
 #ifdef ALBANY_STOKHOS
   else {
-    for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-      for (std::size_t qp=0; qp < dims[1]; ++qp) {
-	for (std::size_t i=0; i<point.size(); i++)
-	  point[i] =
-	    Sacado::ScalarValue<MeshScalarT>::eval(coordVec(cell,qp,i));
-    matprop(cell,qp) = exp_rf_kl->evaluate(point, rv);
-    if (matPropType == EXP_KL_RAND_FIELD)
-       matprop(cell,qp) = std::exp(matprop(cell,qp));
+    kl_cache->evaluate(workset.wsIndex, workset.numCells, dims[1], point.size(),
+                       coordVec, rv, matprop);
+    if (matPropType == EXP_KL_RAND_FIELD) {
+      for (std::size_t cell=0; cell < workset.numCells; ++cell)
+        for (std::size_t qp=0; qp < dims[1]; ++qp)
+          matprop(cell,qp) = std::exp(matprop(cell,qp));
     }
   }
- }
 #endif
 }
 
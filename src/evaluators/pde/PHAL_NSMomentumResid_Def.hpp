@@ -103,33 +103,30 @@ evaluateFields(typename Traits::EvalData workset)
   
   for (std::size_t cell=0; cell < workset.numCells; ++cell) {
     for (std::size_t node=0; node < numNodes; ++node) {          
+      // The SUPG term does not depend on the component i
+      ScalarT supg = 0.0;
+      if (haveSUPG) {
+	for (std::size_t qp=0; qp < numQPs; ++qp) {           
+	  ScalarT rmVGradBF = 0.0;
+	  for (std::size_t j=0; j < numDims; ++j)
+	    rmVGradBF += Rm(cell,qp,j)*V(cell,qp,j)*wGradBF(cell,node,qp,j);
+	  supg += rho(cell,qp)*TauM(cell,qp)*rmVGradBF;
+	}
+      }
       for (std::size_t i=0; i<numDims; i++) {
-	MResidual(cell,node,i) = 0.0;
+	ScalarT res = supg;
 	for (std::size_t qp=0; qp < numQPs; ++qp) {
-	  MResidual(cell,node,i) += 
+	  res += 
 	    (Rm(cell, qp, i)-pGrad(cell,qp,i))*wBF(cell,node,qp) -
 	    P(cell,qp)*wGradBF(cell,node,qp,i);               
+	  ScalarT viscous = 0.0;
 	  for (std::size_t j=0; j < numDims; ++j) { 
-	    MResidual(cell,node,i) += 
-	      mu(cell,qp)*(VGrad(cell,qp,i,j)+VGrad(cell,qp,j,i))*wGradBF(cell,node,qp,j);
+	    viscous += (VGrad(cell,qp,i,j)+VGrad(cell,qp,j,i))*wGradBF(cell,node,qp,j);
 //	      mu(cell,qp)*VGrad(cell,qp,i,j)*wGradBF(cell,node,qp,j);
 	  }  
+	  res += mu(cell,qp)*viscous;
 	}
-      }
-    }
-  }
-  
-  if (haveSUPG) {
-    for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-      for (std::size_t node=0; node < numNodes; ++node) {          
-	for (std::size_t i=0; i<numDims; i++) {
-	  for (std::size_t qp=0; qp < numQPs; ++qp) {           
-	    for (std::size_t j=0; j < numDims; ++j) { 
-	      MResidual(cell,node,i) += 
-		rho(cell,qp)*TauM(cell,qp)*Rm(cell,qp,j)*V(cell,qp,j)*wGradBF(cell,node,qp,j);
-	    }  
-	  }
-	}
+	MResidual(cell,node,i) = res;
       }
     }
   }
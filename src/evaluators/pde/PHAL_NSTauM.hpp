@@ -47,7 +47,6 @@ private:
   PHX::MDField<ScalarT,Cell,Node> TauM;
 
   unsigned int numQPs, numDims, numCells;
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> normGc;
   
 };
 }
@@ -57,9 +57,6 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(mu,fm);
   
   this->utils.setFieldData(TauM,fm);
-
-  // Allocate workspace
-  normGc = Kokkos::createDynRankView(Gc.get_view(), "XXX", numCells, numQPs);
 }
 
 //**********************************************************************
@@ -69,16 +66,20 @@ evaluateFields(typename Traits::EvalData workset)
 { 
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
       for (std::size_t qp=0; qp < numQPs; ++qp) {       
-        TauM(cell,qp) = 0.0;
-        normGc(cell,qp) = 0.0;
+        // V.Gc.V and |Gc| in one sweep over Gc
+        ScalarT vGcV = 0.0;
+        MeshScalarT normGc = 0.0;
         for (std::size_t i=0; i < numDims; ++i) {
+          ScalarT gcV = 0.0;
           for (std::size_t j=0; j < numDims; ++j) {
-            TauM(cell,qp) += rho(cell,qp)*rho(cell,qp)*V(cell,qp,i)*Gc(cell,qp,i,j)*V(cell,qp,j);
-            normGc(cell,qp) += Gc(cell,qp,i,j)*Gc(cell,qp,i,j);          
+            gcV += Gc(cell,qp,i,j)*V(cell,qp,j);
+            normGc += Gc(cell,qp,i,j)*Gc(cell,qp,i,j);          
           }
+          vGcV += V(cell,qp,i)*gcV;
         }
-        TauM(cell,qp) += 12.*mu(cell,qp)*mu(cell,qp)*std::sqrt(normGc(cell,qp));
-        TauM(cell,qp) = 1./std::sqrt(TauM(cell,qp));
+        const ScalarT tau = rho(cell,qp)*rho(cell,qp)*vGcV +
+                            12.*mu(cell,qp)*mu(cell,qp)*std::sqrt(normGc);
+        TauM(cell,qp) = 1./std::sqrt(tau);
       }
     }
   
@@ -48,7 +48,6 @@ private:
   PHX::MDField<ScalarT,Cell,Node> TauT;
 
   unsigned int numQPs, numDims, numCells;
-  Kokkos::DynRankView<MeshScalarT, PHX::Device> normGc;
 
 };
 }
@@ -61,9 +61,6 @@ postRegistrationSetup(typename Traits::SetupData d,
   this->utils.setFieldData(Cp,fm);
   
   this->utils.setFieldData(TauT,fm);
-
-  // Allocate workspace
-  normGc = Kokkos::createDynRankView(Gc.get_view(), "YYY", numCells, numQPs);
 }
 
 //**********************************************************************
@@ -73,16 +70,21 @@ evaluateFields(typename Traits::EvalData workset)
 { 
     for (std::size_t cell=0; cell < workset.numCells; ++cell) {
       for (std::size_t qp=0; qp < numQPs; ++qp) {       
-        TauT(cell,qp) = 0.0;
-        normGc(cell,qp) = 0.0;
+        // V.Gc.V and |Gc| in one sweep over Gc
+        ScalarT vGcV = 0.0;
+        MeshScalarT normGc = 0.0;
         for (std::size_t i=0; i < numDims; ++i) {
+          ScalarT gcV = 0.0;
           for (std::size_t j=0; j < numDims; ++j) {
-            TauT(cell,qp) += rho(cell,qp) * Cp(cell,qp) * rho(cell,qp) * Cp(cell,qp)* V(cell,qp,i)*Gc(cell,qp,i,j)*V(cell,qp,j);
-            normGc(cell,qp) += Gc(cell,qp,i,j)*Gc(cell,qp,i,j);          
+            gcV += Gc(cell,qp,i,j)*V(cell,qp,j);
+            normGc += Gc(cell,qp,i,j)*Gc(cell,qp,i,j);          
           }
+          vGcV += V(cell,qp,i)*gcV;
         }
-        TauT(cell,qp) += 12.*ThermalCond(cell,qp)*ThermalCond(cell,qp)*std::sqrt(normGc(cell,qp));
-        TauT(cell,qp) = 1./std::sqrt(TauT(cell,qp));
+        const ScalarT rhoCp = rho(cell,qp)*Cp(cell,qp);
+        const ScalarT tau = rhoCp*rhoCp*vGcV +
+                            12.*ThermalCond(cell,qp)*ThermalCond(cell,qp)*std::sqrt(normGc);
+        TauT(cell,qp) = 1./std::sqrt(tau);
       }
     }
   
@@ -156,6 +156,7 @@ init_KL_RF(std::string &type, Teuchos::ParameterList& sublist, Teuchos::Paramete
 
     exp_rf_kl =
       Teuchos::rcp(new Stokhos::KL::ExponentialRandomField<RealType>(sublist));
+    kl_cache = Teuchos::rcp(new KLFieldCache(exp_rf_kl));
     int num_KL = exp_rf_kl->stochasticDimension();
 
     // Add KL random variables as Sacado-ized parameters
@@ -196,16 +197,12 @@ evaluateFields(typename Traits::EvalData workset)
   }
 #ifdef ALBANY_STOKHOS
   else {
-    for (std::size_t cell=0; cell < workset.numCells; ++cell) {
-      for (std::size_t qp=0; qp < numQPs; ++qp) {
-          Teuchos::Array<MeshScalarT> point(numDims);
-          for (std::size_t i=0; i<numDims; i++)
-              point[i] = Sacado::ScalarValue<MeshScalarT>::eval(coordVec(cell,qp,i));
-          if (randField == UNIFORM)
-              thermalCond(cell,qp) = exp_rf_kl->evaluate(point, rv);
-          else if (randField == LOGNORMAL)
-              thermalCond(cell,qp) = std::exp(exp_rf_kl->evaluate(point, rv));
-      }
+    kl_cache->evaluate(workset.wsIndex, workset.numCells, numQPs, numDims,
+                       coordVec, rv, thermalCond);
+    if (randField == LOGNORMAL) {
+      for (std::size_t cell=0; cell < workset.numCells; ++cell)
+        for (std::size_t qp=0; qp < numQPs; ++qp)
+          thermalCond(cell,qp) = std::exp(thermalCond(cell,qp));
     }
   }
 #endif
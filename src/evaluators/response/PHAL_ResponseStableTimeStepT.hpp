@@ -0,0 +1,67 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_RESPONSE_STABLE_TIME_STEPT_HPP
+#define PHAL_RESPONSE_STABLE_TIME_STEPT_HPP
+
+#include "PHAL_SeparableScatterScalarResponseT.hpp"
+
+namespace PHAL {
+/**
+ * \brief Response Description
+ * This response estimates the critical time step of an explicit scheme,
+ * dt = C * min_{cells} h / c, where C is the Courant number, h the cell
+ * length, taken as the cell measure to the power 1/dim, and c the largest
+ * signal speed at the quad points of the cell. c is the sum of the norm of
+ * a velocity field (flow speed) and a wave speed, which is either a QP
+ * field, a constant, or the P-wave speed of an isotropic elastic material.
+ * The local response is the time step of each cell. The estimate carries
+ * no derivatives.
+ */
+  template<typename EvalT, typename Traits>
+  class ResponseStableTimeStepT :
+    public PHAL::SeparableScatterScalarResponseT<EvalT,Traits>
+  {
+  public:
+    typedef typename EvalT::ScalarT ScalarT;
+    typedef typename EvalT::MeshScalarT MeshScalarT;
+
+    ResponseStableTimeStepT(Teuchos::ParameterList& p,
+                            const Teuchos::RCP<Albany::Layouts>& dl);
+
+    void postRegistrationSetup(typename Traits::SetupData d,
+                               PHX::FieldManager<Traits>& vm);
+
+    void preEvaluate(typename Traits::PreEvalData d);
+
+    void evaluateFields(typename Traits::EvalData d);
+
+    void postEvaluate(typename Traits::PostEvalData d);
+
+  private:
+    Teuchos::RCP<const Teuchos::ParameterList> getValidResponseParameters() const;
+
+    PHX::MDField<const MeshScalarT> weights;
+    // optional signal speed fields
+    PHX::MDField<const ScalarT> waveSpeed;
+    PHX::MDField<const ScalarT> velocity;
+    bool haveWaveSpeedField;
+    bool haveVelocityField;
+
+    std::size_t numQPs;
+    std::size_t numDims;
+    std::size_t velDims;
+
+    RealType courant;
+    // constant wave speed, added to the flow speed
+    RealType constantWaveSpeed;
+    // smallest cell time step on this rank
+    RealType localMinStep;
+  };
+
+}
+
+#endif
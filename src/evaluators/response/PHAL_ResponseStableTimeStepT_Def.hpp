@@ -0,0 +1,186 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+#include "Teuchos_TestForException.hpp"
+#include "Teuchos_CommHelpers.hpp"
+#include "PHAL_Utilities.hpp"
+#include <cmath>
+#include <limits>
+
+
+template<typename EvalT, typename Traits>
+PHAL::ResponseStableTimeStepT<EvalT, Traits>::
+ResponseStableTimeStepT(Teuchos::ParameterList& p,
+                        const Teuchos::RCP<Albany::Layouts>& dl) :
+  weights("Weights", dl->qp_scalar)
+{
+  // get and validate Response parameter list
+  Teuchos::ParameterList* plist =
+    p.get<Teuchos::ParameterList*>("Parameter List");
+  Teuchos::RCP<const Teuchos::ParameterList> reflist =
+    this->getValidResponseParameters();
+  plist->validateParameters(*reflist,0);
+
+  courant = plist->get<double>("Courant Number", 1.0);
+  TEUCHOS_TEST_FOR_EXCEPTION(courant <= 0.0, Teuchos::Exceptions::InvalidParameter,
+    "Courant Number must be positive" << std::endl);
+
+  // Wave speed: a QP field, an isotropic elastic material or a constant
+  const std::string wave_name = plist->get<std::string>("Wave Speed Field Name", "");
+  haveWaveSpeedField = !wave_name.empty();
+  constantWaveSpeed = 0.0;
+  if (plist->isParameter("Elastic Modulus")) {
+    const RealType E   = plist->get<double>("Elastic Modulus");
+    const RealType nu  = plist->get<double>("Poissons Ratio", 0.0);
+    const RealType rho = plist->get<double>("Density", 1.0);
+    TEUCHOS_TEST_FOR_EXCEPTION(E <= 0.0 || rho <= 0.0 || nu <= -1.0 || nu >= 0.5,
+      Teuchos::Exceptions::InvalidParameter,
+      "Invalid elastic constants for the stable time step" << std::endl);
+    constantWaveSpeed = std::sqrt(E*(1.0-nu)/((1.0+nu)*(1.0-2.0*nu)*rho));
+  } else {
+    constantWaveSpeed = plist->get<double>("Wave Speed", 0.0);
+  }
+
+  // Flow speed
+  const std::string vel_name = plist->get<std::string>("Velocity Field Name", "");
+  haveVelocityField = !vel_name.empty();
+
+  TEUCHOS_TEST_FOR_EXCEPTION(
+    !haveWaveSpeedField && !haveVelocityField && constantWaveSpeed <= 0.0,
+    Teuchos::Exceptions::InvalidParameter,
+    "Stable Time Step needs a wave speed, elastic constants or a velocity field" << std::endl);
+
+  std::vector<PHX::DataLayout::size_type> dims;
+  dl->qp_vector->dimensions(dims);
+  numQPs = dims[1];
+  numDims = dims[2];
+  velDims = numDims;
+
+  this->addDependentField(weights.fieldTag());
+  if (haveWaveSpeedField) {
+    waveSpeed = decltype(waveSpeed)(wave_name, dl->qp_scalar);
+    this->addDependentField(waveSpeed.fieldTag());
+  }
+  if (haveVelocityField) {
+    velocity = decltype(velocity)(vel_name, dl->qp_vector);
+    this->addDependentField(velocity.fieldTag());
+  }
+  this->setName("Response Stable Time Step"+PHX::typeAsString<EvalT>());
+
+  // Setup scatter evaluator
+  p.set("Stand-alone Evaluator", false);
+  std::string local_response_name = "Local Response Stable Time Step";
+  std::string global_response_name = "Global Response Stable Time Step";
+  PHX::Tag<ScalarT> local_response_tag(local_response_name, dl->cell_scalar);
+  PHX::Tag<ScalarT> global_response_tag(global_response_name, dl->workset_scalar);
+  p.set("Local Response Field Tag", local_response_tag);
+  p.set("Global Response Field Tag", global_response_tag);
+  PHAL::SeparableScatterScalarResponseT<EvalT,Traits>::setup(p,dl);
+}
+
+// **********************************************************************
+template<typename EvalT, typename Traits>
+void PHAL::ResponseStableTimeStepT<EvalT, Traits>::
+postRegistrationSetup(typename Traits::SetupData d,
+                      PHX::FieldManager<Traits>& fm)
+{
+  this->utils.setFieldData(weights,fm);
+  if (haveWaveSpeedField)
+    this->utils.setFieldData(waveSpeed,fm);
+  if (haveVelocityField)
+    this->utils.setFieldData(velocity,fm);
+  PHAL::SeparableScatterScalarResponseT<EvalT,Traits>::postRegistrationSetup(d,fm);
+}
+
+// **********************************************************************
+template<typename EvalT, typename Traits>
+void PHAL::ResponseStableTimeStepT<EvalT, Traits>::
+preEvaluate(typename Traits::PreEvalData workset)
+{
+  localMinStep = std::numeric_limits<RealType>::max();
+  PHAL::set(this->global_response_eval, 0.0);
+  // Do global initialization
+  PHAL::SeparableScatterScalarResponseT<EvalT,Traits>::preEvaluate(workset);
+}
+
+// **********************************************************************
+template<typename EvalT, typename Traits>
+void PHAL::ResponseStableTimeStepT<EvalT, Traits>::
+evaluateFields(typename Traits::EvalData workset)
+{
+  // Zero out local response
+  PHAL::set(this->local_response_eval, 0.0);
+
+  for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
+    RealType measure = 0.0;
+    RealType speed = 0.0;
+    for (std::size_t qp = 0; qp < numQPs; ++qp) {
+      measure += Sacado::ScalarValue<MeshScalarT>::eval(weights(cell,qp));
+
+      RealType c = constantWaveSpeed;
+      if (haveWaveSpeedField)
+        c = Sacado::ScalarValue<ScalarT>::eval(waveSpeed(cell,qp));
+      if (haveVelocityField) {
+        RealType u2 = 0.0;
+        for (std::size_t i = 0; i < velDims; ++i) {
+          const RealType u = Sacado::ScalarValue<ScalarT>::eval(velocity(cell,qp,i));
+          u2 += u*u;
+        }
+        c += std::sqrt(u2);
+      }
+      speed = std::max(speed, c);
+    }
+    if (speed <= 0.0) continue;
+
+    const RealType h = std::pow(measure, 1.0/numDims);
+    const RealType dt = courant * h / speed;
+    this->local_response_eval(cell, 0) = dt;
+    localMinStep = std::min(localMinStep, dt);
+  }
+
+  // Do any local-scattering necessary
+  PHAL::SeparableScatterScalarResponseT<EvalT, Traits>::evaluateFields(workset);
+}
+
+// **********************************************************************
+template<typename EvalT, typename Traits>
+void PHAL::ResponseStableTimeStepT<EvalT, Traits>::
+postEvaluate(typename Traits::PostEvalData workset)
+{
+  // One min-reduction of the value; the time step has no derivatives
+  RealType globalMinStep = localMinStep;
+  Teuchos::reduceAll<int, RealType>(*workset.comm, Teuchos::REDUCE_MIN,
+                                    1, &localMinStep, &globalMinStep);
+  this->global_response_eval(0) = globalMinStep;
+  PHAL::SeparableScatterScalarResponseT<EvalT,Traits>::postEvaluate(workset);
+}
+
+// **********************************************************************
+template<typename EvalT,typename Traits>
+Teuchos::RCP<const Teuchos::ParameterList>
+PHAL::ResponseStableTimeStepT<EvalT,Traits>::
+getValidResponseParameters() const
+{
+  Teuchos::RCP<Teuchos::ParameterList> validPL =
+        rcp(new Teuchos::ParameterList("Valid ResponseStableTimeStepT Params"));
+  Teuchos::RCP<const Teuchos::ParameterList> baseValidPL =
+    PHAL::SeparableScatterScalarResponseT<EvalT,Traits>::getValidResponseParameters();
+  validPL->setParameters(*baseValidPL);
+
+  validPL->set<std::string>("Name", "", "Name of response function");
+  validPL->set<int>("Phalanx Graph Visualization Detail", 0, "Make dot file to visualize phalanx graph");
+  validPL->set<double>("Courant Number", 1.0, "Safety factor on the critical time step");
+  validPL->set<std::string>("Wave Speed Field Name", "", "QP field of the wave speed");
+  validPL->set<double>("Wave Speed", 0.0, "Constant wave speed");
+  validPL->set<double>("Elastic Modulus", 0.0, "Young's modulus, for the P-wave speed");
+  validPL->set<double>("Poissons Ratio", 0.0, "Poisson's ratio, for the P-wave speed");
+  validPL->set<double>("Density", 1.0, "Density, for the P-wave speed");
+  validPL->set<std::string>("Velocity Field Name", "", "QP vector field of the flow velocity");
+
+  return validPL;
+}
+
+// **********************************************************************
+
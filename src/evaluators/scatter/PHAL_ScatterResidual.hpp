@@ -197,10 +197,29 @@ public:
   KOKKOS_INLINE_FUNCTION
   void operator() (const PHAL_ScatterJacRank2_Tag&, const int& cell) const;
 
+  void postRegistrationSetup(typename Traits::SetupData d,
+                      PHX::FieldManager<Traits>& vm);
+
 private:
   int neq, nunk, numDims;
   Tpetra_CrsMatrix::local_matrix_type JacT_kokkos;
 
+  // Per-cell scratch rows for the column ids, row ids and derivative values
+  // of one element, sized from the derivative dimension so that elements
+  // with any number of unknowns take the parallel path.
+  typedef Kokkos::View<LO**, Kokkos::LayoutRight, PHX::Device> LOScratchView;
+  typedef Kokkos::View<ST**, Kokkos::LayoutRight, PHX::Device> STScratchView;
+  LOScratchView colT_kokkos;
+  LOScratchView rowT_kokkos;
+  STScratchView vals_kokkos;
+
+  // Offsets of the element entries in the values of JacT_kokkos, used
+  // instead of the column search when the workset provides them
+  Albany::AbstractDiscretization::WorksetJacOffsets jacOffsets;
+  bool useOffsets;
+
+  void allocateScratch(const int numCells, const int numUnks);
+
   typedef ScatterResidualBase<PHAL::AlbanyTraits::Jacobian, Traits> Base;
   using Base::nodeID;
   using Base::fT_kokkos;
@@ -9,6 +9,7 @@
 #include "Teuchos_TestForException.hpp"
 #include "Phalanx_DataLayout.hpp"
 #include "Albany_Utils.hpp"
+#include "PHAL_Utilities.hpp"
 
 // **********************************************************************
 // Base Class Generic Implemtation
@@ -203,16 +204,16 @@ evaluateFields(typename Traits::EvalData workset)
     for (int i = 0; i < numFields; i++)
       val_kokkos[i] = this->val[i].get_view();
 
-    Kokkos::parallel_for(PHAL_ScatterResRank0_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), PHAL_ScatterResRank0_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
   else if (this->tensorRank == 1) {
-    Kokkos::parallel_for(PHAL_ScatterResRank1_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), PHAL_ScatterResRank1_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
   else if (this->tensorRank == 2) {
     numDims = this->valTensor.dimension(2);
-    Kokkos::parallel_for(PHAL_ScatterResRank2_Policy(0,workset.numCells),*this);
+    Kokkos::parallel_for(this->getName(), PHAL_ScatterResRank2_Policy(0,workset.numCells),*this);
     cudaCheckError();
   }
 
@@ -257,31 +258,30 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank0_Adjoint_Tag&, const int& cell) const
 {
-  //const int neq = nodeID.dimension(2);
-  //const int nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  LO colT[500];
-  LO rowT;
-  //std::vector<LO> colT(nunk);
-  //colT=(LO*) Kokkos::cuda_malloc<PHX::Device>(nunk*sizeof(LO));
-
-  if (nunk>500) Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
+  LO* colT = &colT_kokkos(cell,0);
+  LO* rowT = &rowT_kokkos(cell,0);
+  ST* vals = &vals_kokkos(cell,0);
+  const int nrow = this->numNodes*numFields;
 
   for (int node_col=0; node_col<this->numNodes; node_col++) {
     for (int eq_col=0; eq_col<neq; eq_col++) {
-      colT[neq * node_col + eq_col] =  nodeID(cell,node_col,eq_col);
+      colT[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
     }
   }
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
-      rowT = nodeID(cell,node,this->offset + eq);
-      auto valptr = val_kokkos[eq](cell,node);
-      for (int lunk=0; lunk<nunk; lunk++) {
-        ST val = valptr.fastAccessDx(lunk);
-        JacT_kokkos.sumIntoValues(colT[lunk], &rowT, 1, &val, false, true); 
-      }
+      rowT[numFields * node + eq] = nodeID(cell,node,this->offset + eq);
+    }
+  }
+
+  // Column lunk of the element block is one row of the transpose
+  for (int lunk=0; lunk<nunk; lunk++) {
+    for (int node = 0; node < this->numNodes; ++node) {
+      for (int eq = 0; eq < numFields; eq++)
+        vals[numFields * node + eq] = (val_kokkos[eq](cell,node)).fastAccessDx(lunk);
     }
+    JacT_kokkos.sumIntoValues(colT[lunk], rowT, nrow, vals, false, true);
   }
 }
 
@@ -290,19 +290,25 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank0_Tag&, const int& cell) const
 {
-  //const int neq = nodeID.dimension(2);
-  //const int nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  //colT=(LO*) Kokkos::cuda_malloc<PHX::Device>(nunk*sizeof(LO));
-  LO rowT;
-  LO colT[500];
-  ST vals[500];
-  //std::vector<LO> colT(nunk);
-  //std::vector<ST> vals(nunk);
-
-  if (nunk>500) Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
-
-  for (int node_col=0, i=0; node_col<this->numNodes; node_col++) {
+  if (useOffsets) {
+    // Add straight into the matrix values, no column search
+    for (int node = 0; node < this->numNodes; ++node) {
+      for (int eq = 0; eq < numFields; eq++) {
+        auto valptr = val_kokkos[eq](cell,node);
+        for (int lunk = 0; lunk < nunk; ++lunk) {
+          const LO off = jacOffsets(cell,node,this->offset + eq,lunk);
+          if (off >= 0)
+            Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), valptr.fastAccessDx(lunk));
+        }
+      }
+    }
+    return;
+  }
+
+  LO* colT = &colT_kokkos(cell,0);
+  ST* vals = &vals_kokkos(cell,0);
+
+  for (int node_col=0; node_col<this->numNodes; node_col++) {
     for (int eq_col=0; eq_col<neq; eq_col++) {
       colT[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
     }
@@ -310,7 +316,7 @@ operator() (const PHAL_ScatterJacRank0_Tag&, const int& cell) const
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
-      rowT = nodeID(cell,node,this->offset + eq);
+      const LO rowT = nodeID(cell,node,this->offset + eq);
       auto valptr = val_kokkos[eq](cell,node);
       for (int i = 0; i < nunk; ++i) vals[i] = valptr.fastAccessDx(i);
       JacT_kokkos.sumIntoValues(rowT, colT, nunk, vals, false, true);
@@ -335,19 +341,12 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank1_Adjoint_Tag&, const int& cell) const
 {
-  //const int neq = nodeID.dimension(2);
-  //const int nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  LO colT[500];
-  LO rowT;
-  ST vals[500];
-  //std::vector<ST> vals(nunk);
-  //std::vector<LO> colT(nunk);
-  //colT=(LO*) Kokkos::malloc<PHX::Device>(nunk*sizeof(LO));
-
-  if (nunk>500) Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
-
-  for (int node_col=0, i=0; node_col<this->numNodes; node_col++) {
+  LO* colT = &colT_kokkos(cell,0);
+  LO* rowT = &rowT_kokkos(cell,0);
+  ST* vals = &vals_kokkos(cell,0);
+  const int nrow = this->numNodes*numFields;
+
+  for (int node_col=0; node_col<this->numNodes; node_col++) {
     for (int eq_col=0; eq_col<neq; eq_col++) {
       colT[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
     }
@@ -355,14 +354,19 @@ operator() (const PHAL_ScatterJacRank1_Adjoint_Tag&, const int& cell) const
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
-      rowT = nodeID(cell,node,this->offset + eq);
-      if (((this->valVec)(cell,node,eq)).hasFastAccess()) {
-        for (int lunk=0; lunk<nunk; lunk++){
-          ST val = ((this->valVec)(cell,node,eq)).fastAccessDx(lunk);
-          JacT_kokkos.sumIntoValues(colT[lunk], &rowT, 1, &val, false, true);
-        }
-      }//has fast access
+      rowT[numFields * node + eq] = nodeID(cell,node,this->offset + eq);
+    }
+  }
+
+  // Column lunk of the element block is one row of the transpose
+  for (int lunk=0; lunk<nunk; lunk++) {
+    for (int node = 0; node < this->numNodes; ++node) {
+      for (int eq = 0; eq < numFields; eq++) {
+        auto valptr = (this->valVec)(cell,node,eq);
+        vals[numFields * node + eq] = valptr.hasFastAccess() ? valptr.fastAccessDx(lunk) : 0.0;
+      }
     }
+    JacT_kokkos.sumIntoValues(colT[lunk], rowT, nrow, vals, false, true);
   }
 }
 
@@ -371,19 +375,27 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank1_Tag&, const int& cell) const
 {
-  //const int neq = nodeID.dimension(2);
-  //const int nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  LO colT[500];
-  LO rowT;
-  ST vals[500];
-  //std::vector<LO> colT(nunk);
-  //colT=(LO*) Kokkos::malloc<PHX::Device>(nunk*sizeof(LO));
-  //std::vector<ST> vals(nunk);
-
-  if (nunk>500) Kokkos::abort ("ERROR (ScatterResidual): nunk > 500");
-
-  for (int node_col=0, i=0; node_col<this->numNodes; node_col++) {
+  if (useOffsets) {
+    // Add straight into the matrix values, no column search
+    for (int node = 0; node < this->numNodes; ++node) {
+      for (int eq = 0; eq < numFields; eq++) {
+        auto valptr = (this->valVec)(cell,node,eq);
+        if (valptr.hasFastAccess()) {
+          for (int lunk = 0; lunk < nunk; ++lunk) {
+            const LO off = jacOffsets(cell,node,this->offset + eq,lunk);
+            if (off >= 0)
+              Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), valptr.fastAccessDx(lunk));
+          }
+        }
+      }
+    }
+    return;
+  }
+
+  LO* colT = &colT_kokkos(cell,0);
+  ST* vals = &vals_kokkos(cell,0);
+
+  for (int node_col=0; node_col<this->numNodes; node_col++) {
     for (int eq_col=0; eq_col<neq; eq_col++) {
       colT[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
     }
@@ -391,9 +403,10 @@ operator() (const PHAL_ScatterJacRank1_Tag&, const int& cell) const
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
-      rowT = nodeID(cell,node,this->offset + eq);
-      if (((this->valVec)(cell,node,eq)).hasFastAccess()) {
-        for (int i = 0; i < nunk; ++i) vals[i] = (this->valVec)(cell,node,eq).fastAccessDx(i);
+      const LO rowT = nodeID(cell,node,this->offset + eq);
+      auto valptr = (this->valVec)(cell,node,eq);
+      if (valptr.hasFastAccess()) {
+        for (int i = 0; i < nunk; ++i) vals[i] = valptr.fastAccessDx(i);
         JacT_kokkos.sumIntoValues(rowT, colT, nunk, vals, false, true);
       }
     }
@@ -418,17 +431,12 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank2_Adjoint_Tag&, const int& cell) const
 {
-  //const int neq = nodeID.dimension(2);
-  //const int nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  LO colT[500];
-  LO rowT;
-  //std::vector<LO> colT(nunk);
-  //colT=(LO*) Kokkos::malloc<PHX::Device>(nunk*sizeof(LO));
-
-  if (nunk>500) Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
+  LO* colT = &colT_kokkos(cell,0);
+  LO* rowT = &rowT_kokkos(cell,0);
+  ST* vals = &vals_kokkos(cell,0);
+  const int nrow = this->numNodes*numFields;
 
-  for (int node_col=0, i=0; node_col<this->numNodes; node_col++) {
+  for (int node_col=0; node_col<this->numNodes; node_col++) {
     for (int eq_col=0; eq_col<neq; eq_col++) {
       colT[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
     }
@@ -436,15 +444,20 @@ operator() (const PHAL_ScatterJacRank2_Adjoint_Tag&, const int& cell) const
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
-      rowT = nodeID(cell,node,this->offset + eq);
-      if (((this->valTensor)(cell,node, eq/numDims, eq%numDims)).hasFastAccess()) {
-        for (int lunk=0; lunk<nunk; lunk++) {
-          ST val = ((this->valTensor)(cell,node, eq/numDims, eq%numDims)).fastAccessDx(lunk);
-          JacT_kokkos.sumIntoValues (colT[lunk], &rowT, 1, &val, false, true);
-        }
-      }//has fast access
+      rowT[numFields * node + eq] = nodeID(cell,node,this->offset + eq);
     }
   }
+
+  // Column lunk of the element block is one row of the transpose
+  for (int lunk=0; lunk<nunk; lunk++) {
+    for (int node = 0; node < this->numNodes; ++node) {
+      for (int eq = 0; eq < numFields; eq++) {
+        auto valptr = (this->valTensor)(cell,node, eq/numDims, eq%numDims);
+        vals[numFields * node + eq] = valptr.hasFastAccess() ? valptr.fastAccessDx(lunk) : 0.0;
+      }
+    }
+    JacT_kokkos.sumIntoValues(colT[lunk], rowT, nrow, vals, false, true);
+  }
 }
 
 template<typename Traits>
@@ -452,19 +465,27 @@ KOKKOS_INLINE_FUNCTION
 void ScatterResidual<PHAL::AlbanyTraits::Jacobian,Traits>::
 operator() (const PHAL_ScatterJacRank2_Tag&, const int& cell) const
 {
-  //const int neq = nodeID.dimension(2);
-  //const int nunk = neq*this->numNodes;
-  // Irina TOFIX replace 500 with nunk with Kokkos::malloc is available
-  LO colT[500];
-  LO rowT;
-  ST vals[500];
-  //std::vector<LO> colT(nunk);
-  //colT=(LO*) Kokkos::malloc<PHX::Device>(nunk*sizeof(LO));
-  //std::vector<ST> vals(nunk);
-
-  if (nunk>500) Kokkos::abort("ERROR (ScatterResidual): nunk > 500");
-
-  for (int node_col=0, i=0; node_col<this->numNodes; node_col++) {
+  if (useOffsets) {
+    // Add straight into the matrix values, no column search
+    for (int node = 0; node < this->numNodes; ++node) {
+      for (int eq = 0; eq < numFields; eq++) {
+        auto valptr = (this->valTensor)(cell,node, eq/numDims, eq%numDims);
+        if (valptr.hasFastAccess()) {
+          for (int lunk = 0; lunk < nunk; ++lunk) {
+            const LO off = jacOffsets(cell,node,this->offset + eq,lunk);
+            if (off >= 0)
+              Kokkos::atomic_fetch_add(&JacT_kokkos.values(off), valptr.fastAccessDx(lunk));
+          }
+        }
+      }
+    }
+    return;
+  }
+
+  LO* colT = &colT_kokkos(cell,0);
+  ST* vals = &vals_kokkos(cell,0);
+
+  for (int node_col=0; node_col<this->numNodes; node_col++) {
     for (int eq_col=0; eq_col<neq; eq_col++) {
       colT[neq * node_col + eq_col] = nodeID(cell,node_col,eq_col);
     }
@@ -472,14 +493,57 @@ operator() (const PHAL_ScatterJacRank2_Tag&, const int& cell) const
 
   for (int node = 0; node < this->numNodes; ++node) {
     for (int eq = 0; eq < numFields; eq++) {
-      rowT = nodeID(cell,node,this->offset + eq);
-      if (((this->valTensor)(cell,node, eq/numDims, eq%numDims)).hasFastAccess()) {
-        for (int i = 0; i < nunk; ++i) vals[i] = (this->valTensor)(cell,node, eq/numDims, eq%numDims).fastAccessDx(i);
-        JacT_kokkos.sumIntoValues(rowT, colT, nunk,  vals, false, true);
+      const LO rowT = nodeID(cell,node,this->offset + eq);
+      auto valptr = (this->valTensor)(cell,node, eq/numDims, eq%numDims);
+      if (valptr.hasFastAccess()) {
+        for (int i = 0; i < nunk; ++i) vals[i] = valptr.fastAccessDx(i);
+        JacT_kokkos.sumIntoValues(rowT, colT, nunk, vals, false, true);
       }
     }
   }
 }
+
+// **********************************************************************
+template<typename Traits>
+void ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::
+postRegistrationSetup(typename Traits::SetupData d,
+                      PHX::FieldManager<Traits>& fm)
+{
+  Base::postRegistrationSetup(d,fm);
+
+  // Size the scratch rows from the derivative dimension of the scattered
+  // field, so evaluateFields does not allocate in the common case.
+  int numCells = 0, numUnks = 0;
+  if (this->tensorRank == 0) {
+    numCells = this->val[0].dimension(0);
+    numUnks = PHAL::getDerivativeDimensionsFromView(this->val[0].get_view());
+  }
+  else if (this->tensorRank == 1) {
+    numCells = this->valVec.dimension(0);
+    numUnks = PHAL::getDerivativeDimensionsFromView(this->valVec.get_view());
+  }
+  else if (this->tensorRank == 2) {
+    numCells = this->valTensor.dimension(0);
+    numUnks = PHAL::getDerivativeDimensionsFromView(this->valTensor.get_view());
+  }
+  allocateScratch(numCells, numUnks);
+}
+
+// **********************************************************************
+template<typename Traits>
+void ScatterResidual<PHAL::AlbanyTraits::Jacobian, Traits>::
+allocateScratch(const int numCells, const int numUnks)
+{
+  const int numRows = this->numNodes*numFields;
+  if (static_cast<int>(colT_kokkos.dimension(0)) < numCells || static_cast<int>(colT_kokkos.dimension(1)) < numUnks)
+    colT_kokkos = LOScratchView("colT_kokkos", numCells, numUnks);
+  if (static_cast<int>(rowT_kokkos.dimension(0)) < numCells || static_cast<int>(rowT_kokkos.dimension(1)) < numRows)
+    rowT_kokkos = LOScratchView("rowT_kokkos", numCells, numRows);
+  // vals holds either a row (nunk entries) or a transposed row (numRows)
+  const int numVals = numUnks > numRows ? numUnks : numRows;
+  if (static_cast<int>(vals_kokkos.dimension(0)) < numCells || static_cast<int>(vals_kokkos.dimension(1)) < numVals)
+    vals_kokkos = STScratchView("vals_kokkos", numCells, numVals);
+}
 #endif
 
 // **********************************************************************
@@ -499,6 +563,12 @@ evaluateFields(typename Traits::EvalData workset)
   int numDims = 0;
   if (this->tensorRank==2) numDims = this->valTensor.dimension(2);
 
+  // Add straight into the matrix values when the element offsets are known
+  const auto& jacOffsets = workset.wsJacOffsets;
+  auto JacT_values = JacT->getLocalMatrix().values;
+  const bool useOffsets = !workset.is_adjoint && jacOffsets.size() > 0 &&
+    JacT_values.dimension(0) == JacT->getNodeNumEntries();
+
   for (std::size_t cell=0; cell < workset.numCells; ++cell ) {
     // Local Unks: Loop over nodes in element, Loop over equations per node
     for (unsigned int node_col=0, i=0; node_col<this->numNodes; node_col++){
@@ -524,6 +594,12 @@ evaluateFields(typename Traits::EvalData workset)
                 colT[lunk], Teuchos::arrayView(&rowT, 1),
                 Teuchos::arrayView(&(valptr.fastAccessDx(lunk)), 1));
           }
+          else if (useOffsets) {
+            for (unsigned int lunk = 0; lunk < nunk; lunk++) {
+              const LO off = jacOffsets(cell,node,this->offset + eq,lunk);
+              if (off >= 0) JacT_values(off) += valptr.fastAccessDx(lunk);
+            }
+          }
           else {
             // Sum Jacobian entries all at once
             JacT->sumIntoLocalValues(
@@ -545,6 +621,9 @@ evaluateFields(typename Traits::EvalData workset)
   neq = nodeID.dimension(2);
   nunk = neq*this->numNodes;
 
+  // Only grows if the workset has more unknowns than the field layout
+  allocateScratch(workset.numCells, nunk);
+
   // Get Tpetra vector view and local matrix
   const bool loadResid = Teuchos::nonnull(workset.fT);
   if (loadResid) {
@@ -552,6 +631,9 @@ evaluateFields(typename Traits::EvalData workset)
     fT_kokkos = Kokkos::subview(fT_2d, Kokkos::ALL(), 0);
   }
   JacT_kokkos = workset.JacT->getLocalMatrix();
+  jacOffsets = workset.wsJacOffsets;
+  useOffsets = !workset.is_adjoint && jacOffsets.size() > 0 &&
+    JacT_kokkos.values.dimension(0) == workset.JacT->getNodeNumEntries();
 
   if (this->tensorRank == 0) {
     // Get MDField views from std::vector
@@ -559,31 +641,31 @@ evaluateFields(typename Traits::EvalData workset)
       val_kokkos[i] = this->val[i].get_view();
 
     if (loadResid) {
-      Kokkos::parallel_for(PHAL_ScatterResRank0_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_ScatterResRank0_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
 
     if (workset.is_adjoint) {
-      Kokkos::parallel_for(PHAL_ScatterJacRank0_Adjoint_Policy(0,workset.numCells),*this);  
+      Kokkos::parallel_for(this->getName(), PHAL_ScatterJacRank0_Adjoint_Policy(0,workset.numCells),*this);  
       cudaCheckError();
     }
     else {
-      Kokkos::parallel_for(PHAL_ScatterJacRank0_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_ScatterJacRank0_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
   }
   else  if (this->tensorRank == 1) {
     if (loadResid) {
-      Kokkos::parallel_for(PHAL_ScatterResRank1_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_ScatterResRank1_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
 
     if (workset.is_adjoint) {
-      Kokkos::parallel_for(PHAL_ScatterJacRank1_Adjoint_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_ScatterJacRank1_Adjoint_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
     else {
-      Kokkos::parallel_for(PHAL_ScatterJacRank1_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_ScatterJacRank1_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
   }
@@ -591,15 +673,15 @@ evaluateFields(typename Traits::EvalData workset)
     numDims = this->valTensor.dimension(2);
 
     if (loadResid) {
-      Kokkos::parallel_for(PHAL_ScatterResRank2_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_ScatterResRank2_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
 
     if (workset.is_adjoint) {
-      Kokkos::parallel_for(PHAL_ScatterJacRank2_Adjoint_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_ScatterJacRank2_Adjoint_Policy(0,workset.numCells),*this);
     }
     else {
-      Kokkos::parallel_for(PHAL_ScatterJacRank2_Policy(0,workset.numCells),*this);
+      Kokkos::parallel_for(this->getName(), PHAL_ScatterJacRank2_Policy(0,workset.numCells),*this);
       cudaCheckError();
     }
   }
@@ -640,6 +722,22 @@ evaluateFields(typename Traits::EvalData workset)
   int numDims = 0;
   if (this->tensorRank == 2) numDims = this->valTensor.dimension(2);
 
+  // Host views of the tangent multivectors, summed into one row across all
+  // the directions at a time
+  typedef decltype(JVT->template getLocalView<Kokkos::HostSpace>()) MVHostView;
+  MVHostView JV, fp;
+  if (Teuchos::nonnull (JVT)) {
+    JVT->template modify<Kokkos::HostSpace>();
+    JV = JVT->template getLocalView<Kokkos::HostSpace>();
+  }
+  if (Teuchos::nonnull (fpT)) {
+    fpT->template modify<Kokkos::HostSpace>();
+    fp = fpT->template getLocalView<Kokkos::HostSpace>();
+  }
+  const int num_cols_x = workset.num_cols_x;
+  const int num_cols_p = workset.num_cols_p;
+  const int param_offset = workset.param_offset;
+
   for (std::size_t cell = 0; cell < workset.numCells; ++cell ) {
     for (std::size_t node = 0; node < this->numNodes; ++node) {
       for (std::size_t eq = 0; eq < numFields; eq++) {
@@ -654,12 +752,12 @@ evaluateFields(typename Traits::EvalData workset)
           fT->sumIntoLocalValue (row, valref.val ());
 
         if (Teuchos::nonnull (JVT))
-          for (int col = 0; col < workset.num_cols_x; col++)
-            JVT->sumIntoLocalValue (row, col, valref.dx (col));
+          for (int col = 0; col < num_cols_x; col++)
+            JV (row, col) += valref.dx (col);
 
         if (Teuchos::nonnull (fpT))
-          for (int col = 0; col < workset.num_cols_p; col++)
-            fpT->sumIntoLocalValue (row, col, valref.dx (col + workset.param_offset));
+          for (int col = 0; col < num_cols_p; col++)
+            fp (row, col) += valref.dx (col + param_offset);
       }
     }
   }
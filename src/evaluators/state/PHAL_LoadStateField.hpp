@@ -14,6 +14,8 @@
 
 #include "Teuchos_ParameterList.hpp"
 
+#include "PHAL_Utilities.hpp"
+
 namespace PHAL {
 /** \brief LoadStateField
 
@@ -38,6 +40,7 @@ private:
   PHX::MDField<ScalarT> data;
   std::string fieldName;
   std::string stateName;
+  WorksetStateLookup stateLookup;
 };
 
 template<typename EvalT, typename Traits>
@@ -60,6 +63,7 @@ private:
   PHX::MDField<ParamScalarT> data;
   std::string fieldName;
   std::string stateName;
+  WorksetStateLookup stateLookup;
 };
 
 
@@ -4,6 +4,8 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
+#include <type_traits>
 #include <vector>
 #include <string>
 
@@ -13,12 +15,52 @@
 
 namespace PHAL {
 
+namespace {
+
+// The state array is row-major, so real fields on contiguous row-major views
+// are filled with one copy of the state values. Other fields go through the
+// generic MDField iterator.
+template<typename ScalarType>
+void loadState(PHX::MDField<ScalarType>& data, const Albany::MDArray* state, std::false_type)
+{
+  const int n = (state == NULL) ? 0 : state->size();
+  PHAL::MDFieldIterator<ScalarType> d(data);
+  for (int i = 0; ! d.done() && i < n; ++d, ++i)
+    *d = (*state)[i];
+  for ( ; ! d.done(); ++d) *d = 0.;
+}
+
+template<typename ScalarType>
+void loadState(PHX::MDField<ScalarType>& data, const Albany::MDArray* state, std::true_type)
+{
+  const auto view = data.get_view();
+  typedef typename std::remove_const<decltype(view)>::type ViewType;
+  if (!std::is_same<typename ViewType::array_layout, Kokkos::LayoutRight>::value ||
+      !view.span_is_contiguous()) {
+    loadState(data, state, std::false_type());
+    return;
+  }
+  const std::size_t n = std::min<std::size_t>(view.size(), state == NULL ? 0 : state->size());
+  if (n > 0)
+    std::copy(state->contiguous_data(), state->contiguous_data() + n, view.data());
+  std::fill(view.data() + n, view.data() + view.size(), 0.);
+}
+
+template<typename ScalarType>
+void loadState(PHX::MDField<ScalarType>& data, const Albany::MDArray* state)
+{
+  loadState(data, state, std::is_same<ScalarType, RealType>());
+}
+
+} // namespace
+
 template<typename EvalT, typename Traits, typename ScalarType>
 LoadStateFieldBase<EvalT, Traits, ScalarType>::
 LoadStateFieldBase(const Teuchos::ParameterList& p)
 {  
   fieldName =  p.get<std::string>("Field Name");
   stateName =  p.get<std::string>("State Name");
+  stateLookup = WorksetStateLookup(stateName);
 
   PHX::MDField<ScalarType> f(fieldName, p.get<Teuchos::RCP<PHX::DataLayout> >("State Field Layout") );
   data = f;
@@ -42,11 +84,7 @@ void LoadStateFieldBase<EvalT, Traits, ScalarType>::evaluateFields(typename Trai
   //cout << "LoadStateFieldBase importing state " << stateName << " to field "
   //     << fieldName << " with size " << data.size() << endl;
 
-  const Albany::MDArray& stateToLoad = (*workset.stateArrayPtr)[stateName];
-  PHAL::MDFieldIterator<ScalarType> d(data);
-  for (int i = 0; ! d.done() && i < stateToLoad.size(); ++d, ++i)
-    *d = stateToLoad[i];
-  for ( ; ! d.done(); ++d) *d = 0.;
+  loadState(data, stateLookup.get(workset));
 }
 
 
@@ -57,6 +95,7 @@ LoadStateField(const Teuchos::ParameterList& p)
 {  
   fieldName =  p.get<std::string>("Field Name");
   stateName =  p.get<std::string>("State Name");
+  stateLookup = WorksetStateLookup(stateName);
 
   PHX::MDField<ParamScalarT> f(fieldName, p.get<Teuchos::RCP<PHX::DataLayout> >("State Field Layout") );
   data = f;
@@ -80,11 +119,7 @@ void LoadStateField<EvalT, Traits>::evaluateFields(typename Traits::EvalData wor
   //cout << "LoadStateField importing state " << stateName << " to field " 
   //     << fieldName << " with size " << data.size() << endl;
 
-  const Albany::MDArray& stateToLoad = (*workset.stateArrayPtr)[stateName];
-  PHAL::MDFieldIterator<ParamScalarT> d(data);
-  for (int i = 0; ! d.done() && i < stateToLoad.size(); ++d, ++i)
-    *d = stateToLoad[i];
-  for ( ; ! d.done(); ++d) *d = 0.;
+  loadState(data, stateLookup.get(workset));
 }
 
 // **********************************************************************
@@ -14,6 +14,8 @@
 
 #include "Teuchos_ParameterList.hpp"
 
+#include "PHAL_Utilities.hpp"
+
 namespace PHAL {
 /** \brief SaveStateField
 
@@ -65,6 +67,7 @@ private:
   PHX::MDField<const ScalarT> field;
   std::string fieldName;
   std::string stateName;
+  WorksetStateLookup stateLookup;
 
   bool nodalState;
   bool worksetState;
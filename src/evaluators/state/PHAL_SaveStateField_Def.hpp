@@ -4,6 +4,8 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <algorithm>
+#include <type_traits>
 #include <vector>
 #include <string>
 
@@ -49,6 +51,7 @@ SaveStateField(const Teuchos::ParameterList& p)
 {
   fieldName =  p.get<std::string>("Field Name");
   stateName =  p.get<std::string>("State Name");
+  stateLookup = WorksetStateLookup(stateName);
 
   Teuchos::RCP<PHX::DataLayout> layout = p.get<Teuchos::RCP<PHX::DataLayout> >("State Field Layout");
   field = decltype(field)(fieldName, layout );
@@ -109,17 +112,36 @@ saveElemState(typename Traits::EvalData workset)
 {
   // Get shards Array (from STK) for this state
   // Need to check if we can just copy full size -- can assume same ordering?
-  Albany::StateArray::const_iterator it;
-  it = workset.stateArrayPtr->find(stateName);
+  Albany::MDArray* state = stateLookup.get(workset);
 
-  TEUCHOS_TEST_FOR_EXCEPTION((it == workset.stateArrayPtr->end()), std::logic_error,
+  TEUCHOS_TEST_FOR_EXCEPTION((state == NULL), std::logic_error,
          std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
 
-  Albany::MDArray sta = it->second;
+  Albany::MDArray sta = *state;
   std::vector<PHX::DataLayout::size_type> dims;
   sta.dimensions(dims);
   int size = dims.size();
 
+  // The state array is a row-major view of the STK field data for this
+  // bucket. When the field is row-major with the same trailing dimensions,
+  // the cells of the workset are one contiguous block in both.
+  const auto view = field.get_view();
+  typedef typename std::remove_const<decltype(view)>::type ViewType;
+  if (std::is_same<typename ViewType::array_layout, Kokkos::LayoutRight>::value &&
+      view.span_is_contiguous() && static_cast<int>(view.rank()) == size) {
+    bool sameDims = true;
+    std::size_t cellSize = 1;
+    for (int i = 1; i < size; ++i) {
+      sameDims = sameDims && view.dimension(i) == dims[i];
+      cellSize *= dims[i];
+    }
+    if (sameDims) {
+      std::copy(view.data(), view.data() + workset.numCells * cellSize,
+                sta.contiguous_data());
+      return;
+    }
+  }
+
   switch (size) {
   case 1:
     for (int cell = 0; cell < workset.numCells; ++cell)
@@ -163,13 +185,12 @@ saveWorksetState(typename Traits::EvalData workset)
 {
   // Get shards Array (from STK) for this state
   // Need to check if we can just copy full size -- can assume same ordering?
-  Albany::StateArray::const_iterator it;
-  it = workset.stateArrayPtr->find(stateName);
+  Albany::MDArray* state = stateLookup.get(workset);
 
-  TEUCHOS_TEST_FOR_EXCEPTION((it == workset.stateArrayPtr->end()), std::logic_error,
+  TEUCHOS_TEST_FOR_EXCEPTION((state == NULL), std::logic_error,
          std::endl << "Error: cannot locate " << stateName << " in PHAL_SaveStateField_Def" << std::endl);
 
-  Albany::MDArray sta = it->second;
+  Albany::MDArray sta = *state;
   std::vector<PHX::DataLayout::size_type> dims;
   sta.dimensions(dims);
   int size = dims.size();
@@ -41,6 +41,12 @@ public:
 private:
 
   typedef typename EvalT::MeshScalarT MeshScalarT;
+
+  //! Copy the outputs of workset d from the cache. Returns false if the
+  //! workset is not cached or was cached for other coordinates.
+  bool loadCachedBasis(typename Traits::EvalData d);
+  //! Store the outputs of workset d in the cache
+  void cacheBasis(typename Traits::EvalData d);
   int  numVertices, numDims, numNodes, numQPs, numCells;
 
   // Input:
@@ -65,6 +71,23 @@ private:
   PHX::MDField<MeshScalarT,Cell,Node,QuadPoint> wBF;
   PHX::MDField<MeshScalarT,Cell,Node,QuadPoint,Dim> GradBF;
   PHX::MDField<MeshScalarT,Cell,Node,QuadPoint,Dim> wGradBF;
+
+  //! Outputs of one workset, kept when the reference coordinates are fixed
+  //! (see PHAL::Workset::cache_basis_functions)
+  struct CachedBasis {
+    //! Coordinates of the workset the entry was computed for; they are
+    //! reallocated when the mesh is updated or adapted
+    const void* coords = nullptr;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> weighted_measure;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> jacobian_det;
+    Kokkos::DynRankView<RealType, PHX::Device> BF;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> wBF;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> GradBF;
+    Kokkos::DynRankView<MeshScalarT, PHX::Device> wGradBF;
+  };
+  std::vector<CachedBasis> cache;
+  std::size_t cacheBytes;
+  bool cacheReported;
 };
 }
 
@@ -4,7 +4,11 @@
 //    in the file "license.txt" in the top-level Albany directory  //
 //*****************************************************************//
 
+#include <type_traits>
+
 #include "Teuchos_TestForException.hpp"
+#include "Teuchos_DefaultComm.hpp"
+#include "Teuchos_VerboseObject.hpp"
 #include "Phalanx_DataLayout.hpp"
 
 #include "Intrepid2_FunctionSpaceTools.hpp"
@@ -24,7 +28,9 @@ ComputeBasisFunctions(const Teuchos::ParameterList& p,
   BF            (p.get<std::string>  ("BF Name"), dl->node_qp_scalar),
   wBF           (p.get<std::string>  ("Weighted BF Name"), dl->node_qp_scalar),
   GradBF        (p.get<std::string>  ("Gradient BF Name"), dl->node_qp_gradient),
-  wGradBF       (p.get<std::string>  ("Weighted Gradient BF Name"), dl->node_qp_gradient)
+  wGradBF       (p.get<std::string>  ("Weighted Gradient BF Name"), dl->node_qp_gradient),
+  cacheBytes    (0),
+  cacheReported (false)
 {
   this->addDependentField(coordVec.fieldTag());
   this->addEvaluatedField(weighted_measure);
@@ -95,6 +101,12 @@ evaluateFields(typename Traits::EvalData workset)
   //int containerSize = workset.numCells;
     */
 
+  // Coordinates carrying derivatives may change between fills
+  const bool useCache = workset.cache_basis_functions &&
+                        std::is_same<MeshScalarT, RealType>::value;
+  if (useCache && loadCachedBasis(workset))
+    return;
+
   typedef typename Intrepid2::CellTools<PHX::Device>   ICT;
   typedef Intrepid2::FunctionSpaceTools<PHX::Device>   IFST;
 
@@ -110,6 +122,66 @@ evaluateFields(typename Traits::EvalData workset)
   IFST::multiplyMeasure    (wGradBF.get_view(), weighted_measure.get_view(), GradBF.get_view());
 
   (void)isJacobianDetNegative;
+
+  if (useCache)
+    cacheBasis(workset);
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+bool ComputeBasisFunctions<EvalT, Traits>::
+loadCachedBasis(typename Traits::EvalData workset)
+{
+  if (workset.wsIndex >= cache.size() ||
+      cache[workset.wsIndex].coords != workset.wsCoords.getRawPtr())
+    return false;
+
+  // All worksets are cached after the first sweep; report once
+  if (!cacheReported) {
+    cacheReported = true;
+    if (Teuchos::DefaultComm<int>::getComm()->getRank() == 0)
+      *Teuchos::VerboseObjectBase::getDefaultOStream()
+        << this->getName() << ": cached basis functions of " << cache.size()
+        << " worksets use " << cacheBytes / (1024.0 * 1024.0)
+        << " MB on rank 0" << std::endl;
+  }
+
+  const CachedBasis& c = cache[workset.wsIndex];
+  Kokkos::deep_copy(weighted_measure.get_view(), c.weighted_measure);
+  Kokkos::deep_copy(jacobian_det.get_view(), c.jacobian_det);
+  Kokkos::deep_copy(BF.get_view(), c.BF);
+  Kokkos::deep_copy(wBF.get_view(), c.wBF);
+  Kokkos::deep_copy(GradBF.get_view(), c.GradBF);
+  Kokkos::deep_copy(wGradBF.get_view(), c.wGradBF);
+  return true;
+}
+
+//**********************************************************************
+template<typename EvalT, typename Traits>
+void ComputeBasisFunctions<EvalT, Traits>::
+cacheBasis(typename Traits::EvalData workset)
+{
+  if (workset.wsIndex >= cache.size())
+    cache.resize(workset.wsIndex + 1);
+
+  CachedBasis& c = cache[workset.wsIndex];
+  if (c.coords == nullptr) {
+    c.weighted_measure = Kokkos::createDynRankView(weighted_measure.get_view(), "weighted_measure", numCells, numQPs);
+    c.jacobian_det = Kokkos::createDynRankView(jacobian_det.get_view(), "jacobian_det", numCells, numQPs);
+    c.BF = Kokkos::createDynRankView(BF.get_view(), "BF", numCells, numNodes, numQPs);
+    c.wBF = Kokkos::createDynRankView(wBF.get_view(), "wBF", numCells, numNodes, numQPs);
+    c.GradBF = Kokkos::createDynRankView(GradBF.get_view(), "GradBF", numCells, numNodes, numQPs, numDims);
+    c.wGradBF = Kokkos::createDynRankView(wGradBF.get_view(), "wGradBF", numCells, numNodes, numQPs, numDims);
+    cacheBytes += sizeof(RealType) * numCells * numQPs * (2 + 3 * numNodes + 2 * numNodes * numDims);
+  }
+  c.coords = workset.wsCoords.getRawPtr();
+
+  Kokkos::deep_copy(c.weighted_measure, weighted_measure.get_view());
+  Kokkos::deep_copy(c.jacobian_det, jacobian_det.get_view());
+  Kokkos::deep_copy(c.BF, BF.get_view());
+  Kokkos::deep_copy(c.wBF, wBF.get_view());
+  Kokkos::deep_copy(c.GradBF, GradBF.get_view());
+  Kokkos::deep_copy(c.wGradBF, wGradBF.get_view());
 }
 
 //**********************************************************************
@@ -0,0 +1,125 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_KL_FIELD_CACHE_HPP
+#define PHAL_KL_FIELD_CACHE_HPP
+
+#ifdef ALBANY_STOKHOS
+
+#include <cmath>
+#include <map>
+#include <type_traits>
+#include <vector>
+
+#include "Albany_DataTypes.hpp"
+#include "Sacado_Traits.hpp"
+#include "Stokhos_KL_ExponentialRandomField.hpp"
+#include "Teuchos_Array.hpp"
+#include "Teuchos_RCP.hpp"
+
+namespace PHAL {
+/**
+ * \brief Truncated KL expansion of an exponential random field at the
+ * quad points, with the eigenfunctions evaluated once per workset.
+ *
+ * The scaled eigenfunctions std_dev*sqrt(lambda_k)*phi_k(x) at every quad
+ * point of a workset are kept in a dense (points x terms) matrix, so each
+ * evaluation is one matrix-vector product with the random variables. A
+ * workset's matrix is rebuilt only if its coordinates change, e.g. after
+ * adaptation.
+ */
+class KLFieldCache {
+public:
+
+  typedef Stokhos::KL::ExponentialRandomField<RealType> RandomField;
+
+  explicit KLFieldCache(const Teuchos::RCP<RandomField>& rf) :
+    rf_(rf), numKL_(rf->stochasticDimension()) {}
+
+  //! field(cell,qp) = mean + sum_k Phi(cell,qp,k) rv[k], for all the cells
+  template<typename ScalarT, typename FieldT, typename CoordT>
+  void evaluate(const int wsIndex, const std::size_t numCells,
+                const std::size_t numQPs, const std::size_t numDims,
+                const CoordT& coordVec, const Teuchos::Array<ScalarT>& rv,
+                FieldT& field)
+  {
+    const Basis& basis = getBasis(wsIndex, numCells, numQPs, numDims, coordVec);
+
+    const RealType* phi = basis.phi.data();
+    for (std::size_t cell=0; cell < numCells; ++cell) {
+      for (std::size_t qp=0; qp < numQPs; ++qp) {
+        ScalarT value = basis.mean[cell*numQPs+qp];
+        for (int k=0; k < numKL_; ++k)
+          value += phi[k] * rv[k];
+        field(cell,qp) = value;
+        phi += numKL_;
+      }
+    }
+  }
+
+private:
+
+  struct Basis {
+    std::vector<RealType> coords;
+    std::vector<RealType> mean;
+    std::vector<RealType> phi;
+  };
+
+  template<typename CoordT>
+  const Basis& getBasis(const int wsIndex, const std::size_t numCells,
+                        const std::size_t numQPs, const std::size_t numDims,
+                        const CoordT& coordVec)
+  {
+    typedef typename std::remove_const<typename CoordT::value_type>::type MeshScalarT;
+
+    Basis& basis = bases_[wsIndex];
+
+    bool same = basis.coords.size() == numCells*numQPs*numDims;
+    for (std::size_t cell=0; same && cell < numCells; ++cell)
+      for (std::size_t qp=0; same && qp < numQPs; ++qp)
+        for (std::size_t i=0; same && i < numDims; ++i)
+          same = basis.coords[(cell*numQPs+qp)*numDims+i] ==
+                 Sacado::ScalarValue<MeshScalarT>::eval(coordVec(cell,qp,i));
+    if (same) return basis;
+
+    basis.coords.resize(numCells*numQPs*numDims);
+    basis.mean.resize(numCells*numQPs);
+    basis.phi.resize(numCells*numQPs*numKL_);
+
+    std::vector<RealType> scale(numKL_);
+    for (int k=0; k < numKL_; ++k)
+      scale[k] = std::sqrt(rf_->eigenvalue(k));
+
+    Teuchos::Array<RealType> point(numDims);
+    for (std::size_t cell=0; cell < numCells; ++cell) {
+      for (std::size_t qp=0; qp < numQPs; ++qp) {
+        const std::size_t p = cell*numQPs+qp;
+        for (std::size_t i=0; i < numDims; ++i)
+          basis.coords[p*numDims+i] = point[i] =
+            Sacado::ScalarValue<MeshScalarT>::eval(coordVec(cell,qp,i));
+
+        const RealType std_dev = rf_->evaluate_standard_deviation(point);
+        basis.mean[p] = rf_->evaluate_mean(point);
+        for (int k=0; k < numKL_; ++k)
+          basis.phi[p*numKL_+k] =
+            std_dev * scale[k] * rf_->evaluate_eigenfunction(point, k);
+      }
+    }
+    return basis;
+  }
+
+  Teuchos::RCP<RandomField> rf_;
+  int numKL_;
+
+  //! Basis of each workset, by workset index
+  std::map<int, Basis> bases_;
+};
+
+} // Namespace PHAL
+
+#endif // ALBANY_STOKHOS
+
+#endif // PHAL_KL_FIELD_CACHE_HPP
@@ -0,0 +1,90 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+#ifndef PHAL_MDFIELD_MEMOIZER_HPP
+#define PHAL_MDFIELD_MEMOIZER_HPP
+
+#include <vector>
+
+#include "PHAL_Workset.hpp"
+
+namespace PHAL {
+
+/** \brief Per-workset copies of the output of an evaluator whose inputs do
+ *  not depend on the solution or on the scalar parameters.
+ *
+ *  The saved values of a workset are restored as long as its coordinates,
+ *  the distributed parameters (Workset::dist_param_state) and the time are
+ *  the ones they were computed with. Only the evaluator knows that its
+ *  inputs are mesh fields, so it decides whether to use the memoizer;
+ *  the whole mechanism is off unless Workset::memoize_fields is set by the
+ *  "Use MDField Memoization" problem parameter.
+ *
+ *  Usage in evaluateFields:
+ *
+ *    if (memoizer.restore(workset, out)) return;
+ *    ... compute out ...
+ *    memoizer.save(workset, out);
+ */
+template<typename ValueT>
+class MDFieldMemoizer {
+public:
+
+  //! Copy the saved values of the workset into field; false if they are
+  //! missing or stale
+  template<typename FieldT>
+  bool restore(const Workset& workset, FieldT& field) const
+  {
+    if (!workset.memoize_fields || workset.wsIndex >= saved_.size())
+      return false;
+
+    const Saved& s = saved_[workset.wsIndex];
+    if (s.coords != workset.wsCoords.getRawPtr() ||
+        s.distParamState != workset.dist_param_state ||
+        s.time != workset.current_time ||
+        s.values.size() != field.size())
+      return false;
+
+    for (std::size_t i=0; i < s.values.size(); ++i)
+      field[i] = s.values[i];
+    return true;
+  }
+
+  //! Save the values of field, just computed for the workset
+  template<typename FieldT>
+  void save(const Workset& workset, const FieldT& field)
+  {
+    if (!workset.memoize_fields) return;
+
+    if (workset.wsIndex >= saved_.size())
+      saved_.resize(workset.wsIndex + 1);
+
+    Saved& s = saved_[workset.wsIndex];
+    s.coords = workset.wsCoords.getRawPtr();
+    s.distParamState = workset.dist_param_state;
+    s.time = workset.current_time;
+    s.values.resize(field.size());
+    for (std::size_t i=0; i < s.values.size(); ++i)
+      s.values[i] = field[i];
+  }
+
+private:
+
+  struct Saved {
+    //! Coordinates of the workset; they are reallocated when the mesh is
+    //! updated or adapted
+    const void* coords = nullptr;
+    int distParamState = -1;
+    double time = 0;
+    std::vector<ValueT> values;
+  };
+
+  std::vector<Saved> saved_;
+};
+
+} // namespace PHAL
+
+#endif // PHAL_MDFIELD_MEMOIZER_HPP
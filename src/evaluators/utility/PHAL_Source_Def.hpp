@@ -16,6 +16,7 @@
 #include "Albany_Utils.hpp"
 #ifdef ALBANY_STOKHOS
 #include "Stokhos_KL_ExponentialRandomField.hpp"
+#include "PHAL_KLFieldCache.hpp"
 #endif
 #include "Teuchos_Array.hpp"
 #include "Teuchos_TestForException.hpp"
@@ -520,8 +521,8 @@ private :
   PHX::MDField<ScalarT,Cell,Point>   m_source;
   PHX::MDField<const MeshScalarT,Cell,Point,Dim> m_coordVec;
   Teuchos::RCP< Stokhos::KL::ExponentialRandomField<RealType> > m_exp_rf_kl;
+  Teuchos::RCP<KLFieldCache> m_kl_cache;
   Teuchos::Array<ScalarT> m_rv;
-  Teuchos::Array<MeshScalarT> m_point;
   std::string param_name_base;
 };
 
@@ -543,6 +544,7 @@ TruncatedKL(Teuchos::ParameterList& p) {
   
   m_exp_rf_kl = 
       Teuchos::rcp(new Stokhos::KL::ExponentialRandomField<RealType>(paramList));
+  m_kl_cache = Teuchos::rcp(new KLFieldCache(m_exp_rf_kl));
   int num_KL = m_exp_rf_kl->stochasticDimension();
 
   param_name_base = p.get<std::string>("Source Name") + " KL Random Variable";
@@ -591,7 +593,6 @@ FieldData(PHX::EvaluatorUtilities<EvalT,Traits> &utils,
   m_coordVec.dimensions(dims);
   m_num_qp = dims[1];
   m_num_dims = dims[2];
-  m_point.resize(m_num_dims);
 }
 
 template<typename EvalT,typename Traits>
@@ -599,15 +600,9 @@ void
 TruncatedKL<EvalT,Traits>::
 evaluateFields(typename Traits::EvalData workset){
 
-  // Loop over cells, quad points: compute TruncatedKL Source Term
-  for (std::size_t cell = 0; cell < workset.numCells; ++cell) {
-    for (std::size_t qp=0; qp<m_num_qp; qp++) {
-      for (std::size_t i=0; i<m_num_dims; i++)
-	m_point[i] = 
-	  Sacado::ScalarValue<MeshScalarT>::eval(m_coordVec(cell,qp,i));
-        m_source(cell, qp) = m_exp_rf_kl->evaluate(m_point, m_rv);
-    }
-  }
+  // Compute TruncatedKL Source Term at all the cells and quad points
+  m_kl_cache->evaluate(workset.wsIndex, workset.numCells, m_num_qp, m_num_dims,
+                       m_coordVec, m_rv, m_source);
 }
 
 template<typename EvalT,typename Traits>
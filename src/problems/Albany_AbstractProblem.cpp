@@ -150,6 +150,12 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
   validPL->sublist("Neumann BCs", false, "");
   validPL->sublist("Adaptation", false, "");
   validPL->sublist("Catalyst", false, "");
+  validPL->sublist("Jacobian Reuse", false,
+                   "Policy for reusing the Jacobian over Newton iterations and time steps");
+  validPL->set<std::string>("Jacobian Operator", "Assembled",
+                            "Assembled, or Tangent to apply the Jacobian matrix-free with the Tangent evaluation type");
+  validPL->sublist("Tangent Preconditioner", false,
+                   "Ifpack2 preconditioner (Prec Type, Ifpack2 Settings) on the assembled Jacobian for Jacobian Operator = Tangent");
   validPL->set<bool>("Solve Adjoint", false, "");
   validPL->set<int>("Number Of Time Derivatives", 1, "Number of time derivatives in use in the problem");
 
@@ -157,6 +163,22 @@ Albany::AbstractProblem::getGenericProblemParams(std::string listname) const
                      "Ignore residual calculations while computing the Jacobian (only generally appropriate for linear problems)");
   validPL->set<double>("Perturb Dirichlet", 0.0,
                      "Add this (small) perturbation to the diagonal to prevent Mass Matrices from being singular for Dirichlets)");
+  validPL->set<int>("Workset Assembly Threads", 1,
+                     "Number of threads evaluating worksets of the same color concurrently (1 = serial assembly, 0 = all host threads)");
+  validPL->set<bool>("Report Overlap Storage", false,
+                     "Print the ghost DOFs and Jacobian entries summed over the ranks, to compare rank and thread counts");
+  validPL->set<bool>("Static Graph Jacobian Export", false,
+                     "Export only the values of the overlapped Jacobian, with a plan built once per mesh");
+  validPL->set<bool>("Overlap Fill Export", false,
+                     "Assemble the worksets with equations on other ranks first and export them while the rest is assembled");
+  validPL->set<bool>("Cache Basis Functions", false,
+                     "Compute basis functions once per workset; only valid if the reference coordinates do not change");
+  validPL->set<bool>("Use MDField Memoization", false,
+                     "Let evaluators of fields that only depend on mesh fields and distributed parameters reuse their outputs per workset");
+  validPL->set<bool>("Save States In Residual", false,
+                     "Save the states in each Residual fill and skip the state field manager pass at the solution of the last fill");
+  validPL->set<int>("Number of Tangent Directions", 0,
+                     "Number of solution tangent directions the Tangent fields are sized for (0 = number of parameters)");
 
   validPL->sublist("Model Order Reduction", false, "Specify the options relative to model order reduction");
 
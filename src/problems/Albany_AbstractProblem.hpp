@@ -128,6 +128,14 @@ class AbstractProblem {
     return offsets_;
   }
 
+  //! Sizes of the groups of consecutive nodal unknowns of each physics, in
+  //! the order of the nodal interleaving, used to split the Jacobian into
+  //! blocks for block preconditioners. Defaults to a single block.
+  virtual std::vector<int>
+  getUnknownBlocking() const {
+    return std::vector<int>(1, neq);
+  }
+
   //! Return the Null space object used to communicate with MP
   const Teuchos::RCP<Albany::RigidBodyModes>&
   getNullSpace() {
@@ -932,6 +932,10 @@ Albany::BCUtils<Albany::NeumannTraits>::buildEvaluatorsList(
 
   RCP<std::vector<string>> bcs = rcp(new std::vector<string>);
 
+  // Neumann evaluators on the same side set share their side grouping and
+  // geometry through this
+  RCP<PHAL::NeumannSideCaches> sideCaches = rcp(new PHAL::NeumannSideCaches);
+
   // Check for all possible standard BCs (every dof on every sideset) to see
   // which is set
   for (std::size_t i = 0; i < meshSpecs->ssNames.size(); i++) {
@@ -967,6 +971,7 @@ Albany::BCUtils<Albany::NeumannTraits>::buildEvaluatorsList(
           p->set<RCP<ParamLib>>("Parameter Library", paramLib);
 
           p->set<string>("Side Set ID", meshSpecs->ssNames[i]);
+          p->set<RCP<PHAL::NeumannSideCaches>>("Side Caches", sideCaches);
           p->set<Teuchos::Array<int>>("Equation Offset", offsets[j]);
           p->set<RCP<Albany::Layouts>>("Layouts Struct", dl);
           p->set<RCP<MeshSpecsStruct>>("Mesh Specs Struct", meshSpecs);
@@ -185,6 +185,15 @@ namespace Albany {
     constructDOFVecGradInterpolationEvaluator(
        const std::string& dof_names, int offsetToFirstDOF=-1) const;
 
+    //! Values and gradients of several scalar and vector quantities in one
+    //! evaluator. Offsets of -1 mark fields that are not part of the solution.
+    Teuchos::RCP< PHX::Evaluator<Traits> >
+    constructDOFFusedInterpolationEvaluator(
+       const Teuchos::Array<std::string>& dof_names,
+       const Teuchos::Array<int>& offsetsToFirstDOF,
+       const Teuchos::Array<std::string>& vec_dof_names,
+       const Teuchos::Array<int>& vecOffsetsToFirstDOF) const;
+
     //! Interpolation functions for Tensor quantities
     Teuchos::RCP< PHX::Evaluator<Traits> >
     constructDOFTensorInterpolationEvaluator(
@@ -24,6 +24,7 @@
 #include "PHAL_DOFTensorInterpolation.hpp"
 #include "PHAL_DOFTensorGradInterpolation.hpp"
 #include "PHAL_DOFVecGradInterpolation.hpp"
+#include "PHAL_DOFFusedInterpolation.hpp"
 #include "PHAL_DOFVecGradInterpolationSide.hpp"
 #include "PHAL_DOFVecInterpolation.hpp"
 #include "PHAL_DOFVecInterpolationSide.hpp"
@@ -649,8 +650,10 @@ Albany::EvaluatorUtilsBase<EvalT,Traits,ScalarT>::constructDOFInterpolationEvalu
     p->set<int>("Offset of First DOF", offsetToFirstDOF);
 
     // Output (assumes same Name as input)
-
-    return rcp(new PHAL::DOFInterpolationBase<EvalT,Traits,ScalarT>(*p,dl));
+    if(offsetToFirstDOF == -1)
+      return rcp(new PHAL::DOFInterpolationBase<EvalT,Traits,ScalarT>(*p,dl));
+    else  //works only for solution or a solution component
+      return rcp(new PHAL::FastSolutionInterpolationBase<EvalT,Traits,ScalarT>(*p,dl));
 }
 
 template<typename EvalT, typename Traits, typename ScalarT>
@@ -752,6 +755,33 @@ Albany::EvaluatorUtilsBase<EvalT,Traits,ScalarT>::constructDOFVecGradInterpolati
       return rcp(new PHAL::FastSolutionVecGradInterpolationBase<EvalT,Traits,ScalarT>(*p,dl));
 }
 
+template<typename EvalT, typename Traits, typename ScalarT>
+Teuchos::RCP< PHX::Evaluator<Traits> >
+Albany::EvaluatorUtilsBase<EvalT,Traits,ScalarT>::constructDOFFusedInterpolationEvaluator(
+       const Teuchos::Array<std::string>& dof_names,
+       const Teuchos::Array<int>& offsetsToFirstDOF,
+       const Teuchos::Array<std::string>& vec_dof_names,
+       const Teuchos::Array<int>& vecOffsetsToFirstDOF) const
+{
+    using Teuchos::RCP;
+    using Teuchos::rcp;
+    using Teuchos::ParameterList;
+
+    RCP<ParameterList> p = rcp(new ParameterList("DOFFused Interpolation"));
+    // Input
+    p->set< Teuchos::Array<std::string> >("Scalar DOF Names", dof_names);
+    p->set< Teuchos::Array<int> >("Scalar DOF Offsets", offsetsToFirstDOF);
+    p->set< Teuchos::Array<std::string> >("Vector DOF Names", vec_dof_names);
+    p->set< Teuchos::Array<int> >("Vector DOF Offsets", vecOffsetsToFirstDOF);
+    p->set<std::string>("BF Name", "BF");
+    p->set<std::string>("Gradient BF Name", "Grad BF");
+
+    // Output (assumes same Name as input, and " Gradient" for the gradients)
+
+    // The fast version falls back to the dense one if any offset is -1
+    return rcp(new PHAL::FastSolutionFusedInterpolationBase<EvalT,Traits,ScalarT>(*p,dl));
+}
+
 template<typename EvalT, typename Traits, typename ScalarT>
 Teuchos::RCP< PHX::Evaluator<Traits> >
 Albany::EvaluatorUtilsBase<EvalT,Traits,ScalarT>::constructDOFVecGradInterpolationSideEvaluator(
@@ -29,14 +29,7 @@ MaterialDatabase(
     std::cout << input_file << std::endl;
   }
 
-  auto input_extension = Albany::getFileExtension(input_file);
-  if (input_extension == "yaml" || input_extension == "yml") {
-    Teuchos::updateParametersFromYamlFileAndBroadcast(
-        input_file, Teuchos::ptrFromRef(data_), *tcomm);
-  } else {
-    Teuchos::updateParametersFromXmlFileAndBroadcast(
-        input_file, Teuchos::ptrFromRef(data_), *tcomm);
-  }
+  Albany::updateParametersFromInputFile(input_file, data_, *tcomm);
 
   // Check for and set element block and materials sublists
   ALBANY_ASSERT(data_.isSublist("Materials"),
@@ -137,22 +130,14 @@ isElementBlockParam(std::string const& eb_name, std::string const& param_name)
   ALBANY_ASSERT(p_eb_list_,
 		  "\nMaterialDB Error! param required but no DB.\n");
 
-  auto new_name = translateDBSublistName(p_eb_list_, eb_name);
-  if (new_name.empty()) return false;
-
-  auto& sublist = p_eb_list_->sublist(new_name);
+  auto const& lists = getElementBlockLists(eb_name);
+  if (lists.eb == nullptr) return false;
 
-  if (sublist.isParameter(param_name)) return true;
-
-  //check if related material exists (it always should)
-  if(!sublist.isParameter("material")) return false;
+  if (lists.eb->isParameter(param_name)) return true;
 
   //Parameter not directly in element block sublist, so try related material
-  auto material_name = sublist.get<std::string>("material");
-  if(!p_materials_list_->isSublist(material_name)) return false;
-
-  auto& mat_sublist = p_materials_list_->sublist(material_name);
-  return mat_sublist.isParameter(param_name);
+  if (lists.material == nullptr) return false;
+  return lists.material->isParameter(param_name);
 }
 
 template<typename T> T
@@ -165,39 +150,33 @@ getElementBlockParam(std::string const& eb_name, std::string const& param_name)
   ALBANY_ASSERT(!eb_name.empty(),
 		  "\nMaterialDB Error! Empty element block name\n");
 
-  auto new_name = translateDBSublistName(p_eb_list_, eb_name);
+  auto const& lists = getElementBlockLists(eb_name);
 
-  ALBANY_ASSERT(!new_name.empty(),
+  ALBANY_ASSERT(lists.eb != nullptr,
       "\nMaterialDB Error! Invalid element block name \""
       << eb_name << "\".\n");
 
-  // This call returns the sublist for the particular EB within the "ElementBlocks" list
-  auto& sublist = p_eb_list_->sublist(new_name);
-
-  if (sublist.isParameter(param_name)) {
-    return sublist.get<T>(param_name);
+  if (lists.eb->isParameter(param_name)) {
+    return lists.eb->get<T>(param_name);
   }
 
   //check if related material exists (it always should)
-  ALBANY_ASSERT(sublist.isParameter("material"),
+  ALBANY_ASSERT(lists.eb->isParameter("material"),
 		  "\nMaterialDB Error! Param " << param_name
 		  << " not found in " << eb_name << " list and there"
 		  << " is no related material.\n");
 
   //Parameter not directly in element block sublist, so try related material
-  auto material_name = sublist.get<std::string>("material");
-
-  ALBANY_ASSERT(p_materials_list_->isSublist(material_name),
+  ALBANY_ASSERT(lists.material != nullptr,
 		     "\nMaterialDB Error! Param " << param_name
 		     << " not found in " << eb_name << " list, and related"
-		     << " material " << material_name << " is invalid.\n");
+		     << " material " << lists.material_name << " is invalid.\n");
 
-  auto& mat_sublist = p_materials_list_->sublist(material_name);
-  ALBANY_ASSERT(mat_sublist.isParameter(param_name),
+  ALBANY_ASSERT(lists.material->isParameter(param_name),
 		     "\nMaterialDB Error! Param " << param_name
 		     << " not found in " << eb_name << " list or related"
-		     << " material " << material_name << " list.\n");
-  return mat_sublist.get<T>(param_name);
+		     << " material " << lists.material_name << " list.\n");
+  return lists.material->get<T>(param_name);
 }
 
 template<typename T> T
@@ -209,30 +188,47 @@ getElementBlockParam(std::string const& eb_name, std::string const& param_name,
   ALBANY_ASSERT(!eb_name.empty(),
 		  "\nMaterialDB Error! Empty element block name\n");
 
-  auto new_name = translateDBSublistName(p_eb_list_, eb_name);
+  auto const& lists = getElementBlockLists(eb_name);
 
   //check if element block exists - if not return default
-  if (new_name.empty()) return def_value;
-
-  auto& sublist = p_eb_list_->sublist(new_name);
+  if (lists.eb == nullptr) return def_value;
 
-  if (sublist.isParameter(param_name)) {
-    return sublist.get<T>(param_name);
+  if (lists.eb->isParameter(param_name)) {
+    return lists.eb->get<T>(param_name);
   }
 
   //check if related material exists - if not return default
-  if(!sublist.isParameter("material")) return def_value;
+  if (!lists.eb->isParameter("material")) return def_value;
 
   //Parameter not directly in element block sublist, so try related material
-  auto& material_name = sublist.get<std::string>("material");
-
-  ALBANY_ASSERT(p_materials_list_->isSublist(material_name),
+  ALBANY_ASSERT(lists.material != nullptr,
 		     "\nMaterialDB Error! Param " << param_name
 		     << " not found in " << eb_name << " list, and related"
-		     << " material " << material_name << " is invalid.\n");
+		     << " material " << lists.material_name << " is invalid.\n");
+
+  return lists.material->get<T>(param_name, def_value);
+}
+
+template<typename T> std::vector<T>
+Albany::MaterialDatabase::
+getElementBlockParams(std::vector<std::string> const& eb_names, std::string const& param_name)
+{
+  std::vector<T> values;
+  values.reserve(eb_names.size());
+  for (auto const& eb_name : eb_names)
+    values.push_back(getElementBlockParam<T>(eb_name, param_name));
+  return values;
+}
 
-  auto& mat_sublist = p_materials_list_->sublist(material_name);
-  return mat_sublist.get<T>(param_name, def_value);
+template<typename T> std::vector<T>
+Albany::MaterialDatabase::
+getElementBlockParams(std::vector<std::string> const& eb_names, std::string const& param_name, T def_value)
+{
+  std::vector<T> values;
+  values.reserve(eb_names.size());
+  for (auto const& eb_name : eb_names)
+    values.push_back(getElementBlockParam<T>(eb_name, param_name, def_value));
+  return values;
 }
 
 bool
@@ -242,23 +238,14 @@ isElementBlockSublist(std::string const& eb_name, std::string const& sublist_nam
   ALBANY_ASSERT(p_eb_list_,
 		  "\nMaterialDB Error! param required but no DB.\n");
 
-  auto new_name = translateDBSublistName(p_eb_list_, eb_name);
-
-  if (new_name.empty()) return false;
-
-  auto& sublist = p_eb_list_->sublist(new_name);
+  auto const& lists = getElementBlockLists(eb_name);
+  if (lists.eb == nullptr) return false;
 
-  if (sublist.isParameter(sublist_name)) return true;
-
-  //check if related material exists (it always should)
-  if (!sublist.isParameter("material")) return false;
+  if (lists.eb->isParameter(sublist_name)) return true;
 
   //Parameter not directly in element block sublist, so try related material
-  auto material_name = sublist.get<std::string>("material");
-  if (!p_materials_list_->isSublist(material_name)) return false;
-
-  auto& mat_sublist = p_materials_list_->sublist(material_name);
-  return mat_sublist.isSublist(sublist_name);
+  if (lists.material == nullptr) return false;
+  return lists.material->isSublist(sublist_name);
 }
 
 Teuchos::ParameterList&
@@ -271,51 +258,66 @@ getElementBlockSublist(std::string const& eb_name, std::string const& sublist_na
   ALBANY_ASSERT(!eb_name.empty(),
 		  "\nMaterialDB Error! Empty element block name\n");
 
-  auto new_name = translateDBSublistName(p_eb_list_, eb_name);
+  auto const& lists = getElementBlockLists(eb_name);
 
-  ALBANY_ASSERT(!new_name.empty(),
+  ALBANY_ASSERT(lists.eb != nullptr,
       "\nMaterialDB Error! Invalid element block name \""
       << eb_name << "\".\n");
 
-  // This call returns the sublist for the particular EB within the "ElementBlocks" list
-  auto& sublist = p_eb_list_->sublist(new_name);
-
-  if (sublist.isSublist(sublist_name)) {
-    return sublist.sublist(sublist_name);
+  if (lists.eb->isSublist(sublist_name)) {
+    return lists.eb->sublist(sublist_name);
   }
 
   // Didn't find the requested sublist directly in the EB sublist.
   // Drill down to the material next.
 
   //check if related material exists (it always should)
-  ALBANY_ASSERT(sublist.isParameter("material"),
+  ALBANY_ASSERT(lists.eb->isParameter("material"),
 		  "\nMaterialDB Error! Param " << sublist_name
 		  << " not found in " << eb_name << " list and there"
 		  << " is no related material.\n");
 
   //Parameter not directly in element block sublist, so try related material
-  auto& material_name = sublist.get<std::string>("material");
-
-  ALBANY_ASSERT(p_materials_list_->isSublist(material_name),
+  ALBANY_ASSERT(lists.material != nullptr,
 		     "\nMaterialDB Error! Param " << sublist_name
 		     << " not found in " << eb_name << " list, and related"
-		     << " material " << material_name << " is invalid.\n");
-
-  auto& mat_sublist = p_materials_list_->sublist(material_name);
+		     << " material " << lists.material_name << " is invalid.\n");
 
   // In case the entire material sublist is desired
-  if (material_name == sublist_name) {
-    return mat_sublist;
+  if (lists.material_name == sublist_name) {
+    return *lists.material;
   }
 
   // Does the requested sublist appear in the material sublist?
-  ALBANY_ASSERT(mat_sublist.isParameter(sublist_name),
+  ALBANY_ASSERT(lists.material->isParameter(sublist_name),
 		     "\nMaterialDB Error! Sublist " << sublist_name
 		     << " not found in " << eb_name << " list or related"
-		     << " material " << material_name << " list.\n");
+		     << " material " << lists.material_name << " list.\n");
 
   // If so, return the requested sublist
-  return mat_sublist.sublist(sublist_name);
+  return lists.material->sublist(sublist_name);
+}
+
+Albany::MaterialDatabase::ElementBlockLists const&
+Albany::MaterialDatabase::
+getElementBlockLists(std::string const& eb_name)
+{
+  auto it = eb_lists_.find(eb_name);
+  if (it != eb_lists_.end()) return it->second;
+
+  // Finding the sublist scans all element blocks, which is slow with many
+  // blocks (e.g. one per grain), so it is only done once per name
+  ElementBlockLists lists;
+  auto new_name = translateDBSublistName(p_eb_list_, eb_name);
+  if (!new_name.empty()) {
+    lists.eb = &p_eb_list_->sublist(new_name);
+    if (lists.eb->isParameter("material")) {
+      lists.material_name = lists.eb->get<std::string>("material");
+      if (p_materials_list_->isSublist(lists.material_name))
+        lists.material = &p_materials_list_->sublist(lists.material_name);
+    }
+  }
+  return eb_lists_[eb_name] = lists;
 }
 
 template<typename T> std::vector<T>
@@ -488,6 +490,12 @@ getElementBlockParam<T>(std::string const& material_name, std::string const& par
 template T \
 Albany::MaterialDatabase:: \
 getElementBlockParam<T>(std::string const& material_name, std::string const& param_name, T def_val); \
+template std::vector<T> \
+Albany::MaterialDatabase:: \
+getElementBlockParams<T>(std::vector<std::string> const& eb_names, std::string const& param_name); \
+template std::vector<T> \
+Albany::MaterialDatabase:: \
+getElementBlockParams<T>(std::vector<std::string> const& eb_names, std::string const& param_name, T def_val); \
 template T \
 Albany::MaterialDatabase:: \
 getNodeSetParam<T>(std::string const& ns_name, std::string const& param_name); \
@@ -7,6 +7,9 @@
 #ifndef ALBANY_MATERIALDATABASE_HPP
 #define ALBANY_MATERIALDATABASE_HPP
 
+#include <map>
+#include <vector>
+
 #include "Teuchos_ParameterList.hpp"
 #include "Albany_Utils.hpp"
 
@@ -60,6 +63,14 @@ public:
   template<typename T>
   T getElementBlockParam(std::string const& eb_name, std::string const& param_name, T def_val);
 
+  //! Get a parameter for each of a list of element blocks, e.g. resolved once
+  //! at setup into a table indexed like the element blocks of the mesh
+  template<typename T>
+  std::vector<T> getElementBlockParams(std::vector<std::string> const& eb_names, std::string const& param_name);
+
+  template<typename T>
+  std::vector<T> getElementBlockParams(std::vector<std::string> const& eb_names, std::string const& param_name, T def_val);
+
   //! Get a sublist from a particular element block
   bool isElementBlockSublist(std::string const& eb_name, std::string const& sublist_name);
 
@@ -95,6 +106,17 @@ private:
 
   std::string translateDBSublistName(Teuchos::ParameterList* param_list, std::string const& list_name);
 
+  //! Sublists of an element block and of its related material
+  struct ElementBlockLists {
+    Teuchos::ParameterList* eb{nullptr};
+    Teuchos::ParameterList* material{nullptr};
+    std::string material_name;
+  };
+
+  //! Sublists of element block eb_name; eb is null for an unknown block.
+  //! Resolved on the first request for each name
+  ElementBlockLists const& getElementBlockLists(std::string const& eb_name);
+
 private:
 
   //! Encapsulated parameter list which holds all the data
@@ -103,6 +125,9 @@ private:
   Teuchos::ParameterList* p_eb_list_{nullptr};
   Teuchos::ParameterList* p_ns_list_{nullptr};
   Teuchos::ParameterList* p_ss_list_{nullptr};
+
+  //! Resolved element block sublists, by element block name
+  std::map<std::string, ElementBlockLists> eb_lists_;
 };
 
 Teuchos::RCP<Albany::MaterialDatabase>
@@ -132,6 +157,12 @@ getElementBlockParam<T>(std::string const& material_name, std::string const& par
 extern template T \
 Albany::MaterialDatabase:: \
 getElementBlockParam<T>(std::string const& material_name, std::string const& param_name, T def_val); \
+extern template std::vector<T> \
+Albany::MaterialDatabase:: \
+getElementBlockParams<T>(std::vector<std::string> const& eb_names, std::string const& param_name); \
+extern template std::vector<T> \
+Albany::MaterialDatabase:: \
+getElementBlockParams<T>(std::vector<std::string> const& eb_names, std::string const& param_name, T def_val); \
 extern template T \
 Albany::MaterialDatabase:: \
 getNodeSetParam<T>(std::string const& ns_name, std::string const& param_name); \
@@ -16,6 +16,7 @@
 #endif
 #include "PHAL_ResponseFieldIntegralT.hpp"
 #include "PHAL_ResponseThermalEnergyT.hpp"
+#include "PHAL_ResponseStableTimeStepT.hpp"
 #include "Adapt_ElementSizeField.hpp"
 #include "PHAL_ResponseSquaredL2Difference.hpp"
 #include "PHAL_ResponseSquaredL2DifferenceSide.hpp"
@@ -233,6 +234,10 @@ Albany::ResponseUtilities<EvalT,Traits>::constructResponses(
   {
     res_ev = rcp(new PHAL::ResponseThermalEnergyT<EvalT,Traits>(*p, dl));
   }
+  else if (responseName == "Stable Time Step")
+  {
+    res_ev = rcp(new PHAL::ResponseStableTimeStepT<EvalT,Traits>(*p, dl));
+  }
 #ifdef ALBANY_AMP
   else if (responseName == "AMP Energy")
   {
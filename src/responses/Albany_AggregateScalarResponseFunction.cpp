@@ -17,12 +17,27 @@ using Teuchos::rcp;
 Albany::AggregateScalarResponseFunction::
 AggregateScalarResponseFunction(
   const Teuchos::RCP<const Teuchos_Comm>& commT,
-  const Teuchos::Array< Teuchos::RCP<ScalarResponseFunction> >& responses_) :
+  const Teuchos::Array< Teuchos::RCP<ScalarResponseFunction> >& responses_,
+  const bool fused_) :
   SamplingBasedScalarResponseFunction(commT),
-  responses(responses_)
+  responses(responses_),
+  fused(fused_)
 {
 }
 
+Albany::FieldManagerScalarResponseFunction*
+Albany::AggregateScalarResponseFunction::
+sharedSweepResponse(const int i, const bool gradient) const
+{
+  if (!fused) return NULL;
+  FieldManagerScalarResponseFunction* response =
+    dynamic_cast<FieldManagerScalarResponseFunction*>(responses[i].get());
+  if (response == NULL) return NULL;
+  const bool shares = gradient ? response->sharesGradientSweep() :
+                                 response->sharesResponseSweep();
+  return shares ? response : NULL;
+}
+
 #if defined(ALBANY_EPETRA)
 void
 Albany::AggregateScalarResponseFunction::
@@ -79,7 +94,9 @@ evaluateResponseT(const double current_time,
 		 const Teuchos::Array<ParamVec>& p,
 		 Tpetra_Vector& gT)
 {
-  unsigned int offset = 0;
+  Teuchos::Array< RCP<Tpetra_Vector> > local_gT(responses.size());
+  std::vector<FieldManagerScalarResponseFunction*> swept;
+  std::vector<Tpetra_Vector*> swept_gT;
   for (unsigned int i=0; i<responses.size(); i++) {
 
     // Create Tpetra_Map for response function
@@ -89,13 +106,26 @@ evaluateResponseT(const double current_time,
     Teuchos::RCP<Tpetra_Map> local_response_map = Teuchos::rcp(new Tpetra_Map(num_responses, 0, commT, lg));
     
     // Create Tpetra_Vector for response function
-    Teuchos::RCP<Tpetra_Vector> local_gT = Teuchos::rcp(new Tpetra_Vector(local_response_map));
+    local_gT[i] = Teuchos::rcp(new Tpetra_Vector(local_response_map));
   
-    // Evaluate response function
-    responses[i]->evaluateResponseT(current_time, xdotT, xdotdotT, xT, p, *local_gT);
-    
+    // Evaluate response function, or leave it to the shared sweep
+    FieldManagerScalarResponseFunction* response = sharedSweepResponse(i, false);
+    if (response != NULL) {
+      swept.push_back(response);
+      swept_gT.push_back(local_gT[i].get());
+    }
+    else
+      responses[i]->evaluateResponseT(current_time, xdotT, xdotdotT, xT, p, *local_gT[i]);
+  }
+  FieldManagerScalarResponseFunction::evaluateResponsesT(
+    swept, current_time, xdotT, xdotdotT, xT, p, swept_gT);
+
+  unsigned int offset = 0;
+  for (unsigned int i=0; i<responses.size(); i++) {
+    unsigned int num_responses = responses[i]->numResponses();
+
     //get views of g and local_g for element access
-    Teuchos::ArrayRCP<const ST> local_gT_constView = local_gT->get1dView();
+    Teuchos::ArrayRCP<const ST> local_gT_constView = local_gT[i]->get1dView();
     Teuchos::ArrayRCP<ST> gT_nonconstView = gT.get1dViewNonConst();
 
     // Copy result into combined result
@@ -274,7 +304,14 @@ evaluateGradientT(const double current_time,
 		 Tpetra_MultiVector* dg_dxdotdotT,
 		 Tpetra_MultiVector* dg_dpT)
 {
-  unsigned int offset = 0;
+  const int n = responses.size();
+  Teuchos::Array< RCP<Tpetra_Vector> > local_gT(n);
+  Teuchos::Array< RCP<Tpetra_MultiVector> >
+    local_dgdxT(n), local_dgdxdotT(n), local_dgdxdotdotT(n), local_dgdpT(n);
+  std::vector<FieldManagerScalarResponseFunction*> swept;
+  std::vector<Tpetra_Vector*> swept_gT;
+  std::vector<Tpetra_MultiVector*>
+    swept_dgdxT, swept_dgdxdotT, swept_dgdxdotdotT;
   for (unsigned int i=0; i<responses.size(); i++) {
 
     // Create Tpetra_Map for response function
@@ -284,56 +321,69 @@ evaluateGradientT(const double current_time,
     Teuchos::RCP<Tpetra_Map> local_response_map = Teuchos::rcp(new Tpetra_Map(num_responses, 0, commT, lg));
 
     // Create Epetra_Vectors for response function
-    RCP<Tpetra_Vector> local_gT;
     if (gT != NULL)
-      local_gT = rcp(new Tpetra_Vector(local_response_map));
-    RCP<Tpetra_MultiVector> local_dgdxT;
+      local_gT[i] = rcp(new Tpetra_Vector(local_response_map));
     if (dg_dxT != NULL)
-      local_dgdxT = rcp(new Tpetra_MultiVector(dg_dxT->getMap(), num_responses));
-    RCP<Tpetra_MultiVector> local_dgdxdotT;
+      local_dgdxT[i] = rcp(new Tpetra_MultiVector(dg_dxT->getMap(), num_responses));
     if (dg_dxdotT != NULL)
-      local_dgdxdotT = rcp(new Tpetra_MultiVector(dg_dxdotT->getMap(), 
+      local_dgdxdotT[i] = rcp(new Tpetra_MultiVector(dg_dxdotT->getMap(), 
 						 num_responses));
-    RCP<Tpetra_MultiVector> local_dgdxdotdotT;
     if (dg_dxdotdotT != NULL)
-      local_dgdxdotdotT = rcp(new Tpetra_MultiVector(dg_dxdotdotT->getMap(), num_responses));
-    RCP<Tpetra_MultiVector> local_dgdpT;
+      local_dgdxdotdotT[i] = rcp(new Tpetra_MultiVector(dg_dxdotdotT->getMap(), num_responses));
     if (dg_dpT != NULL)
-      local_dgdpT = rcp(new Tpetra_MultiVector(local_response_map, 
+      local_dgdpT[i] = rcp(new Tpetra_MultiVector(local_response_map, 
 					      dg_dpT->getNumVectors()));
 
-    // Evaluate response function
-    responses[i]->evaluateGradientT(current_time, xdotT, xdotdotT, xT, p, deriv_p, 
-				   local_gT.get(), local_dgdxT.get(), 
-				   local_dgdxdotT.get(), local_dgdxdotdotT.get(), local_dgdpT.get());
+    // Evaluate response function, or leave it to the shared sweep. The field
+    // manager responses do not compute dg/dp in evaluateGradientT.
+    FieldManagerScalarResponseFunction* response = sharedSweepResponse(i, true);
+    if (response != NULL) {
+      swept.push_back(response);
+      swept_gT.push_back(local_gT[i].get());
+      swept_dgdxT.push_back(local_dgdxT[i].get());
+      swept_dgdxdotT.push_back(local_dgdxdotT[i].get());
+      swept_dgdxdotdotT.push_back(local_dgdxdotdotT[i].get());
+    }
+    else
+      responses[i]->evaluateGradientT(current_time, xdotT, xdotdotT, xT, p, deriv_p, 
+				   local_gT[i].get(), local_dgdxT[i].get(), 
+				   local_dgdxdotT[i].get(), local_dgdxdotdotT[i].get(), local_dgdpT[i].get());
+  }
+  FieldManagerScalarResponseFunction::evaluateGradientsT(
+    swept, current_time, xdotT, xdotdotT, xT, p, swept_gT, swept_dgdxT,
+    swept_dgdxdotT, swept_dgdxdotdotT);
+
+  unsigned int offset = 0;
+  for (unsigned int i=0; i<responses.size(); i++) {
+    unsigned int num_responses = responses[i]->numResponses();
 
     // Copy results into combined result
     for (unsigned int j=0; j<num_responses; j++) {
       if (gT != NULL) {
-        const Teuchos::ArrayRCP<const ST> local_gT_constView = local_gT->get1dView();
+        const Teuchos::ArrayRCP<const ST> local_gT_constView = local_gT[i]->get1dView();
         const Teuchos::ArrayRCP<ST> gT_nonconstView = gT->get1dViewNonConst();
         gT_nonconstView[offset+j] = local_gT_constView[j];
       }
       if (dg_dxT != NULL) {
         Teuchos::RCP<Tpetra_Vector> dg_dxT_vec = dg_dxT->getVectorNonConst(offset+j); 
-        Teuchos::RCP<const Tpetra_Vector> local_dgdxT_vec = local_dgdxT->getVector(j);
+        Teuchos::RCP<const Tpetra_Vector> local_dgdxT_vec = local_dgdxT[i]->getVector(j);
         dg_dxT_vec->update(1.0, *local_dgdxT_vec, 0.0);  
       }
       if (dg_dxdotT != NULL) {
         Teuchos::RCP<Tpetra_Vector> dg_dxdotT_vec = dg_dxdotT->getVectorNonConst(offset+j); 
-        Teuchos::RCP<const Tpetra_Vector> local_dgdxdotT_vec = local_dgdxdotT->getVector(j);
+        Teuchos::RCP<const Tpetra_Vector> local_dgdxdotT_vec = local_dgdxdotT[i]->getVector(j);
         dg_dxdotT_vec->update(1.0, *local_dgdxdotT_vec, 0.0);  
         }
       if (dg_dxdotdotT != NULL){
         Teuchos::RCP<Tpetra_Vector> dg_dxdotdotT_vec = dg_dxdotdotT->getVectorNonConst(offset+j); 
-        Teuchos::RCP<const Tpetra_Vector> local_dgdxdotdotT_vec = local_dgdxdotdotT->getVector(j);
+        Teuchos::RCP<const Tpetra_Vector> local_dgdxdotdotT_vec = local_dgdxdotdotT[i]->getVector(j);
         dg_dxdotdotT_vec->update(1.0, *local_dgdxdotdotT_vec, 0.0);  
       }
       if (dg_dpT != NULL) {
         Teuchos::ArrayRCP<ST> dg_dpT_nonconstView;
         Teuchos::ArrayRCP<const ST> local_dgdpT_constView;
 	for (int k=0; k<dg_dpT->getNumVectors(); k++) {
-          local_dgdpT_constView = local_dgdpT->getData(k); 
+          local_dgdpT_constView = local_dgdpT[i]->getData(k); 
           dg_dpT_nonconstView = dg_dpT->getDataNonConst(k); 
 	  dg_dpT_nonconstView[offset+j] = local_dgdpT_constView[j];
         }
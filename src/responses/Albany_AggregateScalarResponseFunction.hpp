@@ -8,6 +8,7 @@
 #define ALBANY_AGGREGATE_SCALAR_RESPONSE_FUNCTION_HPP
 
 #include "Albany_SamplingBasedScalarResponseFunction.hpp"
+#include "Albany_FieldManagerScalarResponseFunction.hpp"
 #include "Teuchos_Array.hpp"
 
 namespace Albany {
@@ -21,9 +22,14 @@ namespace Albany {
   public:
   
     //! Default constructor
+    /*!
+     * If fused is true, the field manager responses are evaluated in one
+     * sweep over the worksets instead of one sweep per response.
+     */
     AggregateScalarResponseFunction(
       const Teuchos::RCP<const Teuchos_Comm>& commT,
-      const Teuchos::Array< Teuchos::RCP<ScalarResponseFunction> >& responses);
+      const Teuchos::Array< Teuchos::RCP<ScalarResponseFunction> >& responses,
+      const bool fused = false);
 
 #if defined(ALBANY_EPETRA)
     //! Setup response function
@@ -121,6 +127,14 @@ namespace Albany {
     //! Private to prohibit copying
     AggregateScalarResponseFunction& operator=(const AggregateScalarResponseFunction&);
 
+    //! Response i as a field manager response if it takes part in the shared
+    //! sweep of the response (or gradient) evaluation, NULL otherwise
+    FieldManagerScalarResponseFunction*
+    sharedSweepResponse(const int i, const bool gradient) const;
+
+    //! Evaluate field manager responses in one shared sweep
+    bool fused;
+
   protected:
 
     //! Response functions to aggregate
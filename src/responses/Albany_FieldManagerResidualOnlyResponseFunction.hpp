@@ -93,6 +93,9 @@ namespace Albany {
           const std::string& dist_param_name,
           Tpetra_MultiVector* dg_dpT);
 
+    //! The gradient is not a workset sweep of the response field manager
+    virtual bool sharesGradientSweep() const { return false; }
+
   private:
 
     //! Private to prohibit copying
@@ -24,6 +24,7 @@ FieldManagerScalarResponseFunction(
   problem(problem_),
   meshSpecs(meshSpecs_),
   stateMgr(stateMgr_),
+  ws_filter_conn(NULL),
   performedPostRegSetup(false)
 {
   setup(responseParams);
@@ -40,6 +41,7 @@ FieldManagerScalarResponseFunction(
   problem(problem_),
   meshSpecs(meshSpecs_),
   stateMgr(stateMgr_),
+  ws_filter_conn(NULL),
   performedPostRegSetup(false)
 {
 }
@@ -70,6 +72,28 @@ setup(Teuchos::ParameterList& responseParams)
   element_block_index = reb ? meshSpecs->ebNameToIndex[meshSpecs->ebName] : -1;
   if (reb_parm_present) responseParams.remove(reb_parm, false);
 
+  // Restrict to the worksets with sides in some side sets?
+  const char* rss_parm = "Restrict to Side Sets";
+  const bool rss_parm_present =
+    responseParams.isType<Teuchos::Array<std::string> >(rss_parm);
+  Teuchos::Array<std::string> rss;
+  if (rss_parm_present) {
+    rss = responseParams.get<Teuchos::Array<std::string> >(rss_parm);
+    responseParams.remove(rss_parm, false);
+  }
+  side_set_names.assign(rss.begin(), rss.end());
+
+  // Restrict to the worksets of some element blocks, by name?
+  const char* rebs_parm = "Restrict to Element Blocks";
+  const bool rebs_parm_present =
+    responseParams.isType<Teuchos::Array<std::string> >(rebs_parm);
+  Teuchos::Array<std::string> rebs;
+  if (rebs_parm_present) {
+    rebs = responseParams.get<Teuchos::Array<std::string> >(rebs_parm);
+    responseParams.remove(rebs_parm, false);
+  }
+  element_block_names.assign(rebs.begin(), rebs.end());
+
   // Create field manager
   rfm = Teuchos::rcp(new PHX::FieldManager<PHAL::AlbanyTraits>);
     
@@ -97,6 +121,8 @@ setup(Teuchos::ParameterList& responseParams)
 		 vis_response_name.begin(), ::tolower);
 
   if (reb_parm_present) responseParams.set<bool>(reb_parm, reb);
+  if (rss_parm_present) responseParams.set(rss_parm, rss);
+  if (rebs_parm_present) responseParams.set(rebs_parm, rebs);
 }
 
 Albany::FieldManagerScalarResponseFunction::
@@ -143,17 +169,189 @@ postRegSetup()
 template<typename EvalT>
 void Albany::FieldManagerScalarResponseFunction::
 evaluate (PHAL::Workset& workset) {
-  const WorksetArray<int>::type&
-    wsPhysIndex = application->getDiscretization()->getWsPhysIndex();
-  rfm->preEvaluate<EvalT>(workset);
-  for (int ws = 0, numWorksets = application->getNumWorksets();
+  std::vector<FieldManagerScalarResponseFunction*> responses(1, this);
+  std::vector<PHAL::Workset> worksets(1, workset);
+  evaluate<EvalT>(responses, worksets);
+  workset = worksets[0];
+}
+
+template<typename EvalT>
+void Albany::FieldManagerScalarResponseFunction::
+evaluate (const std::vector<FieldManagerScalarResponseFunction*>& responses,
+          std::vector<PHAL::Workset>& worksets) {
+  const Teuchos::RCP<Albany::Application>& app = responses[0]->application;
+  for (std::size_t i = 0; i < responses.size(); i++) {
+    responses[i]->updateWorksetFilter();
+    responses[i]->rfm->preEvaluate<EvalT>(worksets[i]);
+  }
+  for (int ws = 0, numWorksets = app->getNumWorksets();
        ws < numWorksets; ws++) {
+    for (std::size_t i = 0; i < responses.size(); i++) {
+      if (!responses[i]->ws_filter[ws])
+        continue;
+      app->loadWorksetBucketInfo<EvalT>(worksets[i], ws);
+      responses[i]->rfm->evaluateFields<EvalT>(worksets[i]);
+    }
+  }
+  for (std::size_t i = 0; i < responses.size(); i++)
+    responses[i]->rfm->postEvaluate<EvalT>(worksets[i]);
+}
+
+void
+Albany::FieldManagerScalarResponseFunction::
+updateWorksetFilter()
+{
+  const Teuchos::RCP<Albany::AbstractDiscretization>
+    disc = application->getDiscretization();
+  const int numWorksets = application->getNumWorksets();
+
+  // The worksets only change on adaptation, which reallocates their
+  // connectivity
+  const void* conn =
+    numWorksets > 0 ? disc->getWsElNodeEqID()[0].data() : NULL;
+  if (static_cast<int>(ws_filter.size()) == numWorksets &&
+      ws_filter_conn == conn)
+    return;
+  ws_filter_conn = conn;
+
+  const WorksetArray<int>::type& wsPhysIndex = disc->getWsPhysIndex();
+  const WorksetArray<std::string>::type& wsEBNames = disc->getWsEBNames();
+  ws_filter.assign(numWorksets, 1);
+  for (int ws = 0; ws < numWorksets; ws++) {
     if (element_block_index >= 0 && element_block_index != wsPhysIndex[ws])
-      continue;
-    application->loadWorksetBucketInfo<EvalT>(workset, ws);
-    rfm->evaluateFields<EvalT>(workset);
+      ws_filter[ws] = 0;
+    else if (!element_block_names.empty() &&
+             std::find(element_block_names.begin(), element_block_names.end(),
+                       wsEBNames[ws]) == element_block_names.end())
+      ws_filter[ws] = 0;
+    else if (!side_set_names.empty()) {
+      const Albany::AbstractDiscretization::SideSetList&
+        ssList = disc->getSideSets(ws);
+      bool hasSides = false;
+      for (std::size_t i = 0; !hasSides && i < side_set_names.size(); i++)
+        hasSides = ssList.find(side_set_names[i]) != ssList.end();
+      ws_filter[ws] = hasSides;
+    }
+  }
+}
+
+void
+Albany::FieldManagerScalarResponseFunction::
+evaluateResponsesT(
+  const std::vector<FieldManagerScalarResponseFunction*>& responses,
+  const double current_time,
+  const Tpetra_Vector* xdotT,
+  const Tpetra_Vector* xdotdotT,
+  const Tpetra_Vector& xT,
+  const Teuchos::Array<ParamVec>& p,
+  const std::vector<Tpetra_Vector*>& gT)
+{
+  if (responses.empty()) return;
+  for (std::size_t i = 0; i < responses.size(); i++) {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        !responses[i]->performedPostRegSetup,
+        Teuchos::Exceptions::InvalidParameter,
+        std::endl << "Post registration setup not performed in field manager " <<
+        std::endl << "Forgot to call \"postRegSetup\"? ");
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        responses[i]->application != responses[0]->application,
+        std::logic_error,
+        "Responses evaluated in one sweep must share the application.");
+    responses[i]->visResponseGraph<PHAL::AlbanyTraits::Residual>("");
+  }
+
+  // Set data in Workset struct once, then give each response its own copy
+  PHAL::Workset workset;
+  responses[0]->application->setupBasicWorksetInfoT(
+    workset, current_time, rcp(xdotT, false), rcp(xdotdotT, false),
+    rcpFromRef(xT), p);
+  std::vector<PHAL::Workset> worksets(responses.size(), workset);
+  for (std::size_t i = 0; i < responses.size(); i++)
+    worksets[i].gT = Teuchos::rcp(gT[i], false);
+
+  // Perform fill via field managers
+  evaluate<PHAL::AlbanyTraits::Residual>(responses, worksets);
+}
+
+void
+Albany::FieldManagerScalarResponseFunction::
+evaluateGradientsT(
+  const std::vector<FieldManagerScalarResponseFunction*>& responses,
+  const double current_time,
+  const Tpetra_Vector* xdotT,
+  const Tpetra_Vector* xdotdotT,
+  const Tpetra_Vector& xT,
+  const Teuchos::Array<ParamVec>& p,
+  const std::vector<Tpetra_Vector*>& gT,
+  const std::vector<Tpetra_MultiVector*>& dg_dxT,
+  const std::vector<Tpetra_MultiVector*>& dg_dxdotT,
+  const std::vector<Tpetra_MultiVector*>& dg_dxdotdotT)
+{
+  if (responses.empty()) return;
+  for (std::size_t i = 0; i < responses.size(); i++) {
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        !responses[i]->performedPostRegSetup,
+        Teuchos::Exceptions::InvalidParameter,
+        std::endl << "Post registration setup not performed in field manager " <<
+        std::endl << "Forgot to call \"postRegSetup\"? ");
+    TEUCHOS_TEST_FOR_EXCEPTION(
+        responses[i]->application != responses[0]->application,
+        std::logic_error,
+        "Responses evaluated in one sweep must share the application.");
+    responses[i]->visResponseGraph<PHAL::AlbanyTraits::Jacobian>("_gradient");
+  }
+
+  // Set data in Workset struct once, then give each response its own copy
+  PHAL::Workset workset;
+  responses[0]->application->setupBasicWorksetInfoT(
+    workset, current_time, rcp(xdotT, false), rcp(xdotdotT, false),
+    rcpFromRef(xT), p);
+  std::vector<PHAL::Workset> worksets(responses.size(), workset);
+  for (std::size_t i = 0; i < responses.size(); i++)
+    worksets[i].gT = Teuchos::rcp(gT[i], false);
+  const Teuchos::RCP<const Tpetra_Map>
+    overlap_mapT = workset.x_importerT->getTargetMap();
+
+  // Perform fill via field managers (dg/dx)
+  if (dg_dxT[0] != NULL) {
+    for (std::size_t i = 0; i < responses.size(); i++) {
+      worksets[i].m_coeff = 0.0;
+      worksets[i].j_coeff = 1.0;
+      worksets[i].n_coeff = 0.0;
+      worksets[i].dgdxT = Teuchos::rcp(dg_dxT[i], false);
+      worksets[i].overlapped_dgdxT = Teuchos::rcp(
+        new Tpetra_MultiVector(overlap_mapT, dg_dxT[i]->getNumVectors()));
+    }
+    evaluate<PHAL::AlbanyTraits::Jacobian>(responses, worksets);
+  }
+
+  // Perform fill via field managers (dg/dxdot)
+  if (dg_dxdotT[0] != NULL) {
+    for (std::size_t i = 0; i < responses.size(); i++) {
+      worksets[i].m_coeff = 1.0;
+      worksets[i].j_coeff = 0.0;
+      worksets[i].n_coeff = 0.0;
+      worksets[i].dgdxT = Teuchos::null;
+      worksets[i].dgdxdotT = Teuchos::rcp(dg_dxdotT[i], false);
+      worksets[i].overlapped_dgdxdotT = Teuchos::rcp(
+        new Tpetra_MultiVector(overlap_mapT, dg_dxdotT[i]->getNumVectors()));
+    }
+    evaluate<PHAL::AlbanyTraits::Jacobian>(responses, worksets);
+  }
+
+  // Perform fill via field managers (dg/dxdotdot)
+  if (dg_dxdotdotT[0] != NULL) {
+    for (std::size_t i = 0; i < responses.size(); i++) {
+      worksets[i].m_coeff = 0.0;
+      worksets[i].j_coeff = 0.0;
+      worksets[i].n_coeff = 1.0;
+      worksets[i].dgdxT = Teuchos::null;
+      worksets[i].dgdxdotdotT = Teuchos::rcp(dg_dxdotdotT[i], false);
+      worksets[i].overlapped_dgdxdotdotT = Teuchos::rcp(
+        new Tpetra_MultiVector(overlap_mapT, dg_dxdotdotT[i]->getNumVectors()));
+    }
+    evaluate<PHAL::AlbanyTraits::Jacobian>(responses, worksets);
   }
-  rfm->postEvaluate<EvalT>(workset);
 }
 
 void
@@ -7,6 +7,8 @@
 #ifndef ALBANY_FIELD_MANAGER_SCALAR_RESPONSE_FUNCTION_HPP
 #define ALBANY_FIELD_MANAGER_SCALAR_RESPONSE_FUNCTION_HPP
 
+#include <vector>
+
 #include "Albany_ScalarResponseFunction.hpp"
 #include "Albany_Application.hpp"
 #include "Albany_AbstractProblem.hpp"
@@ -109,6 +111,42 @@ namespace Albany {
           const std::string& dist_param_name,
           Tpetra_MultiVector* dg_dpT);
 
+    //! True if evaluateResponseT is the workset sweep of the response field
+    //! manager, so that it can share a sweep with other responses.
+    virtual bool sharesResponseSweep() const { return true; }
+
+    //! True if evaluateGradientT is the workset sweep of the response field
+    //! manager, so that it can share a sweep with other responses.
+    virtual bool sharesGradientSweep() const { return true; }
+
+    //! Evaluate several responses in one sweep over the worksets. The
+    //! solution is scattered to the overlapped map once for all of them.
+    //! All responses must belong to the same application.
+    static void
+    evaluateResponsesT(
+      const std::vector<FieldManagerScalarResponseFunction*>& responses,
+      const double current_time,
+      const Tpetra_Vector* xdotT,
+      const Tpetra_Vector* xdotdotT,
+      const Tpetra_Vector& xT,
+      const Teuchos::Array<ParamVec>& p,
+      const std::vector<Tpetra_Vector*>& gT);
+
+    //! Gradient counterpart of evaluateResponsesT. Each of the dg/dx,
+    //! dg/dxdot and dg/dxdotdot fills is one sweep for all the responses.
+    static void
+    evaluateGradientsT(
+      const std::vector<FieldManagerScalarResponseFunction*>& responses,
+      const double current_time,
+      const Tpetra_Vector* xdotT,
+      const Tpetra_Vector* xdotdotT,
+      const Tpetra_Vector& xT,
+      const Teuchos::Array<ParamVec>& p,
+      const std::vector<Tpetra_Vector*>& gT,
+      const std::vector<Tpetra_MultiVector*>& dg_dxT,
+      const std::vector<Tpetra_MultiVector*>& dg_dxdotT,
+      const std::vector<Tpetra_MultiVector*>& dg_dxdotdotT);
+
   private:
 
     //! Private to prohibit copying
@@ -166,10 +204,34 @@ namespace Albany {
 
     template <typename EvalT> void evaluate(PHAL::Workset& workset);
 
+    //! Sweep over the worksets once, evaluating the field manager of each
+    //! response on its own copy of the workset.
+    template <typename EvalT>
+    static void
+    evaluate(
+      const std::vector<FieldManagerScalarResponseFunction*>& responses,
+      std::vector<PHAL::Workset>& worksets);
+
     //! Restrict the field manager to an element block, as is done for fm and
     //! sfm in Albany::Application.
     int element_block_index;
 
+    //! Side sets the response is integrated over. If not empty, the worksets
+    //! without a side in any of them are skipped: the response and its
+    //! derivatives get nothing from them.
+    std::vector<std::string> side_set_names;
+
+    //! Element blocks the response is restricted to, by name. If not
+    //! empty, the worksets of the other blocks are skipped.
+    std::vector<std::string> element_block_names;
+
+    //! Whether each workset is visited by the response, built from the
+    //! restrictions above when the worksets change
+    std::vector<char> ws_filter;
+    const void* ws_filter_conn;
+
+    void updateWorksetFilter();
+
     bool performedPostRegSetup;
   };
 
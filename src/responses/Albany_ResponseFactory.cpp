@@ -12,6 +12,7 @@
 #include "Albany_SolutionValuesResponseFunction.hpp"
 #include "Albany_SolutionMaxValueResponseFunction.hpp"
 #include "Albany_SolutionMinValueResponseFunction.hpp"
+#include "Albany_SolutionStatisticsResponseFunction.hpp"
 #include "Albany_SolutionFileResponseFunction.hpp"
 #ifdef ALBANY_PERIDIGM
 #ifdef ALBANY_EPETRA
@@ -35,6 +36,8 @@
 
 #include "Teuchos_TestForException.hpp"
 
+#include <sstream>
+
 void
 Albany::ResponseFactory::
 createResponseFunction(
@@ -79,14 +82,23 @@ createResponseFunction(
       rcp(new Albany::SolutionMinValueResponseFunction(comm, neq, eq, inor)));
   }
 
+  else if (name == "Solution Statistics") {
+    int eq = responseParams.get("Equation", 0);
+    int neq = app->getNumEquations();
+    bool inor =  responseParams.get("Interleaved Ordering", true);
+
+    responses.push_back(
+      rcp(new Albany::SolutionStatisticsResponseFunction(comm, neq, eq, inor)));
+  }
+
   else if (name == "Solution Two Norm File") {
     responses.push_back(
-      rcp(new Albany::SolutionFileResponseFunction<Albany::NormTwo>(comm)));
+      rcp(new Albany::SolutionFileResponseFunction<Albany::NormTwo>(comm, responseParams)));
   }
 
   else if (name == "Solution Inf Norm File") {
     responses.push_back(
-      rcp(new Albany::SolutionFileResponseFunction<Albany::NormInf>(comm)));
+      rcp(new Albany::SolutionFileResponseFunction<Albany::NormInf>(comm, responseParams)));
   }
 
   else if (name == "OBC Functional") {
@@ -116,8 +128,10 @@ createResponseFunction(
           "The aggregated response can only aggregate scalar response " << "functions!");
       scalar_responses[i] = Teuchos::rcp_dynamic_cast<ScalarResponseFunction>(aggregated_responses[i]);
     }
-    if(name == "Aggregate Responses")
-      responses.push_back(rcp(new Albany::AggregateScalarResponseFunction(comm, scalar_responses)));
+    if(name == "Aggregate Responses") {
+      const bool fused = responseParams.get<bool>("Fused Evaluation", false);
+      responses.push_back(rcp(new Albany::AggregateScalarResponseFunction(comm, scalar_responses, fused)));
+    }
     else
       responses.push_back(rcp(new Albany::CumulativeScalarResponseFunction(comm, scalar_responses)));
   }
@@ -166,8 +180,38 @@ createResponseFunction(
      name == "PHAL Field Integral" ||
      name == "PHAL Field IntegralT" ||
      name == "PHAL Thermal EnergyT" ||
+     name == "Stable Time Step" ||
      name == "AMP Energy") {
     responseParams.set("Name", name);
+    // The FELIX misfit responses only have terms on their side sets, so
+    // the worksets without such sides need not be evaluated
+    const char* rss_parm = "Restrict to Side Sets";
+    if (!responseParams.isType<Teuchos::Array<std::string> >(rss_parm) &&
+        (name == "Surface Velocity Mismatch" ||
+         name == "Surface Mass Balance Mismatch" ||
+         name == "Boundary Squared L2 Norm")) {
+      Teuchos::Array<std::string> sideSets;
+      if (name == "Surface Velocity Mismatch" &&
+          responseParams.isType<std::string>("Surface Side Name"))
+        sideSets.push_back(responseParams.get<std::string>("Surface Side Name"));
+      if (responseParams.isType<std::string>("Basal Side Name"))
+        sideSets.push_back(responseParams.get<std::string>("Basal Side Name"));
+      if (sideSets.size() > 0)
+        responseParams.set(rss_parm, sideSets);
+    }
+    // Likewise the field integrals only have terms on their element blocks
+    const char* rebs_parm = "Restrict to Element Blocks";
+    if (!responseParams.isType<Teuchos::Array<std::string> >(rebs_parm) &&
+        (name == "PHAL Field Integral" || name == "PHAL Field IntegralT") &&
+        responseParams.isType<std::string>("Element Block Name")) {
+      Teuchos::Array<std::string> blocks;
+      std::stringstream ss(responseParams.get<std::string>("Element Block Name"));
+      std::string block;
+      while (std::getline(ss, block, ','))
+        blocks.push_back(block);
+      if (blocks.size() > 0)
+        responseParams.set(rebs_parm, blocks);
+    }
     for (int i=0; i<meshSpecs.size(); i++) {
 #if defined(ALBANY_LCM)
       // Skip if dealing with interface block
@@ -47,6 +47,17 @@ Teuchos::Array<Tpetra_GO>
 Albany::UniformSolutionCullingStrategy::
 selectedGIDsT(Teuchos::RCP<const Tpetra_Map> sourceMapT) const
 {
+  // The sorted GIDs of a contiguous map are known without communication
+  if (sourceMapT->isContiguous()) {
+    const Tpetra_GO numGIDs = sourceMapT->getGlobalNumElements();
+    Teuchos::Array<Tpetra_GO> result(numValues_);
+    const Tpetra_GO stride = 1 + (numGIDs - 1) / numValues_;
+    for (int i = 0; i < numValues_; ++i) {
+      result[i] = sourceMapT->getMinAllGlobalIndex() + i * stride;
+    }
+    return result;
+  }
+
   Teuchos::Array<Tpetra_GO> allGIDs(sourceMapT->getGlobalNumElements());
   {
     const int ierr = Tpetra::GatherAllV(
@@ -70,6 +81,16 @@ Teuchos::Array<int>
 Albany::UniformSolutionCullingStrategy::
 selectedGIDs(const Epetra_BlockMap &sourceMap) const
 {
+  // The sorted GIDs of a contiguous map are known without communication
+  if (sourceMap.LinearMap()) {
+    Teuchos::Array<int> result(numValues_);
+    const int stride = 1 + (sourceMap.NumGlobalElements() - 1) / numValues_;
+    for (int i = 0; i < numValues_; ++i) {
+      result[i] = sourceMap.MinAllGID() + i * stride;
+    }
+    return result;
+  }
+
   Teuchos::Array<int> allGIDs(sourceMap.NumGlobalElements());
   {
     const int ierr = Epetra::GatherAllV(
@@ -321,31 +342,20 @@ Teuchos::Array<int>
 Albany::NodeGIDsSolutionCullingStrategy::
 selectedGIDs(const Epetra_BlockMap &sourceMap) const
 {
-  Teuchos::Array<int> result;
-  {
-    Teuchos::Array<int> mySelectedGIDs;
-
-    // Subract 1 to convert exodus GIDs to our GIDs
-    for (int i=0; i<nodeGIDs_.size(); i++)
-      if (sourceMap.MyGID(nodeGIDs_[i] -1) ) mySelectedGIDs.push_back(nodeGIDs_[i] - 1);
-
-    const Epetra_Comm &comm = sourceMap.Comm();
+  // Every rank has the requested GIDs, so only their existence is looked
+  // up in the directory, rather than gathering the selection everywhere
+  // Subract 1 to convert exodus GIDs to our GIDs
+  Teuchos::Array<int> requestedGIDs(nodeGIDs_.size());
+  for (int i=0; i<nodeGIDs_.size(); i++)
+    requestedGIDs[i] = nodeGIDs_[i] - 1;
 
-    {
-      int selectedGIDCount;
-      {
-        int mySelectedGIDCount = mySelectedGIDs.size();
-        comm.SumAll(&mySelectedGIDCount, &selectedGIDCount, 1);
-      }
-      result.resize(selectedGIDCount);
-    }
+  Teuchos::Array<int> owners(requestedGIDs.size()), lids(requestedGIDs.size());
+  sourceMap.RemoteIDList(requestedGIDs.size(), requestedGIDs.getRawPtr(),
+                         owners.getRawPtr(), lids.getRawPtr());
 
-    const int ierr = Epetra::GatherAllV(
-        comm,
-        mySelectedGIDs.getRawPtr(), mySelectedGIDs.size(),
-        result.getRawPtr(), result.size());
-    TEUCHOS_ASSERT(ierr == 0);
-  }
+  Teuchos::Array<int> result;
+  for (int i=0; i<requestedGIDs.size(); i++)
+    if (owners[i] >= 0) result.push_back(requestedGIDs[i]);
 
   std::sort(result.begin(), result.end());
 
@@ -357,30 +367,19 @@ Teuchos::Array<Tpetra_GO>
 Albany::NodeGIDsSolutionCullingStrategy::
 selectedGIDsT(Teuchos::RCP<const Tpetra_Map> sourceMapT) const
 {
-  Teuchos::Array<Tpetra_GO> result;
-  {
-    Teuchos::Array<Tpetra_GO> mySelectedGIDs;
+  // Every rank has the requested GIDs, so only their existence is looked
+  // up in the directory, rather than gathering the selection everywhere
+  // Subract 1 to convert exodus GIDs to our GIDs
+  Teuchos::Array<Tpetra_GO> requestedGIDs(nodeGIDs_.size());
+  for (int i=0; i<nodeGIDs_.size(); i++)
+    requestedGIDs[i] = nodeGIDs_[i] - 1;
 
-    // Subract 1 to convert exodus GIDs to our GIDs
-    for (int i=0; i<nodeGIDs_.size(); i++)
-      if (sourceMapT->isNodeGlobalElement(nodeGIDs_[i] -1) ) mySelectedGIDs.push_back(nodeGIDs_[i] - 1);
+  Teuchos::Array<int> owners(requestedGIDs.size());
+  sourceMapT->getRemoteIndexList(requestedGIDs(), owners());
 
-    Teuchos::RCP<const Teuchos::Comm<int> >commT = sourceMapT->getComm(); 
-    {
-      Tpetra_GO selectedGIDCount;
-      {
-        Tpetra_GO mySelectedGIDCount = mySelectedGIDs.size();
-        Teuchos::reduceAll<LO, Tpetra_GO>(*commT, Teuchos::REDUCE_SUM, 1, &mySelectedGIDCount, &selectedGIDCount); 
-      }
-      result.resize(selectedGIDCount);
-    }
-
-    const int ierr = Tpetra::GatherAllV(
-        commT,
-        mySelectedGIDs.getRawPtr(), mySelectedGIDs.size(),
-        result.getRawPtr(), result.size());
-    TEUCHOS_ASSERT(ierr == 0);
-  }
+  Teuchos::Array<Tpetra_GO> result;
+  for (int i=0; i<requestedGIDs.size(); i++)
+    if (owners[i] >= 0) result.push_back(requestedGIDs[i]);
 
   std::sort(result.begin(), result.end());
 
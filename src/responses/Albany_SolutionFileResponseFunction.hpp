@@ -14,6 +14,13 @@ namespace Albany {
 
   /*!
    * \brief Response function representing the difference from a stored vector on disk
+   *
+   * The reference is read from "Reference Solution File", or, to compare
+   * against a time series, from the entry of "Reference Solution Files"
+   * whose "Reference Solution Times" entry is nearest to the current time.
+   * Files are MatrixMarket arrays, or with "Reference Solution Format" set to
+   * "Binary", two int64 (rows, columns = 1) followed by the doubles in GID
+   * order, which every rank reads its own part of.
    */
   template<class VectorNorm>
   class SolutionFileResponseFunction : 
@@ -21,7 +28,8 @@ namespace Albany {
   public:
   
     //! Default constructor
-    SolutionFileResponseFunction(const Teuchos::RCP<const Teuchos_Comm>& commT);
+    SolutionFileResponseFunction(const Teuchos::RCP<const Teuchos_Comm>& commT,
+                                 Teuchos::ParameterList& responseParams);
 
     //! Destructor
     virtual ~SolutionFileResponseFunction();
@@ -118,6 +126,26 @@ namespace Albany {
 
     bool solutionLoaded;
 
+    //! Reference file, or files of the snapshots and their times
+    std::string refFile;
+    Teuchos::Array<std::string> refFiles;
+    Teuchos::Array<double> refTimes;
+    bool binaryFormat;
+
+    //! Snapshot held by RefSolnT, -1 if none
+    int loadedSnapshotT;
+
+    //! Difference between the solution and the reference, reused across calls
+    Teuchos::RCP<Tpetra_Vector> diffT;
+
+    //! Index of the snapshot to compare against at time current_time
+    int snapshotIndex(const double current_time) const;
+
+    //! Load the reference for current_time if needed, and compute diffT
+    const Tpetra_Vector& computeDiffT(const double current_time, const Tpetra_Vector& xT);
+
+    int BinaryFileToTpetraVector( const char *filename, const Tpetra_Map & map, Tpetra_Vector * & A);
+
 #if defined(ALBANY_EPETRA)
     //! Basic idea borrowed from EpetraExt - TO DO: put it back there?
     int MatrixMarketFileToVector( const char *filename, const Epetra_BlockMap & map, Epetra_Vector * & A);
@@ -14,34 +14,93 @@
 #include "Teuchos_CommHelpers.hpp"
 #include "Tpetra_DistObject.hpp"
 
-#if defined(ALBANY_EPETRA)
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+
 template<class Norm>
 Albany::SolutionFileResponseFunction<Norm>::
-SolutionFileResponseFunction(const Teuchos::RCP<const Teuchos_Comm>& commT)
+SolutionFileResponseFunction(const Teuchos::RCP<const Teuchos_Comm>& commT,
+                             Teuchos::ParameterList& responseParams)
   : SamplingBasedScalarResponseFunction(commT),
-    RefSoln(NULL), RefSolnT(NULL), solutionLoaded(false)
+#if defined(ALBANY_EPETRA)
+    RefSoln(NULL),
+#endif
+    RefSolnT(NULL), solutionLoaded(false), loadedSnapshotT(-1)
 {
+  refFile = responseParams.get<std::string>("Reference Solution File", "reference_solution.dat");
+  if (responseParams.isParameter("Reference Solution Files")) {
+    refFiles = responseParams.get<Teuchos::Array<std::string> >("Reference Solution Files");
+    refTimes = responseParams.get<Teuchos::Array<double> >("Reference Solution Times");
+    TEUCHOS_TEST_FOR_EXCEPTION(refFiles.size() != refTimes.size() || refFiles.size() == 0,
+      std::logic_error,
+      std::endl << "Reference Solution Files and Reference Solution Times must be "
+      "non-empty and of the same length." << std::endl);
+  }
+  const std::string format = responseParams.get<std::string>("Reference Solution Format", "MatrixMarket");
+  TEUCHOS_TEST_FOR_EXCEPTION(format != "MatrixMarket" && format != "Binary",
+    std::logic_error,
+    std::endl << "Unknown Reference Solution Format " << format
+    << ", valid choices are MatrixMarket and Binary." << std::endl);
+  binaryFormat = (format == "Binary");
 }
-#else
+
 template<class Norm>
 Albany::SolutionFileResponseFunction<Norm>::
-SolutionFileResponseFunction(const Teuchos::RCP<const Teuchos_Comm>& commT)
-  : SamplingBasedScalarResponseFunction(commT),
-    RefSolnT(NULL), solutionLoaded(false)
+~SolutionFileResponseFunction()
 {
-}
+#if defined(ALBANY_EPETRA)
+  if (solutionLoaded)
+    delete RefSoln;
 #endif
+  delete RefSolnT;
+}
 
 template<class Norm>
+int
 Albany::SolutionFileResponseFunction<Norm>::
-~SolutionFileResponseFunction()
+snapshotIndex(const double current_time) const
 {
-  if (solutionLoaded) {
-#if defined(ALBANY_EPETRA)
-    delete RefSoln; 
-#endif
-    delete RefSolnT; 
+  if (refTimes.size() == 0) return 0;
+
+  int nearest = 0;
+  for (int i = 1; i < refTimes.size(); ++i)
+    if (std::abs(refTimes[i] - current_time) < std::abs(refTimes[nearest] - current_time))
+      nearest = i;
+  return nearest;
+}
+
+template<class Norm>
+const Tpetra_Vector&
+Albany::SolutionFileResponseFunction<Norm>::
+computeDiffT(const double current_time, const Tpetra_Vector& xT)
+{
+  // Snapshots are only read again when the time moves to another one
+  const int snapshot = snapshotIndex(current_time);
+  if (snapshot != loadedSnapshotT) {
+    const std::string& filename = refTimes.size() == 0 ? refFile : refFiles[snapshot];
+
+    delete RefSolnT;
+    RefSolnT = NULL;
+
+    int fileStatus = binaryFormat ?
+      BinaryFileToTpetraVector(filename.c_str(),*(xT.getMap()),RefSolnT) :
+      MatrixMarketFileToTpetraVector(filename.c_str(),*(xT.getMap()),RefSolnT);
+
+    TEUCHOS_TEST_FOR_EXCEPTION(fileStatus, std::runtime_error,
+      std::endl << "Reading reference solution file " << filename << " in file " __FILE__
+      " line " << __LINE__ << " returned " << fileStatus << std::endl);
+
+    loadedSnapshotT = snapshot;
   }
+
+  if (diffT.is_null() || !diffT->getMap()->isSameAs(*xT.getMap()))
+    diffT = Teuchos::rcp(new Tpetra_Vector(xT.getMap()));
+
+  // The diff vector equals 1.0 * soln + -1.0 * reference
+  diffT->update(1.0,xT,-1.0,*RefSolnT,0.0);
+
+  return *diffT;
 }
 
 template<class Norm>
@@ -62,47 +121,10 @@ evaluateResponseT(const double current_time,
 		 const Teuchos::Array<ParamVec>& p,
 		 Tpetra_Vector& gT)
 {
-  int MMFileStatus = 0;
-
-  // Read the reference solution for comparison from "reference_solution.dat"
-
-  // Note that this is of MatrixMarket array real general format
-
-  if (!solutionLoaded) {
-//    MMFileStatus = EpetraExt::MatrixMarketFileToVector("reference_solution.dat",x.Map(),RefSoln);
-    MMFileStatus = MatrixMarketFileToTpetraVector("reference_solution.dat",*(xT.getMap()),RefSolnT);
-
-    TEUCHOS_TEST_FOR_EXCEPTION(MMFileStatus, std::runtime_error,
-      std::endl << "EpetraExt::MatrixMarketFileToVector, file " __FILE__
-      " line " << __LINE__ << " returned " << MMFileStatus << std::endl);
-
-    solutionLoaded = true;
-  }
-
+  const Tpetra_Vector& diff = computeDiffT(current_time, xT);
 
-  // Build a vector to hold the difference between the actual and reference solutions
-  Tpetra_Vector diffT(xT.getMap());
-
-  double normval;
   Norm vec_op;
-
-  // The diff vector equals 1.0 * soln + -1.0 * reference
-  diffT.update(1.0,xT,-1.0,*RefSolnT,0.0); 
-
-  // Print vectors for debugging
-/*
-  std::cout << "Difference from evaluate response" << std::endl;
-  diff.Print(std::cout);
-  std::cout << "Solution from evaluate response" << std::endl;
-  x.Print(std::cout);
-  std::cout << "Ref solution from evaluate response" << std::endl;
-  RefSoln->Print(std::cout);
-*/
-
-  // Get the norm
-  //normval = vec_op.Norm(diff);
-
-  //g[0]=normval;
+  gT.getDataNonConst()[0] = vec_op.NormT(diff);
 }
 
 template<class Norm>
@@ -149,7 +171,7 @@ evaluateGradient(const double current_time,
 
   if (!solutionLoaded) {
 //    MMFileStatus = EpetraExt::MatrixMarketFileToVector("reference_solution.dat",x.Map(),RefSoln);
-    MMFileStatus = MatrixMarketFileToVector("reference_solution.dat",x.Map(),RefSoln);
+    MMFileStatus = MatrixMarketFileToVector(refFile.c_str(),x.Map(),RefSoln);
 
     TEUCHOS_TEST_FOR_EXCEPTION(MMFileStatus, std::runtime_error,
       std::endl << "EpetraExt::MatrixMarketFileToVector, file " __FILE__
@@ -217,6 +239,30 @@ evaluateGradientT(const double current_time,
 		 Tpetra_MultiVector* dg_dxdotdotT,
 		 Tpetra_MultiVector* dg_dpT)
 {
+  // The response and dg/dx both come from the same difference
+  if (gT != NULL || dg_dxT != NULL) {
+    const Tpetra_Vector& diff = computeDiffT(current_time, xT);
+
+    // Evaluate response g
+    if (gT != NULL) {
+      Norm vec_op;
+      gT->getDataNonConst()[0] = vec_op.NormT(diff);
+    }
+
+    // Evaluate dg/dx
+    if (dg_dxT != NULL)
+      dg_dxT->getVectorNonConst(0)->update(2.0,diff,0.0);
+  }
+
+  // Evaluate dg/dxdot
+  if (dg_dxdotT != NULL)
+    dg_dxdotT->putScalar(0.0);
+  if (dg_dxdotdotT != NULL)
+    dg_dxdotdotT->putScalar(0.0);
+
+  // Evaluate dg/dp
+  if (dg_dpT != NULL)
+    dg_dpT->putScalar(0.0);
 }
 
 //! Evaluate distributed parameter derivative dg/dp
@@ -583,3 +629,58 @@ MatrixMarketFileToTpetraMultiVector( const char *filename, const Tpetra_Map & ma
   return(0);
 }
 
+
+template<class Norm>
+int 
+Albany::SolutionFileResponseFunction<Norm>::
+BinaryFileToTpetraVector( const char *filename, const Tpetra_Map & mapT, Tpetra_Vector * & AT) {
+
+  std::ifstream handle(filename, std::ios::binary);
+  if (!handle)
+    // file not found
+    TEUCHOS_TEST_FOR_EXCEPTION(true, std::runtime_error,
+      std::endl << "Reference solution file \" " << filename << " \" not found"
+      << std::endl);
+
+  // Header: number of rows and of vectors, as int64
+  std::int64_t M, N;
+  handle.read(reinterpret_cast<char*>(&M), sizeof(M));
+  handle.read(reinterpret_cast<char*>(&N), sizeof(N));
+
+  TEUCHOS_TEST_FOR_EXCEPTION(!handle || N != 1 ||
+      M != static_cast<std::int64_t>(mapT.getGlobalNumElements()),
+    std::runtime_error,
+    std::endl << "Reference solution file " << filename << " must hold one vector of "
+    << mapT.getGlobalNumElements() << " rows." << std::endl);
+
+  if (mapT.getComm()->getRank() == 0) {
+    std::cout << "Reading reference solution from binary file \"" << filename << "\"" << std::endl;
+    std::cout << "Reference solution contains " << N << " vectors, each with " << M << " rows." << std::endl;
+    std::cout << std::endl;
+  }
+
+  AT = new Tpetra_Vector(Teuchos::rcpFromRef(mapT));
+  Teuchos::ArrayRCP<ST> vT = AT->get1dViewNonConst();
+
+  // Each rank reads the runs of consecutive GIDs it owns, and nothing else
+  const std::streamoff header = 2*sizeof(std::int64_t);
+  const size_t numMyElements = mapT.getNodeNumElements();
+  size_t i = 0;
+  while (i < numMyElements) {
+    const Tpetra_GO first = mapT.getGlobalElement(i);
+    size_t len = 1;
+    while (i+len < numMyElements && mapT.getGlobalElement(i+len) == first+static_cast<Tpetra_GO>(len))
+      ++len;
+
+    handle.seekg(header + static_cast<std::streamoff>(first)*sizeof(ST));
+    handle.read(reinterpret_cast<char*>(&vT[i]), len*sizeof(ST));
+    if (!handle)
+      TEUCHOS_TEST_FOR_EXCEPTION(true, std::runtime_error,
+        std::endl << "Reference solution file: cannot read rows " << first << " to "
+        << first+len-1 << " in file." << std::endl);
+
+    i += len;
+  }
+
+  return(0);
+}
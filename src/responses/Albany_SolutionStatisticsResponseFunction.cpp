@@ -0,0 +1,320 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+
+#include "Albany_SolutionStatisticsResponseFunction.hpp"
+#include "Teuchos_CommHelpers.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Layout of the buffer reduced in one collective
+enum { MAX, MAX_GID, MIN, MIN_GID, SUM_SQUARES, SUM, COUNT, NUM_STATISTICS };
+
+//! Max and min with their global ids (the smallest on ties, as
+//! MPI_MAXLOC/MPI_MINLOC do), and the sums, over the ranks
+class StatisticsReductionOp :
+  public Teuchos::ValueTypeReductionOp<int, double> {
+public:
+  void reduce (const int count, const double inBuffer[],
+               double inoutBuffer[]) const {
+    for (int i = 0; i + NUM_STATISTICS <= count; i += NUM_STATISTICS) {
+      const double* in = inBuffer + i;
+      double* inout = inoutBuffer + i;
+      if (in[MAX] > inout[MAX] ||
+          (in[MAX] == inout[MAX] && in[MAX_GID] < inout[MAX_GID])) {
+        inout[MAX] = in[MAX];
+        inout[MAX_GID] = in[MAX_GID];
+      }
+      if (in[MIN] < inout[MIN] ||
+          (in[MIN] == inout[MIN] && in[MIN_GID] < inout[MIN_GID])) {
+        inout[MIN] = in[MIN];
+        inout[MIN_GID] = in[MIN_GID];
+      }
+      inout[SUM_SQUARES] += in[SUM_SQUARES];
+      inout[SUM] += in[SUM];
+      inout[COUNT] += in[COUNT];
+    }
+  }
+};
+
+}
+
+Albany::SolutionStatisticsResponseFunction::
+SolutionStatisticsResponseFunction(const Teuchos::RCP<const Teuchos_Comm>& commT,
+				   int neq_, int eq_, bool interleavedOrdering_) :
+  SamplingBasedScalarResponseFunction(commT),
+  commT_(commT),
+  neq(neq_), eq(eq_), interleavedOrdering(interleavedOrdering_)
+{
+}
+
+Albany::SolutionStatisticsResponseFunction::
+~SolutionStatisticsResponseFunction()
+{
+}
+
+unsigned int
+Albany::SolutionStatisticsResponseFunction::
+numResponses() const
+{
+  return 4;
+}
+
+void
+Albany::SolutionStatisticsResponseFunction::
+evaluateResponseT(const double current_time,
+		 const Tpetra_Vector* xdotT,
+		 const Tpetra_Vector* xdotdotT,
+		 const Tpetra_Vector& xT,
+		 const Teuchos::Array<ParamVec>& p,
+		 Tpetra_Vector& gT)
+{
+  Teuchos::RCP<const Tpetra_Map> mapT = xT.getMap();
+  Teuchos::ArrayRCP<const ST> xT_constView = xT.get1dView();
+  Statistics stats;
+  computeStatistics(xT_constView.getRawPtr(), xT.getLocalLength(),
+                    [&](int lid) { return mapT->getGlobalElement(lid); },
+                    stats);
+
+  Teuchos::ArrayRCP<ST> gT_nonconstView = gT.get1dViewNonConst();
+  gT_nonconstView[0] = stats.max;
+  gT_nonconstView[1] = stats.min;
+  gT_nonconstView[2] = stats.twoNorm;
+  gT_nonconstView[3] = stats.average;
+}
+
+void
+Albany::SolutionStatisticsResponseFunction::
+evaluateTangentT(const double alpha,
+		const double beta,
+		const double omega,
+		const double current_time,
+		bool sum_derivs,
+		const Tpetra_Vector* xdotT,
+		const Tpetra_Vector* xdotdotT,
+		const Tpetra_Vector& xT,
+		const Teuchos::Array<ParamVec>& p,
+		ParamVec* deriv_p,
+		const Tpetra_MultiVector* VxdotT,
+		const Tpetra_MultiVector* VxdotdotT,
+		const Tpetra_MultiVector* VxT,
+		const Tpetra_MultiVector* VpT,
+		Tpetra_Vector* gT,
+		Tpetra_MultiVector* gxT,
+		Tpetra_MultiVector* gpT)
+{
+  // Evaluate tangent of g = dg/dx*dx/dp + dg/dxdot*dxdot/dp + dg/dp
+  Teuchos::RCP<Tpetra_MultiVector> dgdxT;
+  if (gxT != NULL)
+    dgdxT = Teuchos::rcp(new Tpetra_MultiVector(xT.getMap(), numResponses()));
+  evaluateGradientT(current_time, xdotT, xdotdotT, xT, p, deriv_p, gT,
+                    dgdxT.get(), NULL, NULL, gpT);
+
+  if (gxT != NULL) {
+    Teuchos::ETransp T = Teuchos::TRANS;
+    Teuchos::ETransp N = Teuchos::NO_TRANS;
+    if (VxT != NULL)
+      gxT->multiply(T, N, alpha, *dgdxT, *VxT, 0.0);
+    else
+      gxT->update(alpha, *dgdxT, 0.0);
+  }
+}
+
+#if defined(ALBANY_EPETRA)
+void
+Albany::SolutionStatisticsResponseFunction::
+evaluateGradient(const double current_time,
+		 const Epetra_Vector* xdot,
+		 const Epetra_Vector* xdotdot,
+		 const Epetra_Vector& x,
+		 const Teuchos::Array<ParamVec>& p,
+		 ParamVec* deriv_p,
+		 Epetra_Vector* g,
+		 Epetra_MultiVector* dg_dx,
+		 Epetra_MultiVector* dg_dxdot,
+		 Epetra_MultiVector* dg_dxdotdot,
+		 Epetra_MultiVector* dg_dp)
+{
+  Statistics stats;
+  computeStatistics(x.Values(), x.MyLength(),
+                    [&](int lid) { return x.Map().GID(lid); }, stats);
+
+  // Evaluate response g
+  if (g != NULL) {
+    (*g)[0] = stats.max;
+    (*g)[1] = stats.min;
+    (*g)[2] = stats.twoNorm;
+    (*g)[3] = stats.average;
+  }
+
+  // Evaluate dg/dx
+  if (dg_dx != NULL) {
+    const int lidMax = x.Map().LID(static_cast<int>(stats.maxGID));
+    const int lidMin = x.Map().LID(static_cast<int>(stats.minGID));
+    for (int j=0; j<dg_dx->NumVectors(); j++)
+      fillGradient(x.Values(), x.MyLength(), stats, lidMax, lidMin, j,
+                   (*dg_dx)[j]);
+  }
+
+  // Evaluate dg/dxdot
+  if (dg_dxdot != NULL)
+    dg_dxdot->PutScalar(0.0);
+  if (dg_dxdotdot != NULL)
+    dg_dxdotdot->PutScalar(0.0);
+
+  // Evaluate dg/dp
+  if (dg_dp != NULL)
+    dg_dp->PutScalar(0.0);
+}
+#endif
+
+void
+Albany::SolutionStatisticsResponseFunction::
+evaluateGradientT(const double current_time,
+		 const Tpetra_Vector* xdotT,
+		 const Tpetra_Vector* xdotdotT,
+		 const Tpetra_Vector& xT,
+		 const Teuchos::Array<ParamVec>& p,
+		 ParamVec* deriv_p,
+		 Tpetra_Vector* gT,
+		 Tpetra_MultiVector* dg_dxT,
+		 Tpetra_MultiVector* dg_dxdotT,
+		 Tpetra_MultiVector* dg_dxdotdotT,
+		 Tpetra_MultiVector* dg_dpT)
+{
+  Teuchos::RCP<const Tpetra_Map> mapT = xT.getMap();
+  Teuchos::ArrayRCP<const ST> xT_constView = xT.get1dView();
+  Statistics stats;
+  computeStatistics(xT_constView.getRawPtr(), xT.getLocalLength(),
+                    [&](int lid) { return mapT->getGlobalElement(lid); },
+                    stats);
+
+  // Evaluate response g
+  if (gT != NULL) {
+    Teuchos::ArrayRCP<ST> gT_nonconstView = gT->get1dViewNonConst();
+    gT_nonconstView[0] = stats.max;
+    gT_nonconstView[1] = stats.min;
+    gT_nonconstView[2] = stats.twoNorm;
+    gT_nonconstView[3] = stats.average;
+  }
+
+  // Evaluate dg/dx
+  if (dg_dxT != NULL) {
+    const int lidMax = mapT->getLocalElement(stats.maxGID);
+    const int lidMin = mapT->getLocalElement(stats.minGID);
+    for (int j=0; j<dg_dxT->getNumVectors(); j++) {
+      Teuchos::ArrayRCP<ST> dg_dxT_nonconstView = dg_dxT->getDataNonConst(j);
+      fillGradient(xT_constView.getRawPtr(), xT.getLocalLength(), stats,
+                   lidMax, lidMin, j, dg_dxT_nonconstView.getRawPtr());
+    }
+  }
+
+  // Evaluate dg/dxdot
+  if (dg_dxdotT != NULL)
+    dg_dxdotT->putScalar(0.0);
+  if (dg_dxdotdotT != NULL)
+    dg_dxdotdotT->putScalar(0.0);
+
+  // Evaluate dg/dp
+  if (dg_dpT != NULL)
+    dg_dpT->putScalar(0.0);
+}
+
+//! Evaluate distributed parameter derivative dg/dp
+void
+Albany::SolutionStatisticsResponseFunction::
+evaluateDistParamDerivT(
+    const double current_time,
+    const Tpetra_Vector* xdotT,
+    const Tpetra_Vector* xdotdotT,
+    const Tpetra_Vector& xT,
+    const Teuchos::Array<ParamVec>& param_array,
+    const std::string& dist_param_name,
+    Tpetra_MultiVector* dg_dpT)
+{
+  if (dg_dpT) {
+      dg_dpT->putScalar(0.0);
+  }
+}
+
+template <typename GIDFunctor>
+void
+Albany::SolutionStatisticsResponseFunction::
+computeStatistics(const ST* x, int length, const GIDFunctor& gid,
+                  Statistics& stats) const
+{
+  const double huge = std::numeric_limits<double>::max();
+  double my_stats[NUM_STATISTICS] = {-huge, huge, huge, huge, 0.0, 0.0, 0.0};
+  int lidMax = -1, lidMin = -1;
+
+  // One pass over the nodes for equation eq
+  const int num_my_nodes = length / neq;
+  for (int node=0; node<num_my_nodes; node++) {
+    const int index = localIndex(node, num_my_nodes);
+    const ST value = x[index];
+    if (value > my_stats[MAX]) {
+      my_stats[MAX] = value;
+      lidMax = index;
+    }
+    if (value < my_stats[MIN]) {
+      my_stats[MIN] = value;
+      lidMin = index;
+    }
+    my_stats[SUM_SQUARES] += value*value;
+    my_stats[SUM] += value;
+  }
+  my_stats[COUNT] = num_my_nodes;
+  if (lidMax >= 0) my_stats[MAX_GID] = gid(lidMax);
+  if (lidMin >= 0) my_stats[MIN_GID] = gid(lidMin);
+
+  // One collective for all the statistics
+  double global_stats[NUM_STATISTICS];
+  Teuchos::reduceAll(*commT_, StatisticsReductionOp(), NUM_STATISTICS,
+                     my_stats, global_stats);
+
+  stats.max = global_stats[MAX];
+  stats.min = global_stats[MIN];
+  stats.maxGID = static_cast<GO>(global_stats[MAX_GID]);
+  stats.minGID = static_cast<GO>(global_stats[MIN_GID]);
+  stats.count = static_cast<GO>(global_stats[COUNT]);
+  stats.twoNorm = std::sqrt(global_stats[SUM_SQUARES]);
+  stats.average =
+    global_stats[COUNT] > 0 ? global_stats[SUM] / global_stats[COUNT] : 0.0;
+}
+
+void
+Albany::SolutionStatisticsResponseFunction::
+fillGradient(const ST* x, int length, const Statistics& stats,
+             int lidMax, int lidMin, int response, ST* dg_dx) const
+{
+  for (int i=0; i<length; i++)
+    dg_dx[i] = 0.0;
+
+  const int num_my_nodes = length / neq;
+  switch (response) {
+  case 0:
+    if (lidMax >= 0) dg_dx[lidMax] = 1.0;
+    break;
+  case 1:
+    if (lidMin >= 0) dg_dx[lidMin] = 1.0;
+    break;
+  case 2:
+    if (stats.twoNorm > 0.0)
+      for (int node=0; node<num_my_nodes; node++) {
+        const int index = localIndex(node, num_my_nodes);
+        dg_dx[index] = x[index] / stats.twoNorm;
+      }
+    break;
+  case 3:
+    if (stats.count > 0)
+      for (int node=0; node<num_my_nodes; node++)
+        dg_dx[localIndex(node, num_my_nodes)] = 1.0 / stats.count;
+    break;
+  }
+}
@@ -0,0 +1,157 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+
+#ifndef ALBANY_SOLUTIONSTATISTICSRESPONSEFUNCTION_HPP
+#define ALBANY_SOLUTIONSTATISTICSRESPONSEFUNCTION_HPP
+
+#include "Albany_SamplingBasedScalarResponseFunction.hpp"
+
+namespace Albany {
+
+  /*!
+   * \brief Max, min, two norm and average of one equation of the solution
+   *
+   * The four responses, in that order, are computed in one pass over the
+   * local entries and one collective, instead of one collective per
+   * statistic (two for the max and min values with their locations) as
+   * separate Solution Max Value, Solution Min Value, Solution Two Norm and
+   * Solution Average responses would need.
+   */
+  class SolutionStatisticsResponseFunction :
+    public SamplingBasedScalarResponseFunction {
+  public:
+
+    //! Default constructor
+    SolutionStatisticsResponseFunction(
+      const Teuchos::RCP<const Teuchos_Comm>& commT,
+      int neq = 1, int eq = 0, bool interleavedOrdering=true);
+
+    //! Destructor
+    virtual ~SolutionStatisticsResponseFunction();
+
+    //! Get the number of responses
+    virtual unsigned int numResponses() const;
+
+    //! Evaluate responses
+    virtual void
+    evaluateResponseT(const double current_time,
+		     const Tpetra_Vector* xdotT,
+		     const Tpetra_Vector* xdotdotT,
+		     const Tpetra_Vector& xT,
+		     const Teuchos::Array<ParamVec>& p,
+		     Tpetra_Vector& gT);
+
+    //! Evaluate tangent = dg/dx*dx/dp + dg/dxdot*dxdot/dp + dg/dp
+    virtual void
+    evaluateTangentT(const double alpha,
+		    const double beta,
+		    const double omega,
+		    const double current_time,
+		    bool sum_derivs,
+		    const Tpetra_Vector* xdot,
+		    const Tpetra_Vector* xdotdot,
+		    const Tpetra_Vector& x,
+		    const Teuchos::Array<ParamVec>& p,
+		    ParamVec* deriv_p,
+		    const Tpetra_MultiVector* Vxdot,
+		    const Tpetra_MultiVector* Vxdotdot,
+		    const Tpetra_MultiVector* Vx,
+		    const Tpetra_MultiVector* Vp,
+		    Tpetra_Vector* g,
+		    Tpetra_MultiVector* gx,
+		    Tpetra_MultiVector* gp);
+
+#if defined(ALBANY_EPETRA)
+    //! Evaluate gradient = dg/dx, dg/dxdot, dg/dp
+    virtual void
+    evaluateGradient(const double current_time,
+		     const Epetra_Vector* xdot,
+		     const Epetra_Vector* xdotdot,
+		     const Epetra_Vector& x,
+		     const Teuchos::Array<ParamVec>& p,
+		     ParamVec* deriv_p,
+		     Epetra_Vector* g,
+		     Epetra_MultiVector* dg_dx,
+		     Epetra_MultiVector* dg_dxdot,
+		     Epetra_MultiVector* dg_dxdotdot,
+		     Epetra_MultiVector* dg_dp);
+#endif
+
+    //! Evaluate gradient = dg/dx, dg/dxdot, dg/dp - Tpetra version
+    virtual void
+    evaluateGradientT(const double current_time,
+		     const Tpetra_Vector* xdotT,
+		     const Tpetra_Vector* xdotdotT,
+		     const Tpetra_Vector& xT,
+		     const Teuchos::Array<ParamVec>& p,
+		     ParamVec* deriv_p,
+		     Tpetra_Vector* gT,
+		     Tpetra_MultiVector* dg_dxT,
+		     Tpetra_MultiVector* dg_dxdotT,
+		     Tpetra_MultiVector* dg_dxdotdotT,
+		     Tpetra_MultiVector* dg_dpT);
+
+    //! Evaluate distributed parameter derivative dg/dp
+    virtual void
+    evaluateDistParamDerivT(
+        const double current_time,
+        const Tpetra_Vector* xdotT,
+        const Tpetra_Vector* xdotdotT,
+        const Tpetra_Vector& xT,
+        const Teuchos::Array<ParamVec>& param_array,
+        const std::string& dist_param_name,
+        Tpetra_MultiVector* dg_dpT);
+
+  private:
+
+    //! Private to prohibit copying
+    SolutionStatisticsResponseFunction(const SolutionStatisticsResponseFunction&);
+
+    //! Private to prohibit copying
+    SolutionStatisticsResponseFunction& operator=(const SolutionStatisticsResponseFunction&);
+
+  protected:
+
+    //! Global statistics of equation eq
+    struct Statistics {
+      double max, min, twoNorm, average;
+      //! Global ids of the max and min values, the smallest one on ties
+      GO maxGID, minGID;
+      //! Number of entries of equation eq
+      GO count;
+    };
+
+    //! Number of equations per node
+    int neq;
+
+    //! Equation we want the statistics of
+    int eq;
+
+    Teuchos::RCP<const Teuchos_Comm> commT_;
+
+    //! Flag for interleaved verus blocked unknown ordering
+    bool interleavedOrdering;
+
+    //! Local index of the entry of equation eq at node
+    int localIndex(int node, int num_my_nodes) const {
+      return interleavedOrdering ? node*neq+eq : node + eq*num_my_nodes;
+    }
+
+    //! Compute the statistics of the local entries x[0:length), one collective
+    template <typename GIDFunctor>
+    void computeStatistics(const ST* x, int length, const GIDFunctor& gid,
+                           Statistics& stats) const;
+
+    //! Write the four responses as one column of dg/dx
+    void fillGradient(const ST* x, int length, const Statistics& stats,
+                      int lidMax, int lidMin, int response,
+                      ST* dg_dx) const;
+  };
+
+}
+
+#endif // ALBANY_SOLUTIONSTATISTICSRESPONSEFUNCTION_HPP
@@ -157,8 +157,13 @@ namespace Albany {
     Teuchos::RCP<SolutionCullingStrategyBase> cullingStrategy_;
 #if defined(ALBANY_EPETRA)
     Teuchos::RCP<Epetra_Import> solutionImporter_;
+    Teuchos::RCP<const Epetra_BlockMap> solutionMap_;
+    //! Selected GIDs of the current importer, kept for the printer
+    Teuchos::Array<int> selectedGIDs_;
 #endif
     Teuchos::RCP<Tpetra_Import> solutionImporterT_;
+    //! Selected GIDs of the current importer, kept for the printer
+    Teuchos::Array<Tpetra_GO> selectedGIDsT_;
 
     class SolutionPrinter;
     Teuchos::RCP<SolutionPrinter> sol_printer_;
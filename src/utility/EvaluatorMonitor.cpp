@@ -0,0 +1,86 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// @HEADER
+
+#include "EvaluatorMonitor.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "DisplayTable.hpp"
+
+namespace util {
+
+void EvaluatorMonitor::declareCost (const string &name, double bytesPerCell,
+                                    double flopsPerCell) {
+  costs_[name] = std::make_pair(bytesPerCell, flopsPerCell);
+}
+
+void EvaluatorMonitor::record (const string &name, double time, double calls,
+                               double cells) {
+  Entry &entry = entries_[name];
+  entry.time  += time;
+  entry.calls += calls;
+  entry.cells += cells;
+}
+
+void EvaluatorMonitor::summarize (
+    Teuchos::Ptr<const Teuchos::Comm<int> > comm, std::ostream &out) const {
+  if (comm->getRank() != 0 || entries_.empty())
+    return;
+
+  std::vector<std::pair<string, Entry> > sorted(entries_.begin(),
+                                                entries_.end());
+  std::sort(sorted.begin(), sorted.end(),
+            [](const std::pair<string, Entry> &a,
+               const std::pair<string, Entry> &b) {
+              return a.second.time > b.second.time;
+            });
+
+  double totalTime = 0;
+  for (auto iter : sorted)
+    totalTime += iter.second.time;
+
+  DisplayTable table;
+  table.addRow("Evaluator", "Time (s)", "Time (%)", "Calls", "Cells",
+               "Bytes/Cell", "Flops/Cell", "GB/s", "GFLOP/s", "Flops/Byte");
+
+  double costTime = 0, costBytes = 0, costFlops = 0;
+  for (auto iter : sorted) {
+    const Entry &entry = iter.second;
+    const double percent = totalTime > 0 ? 100 * entry.time / totalTime : 0;
+    auto cost = costs_.find(iter.first);
+    const std::size_t type = iter.first.find("] ");
+    if (cost == costs_.end() && iter.first[0] == '[' && type != string::npos)
+      cost = costs_.find(iter.first.substr(type + 2));
+    if (cost == costs_.end() || entry.time <= 0) {
+      table.addRow(iter.first, entry.time, percent, entry.calls, entry.cells,
+                   "", "", "", "", "");
+      continue;
+    }
+    const double bytes = cost->second.first * entry.cells;
+    const double flops = cost->second.second * entry.cells;
+    costTime  += entry.time;
+    costBytes += bytes;
+    costFlops += flops;
+    table.addRow(iter.first, entry.time, percent, entry.calls, entry.cells,
+                 cost->second.first, cost->second.second,
+                 1e-9 * bytes / entry.time, 1e-9 * flops / entry.time,
+                 bytes > 0 ? flops / bytes : 0.0);
+  }
+
+  table.addRow("Total", totalTime, 100.0, "", "", "", "", "", "", "");
+  if (costTime > 0)
+    table.addRow("Total with declared cost", costTime,
+                 totalTime > 0 ? 100 * costTime / totalTime : 0, "", "", "",
+                 "", 1e-9 * costBytes / costTime, 1e-9 * costFlops / costTime,
+                 costBytes > 0 ? costFlops / costBytes : 0.0);
+
+  table.writeCSV(out);
+}
+
+}
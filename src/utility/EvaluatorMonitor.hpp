@@ -0,0 +1,70 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// @HEADER
+
+#ifndef UTIL_EVALUATORMONITOR_HPP
+#define UTIL_EVALUATORMONITOR_HPP
+
+/**
+ *  \file EvaluatorMonitor.hpp
+ *
+ *  \brief Time, work and a roofline-style summary of the evaluators of the
+ *  field managers.
+ */
+
+#include <Teuchos_Comm.hpp>
+#include <Teuchos_PtrDecl.hpp>
+#include <iostream>
+#include <map>
+
+#include "string.hpp"
+
+namespace util {
+
+class EvaluatorMonitor {
+public:
+
+  /**
+   *  \brief Declare the bytes moved and flops done per cell by an evaluator
+   *
+   *  Costs are matched against the names passed to record, with or without
+   *  a leading "[<evaluation type>] ".
+   */
+  void declareCost (const string &name, double bytesPerCell,
+                    double flopsPerCell);
+
+  //! Add time (in seconds), calls and cells to an evaluator
+  void record (const string &name, double time, double calls, double cells);
+
+  bool empty () const {
+    return entries_.empty();
+  }
+
+  /**
+   *  \brief Write the evaluators, slowest first, as CSV on rank 0
+   *
+   *  Achieved bandwidth, flop rate and arithmetic intensity are reported for
+   *  the evaluators with a declared cost, followed by their total.
+   */
+  void summarize (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                  std::ostream &out = std::cout) const;
+
+private:
+
+  struct Entry {
+    double time  = 0;
+    double calls = 0;
+    double cells = 0;
+  };
+
+  std::map<string, Entry>                     entries_;
+  std::map<string, std::pair<double, double> > costs_;
+};
+
+}
+
+#endif  // UTIL_EVALUATORMONITOR_HPP
@@ -15,9 +15,13 @@
  *  \brief 
  */
 
+#include <Teuchos_TimeMonitor.hpp>
+
 #include "TimeMonitor.hpp"
 #include "CounterMonitor.hpp"
 #include "VariableMonitor.hpp"
+#include "PhaseMonitor.hpp"
+#include "EvaluatorMonitor.hpp"
 
 namespace util {
 class PerformanceContext {
@@ -40,6 +44,14 @@ public:
   VariableMonitor& variableMonitor () {
     return variableMonitor_;
   }
+
+  PhaseMonitor& phaseMonitor () {
+    return phaseMonitor_;
+  }
+
+  EvaluatorMonitor& evaluatorMonitor () {
+    return evaluatorMonitor_;
+  }
   
 private:
   
@@ -48,7 +60,21 @@ private:
   TimeMonitor     timeMonitor_;
   CounterMonitor  counterMonitor_;
   VariableMonitor variableMonitor_;
+  PhaseMonitor    phaseMonitor_;
+  EvaluatorMonitor evaluatorMonitor_;
 };
 }
 
+/**
+ *  \brief TEUCHOS_FUNC_TIME_MONITOR that also opens a phase of the same name in
+ *  the PerformanceContext's PhaseMonitor, for the rest of the scope
+ *
+ *  The Teuchos timer keeps the flat timer summary unchanged, while the phase
+ *  places the time under the phases open at the call.
+ */
+#define UTIL_FUNC_PHASE_MONITOR(NAME)                                       \
+  TEUCHOS_FUNC_TIME_MONITOR(NAME);                                          \
+  util::PhaseGuard utilPhaseGuard(                                          \
+      util::PerformanceContext::instance().phaseMonitor(), NAME)
+
 #endif  // UTIL_PERFORMANCECONTEXT_HPP
@@ -0,0 +1,157 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// @HEADER
+
+#include "PhaseMonitor.hpp"
+
+#include <Kokkos_Core.hpp>
+#include <Teuchos_CommHelpers.hpp>
+#include <Teuchos_TestForException.hpp>
+#include <Teuchos_Time.hpp>
+#include <iomanip>
+
+#include "Albany_Memory.hpp"
+
+namespace util {
+
+void PhaseMonitor::start (const string &name) {
+  const string path =
+      open_.empty() ? name : phases_[open_.back().first].path + "/" + name;
+
+  auto pos = index_.find(path);
+  if (pos == index_.end()) {
+    const Phase phase = {path, name, static_cast<int>(open_.size()), 0, 0.0, 0};
+    pos = index_.insert(std::make_pair(path, phases_.size())).first;
+    phases_.push_back(phase);
+  }
+  open_.push_back(std::make_pair(pos->second, Teuchos::Time::wallTime()));
+#if defined(KOKKOS_ENABLE_PROFILING)
+  // Phases show up as regions in Kokkos tools such as Caliper
+  Kokkos::Profiling::pushRegion(path);
+#endif
+}
+
+void PhaseMonitor::stop () {
+  TEUCHOS_TEST_FOR_EXCEPTION(open_.empty(), std::logic_error,
+                             "PhaseMonitor::stop called with no open phase\n");
+  Phase &phase = phases_[open_.back().first];
+  phase.time += Teuchos::Time::wallTime() - open_.back().second;
+  phase.calls += 1;
+  phase.peakRSS = Albany::getPeakResidentSetSize();
+  open_.pop_back();
+#if defined(KOKKOS_ENABLE_PROFILING)
+  Kokkos::Profiling::popRegion();
+#endif
+}
+
+namespace {
+
+//! Min, max, average and rank of the max of x over the ranks
+template <typename Stats>
+void reduceStats (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                  std::vector<double> &x, std::vector<Stats> &stats) {
+  const int n = x.size();
+  stats.resize(n);
+  if (n == 0) return;
+  const int rank = comm->getRank();
+  const int nprocs = comm->getSize();
+  std::vector<double> min(n), max(n), sum(n);
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MIN, n, &x[0], &min[0]);
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MAX, n, &x[0], &max[0]);
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_SUM, n, &x[0], &sum[0]);
+  // Lowest rank that has the max
+  std::vector<int> candidate(n), maxRank(n);
+  for (int i = 0; i < n; ++i)
+    candidate[i] = x[i] == max[i] ? rank : nprocs;
+  Teuchos::reduceAll(*comm, Teuchos::REDUCE_MIN, n, &candidate[0], &maxRank[0]);
+  for (int i = 0; i < n; ++i) {
+    const Stats s = {min[i], max[i], sum[i] / nprocs, maxRank[i]};
+    stats[i] = s;
+  }
+}
+
+}
+
+void PhaseMonitor::gather (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                           std::vector<std::size_t> &order,
+                           std::vector<Stats> &timeStats,
+                           std::vector<Stats> &rssStats) const {
+  // Use the phases of rank 0 on all ranks
+  string paths;
+  for (const Phase &phase : phases_)
+    paths += phase.path + '\n';
+  int size = paths.size();
+  Teuchos::broadcast(*comm, 0, &size);
+  paths.resize(size);
+  if (size > 0)
+    Teuchos::broadcast(*comm, 0, size, &paths[0]);
+
+  order.clear();
+  std::vector<double> time, rss;
+  for (std::size_t begin = 0, end; begin < paths.size(); begin = end + 1) {
+    end = paths.find('\n', begin);
+    const auto pos = index_.find(paths.substr(begin, end - begin));
+    const bool found = pos != index_.end();
+    order.push_back(found ? pos->second : phases_.size());
+    time.push_back(found ? phases_[pos->second].time : 0.0);
+    rss.push_back(found ? phases_[pos->second].peakRSS : 0.0);
+  }
+
+  reduceStats(comm, time, timeStats);
+  reduceStats(comm, rss, rssStats);
+}
+
+void PhaseMonitor::writeJSON (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                              std::ostream &out) const {
+  std::vector<std::size_t> order;
+  std::vector<Stats> time, rss;
+  gather(comm, order, time, rss);
+  if (comm->getRank() != 0) return;
+
+  const auto stats = [&](const Stats &s) {
+    out << "{\"min\": " << s.min << ", \"max\": " << s.max << ", \"avg\": "
+        << s.avg << ", \"max_rank\": " << s.maxRank << ", \"imbalance\": "
+        << (s.avg > 0.0 ? s.max / s.avg : 1.0) << "}";
+  };
+
+  out << std::setprecision(6) << "{\n  \"ranks\": " << comm->getSize()
+      << ",\n  \"phases\": [";
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    // Phases are found on rank 0
+    const Phase &phase = phases_[order[i]];
+    out << (i > 0 ? "," : "") << "\n    {\"path\": \"" << phase.path
+        << "\", \"name\": \"" << phase.name << "\", \"depth\": " << phase.depth
+        << ", \"calls\": " << phase.calls << ",\n     \"time\": ";
+    stats(time[i]);
+    out << ",\n     \"peak_rss_kb\": ";
+    stats(rss[i]);
+    out << "}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+void PhaseMonitor::writeCSV (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                             std::ostream &out) const {
+  std::vector<std::size_t> order;
+  std::vector<Stats> time, rss;
+  gather(comm, order, time, rss);
+  if (comm->getRank() != 0) return;
+
+  out << std::setprecision(6)
+      << "Path,Depth,Calls,Time Min (s),Time Avg (s),Time Max (s),"
+         "Slowest Rank,Peak RSS Min (KB),Peak RSS Avg (KB),"
+         "Peak RSS Max (KB),Largest Rank\n";
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    const Phase &phase = phases_[order[i]];
+    out << "\"" << phase.path << "\"," << phase.depth << "," << phase.calls
+        << "," << time[i].min << "," << time[i].avg << "," << time[i].max
+        << "," << time[i].maxRank << "," << rss[i].min << "," << rss[i].avg
+        << "," << rss[i].max << "," << rss[i].maxRank << "\n";
+  }
+}
+
+}
@@ -0,0 +1,117 @@
+//*****************************************************************//
+//    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+//    This Software is released under the BSD license detailed     //
+//    in the file "license.txt" in the top-level Albany directory  //
+//*****************************************************************//
+
+// @HEADER
+
+#ifndef UTIL_PHASEMONITOR_HPP
+#define UTIL_PHASEMONITOR_HPP
+
+/**
+ *  \file PhaseMonitor.hpp
+ *  
+ *  \brief Hierarchical wall time and peak memory of named phases, e.g. the
+ *  setup phases of an Application.
+ */
+
+#include <Teuchos_Comm.hpp>
+#include <Teuchos_PtrDecl.hpp>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "string.hpp"
+
+namespace util {
+
+class PhaseMonitor {
+public:
+
+  /**
+   *  \brief Open a phase nested in the innermost open phase
+   *
+   *  A phase opened again under the same parent accumulates its time. With
+   *  Kokkos profiling enabled the phase is also pushed as a region named by
+   *  its path, so a tool loaded through KOKKOS_PROFILE_LIBRARY nests the
+   *  labeled evaluator kernels under it.
+   */
+  void start (const string &name);
+
+  //! Close the innermost open phase
+  void stop ();
+
+  bool empty () const {
+    return phases_.empty();
+  }
+
+  /**
+   *  \brief Write the phases and their min, max and average over the ranks as
+   *  JSON on rank 0.
+   *
+   *  Collective. Phases are listed in the order rank 0 first opened them, and
+   *  count as zero on ranks that did not open them. The slowest rank, or the
+   *  one with the largest peak, is listed with each maximum. Peak resident
+   *  set sizes are in KB and are zero unless Albany was built with
+   *  ENABLE_GETRUSAGE.
+   */
+  void writeJSON (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                  std::ostream &out) const;
+
+  //! Same as writeJSON, as one CSV row per phase
+  void writeCSV (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+                 std::ostream &out) const;
+
+private:
+
+  struct Phase {
+    string path;
+    string name;
+    int    depth;
+    int    calls;
+    double time;
+    long long peakRSS;
+  };
+
+  struct Stats {
+    double min;
+    double max;
+    double avg;
+    int    maxRank;
+  };
+
+  //! Collective. The phases of rank 0, as indices into phases_, and the
+  //! statistics of their times and peaks over the ranks
+  void gather (Teuchos::Ptr<const Teuchos::Comm<int> > comm,
+               std::vector<std::size_t> &order, std::vector<Stats> &time,
+               std::vector<Stats> &rss) const;
+
+  std::vector<Phase>            phases_;
+  std::map<string, std::size_t> index_;
+
+  //! Open phases and their start times
+  std::vector<std::pair<std::size_t, double> > open_;
+};
+
+//! Open a phase of a PhaseMonitor for the lifetime of the guard
+class PhaseGuard {
+public:
+
+  PhaseGuard (PhaseMonitor &monitor, const string &name)
+      : monitor_(monitor) {
+    monitor_.start(name);
+  }
+
+  ~PhaseGuard () {
+    monitor_.stop();
+  }
+
+private:
+
+  PhaseMonitor &monitor_;
+};
+
+}
+
+#endif  // UTIL_PHASEMONITOR_HPP
@@ -0,0 +1,169 @@
+##*****************************************************************//
+##    Albany 3.0:  Copyright 2016 Sandia Corporation               //
+##    This Software is released under the BSD license detailed     //
+##    in the file "license.txt" in the top-level Albany directory  //
+##*****************************************************************//
+
+# Strong or weak scaling study of one input, run with cmake -P.
+#
+#   -DEXECUTABLE=<AlbanyT>     executable to run
+#   -DINPUT=<input.xml>        input file
+#   -DRANKS="1;2;4"            MPI rank counts, the first is the reference
+#   -DMODE=strong|weak         weak multiplies the "1D Elements" of the
+#                              (TmplSTKMeshStruct) discretization by the
+#                              rank count over the reference rank count
+#   -DMPIEX, -DMPINPF, -DMPIPRE, -DMPIPOST   MPI launcher, as in the tests
+#   -DOUTPUT=<scaling.csv>     per-phase times and parallel efficiencies
+#   -DMIN_EFFICIENCY=<percent> fail if a phase falls below this efficiency
+#
+# Phases are read from the Teuchos::TimeMonitor summary of each run. The
+# maximum over the ranks is used when the summary has per-rank columns.
+
+# Seconds, in fixed or scientific notation, to integer microseconds, since
+# math() only does integer arithmetic
+function(to_microseconds out value)
+  set(exponent 0)
+  if(value MATCHES "^([0-9.]+)[eE]([+-]?[0-9]+)$")
+    set(value ${CMAKE_MATCH_1})
+    set(exponent ${CMAKE_MATCH_2})
+  endif()
+  string(REGEX MATCH "^([0-9]*)\\.?([0-9]*)$" match "${value}")
+  set(whole "${CMAKE_MATCH_1}")
+  set(fraction "${CMAKE_MATCH_2}000000")
+  string(SUBSTRING "${fraction}" 0 6 fraction)
+  string(REGEX REPLACE "^0+([0-9])" "\\1" whole "0${whole}")
+  string(REGEX REPLACE "^0+([0-9])" "\\1" fraction "${fraction}")
+  math(EXPR micro "${whole} * 1000000 + ${fraction}")
+  string(REGEX REPLACE "^\\+" "" exponent "${exponent}")
+  while(exponent GREATER 0)
+    math(EXPR micro "${micro} * 10")
+    math(EXPR exponent "${exponent} - 1")
+  endwhile()
+  while(exponent LESS 0)
+    math(EXPR micro "${micro} / 10")
+    math(EXPR exponent "${exponent} + 1")
+  endwhile()
+  set(${out} ${micro} PARENT_SCOPE)
+endfunction()
+
+if(NOT MODE)
+  set(MODE strong)
+endif()
+if(NOT OUTPUT)
+  set(OUTPUT scaling.csv)
+endif()
+separate_arguments(MPIPRE)
+separate_arguments(MPIPOST)
+
+set(phases
+  "Albany: Setup Time"
+  "Albany Fill: Residual"
+  "Albany Fill: Jacobian"
+  "Albany Fill: Jacobian Export"
+  "NOX Total Linear Solve"
+  "Albany: ***Total Time***")
+
+file(READ ${INPUT} inputText)
+list(GET RANKS 0 refRanks)
+
+foreach(ranks ${RANKS})
+  set(runInput ${INPUT})
+  if(MODE STREQUAL weak)
+    string(REGEX MATCH "name=\"1D Elements\" type=\"int\" value=\"([0-9]+)\""
+           match "${inputText}")
+    if(NOT match)
+      message(FATAL_ERROR "Weak scaling needs a \"1D Elements\" entry in ${INPUT}")
+    endif()
+    math(EXPR elements "${CMAKE_MATCH_1} * ${ranks} / ${refRanks}")
+    string(REGEX REPLACE "name=\"1D Elements\" type=\"int\" value=\"[0-9]+\""
+           "name=\"1D Elements\" type=\"int\" value=\"${elements}\""
+           runText "${inputText}")
+    get_filename_component(inputName ${INPUT} NAME_WE)
+    set(runInput ${inputName}_weak_${ranks}.xml)
+    file(WRITE ${runInput} "${runText}")
+  endif()
+
+  if(MPIEX)
+    set(command ${MPIEX} ${MPIPRE} ${MPINPF} ${ranks} ${MPIPOST} ${EXECUTABLE} ${runInput})
+  else()
+    set(command ${EXECUTABLE} ${runInput})
+  endif()
+  execute_process(COMMAND ${command}
+                  OUTPUT_VARIABLE runOutput ERROR_VARIABLE runError
+                  RESULT_VARIABLE runResult)
+  file(WRITE scaling_${MODE}_${ranks}.log "${runOutput}${runError}")
+  if(NOT runResult EQUAL 0)
+    message(FATAL_ERROR "Run on ${ranks} ranks failed, see scaling_${MODE}_${ranks}.log")
+  endif()
+
+  string(REPLACE ";" "\\;" runOutput "${runOutput}")
+  string(REPLACE "\n" ";" lines "${runOutput}")
+  foreach(phase ${phases})
+    string(MAKE_C_IDENTIFIER "${phase}" key)
+    set(time_${key}_${ranks} "")
+    foreach(line ${lines})
+      string(FIND "${line}" "${phase} " pos)
+      if(pos EQUAL -1)
+        continue()
+      endif()
+      string(LENGTH "${phase}" len)
+      math(EXPR start "${pos} + ${len}")
+      string(SUBSTRING "${line}" ${start} -1 rest)
+      # Skip longer timer names that start with this one
+      if(NOT rest MATCHES "^[ \t]+[0-9]")
+        continue()
+      endif()
+      # Columns are "time (calls)": one column in serial, min, mean, max
+      # and mean over calls in parallel
+      string(REGEX MATCHALL "[0-9.eE+-]+ \\([0-9]+\\)" columns "${rest}")
+      list(LENGTH columns numColumns)
+      if(numColumns GREATER 2)
+        list(GET columns 2 column)
+      else()
+        list(GET columns 0 column)
+      endif()
+      string(REGEX REPLACE " \\(.*" "" value "${column}")
+      set(time_${key}_${ranks} ${value})
+      break()
+    endforeach()
+  endforeach()
+endforeach()
+
+# Efficiency relative to the reference run, in percent: strong scaling
+# divides the reference work over more ranks, weak scaling keeps the work
+# per rank fixed.
+set(csv "Phase,Ranks,Time (s),Efficiency (%)\n")
+set(failures "")
+foreach(phase ${phases})
+  string(MAKE_C_IDENTIFIER "${phase}" key)
+  set(ref "${time_${key}_${refRanks}}")
+  foreach(ranks ${RANKS})
+    set(t "${time_${key}_${ranks}}")
+    if("${t}" STREQUAL "" OR "${ref}" STREQUAL "")
+      continue()
+    endif()
+    to_microseconds(refMicro ${ref})
+    to_microseconds(micro ${t})
+    if(micro EQUAL 0)
+      continue()
+    endif()
+    if(MODE STREQUAL weak)
+      math(EXPR efficiency "100 * ${refMicro} / ${micro}")
+    else()
+      math(EXPR efficiency
+           "100 * ${refMicro} * ${refRanks} / (${micro} * ${ranks})")
+    endif()
+    set(csv "${csv}\"${phase}\",${ranks},${t},${efficiency}\n")
+    message("${phase}: ${ranks} ranks, ${t} s, ${efficiency}% efficiency")
+    if(MIN_EFFICIENCY AND NOT ranks EQUAL refRanks)
+      if(efficiency LESS MIN_EFFICIENCY)
+        set(failures "${failures}\n  ${phase} on ${ranks} ranks: ${efficiency}%")
+      endif()
+    endif()
+  endforeach()
+endforeach()
+file(WRITE ${OUTPUT} "${csv}")
+
+if(failures)
+  message(FATAL_ERROR "Parallel efficiency below ${MIN_EFFICIENCY}%:${failures}")
+endif()